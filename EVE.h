@@ -6,12 +6,17 @@
 #include <ti/drivers/SPI.h>
 #include <ti/devices/msp432p4xx/inc/msp.h>
 
-SPI_Handle      spiHandle;
-SPI_Params      spiParams;
-SPI_Transaction spiTransaction;
+#define EVE_TXBUF_SIZE  1024
 
-uint8_t *txBuf, *rxBuf;
-int txIdx;
+extern SPI_Handle      spiHandle;
+extern SPI_Params      spiParams;
+extern SPI_Transaction spiTransaction;
+
+extern uint8_t txBuf[EVE_TXBUF_SIZE], rxBuf[EVE_TXBUF_SIZE];
+extern int txIdx;
+#define EVE_CHUNK_SIZE  1000 //payload bytes per burst when streaming data
+#define EVE_FLASH_SECTOR    4096 //flash update granularity
+#define EVE_FLASH_BLOB_SIZE 4096 //flash driver blob at the start of the flash
 
 // Display Settings
 #define PCLK		(2L)
@@ -336,6 +341,8 @@ int txIdx;
 #define REG_SOUND                 0x88
 #define REG_SWIZZLE               0x64
 #define REG_TAG                   0x7C
+#define REG_TOUCH_MODE            0x104
+#define REG_TOUCH_TAG             0x12C
 #define REG_TAG_X                 0x74
 #define REG_TAG_Y                 0x78
 #define REG_VCYCLE                0x40
@@ -439,6 +446,22 @@ int txIdx;
 #define NEAREST                    0
 #define BILINEAR                   1
 
+// Interrupt Flags
+#define INT_SWAP                   0x01UL
+#define INT_TOUCH                  0x02UL
+#define INT_TAG                    0x04UL
+#define INT_SOUND                  0x08UL
+#define INT_PLAYBACK               0x10UL
+#define INT_CMDEMPTY               0x20UL
+#define INT_CMDFLAG                0x40UL
+#define INT_CONVCOMPLETE           0x80UL
+
+// Touch Modes
+#define TOUCHMODE_OFF              0UL
+#define TOUCHMODE_ONESHOT          1UL
+#define TOUCHMODE_FRAME            2UL
+#define TOUCHMODE_CONTINUOUS       3UL
+
 // Flash Status
 #define FLASH_STATUS_INIT          0UL
 #define FLASH_STATUS_DETACHED      1UL
@@ -468,12 +491,12 @@ int txIdx;
 #define MAKE_COLOR(r,g,b) (( r << 16) | ( g << 8) | (b))
 #define LINE_WIDTH(width) ((14UL<<24)|(((width)&4095UL)<<0))
 #define VERTEX_FORMAT(frac) ((39UL<<24)|(((frac)&7UL)<<0))
+#define PALETTE_SOURCE(addr) ((42UL<<24)|(((addr)&4194303UL)<<0))
 
 
 
 // Function Prototypes
 void delay(uint32_t ms);
-static inline void waitFIFO();
 void EVE_reset();
 int EVE_startBurst();
 int EVE_sendBurst();
@@ -504,6 +527,16 @@ void EVE_cmdAppend(uint32_t ptr, uint32_t len);
 void EVE_cmdSpinner(int16_t x, int16_t y, uint16_t style, uint16_t scale);
 void EVE_cmdLoadImage(uint32_t dest, uint32_t options, uint8_t *data, uint32_t len);
 void EVE_cmdSetBitmap(uint32_t address, uint16_t format, uint16_t width, uint16_t height);
+void EVE_cmdSetFont2(uint32_t font, uint32_t ptr, uint32_t firstchar);
+void EVE_cmdInflate(uint32_t dest, const uint8_t *data, uint32_t len);
+void EVE_cmdButton(int16_t x, int16_t y, int16_t w, int16_t h, int16_t font, uint16_t options, char* text);
+void EVE_cmdProgress(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t options, uint16_t val, uint16_t range);
+void EVE_cmdFlashRead(uint32_t dest, uint32_t src, uint32_t num);
+void EVE_cmdFlashUpdate(uint32_t dest, uint32_t src, uint32_t num);
+void EVE_waitSpace(uint16_t bytes);
+void EVE_burstReserve(uint32_t bytes);
+void EVE_burstData(const uint8_t *data, uint32_t len);
+uint32_t EVE_burstCount();
 void EVE_cmd(uint32_t cmd);
 void EVE_colorRGB(uint32_t color);
 
@@ -1,9 +1,19 @@
 #include <string.h>
-#include <stdlib.h>
 
 #include "EVE.h"
 #include "Board.h"
 
+SPI_Handle      spiHandle;
+SPI_Params      spiParams;
+SPI_Transaction spiTransaction;
+
+// Statically allocated so the EVE driver needs no heap
+uint8_t txBuf[EVE_TXBUF_SIZE], rxBuf[EVE_TXBUF_SIZE];
+int txIdx;
+
+// A streamed chunk has to fit in a burst after the 3 byte address
+_Static_assert(EVE_CHUNK_SIZE + 3 <= EVE_TXBUF_SIZE, "EVE_CHUNK_SIZE does not fit in txBuf");
+
 void delay(uint32_t ms)
 {
 	uint32_t count;
@@ -16,6 +26,10 @@ void delay(uint32_t ms)
 	}
 }
 
+static void EVE_streamData(const uint8_t *data, uint32_t len);
+
+static uint32_t burstCount;
+
 static inline void waitFIFO()
 {
     while(EVE_read16(REG_CMDB_SPACE + RAM_REG) != 0xFFC)
@@ -57,9 +71,31 @@ int EVE_sendBurst()
     spiTransaction.count = txIdx;
     ret = SPI_transfer(spiHandle, &spiTransaction);
     txIdx = 0;
+    burstCount++;
     return ret;
 }
 
+// Number of bursts sent so far, tells callers whether txBuf was flushed
+uint32_t EVE_burstCount()
+{
+    return burstCount;
+}
+
+// Copy already serialised commands into the burst, len a multiple of 4
+void EVE_burstData(const uint8_t *data, uint32_t len)
+{
+    uint32_t blockSize;
+    while(len > 0)
+    {
+        blockSize = len > EVE_CHUNK_SIZE ? EVE_CHUNK_SIZE : len;
+        EVE_burstReserve(blockSize);
+        memcpy(&txBuf[txIdx], data, blockSize);
+        txIdx += blockSize;
+        data += blockSize;
+        len -= blockSize;
+    }
+}
+
 void EVE_burst8(uint8_t data)
 {
     txBuf[txIdx++] = data;
@@ -187,9 +223,7 @@ void EVE_sendHCMD(uint8_t command, uint8_t param)
 
 void EVE_init()
 {
-    // Initialize SPI buffers
-    txBuf = (uint8_t*)calloc(1024,1);
-    rxBuf = (uint8_t*)calloc(1024,1);
+    // Point the SPI transaction at the static buffers
     spiTransaction.txBuf = txBuf;
     spiTransaction.rxBuf = rxBuf;
     txIdx = 0;
@@ -359,39 +393,40 @@ void EVE_cmdSpinner(int16_t x, int16_t y, uint16_t style, uint16_t scale)
     EVE_burst16(scale);
 }
 
+void EVE_cmdButton(int16_t x, int16_t y, int16_t w, int16_t h, int16_t font, uint16_t options, char* text)
+{
+    EVE_burst32(CMD_BUTTON);
+    EVE_burst16(x);
+    EVE_burst16(y);
+    EVE_burst16(w);
+    EVE_burst16(h);
+    EVE_burst16(font);
+    EVE_burst16(options);
+    EVE_writeString(text);
+}
+
+void EVE_cmdProgress(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t options, uint16_t val, uint16_t range)
+{
+    EVE_burst32(CMD_PROGRESS);
+    EVE_burst16(x);
+    EVE_burst16(y);
+    EVE_burst16(w);
+    EVE_burst16(h);
+    EVE_burst16(options);
+    EVE_burst16(val);
+    EVE_burst16(range);
+    EVE_burst16(0);
+}
+
+// Decode a JPEG or PNG into RAM_G, returns once the coprocessor has finished
 void EVE_cmdLoadImage(uint32_t dest, uint32_t options, uint8_t *data, uint32_t len)
 {
-    uint32_t bytes = 0;
-    uint32_t blockSize = 0;
-    int padding;
     EVE_startBurst();
     EVE_burst32(CMD_LOADIMAGE);
     EVE_burst32(dest);
     EVE_burst32(options);
     EVE_sendBurst();
-    //waitFIFO();
-    while(bytes < len)
-    {
-        blockSize = (len-bytes) > 1000 ? 1000:bytes;
-        EVE_startBurst();
-        memcpy(&txBuf[txIdx], &data[bytes], blockSize);
-        txIdx+=blockSize;
-        padding = 4 - (blockSize % 4);
-        switch(padding)
-        {
-            case 4:
-                txBuf[++txIdx] = 0x00;
-            case 3:
-                txBuf[++txIdx] = 0x00;
-            case 2:
-                txBuf[++txIdx] = 0x00;
-            case 1:
-                txBuf[++txIdx] = 0x00;
-        }
-        EVE_sendBurst();
-        bytes+=blockSize;
-        //waitFIFO();
-    }
+    EVE_streamData(data, len);
 }
 
 void EVE_cmdSetBitmap(uint32_t address, uint16_t format, uint16_t width, uint16_t height)
@@ -401,6 +436,92 @@ void EVE_cmdSetBitmap(uint32_t address, uint16_t format, uint16_t width, uint16_
     EVE_burst16(format);
     EVE_burst16(width);
     EVE_burst16(height);
+    EVE_burst16(0);
+}
+
+void EVE_cmdSetFont2(uint32_t font, uint32_t ptr, uint32_t firstchar)
+{
+    EVE_burst32(CMD_SETFONT2);
+    EVE_burst32(font);
+    EVE_burst32(ptr);
+    EVE_burst32(firstchar);
+}
+
+// Inflate zlib data into RAM_G, returns once the coprocessor has finished
+void EVE_cmdInflate(uint32_t dest, const uint8_t *data, uint32_t len)
+{
+    EVE_startBurst();
+    EVE_burst32(CMD_INFLATE);
+    EVE_burst32(dest);
+    EVE_sendBurst();
+    EVE_streamData(data, len);
+}
+
+// Copy flash to RAM_G, src 64 byte aligned, returns once the copy is done
+void EVE_cmdFlashRead(uint32_t dest, uint32_t src, uint32_t num)
+{
+    EVE_startBurst();
+    EVE_burst32(CMD_FLASHREAD);
+    EVE_burst32(dest);
+    EVE_burst32(src);
+    EVE_burst32(num);
+    EVE_sendBurst();
+    waitFIFO();
+}
+
+// Write RAM_G to flash, only sectors that differ are erased and programmed
+void EVE_cmdFlashUpdate(uint32_t dest, uint32_t src, uint32_t num)
+{
+    EVE_startBurst();
+    EVE_burst32(CMD_FLASHUPDATE);
+    EVE_burst32(dest);
+    EVE_burst32(src);
+    EVE_burst32(num);
+    EVE_sendBurst();
+    waitFIFO();
+}
+
+// Feed the data of the last command in FIFO-sized chunks, padded to a word
+static void EVE_streamData(const uint8_t *data, uint32_t len)
+{
+    uint32_t bytes = 0;
+    uint32_t blockSize;
+    uint32_t padding;
+    while(bytes < len)
+    {
+        blockSize = (len-bytes) > EVE_CHUNK_SIZE ? EVE_CHUNK_SIZE : (len-bytes);
+        padding = (4 - (blockSize % 4)) % 4;
+        // Don't overrun the coprocessor FIFO while it is still decoding
+        EVE_waitSpace(blockSize + padding);
+        EVE_startBurst();
+        memcpy(&txBuf[txIdx], &data[bytes], blockSize);
+        txIdx += blockSize;
+        memset(&txBuf[txIdx], 0, padding);
+        txIdx += padding;
+        EVE_sendBurst();
+        bytes += blockSize;
+    }
+    waitFIFO();
+}
+
+// Wait for free space in the coprocessor FIFO, not during a burst
+void EVE_waitSpace(uint16_t bytes)
+{
+    while(EVE_read16(REG_CMDB_SPACE + RAM_REG) < bytes)
+    {
+        __nop();
+    }
+}
+
+// Make room in the current burst, sending it early if it would overflow
+void EVE_burstReserve(uint32_t bytes)
+{
+    if(txIdx + bytes > EVE_TXBUF_SIZE)
+    {
+        EVE_sendBurst();
+        EVE_waitSpace(EVE_TXBUF_SIZE);
+        EVE_startBurst();
+    }
 }
 
 void EVE_cmd(uint32_t cmd)
@@ -1,8 +1,17 @@
 #include "LP5018.h"
-#include "board.h"
+#include "Board.h"
 
 #include "uart_term.h"
 
+uint8_t txBuffer[LP5018_BUF_SIZE];
+uint8_t rxBuffer[LP5018_BUF_SIZE];
+
+I2C_Handle		i2cHandle;
+I2C_Params		i2cParams;
+
+// LP5018_setAllColor writes the register address and 6 RGB triples
+_Static_assert(1 + 6*3 <= LP5018_BUF_SIZE, "LP5018_BUF_SIZE too small");
+
 void LP5018_init(){
     bool retVal = false;
     I2C_Transaction i2cTransaction;
@@ -6,12 +6,14 @@
 #include <ti/drivers/I2C.h>
 #include <ti/devices/msp432p4xx/inc/msp.h>
 
+#define LP5018_BUF_SIZE     32
+
 /* Buffers */
-uint8_t txBuffer[32];
-uint8_t rxBuffer[32];
+extern uint8_t txBuffer[LP5018_BUF_SIZE];
+extern uint8_t rxBuffer[LP5018_BUF_SIZE];
 
-I2C_Handle		i2cHandle;
-I2C_Params		i2cParams;
+extern I2C_Handle		i2cHandle;
+extern I2C_Params		i2cParams;
 //I2C_Transaction i2cTransaction;
 
 // Function Prototypes
@@ -536,9 +536,12 @@ const uint_least8_t NVS_count = MSP_EXP432P401R_NVSCOUNT;
 /*
  *  =============================== Power ===============================
  */
+#include "power.h"
+
+/* Application policy picks LPM3 or LPM0 and records time in each */
 const PowerMSP432_ConfigV1 PowerMSP432_config = {
     .policyInitFxn = &PowerMSP432_initPolicy,
-    .policyFxn = &PowerMSP432_sleepPolicy,
+    .policyFxn = &SMO_Power_policy,
     .initialPerfLevel = 2,
     .enablePolicy = true,
     .enablePerf = true,
@@ -1,9 +1,9 @@
 
-#include <stdlib.h>
 #include <string.h>
 #include <errno.h>
 
 #include "SMO.h"
+#include "smo_wire.h"
 #include "uart_term.h"
 
 static void SMO_Event_init(SMO_Event *Event);
@@ -12,10 +12,10 @@ static int SMO_Event_addMed(SMO_Event *Event, uint8_t nCmptmt, uint8_t nPills);
 
 static void SMO_Vector_init(SMO_Vector *Vec);
 static void SMO_Vector_free(SMO_Vector *Vec);
-static int SMO_Vector_addMed(SMO_Vector *Vec, SMO_PacketMed *Med);
+static int SMO_Vector_addMed(SMO_Vector *Vec, const SMO_WireMed *Med);
 static SMO_Event *SMO_Vector_findNextEvent(SMO_Vector *Vec, uint8_t Hour, uint8_t Min);
 
-static int SMO_Control_addMedStr(SMO_Control *Ctrl, uint8_t nCmptmt, char *MedString, uint8_t Len);
+static int SMO_Control_addMedStr(SMO_Control *Ctrl, uint8_t nCmptmt, const char *MedStr, uint8_t Len);
 
 static void SMO_Event_init(SMO_Event *Event)
 {
@@ -51,7 +51,6 @@ Error:
 
 static void SMO_Vector_init(SMO_Vector *Vec)
 {
-    Vec->Events = malloc(sizeof(void*)*SMO_VECTOR_MAX_SIZE);
     int i;
     for (i = 0; i < SMO_VECTOR_MAX_SIZE; ++i)
     {
@@ -62,21 +61,11 @@ static void SMO_Vector_init(SMO_Vector *Vec)
 
 static void SMO_Vector_free(SMO_Vector *Vec)
 {
-    int i;
-    if (Vec->Events != NULL)
-    {
-        for (i = 0; i < SMO_VECTOR_MAX_SIZE; ++i)
-        {
-            free(Vec->Events[i]);
-            Vec->Events[i] = NULL;
-        }
-    }
-    free(Vec->Events);
-    Vec->Events = NULL;
-    Vec->Size = 0;
+    //events live in the pool, so this only forgets them
+    SMO_Vector_init(Vec);
 }
 
-static int SMO_Vector_addMed(SMO_Vector *Vec, SMO_PacketMed *Med)
+static int SMO_Vector_addMed(SMO_Vector *Vec, const SMO_WireMed *Med)
 {
     int Res = 0;
     SMO_Event *TmpEvent = NULL, *NewEvent = NULL;
@@ -95,29 +84,33 @@ static int SMO_Vector_addMed(SMO_Vector *Vec, SMO_PacketMed *Med)
     for (i = 0; i < Vec->Size; ++i)
     {
         TmpEvent = Vec->Events[i];
-        if (TmpEvent->AlarmHour == Med->AlarmHour
-            && TmpEvent->AlarmMin == Med->AlarmMin)
+        if (TmpEvent->AlarmHour == Med->Hour
+            && TmpEvent->AlarmMin == Med->Min)
         {
             UART_PRINT("Adding med to event at %02d:%02d in Cmptmt %d\r\n",
-                       TmpEvent->AlarmHour, TmpEvent->AlarmMin, Med->nCmptmt);
-            SMO_Event_addMed(TmpEvent, Med->nCmptmt, Med->nPills);
+                       TmpEvent->AlarmHour, TmpEvent->AlarmMin, Med->Cmptmt);
+            Res = SMO_Event_addMed(TmpEvent, Med->Cmptmt, Med->nPills);
             goto Success;
         }
-        else if (TmpEvent->AlarmHour > Med->AlarmHour
-                 || (TmpEvent->AlarmHour == Med->AlarmHour
-                 && TmpEvent->AlarmMin > Med->AlarmMin))
+        else if (TmpEvent->AlarmHour > Med->Hour
+                 || (TmpEvent->AlarmHour == Med->Hour
+                 && TmpEvent->AlarmMin > Med->Min))
         {
             AddIndex = i;
             break;
         }
     }
 
-    UART_PRINT("Creating new event for med at %02d:%02d in Cmptmt %d\r\n", Med->AlarmHour, Med->AlarmMin, Med->nCmptmt);
-    //allocate memory for the new event
-    NewEvent = malloc(sizeof(SMO_Event));
+    UART_PRINT("Creating new event for med at %02d:%02d in Cmptmt %d\r\n", Med->Hour, Med->Min, Med->Cmptmt);
+    //events are never removed one at a time, so the next free pool entry is at Size
+    NewEvent = &Vec->Pool[Vec->Size];
     SMO_Event_init(NewEvent);
-    SMO_Event_setTime(NewEvent, Med->AlarmHour, Med->AlarmMin);
-    SMO_Event_addMed(NewEvent, Med->nCmptmt, Med->nPills);
+    SMO_Event_setTime(NewEvent, Med->Hour, Med->Min);
+    Res = SMO_Event_addMed(NewEvent, Med->Cmptmt, Med->nPills);
+    if (Res < 0)
+    {
+        goto Error;
+    }
 
     //shift other events if necessary
     Vec->Size++;
@@ -161,63 +154,44 @@ Error:
     return Event;
 }
 
-void SMO_Timer_init(SMO_Timer *Timer)
-{
-    Timer->Timing = false;
-    Timer->Count = 0;
-}
-
-void SMO_Timer_start(SMO_Timer *Timer)
-{
-    //start counting up to SMO event timeout, every minute
-    Timer->Count = 0;
-    Timer->Timing = true;
-    Timer->Delaying = false;
-    Timer->Delay = 0;
-}
-
-void SMO_Timer_stop(SMO_Timer *Timer)
-{
-    //reset timer state
-    Timer->Timing = false;
-    Timer->Count = SMO_TIMER_DELAY;
-}
-
 void SMO_Control_init(SMO_Control *Ctrl)
 {
     SMO_Vector_init(&Ctrl->EventsVec);
     Ctrl->CurrentEvent = NULL;
-    SMO_Timer_init(&Ctrl->Timer);
+    Ctrl->ActiveStart = 0;
+    Ctrl->ActiveCompartments = 0;
 
     int i;
     for (i = 0; i < SMO_MAX_COMPARTMENTS; ++i)
     {
-        Ctrl->CompartmentStrings[i] = NULL;
+        Ctrl->MedStrs[i].Len = 0;
+        Ctrl->MedStrs[i].Str[0] = '\0';
+        Ctrl->Tones[i] = i;
     }
 
 }
 
 void SMO_Control_free(SMO_Control *Ctrl)
 {
-    if (Ctrl->Timer.Timing)
-    {
-        SMO_Timer_stop(&Ctrl->Timer);
-    }
     Ctrl->CurrentEvent = NULL;
     SMO_Vector_free(&Ctrl->EventsVec);
 
     int i;
     for (i = 0; i < SMO_MAX_COMPARTMENTS; ++i)
     {
-        free(Ctrl->CompartmentStrings[i]);
-        Ctrl->CompartmentStrings[i] = NULL;
+        Ctrl->MedStrs[i].Len = 0;
+        Ctrl->MedStrs[i].Str[0] = '\0';
     }
 }
 
-static int SMO_Control_addMedStr(SMO_Control *Ctrl, uint8_t nCmptmt, char *MedStr, uint8_t Len)
+/*
+ * Copy a med info payload from the packet into the compartment's slot
+ */
+static int SMO_Control_addMedStr(SMO_Control *Ctrl, uint8_t nCmptmt, const char *MedStr, uint8_t Len)
 {
     int Res = 0;
-    char Str[SMO_PACKET_MED_PAYLOAD_SIZE];
+    SMO_MedStr *Slot;
+    const char *End;
 
     if (nCmptmt >= SMO_MAX_COMPARTMENTS)
     {
@@ -225,37 +199,94 @@ static int SMO_Control_addMedStr(SMO_Control *Ctrl, uint8_t nCmptmt, char *MedSt
         goto Error;
     }
 
-    memset(Str, 0, sizeof(Str));
-    strncpy(Str, MedStr, Len);
-
-    if (Ctrl->CompartmentStrings[nCmptmt] != NULL)
+    //the slot has room for the whole payload and the terminator
+    if (Len > SMO_PACKET_MED_PAYLOAD_SIZE)
     {
-        free(Ctrl->CompartmentStrings[nCmptmt]);
+        Len = SMO_PACKET_MED_PAYLOAD_SIZE;
     }
-    UART_PRINT("Adding med info in %d, %s\r\n", nCmptmt, Str);
-    Ctrl->CompartmentStrings[nCmptmt] = strdup(Str);
+    End = memchr(MedStr, '\0', Len);
+    if (End != NULL)
+    {
+        Len = End - MedStr;
+    }
+
+    Slot = &Ctrl->MedStrs[nCmptmt];
+    memcpy(Slot->Str, MedStr, Len);
+    Slot->Str[Len] = '\0';
+    Slot->Len = Len;
+    UART_PRINT("Adding med info in %d, %s\r\n", nCmptmt, Slot->Str);
 
 Error:
     return Res;
 }
 
-int SMO_Control_configure(SMO_Control *Ctrl, SMO_Packet *Pkt)
+/*
+ * Replace the schedule with the one in a schedule packet, decoded
+ * in place. Nothing changes if the packet is malformed.
+ */
+int SMO_Control_configure(SMO_Control *Ctrl, const uint8_t *Pkt, int Len)
 {
     int Res = 0;
+    uint8_t Tones[SMO_MAX_COMPARTMENTS];
+    uint32_t ActiveStart;
+    uint8_t ActiveCompartments;
+    uint16_t Keys[SMO_PACKET_MAX_MEDS]; //minute of the day and compartment of each med
+    SMO_WireMed Med;
+    int nMeds, i, j, Err;
+
+    nMeds = SMO_Wire_schedule(Pkt, Len);
+    if (nMeds < 0)
+    {
+        Res = nMeds;
+        goto Error;
+    }
+    for (i = 0; i < nMeds; ++i)
+    {
+        if (SMO_Wire_med(Pkt, i, &Med) < 0)
+        {
+            UART_PRINT("Invalid med %d\r\n", i);
+            Res = -EINVAL;
+            goto Error;
+        }
 
-    //reset control before reconfiguring
+        //a compartment can only be due once at a time
+        Keys[i] = (uint16_t) ((Med.Hour*60 + Med.Min)*SMO_MAX_COMPARTMENTS + Med.Cmptmt);
+        for (j = 0; j < i; ++j)
+        {
+            if (Keys[j] == Keys[i])
+            {
+                UART_PRINT("Med %d repeats compartment %d at %02d:%02d\r\n", i, Med.Cmptmt, Med.Hour, Med.Min);
+                Res = -EINVAL;
+                goto Error;
+            }
+        }
+    }
+
+    //reset control before reconfiguring, the tones are set separately
+    //and a running event still has to be journaled when it ends
+    memcpy(Tones, Ctrl->Tones, sizeof(Tones));
+    ActiveStart = Ctrl->ActiveStart;
+    ActiveCompartments = Ctrl->ActiveCompartments;
     SMO_Control_free(Ctrl);
     SMO_Control_init(Ctrl);
+    memcpy(Ctrl->Tones, Tones, sizeof(Tones));
+    Ctrl->ActiveStart = ActiveStart;
+    Ctrl->ActiveCompartments = ActiveCompartments;
 
-    SMO_PacketMed *Med = NULL;
-    int i;
-    for (i = 0; i < Pkt->nMeds; ++i)
+    for (i = 0; i < nMeds; ++i)
     {
-        Med = &Pkt->Meds[i];
-        Res |= SMO_Vector_addMed(&Ctrl->EventsVec, Med);
-        Res |= SMO_Control_addMedStr(Ctrl, Med->nCmptmt, Med->Payload, Med->Length);
+        //the rest of the schedule is still applied, the first error is returned
+        SMO_Wire_med(Pkt, i, &Med);
+        Err = SMO_Vector_addMed(&Ctrl->EventsVec, &Med);
+        if (Err == 0)
+        {
+            //a med that was not scheduled must not rename its compartment
+            Err = SMO_Control_addMedStr(Ctrl, Med.Cmptmt, Med.Payload, Med.Length);
+        }
+        Res = Res == 0 ? Err : Res;
     }
 
+Error:
     return Res;
 }
 
@@ -264,17 +295,81 @@ SMO_Event *SMO_Control_nextEvent(SMO_Control *Ctrl, uint8_t Hour, uint8_t Min)
     return SMO_Vector_findNextEvent(&Ctrl->EventsVec, Hour, Min);
 }
 
-char *SMO_Control_getMedStr(SMO_Control *Ctrl, uint8_t nCmptmt)
+/*
+ * Fill Events with up to Max events in the order they will next
+ * occur after the given time, returns how many there are
+ */
+uint8_t SMO_Control_upcoming(SMO_Control *Ctrl, uint8_t Hour, uint8_t Min, SMO_Event **Events, uint8_t Max)
+{
+    SMO_Vector *Vec = &Ctrl->EventsVec;
+    SMO_Event *Next;
+    uint8_t i, First, Count;
+
+    Next = SMO_Vector_findNextEvent(Vec, Hour, Min);
+    if (Next == NULL)
+    {
+        return 0;
+    }
+
+    for (First = 0; Vec->Events[First] != Next; ++First);
+    Count = Vec->Size < Max ? Vec->Size : Max;
+    for (i = 0; i < Count; ++i)
+    {
+        Events[i] = Vec->Events[(First + i) % Vec->Size];
+    }
+    return Count;
+}
+
+const char *SMO_Control_getMedStr(SMO_Control *Ctrl, uint8_t nCmptmt)
 {
-    char *Str = NULL;
+    const char *Str = NULL;
 
     if (nCmptmt >= SMO_MAX_COMPARTMENTS)
     {
        goto Error;
     }
 
-    Str = Ctrl->CompartmentStrings[nCmptmt];
+    if (Ctrl->MedStrs[nCmptmt].Len != 0)
+    {
+        Str = Ctrl->MedStrs[nCmptmt].Str;
+    }
 
 Error:
     return Str;
 }
+
+/*
+ * Set the alert tone of every compartment, each below nTones
+ */
+int SMO_Control_setTones(SMO_Control *Ctrl, const uint8_t *Tones, uint8_t nTones)
+{
+    int Res = 0;
+    int i;
+
+    for (i = 0; i < SMO_MAX_COMPARTMENTS; ++i)
+    {
+        if (Tones[i] >= nTones)
+        {
+            Res = -EINVAL;
+            goto Error;
+        }
+    }
+    memcpy(Ctrl->Tones, Tones, sizeof(Ctrl->Tones));
+
+Error:
+    return Res;
+}
+
+uint8_t SMO_Control_getTone(SMO_Control *Ctrl, uint8_t Compartments)
+{
+    int i;
+
+    for (i = 0; i < SMO_MAX_COMPARTMENTS; ++i)
+    {
+        if (Compartments & (1 << i))
+        {
+            return Ctrl->Tones[i];
+        }
+    }
+    return 0;
+}
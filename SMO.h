@@ -7,14 +7,19 @@
 
 #define SMO_VECTOR_MAX_SIZE     10
 #define SMO_MAX_COMPARTMENTS    6
-#define SMO_EVENT_TIMEOUT_MINS  5
 
 #define SMO_PACKET_HEADER_SIZE          2
 #define SMO_PACKET_MAX_MEDS             6
 #define SMO_PACKET_MED_PAYLOAD_SIZE     30
 #define SMO_PACKET_TYPE_HEADER          0x98
+#define SMO_PACKET_TYPE_JOURNAL         0x99
+#define SMO_PACKET_TYPE_LOAD            0x9A
+#define SMO_PACKET_TYPE_TONES           0x9B
+#define SMO_PACKET_TYPE_RECORDING       0x9C
+#define SMO_PACKET_TYPE_PROFILE         0x9D
 
-#define SMO_TIMER_DELAY     1
+//each med in a configuration packet can start a new event in the pool
+_Static_assert(SMO_PACKET_MAX_MEDS <= SMO_VECTOR_MAX_SIZE, "event pool smaller than a packet");
 
 typedef struct SMO_Event
 {
@@ -27,29 +32,31 @@ typedef struct SMO_Event
 
 typedef struct SMO_Vector
 {
-    SMO_Event **Events;
+    SMO_Event *Events[SMO_VECTOR_MAX_SIZE]; //sorted by time of day
+    SMO_Event Pool[SMO_VECTOR_MAX_SIZE]; //the first Size entries are in use
     uint8_t Size;
 
 } SMO_Vector;
 
-typedef struct SMO_Timer
+typedef struct SMO_MedStr
 {
-    volatile bool Timing;
-    volatile int Count;
-    volatile bool Delaying;
-    volatile int Delay;
+    uint8_t Len; //bytes in Str, 0 for an empty slot
+    char Str[SMO_PACKET_MED_PAYLOAD_SIZE + 1]; //payload as received, always terminated
 
-} SMO_Timer;
+} SMO_MedStr;
 
 typedef struct SMO_Control
 {
     SMO_Vector EventsVec;
     SMO_Event *CurrentEvent;
-    SMO_Timer Timer;
-    char *CompartmentStrings[SMO_MAX_COMPARTMENTS]; //string for screen when event occurs
+    uint32_t ActiveStart; //RTC seconds when the active event started
+    uint8_t ActiveCompartments; //compartments of the active event
+    SMO_MedStr MedStrs[SMO_MAX_COMPARTMENTS]; //med info of each compartment, copied to the screen by an event
+    uint8_t Tones[SMO_MAX_COMPARTMENTS]; //alert tone of each compartment, kept across configures
 
 } SMO_Control;
 
+//mirrors one med record of a schedule packet, see smo_wire.h
 typedef struct SMO_PacketMed
 {
     uint8_t AlarmHour; //hour of alarm
@@ -61,6 +68,7 @@ typedef struct SMO_PacketMed
 
 } SMO_PacketMed;
 
+//mirrors a schedule packet, for building one in code
 typedef struct SMO_Packet
 {
     uint8_t PacketType;
@@ -69,14 +77,13 @@ typedef struct SMO_Packet
 
 } SMO_Packet;
 
-void SMO_Timer_init(SMO_Timer *Timer);
-void SMO_Timer_start(SMO_Timer *Timer);
-void SMO_Timer_stop(SMO_Timer *Timer);
-
 void SMO_Control_init(SMO_Control *Ctrl);
 void SMO_Control_free(SMO_Control *Ctrl);
-int SMO_Control_configure(SMO_Control *Ctrl, SMO_Packet *Pkt);
+int SMO_Control_configure(SMO_Control *Ctrl, const uint8_t *Pkt, int Len); //schedule packet in wire format
 SMO_Event *SMO_Control_nextEvent(SMO_Control *Ctrl, uint8_t Hour, uint8_t Min);
-char *SMO_Control_getMedStr(SMO_Control *Ctrl, uint8_t nCmptmt);
+uint8_t SMO_Control_upcoming(SMO_Control *Ctrl, uint8_t Hour, uint8_t Min, SMO_Event **Events, uint8_t Max);
+const char *SMO_Control_getMedStr(SMO_Control *Ctrl, uint8_t nCmptmt); //NULL for none
+int SMO_Control_setTones(SMO_Control *Ctrl, const uint8_t *Tones, uint8_t nTones);
+uint8_t SMO_Control_getTone(SMO_Control *Ctrl, uint8_t Compartments); //tone of the lowest compartment
 
 #endif
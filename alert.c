@@ -0,0 +1,280 @@
+#include <string.h>
+
+#include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/knl/Mailbox.h>
+
+#include "alert.h"
+#include "journal.h"
+#include "peripherals.h"
+#include "power.h"
+#include "rtc.h"
+#include "timer_wheel.h"
+#include "SMO.h"
+#include "uart_term.h"
+
+#define N   SMO_ALERT_NO_OUTCOME
+#define X   SMO_ALERT_STAY
+
+typedef struct SMO_AlertMsg
+{
+    uint8_t Input; //SMO_AlertInput
+    uint8_t Arg; //compartment for SMO_ALERT_TAKE
+    uint16_t Gen; //stage generation, stale expiries are dropped
+    uint32_t Time; //RTC seconds when the input happened
+
+} SMO_AlertMsg;
+
+typedef struct SMO_AlertControl
+{
+    SMO_AlertBegin Begin;
+    SMO_AlertEnd End;
+    Mailbox_Handle Mbx;
+    TimerWheel_Timer Timer; //one-shot timer for the current stage
+    volatile uint16_t Gen; //bumped on every stage change
+    SMO_AlertState State;
+    uint8_t Compartments; //compartments of the active event
+    uint8_t Snoozes;
+
+} SMO_AlertControl;
+
+//outputs and duration of each stage, indexed by SMO_AlertState
+static const SMO_AlertStage SMO_AlertStages[SMO_ALERT_STATE_COUNT] = {
+    //Secs  Volume  PeriodMs  Brightness  ShowInfo
+    {  0,   0x00,   0,        0,          false },    //IDLE
+    {  60,  0x60,   2000,     128,        true  },    //RINGING
+    {  60,  0x00,   0,        128,        true  },    //QUIET
+    {  60,  0xA0,   1200,     192,        true  },    //REMINDING
+    {  60,  0x00,   0,        192,        true  },    //QUIET_AGAIN
+    {  60,  0xFF,   0,        255,        true  },    //ESCALATED
+    {  300, 0x00,   0,        32,         true  },    //SNOOZED
+    {  60,  0x00,   0,        128,        true  },    //ACKNOWLEDGED
+};
+
+//next state and journaled outcome, indexed by [SMO_AlertState][SMO_AlertInput]
+static const SMO_AlertTransition SMO_AlertTable[SMO_ALERT_STATE_COUNT][SMO_ALERT_INPUT_COUNT] = {
+    //ALARM                                          EXPIRED                               ACK                                          DISMISS                              SNOOZE                                     TAKE
+    { {SMO_ALERT_RINGING, N},                        {X, N},                               {X, N},                                      {X, N},                              {X, N},                                    {X, N} },   //IDLE
+    { {SMO_ALERT_RINGING, SMO_JOURNAL_SUPERSEDED},   {SMO_ALERT_QUIET, N},                 {SMO_ALERT_ACKNOWLEDGED, SMO_JOURNAL_TAKEN}, {SMO_ALERT_IDLE, SMO_JOURNAL_TAKEN}, {SMO_ALERT_SNOOZED, SMO_JOURNAL_SNOOZED},  {X, N} },   //RINGING
+    { {SMO_ALERT_RINGING, SMO_JOURNAL_SUPERSEDED},   {SMO_ALERT_REMINDING, N},             {SMO_ALERT_ACKNOWLEDGED, SMO_JOURNAL_TAKEN}, {SMO_ALERT_IDLE, SMO_JOURNAL_TAKEN}, {SMO_ALERT_SNOOZED, SMO_JOURNAL_SNOOZED},  {X, N} },   //QUIET
+    { {SMO_ALERT_RINGING, SMO_JOURNAL_SUPERSEDED},   {SMO_ALERT_QUIET_AGAIN, N},           {SMO_ALERT_ACKNOWLEDGED, SMO_JOURNAL_TAKEN}, {SMO_ALERT_IDLE, SMO_JOURNAL_TAKEN}, {SMO_ALERT_SNOOZED, SMO_JOURNAL_SNOOZED},  {X, N} },   //REMINDING
+    { {SMO_ALERT_RINGING, SMO_JOURNAL_SUPERSEDED},   {SMO_ALERT_ESCALATED, N},             {SMO_ALERT_ACKNOWLEDGED, SMO_JOURNAL_TAKEN}, {SMO_ALERT_IDLE, SMO_JOURNAL_TAKEN}, {SMO_ALERT_SNOOZED, SMO_JOURNAL_SNOOZED},  {X, N} },   //QUIET_AGAIN
+    { {SMO_ALERT_RINGING, SMO_JOURNAL_SUPERSEDED},   {SMO_ALERT_IDLE, SMO_JOURNAL_MISSED}, {SMO_ALERT_ACKNOWLEDGED, SMO_JOURNAL_TAKEN}, {SMO_ALERT_IDLE, SMO_JOURNAL_TAKEN}, {SMO_ALERT_SNOOZED, SMO_JOURNAL_SNOOZED},  {X, N} },   //ESCALATED
+    { {SMO_ALERT_RINGING, SMO_JOURNAL_SUPERSEDED},   {SMO_ALERT_REMINDING, N},             {SMO_ALERT_ACKNOWLEDGED, SMO_JOURNAL_TAKEN}, {SMO_ALERT_IDLE, SMO_JOURNAL_TAKEN}, {SMO_ALERT_SNOOZED, SMO_JOURNAL_SNOOZED},  {X, N} },   //SNOOZED
+    { {SMO_ALERT_RINGING, N},                        {SMO_ALERT_IDLE, N},                  {X, N},                                      {SMO_ALERT_IDLE, N},                 {X, N},                                    {X, N} },   //ACKNOWLEDGED
+};
+
+static SMO_AlertControl SMO_AlertCtrl;
+
+static void SMO_Alert_expired(void *Arg);
+static void SMO_Alert_enter(SMO_AlertState State);
+static void SMO_Alert_dispatch(SMO_AlertMsg *Msg);
+
+void SMO_Alert_init(SMO_AlertBegin Begin, SMO_AlertEnd End)
+{
+    memset(&SMO_AlertCtrl, 0, sizeof(SMO_AlertCtrl));
+    SMO_AlertCtrl.Begin = Begin;
+    SMO_AlertCtrl.End = End;
+    SMO_AlertCtrl.State = SMO_ALERT_IDLE;
+
+    //all storage is created up front, nothing is allocated per event
+    SMO_AlertCtrl.Mbx = Mailbox_create(sizeof(SMO_AlertMsg), SMO_ALERT_MAILBOX_SIZE, NULL, NULL);
+    if (SMO_AlertCtrl.Mbx == NULL)
+    {
+        UART_PRINT("Error creating alert mailbox\r\n");
+        while (1);
+    }
+}
+
+/*
+ * Queue an input for the alert thread, safe from interrupts
+ */
+bool SMO_Alert_post(uint8_t Input, uint32_t Time)
+{
+    SMO_AlertMsg Msg;
+
+    Msg.Input = Input;
+    Msg.Arg = 0;
+    Msg.Gen = SMO_AlertCtrl.Gen;
+    Msg.Time = Time;
+
+    return Mailbox_post(SMO_AlertCtrl.Mbx, &Msg, BIOS_NO_WAIT);
+}
+
+/*
+ * Queue the taking of one compartment of the active event
+ */
+bool SMO_Alert_take(uint8_t Compartment, uint32_t Time)
+{
+    SMO_AlertMsg Msg;
+
+    Msg.Input = SMO_ALERT_TAKE;
+    Msg.Arg = Compartment;
+    Msg.Gen = SMO_AlertCtrl.Gen;
+    Msg.Time = Time;
+
+    return Mailbox_post(SMO_AlertCtrl.Mbx, &Msg, BIOS_NO_WAIT);
+}
+
+SMO_AlertState SMO_Alert_getState(void)
+{
+    return SMO_AlertCtrl.State;
+}
+
+/*
+ * Stage timer callback, runs from the timer wheel interrupt
+ */
+static void SMO_Alert_expired(void *Arg)
+{
+    SMO_Alert_post(SMO_ALERT_EXPIRED, (uint32_t) RTC_getTime());
+}
+
+/*
+ * Apply the outputs of a stage and arm its timer
+ */
+static void SMO_Alert_enter(SMO_AlertState State)
+{
+    const SMO_AlertStage *Stage = &SMO_AlertStages[State];
+    uint8_t Compartments, Tmp;
+
+    TimerWheel_stop(&SMO_AlertCtrl.Timer);
+    SMO_AlertCtrl.Gen++;
+    SMO_AlertCtrl.State = State;
+    UART_PRINT("Alert stage %d\r\n", State);
+
+    //wakes the EVE before the speaker is touched
+    SMO_Power_setBusy(State != SMO_ALERT_IDLE);
+
+    //the tone repeats faster and louder as the alert escalates
+    Speaker_play(Stage->Volume, Stage->PeriodMs);
+
+    if (Stage->Brightness == 0)
+    {
+        LED_allOff();
+    }
+    else
+    {
+        Compartments = SMO_AlertCtrl.Compartments;
+        while (Compartments != 0)
+        {
+            Tmp = Compartments & -Compartments;
+            LED_setBrightness(31 - __CLZ(Tmp), Stage->Brightness);
+            Compartments ^= Tmp;
+        }
+    }
+
+    if (!Stage->ShowInfo)
+    {
+        Screen_removeMedInfo();
+    }
+    else if (State <= SMO_ALERT_ESCALATED)
+    {
+        Screen_setAlertProgress(State, SMO_ALERT_ESCALATED);
+    }
+
+    if (Stage->Secs != 0)
+    {
+        TimerWheel_start(&SMO_AlertCtrl.Timer, (uint32_t) Stage->Secs * 1000, 0, SMO_Alert_expired, NULL);
+    }
+}
+
+/*
+ * Take one input through the transition table
+ */
+static void SMO_Alert_dispatch(SMO_AlertMsg *Msg)
+{
+    const SMO_AlertTransition *Trans;
+    int Compartments;
+
+    //expiry of a stage we already left
+    if (Msg->Input >= SMO_ALERT_INPUT_COUNT
+            || (Msg->Input == SMO_ALERT_EXPIRED && Msg->Gen != SMO_AlertCtrl.Gen))
+    {
+        return;
+    }
+
+    //taking a compartment is allowed wherever a click would acknowledge,
+    //and the event is only acknowledged once nothing is left to take
+    if (Msg->Input == SMO_ALERT_TAKE)
+    {
+        if (SMO_AlertTable[SMO_AlertCtrl.State][SMO_ALERT_ACK].Next == SMO_ALERT_STAY
+                || Msg->Arg >= SMO_MAX_COMPARTMENTS
+                || (SMO_AlertCtrl.Compartments & (1 << Msg->Arg)) == 0)
+        {
+            return;
+        }
+        SMO_AlertCtrl.Compartments &= ~(1 << Msg->Arg);
+        LED_off(Msg->Arg);
+        Screen_clearCompartment(Msg->Arg);
+        if (SMO_AlertCtrl.Compartments != 0)
+        {
+            return;
+        }
+        Msg->Input = SMO_ALERT_ACK;
+    }
+
+    Trans = &SMO_AlertTable[SMO_AlertCtrl.State][Msg->Input];
+    if (Trans->Next == SMO_ALERT_STAY)
+    {
+        return;
+    }
+    if (Msg->Input == SMO_ALERT_SNOOZE && SMO_AlertCtrl.Snoozes >= SMO_ALERT_MAX_SNOOZES)
+    {
+        UART_PRINT("Snooze limit reached\r\n");
+        return;
+    }
+
+    if (Trans->Outcome != SMO_ALERT_NO_OUTCOME && SMO_AlertCtrl.End != NULL)
+    {
+        SMO_AlertCtrl.End(Trans->Outcome, Msg->Time);
+    }
+
+    if (Msg->Input == SMO_ALERT_SNOOZE)
+    {
+        SMO_AlertCtrl.Snoozes++;
+    }
+    else if (Msg->Input == SMO_ALERT_ALARM)
+    {
+        //clear the previous event's compartments before lighting the new ones
+        if (SMO_AlertCtrl.State != SMO_ALERT_IDLE)
+        {
+            LED_allOff();
+        }
+
+        SMO_AlertCtrl.Snoozes = 0;
+        Compartments = SMO_AlertCtrl.Begin != NULL ? SMO_AlertCtrl.Begin() : -1;
+        if (Compartments < 0)
+        {
+            SMO_AlertCtrl.Compartments = 0;
+            SMO_Alert_enter(SMO_ALERT_IDLE);
+            return;
+        }
+        SMO_AlertCtrl.Compartments = (uint8_t) Compartments;
+    }
+
+    SMO_Alert_enter((SMO_AlertState) Trans->Next);
+}
+
+/*
+ * Handle the next queued input, waiting for one if Wait is set.
+ * Returns false if there was nothing to handle.
+ */
+bool SMO_Alert_process(bool Wait)
+{
+    SMO_AlertMsg Msg;
+
+    if (!Mailbox_pend(SMO_AlertCtrl.Mbx, &Msg, Wait ? BIOS_WAIT_FOREVER : BIOS_NO_WAIT))
+    {
+        return false;
+    }
+    SMO_Alert_dispatch(&Msg);
+    return true;
+}
+
+void *alertThreadProc(void *pArg)
+{
+    while (1)
+    {
+        SMO_Alert_process(true);
+    }
+}
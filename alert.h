@@ -0,0 +1,82 @@
+/************************************************************
+ * alert.h
+ *
+ * Alert state machine for medication events. Each state is
+ * a stage with its own speaker volume, LED brightness and
+ * duration, and inputs (alarm, stage expiry, button
+ * gestures) move between stages through a fixed table.
+ * Compartments can also be taken one at a time from the
+ * touch screen, and taking the last one acknowledges.
+ * Inputs are posted to a mailbox and handled in order by
+ * the alert thread, so they can come from interrupts. Stage
+ * durations run on a timer wheel one-shot.
+ *
+ ************************************************************/
+
+#ifndef ALERT_H
+#define ALERT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SMO_ALERT_MAILBOX_SIZE  8 //inputs queued for the alert thread
+#define SMO_ALERT_MAX_SNOOZES   3 //further snoozes are ignored
+#define SMO_ALERT_NO_OUTCOME    0xFF //transition is not journaled
+#define SMO_ALERT_STAY          0xFF //input is ignored in this state
+
+typedef enum SMO_AlertState
+{
+    SMO_ALERT_IDLE = 0, //no event, everything off
+    SMO_ALERT_RINGING = 1, //initial alert
+    SMO_ALERT_QUIET = 2, //pause before the first reminder
+    SMO_ALERT_REMINDING = 3, //louder reminder
+    SMO_ALERT_QUIET_AGAIN = 4, //pause before escalating
+    SMO_ALERT_ESCALATED = 5, //full volume and brightness, missed after this
+    SMO_ALERT_SNOOZED = 6, //silenced by the user for a while
+    SMO_ALERT_ACKNOWLEDGED = 7, //taken, lights and screen linger
+    SMO_ALERT_STATE_COUNT
+
+} SMO_AlertState;
+
+typedef enum SMO_AlertInput
+{
+    SMO_ALERT_ALARM = 0, //RTC alarm for the next event
+    SMO_ALERT_EXPIRED = 1, //current stage ran out
+    SMO_ALERT_ACK = 2, //button click
+    SMO_ALERT_DISMISS = 3, //button double press
+    SMO_ALERT_SNOOZE = 4, //button long press
+    SMO_ALERT_TAKE = 5, //one compartment tapped on the screen
+    SMO_ALERT_INPUT_COUNT
+
+} SMO_AlertInput;
+
+typedef struct SMO_AlertStage
+{
+    uint16_t Secs; //time before SMO_ALERT_EXPIRED, 0 for none
+    uint8_t Volume; //speaker volume, 0 for off
+    uint16_t PeriodMs; //time between tone repeats, 0 to play continuously
+    uint8_t Brightness; //brightness of the due compartment LEDs
+    bool ShowInfo; //med info stays on the screen
+
+} SMO_AlertStage;
+
+typedef struct SMO_AlertTransition
+{
+    uint8_t Next; //SMO_AlertState or SMO_ALERT_STAY
+    uint8_t Outcome; //SMO_JournalOutcome or SMO_ALERT_NO_OUTCOME
+
+} SMO_AlertTransition;
+
+//starts a new event and returns its compartments, or negative on error
+typedef int (*SMO_AlertBegin)(void);
+//records how the active event ended, Time in RTC seconds
+typedef void (*SMO_AlertEnd)(uint8_t Outcome, uint32_t Time);
+
+void SMO_Alert_init(SMO_AlertBegin Begin, SMO_AlertEnd End);
+void *alertThreadProc(void *pArg);
+bool SMO_Alert_process(bool Wait); //one input, for callers without a thread
+bool SMO_Alert_post(uint8_t Input, uint32_t Time);
+bool SMO_Alert_take(uint8_t Compartment, uint32_t Time);
+SMO_AlertState SMO_Alert_getState(void);
+
+#endif
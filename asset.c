@@ -1,98 +1,52 @@
-#include <stdint.h>
+#include <errno.h>
 
-const /*__flash*/ uint8_t logo[29300] = {
-0xff,0xd8,0xff,0xe0,0x0,0x10,0x4a,0x46,0x49,0x46,0x0,0x1,0x1,0x1,0x0,0x60,0x0,0x60,0x0,0x0,0xff,0xe1,0x0,0x3a,0x45,0x78,0x69,0x66,0x0,0x0,0x4d,0x4d,0x0,0x2a,0x0,0x0,0x0,0x8,0x0,0x3,0x51,0x10,0x0,0x1,0x0,0x0,0x0,0x1,0x1,0x0,0x0,0x0,0x51,0x11,0x0,0x4,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x51,0x12,0x0,0x4,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xff,0xdb,0x0,0x43,0x0,0x2,0x1,0x1,0x2,0x1,0x1,0x2,0x2,0x2,0x2,0x2,0x2,0x2,0x2,0x3,0x5,0x3,0x3,0x3,0x3,0x3,0x6,0x4,0x4,0x3,0x5,0x7,0x6,0x7,0x7,0x7,0x6,0x7,0x7,0x8,0x9,0xb,0x9,0x8,0x8,0xa,0x8,0x7,0x7,0xa,0xd,0xa,0xa,0xb,0xc,0xc,0xc,0xc,0x7,0x9,0xe,0xf,0xd,0xc,0xe,0xb,0xc,0xc,0xc,0xff,0xdb,0x0,0x43,0x1,0x2,0x2,0x2,0x3,0x3,0x3,0x6,0x3,0x3,0x6,0xc,0x8,0x7,0x8,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xff,0xc0,0x0,0x11,0x8,0x0,0xf0,0x1,0x48,0x3,0x1,0x22,0x0,0x2,0x11,0x1,0x3,0x11,0x1,0xff,0xc4,0x0,0x1f,0x0,0x0,0x1,0x5,0x1,0x1,0x1,0x1,0x1,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x2,0x3,0x4,0x5,0x6,0x7,0x8,0x9,0xa,0xb,0xff,0xc4,0x0,0xb5,0x10,0x0,0x2,0x1,0x3,0x3,0x2,0x4,0x3,0x5,0x5,0x4,0x4,0x0,0x0,0x1,0x7d,0x1,0x2,0x3,0x0,0x4,0x11,0x5,0x12,0x21,0x31,0x41,0x6,0x13,0x51,0x61,0x7,0x22,0x71,0x14,0x32,0x81,0x91,0xa1,0x8,0x23,0x42,0xb1,0xc1,0x15,0x52,0xd1,0xf0,0x24,0x33,0x62,0x72,0x82,0x9,0xa,0x16,0x17,0x18,0x19,0x1a,0x25,0x26,0x27,0x28,0x29,0x2a,0x34,0x35,0x36,0x37,0x38,0x39,0x3a,0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4a,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5a,0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6a,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x83,0x84,0x85,0x86,0x87,0x88,0x89,0x8a,0x92,0x93,0x94,0x95,0x96,0x97,0x98,0x99,0x9a,0xa2,0xa3,0xa4,0xa5,0xa6,0xa7,0xa8,0xa9,0xaa,0xb2,0xb3,0xb4,0xb5,0xb6,0xb7,0xb8,0xb9,0xba,0xc2,0xc3,0xc4,0xc5,0xc6,0xc7,0xc8,0xc9,0xca,0xd2,0xd3,0xd4,0xd5,0xd6,0xd7,0xd8,0xd9,0xda,0xe1,0xe2,0xe3,0xe4,0xe5,0xe6,0xe7,0xe8,0xe9,0xea,0xf1,0xf2,0xf3,0xf4,0xf5,0xf6,0xf7,0xf8,0xf9,0xfa,0xff,0xc4,0x0,0x1f,0x1,0x0,0x3,0x1,0x1,0x1,0x1,0x1,0x1,0x1,0x1,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x2,0x3,0x4,0x5,0x6,0x7,0x8,0x9,0xa,0xb,0xff,0xc4,0x0,0xb5,0x11,0x0,0x2,0x1,0x2,0x4,0x4,0x3,0x4,0x7,0x5,0x4,0x4,0x0,0x1,0x2,0x77,0x0,0x1,0x2,0x3,0x11,0x4,0x5,0x21,0x31,0x6,0x12,0x41,0x51,0x7,0x61,0x71,0x13,0x22,0x32,0x81,0x8,0x14,0x42,0x91,0xa1,0xb1,0xc1,0x9,0x23,0x33,0x52,0xf0,0x15,0x62,0x72,0xd1,0xa,0x16,0x24,0x34,0xe1,0x25,0xf1,0x17,0x18,0x19,0x1a,0x26,0x27,0x28,0x29,0x2a,0x35,0x36,0x37,0x38,0x39,0x3a,0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4a,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5a,0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6a,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x82,0x83,0x84,0x85,0x86,0x87,0x88,0x89,0x8a,0x92,0x93,0x94,0x95,0x96,0x97,0x98,0x99,0x9a,0xa2,0xa3,0xa4,0xa5,0xa6,0xa7,0xa8,0xa9,0xaa,0xb2,0xb3,0xb4,0xb5,0xb6,0xb7,0xb8,0xb9,0xba,0xc2,0xc3,0xc4,0xc5,0xc6,0xc7,0xc8,0xc9,0xca,0xd2,0xd3,0xd4,0xd5,0xd6,0xd7,0xd8,0xd9,0xda,0xe2,0xe3,0xe4,0xe5,0xe6,0xe7,0xe8,0xe9,0xea,0xf2,0xf3,0xf4,0xf5,0xf6,0xf7,0xf8,0xf9,0xfa,0xff,0xda,0x0,0xc,0x3,0x1,0x0,0x2,0x11,0x3,0x11,0x0,0x3f,0x0,0xfd,0xfc,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0x28,0x0,0xa2,0x8c,0xe2,0xa3,0xbb,0xbb,0x8e,0xc6,0xd6,0x49,0xe6,0x92,0x38,0x61,0x85,0x4b,0xc9,0x23,0xb0,0x55,0x45,0x3,0x24,0x92,0x78,0x0,0xe,0x72,0x68,0x2,0x4a,0x33,0xcd,0x7c,0x7,0xfb,0x76,0x7f,0xc1,0xc9,0xbf,0xb2,0xff,0x0,0xec,0x39,0x73,0x79,0xa4,0xc9,0xe2,0xd7,0xf8,0x89,0xe2,0xeb,0x42,0x51,0xb4,0x6f,0xa,0x20,0xbc,0xf2,0xdf,0x19,0x2,0x5b,0x9c,0x88,0x10,0x76,0xe1,0x98,0x8f,0x4a,0xfc,0xb1,0xfd,0xa6,0xbf,0xe0,0xf4,0x6f,0x8b,0x9e,0x35,0x7b,0xcb,0x4f,0x85,0x3f,0xd,0xfc,0x27,0xe0,0x8b,0x29,0xf,0xee,0x2f,0x75,0x79,0x1f,0x54,0xbf,0x8c,0x76,0xe3,0xe5,0x87,0xf3,0x43,0x4b,0x98,0xae,0x56,0x7f,0x49,0x59,0xae,0x63,0xe2,0x97,0xc6,0xcf,0x6,0xfc,0xe,0xd0,0x5b,0x54,0xf1,0xaf,0x8b,0xbc,0x31,0xe0,0xfd,0x2d,0x79,0x6b,0xcd,0x6f,0x54,0x83,0x4f,0xb7,0x3,0xdd,0xe6,0x65,0x5f,0xd6,0xbf,0x90,0xef,0x1d,0xff,0x0,0xc1,0x6d,0x3f,0x6d,0xaf,0xdb,0x4f,0xc4,0xb2,0x68,0xb6,0xbf,0x15,0x3e,0x22,0x6a,0x97,0x9a,0x82,0x95,0x1a,0x3f,0x83,0xed,0x3e,0xc8,0x65,0x1d,0x30,0x21,0xb3,0x8c,0x31,0xea,0x5,0x6b,0x7c,0x39,0xff,0x0,0x82,0x4,0xfe,0xdc,0x9f,0xb5,0xfd,0xcd,0xae,0xb5,0x7f,0xf0,0xb3,0xc6,0x4b,0x1d,0xff,0x0,0xcd,0xfd,0xa3,0xe3,0x4d,0x5a,0x2d,0x3e,0x48,0xc1,0xe7,0x73,0x47,0x75,0x28,0xb8,0xc1,0xf6,0x8c,0xd1,0x70,0xe5,0x3f,0xa4,0xad,0x77,0xfe,0xb,0xcd,0xfb,0x1d,0xf8,0x7b,0xc5,0x8d,0xa2,0xdc,0x7e,0xd0,0xdf,0xd,0xe4,0xbc,0x56,0x2a,0x64,0xb6,0xbf,0x37,0x56,0x84,0x83,0x8f,0xf8,0xf9,0x89,0x5a,0x1c,0x7b,0xef,0xc1,0xaf,0x6f,0xf8,0xd,0xfb,0x64,0xfc,0x24,0xfd,0xa9,0x60,0x92,
-0x4f,0x86,0xbf,0x13,0xbc,0x5,0xe3,0xcf,0x20,0x66,0x64,0xd0,0x75,0xeb,0x6d,0x42,0x58,0x38,0xcf,0xef,0x12,0x27,0x66,0x43,0x82,0xe,0x18,0x3,0xcd,0x7f,0x35,0x16,0xff,0x0,0xf0,0x67,0x8f,0xed,0x79,0x2d,0x87,0x9c,0xd7,0x1f,0x9,0xa2,0x97,0x19,0xf2,0x1b,0xc4,0x73,0x6f,0xfa,0x64,0x5b,0x95,0xfd,0x6b,0xe7,0x9f,0xda,0x4b,0xfe,0x8,0xb3,0xfb,0x5d,0x7f,0xc1,0x35,0xc7,0xfc,0x2c,0xd,0x63,0xc0,0x9e,0x22,0xd1,0x2c,0x7c,0x2b,0x30,0xbb,0x8f,0xc5,0x9e,0x16,0xd4,0x96,0xe1,0x74,0xb6,0x4e,0x44,0xe2,0x5b,0x77,0xf3,0xe1,0xb,0x8c,0xf9,0x8c,0xaa,0x7,0x5c,0x8a,0x57,0xe,0x53,0xfb,0x26,0xdd,0x45,0x7e,0x32,0xff,0x0,0xc1,0xb9,0xbf,0xf0,0x71,0xad,0xf7,0xed,0xa5,0xaf,0x69,0xff,0x0,0x2,0x7e,0x39,0x5e,0x42,0xdf,0x14,0x5a,0x17,0xff,0x0,0x84,0x6b,0xc4,0xc2,0x25,0x86,0x3f,0x15,0x24,0x68,0x5d,0xad,0xae,0x15,0x0,0x58,0xef,0x16,0x35,0x66,0x57,0x1,0x52,0x65,0x42,0x8,0x12,0x1,0xe7,0x7e,0xcc,0xa9,0xca,0xd5,0x12,0x2d,0x14,0x51,0x40,0x5,0x14,0x51,0x40,0x5,0x14,0x51,0x40,0x5,0x14,0x51,0x40,0x5,0x14,0x51,0x40,0x5,0x14,0x51,0x40,0x5,0x14,0x51,0x40,0x5,0x14,0x51,0x40,0x5,0x14,0x51,0x40,0x5,0x14,0x51,0x40,0x5,0x14,0x51,0x40,0x5,0x14,0x51,0x40,0x5,0x14,0x51,0x40,0x5,0x14,0x51,0x40,0x5,0x14,0x57,0x2f,0xf1,0x7b,0xe3,0x4f,0x84,0x7e,0x0,0xfc,0x3f,0xbf,0xf1,0x67,0x8d,0xfc,0x4d,0xa1,0xf8,0x47,0xc3,0x3a,0x5a,0xef,0xbb,0xd4,0xf5,0x7b,0xd8,0xec,0xed,0x61,0x7,0xa0,0x2e,0xe4,0xd,0xcc,0x78,0x0,0x72,0x49,0x0,0x2,0x48,0x14,0x1,0xd4,0x13,0x81,0x5c,0x4f,0xed,0x3,0xfb,0x48,0x78,0xf,0xf6,0x54,0xf8,0x65,0x79,0xe3,0x2f,0x89,0x1e,0x2d,0xd0,0xbc,0x17,0xe1,0x7b,0x2,0x16,0x5d,0x47,0x55,0xbb,0x5b,0x78,0x8b,0x90,0x4a,0xc6,0x99,0xe6,0x49,0x1b,0x69,0xdb,0x1a,0x6,0x76,0x23,0x0,0x13,0x5f,0x8c,0xff,0x0,0xf0,0x51,0x4f,0xf8,0x3c,0xc3,0xc2,0xde,0x4,0xd4,0x2f,0x3c,0x37,0xfb,0x36,0xf8,0x45,0x3c,0x6d,0x73,0x1a,0xb4,0x7f,0xf0,0x96,0xf8,0x91,0x25,0xb4,0xd3,0x15,0xf9,0x0,0xdb,0xd9,0x8d,0xb3,0xcc,0xbd,0xe,0xe9,0x5a,0x1c,0x10,0x46,0xc6,0x7,0x35,0xf8,0xe7,0xe2,0x1f,0x15,0x7e,0xd3,0xdf,0xf0,0x5c,0x6f,0xda,0x8e,0x35,0x9d,0xbc,0x69,0xf1,0x9b,0xc7,0x93,0x86,0x36,0xf6,0xb6,0xeb,0xfe,0x83,0xa1,0xdb,0xb3,0xc,0xec,0x41,0xb6,0xde,0xca,0xdc,0x36,0x32,0xdf,0x22,0x16,0xc6,0x49,0x63,0x92,0xe,0xc7,0xec,0x17,0xed,0xe7,0xff,0x0,0x7,0xa1,0x78,0x67,0xc2,0xd7,0x37,0xba,0x1f,0xec,0xeb,0xe0,0x9,0xbc,0x57,0x71,0x1e,0xe8,0xd7,0xc5,0x1e,0x2b,0xf,0x67,0x61,0x9e,0x40,0x78,0x6c,0x90,0x89,0xa4,0x53,0xc1,0x6,0x57,0x84,0x8e,0x85,0xd,0x7e,0x5b,0xfc,0x4b,0xfd,0xbf,0x3f,0x6d,0x6f,0xf8,0x2c,0x9f,0x8f,0x9f,0xc3,0x91,0xeb,0xdf,0x12,0x3c,0x7c,0xd7,0x92,0x28,0xff,0x0,0x84,0x6f,0xc2,0x76,0xb2,0x5b,0x69,0x76,0xe0,0x8c,0xd,0xf0,0x5b,0x2a,0xc6,0x17,0x19,0xf9,0xe6,0x27,0xb9,0x2d,0x5f,0xaa,0xdf,0xf0,0x4d,0xf,0xf8,0x33,0x9b,0xc2,0xbe,0x7,0xb4,0xb0,0xf1,0x47,0xed,0x2d,0xaf,0x37,0x8b,0x75,0xac,0x24,0xcb,0xe1,0x1d,0xa,0x76,0x83,0x4b,0xb4,0x6e,0xe,0xdb,0x8b,0x91,0x89,0x2e,0xf,0x62,0xb1,0xf9,0x69,0xd4,0x66,0x41,0xcd,0x7e,0xcd,0x7c,0x13,0xf8,0x5,0xe0,0xaf,0xd9,0xbf,0xc0,0xd6,0xbe,0x19,0xf0,0xf,0x85,0x74,0x1f,0x7,0xf8,0x7e,0xcd,0x76,0xc3,0x61,0xa5,0x59,0xa5,0xb4,0x2b,0xf8,0x28,0x19,0x3e,0xe7,0x26,0x80,0x3f,0x9a,0xbf,0xd9,0x23,0xfe,0xc,0xec,0xfd,0xa3,0x3e,0x36,0xdb,0x59,0xea,0x1f,0x12,0x35,0xef,0x7,0xfc,0x1e,0xd2,0xee,0x30,0xd2,0x5b,0x5c,0x48,0x75,0x9d,0x62,0x20,0x73,0x83,0xf6,0x78,0x8,0x87,0xf0,0x6b,0x80,0x46,0x7a,0x75,0xaf,0xd4,0x4f,0xd9,0x7,0xfe,0xd,0x2c,0xfd,0x95,0xff,0x0,0x67,0x4b,0x4b,0x7b,0xaf,0x19,0x69,0xba,0xf7,0xc6,0x3d,0x7e,0x30,0xac,0xf7,0x1e,0x21,0xbc,0x6b,0x7d,0x3d,0x24,0x1d,0x4c,0x76,0x76,0xe5,0x17,0x69,0xfe,0xec,0xcd,0x37,0xd6,0xbf,0x4f,0xf6,0x81,0x4b,0x40,0x8e,0x2f,0xe0,0xcf,0xec,0xe7,0xe0,0xf,0xd9,0xc7,0xc3,0xe7,0x49,0xf8,0x7b,0xe0,0x7f,0x8,0x78,0x17,0x4b,0x6f,0xbd,0x69,0xa0,0x68,0xf6,0xfa,0x6c,0x2e,0x7d,0x4a,0xc2,0x8a,0x9,0xc9,0x27,0x27,0x9c,0x9a,0xed,0x7,0x4a,0x29,0x19,0xc2,0xd0,0x2,0xd5,0x5d,0x5e,0xb,0x7b,0xcd,0x36,0x78,0x6f,0x23,0x86,0x6b,0x39,0x62,0x65,0x9d,0x26,0x0,0xc4,0xf1,0x91,0x86,0xe,0xf,0x5,0x48,0x27,0x20,0xf1,0x8c,0xd7,0x85,0xff,0x0,0xc1,0x40,0x7f,0xe0,0xa5,0xdf,0x7,0xff,0x0,0xe0,0x9a,0x5f,0xb,0x17,0xc5,0x1f,0x15,0x3c,0x4f,0x1e,0x9a,0xd7,0xa1,0xd7,0x49,0xd1,0x2c,0xc2,0xdc,0x6b,0x3a,0xf4,0x8b,0x8c,0xa5,0xa5,0xb6,0xe0,0x5f,0x5,0x90,0x33,0xb1,0x58,0xd0,0xba,0xef,0x75,0xdc,0x33,0xf8,0x6b,0xfb,0x53,0xff,0x0,0xc1,0x48,0xff,0x0,0x69,0x8f,0xf8,0x2d,0xba,0xde,0x78,0x7f,0x64,0x9f,0x1,0xff,0x0,0x67,0xbb,0x86,0x74,0xbc,0xd3,0xac,0x65,0x63,0xa8,0x6b,0x96,0xc7,0x19,0x4b,0xcb,0x96,0xda,0x65,0x4,0x3,0xfb,0xb4,0x58,0xe2,0xc3,0x10,0xeb,0x26,0xd0,0x6b,0x97,0x1d,0x8e,0xc3,0xe0,0xb0,0xf2,0xc5,0x62,0xa6,0xa1,0x8,0xee,0xde,0xde,0x8b,0xbb,0x7d,0x12,0xd5,0xf4,0x47,0x76,0x5b,0x96,0xe2,0xb3,0xc,0x4c,0x70,0x98,0x38,0x39,0xce,0x5b,0x25,0xf9,0xbe,0xc9,0x75,0x6e,0xc9,0x75,0x67,0xc7,0x7f,0xf0,0x50,0x3d,0x2f,0xc3,0xdf,0x7,0x3f,0xe0,0xa6,0xff,0x0,0x11,0xbe,0x35,0x7e,0xca,0xb6,0xab,0x27,0xc2,0x9f,0x85,0x3e,0x30,0xd3,0xb5,0x3d,0x3b,0x57,0xb0,0x65,0x5d,0x2e,0xd3,0x52,0x46,0x81,0xe4,0x4b,0x62,0x8,0xdf,0x6d,0xf6,0xbd,0xca,0xbb,0x32,0xa5,0x8,0xc6,0x50,0xa9,0x3f,0xd7,
-0xaf,0x80,0x7c,0x5b,0x17,0x8f,0x7c,0xb,0xa2,0xeb,0x90,0xc6,0xf0,0xc3,0xad,0x58,0xc1,0x7f,0x1c,0x6e,0x72,0xd1,0xac,0xb1,0xac,0x81,0x4f,0xb8,0xd,0x8a,0xfe,0x64,0x3e,0x8,0x7e,0xcc,0xd1,0x7f,0xc1,0x49,0x3e,0x3a,0xf8,0x4f,0xf6,0x49,0xf8,0x27,0x6b,0x25,0x9f,0xc2,0xbf,0xc,0xdd,0x43,0xa9,0xfc,0x46,0xf1,0x2c,0x1c,0xc3,0x67,0x65,0x14,0x81,0xdd,0x3c,0xdc,0x10,0xf7,0x12,0xba,0xed,0x4e,0x9,0x69,0x76,0x67,0x9,0x1c,0xa5,0x3f,0xa7,0xcd,0x27,0x4d,0x87,0x46,0xd3,0x6d,0xac,0xed,0x61,0x58,0x6d,0x6d,0x62,0x58,0x61,0x8d,0x7a,0x46,0x8a,0x2,0xa8,0x1f,0x40,0x0,0xae,0xc,0x8f,0x1b,0x8a,0xc5,0xd0,0x78,0x8c,0x4d,0x2f,0x66,0xa4,0xdb,0x84,0x5f,0xc5,0xc9,0xa5,0x9c,0x97,0x49,0x3d,0x5d,0xba,0x26,0x93,0xd5,0x33,0xbf,0x88,0x32,0xfc,0x26,0xb,0x12,0xb0,0xb8,0x5a,0xbe,0xd5,0xc6,0x2b,0x9e,0x4b,0xe1,0xe7,0xd7,0x99,0x45,0xf5,0x8a,0xd1,0x5f,0xab,0x4d,0xad,0x2c,0x5a,0xa2,0x8a,0x2b,0xd9,0x3c,0x20,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0xf3,0x1f,0x8f,0xdf,0xb6,0x7f,0xc2,0xaf,0xd9,0x5f,0xc5,0x3e,0xf,0xd1,0x7e,0x23,0x78,0xf7,0xc3,0x5e,0xb,0xd4,0xfc,0x7d,0x75,0x25,0x97,0x87,0xe1,0xd5,0xae,0xc5,0xbf,0xf6,0x9c,0xd1,0xf9,0x61,0xd5,0x18,0xfc,0xa0,0x29,0x96,0x20,0x59,0x88,0x19,0x91,0x6,0x72,0xc0,0x10,0xf,0x4e,0xa0,0xb6,0x2a,0xbd,0xf6,0xa3,0xe,0x97,0x65,0x3d,0xcd,0xd4,0xb0,0xdb,0xdb,0xdb,0x23,0x4b,0x2c,0xb2,0xb8,0x44,0x89,0x14,0x64,0xb3,0x31,0xe0,0x0,0x39,0x24,0xf0,0x5,0x7e,0x0,0xff,0x0,0xc1,0x75,0x3f,0xe0,0xea,0xd9,0x2f,0x24,0xd6,0x7e,0x12,0xfe,0xca,0xfa,0xd3,0x43,0xf,0xcd,0x67,0xac,0xfc,0x47,0xb6,0x6c,0x34,0x9d,0x44,0x91,0x69,0x47,0xf8,0x47,0xf0,0x9b,0xce,0xe,0x77,0x18,0x40,0xc2,0x4c,0x40,0x3e,0xec,0xff,0x0,0x82,0xc6,0xff,0x0,0xc1,0xc6,0xdf,0xa,0xff,0x0,0xe0,0x97,0xf6,0xda,0x87,0x83,0xf4,0x1f,0xb2,0xfc,0x47,0xf8,0xcc,0xa9,0xb4,0x78,0x7a,0xd6,0x7c,0x5a,0x68,0x6c,0xcb,0x95,0x93,0x50,0x9d,0x7f,0xd5,0xf0,0x43,0x8,0x13,0x32,0xb0,0xdb,0x9f,0x2d,0x58,0x3d,0x7f,0x34,0xbf,0xb6,0x5f,0xfc,0x14,0x3,0xe3,0xc7,0xfc,0x15,0x73,0xe3,0x65,0x8d,0xe7,0xc4,0xf,0x10,0x6b,0x7e,0x34,0xd6,0x2f,0x2e,0xbe,0xcf,0xa0,0xf8,0x6f,0x4b,0xb7,0x61,0x65,0x62,0xf2,0x36,0x16,0xb,0x2b,0x28,0xb2,0x37,0x1c,0xaa,0x6e,0xc3,0x4b,0x26,0x17,0x73,0xb9,0xe6,0xbd,0xa3,0xfe,0x9,0x5f,0xff,0x0,0x4,0x18,0xf8,0xe5,0xff,0x0,0x5,0x73,0xf1,0x13,0xf8,0x9a,0xdd,0xa4,0xf0,0x6f,0xc3,0xa9,0xee,0x5e,0x4d,0x43,0xc7,0x3e,0x20,0x86,0x59,0x52,0xfe,0x43,0x21,0x12,0x8b,0x48,0xc9,0xf,0x7b,0x36,0xed,0xe5,0x88,0x65,0x8c,0x32,0xb0,0x79,0x55,0xb0,0xf,0xf4,0xa5,0xff,0x0,0x4,0xcc,0xff,0x0,0x82,0x26,0xfc,0xa,0xff,0x0,0x82,0x59,0xf8,0x72,0x39,0x3c,0xb,0xe1,0xd5,0xd5,0xbc,0x71,0x34,0x2,0x2b,0xff,0x0,0x19,0x6b,0x48,0x97,0x3a,0xc5,0xce,0x41,0xe,0xb1,0x3e,0x2,0xdb,0x42,0xd9,0xe6,0x38,0x42,0x86,0x1,0x77,0x99,0xa,0x86,0xa0,0x67,0xe3,0x9f,0xfc,0x12,0xbf,0xfe,0xc,0xfe,0xf1,0x97,0xc5,0xf5,0xd3,0x7c,0x63,0xfb,0x4c,0x6a,0x17,0x9f,0xf,0xfc,0x3a,0xc4,0x4f,0x17,0x83,0xf4,0xd9,0x63,0x7d,0x72,0xf9,0x38,0x2b,0xf6,0x99,0x86,0xe8,0xed,0x11,0x86,0x32,0x83,0x7c,0xd8,0xc8,0x22,0x16,0x19,0x1f,0xbf,0x5f,0xb2,0xbf,0xec,0x77,0xf0,0xc3,0xf6,0x28,0xf8,0x61,0xf,0x83,0xfe,0x15,0xf8,0x23,0x43,0xf0,0x47,0x87,0xe1,0xc1,0x68,0x2c,0x21,0x3e,0x6d,0xd3,0xe,0x92,0x4f,0x33,0x96,0x96,0x79,0x30,0x71,0xbe,0x57,0x66,0xc7,0x19,0xaf,0x4c,0x3,0x2,0x8a,0x4,0x1,0x76,0xd1,0x45,0x14,0x0,0x51,0x45,0x14,0x0,0x66,0xbe,0x23,0xff,0x0,0x82,0xd2,0x7f,0xc1,0x62,0x74,0x5f,0xf8,0x25,0x97,0xc2,0x9d,0x2e,0xcf,0x47,0xd2,0xe1,0xf1,0xa7,0xc6,0x3f,0x1e,0x33,0xdb,0x78,0x47,0xc3,0x1,0x89,0x56,0x23,0x86,0xbd,0xbb,0xda,0x43,0x2d,0xac,0x64,0x81,0x85,0x21,0xe5,0x72,0x11,0x4a,0x81,0x24,0x91,0xfd,0x59,0xf1,0xff,0x0,0xe3,0x67,0x87,0x7f,0x66,0xbf,0x82,0x7e,0x2c,0xf8,0x85,0xe2,0xdb,0xbf,0xb0,0xf8,0x67,0xc1,0x7a,0x55,0xce,0xb3,0xa9,0x4c,0x0,0x2e,0x21,0x82,0x36,0x91,0x82,0x2,0x46,0xe7,0x6c,0x6d,0x55,0x7,0x2c,0xc4,0x28,0xe4,0xd7,0xf3,0x53,0x17,0xc7,0x3d,0x57,0xf6,0x86,0xf8,0x89,0xe3,0x6f,0xdb,0x27,0xe3,0x32,0x21,0xd7,0x3c,0x5a,0xef,0x17,0x83,0xf4,0x69,0xe4,0xdd,0x7,0x87,0xf4,0xb8,0xb2,0x90,0x43,0x10,0x38,0xa,0xaa,0x80,0x92,0xc0,0xd,0xcc,0x64,0x90,0x8d,0xf2,0x31,0x3e,0x4e,0x71,0x9b,0x47,0x1,0x45,0x4d,0x45,0xce,0x73,0x6a,0x30,0x82,0xde,0x73,0x96,0xd1,0x5d,0xbb,0xb7,0xb2,0x49,0xb7,0xb1,0xee,0x64,0x19,0x2c,0xb3,0x3c,0x4b,0xa4,0xe4,0xa1,0x4e,0x9,0xce,0x73,0x7b,0x42,0x11,0xde,0x4f,0xbf,0x64,0xba,0xb6,0x97,0x53,0xf,0xc4,0x1f,0xf,0x65,0x9b,0xc5,0x5a,0x9f,0xc7,0xdf,0xda,0xbf,0xc6,0x52,0x78,0xa3,0xc7,0x5a,0xd0,0xfb,0x4b,0xc7,0x7b,0x26,0xef,0x24,0x7d,0xe5,0xb7,0x86,0x25,0xc2,0xc7,0x12,0x3,0xb5,0x62,0x8d,0x42,0xa8,0xe0,0x1,0xd2,0xbb,0x5f,0xd9,0x2f,0xf6,0x5a,0xfd,0xa2,0x3f,0xe0,0xba,0x5e,0x20,0xfb,0x17,0x80,0xec,0xe6,0xf8,0x3f,0xfb,0x3c,0xd9,0xcd,0xf6,0x5d,0x47,0xc5,0x77,0x50,0x18,0xcd,0xe4,0x61,0x88,0x78,0xad,0x23,0x4,0x35,0xcc,0xb8,0x7,0x2a,0x84,0x46,0x87,0x89,0x24,0x42,0xca,0xad,0xdc,0xff,0x0,0xc1,0x1d,0xff,0x0,0xe0,0x92,0x3a,0xd7,0xfc,0x16,0x87,0xe2,0x8c,0x9f,
-0x1e,0xbe,0x39,0xff,0x0,0x69,0x47,0xf0,0x27,0x49,0xbe,0x92,0x2f,0xe,0xe8,0x46,0x46,0x80,0xf8,0xc2,0x68,0x9c,0xa3,0x9c,0xa9,0xc,0x96,0x91,0xb2,0x94,0x66,0x5c,0x17,0x60,0x63,0x56,0x5,0x24,0x35,0xfd,0x11,0xf8,0x4b,0xc2,0xda,0x67,0x81,0xbc,0x35,0x61,0xa2,0xe8,0xba,0x6d,0x86,0x8f,0xa3,0x69,0x36,0xf1,0xd9,0xd8,0xd8,0x58,0xdb,0xa5,0xbd,0xad,0x94,0x11,0xa8,0x54,0x8a,0x28,0xd0,0x5,0x44,0x55,0x0,0x5,0x50,0x0,0x0,0x0,0x2b,0x8b,0x7,0x90,0xce,0x55,0xa3,0x8e,0xcd,0xe4,0xab,0x57,0x8f,0xc2,0xad,0xfb,0xba,0x5e,0x54,0xe2,0xfa,0xf4,0x75,0x1d,0xe7,0x2e,0xe9,0x68,0x7a,0x99,0x8f,0x13,0x42,0x14,0x25,0x97,0x64,0x91,0x74,0x70,0xef,0xe2,0x7f,0xf2,0xf2,0xaf,0x9d,0x49,0x2e,0x9d,0xa9,0xab,0x45,0x76,0x6f,0x53,0xc6,0x3f,0xe0,0x9e,0xff,0x0,0xf0,0x4e,0xaf,0x86,0x1f,0xf0,0x4d,0x1f,0x80,0xd6,0xbf,0xf,0xfe,0x18,0xe8,0xf2,0x59,0xd8,0xee,0x17,0x1a,0x9e,0xa7,0x76,0xc2,0x5d,0x4b,0x5d,0xb9,0xc6,0xd,0xc5,0xd4,0xa0,0xd,0xcf,0xd8,0x2a,0x85,0x44,0x1c,0x2a,0xa8,0xe2,0xbd,0xe0,0xc,0xa,0x28,0xaf,0xa3,0x3e,0x3c,0x28,0xa2,0x8a,0x0,0x28,0xa2,0x8a,0x0,0x28,0xa2,0x8a,0x0,0x28,0xa2,0x8a,0x0,0x28,0xa2,0x8a,0x0,0x28,0xa2,0x8a,0x0,0x28,0xa2,0x8a,0x0,0x28,0xa2,0x8a,0x0,0x28,0xa2,0x8a,0x0,0x28,0xa2,0x8a,0x0,0x28,0xa2,0x8a,0x0,0x28,0x27,0x68,0xa0,0xb6,0x2b,0xf3,0x87,0xfe,0xb,0x31,0xff,0x0,0x5,0x91,0xbe,0xfd,0x94,0xfc,0x4d,0xa6,0xfc,0x31,0xf8,0x4b,0xa9,0x2a,0xf8,0xd2,0xd6,0x6b,0x4d,0x5b,0xe2,0xf,0x89,0xd7,0xc2,0xb7,0x5e,0x26,0xd3,0xbe,0x17,0xf8,0x71,0xe6,0x68,0xa4,0xd4,0x6e,0xa1,0xb7,0x3c,0xcb,0xe6,0x6c,0xc4,0x4d,0x92,0x23,0xdc,0x48,0x5,0xa2,0x24,0x3,0xe9,0xf,0xdb,0xc7,0xfe,0xa,0x89,0xf0,0xb7,0xf6,0x5,0xd2,0x2d,0xed,0x7c,0x41,0xa9,0x37,0x89,0xbe,0x21,0x6a,0xd3,0xd9,0xda,0xe8,0x5f,0xf,0xfc,0x3d,0x3c,0x17,0x9e,0x2a,0xd7,0xa6,0xbb,0x9f,0xec,0xf6,0xfe,0x45,0x89,0x91,0x65,0x68,0xda,0x50,0x57,0xcc,0xc6,0xdc,0xa9,0x3,0x73,0xe1,0x4f,0xe1,0x7f,0x8c,0x7e,0x2d,0xfc,0x54,0xff,0x0,0x82,0x82,0xfc,0x75,0xf0,0x2f,0xc6,0x9f,0x8b,0x1a,0xd7,0x87,0x7c,0x50,0xda,0xa5,0xd4,0xfe,0x17,0xd1,0x3e,0x1c,0x6a,0x51,0xbe,0x91,0xe1,0x3b,0x4d,0x61,0x17,0xec,0xfa,0xcf,0x81,0x6f,0xd6,0xe9,0xa5,0x3a,0x4e,0xa9,0xa8,0x5b,0x22,0x5c,0x59,0xde,0xcf,0x26,0xd9,0x65,0xb7,0x4c,0xaa,0x3a,0x29,0xb5,0xf3,0x9f,0x8c,0x5f,0x11,0x26,0xf8,0xb,0xf1,0xf2,0xfe,0xfb,0xf6,0x96,0xba,0xba,0xf8,0xf1,0xa7,0xfc,0x5c,0xb0,0x8b,0x51,0xbf,0xf1,0xae,0x97,0x75,0x15,0xdc,0xf7,0xba,0x3a,0x4d,0x24,0xba,0x67,0x89,0xbc,0x23,0xa8,0x4,0x8e,0x5b,0x2b,0xad,0x3a,0x47,0x96,0x39,0xb4,0xf7,0x21,0x19,0x10,0xab,0x3,0x1b,0x13,0x7,0x51,0xe3,0xbb,0xed,0x53,0xf6,0x8f,0xd6,0x3c,0x61,0x25,0xc5,0xbe,0x9f,0xf1,0x1b,0xe2,0x8f,0xfc,0x23,0xd6,0xf7,0xbe,0x3b,0xd1,0x34,0xdc,0xdb,0x69,0xbf,0xb4,0x9f,0x81,0xe3,0x1b,0xed,0x7c,0x51,0xa4,0xfc,0xa4,0x5b,0xeb,0xf6,0x28,0x81,0xdd,0x2,0xf9,0xaa,0xd1,0xcb,0xfb,0xb2,0xf0,0xde,0xda,0x38,0x7,0xdb,0x9e,0xe,0xf1,0xbc,0x3f,0x13,0xbf,0x61,0xff,0x0,0x10,0x7e,0xcd,0x5a,0xd7,0x8e,0x3c,0x4d,0x73,0xf0,0x17,0xe3,0x5,0xa5,0xcf,0x81,0xfe,0x1f,0x78,0xe3,0xc4,0x29,0x25,0xb7,0x88,0x7e,0x15,0x78,0x8e,0x26,0x50,0x9e,0xb,0xf1,0x4c,0x5f,0x7e,0x29,0xa1,0x9d,0x63,0x8e,0x32,0xe5,0x7c,0xd8,0xf3,0x8,0x2c,0xb2,0x44,0xc3,0xc3,0xff,0x0,0xe0,0x80,0x9f,0xf0,0x6d,0xdf,0xc3,0x9f,0x1b,0x78,0xab,0xc5,0xbe,0x2a,0xfd,0xa0,0x6f,0x2d,0x7c,0x55,0xe3,0x3f,0x85,0xde,0x27,0xb8,0xf0,0xe6,0xa3,0xf0,0xd3,0x61,0x5b,0x3d,0x1e,0xee,0xf,0x9a,0x39,0xaf,0xd8,0xe0,0xdd,0xc5,0x34,0x6d,0x1c,0xd0,0x88,0xff,0x0,0x70,0xf1,0x90,0x59,0xa5,0xcb,0xc5,0x1c,0x3e,0x16,0xf8,0xc3,0xe,0x8d,0xf0,0xa7,0x52,0xd4,0x3c,0x41,0x75,0xa3,0x7c,0x56,0xb8,0xf1,0x87,0x82,0x8d,0xee,0xab,0x6,0xa0,0xff,0x0,0x63,0xb5,0xfd,0xa7,0xfe,0x1f,0x5b,0x46,0xea,0x6e,0x84,0x9b,0xcf,0xd9,0xfc,0x61,0xa1,0xac,0x52,0xa4,0xaa,0x58,0x5d,0x13,0xe,0x55,0xee,0x30,0xb2,0xd7,0xdb,0xdf,0xf0,0x40,0x7f,0xd9,0xbf,0xe2,0x15,0xa7,0x8d,0x7c,0x79,0xf1,0x83,0xc6,0x9e,0x24,0xf1,0xd5,0xee,0x9b,0x7b,0xa7,0xda,0x78,0x1f,0xc3,0x43,0xc4,0xfe,0x1d,0x8f,0x4b,0xd5,0x3c,0x55,0xa1,0xda,0xac,0x57,0xba,0x6e,0xa9,0xa8,0xcc,0xb2,0x11,0x7b,0x75,0x4,0x77,0x93,0x59,0xb,0x85,0x52,0xae,0xb0,0xb9,0x59,0xa7,0x43,0x19,0x40,0xf,0xd2,0xed,0x17,0x47,0xb5,0xf0,0xf6,0x93,0x6d,0x61,0x63,0x6b,0x6f,0x63,0x63,0x65,0x12,0xc1,0x6d,0x6d,0x6f,0x18,0x8e,0x1b,0x78,0x91,0x42,0xa2,0x22,0x28,0x1,0x55,0x54,0x0,0x0,0x0,0x0,0x2a,0xd5,0x14,0x50,0x1,0x45,0x14,0x50,0x1,0x45,0x14,0x50,0x1,0x45,0x14,0x50,0x7,0xe4,0x3f,0xfc,0x1d,0x3f,0xfb,0x47,0x5f,0x78,0x9f,0xc3,0xdf,0x7,0xff,0x0,0x65,0x9d,0x2,0x69,0x23,0xba,0xf8,0xd1,0xad,0x26,0xa9,0xe2,0x49,0x23,0x39,0x30,0xe9,0x16,0x32,0xa3,0x2c,0x6c,0xbf,0xdd,0x92,0x71,0xbf,0x3d,0x7,0xd8,0xc8,0xef,0x5f,0x9e,0x9a,0xc7,0xec,0xd1,0xa9,0x7f,0xc1,0x4c,0x3f,0xe0,0xa1,0x1f,0xe,0xbf,0x66,0x1f,0x9,0xcd,0x26,0x9b,0xe1,0x3d,0x32,0x5,0xbc,0xf1,0x35,0xed,0xbf,0x23,0x4a,0xd1,0xed,0x42,0xf9,0xef,0xd0,0xfc,0xcd,0xf2,0x44,0x84,0xf0,0x65,0x92,0x30,0xd8,0x4,0x91,0xec,0x7f,0xb7,0xbf,0xc5,0x55,0xfd,0xa1,0xff,0x0,0xe0,0xe2,0xef,0x8a,0xda,0x83,0x5c,0xc9,0x7b,0x63,0xf0,0x67,0xc2,0xb6,0xde,0x1e,0xd3,0x41,0xfb,0x90,0x15,0x81,0x64,0x9d,0x47,0xd2,0xe2,0xe6,0xe3,0xf1,0x26,0xbd,0xdb,0xfe,0xd,0x2a,
-0xf8,0x7b,0xa7,0xfc,0x45,0xf8,0x89,0xfb,0x4d,0x7c,0x68,0xb9,0x65,0xba,0xd6,0xaf,0xbc,0x41,0x6f,0xe1,0x2b,0x17,0x60,0x77,0xda,0x59,0xc2,0xa6,0xe2,0x40,0xe,0x31,0x89,0x19,0xa0,0x24,0x67,0xac,0x3,0xa7,0x7f,0x96,0xa5,0xfe,0xd1,0xc4,0x52,0x94,0xb6,0xc3,0x52,0x5c,0xbf,0xe3,0xaa,0xe4,0x9b,0xf5,0x50,0x85,0x97,0x94,0xd9,0xf6,0x92,0xff,0x0,0x63,0xe1,0x74,0xa3,0xf1,0x62,0xaa,0xbb,0xff,0x0,0x82,0x92,0x8b,0x4b,0xd1,0xce,0x57,0xf5,0x8a,0x3f,0x63,0x3e,0x19,0xfc,0x39,0xd0,0xfe,0xf,0xfc,0x3a,0xd0,0xfc,0x27,0xe1,0x9d,0x2e,0xdf,0x45,0xf0,0xdf,0x86,0x6c,0x20,0xd2,0xf4,0xbb,0xb,0x70,0x44,0x56,0x76,0xb0,0xc6,0xb1,0xc5,0x12,0xe4,0x93,0x85,0x45,0x3,0x92,0x4f,0x1c,0x93,0x5e,0x37,0xfb,0x7f,0xff,0x0,0xc1,0x4e,0x7e,0xd,0x7f,0xc1,0x34,0x7e,0x1b,0x43,0xe2,0x2f,0x8a,0xde,0x2a,0x87,0x4a,0x92,0xfc,0x3f,0xf6,0x56,0x8b,0x68,0xa2,0xe7,0x58,0xd6,0xd9,0x71,0xb9,0x6d,0xad,0x81,0xc,0xc0,0x12,0xa1,0xa4,0x62,0xb1,0xa1,0x65,0xc,0xeb,0xb8,0x67,0xd9,0xbe,0x22,0xf8,0xff,0x0,0x49,0xf8,0x4d,0xf0,0xff,0x0,0x5d,0xf1,0x46,0xbd,0x74,0xb6,0x3a,0x1f,0x86,0xf4,0xf9,0xf5,0x4d,0x46,0xe1,0x87,0xcb,0x5,0xbc,0x31,0xb4,0x92,0x3f,0xaf,0x8,0xa4,0xfe,0x15,0xfc,0xb6,0x78,0x13,0xc5,0x5a,0x8f,0xfc,0x14,0xd3,0xf6,0xac,0xf1,0xdf,0xed,0x39,0xf1,0x8a,0x49,0x6f,0x2c,0x7c,0xf7,0xb9,0xd1,0xf4,0xbb,0xa9,0xc,0xb0,0x68,0xba,0x6a,0x33,0xfd,0x92,0xce,0x35,0xfb,0xa1,0x23,0x50,0xd9,0x0,0xd,0xcd,0xb9,0xce,0x5a,0x46,0x27,0xdb,0xcc,0xb1,0xf4,0xb0,0x38,0x4a,0x98,0xca,0xf7,0xe5,0x82,0xd9,0x6a,0xdb,0x6d,0x46,0x31,0x4b,0xab,0x94,0x9a,0x8a,0x5d,0xd9,0xf3,0xb9,0x3e,0x57,0x5b,0x32,0xc6,0xd3,0xc1,0x50,0xb2,0x94,0xde,0xef,0x68,0xa4,0x9b,0x94,0x9b,0xe8,0xa3,0x14,0xdb,0xf2,0x47,0xe8,0x46,0xb1,0xff,0x0,0x7,0x5f,0xfc,0x42,0xf1,0x4d,0xe8,0xd4,0xbc,0x5,0xfb,0x1b,0xf8,0xeb,0x5c,0xf0,0x78,0xf9,0x85,0xf6,0xa5,0xaf,0x1b,0x4b,0x9b,0x84,0xcf,0x55,0x8e,0x3b,0x49,0x15,0x78,0xc7,0x47,0x7a,0xfb,0x33,0xfe,0x9,0x63,0xff,0x0,0x5,0xd1,0xf8,0x4f,0xff,0x0,0x5,0x46,0xd5,0x35,0xf,0xb,0xe9,0xb6,0xba,0xc7,0xc3,0xff,0x0,0x8a,0x5a,0x24,0x4d,0x71,0xa8,0x78,0x37,0x5f,0x1,0x6e,0xfc,0xa5,0x20,0x34,0xb6,0xf2,0x0,0x16,0x74,0x5c,0x8d,0xc3,0xa,0xeb,0x9c,0x94,0xb,0x86,0x3f,0x84,0x9e,0x2d,0xfd,0xb1,0x3e,0x32,0x78,0x87,0xc0,0xba,0xe7,0xc5,0x6f,0x9,0xf8,0xf,0xc5,0xbf,0xf0,0xa4,0x3c,0x1f,0xaa,0x8d,0x1f,0x50,0xf1,0x15,0x86,0x9e,0x8f,0xa6,0xd9,0xcb,0x94,0x50,0xac,0x48,0xcb,0x28,0x69,0x23,0x56,0x60,0x42,0x83,0x22,0x8c,0x82,0xcb,0x97,0x7c,0x73,0xf8,0xa9,0x75,0xa5,0x78,0x33,0xc0,0x3f,0xb5,0x87,0xc3,0x66,0xb7,0xd2,0x7e,0x23,0xfc,0x2b,0xd6,0xad,0x2f,0x2e,0x6e,0xad,0x1,0x8e,0x3d,0x4a,0xd9,0x99,0x54,0xac,0x83,0x82,0xd1,0xb8,0x75,0x56,0x56,0xeb,0x1c,0xd2,0xa1,0xc8,0xaf,0xd,0x66,0x99,0xb6,0x12,0xa5,0x29,0x66,0xd4,0x61,0x1a,0x75,0x64,0xa2,0x9c,0x26,0xe4,0xe9,0xca,0x5f,0xc,0x6a,0x5e,0x31,0x4f,0x99,0xfb,0xbc,0xd0,0x6d,0x73,0x59,0x75,0x4c,0xfa,0x6a,0x99,0xe,0x4d,0x8b,0xa3,0x5a,0x39,0x2e,0x22,0x73,0xab,0x46,0x2e,0x6d,0x4e,0xa,0x2a,0xa4,0x63,0x6e,0x69,0x53,0xb4,0x9b,0x5c,0xab,0x5e,0x59,0x24,0xdc,0x6e,0xfa,0x58,0xfe,0xad,0x3,0x6e,0x14,0x57,0x39,0xf0,0x8b,0xe2,0x5e,0x9b,0xf1,0xa3,0xe1,0x5f,0x86,0xbc,0x61,0xa2,0xc8,0xd2,0xe8,0xfe,0x2c,0xd2,0xad,0xb5,0x8b,0x17,0x61,0x82,0xd0,0xdc,0x44,0xb2,0xa1,0x23,0xb7,0xca,0xe2,0xba,0x3a,0xfa,0xad,0xb4,0x3e,0x1c,0x28,0xa2,0x8a,0x0,0x28,0xa2,0x8a,0x0,0x28,0xa2,0x8a,0x0,0x28,0xa2,0x8a,0x0,0x28,0xa2,0x8a,0x0,0x28,0xa0,0x9c,0x52,0x6f,0x5f,0x5a,0x0,0x5a,0x28,0x7,0x34,0x50,0x1,0x45,0x14,0x50,0x1,0x45,0x14,0x50,0x1,0x41,0x38,0xa2,0x8a,0x0,0xfc,0xe1,0xff,0x0,0x82,0xf6,0xff,0x0,0xc1,0x64,0xef,0xbf,0xe0,0x9f,0x5e,0x14,0xb3,0xf8,0x7b,0xe0,0x24,0xd6,0x6c,0x7e,0x26,0x78,0x93,0x4f,0xb7,0xd6,0xee,0xbc,0x52,0x9a,0x8,0xd5,0xb4,0xbf,0x1,0x68,0x6f,0xa8,0x45,0x65,0x36,0xab,0x71,0x11,0x27,0xcd,0x71,0x24,0x82,0x38,0xa3,0x28,0xc8,0x5d,0xd7,0x71,0x4,0xa2,0x49,0xf8,0xe7,0xe1,0xf4,0xf1,0x27,0xec,0x97,0xf1,0xab,0x4f,0xf0,0x97,0x81,0x75,0xaf,0xc,0x6b,0x1e,0x3c,0xbf,0xf3,0xb5,0x4f,0x0,0x7c,0x46,0xb2,0x88,0xc9,0xa1,0x7e,0xd0,0xda,0xe,0xa5,0x34,0xcd,0x26,0x8d,0xe2,0xb,0x79,0x24,0x64,0xb8,0x9a,0xe6,0x51,0x2c,0x9,0xe6,0x92,0x63,0xba,0x8d,0xed,0x65,0x60,0x4c,0x37,0x30,0xfe,0xb2,0x7f,0xc1,0xc6,0xdf,0x13,0x7e,0x1f,0xfe,0xc7,0x5a,0x97,0xc0,0xef,0x8e,0x7e,0x28,0x82,0xc7,0x58,0x9a,0x3d,0x5e,0xf7,0xe1,0xff,0x0,0x89,0x3c,0x29,0x2b,0xae,0xff,0x0,0x1b,0x78,0x47,0x54,0xb5,0x90,0x6a,0x76,0xc6,0x3e,0x1a,0x4f,0xb3,0xb4,0x70,0x4c,0x84,0x95,0x44,0x91,0xc0,0x62,0xc,0x8b,0x9f,0xca,0xbf,0xf8,0x28,0xcf,0xfc,0x13,0xca,0xcb,0xf6,0x1,0xf0,0x7e,0x93,0x6f,0x6b,0xad,0x6a,0x1e,0x36,0xfd,0x94,0xfe,0x28,0x4d,0xfd,0xb9,0xe0,0xbf,0x18,0x41,0x1,0xbc,0x87,0x4c,0x5b,0xd8,0xa3,0x2a,0xf9,0x50,0x16,0x3b,0xcf,0x25,0x20,0xf3,0xa2,0xcc,0x69,0xa9,0xdb,0xc1,0x14,0x91,0xf9,0x57,0x56,0xa0,0xc4,0xd,0x17,0x3c,0xf,0xe0,0xdf,0x6,0xfc,0x40,0xf8,0x37,0x67,0xa2,0x44,0x75,0xf,0xa,0x7e,0xce,0x3f,0x13,0x7c,0x4a,0xf6,0x9e,0x1b,0xbf,0xd5,0x8b,0x5c,0x6a,0x1f,0xb3,0x1f,0xc4,0x4f,0x97,0xcc,0xd3,0xae,0x64,0x71,0xb9,0xf4,0x9b,0xb3,0xb6,0x36,0x32,0x85,0x59,0x6d,0xe5,0x8e,0x47,0x11,0xdc,0x5b,0x48,0x5b,0x27,0xe0,0xe7,0xc1,0x7d,0x5b,0xe1,0x4f,0xc4,
-0x3b,0x5f,0x9,0xde,0xf8,0xaa,0x1f,0x85,0x3a,0xdf,0x81,0xbc,0x60,0x74,0xdb,0x1d,0x4a,0x79,0x4a,0xcb,0xf0,0x1f,0xc7,0x61,0xc8,0x8c,0x4b,0x21,0x4,0x49,0xe1,0x7d,0x65,0xa3,0x60,0xb2,0x8d,0xc8,0x8c,0xc8,0x5b,0x77,0x92,0xcd,0x7d,0xe9,0xff,0x0,0xb2,0xf7,0xc4,0xd6,0xf8,0x41,0x65,0xe3,0x6f,0x10,0x7c,0x65,0xd0,0x17,0xc6,0x11,0xdc,0x78,0x76,0xc3,0x4b,0xf8,0xe1,0xe1,0xeb,0x69,0x17,0x50,0xb6,0xf8,0xb9,0xe0,0x8b,0xc7,0x48,0x34,0x6f,0x1d,0x69,0x72,0x2,0xbf,0x68,0xbe,0xb3,0xb9,0x9a,0x18,0xe7,0x99,0x6,0xe7,0x57,0x49,0x9,0x86,0xe8,0xdc,0x38,0xfa,0x4b,0xfe,0x9,0xc7,0xff,0x0,0x4,0x3b,0xb5,0xfd,0xb9,0xb5,0x3f,0x89,0x7e,0x3a,0xf8,0x99,0xf1,0x3b,0xe2,0x7d,0xf7,0x84,0x61,0x95,0xbe,0x16,0xe8,0xea,0xde,0x17,0x5f,0xf,0x6a,0x7e,0x36,0xf0,0xce,0x9b,0x77,0x6d,0x73,0x69,0x26,0xa7,0x25,0xfd,0xaf,0x9d,0x71,0x95,0x86,0xd2,0xdd,0x98,0x41,0xc,0xc8,0xfa,0x71,0x41,0x31,0x11,0x8c,0x82,0x22,0xff,0x0,0x82,0x64,0xfe,0xc3,0x1a,0x4f,0xfc,0x15,0x1b,0xf6,0x8d,0xd6,0x7c,0x73,0xe3,0xf,0x87,0x3a,0xd7,0x86,0xff,0x0,0x67,0xfd,0x3f,0xce,0xd7,0x9f,0xc0,0x3a,0xf7,0x86,0xed,0x67,0xf0,0xeb,0xf8,0xae,0xfe,0x1b,0xed,0x2f,0x5f,0x83,0x46,0xbe,0xf3,0x59,0xfe,0xc4,0xb7,0x56,0x90,0xdd,0x83,0x6,0x2,0xce,0xb1,0xf1,0x13,0x44,0x8c,0xdf,0xb6,0xde,0x10,0xf0,0x96,0x9b,0xe0,0x5f,0xa,0x69,0x7a,0x26,0x8d,0x63,0x6d,0xa5,0xe8,0xfa,0x2d,0xa4,0x56,0x36,0x16,0x56,0xc8,0x23,0x86,0xd2,0x8,0x90,0x24,0x71,0x22,0x8e,0x15,0x55,0x54,0x28,0x3,0x80,0x0,0xa6,0x78,0x2b,0xc0,0xfa,0x3f,0xc3,0x7f,0xb,0xd8,0xe8,0x7e,0x1e,0xd2,0x74,0xbd,0x7,0x43,0xd2,0xa1,0x16,0xf6,0x5a,0x76,0x9d,0x6a,0x96,0xb6,0x96,0x71,0xe,0x89,0x1c,0x51,0x80,0x88,0xa3,0xb0,0x50,0x5,0x6a,0xd0,0x1,0x45,0x14,0x50,0x1,0x45,0x14,0x50,0x1,0x45,0x14,0x50,0x1,0x45,0x14,0x50,0x7,0xf3,0x1f,0x75,0x12,0xe8,0xbf,0xf0,0x5c,0xbf,0xdb,0x1f,0x47,0x93,0xcd,0xfb,0x66,0xa5,0xad,0x6a,0x33,0xc0,0x64,0x18,0x62,0x1e,0x63,0x26,0x7,0xb6,0x24,0x18,0xf5,0x18,0xaf,0xbb,0xff,0x0,0xe0,0xce,0x3d,0x4e,0xda,0xc7,0xf6,0x39,0xf8,0xdf,0xa0,0xc8,0x15,0x75,0xad,0x2f,0xe2,0x9d,0xdc,0xd7,0x89,0x8f,0x9d,0x63,0x92,0xc6,0xcd,0x23,0xcf,0xb6,0xe8,0x26,0xc7,0xd0,0xd7,0xcb,0x3f,0xf0,0x71,0x67,0xc0,0x8f,0x10,0x7f,0xc1,0x3b,0x3f,0xe0,0xac,0x9a,0x17,0xed,0x33,0xa6,0xd9,0x5c,0x5d,0x7c,0x3d,0xf8,0xb5,0xc,0x16,0xba,0xc4,0xa8,0x3e,0x4b,0x6d,0x4a,0x8,0x16,0x9,0xed,0x8e,0x38,0x53,0x25,0xb4,0x51,0x4f,0x1e,0xe3,0x97,0x65,0xb8,0x0,0x7c,0x86,0xbc,0xf3,0xe0,0xff,0x0,0xed,0x41,0xe3,0x8f,0xf8,0x25,0xd7,0xed,0x30,0x9f,0xb4,0x3f,0xc1,0x18,0xa1,0xf1,0xb7,0xc3,0x1f,0x8a,0x50,0xc0,0x7c,0x5d,0xe1,0x53,0x37,0x97,0x6f,0xac,0x46,0xa5,0x8a,0xbc,0x72,0x60,0xf9,0x57,0x8,0x59,0xca,0x36,0x9,0x56,0x67,0x52,0x18,0x33,0x21,0xf9,0x58,0x4b,0xea,0x99,0xfc,0xa3,0x3f,0x87,0x15,0x18,0x28,0x3f,0xfa,0x79,0x4f,0x99,0x38,0x7a,0xb8,0xb5,0x28,0xae,0xb6,0x95,0xb5,0x56,0x3e,0xde,0x54,0xfe,0xbf,0xc3,0x50,0xf6,0x3a,0xcb,0x9,0x39,0xb9,0xae,0xbe,0xce,0xa7,0x2b,0x53,0xb7,0x65,0x24,0xd4,0x9f,0x4b,0xc6,0xfb,0x9f,0xbe,0x9f,0xf0,0x53,0xaf,0x87,0x1a,0xa7,0xc6,0xf,0xf8,0x27,0x37,0xc7,0x6f,0xb,0xe8,0xb1,0x35,0xc6,0xb1,0xaf,0xf8,0xb,0x5a,0xb1,0xb3,0x85,0x7e,0xf4,0xb2,0xbd,0x94,0xa1,0x10,0x7b,0x93,0x81,0x8f,0x7a,0xfe,0x6f,0x7f,0x60,0x8b,0xc5,0xf8,0x91,0xfb,0x1b,0xf8,0x8b,0xc3,0xf6,0x7b,0x7e,0xdb,0x3e,0x8d,0xc,0xb0,0x22,0xf5,0x90,0xc7,0x1b,0x46,0xc3,0xfe,0xfb,0x5c,0x7e,0x35,0xfb,0xaf,0xfb,0x2e,0xff,0x0,0xc1,0xc3,0x9f,0xb2,0x4f,0xed,0x3f,0xe1,0x48,0xe7,0x9b,0xe2,0xae,0x81,0xf0,0xef,0x59,0x58,0xd7,0xfb,0x43,0x41,0xf1,0xdc,0xcb,0xa0,0xdd,0xd8,0x48,0x47,0x31,0x33,0xdc,0x11,0x4,0xa4,0x74,0x26,0x29,0x1c,0x7d,0x3a,0x57,0xe1,0x17,0xed,0x7e,0x9e,0x9,0xff,0x0,0x82,0x5a,0x7e,0xdd,0xba,0xe4,0x1f,0xd,0x7e,0x20,0xf8,0x17,0xc6,0x9f,0xa,0x7c,0x4b,0x73,0x3f,0x88,0x7c,0x25,0x77,0xe1,0xad,0x6e,0xd7,0x57,0x8f,0x4e,0xb7,0x99,0xb3,0x36,0x95,0x73,0x1d,0xb3,0xbb,0x47,0xe5,0xb1,0xdb,0x19,0x20,0x7,0x4d,0xac,0x9,0x3b,0xc2,0x7b,0x99,0xc6,0x5b,0x57,0x1d,0x80,0xa9,0x84,0xa2,0xd4,0x6a,0xde,0x13,0x83,0x96,0x8b,0x9e,0x9c,0xe3,0x38,0xa6,0xfa,0x29,0x38,0xf2,0xb7,0xd2,0xe7,0x89,0xc3,0x39,0xad,0x1c,0xbb,0x32,0xa7,0x8a,0xc4,0x26,0xe9,0x35,0x28,0x4e,0xda,0xbe,0x4a,0x90,0x70,0x93,0x4b,0xab,0x5c,0xd7,0x4b,0xad,0xac,0x7d,0xa5,0xff,0x0,0x4,0xc4,0xfd,0xae,0x7c,0xb,0x6b,0xff,0x0,0x6,0xc3,0x7e,0xd2,0xbf,0xc,0x7c,0x59,0x71,0x65,0xa6,0x6b,0x1f,0x7,0x74,0x6f,0x11,0x68,0x9a,0x95,0xb4,0xce,0xab,0x25,0xd1,0xd5,0x8c,0xef,0xa6,0xce,0x1,0xff,0x0,0x9e,0xd7,0x57,0x26,0x4,0xee,0x5a,0x11,0xea,0x2b,0xf3,0xfb,0xe1,0xd6,0x9e,0x7c,0xb,0xff,0x0,0x4,0x97,0xf8,0x86,0xda,0x81,0xdd,0xd,0xce,0x99,0x6b,0xa,0x2b,0xc,0x6d,0x9a,0x52,0xac,0x17,0x7,0xba,0x99,0x50,0x7f,0xc0,0x6b,0x98,0xd4,0x3e,0x17,0x6a,0x3f,0xf0,0x50,0x2f,0xda,0x5e,0x4d,0x7b,0xc3,0xbe,0xe,0xd4,0x3c,0x13,0xe1,0xbd,0x42,0x28,0x3f,0xb4,0xad,0xa6,0x95,0x87,0xf6,0xbb,0x23,0x6f,0xf3,0x2e,0x11,0x70,0xa8,0x9b,0x80,0x20,0x10,0x49,0xda,0x8,0xc9,0x39,0x5f,0xa4,0xfe,0x1e,0x7c,0x2c,0xf0,0x3f,0xed,0xab,0xfb,0x62,0xfc,0x3c,0xfd,0x95,0xd3,0xc6,0x5e,0x1b,0xd0,0xbc,0x7,0xa1,0xea,0x29,0xae,0xfc,0x41,0xd6,0x35,0xd,0x5a,0x1b,0x16,0xd5,0xcc,0x2e,0xb9,0xd3,0x6d,0x4b,0xba,0xf9,0xb7,0x32,0xb3,0x84,
-0xd8,0x9b,0x99,0x33,0xbb,0x4,0x42,0xe2,0xbe,0x7f,0x3f,0xc5,0x4b,0x17,0xc,0x3e,0x54,0xa0,0xe3,0x5e,0xa4,0xe9,0x54,0x9c,0x2e,0x9b,0xa5,0x8,0x49,0x4d,0xb9,0xb5,0x74,0x9b,0x69,0x46,0x3f,0xcd,0x76,0xd6,0x88,0xfa,0x4e,0x1f,0xc0,0xc7,0x2f,0x78,0xac,0xde,0x53,0xe6,0xa1,0x4e,0x15,0x29,0xd3,0x9d,0x9a,0x55,0x67,0x38,0xb8,0x25,0x14,0xec,0xda,0x49,0xb9,0x4b,0xa4,0x6c,0x93,0xd5,0x9f,0xd0,0xaf,0xfc,0x13,0x5b,0xc2,0x57,0x9e,0x3,0xff,0x0,0x82,0x77,0x7c,0x7,0xd1,0x75,0x8,0xe4,0x8b,0x50,0xd2,0xfe,0x1e,0xe8,0x36,0xb7,0x31,0xc8,0x30,0xd1,0xca,0xba,0x7c,0x1,0xd4,0xfb,0x86,0xc8,0xfc,0x2b,0xdb,0x2a,0x3b,0x78,0x63,0xb5,0x85,0x63,0x8a,0x35,0x8e,0x34,0x50,0xa8,0xa8,0x30,0xaa,0xa3,0x80,0x0,0x1d,0x0,0xa7,0xee,0xf6,0x3f,0x95,0x7d,0x71,0xf9,0xf8,0xb4,0x56,0x6f,0x8a,0xbc,0x65,0xa4,0x78,0x17,0x47,0x93,0x50,0xd6,0xf5,0x4d,0x37,0x47,0xd3,0xe1,0x5,0xa4,0xb9,0xbe,0xb9,0x4b,0x78,0x50,0x1,0x92,0x4b,0xb9,0x0,0x60,0x2,0x79,0x35,0xf2,0xf,0xed,0x25,0xff,0x0,0x7,0x9,0x7e,0xc7,0xff,0x0,0xb3,0x5,0xac,0x9f,0xda,0xff,0x0,0x1b,0x3c,0x2b,0xe2,0x2b,0xe0,0x18,0x25,0x8f,0x84,0xe4,0x6f,0x10,0x4c,0xec,0x33,0x94,0x2d,0x68,0x1e,0x28,0xdb,0x8c,0x7e,0xf1,0xd0,0x67,0xbd,0x0,0x7d,0xa1,0x45,0x7e,0x1b,0x7e,0xd0,0x9f,0xf0,0x7b,0x47,0x80,0x74,0x19,0x67,0xb7,0xf8,0x5b,0xf0,0x53,0xc5,0x9e,0x26,0x6f,0x99,0x63,0xbd,0xf1,0x2e,0xad,0xe,0x8f,0x1a,0x9e,0x70,0xe2,0x18,0x56,0xe1,0x9d,0x7a,0x1c,0x17,0x43,0xcf,0x6a,0xf8,0xc3,0xe3,0x17,0xfc,0x1e,0x29,0xfb,0x58,0x7c,0x41,0x13,0x43,0xe1,0xdb,0x1f,0x85,0xbe,0x1,0x85,0x8b,0x8,0x64,0xd3,0x74,0x39,0x6f,0x2e,0x91,0x4f,0x4d,0xcf,0x77,0x34,0xb1,0xb3,0xf,0x51,0x1a,0x8f,0x6a,0x2e,0x3b,0x33,0xfa,0x98,0xa2,0xbf,0x8d,0x1f,0x89,0x3f,0xf0,0x5f,0xaf,0xdb,0x2f,0xe3,0xb,0x4a,0x9a,0x87,0xed,0x1,0xe3,0xcb,0x5f,0x39,0x8b,0xec,0xd0,0x9a,0x1d,0x1f,0x6f,0xb2,0x9b,0x38,0xe3,0x60,0x3d,0xb3,0x5c,0x1c,0xdf,0xb4,0x97,0xed,0x65,0xf1,0xd1,0x9b,0x7f,0x8f,0x3f,0x68,0xbf,0x18,0x79,0xa3,0x69,0xff,0x0,0x89,0xd6,0xb3,0x7c,0x1c,0x75,0xc6,0x37,0xb5,0x4f,0x30,0xf9,0x59,0xfd,0xb5,0x51,0x5f,0xc4,0x7d,0x87,0xc1,0x7f,0xda,0xaa,0x7b,0xf5,0xbc,0xb6,0xf0,0x97,0xed,0xc,0xd7,0x4a,0xdb,0x96,0x78,0xf4,0xdd,0x60,0xc8,0xa7,0xd4,0x30,0x5c,0xfe,0xb5,0xd8,0x5a,0x78,0x7f,0xf6,0xea,0xb0,0x81,0x56,0xde,0xcf,0xf6,0xb4,0xb7,0x8d,0x46,0x0,0x8d,0x7c,0x40,0xaa,0x7,0xe1,0x47,0x30,0x72,0xb3,0xfb,0x40,0xa2,0xbf,0x8c,0x84,0xfd,0xa3,0xbf,0x6f,0x1f,0x81,0x50,0xb5,0xc4,0xbe,0x34,0xfd,0xac,0x3c,0x33,0x6e,0xb8,0x77,0x37,0x7a,0x86,0xbb,0xc,0x38,0x1d,0x37,0x9,0xe,0xd2,0x3e,0xbc,0x57,0xb0,0x7c,0xd,0xff,0x0,0x83,0xa8,0x3f,0x6c,0xef,0x80,0xd7,0x51,0xdb,0xea,0x7e,0x36,0xd1,0x3c,0x79,0x6f,0x6a,0x71,0xf6,0x3f,0x16,0xe8,0x10,0xc8,0x4e,0x3a,0x86,0x96,0xdf,0xc8,0x9c,0xfe,0x32,0x66,0x9d,0xc5,0xca,0x7e,0xe3,0xff,0x0,0xc1,0x72,0xff,0x0,0xe0,0xb8,0xd7,0x9f,0xf0,0x4b,0x3f,0x10,0x7c,0x34,0xf0,0x2f,0x80,0xfc,0x17,0x67,0xf1,0x1f,0xe2,0xb7,0xc4,0xab,0xb0,0xf6,0xda,0x34,0xf7,0xe,0x89,0x6d,0x66,0x25,0x58,0x50,0x95,0x8f,0xf7,0x8d,0x2d,0xc4,0xcc,0xd1,0x42,0x7,0x19,0x8a,0x52,0x73,0xb4,0x2b,0xfe,0x7b,0xff,0x0,0xc1,0x42,0x7f,0xe0,0xaf,0x1f,0x1f,0xff,0x0,0x69,0x1f,0xf8,0x38,0x17,0xc0,0xbf,0x5,0xfe,0x1,0xf8,0xeb,0x58,0xf0,0xce,0x85,0xe0,0xdf,0x14,0xe9,0xfe,0x15,0x93,0x4c,0xd3,0xee,0x9b,0xfb,0x37,0x54,0xbf,0x49,0x95,0xb5,0x59,0xaf,0x91,0x47,0xfa,0x44,0x30,0x9f,0x36,0x26,0x57,0xc,0xa2,0x3b,0x46,0x75,0x55,0x66,0x62,0x7e,0x45,0xf8,0x3f,0xfb,0x75,0x6b,0xff,0x0,0xb5,0x7f,0xed,0xed,0xf1,0xa3,0xf6,0xea,0xf1,0xf6,0x8f,0xa6,0xda,0xb7,0xc1,0xdf,0xe,0x45,0xaa,0x68,0xba,0x60,0x56,0xba,0xd3,0x20,0xf1,0xc,0xd0,0xa6,0x97,0xa0,0xd9,0xa0,0x90,0xee,0xf9,0x67,0xf3,0x2f,0xb0,0x39,0xc5,0x8c,0xed,0xc6,0x9,0xaf,0xa2,0xbf,0xe0,0xcd,0x3f,0xd9,0x97,0x41,0xf8,0xa3,0xfb,0x5e,0x7c,0x41,0xf8,0xd1,0xe2,0x6f,0x10,0x69,0x37,0xde,0x2a,0xf0,0x85,0x93,0x58,0x68,0x5a,0x5d,0xc6,0xa3,0x14,0xba,0xac,0xd7,0x37,0xa1,0xbe,0xd9,0xa8,0x98,0x4b,0x79,0xdb,0x56,0x1c,0xc4,0x25,0x2b,0xb5,0xcd,0xd4,0xa3,0x39,0x42,0x29,0x8c,0xfe,0x91,0x90,0xf5,0xa7,0x52,0x6,0xcd,0x2d,0x4,0x85,0x14,0x51,0x40,0x5,0x14,0x51,0x40,0x5,0x70,0x5f,0xb4,0xf7,0xed,0x25,0xe1,0x1f,0xd9,0x3,0xe0,0x27,0x8a,0xbe,0x25,0xf8,0xf3,0x53,0x1a,0x4f,0x84,0xfc,0x1f,0x62,0xd7,0xfa,0x85,0xc6,0xdd,0xce,0x40,0x21,0x52,0x38,0xd7,0x8d,0xd2,0xc9,0x23,0x24,0x68,0x9d,0x59,0xdd,0x47,0x7a,0xef,0x58,0xf1,0x5f,0xcd,0x77,0xfc,0x1d,0xdb,0xff,0x0,0x5,0x58,0x6f,0x8e,0x9f,0x1d,0xad,0x7f,0x66,0xff,0x0,0x6,0xea,0x9b,0xfc,0x23,0xf0,0xde,0xe1,0x6f,0x3c,0x59,0x24,0xf,0xfb,0xbd,0x4b,0x5a,0xda,0x76,0xdb,0x12,0xe,0x19,0x2d,0x63,0x6e,0x47,0x4f,0x3a,0x47,0x4,0x66,0x25,0x34,0x1,0xf3,0x47,0x88,0xfc,0x4b,0xf1,0xa3,0xfe,0xe,0x81,0xff,0x0,0x82,0xb1,0xdb,0x58,0xc3,0xe7,0x69,0xba,0x5d,0xd3,0xb0,0xb3,0xb5,0x24,0xc9,0x63,0xe0,0x2f,0xe,0x45,0x2a,0xef,0x95,0xba,0x6,0x93,0xc,0xa5,0x9b,0x83,0x34,0xf2,0xaa,0x8d,0xaa,0x51,0x53,0xfa,0x98,0xd2,0x7f,0x63,0x7f,0x86,0xfa,0x6f,0xec,0xa1,0xa7,0xfc,0x11,0x9b,0xc2,0xba,0x76,0xad,0xf0,0xc7,0x4f,0xd0,0x61,0xf0,0xda,0xe8,0x9a,0x84,0x62,0xe2,0x19,0xec,0xe2,0x8d,0x51,0x43,0xee,0xe5,0x9f,0xe5,0xd,0xe6,0x70,0xdb,0xfe,0x60,0x43,0x73,0x5f,0x17,0xff,0x0,0xc1,0xb3,0x9f,
-0xf0,0x4b,0x55,0xff,0x0,0x82,0x7b,0xfe,0xc2,0x36,0x3e,0x24,0xf1,0x26,0x9e,0xb6,0xff,0x0,0x13,0xfe,0x2e,0x45,0x6,0xbb,0xad,0x17,0x8f,0x13,0x69,0xb6,0x65,0x4b,0x59,0x58,0x1c,0x80,0x54,0xa4,0x6e,0x64,0x91,0x48,0x4,0x4b,0x33,0xa9,0xce,0xc5,0x35,0xfa,0x40,0x38,0x14,0x90,0xd9,0xf9,0x85,0xe0,0xdf,0xf8,0x36,0x33,0xe1,0xde,0x99,0xf1,0xb7,0xc1,0xdf,0xf0,0x92,0x78,0xba,0xeb,0xc6,0xbf,0x4,0x7e,0x1c,0x43,0xac,0x47,0xe1,0x6f,0x2,0xea,0x7a,0x71,0x8e,0xf7,0x4f,0x4d,0x4a,0x55,0x99,0xec,0xa6,0xd5,0x61,0x99,0x25,0xb9,0xb1,0x86,0x6f,0x3a,0x58,0xa2,0x74,0xdd,0x9b,0x89,0x55,0xde,0x45,0x76,0xd,0xfa,0x75,0xa,0x79,0x6b,0xb7,0x1,0x54,0x0,0x0,0x3,0xa5,0x3e,0x8a,0x62,0xa,0x28,0xa2,0x80,0xa,0x28,0xa3,0x34,0x0,0x51,0x46,0x68,0x27,0x14,0x0,0x51,0x46,0xee,0x68,0xa0,0x2,0x8a,0x28,0xa0,0xf,0x37,0xfd,0xac,0x3f,0x65,0x2f,0x4,0x7e,0xda,0xff,0x0,0x0,0xbc,0x43,0xf0,0xd3,0xe2,0x26,0x8a,0x9a,0xdf,0x85,0x7c,0x4b,0x7,0x93,0x71,0xe,0xed,0x93,0x40,0xea,0x43,0x47,0x3c,0x2f,0xd6,0x39,0x63,0x70,0xae,0xac,0x3a,0x10,0x3a,0x8c,0x83,0xf8,0x13,0xf1,0xdf,0xfe,0x8,0xef,0xfb,0x53,0xff,0x0,0xc1,0x21,0xf5,0x3d,0x6a,0x1f,0x1,0xf8,0x62,0x4f,0xda,0x47,0xe0,0x1d,0xe4,0xef,0x3a,0xda,0x69,0xf0,0x19,0x75,0x7d,0x3a,0x33,0xce,0x25,0xb3,0x5c,0xca,0xb2,0x75,0xcb,0xc0,0xb2,0xc2,0xc1,0x77,0xb0,0x89,0x98,0x28,0xfe,0x8f,0xa9,0xa,0xe4,0xd7,0xe,0x61,0x96,0xe1,0xb1,0xd4,0x1e,0x1b,0x17,0x5,0x28,0x3b,0x3b,0x3e,0xeb,0x66,0x9a,0xd5,0x35,0xd1,0xa6,0x9a,0xee,0x7a,0x19,0x5e,0x6b,0x8b,0xcb,0xb1,0xb,0x13,0x83,0x9b,0x8c,0xd5,0xd5,0xd7,0x54,0xf7,0x4d,0x3d,0x1a,0x7d,0x53,0x4d,0x3e,0xc7,0xf2,0x2d,0xae,0x7e,0xd1,0x1f,0xb2,0xef,0xc4,0x8d,0x56,0x4b,0x5f,0x1b,0x78,0x37,0xc4,0xde,0xb,0xd6,0xed,0x49,0x5b,0x8b,0x7d,0x43,0x4e,0x69,0x3e,0xcd,0x27,0xf1,0x20,0x5c,0xb1,0x5c,0x11,0xd0,0xa2,0xf4,0xe9,0x4d,0xd3,0x3e,0x29,0x7e,0xc7,0x7f,0xe,0x2f,0x63,0xbe,0xd2,0x6c,0xf5,0x5f,0x11,0x6a,0x5b,0x87,0x91,0x6f,0x69,0xa5,0xc8,0x92,0x48,0xe7,0x80,0x17,0xe5,0x41,0x93,0xf5,0xaf,0xeb,0x2b,0xc6,0xbf,0x8,0x3c,0x27,0xf1,0x28,0x2f,0xfc,0x24,0x7e,0x18,0xf0,0xf7,0x88,0x36,0xe3,0x6f,0xf6,0x96,0x9b,0xd,0xde,0x31,0xd3,0xfd,0x62,0x9a,0x8b,0xc2,0xdf,0x5,0x3c,0x1b,0xe0,0x69,0x23,0x7d,0x13,0xc2,0x7e,0x19,0xd1,0xda,0x12,0xc,0x6d,0x63,0xa5,0xc1,0x6e,0x53,0x1d,0x31,0xb1,0x46,0x2b,0xc7,0xff,0x0,0x56,0xe6,0x97,0x2a,0xc6,0xe2,0x39,0x7b,0x7b,0x57,0xf7,0x73,0x3b,0xcf,0xff,0x0,0x26,0x3e,0x8b,0xfd,0x71,0x6d,0xf3,0xcb,0x5,0x87,0x73,0xfe,0x6f,0x64,0xbe,0xfb,0x26,0xa3,0xff,0x0,0x92,0x9f,0xcf,0xbf,0xec,0xb9,0xfb,0xa,0x7e,0xd4,0x7f,0xf0,0x52,0xa6,0xb3,0xd2,0x7c,0x17,0xe0,0x3b,0xcf,0xd9,0x9f,0xe0,0xa5,0xc4,0x98,0xd4,0x7c,0x4f,0xaf,0x5a,0x9b,0x5d,0x63,0x50,0x83,0x2b,0xbd,0x6c,0xed,0xd8,0x9,0x59,0x99,0x4e,0x44,0x81,0x55,0xe,0xf,0xef,0x86,0xa,0x98,0x3f,0x6e,0x3f,0xf8,0x33,0x7,0xe2,0x27,0x84,0x2e,0xe6,0xd5,0xbe,0x3,0x7c,0x40,0xd3,0x7c,0x79,0xa7,0xb0,0x32,0x3e,0x8d,0xe2,0xa7,0x1a,0x76,0xad,0xbb,0x8f,0xf5,0x77,0x8,0xa6,0xde,0x62,0xc7,0x27,0x2f,0xe4,0x63,0xd5,0xba,0xd7,0xf4,0x6a,0x13,0x7,0x3c,0xd2,0xe3,0x35,0xea,0x65,0xb9,0x3e,0xf,0x2f,0x83,0x86,0x12,0x1c,0xbc,0xce,0xed,0xea,0xe5,0x27,0xde,0x52,0x77,0x72,0x7e,0x6d,0xb6,0x78,0x79,0xb6,0x79,0x8e,0xcc,0xea,0x2a,0x98,0xda,0x8e,0x5c,0xaa,0xc9,0x68,0xa3,0x15,0xda,0x31,0x56,0x51,0x5e,0x49,0x23,0xf9,0xd,0xbb,0xff,0x0,0x82,0x7c,0x7f,0xc1,0x48,0xff,0x0,0x60,0xb8,0x56,0x1d,0x1f,0xc2,0xbf,0xb4,0x4f,0x85,0xed,0xad,0xf7,0x49,0x8f,0x5,0xeb,0x57,0x3a,0x95,0xaa,0x7a,0x93,0xfd,0x9b,0x3c,0xb1,0xfe,0x7d,0x7f,0xa,0x8f,0xfe,0x16,0xef,0xfc,0x14,0xe3,0xc6,0xf6,0xeb,0xa7,0xc7,0x7b,0xfb,0x67,0xdd,0x2a,0xd,0xb8,0x82,0xcf,0x5e,0x46,0x19,0xfe,0xf3,0x2a,0x3,0xcf,0xb9,0xaf,0xeb,0xd0,0x26,0x29,0x76,0xf3,0xdf,0xf3,0xaf,0x48,0xf2,0x8f,0xe4,0x43,0x4a,0xff,0x0,0x82,0x5,0xfe,0xdf,0x5f,0xb5,0xde,0xab,0x6f,0xad,0x78,0x87,0xe1,0xaf,0x8d,0xaf,0xa5,0xbc,0xc6,0xed,0x47,0xc6,0xbe,0x24,0x82,0x1b,0x88,0xc7,0xab,0xa5,0xd5,0xc7,0xda,0x7,0x5f,0xee,0x13,0x5f,0x49,0x7c,0xc,0xff,0x0,0x83,0x2d,0x3e,0x3c,0x78,0xae,0xe6,0x16,0xf1,0xf7,0xc4,0x6f,0x87,0x5e,0xd,0xb3,0x6e,0x5d,0x74,0xdf,0xb4,0x6a,0xd7,0x29,0xed,0xb7,0x64,0x49,0x9f,0xa3,0x91,0x5f,0xd2,0xee,0xdc,0xd2,0x8e,0x29,0x58,0x39,0x8f,0xc6,0x7f,0x82,0x3f,0xf0,0x65,0xaf,0xc0,0xbf,0x9,0xac,0x33,0x78,0xef,0xe2,0x27,0xc4,0x4f,0x19,0x5c,0xa1,0x5,0xe1,0xb3,0x6b,0x7d,0x2e,0xd2,0x4f,0x62,0xa1,0x1e,0x4f,0xca,0x41,0x5f,0x5b,0x7c,0x2c,0xff,0x0,0x83,0x70,0xbf,0x63,0x1f,0x84,0xa2,0x16,0xb3,0xf8,0x25,0xa2,0xea,0xb3,0x42,0x7,0xef,0x75,0x9b,0xfb,0xbd,0x48,0xb9,0x1d,0xca,0xcd,0x2b,0x2f,0xe4,0x0,0xf6,0xaf,0xb8,0xa8,0xce,0x28,0xb0,0xf9,0x99,0xe5,0xbf,0xd,0x3f,0x62,0x3f,0x83,0xbf,0x6,0x51,0x57,0xc2,0x7f,0xa,0xfe,0x1e,0xf8,0x7b,0xcb,0xc6,0xd3,0x61,0xa0,0x5a,0xc0,0xc3,0x1d,0x39,0x54,0xcd,0x7a,0x4d,0xb6,0x95,0x6b,0x66,0x9b,0x61,0xb5,0xb7,0x89,0x7a,0x61,0x23,0xa,0x3f,0x41,0x56,0x73,0x46,0x69,0x8a,0xec,0x40,0x8a,0xbd,0x14,0xf,0xc2,0x96,0x8c,0xd1,0x40,0x86,0x4b,0x6d,0x1c,0xeb,0x89,0x23,0x47,0x1e,0x8c,0xa0,0xd7,0xe3,0x77,0xfc,0x1d,0xf9,0xf1,0x83,0xe1,0xa7,0xc0,0x1f,0xd8,0xb7,0x48,0xf0,0xdc,0x7e,0x4,0xf0,0x45,0xf7,0xc5,0xf,0x8b,0x1a,0x81,0xb3,0xb0,0xd5,0xae,0x34,
-0x5b,0x79,0x2f,0xb4,0x8d,0x3a,0xd4,0xa4,0xb7,0x77,0x30,0xca,0x50,0xb2,0x48,0x59,0xa0,0x80,0x72,0xe,0xdb,0x89,0x18,0x10,0x50,0x57,0xec,0xa1,0xe9,0x5f,0x7,0x7f,0xc1,0x5e,0xff,0x0,0xe0,0x9b,0x5f,0xb3,0x9f,0xc6,0xdd,0x77,0x49,0xfd,0xa5,0x3f,0x68,0x29,0xfc,0x47,0x71,0xa1,0xfc,0x5,0xd0,0xe7,0xbb,0xb8,0xd1,0xe2,0xbe,0x45,0xd2,0x75,0x7b,0x78,0xe4,0x33,0xac,0x33,0xc0,0xc8,0x5a,0x47,0x79,0x48,0x40,0x91,0xba,0x79,0xa5,0x92,0x36,0xdc,0x30,0x28,0x3,0xf9,0xd2,0xfd,0xbc,0xbc,0xa,0xbf,0xb2,0x27,0xec,0x95,0xf0,0x57,0xf6,0x67,0xd2,0x21,0x9e,0xef,0xe2,0x7,0x8a,0x16,0xdb,0xe2,0x7f,0xc4,0x68,0x20,0x84,0xb4,0xe3,0x55,0xd4,0x6d,0xc2,0x68,0xda,0x49,0x42,0xa2,0x41,0x2d,0xa5,0x84,0xae,0xcd,0x1f,0xcc,0xc,0xba,0x8b,0xe2,0xb9,0xdf,0xdb,0x5b,0xfe,0x9,0x1,0xfb,0x4f,0x7f,0xc1,0x29,0x3c,0x4d,0x7,0x88,0xfc,0x59,0xe1,0x3d,0x6f,0x4a,0xd3,0x34,0xa7,0x82,0xe6,0xd3,0xc6,0xde,0x17,0xb9,0x7b,0x9d,0x36,0xd6,0x46,0xdb,0xb0,0xfd,0xae,0x1c,0x35,0xb4,0xa2,0x43,0xb0,0x9,0x44,0x6c,0x58,0x65,0x77,0x29,0x56,0x6f,0xb1,0x3f,0xe0,0xde,0xdf,0x80,0x9a,0xef,0xfc,0x15,0xfb,0xfe,0xb,0x5b,0xe3,0xf,0xda,0x23,0xe2,0x15,0xbf,0xdb,0x34,0xaf,0x3,0xea,0x8f,0xe3,0xad,0x45,0x1d,0x8c,0xd0,0xd,0x56,0xe2,0x67,0xfe,0xcb,0xb3,0x52,0xdc,0x84,0x84,0xa3,0x49,0x18,0xe8,0x16,0xc1,0x57,0x18,0x35,0xfd,0x38,0xea,0x7a,0x35,0xa7,0x88,0x34,0x8b,0x9b,0x1b,0xfb,0x6b,0x7b,0xeb,0x1b,0xe8,0x9e,0xb,0x8b,0x7b,0x88,0xc4,0x91,0x5c,0x46,0xe0,0xab,0x23,0xab,0x2,0x19,0x48,0x24,0x10,0x41,0x4,0x13,0x40,0xee,0x7f,0x33,0x3f,0xf0,0x49,0x9f,0xf8,0x3b,0x3f,0xe2,0x87,0xec,0xeb,0xe2,0x8d,0xb,0xc1,0xbf,0xb4,0x25,0xd5,0xc7,0xc4,0xaf,0x86,0xc4,0xfd,0x9a,0x4f,0x10,0x34,0x5e,0x67,0x89,0x74,0x65,0x23,0x9,0x21,0x90,0x30,0x17,0x91,0xa9,0xfb,0xe2,0x40,0x66,0x20,0x92,0x24,0x62,0xa2,0x36,0xfe,0x8e,0x7f,0x67,0x8f,0xda,0x4b,0xc0,0x7f,0xb5,0x8f,0xc2,0x5d,0x2f,0xc7,0x5f,0xe,0x3c,0x53,0xa4,0xf8,0xc3,0xc2,0x7a,0xc2,0x6e,0xb5,0xd4,0x74,0xf9,0x77,0xa1,0x38,0x4,0xc6,0xea,0x40,0x68,0xe4,0x5c,0x80,0xd1,0xc8,0x15,0xd0,0xf0,0xca,0xf,0x15,0xf9,0xd1,0xff,0x0,0x5,0x3d,0xff,0x0,0x83,0x54,0xfe,0x3,0xfe,0xd7,0xfe,0x14,0xbf,0xd6,0x3e,0x12,0x69,0x3a,0x5f,0xc1,0x3f,0x89,0x0,0x34,0xd6,0xf2,0xe9,0x30,0x32,0x68,0x1a,0x83,0x60,0x62,0x19,0xec,0x94,0xf9,0x70,0x29,0xc6,0x4,0x96,0xca,0x85,0x4b,0x16,0x65,0x97,0x1,0x6b,0xf0,0xcb,0xe0,0x8f,0xed,0xd,0xfb,0x4d,0x7f,0xc1,0xba,0x3f,0xb6,0xce,0xab,0xa3,0xb4,0x37,0x9e,0x1b,0xd5,0xad,0x66,0x58,0xf5,0xef,0xc,0xea,0xc,0xd3,0x68,0x5e,0x2d,0xb4,0x56,0x3e,0x5c,0xb8,0x4,0x2c,0x8a,0x46,0xe3,0x15,0xc4,0x78,0x91,0x3,0xb0,0x4,0x6,0x91,0x8,0x7,0xf6,0x38,0xe,0xe1,0x45,0x7c,0xab,0xff,0x0,0x4,0xa2,0xff,0x0,0x82,0xb8,0xfc,0x35,0xff,0x0,0x82,0xb5,0x7c,0xe,0x93,0xc4,0xfe,0xb,0x79,0x34,0x6f,0x11,0xe8,0xbe,0x5c,0x1e,0x25,0xf0,0xb5,0xec,0xca,0xf7,0xda,0x14,0xee,0x9,0x53,0x91,0x81,0x35,0xbb,0xed,0x6f,0x2e,0x75,0x0,0x38,0x52,0xa,0xa3,0xab,0xa2,0xfd,0x55,0x9c,0xd0,0x20,0xa2,0x8a,0x28,0x3,0xca,0x7f,0x6e,0x5f,0xda,0x6e,0xcf,0xf6,0x33,0xfd,0x8f,0x7e,0x25,0xfc,0x53,0xbd,0x5b,0x79,0x13,0xc0,0xbe,0x1d,0xbc,0xd5,0xa0,0x82,0x76,0x2b,0x1d,0xdd,0xcc,0x71,0x1f,0xb3,0xdb,0x92,0x39,0x1e,0x6c,0xc6,0x38,0xc7,0xbb,0x8a,0xfe,0x54,0xff,0x0,0xe0,0x83,0xdf,0xb2,0x15,0xff,0x0,0xfc,0x15,0x13,0xfe,0xa,0xe9,0xe1,0xb6,0xf1,0x9f,0xda,0x3c,0x41,0xa4,0xe9,0xb7,0xd7,0x3f,0x10,0x3c,0x69,0x71,0x71,0xf3,0xfd,0xbd,0x62,0x94,0x4b,0xb6,0x5c,0x8c,0x30,0xb8,0xbc,0x92,0x4,0x71,0xc6,0x52,0x47,0x3d,0xab,0xf6,0x4b,0xfe,0xf,0x1d,0xfd,0xa5,0xa6,0xf8,0x4f,0xff,0x0,0x4,0xd6,0xd0,0xbc,0x3,0x65,0x3b,0xc3,0x77,0xf1,0x4f,0xc5,0x10,0x5b,0x5c,0xaa,0xb6,0xdf,0x32,0xc6,0xc9,0x4d,0xd4,0xa3,0xfe,0xff,0x0,0xb,0x4e,0x3d,0x9,0xaf,0x31,0xff,0x0,0x83,0x29,0x7f,0x66,0x78,0x7c,0x3b,0xfb,0x36,0x7c,0x5a,0xf8,0xbb,0x71,0x6d,0x8b,0xff,0x0,0x15,0xeb,0xf1,0x78,0x66,0xca,0x47,0x20,0x95,0xb6,0xb2,0x85,0x66,0x90,0xaf,0xa0,0x79,0x6e,0x80,0x3e,0xa6,0x11,0xe9,0x48,0xa5,0xb1,0xfb,0x7a,0xab,0x82,0x7d,0xe9,0x68,0xa2,0x99,0x21,0x45,0x14,0x50,0x1,0x45,0x14,0xd9,0xa4,0x58,0xa1,0x66,0x66,0x54,0x55,0x4,0xb3,0x31,0xc0,0x51,0xdc,0x9a,0x0,0xc7,0xf8,0x87,0xf1,0x1b,0x41,0xf8,0x49,0xe0,0xbd,0x4b,0xc4,0x9e,0x29,0xd6,0xb4,0x9f,0xe,0x78,0x7b,0x46,0x80,0xdc,0xdf,0xea,0x7a,0x9d,0xda,0x5a,0x59,0xd9,0x44,0x3a,0xbc,0x92,0xc8,0x42,0xa2,0x8e,0x39,0x24,0x75,0xaf,0xc2,0x7f,0xf8,0x29,0xcf,0xfc,0x1e,0x32,0x34,0x2f,0x10,0x6a,0x3e,0x13,0xfd,0x97,0xbc,0x3f,0xa7,0xea,0x56,0xf6,0xfb,0xa0,0x7f,0x1c,0xf8,0x8e,0xda,0x43,0x14,0xad,0xc8,0xdf,0x65,0x64,0x76,0x1c,0xe,0x8,0x92,0xe0,0xe0,0x9c,0x83,0xe,0x30,0x4f,0xc5,0xbf,0xf0,0x70,0x9f,0xfc,0x17,0x7,0xc4,0x5f,0xf0,0x52,0xff,0x0,0x8f,0x7a,0xa7,0xc3,0x9f,0x3,0xea,0x93,0x43,0xf0,0x2b,0xc2,0x3a,0xa1,0xb6,0xd2,0x6d,0x6d,0x7e,0x5f,0xf8,0x4a,0xee,0xa2,0x62,0x9f,0xda,0x13,0x11,0xcb,0xc6,0xcd,0xb8,0xc1,0x19,0xc0,0x8,0x51,0x8a,0x89,0x9,0xdb,0xe4,0x3f,0xb3,0x37,0xec,0x3d,0xa5,0xf8,0x53,0x48,0x8f,0x5a,0xf1,0x8d,0xad,0xbe,0xa9,0xad,0xc8,0xab,0x34,0x3a,0x7c,0xbf,0x3d,0xbd,0x8f,0x71,0xbd,0x3a,0x3b,0xfa,0x86,0xca,0x8c,0x63,0x6,0xbb,0x30,0x38,0xa,0xb8,0xa9,0xf2,0x52,0xf9,0xbe,0x88,0xca,0xb5,0x68,0x52,0x57,0x99,0x63,0xc6,0x1f,0xf0,0x57,
-0xf,0xdb,0xbb,0xf6,0xc6,0x8e,0x48,0x62,0xf8,0xa9,0xf1,0x9b,0x58,0x85,0xc9,0x2d,0x1f,0x84,0xe1,0x93,0x4c,0x8b,0x7,0x9c,0x1f,0xec,0xf8,0xe3,0x5,0x71,0xd9,0x89,0x15,0x9b,0xa5,0xfe,0xde,0xdf,0xb7,0x77,0xec,0xd5,0x7,0xdb,0x26,0xf8,0x95,0xfb,0x49,0x68,0x76,0x76,0xff,0x0,0x36,0x75,0x9b,0xdd,0x4a,0xe2,0xd1,0x73,0xdc,0xad,0xc8,0x78,0xff,0x0,0x31,0x5f,0xbd,0xdf,0xb5,0x7c,0x96,0x3e,0x27,0x1f,0xe,0x7c,0x67,0xa6,0xd8,0x59,0xe9,0xf6,0xfe,0x33,0xf0,0x75,0x8d,0xfc,0x8b,0x69,0xa,0xc3,0x19,0x97,0x6e,0xe,0x2,0x80,0x38,0x5d,0xa3,0x1d,0x85,0x1f,0xb0,0xec,0xb6,0xf2,0xfe,0xd4,0x3e,0x1a,0xb3,0xbe,0x8a,0x1b,0xbb,0x5d,0x44,0xcf,0x6c,0xf0,0xce,0xa2,0x48,0xdb,0x74,0x2e,0x79,0x53,0xc1,0xfb,0xbf,0xad,0x7e,0x23,0x99,0x78,0x9d,0x89,0xc2,0x71,0x1f,0xf6,0x14,0xb0,0xea,0xde,0xd2,0x30,0xe6,0xe6,0x77,0xd5,0xa4,0x9e,0xde,0x77,0xb7,0xe2,0x7e,0xdf,0x97,0x78,0x59,0x86,0xc5,0xf0,0xd7,0xf6,0xf4,0x71,0x12,0xbf,0xb3,0x94,0xf9,0x79,0x55,0xbd,0xd4,0xdb,0x5b,0xf9,0x6f,0xf8,0x1f,0x91,0xff,0x0,0xb3,0xf,0xfc,0x1d,0xc9,0xfb,0x58,0x7c,0xd,0xbb,0x8a,0xf,0x17,0x5f,0x78,0x3f,0xe2,0xd6,0x97,0xb8,0x2c,0x91,0x6b,0xda,0x52,0xd9,0xde,0x2a,0xe,0x48,0x8e,0x7b,0x3f,0x2b,0xd,0xef,0x22,0x49,0xf4,0xaf,0xbd,0xbf,0x67,0xcf,0xf8,0x3d,0x87,0xe1,0x77,0x8a,0xaf,0x6d,0xed,0xfe,0x26,0x7c,0x1b,0xf1,0x9f,0x82,0xd6,0x46,0x11,0xbd,0xde,0x87,0xaa,0x41,0xae,0xc3,0x1f,0x4f,0x9d,0x95,0xd2,0xda,0x40,0x33,0x9c,0x85,0xe,0x40,0xfe,0xf5,0x7c,0x43,0xf1,0xe3,0xe0,0x1f,0x86,0x35,0x1f,0x88,0xde,0x23,0xd2,0x75,0xcf,0xe,0x69,0x37,0xcf,0xa6,0xea,0x97,0x76,0xb9,0x96,0xd5,0x56,0x44,0xb,0x2b,0xc,0x2,0x6,0x46,0x2b,0xc1,0x7c,0x73,0xff,0x0,0x4,0xe3,0xf0,0x5f,0x88,0x3c,0xc9,0x34,0x5b,0xcd,0x53,0xc3,0xd3,0x11,0xf2,0x22,0xb7,0xda,0xad,0xc1,0xeb,0xc8,0x73,0xbf,0xf2,0x6a,0xfe,0x80,0x97,0xf,0x62,0x5c,0x15,0x4a,0x4d,0x49,0x35,0x7e,0xcf,0x5f,0x53,0xf0,0x7f,0xed,0xa,0x4a,0x6e,0x13,0xd1,0xa7,0x63,0xfa,0x68,0xfd,0x9f,0xff,0x0,0xe0,0xb7,0x9f,0xb2,0x6f,0xed,0x33,0x65,0xc,0x9e,0x17,0xf8,0xf3,0xf0,0xf1,0x2e,0x2e,0x30,0x12,0xcb,0x5a,0xd4,0x86,0x87,0x7a,0xcc,0x7f,0x84,0x41,0x7a,0x22,0x91,0x88,0xc1,0xfb,0xaa,0x7f,0x2e,0x6b,0xea,0xd,0x37,0x55,0xb7,0xd6,0x6c,0x21,0xba,0xb3,0x9e,0x1b,0xbb,0x5b,0x85,0xf,0x14,0xd0,0x48,0x24,0x8e,0x45,0x3d,0xa,0xb0,0xe0,0x8f,0x71,0x5f,0xc7,0x3d,0xd7,0xfc,0x10,0x77,0xe3,0x96,0xb9,0xf0,0x1e,0xcf,0xe2,0x4f,0x84,0xe2,0xf0,0xbf,0x8b,0xfc,0x2f,0x79,0xa9,0x4d,0xa5,0x5,0x83,0x54,0x4b,0x3b,0xe8,0x26,0x88,0x9c,0xf9,0x91,0x5c,0x6c,0x40,0x1b,0x7,0x6e,0x24,0x62,0x7d,0x7,0x15,0xc0,0xf8,0x16,0xe3,0xf6,0xae,0xff,0x0,0x82,0x75,0xeb,0x8d,0x7f,0xe1,0x99,0xbe,0x31,0xfc,0x33,0x30,0x3f,0xef,0x25,0xd2,0xa5,0xbb,0x8a,0xc6,0x6c,0x1e,0x8f,0xe5,0x93,0x4,0xab,0xcf,0x46,0xdc,0xa7,0x3d,0xeb,0xe5,0xeb,0x63,0xf0,0xd4,0x71,0x2f,0x5,0x56,0xa4,0x63,0x55,0x6f,0x17,0x25,0xcd,0xf7,0x5e,0xe7,0xb9,0x4f,0x2d,0xc5,0xd4,0xc3,0x2c,0x65,0x3a,0x52,0x74,0xdf,0xda,0x51,0x6e,0x3a,0x79,0xda,0xd7,0x3f,0xb5,0xea,0x2b,0xf9,0x6d,0xfd,0x9c,0xff,0x0,0xe0,0xf0,0x9f,0xda,0x93,0xe0,0xe5,0xa4,0x7a,0x6f,0x8e,0x34,0xef,0x1,0x7c,0x52,0x86,0x16,0xdb,0x25,0xce,0xab,0xa6,0x36,0x97,0xa9,0xf1,0xc6,0xdf,0x32,0xd1,0xa3,0x8b,0xea,0x5a,0x2,0x7d,0xfa,0xd7,0xd9,0x1f,0x3,0x7f,0xe0,0xf6,0xdf,0x0,0xea,0xcf,0x1c,0x7f,0x12,0xbe,0x7,0xf8,0xcb,0xc3,0xe1,0x46,0x1e,0xe3,0xc3,0x5a,0xb5,0xb6,0xaf,0xb8,0xe3,0xa8,0x8a,0x71,0x6c,0x40,0xcf,0xfb,0x67,0xf1,0xae,0x9b,0xa3,0x8b,0x95,0x9f,0xb9,0x54,0x57,0xe7,0x6f,0xc2,0xff,0x0,0xf8,0x3a,0x93,0xf6,0x27,0xf8,0x87,0x61,0xb,0xde,0x7c,0x4f,0xd5,0x3c,0x25,0x79,0x33,0xec,0x16,0x7a,0xdf,0x85,0xf5,0x25,0x91,0x78,0x1c,0xb4,0x90,0x43,0x2c,0x20,0x76,0xc9,0x93,0xb1,0xfa,0xd7,0xd0,0x3e,0x15,0xff,0x0,0x82,0xc4,0x7e,0xca,0x7e,0x33,0x16,0x3f,0xd9,0xff,0x0,0xb4,0x4f,0xc1,0xc6,0x6d,0x41,0x43,0xc1,0x1c,0xde,0x2a,0xb3,0xb7,0x90,0xfb,0x32,0x48,0xea,0xc8,0x7d,0x98,0x3,0xed,0x4c,0x47,0xd2,0x34,0x57,0x99,0x69,0xdf,0xb6,0xb7,0xc1,0xbd,0x62,0xdb,0xce,0xb4,0xf8,0xb5,0xf0,0xce,0xea,0x1f,0xef,0xc3,0xe2,0x8b,0x17,0x5f,0xcc,0x4b,0x8a,0xf3,0xcf,0x8e,0x7f,0xf0,0x57,0xdf,0xd9,0x7f,0xf6,0x72,0xd0,0xa4,0xbf,0xf1,0x6f,0xc7,0x6f,0x86,0x76,0x71,0xc6,0xa5,0x8d,0xbd,0x96,0xb5,0x16,0xa7,0x78,0xc0,0x75,0xdb,0x6d,0x6a,0x65,0x99,0xbf,0xe0,0x28,0x68,0x3,0xe9,0xa,0x9,0xc5,0x7e,0x25,0xfe,0xd8,0x5f,0xf0,0x7a,0x37,0xc3,0x1f,0x1,0xcb,0x75,0xa6,0xfc,0x13,0xf8,0x73,0xe2,0x2f,0x88,0x37,0x91,0x93,0x1a,0x6b,0x1a,0xfc,0xa3,0x46,0xd3,0x1b,0xd1,0xe3,0x88,0x7,0xb8,0x91,0x7a,0x70,0xeb,0x9,0xaf,0xcc,0xcf,0xda,0x67,0xfe,0xe,0x83,0xfd,0xb1,0xff,0x0,0x69,0x6b,0x9b,0x8b,0x7b,0x4f,0x88,0x16,0x9f,0xe,0x34,0xbb,0xcf,0x90,0x69,0xbe,0xc,0xd3,0x23,0xb1,0x61,0xcf,0x5,0x6e,0x64,0xf3,0x6e,0xc3,0x76,0xf9,0x66,0x0,0xfa,0x51,0x70,0xb1,0xfd,0x67,0xf8,0xe3,0xe2,0x1e,0x83,0xf0,0xcb,0xc3,0x97,0x1a,0xc7,0x89,0x75,0xad,0x23,0xc3,0xba,0x4d,0xa8,0xdd,0x3d,0xf6,0xa7,0x79,0x1d,0xa5,0xb4,0x23,0xd5,0xa4,0x90,0x85,0x3,0xea,0x6b,0xe3,0x5f,0xda,0x53,0xfe,0xe,0x38,0xfd,0x8f,0x7f,0x66,0x6b,0x66,0xfb,0x5f,0xc6,0xd,0xf,0xc6,0x57,0xc3,0xee,0xd9,0xf8,0x34,0xff,0x0,0x6e,0xb3,0xfd,0x25,0x80,0x98,0x7,0xe3,0x20,0xaf,0xe6,0x66,0xc3,0xf6,0x1c,0xfd,0xa9,0x3f,0x6d,0xff,0x0,0x11,
-0xff,0x0,0x6e,0x78,0xaa,0xd3,0xc6,0x9a,0xad,0xc4,0xce,0x4,0x9a,0xbf,0x8e,0xb5,0x69,0x92,0x55,0xe0,0x10,0x48,0xba,0x63,0x31,0x5c,0x63,0x5,0x50,0x8c,0x74,0xaf,0xa1,0xbe,0x29,0x7f,0xc1,0xb8,0x9a,0xdf,0xc0,0xaf,0xd9,0x5f,0xc2,0x3f,0x15,0x3c,0x43,0xf1,0x3b,0x4a,0xd5,0x2c,0x7c,0x41,0x7f,0xfd,0x9d,0x7f,0xa7,0x68,0xda,0x6b,0xff,0x0,0xc4,0xb2,0x62,0xe,0xd4,0xf3,0xe5,0x61,0xe6,0x12,0xca,0xe0,0x91,0x18,0x3,0x1c,0x67,0x35,0xc3,0x84,0xcd,0x30,0x78,0xac,0x67,0xf6,0x7e,0x1e,0xac,0x65,0x5b,0xac,0x53,0x4d,0xad,0x6d,0xaf,0x6d,0x5d,0xb5,0x3d,0x3c,0x46,0x4b,0x8e,0xc3,0xe1,0x16,0x3e,0xbd,0x19,0x46,0x93,0xda,0x4d,0x34,0x9e,0x8d,0xe8,0xde,0xfa,0x2e,0x87,0xde,0x9f,0x1a,0xbf,0xe0,0xf6,0xaf,0x4,0xe9,0x72,0x5f,0x5b,0xfc,0x3f,0xf8,0x25,0xe2,0x4d,0x69,0x93,0x2b,0x69,0x7b,0xad,0xeb,0x11,0x59,0x46,0xe7,0xd5,0xa1,0x8d,0x24,0x6c,0x7b,0x6f,0x6,0xbe,0x61,0xf8,0x8b,0xff,0x0,0x7,0xa3,0x7e,0xd1,0x5e,0x23,0xb3,0x96,0x1f,0xf,0xfc,0x3f,0xf8,0x53,0xe1,0x96,0x6c,0xec,0x99,0xad,0xef,0x2f,0x65,0x8f,0xfe,0xfb,0x98,0x21,0xff,0x0,0xbe,0x6b,0xe7,0x4f,0xb,0xfe,0xc0,0x3f,0xd,0x7c,0x3c,0x8b,0xf6,0xad,0x3f,0x52,0xd6,0xa4,0x5f,0xe2,0xbe,0xbe,0x70,0x9,0xff,0x0,0x76,0x2d,0x83,0xf0,0x39,0xaf,0x40,0xf0,0x6f,0xc1,0x5f,0x2,0x7c,0x35,0xd5,0x6c,0xf5,0x2b,0xf,0x5,0xf8,0x65,0x5b,0x4d,0x9e,0x3b,0xa0,0xb3,0xe9,0xf1,0xdc,0xef,0xf2,0xdc,0x3e,0x9,0x94,0x36,0x41,0xc6,0x8,0x3d,0xab,0xec,0x29,0xf0,0xc6,0x25,0xfc,0x72,0x4b,0xf1,0x3e,0x6e,0x59,0xa5,0x25,0xf0,0xa6,0xca,0x13,0x7f,0xc1,0xd7,0xdf,0xb6,0xd6,0xbf,0x70,0xc2,0xc7,0xc5,0xde,0x17,0x8d,0x9b,0xa4,0x76,0x9e,0x10,0xb4,0x93,0x6f,0xd3,0x72,0x31,0xa6,0xe8,0xff,0x0,0xf0,0x73,0x57,0xed,0xe7,0xa0,0x4f,0x2d,0xc4,0x9e,0x2e,0x17,0x91,0xcc,0x77,0x6d,0xba,0xf0,0x55,0xa3,0x46,0xbf,0xee,0xe2,0x11,0x81,0xf4,0x35,0xfb,0x3d,0xfb,0x70,0x78,0x43,0x45,0xd1,0xbc,0x5b,0xe0,0xbd,0x7b,0x42,0xd2,0x74,0xdd,0x1e,0xcb,0xc5,0x1e,0x1a,0xb6,0xbc,0x58,0x2c,0x2d,0x92,0xde,0x18,0xf0,0x17,0x1,0x55,0x0,0x3,0x87,0xaf,0x17,0x33,0xcc,0xcb,0x86,0x9a,0x43,0xff,0x0,0x3,0x35,0xfc,0xe3,0xc4,0x9e,0x2f,0x4f,0x29,0xcc,0xea,0xe5,0xcf,0x9,0x7f,0x66,0xed,0x7e,0x7b,0x5f,0xaa,0x76,0xe5,0x7b,0xa6,0x7f,0x43,0xf0,0xbf,0x83,0x74,0xf3,0x7c,0xae,0x8e,0x64,0xb1,0x7c,0xbe,0xd1,0x5e,0xdc,0x97,0xb6,0xb6,0x6a,0xfc,0xdd,0x1a,0x3e,0x51,0xfd,0x93,0x7f,0xe0,0xf4,0x3f,0x8a,0x5e,0xa,0xd6,0xed,0x74,0xff,0x0,0x8d,0x9f,0xe,0x3c,0x33,0xe2,0xed,0x26,0x3c,0xc7,0x73,0xa8,0x78,0x79,0x64,0xd2,0xb5,0x45,0xe7,0xef,0x98,0xe4,0x67,0x81,0xc8,0xe7,0xe5,0x2,0x3c,0xfa,0x8a,0xfd,0xd0,0xfd,0x83,0xbf,0xe0,0xa2,0x7f,0x9,0xbf,0xe0,0xa4,0x5f,0x8,0x57,0xc6,0x5f,0xa,0x7c,0x4d,0xe,0xb5,0x67,0xb,0x8,0xb5,0xb,0x9,0x80,0x83,0x52,0xd1,0xe5,0x39,0x22,0x2b,0x9b,0x72,0x4b,0x46,0xc7,0x7,0x7,0x95,0x6c,0x12,0xac,0xc0,0x66,0xbf,0x1e,0xff,0x0,0x69,0x2f,0xd8,0x6f,0xe1,0x9f,0xed,0x53,0xa2,0xcd,0x6f,0xe2,0xaf,0xd,0xd9,0xff,0x0,0x68,0x3a,0xed,0x87,0x57,0xb3,0x41,0x6f,0x7f,0x6c,0xdd,0x8a,0xc8,0xb8,0xdd,0x8e,0xbb,0x5b,0x2a,0x7b,0x8a,0xfc,0xd5,0xf0,0xee,0xab,0xf1,0xd7,0xfe,0xd,0xfe,0xfd,0xb3,0x34,0xf,0x1b,0x78,0x66,0xf8,0x35,0xa5,0xd4,0xb2,0x7d,0x8e,0xe9,0x49,0x6d,0x27,0xc6,0x5a,0x7c,0x72,0x27,0x9d,0x67,0x73,0x1e,0x7e,0x56,0xc3,0x20,0x74,0x38,0x92,0x22,0xe8,0xe8,0xdc,0xa3,0x9f,0xac,0xe0,0xdf,0x11,0x30,0x1c,0x40,0xdd,0x18,0x27,0x4e,0xaa,0x57,0x71,0x7a,0xdd,0x75,0x71,0x6b,0x7b,0x75,0xd1,0x34,0x7c,0x7f,0x1b,0x78,0x6b,0x98,0x70,0xea,0x55,0xe7,0x25,0x52,0x8b,0x76,0x52,0x49,0xab,0x3e,0x8a,0x49,0xed,0x7e,0x9a,0xb4,0xcf,0xec,0x7a,0xbe,0x59,0xff,0x0,0x82,0xc7,0x7f,0xc1,0x3c,0x75,0x1f,0xf8,0x2a,0x1f,0xec,0x31,0xae,0x7c,0x25,0xd2,0xbc,0x64,0xde,0x9,0xbe,0xd4,0xaf,0xec,0xf5,0x8,0xef,0x5e,0xdd,0xae,0x2d,0x6e,0xd,0xbc,0xa2,0x41,0x5,0xc4,0x6a,0xca,0xcd,0x1b,0x1c,0x37,0x7,0xe5,0x74,0x8d,0xb0,0x76,0xe0,0xfa,0x47,0xec,0x27,0xfb,0x66,0x78,0x47,0xf6,0xfe,0xfd,0x95,0x7c,0x23,0xf1,0x63,0xc1,0x72,0xbf,0xf6,0x37,0x8a,0xad,0x7c,0xd7,0xb5,0x95,0xc3,0x4f,0xa6,0x5c,0xa9,0x29,0x3d,0xac,0xb8,0xe8,0xf1,0xc8,0xac,0xa7,0xa0,0x23,0xc,0x38,0x60,0x4f,0xaf,0x11,0x9a,0xfd,0x0,0xfc,0xe4,0xf9,0x7f,0xfe,0x9,0x21,0xff,0x0,0x4,0xc3,0xf0,0xbf,0xfc,0x12,0x87,0xf6,0x43,0xd3,0x7e,0x1b,0xe8,0x37,0x83,0x5c,0xd5,0xae,0x2e,0x1f,0x54,0xf1,0x16,0xba,0xd6,0xfe,0x44,0x9a,0xcd,0xfc,0x80,0x2b,0x3e,0xcc,0x9d,0x91,0x22,0x2a,0x47,0x1a,0x64,0xe1,0x50,0x12,0x4b,0x33,0x13,0xf5,0x5,0x14,0x50,0x1,0x5f,0x33,0xff,0x0,0xc1,0x4f,0x3f,0xe0,0x95,0xff,0x0,0xc,0x7f,0xe0,0xa9,0xff,0x0,0x2,0xe4,0xf0,0x97,0x8f,0xac,0x9a,0xd7,0x55,0xb1,0xf,0x26,0x83,0xe2,0x2b,0x48,0xd7,0xfb,0x43,0x42,0x9c,0x8f,0xbd,0x1b,0x1f,0xbd,0x19,0x20,0x6f,0x8d,0xbe,0x56,0x3,0xb1,0x0,0x8f,0xa6,0x28,0xc7,0x14,0x1,0xfc,0x73,0xfc,0x64,0xf8,0x1b,0xfb,0x46,0x7f,0xc1,0xb7,0xff,0x0,0xf0,0x50,0x2d,0x1b,0x55,0x82,0xe5,0xb4,0xbd,0x6f,0x4d,0x77,0xb8,0xd0,0xb5,0xdb,0x78,0xdd,0xf4,0x3f,0x19,0x69,0xdb,0xc0,0x96,0x17,0x19,0x1b,0xe3,0x61,0xb5,0x66,0x81,0x88,0x78,0xc9,0x46,0x5,0x4f,0x97,0x25,0x7f,0x4f,0x3f,0xf0,0x49,0xaf,0xf8,0x2a,0x1f,0x83,0x3f,0xe0,0xab,0x3f,0xb2,0x96,0x9d,0xf1,0x3,0xc3,0x6b,0xe,0x95,0xaf,0xda,0xb0,0xb1,0xf1,0x3f,0x87,0x5a,0xe0,0x4b,0x71,0xa0,0x5f,0x1,0xca,0x13,0x80,
-0x5e,0x19,0x0,0xdf,0x14,0xb8,0x1,0xd0,0xe0,0xed,0x75,0x74,0x5d,0x7f,0xf8,0x29,0xf7,0xfc,0x13,0x9b,0xc1,0xbf,0xf0,0x53,0xdf,0xd9,0x3b,0x5e,0xf8,0x6b,0xe2,0xdb,0x78,0x62,0xba,0x95,0x1a,0xef,0xc3,0xfa,0xbe,0xcc,0xcf,0xa0,0xea,0x2a,0xa7,0xc9,0xb8,0x43,0xd7,0x6e,0x4e,0xd7,0x4e,0x8f,0x1b,0x32,0xfa,0x11,0xfc,0xc2,0xff,0x0,0xc1,0x3a,0x3f,0x6b,0x5f,0x88,0x5f,0xf0,0x6f,0xf7,0xfc,0x15,0x5a,0xef,0x4e,0xf1,0xb5,0xad,0xed,0x85,0x8e,0x97,0xa8,0x1f,0xb,0xfc,0x42,0xd1,0x11,0xb7,0xc7,0x7b,0xa7,0xb3,0x29,0x17,0x31,0x8c,0x10,0xed,0x18,0x29,0x73,0xb,0x8c,0x16,0x5c,0xa6,0xe0,0xb2,0xbe,0x56,0xc3,0xdc,0xfe,0xc0,0xa8,0xaa,0x5e,0x1c,0xf1,0x15,0x8f,0x8b,0xb4,0xb,0x1d,0x5b,0x4b,0xba,0x82,0xfb,0x4d,0xd5,0x2d,0xe3,0xbb,0xb4,0xb9,0x85,0xb7,0xc7,0x71,0xc,0x8a,0x1d,0x1d,0x48,0xe0,0xab,0x29,0x4,0x1e,0xe0,0xd1,0x4c,0x47,0xf3,0xe5,0xff,0x0,0x7,0xbd,0x7c,0x48,0x96,0xf3,0xe2,0xc7,0xc0,0x1f,0x7,0x83,0xfb,0x9d,0x3f,0x4a,0xd5,0x75,0x92,0x3f,0xda,0x9e,0x6b,0x78,0x79,0xfc,0x2d,0xff,0x0,0x9d,0x7d,0xf5,0xff,0x0,0x6,0xa2,0x7c,0x3d,0x5f,0x5,0xff,0x0,0xc1,0x16,0xbc,0x1,0x7c,0xd0,0xac,0x53,0x78,0xa3,0x55,0xd6,0x35,0x49,0x18,0xe,0x64,0xff,0x0,0x4f,0x9a,0x5,0x27,0xfe,0x3,0x2,0xd7,0xe5,0x9f,0xfc,0x1e,0x8b,0xac,0x4b,0x7d,0xff,0x0,0x5,0x17,0xf8,0x7f,0x6a,0xf9,0xf2,0xec,0x7c,0xd,0x10,0x8f,0x3d,0x3e,0x6b,0xcb,0x86,0x3f,0xad,0x7e,0xd0,0x7f,0xc1,0xbd,0x56,0x31,0xe9,0xdf,0xf0,0x45,0xff,0x0,0xd9,0xfa,0x38,0x94,0x2a,0xb7,0x87,0x5a,0x52,0x7,0xf7,0x9e,0xea,0x77,0x6f,0xd5,0x8d,0x4f,0x52,0x8f,0xb3,0x28,0xa2,0x8a,0xa2,0x42,0x8a,0x28,0xa0,0x2,0xbe,0x10,0xff,0x0,0x83,0x8f,0x7f,0x6d,0xf9,0x3f,0x61,0xef,0xf8,0x25,0x4f,0x8f,0x6f,0xb4,0xbb,0xef,0xb1,0x78,0xaf,0xc7,0xca,0xbe,0xc,0xd0,0x99,0x5b,0x6c,0x8b,0x2d,0xe2,0xb0,0xb8,0x95,0x48,0x3b,0x95,0xa3,0xb4,0x5b,0x97,0x56,0x1f,0x75,0xc4,0x7d,0x2b,0xee,0xf,0x14,0xf8,0xa3,0x4d,0xf0,0x47,0x86,0xb5,0xd,0x6b,0x59,0xd4,0x2c,0x74,0x9d,0x1f,0x49,0xb6,0x92,0xf6,0xfa,0xfa,0xf6,0x75,0xb7,0xb5,0xb2,0x82,0x35,0x2f,0x24,0xb2,0xc8,0xe4,0x2a,0x46,0x8a,0xa5,0x99,0x98,0x80,0x0,0x24,0x90,0x2b,0xf9,0x3c,0xff,0x0,0x83,0x82,0x7f,0xe0,0xad,0x4d,0xff,0x0,0x5,0x85,0xfd,0xb0,0x7c,0x3f,0xe1,0x9f,0x87,0x76,0xf7,0x2d,0xf0,0xd7,0xc0,0x73,0x4d,0xa5,0x78,0x61,0xa4,0x56,0x49,0x75,0xfb,0xa9,0xdd,0x16,0x7d,0x41,0x90,0x80,0x63,0x47,0x11,0xc6,0xb1,0xa3,0xd,0xcb,0x1a,0x6e,0x3b,0x5a,0x46,0x44,0x12,0x6d,0xd9,0x1,0xe5,0x9f,0xf0,0x47,0x1f,0xd8,0x4b,0x53,0xfd,0xac,0xff,0x0,0x68,0x5f,0xe,0xc7,0x6f,0x6e,0xad,0x2e,0xa9,0xa8,0xae,0x9b,0xa4,0xb4,0xb1,0x99,0x23,0x86,0x40,0x37,0xcf,0x76,0xcb,0xdd,0x20,0x89,0x5d,0xbd,0xc8,0xf5,0x15,0xfb,0x39,0xff,0x0,0x5,0x8e,0xf8,0x71,0xe1,0x8f,0x82,0x9f,0xb,0xbc,0x23,0xf0,0xbb,0xe1,0xbf,0xc3,0xdd,0xba,0x7,0xc3,0xa3,0x14,0xde,0x23,0xf1,0x72,0x69,0x7e,0x64,0x90,0x5d,0x4f,0x1e,0xd8,0x2d,0x67,0xbc,0x9,0xcc,0xd3,0x2b,0xf9,0xf2,0x6,0x3c,0x97,0xb6,0xc0,0xe4,0xa,0xcd,0xff,0x0,0x83,0x74,0xff,0x0,0x67,0x7d,0x17,0xf6,0x59,0xf8,0x43,0xe3,0x3f,0x8c,0x3e,0x26,0x64,0xb1,0xf0,0xaf,0xc3,0xcd,0x5,0xf4,0x5b,0x7b,0xd9,0x13,0xe5,0x9a,0x4f,0x96,0xe7,0x50,0x9a,0x3c,0xf5,0x6c,0xac,0x48,0xb8,0xe4,0x99,0x5d,0x7a,0xe4,0x56,0xdf,0xc7,0x6d,0x13,0x54,0xf8,0xad,0xff,0x0,0x4,0xae,0xf1,0x97,0xc6,0x19,0xbe,0x2f,0xea,0x16,0xb1,0xfc,0x4c,0xf1,0x47,0xfc,0x24,0x5a,0x9f,0x82,0xb3,0x68,0xfa,0x79,0x99,0xef,0x56,0x18,0xf4,0xf5,0x6d,0xbf,0x69,0x13,0x43,0x14,0x71,0x31,0x2,0x4d,0xad,0xf6,0x70,0x4c,0x78,0x1b,0xab,0xea,0xf0,0xb1,0xf6,0x15,0x69,0xd3,0x5b,0x45,0xa4,0xf7,0xd6,0x72,0xf4,0xec,0xb4,0xd7,0xae,0xe7,0x93,0x5e,0x5e,0xd2,0x12,0x97,0x7b,0xdb,0xd1,0x7f,0x99,0xd5,0xeb,0x1a,0x9f,0xfc,0x24,0x5f,0xb0,0x7,0xec,0xe7,0x7d,0xd5,0xa1,0xd1,0xae,0x6c,0x9,0x3d,0x48,0x85,0x82,0xf,0xe5,0x55,0xbf,0x66,0x2d,0x5d,0xb4,0x2f,0xda,0x27,0xc1,0xb7,0x79,0x21,0x93,0x54,0x89,0x73,0xfe,0xfe,0x53,0xff,0x0,0x66,0xae,0x7b,0xc1,0x7a,0xdc,0x97,0xbf,0xf0,0x49,0x5f,0x83,0xb7,0x91,0xb2,0xc9,0x36,0x9b,0xad,0xea,0xba,0x73,0x3e,0x73,0xe4,0xe6,0xe6,0x46,0x3,0xeb,0xb7,0x15,0xc6,0x7c,0x22,0xd6,0xa6,0xb3,0xf8,0xc7,0xe1,0x3b,0xa6,0x99,0x89,0x8b,0x5a,0xb3,0x76,0x25,0xb8,0xc7,0x9e,0x99,0xfd,0x33,0x5f,0xc4,0x5e,0x2c,0x62,0x3e,0xa5,0xc7,0xd5,0x1d,0xb5,0xe7,0xa7,0x2f,0xfd,0x27,0xfc,0x8f,0xed,0xcf,0xa,0x30,0x6f,0x1d,0xc0,0xa,0x2d,0xe9,0xc9,0x56,0x3f,0x8c,0xbf,0xcc,0xf9,0xf3,0xf6,0xf2,0xd2,0x3f,0xb1,0xff,0x0,0x6e,0xf,0x8b,0xf6,0xeb,0x1f,0x97,0x1a,0x78,0xbb,0x50,0x31,0xa8,0x1c,0x5,0x33,0x12,0x3f,0x9d,0x79,0x36,0x39,0xae,0xd7,0xfe,0xa,0xf9,0xe0,0xbd,0x7a,0xdb,0xfe,0xa,0xc5,0xf1,0x3,0xc2,0x3e,0x17,0xd3,0x75,0x7d,0x7b,0xc5,0x1e,0x30,0xd7,0xe1,0x6d,0x1f,0x48,0xb2,0xcb,0xdc,0x5f,0xdc,0x5d,0x20,0x91,0x55,0x17,0x20,0x1,0xc9,0x62,0xc4,0x85,0x55,0x56,0x66,0x2a,0xaa,0xc4,0x7d,0x5f,0xf0,0x67,0xfe,0xd,0xcd,0xff,0x0,0x84,0x37,0xe1,0x4b,0x78,0xab,0xf6,0x92,0xfd,0xa1,0x6f,0x3c,0x12,0x61,0xb2,0x6b,0xeb,0xfb,0xf,0xd,0xcf,0x65,0x65,0xa7,0xe8,0x11,0x2a,0xee,0x6f,0x3f,0x51,0xbe,0x8e,0x44,0x90,0x22,0xf2,0xce,0x22,0x8d,0x14,0xe4,0x6,0x60,0x3,0x9f,0xef,0x25,0x9b,0x61,0xf0,0xf8,0x5a,0x4e,0x6f,0x57,0x15,0xa2,0xf4,0x3f,0x86,0x67,0x83,0xa9,0x52,0xbc,0xed,0xb5,0xde,0xa5,0xdf,0xf8,0x26,0xb4,0xbf,
-0xf0,0x93,0x7e,0xc0,0x3f,0x1a,0x34,0x99,0xa4,0x76,0xfe,0xc1,0xf1,0x6,0x9f,0xac,0x41,0x19,0x3f,0x2a,0x29,0x89,0x51,0x88,0xf4,0xcb,0x75,0xfa,0xd4,0xcd,0x3c,0xb0,0xc6,0xcd,0xc,0x92,0x43,0x20,0x7,0xc,0x8c,0x54,0x83,0xda,0xba,0x65,0xff,0x0,0x82,0x63,0xf8,0xdf,0xf6,0x2c,0xf8,0x17,0xe2,0x8f,0x15,0xfe,0xce,0xbf,0x13,0x3f,0xe1,0x72,0xf8,0x17,0xe2,0x6,0x8d,0x4,0x92,0x69,0xda,0xe4,0xd6,0x93,0x7f,0x69,0xdb,0x82,0xb2,0xc5,0x71,0x65,0xa8,0x5a,0x2c,0x76,0xed,0xb9,0x71,0xb7,0x74,0x5b,0x1c,0x30,0xfd,0xec,0x63,0x2d,0x5e,0x29,0xf0,0x7f,0xf6,0x8c,0xd3,0x3e,0x2d,0xe8,0x92,0x4d,0xf6,0x3b,0xcd,0x37,0x50,0xb2,0x95,0xec,0xf5,0xb,0x1b,0x84,0x29,0x71,0x61,0x70,0x8c,0x52,0x48,0xa4,0x43,0x86,0x57,0x56,0xc,0xa5,0x48,0xc8,0x20,0x8a,0xfe,0x31,0xf1,0xff,0x0,0x7,0x39,0xe6,0xf0,0xcd,0xe1,0x17,0xec,0xa5,0x15,0x17,0x2b,0x6d,0x24,0xde,0x8f,0xb3,0xb1,0xfd,0x81,0xf4,0x7f,0xcc,0x29,0xbc,0xaa,0xa6,0x53,0x29,0x27,0x52,0x32,0x72,0x51,0xea,0xe2,0xd4,0x53,0x6b,0xba,0xba,0x3a,0x6f,0xf8,0x2e,0xef,0xc1,0xdf,0xb,0x7c,0x4a,0xb0,0xf8,0x2b,0xe3,0x6b,0xff,0x0,0xc,0xf8,0x76,0xfa,0x6f,0x11,0x78,0x72,0x4b,0x3b,0xd9,0xa7,0xd3,0x21,0x79,0xee,0x64,0x8d,0x91,0x83,0x34,0x85,0x77,0x93,0xcb,0x73,0x9e,0xf5,0xf9,0xab,0xe2,0x6f,0xd8,0xb7,0xe1,0xaf,0x89,0x93,0x6b,0x78,0x6a,0x1d,0x3d,0xfb,0x3d,0x84,0xcf,0x1,0xfc,0x81,0x23,0xf4,0xaf,0xd5,0xaf,0x87,0xdf,0xb1,0xb7,0x8d,0xff,0x0,0xe0,0xb3,0xdf,0x9,0xcb,0x4d,0xf1,0x62,0xc7,0xe1,0xde,0x89,0xf0,0x87,0x5b,0x6f,0xd,0xe9,0xfa,0x7c,0x1e,0x18,0x3a,0x95,0xc5,0xce,0xed,0x3e,0xce,0xed,0xae,0x24,0x94,0xdd,0xc2,0x14,0x37,0xda,0xf6,0x4,0x11,0x9c,0x79,0x25,0xb7,0x9d,0xdb,0x53,0xcd,0x7f,0x6b,0xff,0x0,0xf8,0x20,0x3f,0x8b,0x3f,0x65,0x2f,0x82,0x3a,0xc7,0x8c,0xad,0xbe,0x3e,0x47,0xaf,0xcb,0xa5,0x5b,0xc9,0x3a,0xd9,0xcf,0xe0,0xcf,0xb3,0xa4,0xa5,0x10,0xb0,0x52,0xe2,0xf9,0xca,0x83,0x8c,0x67,0x69,0xc6,0x73,0x83,0xd2,0xbf,0xa8,0xb8,0x5f,0x36,0xc1,0xcf,0x27,0xc3,0x7d,0x6a,0x3c,0xd2,0xe4,0x8d,0xdd,0x93,0xdd,0x5f,0xf5,0x3f,0x97,0xf8,0x8b,0x3,0x5a,0x96,0x6b,0x88,0x85,0x7,0x68,0xa9,0xc9,0x2d,0x7b,0x36,0x7c,0x33,0xfb,0x12,0x7f,0xc1,0x1,0xbc,0x37,0xfb,0x74,0xfc,0x60,0xd7,0x3c,0x2b,0xa7,0xfc,0x47,0xd6,0x3c,0x1b,0x25,0x96,0x85,0x3e,0xab,0x6b,0x34,0xba,0x54,0x7a,0x92,0x34,0x88,0xea,0xa2,0x36,0x5f,0x32,0x23,0xb7,0xe6,0xc9,0x21,0xb3,0xc5,0x79,0x37,0x8d,0xff,0x0,0xe0,0x81,0x7f,0x16,0xb4,0x29,0x18,0xe8,0xba,0xe7,0x81,0xfc,0x41,0x1a,0xb1,0x5d,0xa6,0xea,0x5b,0x39,0xbe,0xb8,0x92,0x3d,0xbf,0xf8,0xfd,0x7e,0x9c,0xff,0x0,0xc1,0xbb,0x1e,0x24,0x9b,0xc6,0x5f,0xb5,0x35,0xbe,0xaa,0xcb,0xe5,0x9b,0xdf,0x8,0x5d,0x4d,0x2a,0x8e,0x83,0x21,0x7f,0xad,0x7a,0x2e,0xa7,0x81,0xa9,0xdd,0xe3,0x1,0x7c,0xf7,0xc7,0xd3,0x71,0xaf,0xc9,0xfc,0x6a,0xe2,0xac,0x67,0xd,0xe2,0xb0,0xcf,0x2b,0xe5,0x51,0xa8,0xa5,0x74,0xd5,0xd6,0x96,0xb7,0x54,0xfa,0xbd,0x99,0xfa,0xb7,0x83,0x9c,0x1f,0x80,0xe2,0x4a,0x38,0xa8,0xe6,0x7c,0xcd,0xd3,0x71,0xb3,0x8b,0xb3,0x57,0xe6,0xbf,0x46,0x9e,0xcb,0x74,0x7e,0x2e,0xd9,0x7f,0xc1,0x8,0x3f,0x69,0xad,0x5f,0xc2,0x1e,0x28,0xd7,0xac,0x3c,0x3,0xa6,0xdf,0xe8,0xfe,0xd,0xb4,0x37,0xda,0xad,0xc4,0x5e,0x20,0xd3,0xc7,0x91,0x8,0x56,0x62,0xe1,0x5a,0x55,0x67,0xc2,0xa9,0x38,0x50,0x4f,0x15,0xe7,0x1e,0x1f,0xff,0x0,0x82,0x74,0x7c,0x42,0xd5,0xb6,0x35,0xc1,0xf0,0xf6,0x92,0xac,0x32,0x4d,0xc5,0xf1,0x90,0x81,0xf4,0x89,0x1e,0xbf,0xa5,0xaf,0xd8,0x83,0x4e,0x5f,0x1d,0x59,0x7c,0x50,0xf0,0x4c,0x8c,0x52,0x3f,0x14,0xf8,0x4e,0xea,0x1d,0xff,0x0,0xdd,0x3b,0x4a,0x7f,0x29,0x2b,0xf2,0x3e,0x4,0x31,0xc5,0xb5,0xbe,0xf2,0xfc,0xa7,0x8f,0x43,0x5f,0x69,0xe1,0x4e,0x3a,0x3c,0x4b,0x93,0x2c,0xc3,0x1a,0xbf,0x79,0x76,0x9a,0x8e,0x8b,0x46,0xed,0xbd,0xde,0xd6,0xea,0x7c,0x67,0x89,0x99,0x3c,0x78,0x77,0x3a,0x9e,0x5f,0x84,0x6d,0xc2,0xc9,0xa7,0x2b,0x37,0xaa,0x4f,0xa5,0x96,0xf7,0xe8,0x7c,0xb7,0xe0,0xef,0xf8,0x26,0x35,0x8c,0x2c,0xb2,0x78,0x87,0xc5,0x77,0x57,0x3c,0xfc,0xd0,0x69,0xd6,0xa2,0x15,0x3f,0xf6,0xd6,0x42,0xc7,0xff,0x0,0x1c,0x15,0xf4,0xf,0xec,0xfb,0xf0,0x5f,0xc1,0xff,0x0,0xb3,0x4f,0x8d,0x74,0x1d,0x7b,0xc3,0xba,0x25,0xac,0x5a,0x96,0x87,0xa9,0x5b,0x6a,0x11,0x5f,0xdc,0x8f,0xb4,0x5d,0x2b,0xc5,0x2a,0x38,0x21,0xdb,0xee,0xf2,0xbf,0xc3,0xb4,0x7b,0x57,0x4b,0x9e,0x29,0xb7,0x4b,0xbe,0xde,0x45,0xf5,0x5c,0x57,0xeb,0xb4,0x32,0xbc,0x2d,0x1f,0x82,0xb,0xe7,0xab,0xfc,0x4f,0xcd,0x6a,0x62,0xeb,0x4f,0xe2,0x91,0xfa,0xd1,0xff,0x0,0x5,0x7,0xd3,0x95,0x3f,0x68,0x6f,0xed,0x45,0xb,0xff,0x0,0x13,0xed,0x26,0xd2,0xf4,0x9c,0x70,0x7f,0x76,0x14,0xff,0x0,0x2a,0xe6,0xfc,0x65,0xa0,0xaf,0xc6,0x9f,0xf8,0x25,0x57,0xc5,0xaf,0xe,0xba,0x79,0xb7,0x7e,0xa,0xb9,0x8b,0xc4,0x3a,0x72,0x8f,0xe1,0x20,0x86,0x27,0xf0,0x1e,0x6d,0x6d,0x7e,0xd4,0x9a,0xa7,0xfc,0x27,0x7f,0xa,0x3e,0x8,0xf8,0xc5,0x7e,0x78,0xfc,0x41,0xe0,0xbb,0x45,0xdf,0xea,0xeb,0x1a,0xb1,0xff,0x0,0xd0,0xaa,0xf7,0xec,0x39,0xf,0xfc,0x25,0x57,0xdf,0x11,0x3c,0x1a,0xcb,0xba,0x3f,0x18,0x78,0x52,0xf2,0xd7,0x7,0x9f,0x98,0x46,0xea,0x30,0x3d,0x7f,0x7b,0xfa,0x57,0xf1,0x26,0x57,0x88,0x96,0x51,0xe2,0x74,0x96,0xca,0x55,0x1a,0x7f,0xf6,0xf2,0xba,0xfc,0x6c,0x7f,0x61,0xe6,0x38,0x78,0xe6,0xde,0x17,0xc2,0x7b,0xb8,0x53,0x8b,0x5f,0xf6,0xe4,0xb9,0x5f,0xfe,0x4b,0x73,0xf2,0x55,0xe,0xf1,0xbb,0xb1,0x19,0x14,
-0x92,0xc6,0xb3,0x46,0xca,0x79,0xc,0x8,0x35,0x91,0xac,0xf8,0xcf,0x4c,0xf0,0xc5,0xcc,0xf6,0xaf,0x75,0xe7,0xc9,0x67,0x2b,0xc0,0x52,0x21,0xbd,0xb2,0x8c,0x57,0x93,0xdb,0xa5,0x73,0xba,0x8f,0xc5,0xf9,0x64,0x25,0x6d,0x6c,0xd5,0x57,0xfb,0xd2,0xb6,0x4f,0xe4,0x2b,0xfb,0xba,0x34,0xe4,0xd5,0xd1,0xfc,0x62,0xe4,0xb6,0x3f,0x63,0xbc,0x5b,0xad,0xbf,0xc4,0xcf,0xf8,0x27,0x47,0xec,0xfb,0xe2,0xa9,0x5b,0xed,0x17,0x91,0xe9,0xc7,0x4d,0xba,0x94,0x72,0x50,0xa2,0xed,0xa,0x4f,0xd5,0x5,0x79,0x19,0xcd,0x1f,0xb0,0x87,0xc4,0x6b,0xbf,0x8a,0x1f,0xf0,0x45,0x7d,0x7a,0x16,0x9c,0x1d,0x53,0xc0,0xfe,0x33,0x66,0x72,0x83,0x2,0x38,0x24,0x75,0x75,0x50,0x3e,0x84,0xd7,0x2f,0x61,0xe3,0x29,0xa1,0x97,0x17,0xa,0xb2,0x47,0xdc,0xa8,0xc3,0xf,0xf1,0xaf,0xf3,0xb7,0xc7,0x8c,0x3c,0x30,0x3c,0x5d,0x56,0x32,0xd3,0x9d,0x46,0x5f,0xa7,0xe8,0x7f,0x7d,0x78,0xf,0x5a,0xa6,0x37,0x84,0xe9,0xb8,0xeb,0xec,0xe5,0x28,0xfe,0x52,0xff,0x0,0xdb,0x8e,0xa1,0x97,0xe5,0xaf,0x2f,0xff,0x0,0x82,0x99,0x7c,0x12,0xd2,0x7e,0x33,0xff,0x0,0xc1,0x1e,0x3e,0x39,0x4f,0x79,0x60,0x97,0x3a,0xd7,0x81,0xf5,0x4d,0x17,0xc4,0x7a,0x34,0xd8,0xf9,0xed,0x65,0x57,0x92,0x19,0x8a,0xf7,0xc3,0xc1,0x24,0x8a,0x47,0x43,0x95,0x3d,0x54,0x57,0xa6,0x5a,0xde,0x47,0x77,0x6e,0xb2,0xc6,0xdb,0xa3,0x61,0xc1,0xf5,0xae,0x9a,0xd3,0x42,0x87,0xc5,0xdf,0xb2,0xc7,0xed,0x9,0xa6,0x5e,0x46,0xb3,0x59,0xc7,0xe0,0x39,0xb5,0x26,0x89,0xbe,0xeb,0x3d,0xbc,0xab,0x22,0xe7,0xf2,0x3f,0x9d,0x79,0x5e,0x13,0xd6,0x51,0xe2,0xac,0x1a,0x7b,0x49,0xb8,0xff,0x0,0xe0,0x51,0x68,0xf4,0x7c,0x5c,0xa0,0xe7,0xc2,0x98,0xbb,0x6f,0x15,0x19,0x7d,0xd3,0x8b,0x3e,0x5f,0xff,0x0,0x83,0x2c,0xff,0x0,0x6d,0xc6,0xd2,0x3c,0x6d,0xf1,0x2b,0xf6,0x7b,0xd5,0xae,0xff,0x0,0xd1,0x75,0x88,0x3f,0xe1,0x32,0xf0,0xf2,0x49,0x28,0xa,0xb7,0x11,0xf9,0x70,0x5e,0x44,0x8a,0x79,0x2c,0xf1,0x98,0x24,0xc0,0x3c,0x8,0x1c,0xe3,0x92,0x6b,0xfa,0x14,0xaf,0xe2,0x67,0xf6,0x27,0xf8,0xff,0x0,0xaa,0xff,0x0,0xc1,0x32,0x3f,0xe0,0xa5,0xde,0xb,0xf1,0xbc,0x32,0xc9,0x19,0xf8,0x7b,0xe2,0x81,0xd,0xfe,0x47,0xfc,0x7d,0x69,0xb2,0x16,0x82,0xe5,0x7f,0xed,0xa5,0xa4,0xb2,0x60,0xf6,0xdc,0x8,0xe8,0x2b,0xfb,0x60,0xd3,0x75,0x1b,0x7d,0x63,0x4f,0x82,0xee,0xd6,0x68,0xae,0x2d,0x6e,0xa3,0x59,0x61,0x96,0x26,0xc,0x92,0xa3,0xc,0xab,0x29,0x1c,0x10,0x41,0x4,0x11,0xeb,0x5f,0xd9,0x32,0x8b,0x8c,0x9c,0x65,0xba,0x3f,0x89,0xae,0x9a,0xba,0x26,0xa2,0x8a,0x2a,0x40,0x28,0xa2,0x8a,0x0,0x8,0xc8,0xaf,0xc0,0xcf,0xf8,0x3d,0x3,0xfe,0x9,0xff,0x0,0x6a,0xba,0x5f,0x80,0xff,0x0,0x69,0x2d,0xa,0xd6,0x18,0x6e,0xbc,0xf4,0xf0,0x6f,0x8a,0x44,0x69,0x86,0xb8,0x56,0x59,0x25,0xb1,0xb9,0x6c,0xc,0x12,0xbb,0x26,0x85,0x99,0x8e,0x70,0xd6,0xea,0x38,0x5e,0x3f,0x7c,0xeb,0xe3,0x7f,0xf8,0x38,0x23,0xc0,0x3a,0x6f,0xc4,0x8f,0xf8,0x23,0x77,0xc7,0xeb,0x1d,0x55,0x15,0xad,0xed,0x7c,0x36,0x75,0x48,0x98,0xff,0x0,0xcb,0x39,0xed,0x67,0x8a,0xe6,0x16,0x1f,0xf6,0xd2,0x25,0xfc,0x9,0x1d,0xe8,0x3,0xe7,0x3f,0xf8,0x34,0x87,0xf6,0xe1,0xbe,0xfd,0xa7,0x7f,0xe0,0x9c,0xd3,0x78,0x7,0x5c,0xba,0x7b,0xad,0x6f,0xe0,0xbd,0xf2,0x68,0x70,0xc9,0x2c,0x80,0xc9,0x26,0x99,0x22,0x99,0x2c,0xc6,0x3a,0xed,0x8d,0x43,0xc4,0x33,0xda,0x25,0x1d,0xa8,0xaf,0xcf,0xdf,0xf8,0x32,0x7b,0xc6,0xf7,0xf6,0x3f,0xb7,0x67,0xc5,0xaf,0xd,0xc7,0xff,0x0,0x20,0xdd,0x5f,0xc0,0x23,0x53,0xb8,0x18,0xeb,0x35,0xb6,0xa1,0x6d,0x1c,0x5c,0xff,0x0,0xbb,0x77,0x35,0x14,0x21,0xb3,0xa6,0xff,0x0,0x83,0xd9,0xfe,0xe,0x5e,0x69,0x5f,0xb4,0x57,0xc1,0x9f,0x1f,0x2d,0xab,0xd,0x37,0x58,0xf0,0xfd,0xd6,0x87,0x24,0xff,0x0,0xc2,0x6e,0x20,0x9f,0xce,0xb,0xf5,0xd9,0x30,0xfc,0xab,0xf4,0x1f,0xfe,0xd,0x44,0xfd,0xa4,0xac,0xfe,0x39,0x7f,0xc1,0x1f,0x7c,0x23,0xa0,0x8b,0x95,0x9b,0x58,0xf8,0x63,0xaa,0x5f,0xf8,0x6b,0x50,0x8f,0xa3,0x46,0xc,0xed,0x77,0x6e,0x71,0xfd,0xdf,0x22,0xe6,0x35,0x4,0x70,0x4a,0x30,0xea,0xd,0x7a,0x3f,0xfc,0x1c,0x1d,0xff,0x0,0x4,0xf3,0xff,0x0,0x87,0x87,0xff,0x0,0xc1,0x38,0xbc,0x59,0xa3,0xe9,0x76,0xab,0x37,0x8d,0x3c,0x16,0x8d,0xe2,0x6f,0xe,0x36,0xcc,0xc9,0x24,0xf0,0x21,0x69,0x2d,0xd4,0xf5,0x1e,0x74,0x5b,0x93,0x8e,0xad,0xb6,0xbf,0x4,0xbf,0xe0,0xda,0x7f,0xf8,0x2a,0x9d,0xaf,0xfc,0x13,0x5b,0xf6,0xdc,0x9b,0xc3,0xbe,0x3a,0xd4,0x1b,0x4a,0xf8,0x5f,0xf1,0x48,0x47,0xa4,0x6b,0x92,0xdc,0xb3,0x2c,0x5a,0x25,0xf2,0x33,0xb,0x5b,0xd7,0x4,0xe1,0x55,0x5d,0x9a,0x29,0x58,0xe3,0x6a,0x48,0x58,0x9c,0x47,0x8a,0x5d,0x47,0xd0,0xfe,0xb3,0xe8,0xa6,0xc5,0x3a,0x4f,0x12,0xba,0x32,0xba,0x38,0xc,0xac,0xa7,0x21,0x81,0xe8,0x41,0xa6,0xdc,0x23,0x4b,0x3,0x2a,0xb6,0xd2,0xc3,0x82,0x3b,0x53,0x24,0x90,0x1c,0xd3,0x27,0x9d,0x6d,0xa3,0x67,0x91,0x95,0x51,0x41,0x66,0x62,0x70,0x14,0xe,0xa4,0x9a,0x83,0x54,0xd5,0xac,0xfc,0x3d,0xa4,0xdd,0x5e,0xdf,0x5d,0x5b,0xd8,0xd8,0xd8,0xc4,0xf3,0xdc,0x5c,0x4f,0x20,0x8e,0x1b,0x78,0xd4,0x16,0x67,0x76,0x6c,0x5,0x55,0x50,0x49,0x24,0xe0,0x1,0x5f,0xce,0x2f,0xfc,0x17,0x87,0xfe,0xe,0x50,0xd6,0x7f,0x6c,0x3b,0xad,0x77,0xf6,0x7f,0xfd,0x9c,0x5a,0xf6,0x1f,0x2,0xea,0x93,0x36,0x93,0xac,0x78,0xa2,0xd7,0x77,0xdb,0xbc,0x5e,0xb9,0x2a,0xf6,0xb6,0x80,0x73,0x15,0x93,0x9e,0x19,0xfe,0xfc,0xeb,0xf2,0xfc,0x91,0x17,0x59,0xb,0x37,0xa2,0x3,0x93,0xff,0x0,0x83,0x93,0x3f,0xe0,0xbe,0x53,0x7e,0xdb,0xfe,0x36,0xb8,0xf8,0x17,0xf0,0x57,0x5c,0x9a,0xe3,0xe1,
-0x16,0x93,0x70,0x22,0xd6,0xf5,0x3b,0xf,0xbb,0xe3,0x7b,0xe4,0x71,0x84,0x8d,0x87,0x2f,0x65,0x13,0x1,0xb3,0x18,0x59,0xa4,0xcb,0xfc,0xe8,0xb1,0x35,0x79,0x37,0xfc,0x12,0xf,0xfe,0x9,0x47,0xe2,0xff,0x0,0x8d,0xdf,0x16,0x6c,0x2c,0x6d,0x74,0xd5,0x6f,0x15,0xea,0xb,0xe6,0xcd,0x34,0xe3,0x75,0xb7,0x85,0xac,0x49,0x1,0xee,0x66,0x23,0xf8,0xcf,0x20,0x28,0x3b,0x98,0x90,0xa3,0x92,0x48,0xec,0xff,0x0,0xe0,0x8f,0xff,0x0,0xf0,0x43,0xff,0x0,0x1a,0x7c,0x7e,0xf1,0x32,0x6a,0x16,0x36,0x16,0x6d,0x75,0x6b,0x2a,0xc7,0xa8,0xf8,0x82,0xf5,0x4b,0x69,0x9e,0x1b,0xe0,0x13,0x1c,0x44,0x73,0x3d,0xd6,0xd2,0xe,0xd4,0xe8,0x48,0xcb,0x22,0x9d,0xf5,0xfa,0xa5,0xf1,0xc3,0xf6,0xad,0xf8,0x67,0xff,0x0,0x4,0x80,0xf8,0x27,0xa8,0x7c,0x21,0xf8,0x28,0xd6,0xfe,0x22,0xf8,0xa9,0x77,0xc6,0xb9,0xae,0xca,0xa9,0x37,0xd8,0x6e,0x71,0x83,0x3d,0xd3,0xf,0x95,0xe7,0x40,0x48,0x8a,0xd8,0x7c,0xb1,0xf5,0x7c,0x72,0x24,0xfa,0x2c,0x16,0xa,0x54,0x64,0xac,0xb9,0xab,0x3d,0x97,0x48,0xf9,0xcb,0xcf,0xb2,0x3c,0xea,0xf5,0xd4,0xd3,0xe9,0xe,0xaf,0xbf,0x92,0x3c,0xd7,0xfe,0xa,0xb9,0xf1,0xaf,0xc3,0x9f,0xb3,0x87,0xc1,0x5f,0xb,0xfe,0xca,0x3f,0xc,0xee,0xd9,0xb4,0x6f,0xa,0xc7,0x1d,0xcf,0x8b,0x6e,0x83,0x6e,0x92,0xee,0xe0,0xb7,0x9c,0x90,0x48,0x47,0x5,0xe4,0x99,0xcd,0xcc,0xa1,0x46,0x3,0x18,0x94,0x60,0x6,0x51,0xf9,0xc7,0xe3,0x7f,0x14,0x47,0xe1,0x9d,0x3f,0x31,0xed,0x37,0x93,0x67,0xca,0x18,0xfb,0xbc,0x60,0xb1,0xfa,0x7a,0xd5,0x9f,0x88,0xdf,0x12,0xa4,0x82,0xfe,0xf2,0xf6,0xfa,0xf2,0x7d,0x53,0x5c,0xd4,0xa6,0x7b,0x99,0xe5,0xb8,0x94,0xcb,0x35,0xc4,0xce,0xc5,0x9e,0x59,0x58,0xf2,0x59,0x98,0x92,0x49,0xe4,0x92,0x6b,0xcb,0x2f,0xf5,0x9,0xf5,0x5b,0xc7,0x9e,0xe2,0x46,0x92,0x69,0x3a,0xb1,0xfe,0x9e,0xd5,0xf6,0xd9,0x7e,0x5,0x51,0xa6,0xa2,0xdd,0xde,0xed,0xf7,0x6f,0x76,0x78,0x58,0x8c,0x47,0x3c,0xae,0xbf,0xe1,0x91,0xfa,0x6d,0xfb,0x16,0xf8,0x81,0xbc,0x61,0xff,0x0,0x4,0x63,0xb7,0x87,0xe6,0x92,0x6f,0xc,0xfc,0x4b,0xb9,0xb6,0x95,0xb3,0x92,0x7c,0xdb,0x75,0x9b,0x27,0xfe,0xfe,0x8a,0xc7,0x86,0xf9,0xb4,0xd9,0xe3,0xba,0x4f,0x95,0xed,0x5c,0x4c,0xa7,0x38,0xc1,0x53,0x9f,0xe9,0x53,0x7f,0xc1,0x31,0x4e,0xcf,0xf8,0x24,0x27,0xc5,0x9d,0xdf,0x75,0xbe,0x25,0x5b,0x84,0xcf,0x66,0xfb,0x15,0x9e,0x71,0xef,0x8a,0xe7,0x7e,0x23,0xea,0xeb,0xa0,0x78,0xb,0x58,0xbc,0x66,0x28,0x21,0xb5,0x73,0x9c,0x74,0xc8,0xc7,0xf5,0xaf,0xf3,0xdf,0xe9,0x13,0x86,0xe5,0xe3,0x99,0x2a,0x7b,0xca,0x30,0xfb,0xdb,0x68,0xfe,0xfa,0xfa,0x3c,0x62,0xaf,0xc1,0x4f,0xda,0x6d,0x19,0xcf,0xee,0xb4,0x5b,0xfc,0xcf,0xbd,0x7f,0xe0,0x9e,0x7f,0xb3,0xb6,0x8d,0xf1,0xf3,0xfe,0xa,0xd,0xf1,0x97,0xf6,0xaa,0xd4,0x2d,0xe1,0xbc,0x9e,0x6f,0xb2,0x78,0x1b,0xc1,0xce,0xf1,0xe4,0x5a,0x45,0x6d,0x67,0x2,0xea,0x37,0x71,0x93,0xc1,0x69,0x24,0x29,0x6f,0xb8,0x61,0x93,0xec,0xd7,0x2a,0xe,0xd9,0x5b,0x3e,0x2d,0xff,0x0,0x7,0x55,0xeb,0x17,0x56,0x9f,0xb1,0xef,0xd8,0xe3,0xb8,0x92,0x3b,0x5b,0xbb,0xfd,0x29,0x66,0x88,0x37,0xcb,0x28,0x1a,0x9d,0xbb,0x0,0x47,0x7f,0x99,0x54,0xfd,0x40,0xaf,0xb7,0xff,0x0,0xe0,0x94,0xbe,0x6,0xff,0x0,0x84,0x3,0xfe,0x9,0xc7,0xf0,0x66,0x9,0x15,0xd6,0xff,0x0,0x58,0xf0,0xb5,0x9f,0x88,0x35,0x2d,0xc3,0x7,0xed,0xda,0x8a,0x7d,0xbe,0xeb,0xff,0x0,0x23,0xdc,0xc8,0x7,0xb0,0x15,0xf0,0xc7,0xfc,0x1d,0x6b,0xff,0x0,0x26,0xa3,0x6f,0xff,0x0,0x61,0x1d,0x2b,0xff,0x0,0x4e,0x10,0x57,0xf5,0x96,0x7,0x9d,0xba,0x4a,0xa6,0xfe,0xea,0xfc,0x8f,0xe3,0x6c,0x62,0x8f,0x3c,0xf9,0x36,0xbb,0x3d,0xf7,0xfe,0xd,0xbe,0x89,0x75,0x2f,0xf8,0x22,0x9f,0xc2,0x48,0x6e,0x33,0x32,0x35,0xcf,0x89,0x22,0xc3,0x9c,0xe1,0x17,0xc4,0x5a,0x9a,0xaa,0xfd,0x0,0x0,0x1,0xd8,0xc,0x57,0xc7,0xdf,0xf0,0x56,0x3f,0x80,0x71,0xfe,0xc8,0x1f,0xb6,0x9e,0x8f,0xe3,0xad,0x26,0x6,0xb7,0xf0,0xf7,0xc4,0x9,0xbf,0xb2,0xf5,0x88,0xd0,0x7c,0x82,0xe4,0x29,0x6b,0x69,0xf0,0x38,0x4,0xa2,0x49,0x13,0x37,0x7d,0xb6,0xcb,0xc6,0x39,0xfb,0xb,0xfe,0xd,0xb0,0xff,0x0,0x94,0x2f,0x7c,0x22,0xff,0x0,0xaf,0xdf,0x13,0x7f,0xea,0x49,0xaa,0x56,0x3f,0xfc,0x1c,0x43,0xf0,0xfa,0x3d,0x7b,0xf6,0x23,0xd6,0xb5,0xb0,0xab,0xf6,0xaf,0xd,0xc5,0xfd,0xaf,0xb,0x85,0xc9,0x57,0xb4,0x75,0xba,0x1f,0x9f,0x93,0xb7,0xe8,0xc6,0xbc,0x5e,0x2a,0xc9,0xe9,0x66,0xb9,0x7e,0x23,0x3,0x59,0x5d,0x4d,0x35,0xe8,0xf7,0x4f,0xe4,0xec,0x7b,0x7c,0x23,0x9d,0x56,0xca,0x73,0x4c,0x3e,0x3e,0x8b,0xb3,0x84,0x95,0xfc,0xd3,0xd1,0xaf,0x9a,0xb9,0x87,0xff,0x0,0x4,0xc2,0xb3,0xd3,0x6c,0x7f,0x6b,0xff,0x0,0x6,0xcd,0xa6,0xda,0xc1,0x69,0x36,0xa1,0xf0,0xbb,0x5b,0x8b,0x52,0x78,0x57,0x6b,0x5e,0xc9,0x6f,0xab,0x69,0x1e,0x51,0x93,0xfb,0xdb,0x4,0xf2,0xed,0xcf,0xdd,0xf3,0xa4,0xc6,0x37,0xb6,0x7e,0xb4,0xfd,0xbe,0xfe,0xe,0xea,0x1f,0x1c,0xbf,0x66,0x8f,0x13,0x68,0x3a,0x6a,0xb3,0xdc,0x5c,0x69,0xf7,0x25,0x55,0x14,0xb3,0xb9,0x10,0xb9,0xa,0xa0,0xc,0x96,0x27,0x80,0x6,0x49,0x26,0xbe,0x1f,0xff,0x0,0x82,0x34,0xf8,0x8f,0xfe,0x12,0xf,0xda,0x7f,0xc2,0xac,0x64,0xf3,0x24,0x87,0xe1,0xf7,0x88,0xb3,0x9e,0xa3,0x76,0xa3,0xa0,0x7f,0x81,0xaf,0xbc,0x7f,0x6d,0xf,0x8e,0x57,0xdf,0xb3,0xcf,0xc0,0x8d,0x63,0xc4,0xda,0x6c,0x30,0xdc,0x5e,0x69,0xf0,0x49,0x34,0x71,0xc9,0xf7,0x18,0xaa,0x16,0x0,0xe3,0x9c,0x12,0x3b,0x57,0x9b,0xc0,0xf5,0x25,0x3c,0x83,0x8,0xe5,0xbf,0xb3,0x8a,0xf9,0xa5,0x6f,0xd0,0xf4,0x38,0xfa,0x9c,0x69,0xf1,0x16,0x36,0x31,0xdb,
-0xda,0x49,0xaf,0x46,0xef,0xfa,0x9f,0x98,0xff,0x0,0xf0,0x46,0x9f,0xf8,0x21,0xe7,0xc6,0xf,0xa,0x7c,0x22,0xd1,0xbc,0x77,0xf1,0x1b,0xe2,0x1f,0x89,0x3e,0xf,0xea,0xda,0xb6,0x88,0xb6,0xd6,0x3e,0x1a,0xf0,0xf5,0xad,0xb7,0xf6,0xb5,0x95,0xbb,0x85,0x20,0xdf,0xcb,0x75,0x14,0xb1,0xc5,0x23,0x1,0x93,0x6e,0xb1,0x17,0x8c,0x11,0xbe,0x40,0xfb,0xa3,0x4e,0x63,0xf6,0xae,0xf8,0x17,0xe3,0x2f,0xf8,0x26,0x8f,0xc5,0x8d,0x26,0xd3,0x5e,0xf1,0x35,0xff,0x0,0x8e,0x7e,0x1c,0xf8,0x8e,0xe9,0x2d,0x22,0xd5,0x75,0x8,0x63,0x5d,0x4b,0x4b,0xb8,0x7c,0x84,0x13,0x18,0x95,0x63,0x91,0x1d,0x86,0xd0,0xe8,0x89,0xb5,0xca,0xa9,0x43,0xb8,0x3d,0x7d,0x33,0xff,0x0,0x6,0xe2,0x7f,0xc1,0x49,0x7e,0x2b,0x7f,0xc1,0x47,0xbe,0xd,0x7c,0x50,0xd5,0xbe,0x2b,0x6a,0x5a,0x4e,0xad,0xa8,0x68,0x1e,0x20,0xb6,0xfe,0xcf,0x92,0xc7,0x4d,0x8e,0xc5,0x6d,0x6d,0xee,0xad,0x44,0xbf,0x65,0xb,0x1f,0xd,0x1c,0x6c,0xe,0xc6,0x7d,0xd2,0x10,0xc4,0x3b,0xb9,0x0,0xd1,0xff,0x0,0x7,0x1e,0x5a,0xc6,0xdf,0xb2,0xe5,0x8c,0x8c,0xaa,0x5d,0x75,0x7d,0x28,0xa9,0xc7,0x4c,0x6a,0x76,0x84,0x57,0x6f,0x1a,0xe4,0x78,0x7c,0xdf,0x9,0x56,0x9e,0x61,0x15,0x29,0x46,0x2f,0x95,0xf5,0x8b,0xb6,0x96,0x7d,0x35,0x4a,0xfd,0xfa,0x9c,0xfc,0x15,0xc4,0x18,0xbc,0xa3,0x1f,0x4a,0xa6,0x6,0x6e,0x31,0x94,0xa3,0xcc,0xba,0x49,0x37,0xd5,0x7c,0xdd,0x9f,0x43,0xce,0x7f,0xe0,0x97,0x5f,0xb3,0xef,0x8a,0x3f,0x6c,0x6,0xf8,0x81,0xe3,0x8d,0x23,0xe3,0x67,0x88,0x3c,0x1,0x7d,0xe1,0xad,0x7a,0x5f,0xb,0xa6,0x93,0xa3,0x69,0xd6,0x73,0x6d,0xb5,0x6b,0x4b,0x59,0xc4,0xd3,0x79,0xea,0xcd,0x99,0x1a,0x67,0xa,0x40,0x51,0x88,0x7f,0x88,0xee,0xc7,0x29,0xfb,0x54,0xff,0x0,0xc1,0xb8,0x97,0x1f,0x8,0x3e,0xa,0xf8,0xb3,0xc5,0xbe,0xb,0xf8,0xc3,0xf1,0x23,0xc4,0xda,0xee,0x81,0xa4,0xdf,0x6a,0xf0,0x69,0x57,0x5a,0x4d,0x94,0xe9,0xa8,0x4b,0x4,0x12,0x4c,0xb0,0x2c,0x76,0xf0,0xac,0xac,0x64,0x65,0x8,0x15,0xe,0xe2,0x5c,0x63,0x27,0x83,0xd3,0xff,0x0,0xc1,0x8,0xa0,0x8e,0xcf,0xf6,0xf9,0xf8,0x98,0x21,0x45,0x8f,0xed,0x1e,0x0,0xd3,0x1e,0x5d,0x83,0x1e,0x61,0x17,0x6d,0x82,0xde,0xa4,0x6e,0x6c,0x67,0xa6,0xe6,0xf5,0x35,0xf7,0xaf,0xfc,0x14,0x43,0xf6,0x9e,0xd5,0x3f,0x64,0x6f,0xd9,0x8f,0xc5,0x1e,0x35,0xd1,0x6d,0x2d,0x2f,0xb5,0x2d,0xf,0x4b,0xbb,0xbe,0xb7,0x86,0xeb,0x77,0x93,0x24,0x90,0xdb,0xc9,0x2a,0xab,0xed,0x21,0xb6,0x96,0x40,0xe,0x8,0x38,0xce,0x8,0xae,0xf,0xe,0x71,0x51,0x86,0x41,0x86,0xa9,0x83,0x8f,0xb2,0x52,0x8a,0x6d,0x2e,0xad,0x68,0xdb,0xf5,0x6a,0xe7,0x7f,0x89,0x54,0x2a,0xae,0x23,0xc4,0xd2,0xc5,0x4d,0xd4,0x71,0x96,0x8d,0xf4,0x4f,0x54,0x97,0xa2,0x76,0x3f,0x38,0xff,0x0,0x64,0x7f,0xf8,0x36,0xeb,0xc4,0x3f,0x17,0xbe,0x15,0x5a,0xf8,0x93,0xe3,0x8f,0xc4,0x4f,0x16,0x78,0x2f,0x5f,0xd5,0x20,0x59,0xed,0x7c,0x31,0xe1,0x51,0x67,0x1c,0x9a,0x42,0xb0,0xc8,0x4b,0xdb,0x89,0xe1,0x9d,0x64,0x9f,0x91,0xb9,0x21,0x54,0x58,0xd8,0x15,0xf3,0x25,0xe1,0xab,0xe7,0xbf,0xda,0xf7,0xfe,0x9,0x3,0xf1,0xd3,0xf6,0x48,0xf8,0xb7,0xa0,0xf8,0x7b,0xc0,0xba,0x66,0xb7,0xf1,0x83,0xc3,0xfe,0x39,0xd4,0xff,0x0,0xb1,0x74,0x4b,0xa6,0x8e,0x18,0xaf,0x74,0xeb,0xc3,0x1b,0x4a,0x16,0xf5,0x97,0x6c,0x4b,0xf,0x95,0x1c,0xd2,0x7d,0xa0,0x2c,0x71,0xaa,0xc3,0x20,0x65,0x53,0xb0,0xcb,0xfa,0x59,0xff,0x0,0x6,0xfe,0x7e,0xdf,0x9f,0x11,0xbf,0xe0,0xa2,0xdf,0xb2,0xf,0x8c,0x3c,0x61,0xf1,0x3a,0x7d,0xe,0xe7,0xc4,0x1a,0x17,0x8e,0xaf,0x34,0x18,0x24,0xd2,0xb4,0xff,0x0,0xb0,0xc2,0x6d,0x56,0xc7,0x4f,0xbb,0x45,0x31,0xef,0x7e,0x55,0xae,0xe4,0x40,0x73,0x92,0x88,0x99,0x2c,0xc0,0xb3,0x41,0xff,0x0,0x5,0xd6,0xff,0x0,0x82,0x87,0xf8,0xeb,0xf6,0x0,0xfd,0x99,0x2f,0xb5,0xaf,0x87,0xbf,0xd9,0xb6,0xfe,0x24,0xbb,0x92,0xce,0xce,0xd6,0xf2,0xf6,0xd8,0x5c,0xc7,0x64,0x67,0xbb,0x8a,0x17,0x97,0xca,0x3f,0x2b,0xb2,0xc6,0xcd,0xb4,0x37,0xcb,0xbb,0x69,0x21,0x80,0xda,0x7f,0x42,0x8e,0x61,0x8d,0x86,0x22,0xdc,0xde,0xf5,0xed,0x6e,0x97,0xd8,0xfc,0xfd,0xe1,0xe8,0x4a,0x9d,0xed,0xa6,0xe7,0x3d,0xe1,0x6f,0xf8,0x22,0x87,0x8d,0xbc,0x63,0xfb,0x3b,0x78,0x2f,0x41,0xf8,0x8d,0xf1,0xf3,0xc5,0xb1,0xf8,0x83,0xc1,0xfa,0x72,0x5a,0xd9,0xda,0x78,0x3a,0xda,0xd2,0xd7,0x48,0xb1,0xfd,0xda,0x83,0x18,0x37,0x76,0xf3,0xcd,0x3e,0x8,0x23,0xcd,0xfd,0xc8,0x71,0x83,0xe5,0x21,0xaf,0x13,0xfd,0x80,0xe4,0xf1,0xa7,0xec,0xa1,0xff,0x0,0x5,0x54,0xd2,0x7e,0x15,0xfc,0x40,0xd6,0x13,0x5a,0x9a,0xf6,0xce,0xe4,0xe8,0xba,0xc2,0xc1,0xf6,0x71,0xaa,0x41,0xb7,0x12,0x23,0xc7,0xb9,0x82,0xca,0x8c,0x13,0x70,0x5,0x94,0x89,0x62,0x60,0x46,0xe2,0x89,0xf7,0x87,0xfc,0x12,0x4b,0xf6,0x97,0xf1,0x47,0xed,0x83,0xff,0x0,0x4,0xe8,0xf8,0x5b,0xf1,0x1b,0xc6,0xd2,0xd8,0xdc,0x78,0xab,0xc4,0x5a,0x7c,0xe3,0x52,0x9e,0xd2,0xdc,0x5b,0xc5,0x73,0x24,0x17,0x73,0xdb,0x79,0xa2,0x31,0xc2,0x33,0x88,0x83,0x30,0x5c,0x28,0x66,0x6c,0x0,0x30,0x7,0xc7,0x1f,0xf0,0x50,0x8b,0xa3,0xa0,0x7f,0xc1,0x62,0x3e,0x1,0xde,0x5b,0x1,0x1d,0xc8,0xb9,0xd5,0x23,0x56,0x51,0xf3,0x61,0xa0,0x87,0x23,0xf1,0x2a,0xbf,0x90,0xaf,0x81,0xe2,0x2e,0x1d,0xc0,0xe2,0x6a,0x2c,0x75,0x5a,0x6b,0xdb,0x53,0x9c,0x64,0xa6,0x95,0xa5,0x75,0x25,0xbb,0x5b,0xab,0x69,0xa9,0xf7,0x3c,0x37,0xc4,0x99,0x86,0x1a,0x12,0xcb,0xa9,0xd4,0x6e,0x8d,0x48,0x4e,0x2e,0xd,0xde,0x36,0x71,0x7b,0x2e,0x8d,0x3d,0x74,0x3e,0x3e,0xff,0x0,0x82,0x79,0xff,0x0,0xc1,0x15,0xb5,0x9f,0xf8,0x29,0x6f,0xc4,0xff,0x0,0x88,0xde,0x2a,
-0xd7,0xbc,0x53,0xa9,0xfc,0x3f,0xf8,0x43,0xe1,0xdf,0x14,0xea,0x1a,0x3d,0xbd,0xc6,0x95,0x4,0x4d,0xab,0x78,0x86,0xe6,0x39,0x59,0xa5,0x16,0xed,0x32,0xbc,0x50,0xc3,0x11,0x75,0x56,0x95,0xa3,0x93,0x73,0x87,0x40,0xa0,0xab,0x38,0xfa,0x3b,0xc4,0xbf,0xf0,0x6a,0x2f,0x84,0xa7,0xf1,0x85,0x8c,0xde,0x1e,0xf8,0xe9,0xe3,0xcf,0xf8,0x44,0xed,0x66,0x75,0xd7,0x34,0xfb,0xb8,0x2c,0x6e,0x75,0x46,0x2,0x16,0x74,0x16,0xf7,0x51,0xc4,0x91,0xc2,0xc5,0x9a,0x2d,0xcb,0x2d,0xbc,0x99,0x46,0x24,0x10,0x76,0x8a,0xfb,0x87,0xfe,0x9,0x1b,0xe1,0x5b,0x5b,0x2f,0xf8,0x26,0x9f,0x82,0x74,0xeb,0x36,0x2a,0x2e,0x64,0xd6,0x66,0x98,0xab,0x72,0xb7,0x33,0x6b,0x17,0xd2,0xcf,0xf8,0x89,0x9e,0x4c,0xfa,0x1a,0xfc,0xc6,0xf8,0xe5,0xf1,0xb7,0xc5,0x9f,0xf0,0x43,0xff,0x0,0xf8,0x2c,0xed,0xd7,0xc4,0x7b,0xc9,0x35,0x7b,0xdf,0x84,0x3f,0x1c,0x27,0xb,0xe3,0x1d,0x3a,0x26,0x92,0x48,0xe4,0x91,0x55,0x12,0x6b,0x84,0x8f,0xa3,0x5d,0x43,0xf2,0xdd,0x46,0x70,0x59,0xe3,0x92,0xf2,0x15,0xc0,0xc1,0x5f,0xd0,0x25,0x99,0x63,0x2b,0xd5,0x6e,0x35,0x1a,0x7d,0x17,0xe8,0x7c,0x2a,0xc2,0xd1,0x84,0x75,0x8a,0xfe,0xba,0x9d,0x57,0xfc,0x13,0xd3,0xe1,0x8c,0x9f,0xb3,0x37,0x81,0x3f,0x6c,0xef,0x82,0xd2,0xea,0x5a,0x96,0xad,0xa6,0xe8,0x10,0xe9,0x7a,0xf6,0x8d,0x3e,0xa3,0xb0,0xdd,0x49,0x13,0x44,0xca,0xc5,0x9a,0x34,0x44,0x62,0x24,0xc,0xb9,0xa,0xbf,0xea,0xfa,0x67,0x24,0xe1,0x21,0xfd,0xd8,0xe9,0xd2,0xbb,0x1f,0x9,0xfc,0x7c,0xf0,0x3f,0xc7,0xcf,0xdb,0x5b,0xe3,0xdf,0x88,0xfe,0x13,0xeb,0xf6,0x7e,0x32,0xf0,0xbe,0xa5,0xf0,0xcf,0xcb,0xd5,0xb5,0xb,0x21,0x2a,0xdb,0xda,0x3c,0x57,0x73,0xb4,0x28,0xdb,0xd5,0x7e,0x67,0x17,0x32,0x1d,0xb8,0xca,0xf9,0x43,0x70,0x5,0x94,0x1e,0x36,0x23,0x94,0xaf,0xe3,0x9f,0xa4,0x5c,0x67,0x2c,0xe3,0xd,0x5a,0x7b,0xba,0x76,0x6d,0xf9,0x49,0x9f,0xd9,0x9f,0x46,0xda,0x8b,0xfb,0x1b,0x15,0x4a,0x3b,0x2a,0xb7,0xfb,0xe2,0xbf,0xc8,0xda,0xf0,0x76,0xa4,0x61,0xbc,0x6b,0x66,0x3f,0xbb,0x90,0x12,0xbe,0xcd,0xff,0x0,0xd7,0xaf,0x69,0xf8,0x2f,0xa4,0x7f,0xc2,0x4b,0xf0,0x9b,0xe3,0xb6,0x95,0xe6,0x32,0x36,0xa5,0xf0,0xdb,0x54,0x84,0x38,0x19,0xdb,0xf2,0xfa,0x57,0x80,0x47,0x23,0x41,0x22,0xc8,0x9c,0x32,0x10,0x41,0xf4,0xaf,0xa3,0x3f,0x64,0xb,0xf8,0x35,0xad,0x3,0xe2,0xa4,0x8e,0xdb,0x77,0x78,0xb,0x52,0x57,0x52,0x79,0x7,0x67,0x35,0xf1,0x1e,0x13,0xe2,0xad,0xc4,0xb8,0x28,0xdf,0x55,0x35,0x6f,0xb9,0x9f,0x71,0xe2,0xf6,0x17,0xfe,0x31,0x9c,0x64,0xfa,0x38,0x6b,0xf7,0xa3,0xf9,0xf5,0xff,0x0,0x82,0x8e,0x7c,0x22,0x7b,0x5f,0x10,0x69,0xbe,0x37,0xb3,0x87,0xfd,0x17,0x54,0x89,0x2c,0x75,0x22,0xa3,0xee,0x4e,0x80,0xf9,0x6e,0xdf,0xef,0xc6,0x2,0xfd,0x62,0xf7,0xaf,0xe8,0x3b,0xfe,0xd,0x6b,0xff,0x0,0x82,0xa5,0x69,0xdf,0xb6,0xa7,0xec,0x35,0xa5,0xfc,0x2f,0xd7,0xf5,0x35,0x7f,0x8a,0x1f,0x6,0x6c,0xe2,0xd2,0x6e,0x61,0x99,0xc0,0x9b,0x54,0xd2,0x13,0xe4,0xb2,0xbb,0x41,0xfc,0x41,0x23,0x9,0x6f,0x27,0xde,0x21,0xa2,0x57,0x62,0x3c,0xe5,0xcf,0xe4,0xef,0x89,0xfc,0x1f,0xa7,0xfc,0x40,0xf0,0x55,0xd6,0x8b,0xab,0xdb,0xad,0xd6,0x9f,0xa9,0x41,0xe4,0xcf,0x19,0xe0,0x91,0xd4,0x30,0x3d,0x99,0x58,0x6,0x7,0xb1,0x0,0xd7,0xc7,0x9e,0xb,0xf1,0xa7,0xc4,0xbf,0xf8,0x24,0xff,0x0,0xed,0x79,0xe1,0xff,0x0,0x1d,0x78,0x2f,0x55,0xb8,0xb3,0xd4,0xb4,0x5b,0x83,0x3e,0x95,0xa8,0x2e,0x56,0xdf,0x56,0xb6,0x38,0x12,0x5b,0xcc,0xbd,0x19,0x59,0x4e,0xd9,0x23,0x3d,0x32,0x8,0xfe,0x16,0xaf,0xf4,0x1f,0x88,0x32,0xd9,0x53,0xab,0xf5,0x98,0x7c,0x32,0xdf,0xc9,0xff,0x0,0xc1,0x3f,0xcf,0x5c,0xbf,0x14,0xa5,0x5,0x4a,0x5b,0xaf,0xc8,0xfe,0xda,0x41,0xc8,0xa2,0xbe,0x5e,0xff,0x0,0x82,0x53,0xff,0x0,0xc1,0x53,0xbc,0x3,0xff,0x0,0x5,0x57,0xfd,0x9b,0xad,0x7c,0x65,0xe1,0x2b,0x98,0x6c,0x7c,0x43,0xa7,0xa4,0x56,0xfe,0x26,0xf0,0xec,0x93,0x6,0xba,0xd0,0x6e,0xd9,0x4f,0xca,0xc3,0xab,0x42,0xe5,0x5c,0xc7,0x26,0x0,0x75,0x53,0xd1,0x95,0x94,0x7d,0x3a,0x24,0x6d,0xbf,0x32,0xfe,0x46,0xbe,0x74,0xf4,0x89,0x28,0xa4,0x56,0xdc,0xb9,0xa5,0x2d,0xb6,0x80,0xa,0xfc,0xd5,0xff,0x0,0x83,0xad,0xbf,0x6a,0x6b,0x5f,0xd9,0xeb,0xfe,0x9,0x25,0xe2,0x8f,0xe,0xa5,0xc4,0x31,0xeb,0x9f,0x15,0xaf,0xed,0x7c,0x33,0x63,0x13,0x64,0xbb,0x45,0xe6,0xb,0x8b,0xa7,0x3,0xd0,0x43,0xb,0x29,0x27,0xa1,0x95,0x7b,0x91,0x5f,0xa0,0x1f,0x1a,0x7e,0x36,0xf8,0x47,0xf6,0x76,0xf8,0x5d,0xac,0xf8,0xd3,0xc7,0x3e,0x22,0xd2,0xfc,0x2b,0xe1,0x5f,0xf,0xc0,0x6e,0x75,0xd,0x4f,0x50,0x9c,0x43,0x5,0xba,0xe,0x7,0x27,0x92,0xcc,0x48,0x55,0x45,0xcb,0x33,0x32,0xaa,0x82,0xc4,0x3,0xfc,0x9d,0xff,0x0,0xc1,0x6b,0x7f,0xe0,0xa5,0xfe,0x22,0xff,0x0,0x82,0xe1,0xfe,0xdf,0x9a,0x6,0x8f,0xf0,0xeb,0x4b,0xd6,0xaf,0x3c,0x21,0xa5,0xce,0x9e,0x19,0xf0,0x6,0x84,0x53,0x17,0x5a,0x9d,0xc5,0xc4,0xaa,0xaf,0x76,0xd1,0x67,0xb,0x2d,0xcc,0x9e,0x58,0x0,0xfd,0xd8,0xe3,0x88,0x1c,0x10,0xc6,0x81,0xa3,0xef,0x2f,0xf8,0x32,0x33,0xf6,0x7b,0xb9,0xf3,0xbe,0x3b,0x7c,0x55,0xba,0xb5,0x65,0xb5,0x75,0xd3,0xbc,0x29,0xa6,0xdc,0x95,0x18,0x91,0xc7,0x99,0x75,0x78,0x80,0xff,0x0,0xb3,0x9b,0x22,0x47,0x7d,0xe3,0xd2,0x8a,0xfd,0x70,0xff,0x0,0x82,0x51,0x7e,0xc0,0xda,0x6f,0xfc,0x13,0x53,0xf6,0x15,0xf0,0x3f,0xc2,0x9b,0x36,0xb7,0xb8,0xd5,0x34,0xbb,0x5f,0xb6,0x78,0x82,0xfa,0x1f,0xbb,0xa9,0x6a,0xb3,0xe2,0x4b,0xa9,0x41,0xc0,0x25,0x3,0x9f,0x2d,0x32,0x32,0x22,0x8a,0x30,0x79,0x14,0x50,0x23,0xe8,0xb6,0x38,0x15,0xfc,0xde,0x7f,0xc1,0xc6,
-0x5f,0xf0,0x6e,0xc7,0x8b,0x3e,0x18,0xfc,0x58,0xf1,0x17,0xc7,0x5f,0x81,0xbe,0x1d,0xba,0xf1,0x17,0x81,0xfc,0x45,0x33,0x6a,0x3e,0x22,0xf0,0xf6,0x99,0x6e,0x65,0xbc,0xd0,0x2e,0x5b,0x2d,0x2c,0xf1,0x44,0xa3,0x74,0x96,0xce,0xd9,0x73,0xb4,0x13,0x19,0x2d,0x9f,0x97,0x9a,0xfe,0x91,0x29,0x19,0x77,0x50,0xc6,0x9d,0x8f,0xe4,0x9f,0xfe,0x9,0x3d,0xff,0x0,0x7,0x22,0x7c,0x6a,0xff,0x0,0x82,0x68,0xdd,0x69,0xfe,0x11,0xf1,0x14,0x97,0x9f,0x14,0xbe,0x13,0x69,0xe8,0xb6,0x4b,0xe1,0x9d,0x5a,0xe8,0xc7,0x79,0xa1,0xc6,0xbf,0x28,0xfb,0xd,0xd3,0x2b,0x3c,0x41,0x30,0x0,0x81,0xc3,0x45,0xb5,0x4a,0xaa,0xc6,0x4e,0xf1,0xfb,0x81,0xfb,0x3b,0xff,0x0,0xc1,0xd4,0x5f,0xb1,0xc7,0xc7,0x7b,0x1b,0x35,0xd4,0x3c,0x79,0xaa,0x7c,0x39,0xd5,0x6e,0x50,0x33,0x58,0x78,0xab,0x46,0xb8,0x83,0xca,0x38,0xe4,0x1b,0x88,0x56,0x5b,0x71,0x8e,0xc4,0xca,0x33,0xc7,0x7e,0x2b,0xa8,0xff,0x0,0x82,0x8a,0x7f,0xc1,0xba,0x9f,0xb3,0x8f,0xfc,0x14,0x46,0xf2,0xef,0x5c,0xd4,0x3c,0x3b,0x2f,0x80,0xbc,0x75,0x75,0x96,0x6f,0x11,0x78,0x5f,0x65,0xa4,0x97,0x2e,0x7b,0xdc,0x40,0x41,0x86,0x6e,0x79,0x2c,0x54,0x39,0xfe,0xfd,0x7e,0x67,0xfc,0x43,0xff,0x0,0x83,0x22,0xbc,0x65,0x67,0x2d,0xc3,0x78,0x53,0xe3,0xc7,0x86,0xef,0x90,0x13,0xe4,0x26,0xad,0xa0,0xcd,0x6a,0xc4,0x76,0xdc,0x63,0x92,0x4f,0xd0,0x54,0xea,0x3d,0xf,0x38,0xff,0x0,0x83,0x82,0xff,0x0,0xe0,0xbf,0x5a,0xb7,0xfc,0x14,0x23,0xc7,0x73,0x7c,0x0,0xf8,0x11,0xa8,0xb0,0xf8,0x53,0x25,0xd4,0x56,0x9a,0x86,0xaf,0x6b,0x23,0x45,0x27,0x8d,0x67,0x25,0x48,0x8f,0x2c,0x14,0xa5,0x9a,0x3f,0xf0,0x9f,0xf5,0x8c,0x9b,0x8f,0xca,0x0,0x3e,0x7,0xfb,0x37,0x7e,0xca,0xba,0x57,0xec,0xfd,0xa0,0x99,0xb2,0xba,0x87,0x89,0xaf,0x21,0x31,0xdd,0x6a,0x1b,0x38,0x8b,0x3d,0x63,0x84,0x11,0xf2,0xa0,0xee,0x4f,0x2d,0x8e,0x70,0x3e,0x51,0xe6,0x3f,0xb7,0xe7,0xfc,0x12,0x23,0xe3,0xa7,0xfc,0x11,0xf7,0xe2,0x6e,0x93,0xa9,0x7c,0x42,0xf0,0xed,0xae,0xaf,0xe1,0x83,0x72,0xbf,0xd9,0xfe,0x27,0xd1,0xa5,0x7b,0x8d,0x1e,0xf9,0xf1,0xcc,0x46,0x42,0xaa,0xf0,0xcb,0xd7,0x9,0x2a,0x29,0x38,0xca,0x86,0x1c,0xd1,0xf0,0xef,0xe2,0xa5,0xbf,0x8e,0x74,0x5f,0xb5,0x69,0x37,0xf7,0x51,0x85,0x1,0x66,0xb7,0xf3,0x59,0x24,0x80,0x9e,0xcc,0x1,0xe8,0x7b,0x1e,0x87,0xf4,0xaf,0xab,0xe1,0x9a,0x78,0x77,0x37,0x29,0xfc,0x6b,0x6f,0x4e,0xeb,0xcc,0xf2,0x73,0x49,0x54,0x49,0x28,0xfc,0x3d,0x4f,0xd4,0xef,0x8d,0x1f,0xf0,0x5a,0x2f,0x16,0xf,0xd9,0xef,0x45,0xf8,0x69,0xe0,0x7d,0x27,0x45,0xf8,0x45,0xe1,0x9d,0x37,0x4c,0x8b,0x4e,0xb8,0x3a,0x3c,0xed,0x2e,0xa5,0x77,0xb5,0x0,0x7f,0x2a,0x40,0xa9,0xe4,0xac,0x87,0x73,0x31,0x55,0x32,0x12,0xd9,0xf3,0x79,0x24,0xfc,0x23,0xe2,0x2f,0x89,0x73,0xdf,0x6e,0x87,0x4f,0x57,0xb4,0x84,0xe7,0x2e,0x4f,0xef,0x1f,0x3d,0x4f,0xb7,0xea,0x6b,0xcd,0xd6,0xf2,0x65,0x93,0x3e,0x6c,0x85,0x8f,0x39,0x2d,0x9a,0xd3,0xd2,0x75,0x4f,0xb5,0x8d,0xaf,0xc4,0x83,0xbf,0xad,0x7d,0x9e,0xf,0xb,0x42,0x8d,0xd5,0x38,0xda,0xff,0x0,0x8b,0xfd,0x4f,0x12,0xb5,0x6a,0x93,0xf8,0x99,0x7c,0x92,0xee,0xcc,0x59,0x8b,0x31,0xc9,0x27,0xa9,0xa2,0x81,0x45,0x7a,0x7,0x31,0xfa,0x4b,0xff,0x0,0x4,0xdf,0x6f,0x27,0xfe,0x8,0xfb,0xf1,0x3,0x1f,0xf2,0xd3,0xe2,0xaa,0x2b,0x67,0xfe,0xc1,0xd6,0x9d,0x2b,0x86,0xfd,0xa2,0x59,0xa3,0xf8,0x23,0xe2,0x86,0x5f,0xbc,0xb6,0x2e,0x54,0x7b,0xf1,0x8a,0xee,0x3f,0xe0,0x9c,0xff,0x0,0xe8,0xdf,0xf0,0x47,0xef,0x1c,0x6e,0xe9,0x73,0xf1,0x5d,0x16,0x3c,0xf6,0xc6,0x9d,0x6b,0x9c,0x7e,0x46,0xb9,0xbf,0x8a,0xda,0x3f,0xf6,0xff,0x0,0xc3,0x6d,0x6a,0xd3,0x9f,0xdf,0x5a,0xb0,0xe3,0xe8,0xf,0xf4,0xaf,0xf3,0xab,0xe9,0x3,0x51,0x43,0x8f,0xd4,0xe5,0xb2,0x54,0xff,0x0,0x33,0xfb,0xeb,0xc0,0xa,0x72,0x9f,0x2,0x54,0x84,0x77,0x72,0xa8,0x97,0xfe,0x2,0x8f,0xdb,0x5f,0xd9,0x4a,0x35,0x8b,0xf6,0x5e,0xf8,0x6c,0xa9,0xc2,0xaf,0x85,0x74,0xb0,0x0,0x18,0xc0,0xfb,0x24,0x55,0xf9,0xa9,0xff,0x0,0x7,0x5a,0xff,0x0,0xc9,0xa8,0xdb,0xff,0x0,0xd8,0x47,0x4a,0xff,0x0,0xd3,0x84,0x15,0xf7,0xb7,0xfc,0x13,0x17,0xe2,0x1a,0x7c,0x53,0xff,0x0,0x82,0x76,0x7c,0xf,0xd6,0xbc,0xf5,0xb8,0xba,0x9f,0xc1,0x1a,0x55,0xbd,0xf3,0xc,0xfc,0x97,0x90,0x5a,0xc7,0x5,0xd4,0x67,0xdd,0x27,0x8e,0x54,0x3e,0xea,0x6b,0xe0,0x9f,0xf8,0x3a,0xd7,0xfe,0x4d,0x46,0xdf,0xfe,0xc2,0x3a,0x57,0xfe,0x9c,0x20,0xaf,0xea,0xdc,0x1c,0x94,0xaa,0x53,0x6b,0x6b,0xaf,0xcd,0x1f,0xc7,0xd8,0x88,0xb8,0xb9,0x46,0x5b,0xab,0x9e,0xff,0x0,0xff,0x0,0x6,0xd7,0xff,0x0,0xca,0x17,0xbe,0x11,0x7f,0xd7,0xef,0x89,0xbf,0xf5,0x24,0xd5,0x2b,0xa7,0xff,0x0,0x82,0xe3,0xdb,0xc7,0x71,0xff,0x0,0x4,0xf7,0xf1,0xf8,0x93,0x0,0x1d,0x13,0x50,0xeb,0xff,0x0,0x5e,0xb2,0xd7,0x31,0xff,0x0,0x6,0xd7,0x9c,0x7f,0xc1,0x17,0xfe,0x11,0x7f,0xd7,0xef,0x89,0xbf,0xf5,0x24,0xd5,0x2a,0xbf,0xfc,0x1c,0x1d,0xe3,0xa8,0xfc,0x37,0xfb,0x6,0x78,0xa3,0x4e,0xf3,0x36,0xdc,0xeb,0x56,0x33,0x69,0xb0,0x28,0xea,0xd2,0xdc,0xaf,0xd9,0xa2,0x0,0x7b,0xc9,0x32,0xd4,0x62,0x2a,0x28,0x39,0x4e,0x5b,0x2b,0xb6,0x3c,0x35,0x39,0x54,0x71,0x84,0x77,0x76,0x4b,0xd4,0xf9,0xc3,0xfe,0x8,0x27,0x7f,0x25,0xd7,0xed,0x7d,0x62,0xb2,0x2,0xc,0x7f,0xe,0x35,0x62,0x1,0xed,0x9b,0xed,0xf,0xfc,0x2b,0xee,0xff,0x0,0xf8,0x2a,0xa7,0x1f,0xb2,0x7,0x89,0xbf,0xeb,0xce,0x6f,0xfd,0x14,0xd5,0xf0,0xd7,0xfc,0x10,0xe3,0x4f,0x3a,0x47,0xed,0xdc,0x2d,0x5b,0xef,0x45,0xf0,0xd3,0x52,0xcf,0xb6,0x6f,0xb4,0x4f,0xf3,0xf8,0x57,0xdc,0xbf,
-0xf0,0x55,0x53,0xff,0x0,0x18,0x81,0xe2,0x6f,0xfa,0xf3,0x9b,0xff,0x0,0x45,0x35,0x7c,0x4f,0x87,0x55,0x14,0xf8,0x7f,0xd,0x25,0xda,0x5f,0xfa,0x54,0x8f,0xba,0xf1,0x32,0x9b,0xa7,0xc4,0x98,0x98,0xbd,0xef,0x1f,0xfd,0x22,0x27,0xe7,0xc7,0xfc,0x19,0xb1,0xff,0x0,0x26,0xf3,0xf1,0xa3,0xfe,0xc3,0x7a,0x47,0xfe,0x90,0x57,0xbe,0x7f,0xc1,0xc7,0x9f,0xf2,0x6a,0xb6,0x7f,0xf6,0x16,0xd3,0x3f,0xf4,0xe5,0x69,0x5e,0x7,0xff,0x0,0x6,0x6c,0x7f,0xc9,0xbc,0xfc,0x68,0xff,0x0,0xb0,0xde,0x91,0xff,0x0,0xa4,0x15,0xef,0x9f,0xf0,0x71,0xe7,0xfc,0x9a,0xad,0x9f,0xfd,0x85,0xb4,0xcf,0xfd,0x39,0x5a,0x57,0xda,0x67,0x9f,0xd,0x7f,0x49,0x7e,0x47,0xc6,0xe4,0x9f,0xef,0x34,0x3f,0xc5,0x1f,0xcd,0x1e,0x6b,0xff,0x0,0x4,0x29,0xff,0x0,0x93,0xfa,0xf8,0x8d,0xff,0x0,0x64,0xfb,0x4e,0xff,0x0,0xd2,0xb3,0x5f,0x51,0xff,0x0,0xc1,0x71,0xf,0xfc,0x60,0x1f,0x8f,0xff,0x0,0xec,0x1,0xa9,0x7f,0xe9,0x14,0xf5,0xf2,0xef,0xfc,0x10,0xaf,0x8f,0xdb,0xef,0xe2,0x3f,0xfd,0x93,0xed,0x3b,0xff,0x0,0x4a,0xcd,0x7d,0x45,0xff,0x0,0x5,0xc4,0xff,0x0,0x93,0x3,0xf1,0xff,0x0,0xfd,0x80,0x35,0x2f,0xfd,0x22,0x9e,0xbe,0x1f,0xc3,0x5f,0xf9,0x26,0xb0,0x9f,0xe1,0xfd,0x59,0xf6,0xfe,0x29,0x7f,0xc9,0x53,0x8b,0xff,0x0,0x12,0xff,0x0,0xd2,0x51,0xf3,0x97,0xfc,0x1a,0x2f,0xff,0x0,0x28,0xf6,0xf8,0x99,0xff,0x0,0x65,0x52,0xf3,0xff,0x0,0x4c,0xba,0x2d,0x63,0x7f,0xc1,0xd6,0x7,0xfe,0x31,0x42,0x3f,0xfb,0x8,0xe9,0x5f,0xfa,0x70,0x86,0xb6,0x7f,0xe0,0xd1,0x7f,0xf9,0x47,0xb7,0xc4,0xcf,0xfb,0x2a,0x97,0x9f,0xfa,0x65,0xd1,0x6b,0x17,0xfe,0xe,0xb2,0x38,0xfd,0x93,0xe3,0xff,0x0,0xb0,0x8e,0x97,0xff,0x0,0xa5,0xf0,0xd7,0xe9,0x55,0x3f,0xdf,0x5f,0xf8,0xbf,0x53,0xf3,0x48,0x7f,0x1,0x7a,0x7e,0x87,0xd3,0xff,0x0,0xf0,0x6f,0x87,0xfc,0xa1,0xdb,0xe0,0xaf,0xfd,0x79,0x6a,0x3f,0xfa,0x75,0xbb,0xaf,0x9d,0xbf,0xe0,0xa2,0x52,0x88,0xbf,0xe0,0xb1,0xff,0x0,0xb3,0x96,0xe1,0xb9,0x24,0xd6,0xee,0x23,0x61,0xea,0x1b,0xec,0xea,0x7f,0xf4,0x2a,0xfa,0x2b,0xfe,0xd,0xf3,0x1b,0x7f,0xe0,0x8f,0x3f,0x5,0x47,0xa5,0x9e,0xa4,0x3f,0xf2,0xad,0x79,0x5f,0x3b,0x7f,0xc1,0x43,0xa0,0x37,0x3f,0xf0,0x59,0x7f,0xd9,0xb6,0x35,0xfb,0xcd,0xaf,0x4d,0xfa,0x1b,0x63,0x5f,0x3d,0xc4,0x17,0xfa,0xad,0x6b,0x6f,0xff,0x0,0x4,0xfa,0xe,0x1e,0xb7,0xd7,0x69,0x5f,0x6d,0x7f,0x26,0x7b,0x6f,0xfc,0x11,0xc3,0xe3,0xc5,0x95,0x8f,0x8e,0x7f,0x68,0x4f,0xd9,0xf6,0xea,0xe1,0x17,0x5c,0xf8,0x33,0xf1,0xb,0x53,0xbb,0xb0,0x83,0x1,0x7c,0xfd,0x23,0x53,0xb9,0x92,0xf1,0x25,0x5e,0x72,0xc5,0x6e,0xe4,0xbd,0x56,0xe3,0xe5,0x6,0x1e,0x7e,0x70,0x6,0xd7,0xfc,0x16,0x97,0xf6,0x2,0xb0,0xfd,0xb8,0x3f,0x65,0x4d,0x62,0xc2,0x35,0x8e,0xdf,0x5c,0xd3,0xc0,0xbd,0xd3,0x6f,0x36,0x6e,0x36,0x57,0x51,0x6e,0x31,0x4d,0x8e,0xa4,0x2,0x4a,0xb0,0x1c,0xb4,0x72,0x48,0xbf,0xc5,0x5f,0x93,0x3f,0x1d,0xff,0x0,0x6c,0xdd,0x4b,0xfe,0x9,0xfb,0xff,0x0,0x5,0xe7,0xf8,0x87,0xf1,0x7b,0x4a,0x4b,0x8b,0xbd,0x37,0x49,0xf1,0x75,0xde,0x95,0xe2,0x8d,0x36,0x3,0x97,0xd5,0xb4,0x69,0xbc,0xa5,0xba,0x8c,0x2e,0x46,0xe9,0x13,0x6a,0x4f,0x10,0xc8,0x6,0x6b,0x78,0xb2,0x76,0xee,0x7,0xfa,0x14,0xf0,0xa7,0x8a,0xf4,0x3f,0x8c,0x9f,0xe,0x34,0xbd,0x73,0x43,0xbe,0xb6,0xd6,0x3c,0x3b,0xe2,0x8d,0x36,0x1d,0x47,0x4e,0xbc,0x80,0xee,0x86,0xfa,0xd6,0x78,0xd6,0x48,0xa6,0x43,0xdd,0x5d,0x19,0x58,0x1f,0x43,0x5f,0x43,0x8e,0xc2,0x4f,0xd,0x52,0x32,0x5b,0x34,0x9a,0x7f,0x24,0xff,0x0,0x33,0xc1,0xc3,0xd6,0x55,0x62,0xd7,0x67,0x63,0xf0,0x47,0xfe,0x8,0x45,0x73,0x73,0x1f,0xc2,0xef,0xda,0xbf,0x47,0xd5,0xac,0x5b,0x4e,0xd5,0xb4,0x9f,0x8,0x25,0xa6,0xa9,0x62,0xca,0x3c,0xdb,0x7b,0xa8,0x6e,0x26,0x8e,0x44,0x3c,0x73,0xb5,0x94,0x8c,0xf4,0x38,0xcf,0x4c,0x57,0x71,0x9,0xdd,0x12,0x9f,0x55,0xcd,0x7a,0x2e,0xb9,0xf0,0xba,0xd7,0xf6,0x4f,0xff,0x0,0x82,0x88,0xfe,0xd0,0xd6,0x76,0x91,0x8b,0x5d,0x3b,0xe2,0xe7,0xc3,0x4b,0x89,0xb6,0x20,0xeb,0x77,0x63,0x3c,0x69,0x23,0x8e,0x72,0x9,0x8e,0xe2,0xd0,0x74,0xc1,0x3b,0x8f,0x52,0x4d,0x79,0xd5,0xb2,0x6d,0x89,0x7f,0xf,0xe5,0x5f,0xcb,0x9f,0x49,0x8c,0x42,0xc4,0x62,0x70,0x35,0xde,0xee,0x33,0x4f,0xe5,0xc9,0xff,0x0,0x4,0xfe,0xb0,0xfa,0x31,0xc1,0xd3,0xc2,0xe3,0xa9,0xf4,0xe6,0x85,0xbe,0x6a,0x44,0xc7,0xee,0xd7,0xb0,0x7e,0xc8,0xfe,0x2d,0x87,0xc0,0x1e,0x13,0xf8,0xdd,0xe2,0xb,0xa8,0xd6,0x6b,0x5d,0xf,0xe1,0xb6,0xa9,0x7b,0x2c,0x6f,0xf7,0x5c,0x2a,0xf4,0x35,0xe3,0xcd,0xd2,0xbb,0x9f,0x0,0x66,0x1f,0xd9,0x5f,0xf6,0xa0,0x9b,0xa2,0xaf,0xc2,0x6d,0x56,0x3c,0xfb,0xb2,0xe0,0xa,0xfc,0x87,0xc2,0x2a,0x6a,0xa7,0x17,0xe0,0x22,0xff,0x0,0xe7,0xe2,0xfc,0x99,0xfb,0x7,0x8b,0xd5,0x39,0x38,0x3b,0x1f,0x25,0xfc,0x9f,0xfb,0x74,0x4f,0xcf,0x5f,0x9,0xf8,0xaa,0xcf,0x5f,0xb1,0x8c,0x45,0x20,0x59,0x95,0x46,0xe8,0x9c,0xe1,0xc7,0x1f,0xaf,0xd4,0x54,0x5f,0x12,0xbe,0x1a,0xe8,0xdf,0x16,0xbc,0x1f,0x73,0xa1,0xeb,0xb6,0xbf,0x6a,0xb1,0xb8,0xf9,0x81,0x53,0xb6,0x4b,0x79,0x6,0x76,0xcb,0x1b,0x73,0xb5,0xd7,0x27,0x7,0xd0,0x90,0x41,0x4,0x83,0xe6,0x11,0x3b,0x44,0xc1,0x91,0x99,0x59,0x79,0xc,0xa7,0x91,0xf4,0x35,0xa7,0x67,0xf1,0x72,0xff,0x0,0x47,0xf9,0x3e,0xd0,0xb7,0x6a,0xbc,0x6d,0x75,0xdd,0x8f,0xc7,0x83,0xfa,0xd7,0xfa,0xa5,0x5b,0xf,0x19,0x45,0xc1,0xed,0xd9,0x9f,0xe6,0x2d,0x3a,0x8e,0xf7,0x47,0x84,0x68,0x67,0xe3,0x1f,0xfc,0x12,0xbf,0xe3,0xa6,0x9f,0xf1,0x23,0xe1,0xaf,0x89,0xb5,0x3d,0xe,0xeb,0x4f,0x90,
-0xc5,0x67,0xaf,0x69,0xf8,0xf2,0xe5,0x8d,0x88,0x26,0xda,0xf2,0x16,0xdc,0x8c,0x8f,0xb5,0x73,0x1c,0xa1,0xa3,0x72,0xa3,0x19,0x2b,0xc7,0xee,0xc7,0xfc,0x13,0x1f,0xfe,0xe,0xe9,0xf8,0x4b,0xfb,0x44,0x68,0xda,0x6f,0x86,0xbe,0x3f,0x5b,0xdb,0xfc,0x23,0xf1,0xd3,0x32,0xdb,0xb6,0xaf,0xa,0x49,0x2f,0x86,0x75,0x27,0x23,0x1b,0xfc,0xcf,0x9a,0x4b,0x32,0x5b,0x39,0x59,0xb7,0x46,0xa0,0x3,0xe7,0x1c,0x90,0xbf,0x93,0x7e,0x27,0xfd,0xa2,0x2c,0x6c,0xfc,0x35,0x78,0xda,0xd6,0x9b,0x63,0x26,0x97,0xe5,0x15,0xba,0x17,0x24,0x34,0x32,0x21,0xea,0xa5,0x8,0x3b,0xb3,0xfd,0xde,0xfd,0x3a,0xd7,0xc7,0xff,0x0,0x6,0xbf,0x67,0x6f,0x17,0xfe,0xd9,0x3f,0x1f,0x93,0xc1,0xbf,0x8,0xfc,0x17,0xab,0x78,0x83,0x5a,0xd7,0xee,0xe4,0x3a,0x6e,0x8f,0x66,0x37,0xb5,0xb4,0x25,0x89,0x1e,0x64,0x8e,0xdb,0x63,0x8d,0x14,0x8d,0xd2,0x48,0xe1,0x54,0xc,0xb3,0x77,0xaf,0xce,0x73,0xcc,0xb6,0x9e,0x16,0x69,0xd2,0x96,0x8f,0xa7,0x55,0xff,0x0,0x0,0xfa,0x5c,0xe,0x26,0x55,0xa3,0xef,0xad,0xba,0x9f,0xd9,0x4,0xdf,0xf0,0x57,0x6f,0xd9,0x56,0xd7,0x4c,0x92,0xe9,0xbf,0x69,0x3f,0x81,0x1e,0x4c,0x6a,0x5c,0xaa,0x78,0xef,0x4c,0x69,0x30,0x3d,0x23,0x13,0x17,0x27,0xd8,0x29,0x26,0xbe,0x1a,0xfd,0xb8,0x3f,0xe0,0xf0,0xf,0xd9,0xef,0xe0,0x2d,0xae,0xa1,0xa5,0xfc,0x28,0xd3,0x75,0xcf,0x8c,0xde,0x25,0xb7,0x63,0x14,0x53,0xc0,0x8d,0xa5,0x68,0x6a,0xe0,0xe0,0x96,0xb9,0x99,0x7c,0xd9,0x2,0xf5,0x1e,0x54,0x2c,0xae,0x7,0xe,0x1,0xd,0x5f,0x9e,0x1f,0x6,0xff,0x0,0xe0,0xcc,0xcf,0xda,0x63,0xc6,0xd2,0xda,0xcd,0xe2,0xef,0x16,0xfc,0x2b,0xf0,0x3d,0x9c,0xca,0xad,0x3a,0x7d,0xbe,0xe7,0x52,0xbd,0xb7,0xce,0x32,0xbe,0x5c,0x50,0x88,0x99,0x87,0xb4,0xd8,0x24,0x75,0xef,0x5f,0x7d,0x7e,0xc9,0xdf,0xf0,0x66,0x97,0xc0,0x1f,0x84,0xd7,0x56,0xba,0x87,0xc5,0x2f,0x17,0x78,0xc3,0xe2,0xd5,0xe4,0x18,0x2f,0x62,0x8c,0x34,0x2d,0x26,0x5e,0x39,0xd,0x1c,0x2c,0xd7,0x7,0x9e,0xe2,0xe1,0x7d,0xc5,0x78,0x67,0x76,0x87,0xe4,0x2f,0x8c,0x7e,0x25,0x7e,0xd8,0x7f,0xf0,0x72,0xcf,0xed,0x3f,0xe,0x9f,0xd,0xbd,0xf7,0x8a,0x23,0xd3,0xe5,0x57,0x87,0x4b,0xd3,0x96,0x4b,0xf,0x8,0xf8,0x2e,0x27,0xdc,0x3c,0xd7,0xdc,0xcc,0x91,0x12,0x37,0xfe,0xf2,0x56,0x92,0xe2,0x40,0xbb,0x41,0x7d,0xaa,0xa3,0xf7,0xbb,0xfe,0x8,0xb7,0xff,0x0,0x6,0xf3,0x7c,0x37,0xff,0x0,0x82,0x53,0x59,0xc3,0xe2,0xfd,0x5a,0xe2,0xf,0x88,0x1f,0x1a,0x2e,0x2d,0xda,0x19,0xfc,0x47,0x35,0xbe,0xcb,0x5d,0x11,0x64,0x4,0x49,0xe,0x9d,0x13,0x64,0xc6,0xa,0x92,0x8d,0x3b,0x1f,0x36,0x45,0xdc,0x3f,0x76,0x92,0x34,0x55,0xf6,0xe7,0xc0,0x8f,0xd9,0xdb,0xc0,0xbf,0xb3,0x7,0xc3,0xcb,0x4f,0x9,0xfc,0x3b,0xf0,0x9f,0x87,0xfc,0x17,0xe1,0xbb,0x2e,0x63,0xd3,0xf4,0x8b,0x24,0xb5,0x84,0xb6,0x0,0x2e,0xc1,0x46,0x5e,0x43,0x81,0x97,0x62,0x59,0xbb,0x92,0x6b,0xb4,0xa0,0x41,0x45,0x14,0x50,0x1,0x45,0x14,0x50,0x1,0x46,0x28,0xa2,0x80,0x39,0xaf,0x8b,0x9f,0x8,0x3c,0x2f,0xf1,0xe7,0xe1,0xde,0xad,0xe1,0x1f,0x1a,0x78,0x7f,0x48,0xf1,0x47,0x85,0xf5,0xc8,0xd,0xbd,0xfe,0x99,0xa9,0xdb,0x2d,0xc5,0xb5,0xd2,0x70,0x7e,0x64,0x60,0x46,0x41,0x0,0x82,0x39,0x52,0x1,0x4,0x10,0xd,0x7f,0x30,0x5f,0xf0,0x5c,0xdf,0xf8,0x21,0x4f,0x8a,0x3f,0xe0,0x91,0x3f,0x10,0x9b,0xe2,0xbf,0xc2,0xb6,0xbe,0xd6,0xbe,0x8,0x6a,0xd7,0x82,0x1c,0x48,0x5a,0x6b,0x8f,0xb,0x49,0x23,0x7c,0xb6,0x77,0x67,0xac,0x96,0xec,0x7e,0x58,0xa7,0x3c,0xe7,0x6a,0x39,0xf,0xb1,0xa4,0xfe,0xa8,0x8f,0x35,0x89,0xf1,0x1b,0xe1,0xde,0x87,0xf1,0x6b,0xc0,0x9a,0xc7,0x85,0xfc,0x4d,0xa5,0x59,0x6b,0x9e,0x1e,0xf1,0x5,0x9c,0xb6,0x1a,0x8e,0x9f,0x79,0x10,0x96,0xde,0xf2,0x9,0x14,0xab,0xc6,0xea,0x78,0x20,0xa9,0x35,0x50,0x9c,0xa1,0x25,0x28,0xbb,0x34,0x29,0x24,0xd5,0x9e,0xc7,0xf1,0xbb,0xf0,0xf3,0xe2,0xd,0x8f,0xc4,0x8f,0xe,0xad,0xf5,0x97,0xee,0xe4,0x42,0x12,0xe2,0x6,0x39,0x7b,0x77,0x3d,0x8f,0xa8,0x3d,0x8f,0x71,0xee,0x8,0xad,0xf8,0x9c,0xa3,0x6e,0x56,0xda,0x46,0x31,0x8a,0x9f,0xfe,0xa,0xd5,0xff,0x0,0x4,0xf9,0xd6,0xff,0x0,0xe0,0x8c,0xff,0x0,0xf0,0x50,0x4b,0xef,0xc,0xda,0x35,0xd5,0xdf,0x80,0xf5,0xe5,0x3a,0xb7,0x86,0x6f,0x64,0x57,0xdb,0x7b,0xa5,0xc9,0x21,0xd,0x6c,0xee,0x78,0x69,0xa0,0x61,0xb1,0xb0,0x49,0xe2,0x37,0x38,0xf3,0x0,0xaa,0x96,0xb7,0x31,0xdd,0x5a,0xc7,0x34,0x2f,0xe6,0x45,0x32,0x7,0x46,0x1f,0xc4,0xf,0x20,0xd7,0xe8,0x79,0x3e,0x69,0xf5,0xba,0x76,0x97,0xc5,0x1d,0xfc,0xfc,0xcf,0x9c,0xc7,0x61,0x7d,0x8c,0xaf,0x1d,0x99,0xbd,0xa5,0xea,0x3f,0x6c,0x87,0xe6,0xfb,0xeb,0xd7,0xdf,0xde,0xad,0xb7,0x4a,0xe7,0xb4,0xf9,0xfe,0xc7,0x72,0x8d,0xf8,0x37,0xd2,0xba,0x0,0x77,0x2f,0xe1,0x5f,0x47,0x4e,0x5c,0xd1,0x3c,0xd9,0x46,0xc7,0xe9,0xa7,0xec,0x5d,0xa6,0x7f,0x62,0xff,0x0,0xc1,0x19,0x34,0xf9,0xb9,0x7,0x5b,0xf8,0x9d,0x73,0x73,0xcf,0x71,0x1d,0xaa,0xc5,0xc7,0xfd,0xf1,0x59,0x72,0xc4,0xb7,0x11,0xb2,0x30,0xdc,0x8c,0xa4,0x30,0x23,0xa8,0x3d,0x6b,0xa4,0xfd,0x9f,0x23,0x6b,0x4f,0xf8,0x23,0x9f,0xc1,0x54,0x5f,0xb9,0x7b,0xe2,0x6d,0x76,0x79,0x3e,0xab,0x72,0xe8,0x3f,0x41,0x5c,0xeb,0x1c,0x2e,0x7f,0x1f,0xa5,0x7f,0x9a,0xff,0x0,0x48,0xaa,0xbc,0xdc,0x6b,0x5a,0xdd,0x23,0x15,0xf9,0x9f,0xe8,0x97,0xd1,0xde,0x97,0x2f,0x6,0xd2,0xbf,0xda,0x9c,0xdf,0xe2,0x97,0xe8,0x7d,0xc9,0xff,0x0,0x4,0x4d,0xf8,0x81,0x27,0xc3,0x9f,0x5,0x6a,0x9f,0x5,0x35,0x89,0x8c,0x77,0x7a,0x6d,0xb0,0xf1,0xa7,0x86,0x56,0x46,0x3,0xed,0x7a,0x4d,0xfc,0xa4,0xdc,0xaa,0x77,0x63,0x5,0xf1,
-0x91,0x9c,0x8e,0x15,0x6f,0xed,0x87,0x7a,0xf0,0x6f,0xf8,0x3a,0xc6,0x26,0x6f,0xd9,0x2a,0x19,0x2,0xb1,0x54,0xd4,0x74,0xbd,0xc7,0x1c,0xf,0xf8,0x98,0xc1,0xff,0x0,0xd6,0xaf,0x6,0xff,0x0,0x82,0xaa,0x7c,0x68,0xf1,0x67,0xec,0xbb,0xe2,0x6f,0xd8,0xff,0x0,0xe2,0x7,0xc3,0xad,0x4a,0x3d,0x17,0xc6,0xde,0x15,0xf0,0x6c,0x97,0x90,0x4d,0x24,0x66,0x4b,0x7b,0xe8,0xa4,0x91,0x56,0x4b,0x5b,0x94,0x5,0x7c,0xcb,0x79,0x54,0x15,0x74,0xdc,0xe,0x8,0x2a,0xc8,0xca,0xae,0xbe,0xcd,0xff,0x0,0xf,0xe7,0xfd,0x93,0x3f,0x6f,0x2f,0x80,0xb7,0xbe,0xf,0xfd,0xa6,0xbc,0x17,0xe2,0x4f,0x5,0x5d,0x6a,0x56,0x8b,0x6d,0xaa,0x69,0xaf,0xa6,0x5e,0xeb,0x1a,0x75,0xd3,0x2b,0xab,0xab,0xda,0x5d,0xd8,0x23,0x4e,0x85,0x24,0x44,0x91,0x5e,0x44,0x85,0xd1,0x95,0x48,0x27,0x6e,0xe3,0xfd,0x75,0xc3,0x78,0x2c,0x4a,0xca,0x30,0x58,0xb9,0x27,0x25,0x2a,0x70,0x77,0x5d,0xec,0xae,0x7f,0x1a,0x71,0x2d,0x6a,0x3f,0xdb,0x18,0xca,0x30,0xd2,0xd5,0x26,0xbe,0x5c,0xcc,0xfa,0x43,0xfe,0xd,0xb2,0x75,0x4f,0xf8,0x22,0xcf,0xc2,0x46,0x62,0x36,0xad,0xe7,0x89,0x89,0x3f,0xf7,0x32,0x6a,0x95,0xf2,0xef,0xfc,0x16,0xcf,0xe3,0x9c,0x7f,0xb4,0x5f,0xed,0x47,0xe1,0x1f,0x85,0x7a,0x5c,0xdf,0x68,0xb1,0xd0,0xae,0x17,0x5e,0xd6,0x8a,0x9c,0xac,0x51,0x44,0xc5,0x6d,0xe3,0x6f,0x79,0x26,0xd,0x20,0xee,0x3e,0xc7,0xce,0x37,0xc,0xf6,0x17,0x1f,0xf0,0x57,0x4f,0x87,0xbe,0x1a,0xfd,0x91,0x8f,0x82,0x7f,0x63,0xbf,0x87,0xfa,0xc6,0xb1,0xe1,0x2f,0x5,0xa4,0x3a,0x14,0x37,0xd7,0x16,0x17,0x3a,0x4e,0x8f,0xa3,0x3c,0xdb,0x99,0x44,0x86,0xe8,0x2d,0xdc,0xf2,0xb1,0x2f,0x2b,0x15,0x8c,0x99,0xb,0x31,0x79,0x91,0x9f,0x75,0x7c,0xb3,0xf0,0xa7,0xe1,0xd5,0xf7,0x86,0x6f,0x35,0x6d,0x7b,0xc4,0x1a,0x83,0x6b,0x9e,0x30,0xf1,0x35,0xc9,0xbd,0xd5,0xf5,0x29,0x14,0x3,0x34,0x87,0x3,0xa,0x7,0xdd,0x45,0x50,0xa8,0xa8,0x38,0x54,0x45,0x51,0x9c,0x66,0xbf,0x2f,0xf1,0x73,0x8e,0xa8,0x64,0xd8,0xa,0xb8,0x2a,0x6f,0xfd,0xa2,0xb2,0x69,0x47,0xac,0x63,0x2d,0xe4,0xfe,0x57,0x4b,0xcf,0x5e,0x87,0xea,0x3e,0xe,0xf0,0x6,0x23,0x3a,0xcc,0xa9,0xe6,0x15,0x63,0xfe,0xcd,0x45,0xa6,0xdf,0x49,0x49,0x59,0xa8,0xaf,0x9d,0x9b,0xf2,0xd0,0xfa,0x83,0xfe,0x8,0xea,0xe9,0xff,0x0,0xf,0x2d,0xd5,0x23,0x52,0xbf,0x27,0xc3,0xbd,0x51,0x70,0x3b,0x62,0xff,0x0,0x44,0xe3,0xf5,0x1f,0x9d,0x7d,0xa9,0xff,0x0,0x5,0x50,0x89,0xa6,0xfd,0x90,0x3c,0x4d,0xb5,0x59,0xb6,0xd9,0xcc,0x78,0x1f,0xf4,0xc9,0xab,0xf3,0xe7,0xfe,0x9,0xc7,0xfb,0x67,0x78,0x17,0xfe,0x9,0xbd,0xe1,0xbf,0x8d,0x1e,0x34,0xf8,0x93,0xe0,0x3f,0x1c,0x5c,0x5c,0x6a,0xde,0x21,0xb7,0xdb,0xe2,0xdd,0x1f,0x48,0x8f,0x50,0x85,0x34,0xcf,0xb3,0x42,0xb0,0x58,0x33,0x79,0xab,0x22,0x95,0xb9,0xfb,0x5c,0xbb,0x42,0x6d,0x6f,0xb4,0xa9,0xdc,0x4a,0x90,0x9e,0x99,0xf1,0x73,0xfe,0xe,0x71,0xfd,0x97,0xbc,0x77,0xe0,0xd,0x43,0x4d,0x5b,0x2f,0x8a,0x52,0x4f,0x3c,0x7f,0xb9,0x13,0x78,0x49,0xd5,0xb,0xf6,0xc9,0x32,0x57,0xd3,0x78,0x6b,0x97,0xce,0x9f,0xc,0xe0,0xd5,0x2f,0x7d,0x72,0x27,0x74,0xb4,0xbb,0x77,0xb7,0xca,0xf6,0x7e,0x68,0xf9,0x6f,0x14,0x31,0x9e,0xd7,0x8a,0x71,0xb2,0xa8,0xb9,0x1f,0x3b,0x56,0x7b,0xe8,0x92,0x4f,0xe7,0x6b,0xaf,0x23,0xcb,0xff,0x0,0xe0,0xcd,0x83,0x9f,0xd9,0xe3,0xe3,0x3f,0xfd,0x86,0xb4,0x8f,0xfd,0x20,0xaf,0x7e,0xff,0x0,0x83,0x8e,0x91,0x8f,0xec,0xa5,0x66,0xdb,0x4e,0xd1,0xab,0xe9,0x60,0x9c,0x7f,0xd4,0x4e,0xd2,0xbe,0x15,0xff,0x0,0x82,0x11,0xff,0x0,0xc1,0x44,0x34,0x7f,0xd9,0x47,0xf6,0x81,0xfd,0xa3,0xaf,0x6c,0xfe,0x1d,0xf8,0xb2,0x4f,0x83,0xbe,0x30,0xd4,0x1b,0xc4,0x5a,0x6d,0xb6,0x85,0x63,0x14,0x93,0x78,0x5a,0x38,0xee,0xee,0x45,0xba,0x35,0xb1,0x91,0x40,0x85,0xed,0xa7,0x8d,0x76,0xc6,0xcc,0x62,0x36,0xf1,0xa8,0x56,0x52,0xcc,0x9f,0x4f,0x7e,0xdc,0xff,0x0,0xf0,0x5a,0x9f,0x80,0x7f,0xb5,0x87,0xc0,0x4d,0x5b,0xc2,0x71,0xf8,0x27,0xe2,0x86,0xbb,0x2e,0xa9,0x6f,0x24,0x2,0xd2,0xf3,0xc3,0x2b,0xc,0x73,0x86,0x42,0x36,0xef,0x69,0xb0,0xb9,0x38,0xc3,0x7f,0x9,0xc3,0x76,0xcd,0x7d,0x4e,0x7f,0x8a,0xc3,0xd2,0x94,0xe9,0x62,0xaa,0x46,0x9b,0x9a,0x76,0xe6,0x69,0x68,0xd6,0xfa,0xb4,0x7c,0xb6,0x47,0x83,0xc5,0x55,0x9c,0x2b,0x61,0x69,0x4a,0xa2,0x84,0x95,0xf9,0x53,0x7a,0xa7,0x7b,0x68,0x9d,0x84,0xff,0x0,0x82,0x15,0x48,0xb2,0x7e,0xdf,0x9f,0x11,0xb6,0xb2,0xb7,0xfc,0x5b,0xed,0x3b,0xa1,0xff,0x0,0xa7,0xbf,0xfe,0xb8,0xaf,0xa9,0x7f,0xe0,0xb8,0x8a,0x4f,0xec,0x3,0xe3,0xf6,0x3,0xe5,0x5f,0xf,0xea,0x65,0x8f,0xa7,0xfa,0x14,0xf5,0xf0,0x6f,0xfc,0x10,0xf7,0xf6,0xe8,0xf0,0x3f,0xec,0x41,0xf0,0xeb,0xc5,0x3e,0x1f,0xf1,0xb7,0x82,0x7e,0x20,0x6a,0xdf,0x14,0x3c,0x4f,0xa9,0xc7,0x75,0x2e,0xa7,0xa3,0xe8,0x6b,0x7c,0xd7,0xba,0x6c,0x16,0x50,0x2c,0x51,0x19,0x4c,0x8a,0x55,0x63,0x9f,0xed,0x8e,0x23,0x20,0x0,0x67,0x66,0x19,0x2e,0x4d,0x7a,0xf7,0xc7,0xcf,0xf8,0x39,0x8b,0xf6,0x5b,0xf8,0x8d,0xe0,0x3d,0x4f,0x43,0x93,0x4a,0xf8,0x97,0x7b,0x70,0xc5,0xa1,0x6b,0x6b,0xcf,0x7,0xb3,0x42,0xc4,0x65,0x59,0x1c,0x33,0xed,0x20,0xf2,0x8,0x39,0x4,0x12,0x2b,0xe7,0xb8,0xf,0x2,0xa8,0xe4,0x78,0x7c,0x3e,0x1e,0x6a,0xaf,0x24,0x75,0x71,0xd5,0x5d,0xeb,0x6e,0xba,0xab,0xd8,0xfa,0x1f,0x10,0xb1,0x93,0xc4,0x67,0xf8,0x8c,0x4d,0x7a,0x6e,0x9b,0x93,0xd1,0x4b,0x47,0x64,0x92,0xbf,0x4d,0x1d,0x89,0x7f,0xe0,0xd1,0x71,0x8f,0xf8,0x27,0xaf,0xc4,0xcc,0xff,0x0,0xd1,0x54,0xbc,0xff,0x0,0xd3,0x26,0x8b,0x58,0xdf,0xf0,0x75,0xb2,0xb0,0xfd,0x92,0x15,0xb1,0xf2,0xff,0x0,
-0x68,0xe9,0x63,0x3e,0xff,0x0,0x6f,0x86,0xbe,0x54,0xff,0x0,0x82,0x1e,0x7f,0xc1,0x6b,0x7e,0x19,0xff,0x0,0xc1,0x37,0xfc,0x31,0xf1,0x73,0xc1,0xfe,0x38,0xf0,0xcf,0x8b,0x34,0x7f,0x4,0x78,0xb3,0xc5,0xf3,0x78,0xb7,0xc2,0x63,0x47,0xd2,0xfe,0xdf,0x25,0x82,0x4c,0x8b,0x6e,0xd6,0x53,0x22,0xbe,0x50,0x47,0x6f,0x6d,0x67,0xb0,0x82,0xe0,0x9f,0x34,0x12,0x30,0xbb,0xfd,0x6b,0xfe,0xa,0x8b,0xff,0x0,0x5,0xe4,0xfd,0x9a,0xff,0x0,0x6d,0xef,0xd9,0x67,0xc5,0x1e,0x9,0xd0,0xbc,0x3d,0xe3,0xed,0x7b,0x5c,0xd7,0x34,0xbb,0x9b,0x2b,0x8,0x35,0x2f,0xc,0x1b,0x78,0x56,0xed,0xa3,0x3f,0x65,0x93,0x7b,0x3f,0xca,0x63,0xb8,0x11,0x4a,0x18,0x72,0xa6,0x30,0x46,0x48,0x2,0xbe,0xf2,0xa6,0x1e,0xba,0xc4,0xfb,0x47,0x7,0xbd,0xf6,0x7d,0xd3,0x3e,0x12,0x33,0x87,0xb3,0xe5,0xe6,0x5b,0x58,0xfd,0x3,0xff,0x0,0x82,0x12,0xe9,0x47,0x41,0xff,0x0,0x82,0x53,0xfc,0x2b,0xb1,0x6f,0xbd,0x67,0xfd,0xaf,0x9,0xff,0x0,0x80,0xeb,0x17,0xa3,0xfa,0x57,0xce,0x9f,0xb7,0x76,0x9d,0x25,0xe7,0xfc,0x16,0x9b,0xf6,0x6e,0x54,0x61,0x14,0x8d,0xab,0x5e,0xb4,0x6e,0xc3,0x80,0xc2,0x38,0x48,0xfd,0x71,0x55,0x7f,0x64,0x9f,0xf8,0x2a,0xbf,0x85,0xbf,0xe0,0x9b,0x1f,0x7,0x2d,0x3e,0xf,0xfc,0x58,0xf0,0x9f,0x8f,0x60,0xd6,0x34,0x3b,0x89,0xb5,0x3d,0x3a,0xeb,0x45,0xd2,0x57,0x50,0xb7,0xbd,0xb3,0xd4,0x24,0x6b,0xf1,0xbb,0x12,0x29,0x8e,0x48,0xa5,0xb9,0x96,0x22,0xa4,0x60,0xa2,0x44,0xe1,0x89,0x67,0x54,0xe4,0x3e,0x3e,0xfe,0xda,0x9e,0x13,0xff,0x0,0x82,0x98,0xfe,0xd5,0x9f,0x7,0xe0,0xf8,0x3d,0xe1,0x5f,0x1f,0x2f,0x8b,0xbc,0x3b,0xe2,0x4b,0x6d,0x50,0xdf,0xea,0x5a,0x4a,0xd8,0x2d,0x95,0xb4,0x67,0x17,0x2d,0xbb,0xcd,0x2c,0x43,0xc0,0xcf,0x1e,0xdd,0xa7,0x26,0x40,0x4e,0x36,0xee,0x5f,0x97,0xc7,0x63,0xb0,0x75,0xa5,0x2c,0x33,0xad,0x15,0x26,0xed,0x6e,0x65,0x7b,0xdf,0x6b,0x5f,0x73,0xe8,0xf0,0x39,0x7e,0x3e,0x8a,0x58,0xc5,0x42,0x6e,0x9,0x37,0x7e,0x57,0x6b,0x35,0xbd,0xed,0x6b,0x6b,0xbe,0xc7,0x91,0xe9,0xdf,0xf0,0x4a,0x8f,0x4,0xff,0x0,0xc1,0x45,0x7f,0x61,0x7f,0x88,0xdf,0x14,0xf4,0x7b,0x5d,0x4f,0xfe,0x17,0xc3,0x78,0xdb,0xc4,0xb6,0x7a,0x8e,0xb5,0x2e,0xb5,0x76,0xd0,0xcd,0x79,0xe,0xa3,0x2b,0x5a,0xab,0x5b,0xf9,0x9e,0x40,0x88,0xda,0xb5,0xb4,0x6f,0xfb,0xad,0xd8,0x2c,0xe3,0xe7,0xc3,0x57,0xb9,0xff,0x0,0xc1,0xab,0x3f,0xb5,0xb7,0x88,0x3c,0x53,0xf0,0x7f,0xe2,0x37,0xec,0xf7,0xe3,0x28,0x6f,0x2c,0xf5,0xef,0x82,0x3a,0x8a,0xbd,0x8d,0xa5,0xe0,0xc5,0xd6,0x9d,0x6b,0x75,0x2c,0xeb,0x35,0x84,0x8b,0x8c,0x86,0xb6,0xbb,0x86,0x6c,0x64,0x9c,0x25,0xc4,0x68,0xbf,0x24,0x62,0xbe,0x7c,0xff,0x0,0x82,0x41,0xff,0x0,0xc1,0x62,0xbe,0x1c,0xff,0x0,0xc1,0x3b,0xfc,0x2f,0xf1,0xf3,0xc2,0x7f,0x14,0xe5,0xd6,0x95,0xf5,0xef,0x1c,0x5d,0x78,0xaf,0x42,0x4b,0x1d,0x1e,0xea,0xfb,0xfb,0x4e,0x59,0x60,0x5b,0x6b,0x88,0xb,0xc3,0x1b,0xac,0x64,0x1b,0x28,0x8,0x32,0x6c,0x5c,0xcc,0x4e,0x7e,0x56,0xc7,0xd2,0x9f,0xc,0x3f,0xe0,0xe6,0xff,0x0,0xd9,0xb6,0x4f,0x86,0x57,0xfe,0x2a,0xd5,0xbc,0x1b,0xe2,0x8f,0x87,0xbf,0x14,0x35,0x6b,0x48,0x13,0x56,0xd1,0xa3,0xf0,0xe4,0x9a,0x84,0xf7,0xf2,0xc5,0x19,0x11,0xa2,0x6a,0x16,0xd1,0xf9,0x77,0x11,0x26,0xe6,0x58,0xda,0x76,0x84,0x80,0x79,0x48,0xc1,0x20,0x7d,0x56,0x26,0x86,0x21,0x73,0x51,0x94,0x5b,0x57,0xd1,0xeb,0xa7,0xfc,0x3a,0x3e,0x72,0x9d,0x4a,0x7a,0x4d,0x34,0x66,0xff,0x0,0xc1,0x4f,0x75,0x15,0x8b,0xf6,0xf7,0x86,0x7b,0x5e,0x5a,0xd7,0xc0,0xfe,0x21,0x32,0x95,0x19,0xda,0xc,0xda,0x4a,0x9c,0xfe,0x2c,0xbc,0x7b,0x57,0x89,0xa2,0x85,0x5c,0x7e,0x15,0x6b,0xf6,0x4c,0xf8,0xbd,0x7d,0xfb,0x6f,0xf8,0x17,0xf6,0x9e,0xf8,0xf5,0xe2,0x6d,0x35,0xb4,0x97,0x90,0xe9,0x9e,0x13,0xf0,0xdd,0x84,0xac,0x25,0x96,0xce,0xd1,0xda,0x69,0x99,0xa4,0x61,0xc0,0x96,0x46,0x93,0x2d,0xb7,0xe5,0xfb,0x8b,0x96,0xf2,0xc3,0xb5,0x75,0x1c,0xd7,0xf2,0xf,0xd2,0x31,0xd4,0xa7,0x99,0x61,0x30,0xf5,0x34,0xb4,0x1b,0xb7,0xac,0xbf,0xe0,0x23,0xfb,0x17,0xe8,0xd7,0x4e,0x32,0xca,0xf1,0x75,0xe3,0xd6,0xa4,0x57,0xdd,0x1f,0xf8,0x22,0xb7,0x4a,0xee,0x75,0x7b,0xd5,0xf0,0x77,0xfc,0x12,0xef,0xf6,0x9a,0xd7,0x24,0x50,0x1a,0xfb,0x4d,0xb1,0xd0,0xa3,0x90,0xf6,0x5b,0x89,0x4a,0xb8,0xfd,0x56,0xb8,0x56,0x7c,0xa,0x87,0xf6,0xa6,0xf1,0xb3,0x5b,0xff,0x0,0xc1,0x26,0x7e,0x30,0x69,0x51,0x15,0x58,0xe5,0xf1,0x3e,0x82,0x8e,0xe3,0xef,0x48,0x4c,0xe4,0x95,0x3f,0x4d,0xa2,0xbe,0x4f,0xc0,0x5c,0x3a,0xa9,0xc6,0xb8,0x3e,0x65,0x7b,0x39,0x3f,0xba,0x2c,0xfb,0x3f,0x1e,0x71,0x12,0xa7,0xc1,0x58,0xb5,0x17,0x6e,0x6e,0x45,0xf2,0xe7,0x89,0xf9,0x91,0xa8,0x6a,0xad,0x74,0x5a,0x38,0xc9,0x58,0xfa,0x1f,0x56,0xac,0x8d,0x7b,0x5e,0xb5,0xf0,0xc6,0x91,0x73,0x7f,0x7d,0x2a,0xc1,0x67,0x6a,0x9b,0xe4,0x73,0xd7,0xd0,0x60,0x77,0x24,0xe0,0x1,0xdc,0x9a,0xb4,0x7,0xcf,0x8e,0xf5,0xe1,0x3f,0x11,0xb5,0x4d,0x6f,0xf6,0x8a,0xf8,0xb5,0xa3,0xf8,0x1f,0xc2,0x36,0x37,0x9a,0xd5,0xd5,0xe6,0xa3,0x1e,0x9d,0xa6,0x58,0xd9,0xa1,0x92,0x5d,0x52,0xf6,0x46,0xf2,0xd7,0x6a,0x8e,0xbf,0x33,0x6d,0x5f,0xc4,0xf7,0xaf,0xf4,0x8b,0x36,0xcc,0x56,0x16,0x97,0xb4,0x7a,0xb7,0xb2,0xf3,0xff,0x0,0x80,0x7f,0x9d,0x38,0x3c,0x2b,0xab,0x3e,0x5e,0x9d,0x4e,0x97,0xf6,0x79,0xf8,0x9,0xf1,0x2b,0xfe,0xa,0x9b,0xfb,0x53,0xe8,0x5f,0xc,0xfe,0x1f,0xe9,0xe6,0xe7,0x50,0xd5,0xe6,0x26,0x8,0x65,0x72,0xb6,0x7a,0x4d,0xb2,0xe3,0xcc,0xbc,0xb9,0x75,0x7,0xa,0x8a,0x72,0xcd,0x82,0x4e,0x42,0xa8,0x24,0xaa,0x9f,0xea,0xff,0x0,0xfe,0x9,0x31,
-0xff,0x0,0x4,0x85,0xf8,0x6f,0xff,0x0,0x4,0x93,0xf8,0x1d,0x27,0x87,0x3c,0x23,0xbf,0x5e,0xf1,0x4e,0xb6,0x52,0x7f,0x11,0xf8,0xaa,0xf6,0xdd,0x23,0xbd,0xd6,0x25,0x51,0x80,0x8a,0x6,0x7c,0x9b,0x64,0xe7,0xcb,0x84,0x33,0x5,0xdc,0x49,0x2c,0xcc,0xcc,0x78,0x9f,0xf8,0x21,0x6f,0xfc,0x11,0xa7,0xc3,0xff,0x0,0xf0,0x49,0x7f,0xd9,0xc7,0xc9,0xbe,0x5b,0x3d,0x63,0xe2,0xc7,0x8c,0x21,0x8a,0xe3,0xc5,0x9a,0xca,0x28,0x65,0x8d,0x80,0xdc,0xb6,0x36,0xed,0xd7,0xec,0xf1,0x12,0x79,0xff,0x0,0x96,0x8f,0x97,0x20,0x7c,0xaa,0xbf,0x73,0x5,0xda,0xe,0x2b,0xf3,0x5a,0xb5,0xa7,0x56,0x4e,0xa5,0x47,0x76,0xcf,0xa6,0x8c,0x63,0x15,0xcb,0x1d,0x85,0x0,0x11,0xd3,0xf4,0xa5,0xa6,0xa0,0x60,0xbf,0x37,0x5a,0x75,0x66,0x50,0x51,0x45,0x14,0x0,0x51,0x45,0x14,0x0,0x51,0x45,0x14,0x0,0x51,0x45,0x14,0x0,0x51,0x45,0x14,0x1,0xf9,0x41,0xff,0x0,0x7,0x74,0x7e,0xc3,0x2f,0xfb,0x4a,0xff,0x0,0xc1,0x3b,0xad,0x7e,0x24,0xe8,0xfa,0x6b,0x5d,0xf8,0x93,0xe0,0xb5,0xfb,0x6a,0x72,0x34,0x49,0xba,0x53,0xa4,0xce,0x16,0x3b,0xc5,0xff,0x0,0x75,0xa,0xc1,0x33,0x1e,0xcb,0x3,0x7b,0xd7,0xf3,0xf3,0xfb,0x32,0xf8,0xd3,0xfe,0x12,0x1f,0x2,0x7f,0x67,0xca,0xfb,0xae,0xb4,0x77,0xf2,0xb9,0x3c,0xb4,0x4d,0xca,0x9f,0xc3,0x95,0xfc,0x5,0x7f,0x69,0xfe,0x3a,0xf0,0x66,0x97,0xf1,0x1b,0xc1,0x7a,0xb7,0x87,0xb5,0xcb,0x1b,0x7d,0x4b,0x45,0xd7,0xac,0xe6,0xd3,0xb5,0xb,0x39,0xd0,0x3c,0x57,0x56,0xf3,0x23,0x47,0x24,0x6e,0xa7,0x82,0xac,0x8c,0x41,0x7,0xa8,0x35,0xfc,0x72,0xff,0x0,0xc1,0x49,0xff,0x0,0x60,0x1f,0x1a,0xff,0x0,0xc1,0x1a,0xff,0x0,0x6e,0x5d,0x4b,0xc3,0x3a,0xa5,0x9d,0xf5,0xcf,0x83,0xef,0xe7,0x96,0xe3,0xc3,0x5a,0xab,0xf,0xdc,0xeb,0xda,0x53,0x37,0xca,0x37,0xf4,0xf3,0xe2,0x5,0x55,0xd4,0xe0,0xab,0xa8,0x38,0xda,0xca,0x4f,0xa3,0x95,0x63,0x7e,0xad,0x88,0x53,0x7b,0x3d,0x1f,0xa7,0xfc,0x3,0x9f,0x15,0x47,0xda,0xd2,0x71,0xeb,0xd0,0xd1,0x60,0x4b,0x56,0xae,0x95,0xab,0x23,0xc6,0xb1,0xc8,0xdb,0x5d,0x7e,0x50,0x4f,0x46,0xae,0x77,0x41,0xf1,0x5,0x9f,0x8a,0xf4,0x88,0x75,0xd,0x3e,0xe1,0x6e,0x2d,0x2e,0x17,0x2a,0xe3,0xa8,0x3d,0xd5,0x87,0x66,0x1d,0x8,0xed,0x57,0x37,0x62,0x3c,0xfa,0x75,0xaf,0xd3,0x69,0x55,0x56,0x53,0x8e,0xcc,0xf9,0x69,0x43,0x5b,0x4b,0x74,0x7e,0xb9,0x7c,0xa,0x21,0x3f,0xe0,0x8e,0x1f,0x2,0x54,0xfc,0xcd,0x2e,0xbb,0xaf,0x3a,0x9f,0x41,0xf6,0xd9,0x6b,0x94,0x6e,0x23,0xac,0xed,0x2,0x1b,0xbf,0x1,0x7f,0xc1,0x36,0xff,0x0,0x67,0xad,0x23,0xed,0x13,0x45,0x35,0xdc,0x3a,0xa6,0xae,0x54,0x39,0x5c,0x25,0xc5,0xc6,0xf4,0x38,0xf7,0x4,0xd7,0x23,0x2f,0x8a,0xf5,0x8,0x6d,0xa4,0xc5,0xd4,0x87,0x8f,0xe2,0xe6,0xbf,0xcd,0xbf,0x1c,0x70,0xf2,0xc4,0xf1,0x9e,0x2e,0xa4,0x5a,0xb5,0xe2,0xbf,0xf2,0x54,0x7f,0xa2,0x1e,0x6,0xe2,0x63,0x86,0xe0,0xec,0x2d,0x39,0xa7,0xf6,0x9f,0xdf,0x36,0x5c,0xff,0x0,0x82,0xe3,0xdc,0x35,0xaa,0x7e,0xcd,0xba,0x71,0xe3,0xec,0xff,0x0,0xd,0x63,0x9b,0x18,0xe4,0x6e,0x9c,0x8f,0xfd,0x96,0xbe,0x10,0x91,0x16,0x5e,0xa1,0x5b,0x8e,0xe3,0x35,0xf5,0xe7,0xfc,0x17,0x37,0xc5,0x77,0xd7,0x3f,0x1f,0xfe,0x19,0xe9,0xd2,0xdc,0x6f,0x5d,0x17,0xe1,0xfd,0x8d,0xb4,0x63,0x6e,0xa,0xab,0x3b,0x3e,0x3f,0x36,0xaf,0x88,0xee,0x35,0x4b,0x88,0xa2,0x77,0xdf,0x23,0x15,0x4,0x85,0x5e,0xac,0x7d,0x7,0xd6,0xbf,0xd0,0x6e,0xb,0x8a,0xa1,0x90,0xe1,0x28,0xcb,0x78,0xd3,0x8a,0xfb,0x91,0xfc,0x11,0xc5,0x15,0x3d,0xb6,0x6f,0x89,0xac,0xbe,0xd4,0xe4,0xfe,0xf6,0xcf,0xd4,0x5f,0xd8,0xdb,0x47,0x87,0xe1,0xdf,0xfc,0x12,0x3b,0x41,0x99,0x63,0x5b,0x7b,0x8f,0x88,0xbe,0x3c,0xbe,0xbc,0xb8,0x66,0xc2,0xee,0x8e,0xc5,0x4c,0x11,0x11,0xec,0x71,0x59,0x37,0xfe,0x31,0xb1,0xd3,0xc6,0x3c,0xcf,0x39,0xd7,0x8d,0xb1,0x8c,0xfe,0xbd,0x2a,0x6f,0x8b,0xda,0x14,0x9f,0xa,0x3e,0x14,0xfc,0x25,0xf8,0x6a,0xd2,0xbb,0xcd,0xe0,0xbf,0x9,0xdb,0x49,0x7c,0x1,0xfd,0xdc,0x97,0x57,0x7f,0xe9,0x2e,0xf8,0xfe,0xf6,0x1c,0x3,0xee,0x2b,0xcf,0x67,0x93,0xc9,0x85,0x9b,0xb2,0x8c,0xf1,0x5f,0xe7,0xcf,0x8c,0xb8,0x9a,0x79,0xaf,0x17,0xe2,0xf1,0x17,0x6e,0x31,0x97,0x22,0xff,0x0,0xb7,0x74,0x7f,0x8d,0xcf,0xef,0x8f,0x6,0xf0,0xf5,0x32,0xce,0x11,0xc2,0xd0,0xe5,0xb4,0xa6,0x9c,0xdf,0xfd,0xbc,0xf4,0xff,0x0,0xc9,0x6c,0x7a,0x37,0xed,0xaf,0xf1,0x66,0x4f,0xd,0xff,0x0,0xc1,0x1d,0xe6,0xd2,0xd6,0x24,0xb5,0x93,0xc7,0x7e,0x3a,0x85,0x63,0x62,0x73,0x24,0xa9,0x6a,0x63,0x94,0xe3,0xb6,0x30,0x3f,0x43,0x5f,0x98,0x6e,0xcd,0x21,0xdc,0xc7,0x71,0xcf,0x53,0x5f,0x78,0x7f,0xc1,0x63,0x75,0xdf,0xf8,0x42,0x7e,0x10,0x7c,0x5,0xf8,0x66,0x1a,0x36,0x9b,0x4d,0xd1,0xe6,0xf1,0x1d,0xf2,0xa9,0xe5,0x25,0x9c,0xec,0x4c,0x8f,0x78,0xcf,0x7f,0x4a,0xfc,0xf5,0xf1,0x6f,0xc4,0xd,0x17,0xc0,0x89,0xff,0x0,0x13,0x6b,0xf8,0x6d,0x64,0x23,0x22,0x12,0x4b,0x4c,0xdf,0x44,0x19,0x6f,0xc4,0xe0,0x7b,0xd7,0xf7,0x17,0x86,0x79,0x7c,0x72,0xbe,0x16,0xc1,0xe1,0xe7,0xee,0xda,0x9,0xbb,0xe9,0xab,0xd5,0x9f,0xc4,0xbe,0x21,0xe6,0x4f,0x33,0xe2,0x5c,0x66,0x2a,0x3a,0xf3,0x4e,0x56,0xf4,0x5a,0x23,0xf4,0x87,0xfe,0x9,0x2d,0xa5,0x37,0x80,0xff,0x0,0x62,0x2f,0x8f,0xde,0x31,0xb8,0x1e,0x5a,0xeb,0x8f,0x67,0xe1,0xdb,0x19,0x3b,0xb3,0x95,0x7f,0x31,0x7f,0x6,0x64,0xfc,0xeb,0x3a,0x38,0xf6,0xf,0xfe,0xb5,0x7c,0x8b,0xa6,0x7f,0xc1,0x6f,0x34,0x8f,0x85,0x5f,0xb1,0x1e,0x87,0xf0,0x93,0xc1,0x9f,0xf,0xef,0xae,0x75,0x8,0x75,0x79,0xf5,0xad,0x5f,0x57,0xd5,0x35,0x5,0x86,0xde,0xea,0x67,0xe1,0x15,0x60,0x8d,0x59,
-0x8a,0x85,0xa,0x72,0xd2,0x29,0xc8,0xe9,0x5f,0x3f,0xf8,0xb3,0xfe,0xa,0xb1,0xf1,0x73,0x5f,0x76,0xfb,0x1e,0xa1,0xa0,0xe8,0x29,0x9c,0x4,0xb3,0xd3,0x23,0x76,0x5f,0xf8,0x14,0xde,0x61,0xaf,0xc1,0xfc,0x58,0xe0,0xfc,0xdb,0x89,0xb3,0xef,0x6f,0x83,0xe5,0x8d,0x28,0xc5,0x45,0x4a,0x52,0xb5,0xdf,0x5b,0x24,0x9b,0xec,0xb5,0x48,0xfd,0xa7,0xc2,0xbe,0x38,0xc9,0x78,0x6b,0x24,0x95,0x1c,0x67,0x34,0xaa,0xce,0x4e,0x4e,0x31,0x8d,0xec,0xac,0x92,0xbb,0x6d,0x2e,0xfb,0x36,0x7e,0xd9,0x7f,0xc1,0x39,0x1d,0x47,0xed,0x41,0x65,0xbb,0xa9,0xd3,0x6f,0x42,0xe4,0x77,0xf2,0x18,0xff,0x0,0x4a,0xfc,0xa0,0xf1,0x7c,0x86,0x6f,0x19,0x6b,0x32,0x32,0xaa,0xb4,0x9a,0x85,0xc3,0x15,0x1d,0x14,0x99,0x5a,0xbc,0xdf,0xe1,0xc7,0xed,0x23,0xfb,0x5a,0x6b,0xda,0x85,0xbf,0x88,0xbc,0x17,0xac,0x7c,0x63,0x79,0x8a,0xb9,0x82,0xfb,0xc3,0xb6,0x17,0x48,0xbb,0x58,0x15,0x6d,0xad,0x6f,0x18,0x18,0x20,0x90,0x71,0xc7,0x35,0xe7,0x9e,0x2c,0x4f,0x8d,0x1e,0x6,0x86,0xe7,0x52,0xf1,0x6,0x9b,0xf1,0x3,0x4d,0x8f,0x79,0x92,0xe2,0xe3,0x55,0xd2,0xae,0x23,0x40,0xc4,0x92,0x4b,0x34,0xb1,0xe3,0x24,0xfa,0xd7,0xe8,0x1e,0x13,0xe5,0xb5,0x38,0x5b,0x2d,0x9e,0xb,0x1a,0xd4,0xdc,0xa5,0xcd,0x78,0xde,0xdb,0x2e,0xf6,0x3f,0x3f,0xf1,0x43,0x3f,0xa1,0xc4,0xd9,0x9c,0x71,0xb8,0x38,0xb8,0x46,0x31,0x51,0xb4,0xad,0x7b,0xa6,0xf5,0xd1,0xb3,0xde,0x8f,0x23,0x3d,0x73,0xda,0xbb,0x8f,0xd9,0x97,0xc1,0xff,0x0,0xf0,0x9e,0xfe,0xd2,0x3f,0xf,0xf4,0x51,0x18,0x95,0x75,0x2f,0x12,0x58,0x40,0xe8,0x7f,0x89,0x3e,0xd0,0x85,0xff,0x0,0xf1,0xd0,0xd5,0xf1,0xbe,0x93,0xfb,0x4f,0x78,0xaa,0xc5,0xb6,0xcd,0x71,0x61,0xa8,0x2e,0x79,0x13,0x5b,0x2a,0x93,0xf8,0xa6,0xd3,0x5f,0x43,0xff,0x0,0xc1,0x3f,0xbf,0xe0,0xa1,0x7e,0x13,0xf8,0x2b,0xfb,0x5f,0x7c,0x3c,0xf1,0x67,0x8f,0xf4,0x9d,0x52,0xcf,0xc3,0xbe,0x1f,0xd5,0x5,0xcd,0xfc,0xda,0x62,0xad,0xe3,0xa2,0xf9,0x4e,0x81,0xc4,0x4c,0x50,0x90,0xae,0xca,0x48,0xc,0x4e,0x1,0xc0,0x63,0x80,0x7f,0x58,0xff,0x0,0x58,0x70,0x95,0x29,0xca,0xce,0xce,0xce,0xd7,0x5e,0x5e,0x57,0x3f,0x32,0xfe,0xcd,0xad,0x19,0x2d,0x2e,0xae,0x7e,0xad,0xfe,0xdd,0xfa,0xea,0x78,0x83,0xf6,0xb7,0xf1,0x66,0xce,0x61,0xd3,0x64,0x8e,0xc1,0x7,0xf7,0x44,0x31,0xac,0x78,0xff,0x0,0xc7,0x4d,0x6f,0x7f,0xc1,0x38,0x6e,0xdb,0x49,0xfd,0xa5,0x1a,0xfa,0x37,0x68,0x5b,0x4f,0xd0,0xb5,0xb,0x9d,0xe8,0x70,0x53,0x64,0x60,0xe6,0xbe,0x4f,0xf1,0xf,0xfc,0x14,0x5b,0xe1,0xf,0xc7,0xaf,0x8a,0x5e,0x20,0xd7,0x2c,0x7c,0x71,0xa5,0x5a,0x3e,0xb9,0xa9,0x4f,0x77,0x1c,0x3a,0x9e,0xfb,0x19,0x14,0x3c,0x84,0xa8,0x63,0x20,0x9,0x9c,0x1f,0xef,0x1a,0xfa,0x7b,0xf6,0x27,0xd5,0x6d,0x47,0x84,0xbe,0x2c,0xf8,0xbb,0x4f,0xba,0xb7,0xbc,0xb7,0xd1,0x7c,0x5,0xa9,0xc9,0x6f,0x75,0x6d,0x2a,0xcd,0x11,0x67,0x82,0x40,0x30,0xea,0x4a,0x9e,0x55,0x7b,0xd7,0xf0,0xa6,0x57,0x80,0xc7,0x55,0xe3,0x6a,0x55,0x71,0x34,0xa5,0xe,0x7a,0xce,0x5e,0xf2,0x6a,0xea,0xed,0xf5,0x5a,0xe8,0x7f,0x70,0x66,0xd8,0xec,0xd,0x2e,0x5,0xab,0x4b,0xd,0x56,0x33,0xe4,0xa0,0xa3,0xee,0xc9,0x3b,0x3e,0x54,0xba,0x3d,0x35,0x3f,0x2d,0x75,0x8d,0x7a,0x59,0xbc,0x43,0xa9,0x48,0xfb,0x66,0xf3,0x2f,0xae,0x1f,0x2c,0x39,0x39,0x95,0x8f,0x5f,0xc6,0xa4,0x87,0x59,0x82,0x66,0xfd,0xe0,0xf2,0xdb,0xdc,0x67,0xf5,0xac,0x6b,0x69,0x5a,0x78,0x56,0x47,0xe5,0xa4,0x1,0xd8,0x9f,0x53,0xc9,0xfd,0x4d,0x3f,0x39,0xea,0x3f,0x23,0x5f,0xe8,0x7c,0x6a,0x4a,0x2a,0xc7,0xf0,0x5f,0x2a,0x6c,0xfd,0x4c,0xff,0x0,0x82,0x73,0xe8,0x8d,0xe1,0xdf,0xf8,0x23,0xef,0x8f,0xb5,0xc8,0xe4,0x8d,0x93,0xc4,0xff,0x0,0x10,0x2c,0xed,0x70,0x5c,0x64,0x24,0x3b,0x50,0x9c,0x7e,0x35,0x56,0x4b,0xf8,0x60,0x5f,0xde,0x4d,0x1a,0xff,0x0,0xbc,0xc0,0x56,0x87,0xc0,0x2f,0x9,0xf,0x2,0x7f,0xc1,0x10,0x7c,0x22,0xb2,0x1f,0xde,0x78,0x93,0xc4,0x67,0x5a,0x4f,0x75,0x92,0x5c,0x8f,0xd1,0x6b,0xc9,0x71,0x9f,0xbd,0x96,0x23,0xf1,0xaf,0xf3,0xf7,0xe9,0x14,0xbe,0xb9,0xc5,0x3a,0xcb,0x48,0xc1,0x7f,0xe9,0x52,0x3f,0xbb,0x3e,0x8e,0xb3,0xfa,0xaf,0xc,0x49,0xa5,0xac,0xaa,0x3f,0xc2,0x31,0x3b,0x2f,0x10,0x78,0xce,0xb,0x6b,0x46,0x4b,0x59,0x16,0x6b,0x86,0xf9,0x41,0x5e,0x89,0xef,0x5c,0xb7,0xed,0x6d,0xab,0xd,0x13,0xfe,0x9,0x69,0x7d,0x1e,0xec,0xc9,0xe2,0x5f,0x1f,0x5a,0xdb,0xb0,0xee,0x7c,0x88,0x5a,0x5e,0x7f,0x5a,0xad,0xfe,0x78,0xac,0xff,0x0,0xdb,0xe3,0x59,0xb5,0xf0,0xff,0x0,0xfc,0x12,0xcf,0xc3,0xb7,0x77,0x92,0x2d,0xad,0xbc,0x5f,0x12,0x67,0x77,0x98,0x9e,0x8,0x1a,0x74,0x99,0xc8,0xfc,0x38,0xc7,0x52,0x40,0xae,0x6f,0x0,0x30,0xb4,0xe9,0xf1,0x65,0x17,0xda,0x33,0x77,0xf9,0x1d,0x5e,0x3e,0x62,0xaa,0x54,0xe1,0x5a,0x97,0xfe,0x68,0x2b,0x7c,0xcf,0xcd,0xcf,0xda,0x3,0xe2,0xb,0xf8,0x1b,0xc1,0x6,0x2b,0x59,0xc4,0x7a,0x8e,0xa8,0xc6,0x8,0x48,0x38,0x64,0x4c,0x7c,0xee,0x3e,0x83,0x8c,0xfa,0x9a,0xfd,0x52,0xff,0x0,0x83,0x3c,0x7f,0xe0,0x96,0x6b,0xa8,0xde,0x6a,0x7f,0xb5,0x37,0x8c,0x34,0xd5,0x6b,0x7b,0x76,0xb8,0xd0,0xfc,0x9,0x1d,0xc2,0x64,0x33,0x8c,0xc7,0x79,0xa8,0x27,0xfb,0xa7,0x75,0xba,0x37,0x63,0xf6,0x81,0x8c,0x85,0x23,0xf2,0xc7,0xf6,0x23,0xfd,0x91,0x3c,0x5d,0xff,0x0,0x5,0x77,0xfd,0xbc,0xbc,0x35,0xf0,0xdf,0xc3,0x6b,0x35,0x8d,0xb6,0xab,0x27,0x9b,0x7f,0x7a,0x53,0xcc,0x8f,0xc3,0xfa,0x44,0x24,0x1b,0x8b,0xa7,0x1d,0x37,0x5,0x38,0x50,0x48,0xf,0x2c,0x91,0xa6,0xe1,0xb8,0x1a,0xfe,0xc9,0x7e,0x1,0x7c,0xb,0xf0,0xd7,0xec,0xcb,0xf0,0x5b,0xc2,0xff,0x0,0xf,0xfc,0x1b,0xa7,
-0x47,0xa5,0x78,0x5f,0xc1,0xfa,0x6c,0x3a,0x56,0x9b,0x6c,0xbc,0x94,0x8a,0x25,0xa,0xb,0x1c,0x7c,0xce,0xc7,0x2c,0xce,0x79,0x66,0x66,0x63,0x92,0x49,0xaf,0xeb,0xec,0xdb,0x1d,0xf5,0xac,0x43,0x9c,0x7e,0x15,0xa2,0xf4,0xef,0xf3,0x3f,0x8c,0x70,0x74,0x3d,0x95,0x25,0x17,0xbf,0x53,0xb0,0x5f,0xba,0x28,0xa2,0x8a,0xf3,0xe,0xa0,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0x28,0x0,0xa2,0x8a,0x28,0x0,0x23,0x35,0xe1,0xbf,0xf0,0x50,0x5f,0xf8,0x27,0xdf,0xc3,0xbf,0xf8,0x29,0x47,0xec,0xe9,0xa9,0x7c,0x37,0xf8,0x8d,0xa6,0xb5,0xc6,0x9f,0x70,0xc2,0xe3,0x4f,0xd4,0x2d,0xc0,0x5b,0xed,0x12,0xed,0x41,0xd9,0x73,0x6e,0xe4,0x1d,0xae,0x32,0x41,0x1f,0x75,0xd4,0xb2,0xb0,0x20,0x9a,0xf7,0x2a,0x28,0x3,0xf8,0xed,0xff,0x0,0x82,0x90,0x7f,0xc1,0x27,0x7e,0x3a,0x7f,0xc1,0x17,0xbe,0x26,0x5c,0x4d,0xaa,0x59,0xcd,0xae,0x7c,0x37,0xd4,0xae,0xbc,0x8d,0x2f,0xc5,0x76,0xb6,0xed,0x26,0x95,0xa8,0xe7,0x26,0x38,0xae,0x14,0x13,0xf6,0x7b,0x9d,0xa0,0xfc,0x8c,0x41,0x38,0x6d,0x8c,0xca,0xd,0x78,0x8f,0x87,0x7f,0x6b,0x2b,0x5b,0x98,0x9a,0x3d,0x63,0x4c,0x92,0xd6,0x42,0xb8,0x12,0xda,0x1f,0x31,0x3f,0x14,0x6e,0x47,0xe6,0x6b,0xfb,0x69,0xf1,0xd7,0x80,0x34,0x3f,0x8a,0x1e,0x11,0xd4,0x3c,0x3f,0xe2,0x4d,0x1f,0x4b,0xf1,0x6,0x83,0xab,0x42,0x6d,0xef,0xb4,0xdd,0x4a,0xd1,0x2e,0xad,0x2f,0x23,0x3d,0x52,0x48,0xa4,0x5,0x1d,0x4e,0x3a,0x10,0x45,0x7e,0x58,0x7e,0xd9,0xdf,0xf0,0x68,0x7,0xec,0xe3,0xf1,0xff,0x0,0x50,0xb8,0xd5,0xbe,0x1b,0xea,0x9e,0x24,0xf8,0x2f,0xac,0x5c,0x31,0x76,0xb7,0xd3,0x9b,0xfb,0x53,0x47,0x2c,0x79,0x63,0xf6,0x59,0xdb,0xcc,0x4e,0x7a,0x8,0xe6,0x44,0x51,0xc0,0x4e,0x98,0xef,0xc2,0xe6,0x78,0x9c,0x32,0xb5,0x29,0x69,0xd9,0xea,0x8c,0x6b,0x61,0xa9,0x55,0xd6,0x6b,0x5e,0xe7,0xc7,0x1e,0x3a,0xfd,0xbb,0xfe,0x8,0xfc,0x65,0xd3,0x3e,0x1c,0xf8,0x77,0xc0,0x3f,0x10,0xb4,0x3b,0xfd,0x37,0xc1,0xbe,0x11,0xb2,0xd1,0x11,0x6f,0x99,0xf4,0xc9,0x9a,0x68,0xf7,0x17,0x2,0x3b,0x91,0x1b,0x31,0xcb,0x1,0xf2,0xe4,0x1c,0x70,0x4d,0x1e,0x62,0xea,0x16,0xc,0xf6,0xec,0x97,0x11,0xb2,0x9c,0x34,0x4c,0x24,0x52,0x3d,0x88,0xaf,0x2c,0xf8,0xff,0x0,0xff,0x0,0x6,0x6c,0xfe,0xd2,0xff,0x0,0xe,0xee,0xe4,0x93,0xc0,0xfe,0x23,0xf8,0x71,0xf1,0x23,0x4f,0x2f,0xb6,0x31,0x1d,0xf4,0x9a,0x45,0xf6,0x38,0xf9,0x9e,0x2b,0x84,0xf2,0x80,0xf6,0x59,0xd8,0xd7,0x80,0xf8,0xdf,0xfe,0xd,0xae,0xfd,0xb7,0xbe,0x1d,0x4e,0xb0,0x9f,0x83,0x7a,0x96,0xa4,0xad,0xd1,0xf4,0x9d,0x7b,0x4f,0xba,0x51,0xff,0x0,0x7c,0xdc,0x64,0x7e,0x55,0xf8,0x77,0x13,0x78,0x4b,0x4f,0x36,0xcc,0x6a,0x66,0x5f,0x5a,0x71,0x95,0x47,0x76,0x9c,0x54,0xb5,0xf2,0x77,0x8e,0x9e,0xa7,0xee,0x9c,0x2f,0xe3,0x24,0xf2,0x9c,0xb6,0x96,0x5b,0x2c,0x2a,0x94,0x69,0xae,0x54,0xd4,0x9a,0x76,0xf3,0x56,0x7a,0x9f,0x4e,0xff,0x0,0xc1,0x70,0x35,0x3f,0x3b,0xf6,0xdf,0x8b,0x4f,0x2a,0x55,0xb4,0x7f,0xa,0x69,0x30,0x38,0x6e,0x30,0x5a,0xd9,0x64,0xe7,0xd3,0xad,0x78,0x27,0xec,0x79,0xa7,0xf8,0x37,0xc4,0x9f,0xb5,0x3f,0x82,0x6d,0x7c,0x71,0xe2,0xaf,0xe,0xf8,0x5b,0xc2,0xb6,0x1a,0x8a,0x6a,0x7a,0xbd,0xf6,0xa9,0xaa,0xdb,0xd8,0xc5,0x15,0xbd,0xb7,0xef,0x8a,0x86,0x95,0x94,0x33,0x3b,0x22,0x20,0x41,0x96,0x6d,0xe4,0x0,0x4d,0x79,0xda,0xff,0x0,0xc1,0xbe,0x1f,0xb6,0xbe,0xb3,0x77,0x87,0xf8,0xb,0xe3,0x49,0x24,0x72,0x1,0x79,0xef,0x2d,0x17,0x3e,0x99,0x66,0x9e,0xbd,0x17,0xe1,0xe7,0xfc,0x1a,0xa3,0xfb,0x68,0xf8,0xf0,0x86,0xb8,0xf8,0x79,0xa0,0xf8,0x6e,0x36,0x20,0x6f,0xd5,0xfc,0x4b,0x66,0x9b,0x73,0xea,0xb1,0x3c,0x8d,0xfa,0x57,0xf4,0x6,0x1f,0x3d,0x95,0xc,0x1c,0x70,0xb4,0xe1,0xf0,0xc7,0x96,0xf7,0xf2,0xb5,0xed,0x6f,0xd4,0xfc,0x16,0xbe,0x5,0x55,0xc4,0x4a,0xbc,0xdf,0xc4,0xdb,0xb7,0xce,0xf6,0x3d,0xbf,0xf6,0x89,0xff,0x0,0x82,0xa3,0x7c,0x21,0xf1,0xf,0xc5,0xf,0x12,0x78,0x8a,0xeb,0xc6,0x56,0x77,0x93,0x6a,0x77,0xd2,0x4e,0x96,0xfa,0x65,0xb4,0xd7,0x61,0x53,0xa2,0x2a,0xb0,0x5d,0x98,0xa,0x14,0xf,0x9b,0x8a,0xf9,0xdf,0xc7,0x5f,0xf0,0x59,0x8d,0x1f,0x48,0xbf,0x88,0xf8,0x4f,0xc1,0x37,0x5a,0xb0,0x86,0x45,0x93,0xce,0xd6,0xae,0x7e,0xcf,0x14,0x9b,0x58,0x10,0xc,0x51,0x6e,0x62,0xa7,0x1c,0xfe,0xf1,0x4f,0xd2,0xbe,0xca,0xfd,0x9f,0xff,0x0,0xe0,0xc9,0xaf,0x1e,0x6b,0xb2,0x5a,0x5c,0x7c,0x50,0xf8,0xd1,0xe1,0x9f,0xf,0xc2,0xc9,0xba,0x7b,0x4f,0xe,0x69,0x72,0xea,0x53,0x2b,0x67,0xee,0x9,0x66,0x30,0xa0,0xe3,0xf8,0x82,0xb7,0xd0,0xd7,0xde,0x5f,0xb3,0x17,0xfc,0x1a,0x59,0xfb,0x22,0xfc,0x6,0x68,0x2e,0xbc,0x47,0xa2,0x78,0xab,0xe2,0xb6,0xa9,0xe,0xd7,0xf3,0x7c,0x4f,0xab,0xba,0x5a,0xac,0x83,0x92,0xcb,0x6f,0x68,0x21,0x46,0x53,0xd3,0x64,0xbe,0x60,0xc7,0x5c,0x9e,0x6b,0xf1,0x5c,0x2f,0x85,0x19,0x24,0x31,0xf,0x15,0x89,0x52,0xab,0x39,0x37,0x27,0xcd,0x2d,0x2e,0xdd,0xf6,0x8a,0x8f,0xe3,0x73,0xf6,0x1c,0x5f,0x8c,0x19,0xec,0xf0,0xf1,0xc2,0x61,0x79,0x28,0xc2,0x29,0x45,0x72,0xc6,0xee,0xc9,0x5b,0x79,0x39,0x74,0xec,0x93,0x3f,0x9d,0xef,0x8c,0x9f,0xb5,0x77,0xc7,0xaf,0xf8,0x2a,0xdf,0xed,0x47,0x25,0xd5,0x86,0x95,0x7d,0xae,0x78,0xcb,0xc4,0x89,0x15,0x95,0x96,0x81,0xe0,0xcd,0x2e,0x5d,0xb0,0x41,0x10,0x21,0x22,0x85,0x14,0xc9,0x28,0x89,0x1,0x24,0x97,0x73,0x81,0x92,0xcd,0x81,0x91,0xf5,0xcf,0xec,0x9d,0xff,0x0,0x6,0x88,0xfe,0xd4,0x7f,0x1f,0x25,0x86,0xfb,0xc7,0x8d,0xe1,0x7f,0x84,0x3a,0x4d,0xc2,0x99,0x1d,0xb5,0x8b,0xd1,0xa8,0xea,0x4d,0x93,0xc6,0x2d,
-0xad,0x8b,0xd,0xc7,0xa9,0x12,0x4a,0x84,0x7d,0x78,0xaf,0xe9,0xb7,0xe0,0xc7,0xec,0xe9,0xe0,0x1f,0xd9,0xc7,0xc3,0x7f,0xd8,0xff,0x0,0xf,0xfc,0x13,0xe1,0x4f,0x4,0x69,0x5c,0x6e,0xb4,0xd0,0xb4,0x98,0x34,0xf8,0xa4,0x23,0xbb,0x8,0x95,0x77,0x1f,0x73,0x93,0x5d,0x98,0x18,0x15,0xfa,0x74,0xaa,0x4a,0x49,0x46,0x4d,0xb4,0xb6,0xf2,0xf4,0x3f,0x2a,0xd1,0x36,0xd7,0x53,0xf2,0x93,0xf6,0x4c,0xff,0x0,0x83,0x41,0x7f,0x66,0x3f,0x81,0x51,0xda,0xde,0x78,0xfa,0x7f,0x16,0x7c,0x60,0xd6,0xa1,0x2a,0xef,0xfd,0xa9,0x76,0x74,0xdd,0x2c,0xb0,0x3,0xee,0xda,0xdb,0x10,0xdb,0x49,0xc9,0xdb,0x24,0xd2,0xe,0x83,0xeb,0xfa,0xf,0xf0,0x2b,0xf6,0x1c,0xf8,0x35,0xfb,0x32,0x5a,0xc1,0x17,0xc3,0xdf,0x85,0x7f,0xf,0xfc,0x1b,0xf6,0x73,0xb9,0x26,0xd2,0x74,0x2b,0x6b,0x69,0xf7,0x7f,0x78,0xca,0xa9,0xbd,0x9b,0xfd,0xa6,0x62,0x6b,0xd5,0x28,0xa9,0x0,0x23,0x34,0x9b,0x7e,0xb4,0xb4,0x50,0x7,0x93,0x7c,0x73,0xfd,0x83,0x3e,0x9,0xfe,0xd3,0x51,0x5c,0x2f,0xc4,0xf,0x84,0xbf,0xe,0xfc,0x61,0x2d,0xd6,0x4c,0x97,0x1a,0xa6,0x81,0x6d,0x71,0x75,0x93,0xd5,0x84,0xc5,0x3c,0xc5,0x6f,0x75,0x60,0x7d,0xeb,0xe0,0x5f,0xda,0x73,0xfe,0xd,0x8,0xfd,0x95,0xbe,0x36,0xcb,0x71,0x79,0xe0,0xdf,0xf8,0x4d,0xbe,0x12,0xea,0x52,0x2b,0x18,0xe3,0xd1,0x35,0x4f,0xb6,0xe9,0xdb,0xcf,0xf1,0x3c,0x17,0x62,0x57,0xc7,0xfb,0x31,0xcb,0x18,0xaf,0xd5,0x3a,0x33,0x40,0x1f,0xcd,0x87,0xed,0x13,0xff,0x0,0x6,0x56,0xfc,0x66,0xf0,0x52,0xdc,0x5c,0x7c,0x33,0xf8,0xa5,0xe0,0x5f,0x1e,0x5b,0x46,0xa5,0xd2,0xd7,0x57,0xb5,0x9f,0x41,0xbc,0x97,0xae,0x11,0x40,0xfb,0x44,0x45,0xb1,0x81,0x96,0x91,0x1,0x27,0xb0,0xaf,0x87,0xbe,0x32,0xff,0x0,0xc1,0x26,0x7f,0x6c,0xcf,0xf8,0x27,0x84,0x9a,0x96,0xa1,0xa8,0xfc,0x35,0xf8,0x9d,0xe1,0x9b,0x16,0x81,0xad,0xef,0x75,0x7f,0xa,0xcc,0xfa,0x85,0x8c,0x96,0xec,0x8,0x65,0x9a,0x7b,0x7,0x75,0x58,0xd8,0x64,0x15,0x97,0x3,0x90,0x8,0xe7,0x15,0xfd,0x98,0x66,0x9b,0x8c,0x9e,0xb4,0xe,0xed,0x1f,0xc2,0x8f,0x87,0xbf,0x69,0x8f,0x14,0x78,0x7f,0x10,0xdc,0x49,0x6b,0xa8,0xac,0x7f,0x29,0x5b,0xa8,0xb0,0xeb,0x8e,0xdb,0x94,0xa9,0xcf,0xd7,0x35,0xdb,0x68,0x7f,0xb5,0x9e,0x9d,0x75,0x1e,0xdd,0x4b,0x4d,0xbc,0xb2,0x93,0x18,0xdf,0x3,0x89,0xa3,0x27,0xd7,0x7,0x69,0x1f,0xad,0x7f,0x5d,0xdf,0xb5,0xc7,0xfc,0x12,0xb3,0xf6,0x6f,0xfd,0xb2,0x2c,0x2e,0xae,0x7e,0x28,0x7c,0x27,0xf0,0x5e,0xb1,0x74,0xd1,0xca,0xd2,0xeb,0x22,0xd4,0x69,0xfa,0x84,0x4a,0xcb,0xf3,0x39,0xbb,0x80,0xc7,0x2f,0x18,0xdd,0x96,0x72,0x1,0x19,0xaf,0xc0,0xff,0x0,0xda,0x63,0xfe,0x9,0x79,0xff,0x0,0x4,0xff,0x0,0xf1,0x67,0x8e,0x35,0x43,0xf0,0xc7,0xe3,0xbf,0xc5,0xdf,0x6,0xf8,0x72,0xde,0x66,0xb3,0x3e,0x27,0x9f,0xc1,0x17,0xde,0x24,0xf0,0x4d,0xbd,0xc2,0x31,0x8d,0x87,0xf6,0x92,0x45,0x1e,0x62,0xde,0x31,0xe7,0x7,0x78,0x86,0xb,0x6f,0x2b,0xcd,0x7a,0x94,0x73,0xac,0x65,0x2d,0x14,0xee,0xbc,0xf5,0xff,0x0,0x82,0x72,0x54,0xc0,0xd0,0x9e,0xf1,0xb7,0xa6,0x87,0xbb,0xdf,0xfe,0xde,0x3f,0x5,0xfe,0x22,0xfe,0xc3,0x9f,0x3,0xfe,0x1f,0xf8,0x27,0xe2,0x47,0x86,0x6f,0xaf,0x34,0xd,0x30,0x7f,0x69,0xd8,0xcf,0x75,0xf6,0x1b,0x9b,0x69,0xd5,0x40,0x31,0x34,0x73,0x88,0xd9,0x98,0x33,0x12,0xa,0x82,0x8,0x4,0x82,0x6b,0x8e,0x6f,0x15,0x69,0x50,0xda,0x99,0x5f,0x56,0xd2,0x56,0x15,0xeb,0x21,0xbd,0x89,0x50,0x7e,0x25,0xb1,0x5e,0x2f,0xf1,0x3b,0xfe,0xd,0x9,0xfd,0xa6,0x74,0xbb,0xb,0x5d,0x5b,0xe1,0xff,0x0,0x88,0x3e,0x14,0x7c,0x56,0xf0,0xee,0xa9,0x12,0x5c,0xe9,0xd7,0xba,0x46,0xbc,0x6d,0x5a,0xea,0xdd,0xc6,0xe8,0xe5,0xc4,0xe8,0xb1,0x15,0x65,0x2a,0xc0,0xa4,0xae,0x8,0x61,0x82,0x47,0x35,0xc5,0x69,0x7f,0xf0,0x6a,0x7,0xed,0xad,0xa8,0x4c,0x12,0x6f,0x87,0xde,0x19,0xb1,0x5c,0xe3,0x74,0xfe,0x2d,0xd3,0xd9,0x47,0xbe,0x12,0x56,0x38,0xfc,0x33,0x5f,0x8a,0xf1,0x87,0x85,0xf1,0xcf,0xf3,0x39,0xe6,0x55,0x31,0x2e,0xe,0x56,0xba,0xe5,0x4d,0x2b,0x2b,0x68,0xf9,0x91,0xfb,0x67,0x6,0xf8,0xb3,0x2c,0x83,0x2c,0x8e,0x5b,0xc,0x2a,0x9a,0x8b,0x6e,0xfc,0xed,0x37,0x77,0x7d,0x57,0x2b,0xf4,0xdc,0xf6,0xbf,0x1e,0xfe,0xd5,0xff,0x0,0xd,0xfe,0x1a,0xd8,0x4f,0x36,0xab,0xe3,0x4f,0xf,0x7,0x85,0x77,0x7d,0x9e,0xda,0xf1,0x2e,0x2e,0x1f,0xd9,0x51,0x9,0x24,0xd7,0xc3,0xbf,0xb6,0x6f,0xfc,0x14,0x2f,0xc5,0x9f,0xb6,0xa6,0x89,0xe1,0xff,0x0,0x85,0x7e,0x1c,0xb1,0xbb,0x8f,0xc0,0xfa,0x7e,0xbc,0xfa,0x8e,0x93,0xa4,0x41,0x6e,0x66,0xd4,0x35,0x8d,0x4a,0x75,0x58,0x15,0xd8,0x28,0x2c,0xcc,0x57,0xe4,0x8e,0x25,0xee,0xe7,0xef,0x12,0x31,0xf6,0xf7,0xc1,0x4f,0xf8,0x32,0xf3,0xf6,0x88,0xf1,0x5e,0xbd,0x63,0xff,0x0,0x9,0xc7,0x8f,0xbe,0x15,0xf8,0x2f,0x45,0x92,0x41,0xf6,0xb7,0xb2,0xb9,0xbb,0xd5,0xb5,0x8,0x53,0xb9,0x48,0x44,0x31,0x44,0xec,0x3a,0x60,0xce,0xa3,0xde,0xbf,0x63,0x7f,0xe0,0x9b,0x3f,0xf0,0x6f,0xd7,0xec,0xeb,0xff,0x0,0x4,0xd0,0xd4,0x6d,0x3c,0x45,0xe1,0x9f,0xf,0xde,0x78,0xbb,0xe2,0x15,0xba,0xfc,0xbe,0x2b,0xf1,0x34,0x8b,0x77,0x7b,0x6c,0xc5,0x70,0xdf,0x66,0x8d,0x55,0x61,0xb6,0xfe,0x20,0x1a,0x34,0xf3,0x36,0xb1,0x53,0x23,0xa,0xf4,0xb8,0x43,0xc3,0x7c,0xe,0x43,0x5d,0xe2,0xe9,0xce,0x53,0xa9,0x6b,0x5d,0xe8,0x92,0x7b,0xd9,0x2e,0xfe,0x6d,0x9e,0x4f,0x19,0xf8,0xa1,0x98,0x71,0xe,0x1d,0x60,0xea,0x53,0x8d,0x3a,0x57,0x4e,0xcb,0x56,0xda,0xda,0xed,0xf6,0xf2,0x48,0xf3,0xaf,0xf8,0x36,0xdb,0xfe,0x8,0xfb,0x7d,0xff,0x0,0x4,0xc5,0xfd,0x95,0xaf,0xb5,0xef,0x1d,0x59,0xc1,0xf,0xc5,0xdf,0x89,
-0xc6,0x1b,0xcd,0x6a,0x10,0x3,0x36,0x81,0x66,0x80,0x9b,0x7d,0x3b,0x78,0x24,0x17,0x52,0xcf,0x24,0xa5,0x70,0xb,0xc8,0x13,0xe6,0x11,0x2b,0x9f,0xd2,0x4a,0x15,0x76,0xf4,0xa2,0xbf,0x44,0x3f,0x33,0xa,0x28,0xa2,0x80,0xa,0x28,0xa2,0x80,0xa,0x28,0xa2,0x80,0xa,0x28,0xa2,0x80,0xa,0x28,0xa2,0x80,0xa,0x28,0xa2,0x80,0xa,0x28,0xa2,0x80,0xa,0x28,0xa2,0x80,0xa,0x28,0xa2,0x80,0xa,0x28,0xa2,0x80,0xa,0x28,0xa0,0x9c,0xa,0x0,0xf1,0xbf,0xf8,0x28,0x1f,0xed,0x91,0xa1,0xfe,0xc0,0x3f,0xb1,0xbf,0xc4,0xf,0x8b,0x9a,0xfa,0xac,0xd6,0xbe,0xd,0xd2,0xda,0xe2,0xda,0xd5,0x9b,0x6f,0xf6,0x85,0xe3,0x91,0x15,0xad,0xb0,0x3d,0x47,0x9b,0x3b,0xc4,0x99,0xc1,0xda,0x18,0x9e,0x80,0xd7,0x8e,0x7f,0xc1,0xc,0xff,0x0,0xe0,0xa3,0xb7,0x7f,0xf0,0x52,0x9f,0xd8,0x37,0x45,0xf1,0x57,0x89,0x4,0x76,0xff,0x0,0x11,0xfc,0x2f,0x73,0x27,0x86,0xbc,0x69,0x6a,0x21,0x16,0xef,0x1e,0xa5,0x6e,0x17,0x74,0xa6,0x2c,0x28,0x8f,0xce,0x8d,0xa3,0x94,0xa8,0x1,0x55,0x9d,0xd0,0x63,0x66,0x7,0xc7,0x5f,0xf0,0x5b,0x7f,0xda,0x53,0xc0,0x5f,0xb5,0xb7,0xfc,0x15,0x17,0xe0,0xef,0xec,0xb3,0xe3,0xf,0x1e,0xf8,0x1f,0xc1,0xbf,0xb,0xbe,0x1b,0x4d,0x1f,0xc4,0x5f,0x89,0x57,0x7e,0x23,0xd7,0xac,0xf4,0xab,0x5b,0xcb,0x95,0x41,0xfd,0x9f,0xa6,0x16,0xb9,0x74,0x57,0x73,0x1c,0xc2,0x46,0x88,0x12,0x5e,0x3b,0xc0,0xe0,0x7e,0xeb,0x22,0xaf,0xc3,0x8f,0xda,0xe7,0xe0,0xef,0xec,0x57,0xff,0x0,0x7,0x2,0x5b,0xde,0x7c,0x30,0xf8,0xa9,0xf0,0xdf,0xc6,0x5f,0xa,0xff,0x0,0x6c,0x4b,0x8,0xac,0xb5,0xc8,0x3c,0x37,0xe2,0x7b,0x1d,0x4d,0x74,0x2f,0x16,0x5b,0x36,0xc8,0x27,0x95,0x6d,0xe4,0x73,0x1a,0xdd,0x19,0x76,0x82,0xf8,0xf3,0x26,0xbc,0x98,0x82,0x44,0x78,0xa0,0xf,0xd9,0x56,0x6c,0x55,0x6d,0x57,0x5b,0xb3,0xd0,0xed,0x7c,0xfb,0xdb,0xab,0x7b,0x38,0x37,0x5,0xf3,0x27,0x95,0x63,0x4c,0x9e,0x83,0x2c,0x40,0xc9,0xaf,0x89,0x7f,0xe0,0xe4,0x9d,0xb2,0xff,0x0,0xc1,0x11,0xfe,0x3d,0xe4,0x6,0x1f,0xd9,0x96,0x7,0x91,0xdf,0xfb,0x52,0xcf,0x15,0xe1,0xff,0x0,0xb1,0xff,0x0,0xfc,0x10,0x83,0xc2,0xbf,0xb6,0x67,0xc1,0xcf,0xb,0xfc,0x52,0xfd,0xae,0xa7,0xd7,0x3e,0x2c,0x7c,0x48,0xf1,0x26,0x91,0x4,0xf1,0xe9,0xf7,0x7a,0xb5,0xcd,0xa6,0x93,0xe1,0x2b,0x57,0x8d,0x4c,0x5a,0x7d,0x8d,0xb4,0x12,0x22,0xc5,0x1c,0x48,0x11,0x58,0xe5,0x8b,0xc8,0x1d,0xc9,0x25,0x89,0x20,0x1f,0xaa,0x5e,0x68,0x38,0xc7,0xcc,0x1b,0xa1,0x1d,0xe9,0x59,0xb6,0xd7,0xe4,0x97,0x8a,0xbe,0x10,0xea,0x1f,0xf0,0x6e,0xd7,0xed,0x83,0xf0,0x7a,0xeb,0xe1,0xcf,0x89,0x3c,0x49,0x7f,0xfb,0x2b,0xfc,0x75,0xf1,0x54,0x5e,0x6,0xd7,0x7c,0x13,0xad,0x5f,0xb5,0xf4,0x1e,0xa,0xd6,0x6e,0xf2,0xd6,0x97,0xda,0x74,0x8e,0x4b,0xa2,0x3e,0xc9,0x4c,0xaa,0x49,0xca,0xc5,0x26,0xe2,0xe5,0xa1,0xf2,0x7b,0xcf,0xf8,0x2a,0x5f,0xc4,0xcf,0x88,0x9f,0xb6,0xf7,0xfc,0x14,0x37,0xc1,0x5f,0xb1,0x7f,0xc3,0xbf,0x18,0x6b,0x1f,0xf,0xbc,0x27,0x75,0xe1,0x83,0xe3,0x6f,0x89,0xfe,0x22,0xd0,0xee,0x7c,0x8d,0x5a,0x7d,0x39,0xe7,0x68,0x21,0xd2,0xed,0xe5,0xeb,0x7,0x98,0x54,0x34,0x8d,0x83,0xb9,0x27,0x4e,0xaa,0xb2,0x45,0x28,0x7,0xe9,0x3d,0xb6,0xb9,0x67,0x79,0x7f,0x71,0x6b,0xd,0xd5,0xb4,0xd7,0x56,0xb8,0xf3,0xa1,0x49,0x55,0xa4,0x87,0x3d,0x37,0x28,0x39,0x19,0xf7,0xab,0x3b,0xfd,0xab,0xf3,0x9e,0x5f,0xf8,0x35,0xf3,0xf6,0x5f,0xf0,0xd7,0x83,0xec,0xff,0x0,0xe1,0x5,0xd3,0x3c,0x61,0xf0,0xd7,0xc7,0x9a,0x3a,0xf9,0xba,0x47,0x8d,0xbc,0x3b,0xe2,0x5b,0xe8,0x75,0x9d,0x32,0xe8,0xf,0x96,0x74,0x66,0x95,0x90,0x90,0x7a,0x82,0xbc,0x82,0x40,0x2a,0x48,0x61,0xf2,0x7f,0xfc,0x12,0xe7,0x4d,0xf8,0x81,0xe1,0xff,0x0,0x9,0x7f,0xc1,0x52,0xf4,0x9f,0x8a,0x5a,0x85,0x9e,0xb1,0xe3,0xcd,0x36,0xd6,0xf2,0xcb,0x5c,0xd4,0xad,0x6d,0x96,0xde,0xd,0x62,0x78,0x74,0xad,0x46,0x21,0x7a,0xb1,0x8e,0x14,0x4e,0x8a,0xb3,0x6d,0x0,0x1,0xe6,0x9f,0x95,0x7e,0xe8,0x0,0xfd,0xc3,0xba,0xd4,0xa0,0xb2,0x68,0x84,0xd2,0xc7,0x9,0x9e,0x41,0x14,0x41,0xdc,0x2f,0x98,0xe4,0x12,0x15,0x73,0xd5,0xb0,0x9,0xc0,0xf4,0x35,0xf0,0xa7,0xc6,0x9f,0xda,0x67,0xe2,0xf,0x86,0xff,0x0,0xe0,0xe1,0xf,0x84,0x3f,0xa,0xf4,0xff,0x0,0x11,0x6a,0x31,0x7c,0x3a,0xf1,0xf,0xc2,0xcb,0xfd,0x67,0x51,0xd0,0xd5,0x14,0xda,0xdc,0x5e,0x47,0x75,0x72,0xab,0x70,0xdf,0x2e,0xed,0xea,0xa8,0x83,0xef,0x63,0x81,0xc7,0x26,0xbe,0x49,0xff,0x0,0x83,0x7b,0xff,0x0,0xe0,0x91,0x3e,0x9,0xfd,0xa7,0xff,0x0,0x62,0x7f,0x84,0x7f,0x1b,0xbe,0x35,0xc7,0xaa,0x78,0xf3,0xc5,0x1a,0x3c,0x91,0xc9,0xe0,0x78,0x2f,0xb5,0x9,0x96,0xc7,0xc2,0x76,0x36,0x17,0x8c,0x6d,0x61,0x82,0xd9,0x59,0x62,0x2a,0xd2,0xc4,0xd3,0x48,0x1d,0x58,0x48,0x65,0x3b,0x81,0xe7,0x77,0x5,0xfb,0x46,0xff,0x0,0xc1,0x10,0x7f,0x67,0x15,0xff,0x0,0x82,0xff,0x0,0x7c,0x37,0xf8,0x47,0x1f,0x82,0x6e,0xe3,0xf0,0x3f,0x8f,0x3e,0x1e,0xea,0x5e,0x2b,0xd6,0x2c,0x86,0xb5,0x7a,0x5e,0xe3,0x51,0xfb,0x65,0xd0,0x13,0x9,0xc,0xbb,0xd4,0x61,0x14,0x6d,0x56,0xb,0xc7,0x4a,0x0,0xfd,0xb1,0xf8,0xff,0x0,0xf1,0xa3,0x4b,0xfd,0x9c,0x7e,0x3,0x78,0xd3,0xe2,0x6,0xb8,0x97,0x12,0x68,0xde,0x6,0xd0,0xef,0x75,0xeb,0xe8,0xe0,0x1,0xa6,0x92,0x1b,0x58,0x1e,0x67,0x54,0x7,0x3,0x71,0x54,0x20,0x64,0x81,0x92,0x3a,0x57,0xe6,0x3e,0xb9,0xff,0x0,0x5,0x4c,0xfd,0xaf,0xad,0x17,0xc3,0xbe,0x23,0xb8,0xd3,0xbe,0x2,0xf8,0x7a,0xcf,0xc5,0x3a,0x45,0xbf,0x88,0x2c,0xbc,0x27,0x71,0xa6,0xea,0x37,0x93,0x5a,0xda,0x5c,0x6e,0x31,0x45,0x73,0x7e,0x97,0xa,0x44,0xd8,0x5f,
-0x99,0x96,0xdf,0x68,0xe0,0x85,0x23,0x83,0xfa,0x43,0x27,0xec,0xad,0xe1,0x13,0xfb,0x26,0x49,0xf0,0x55,0x6d,0x6e,0xa2,0xf0,0x1c,0x9e,0x14,0x6f,0x5,0xad,0xba,0xcc,0x5a,0x68,0x74,0xd3,0x69,0xf6,0x31,0x1a,0xbb,0x6e,0x3b,0x96,0x1c,0x0,0xcd,0x93,0x90,0x9,0xc9,0xaf,0xc7,0x6d,0x6f,0x53,0xf1,0x17,0xc3,0xdd,0x5b,0x4f,0xf8,0x3b,0xf1,0x43,0x75,0xa7,0xc5,0x8f,0x84,0xba,0x72,0x78,0x79,0x9d,0xed,0xc,0x10,0xf8,0xbf,0x43,0x80,0xb7,0xd8,0x35,0xcb,0x59,0x19,0xcf,0x9c,0x92,0xab,0x3a,0x48,0x10,0x7e,0xe5,0xe3,0x31,0xb9,0xc,0x2b,0xf3,0x5f,0x14,0x33,0x9c,0xe3,0x2a,0xca,0x7e,0xbf,0x94,0xbb,0x72,0xbf,0x7b,0x45,0x2d,0x2e,0x96,0xa9,0xa7,0xa6,0xf7,0x6a,0xdd,0x35,0x3f,0x50,0xf0,0x9f,0x24,0xc9,0xb3,0x7c,0xdf,0xfb,0x3f,0x38,0x57,0x53,0x5e,0xea,0xbb,0x5a,0xd9,0xbd,0x1a,0x6b,0x5d,0xb7,0x37,0xff,0x0,0xe0,0xa7,0x7f,0xf0,0x5b,0xe8,0x3e,0x31,0x7f,0xc1,0x38,0x7c,0x67,0xf0,0xff,0x0,0xc7,0x9e,0x17,0xd7,0xfe,0xf,0x78,0xcb,0xc4,0x77,0xba,0x56,0x9b,0xa8,0x3d,0x9d,0xeb,0x5f,0xe9,0x3e,0x22,0xd1,0xa4,0xd4,0x6d,0xd7,0x51,0x8e,0xc3,0x50,0x89,0x54,0x89,0x1e,0xd3,0xce,0xf,0x4,0xe9,0x1c,0x9e,0x53,0x49,0x80,0xe3,0x24,0x7e,0x8f,0xfc,0xf,0x5f,0x5,0xe8,0xff,0x0,0x2,0xb4,0xcd,0x27,0xc3,0xfa,0x6f,0x87,0xee,0x3e,0x17,0xb6,0x87,0xf,0xf6,0x53,0xda,0xac,0x1f,0x61,0x82,0xc0,0x5b,0x8d,0xa8,0x57,0xa1,0x8c,0xae,0x8,0x23,0x20,0x86,0xcf,0x4a,0xfc,0xa3,0xf8,0x9a,0xbe,0x1e,0x6f,0x87,0x5a,0xe7,0xfc,0x25,0x90,0xe9,0xf7,0x1e,0x18,0x4b,0x39,0x26,0xd5,0x62,0xbf,0x8d,0x64,0xb7,0x68,0x10,0x6f,0x6d,0xea,0xdc,0x1c,0x6d,0xc8,0xef,0x90,0x31,0xce,0x2b,0xf3,0x1f,0xc2,0xba,0x8d,0xbe,0x99,0xac,0xde,0x79,0xd6,0x1e,0x2d,0xd4,0xbe,0x13,0xea,0x93,0xcb,0x2c,0x3f,0xf,0x97,0xc5,0x17,0x96,0x90,0xd8,0x5b,0xb4,0x9b,0xe3,0xda,0x3c,0xcd,0x92,0x3e,0xde,0x5a,0x29,0x0,0x4,0xb9,0x1b,0xc1,0x19,0xae,0x5f,0xc,0x38,0xf3,0x30,0xe2,0x8c,0x1d,0x79,0xcb,0x8,0xdd,0x4a,0x9,0x36,0xe1,0x6b,0x4a,0xfd,0x12,0x93,0x56,0x96,0x8f,0x4b,0xb5,0xd6,0xeb,0x44,0x7a,0x5e,0x27,0xf8,0x71,0x81,0xe1,0x8c,0x75,0x8,0x51,0xc5,0xa5,0x4e,0xbb,0x69,0x29,0xdf,0x9a,0x9,0x6e,0xdb,0x8a,0x77,0x8e,0xda,0xd9,0x3f,0x27,0xab,0x3f,0x60,0x3f,0xe0,0x98,0x1f,0xf0,0x52,0xef,0x19,0x7c,0x19,0xf8,0x2d,0xf1,0x27,0xc1,0x5f,0x9,0x7e,0x1e,0xe8,0xde,0x3f,0xf8,0x73,0xe1,0xdf,0x89,0x1a,0xe4,0x3e,0x9,0xf1,0xf,0x89,0x7c,0x77,0x65,0xe1,0xad,0x6,0xd3,0x46,0x79,0x95,0xe1,0xb3,0xb3,0xde,0x25,0xb8,0x9d,0x23,0x90,0xcc,0x50,0x47,0x10,0x8d,0x63,0x74,0x1b,0xc1,0xe2,0xbe,0xe6,0xff,0x0,0x82,0x7d,0xff,0x0,0xc1,0x59,0x6c,0xbf,0x6b,0xff,0x0,0x8a,0x3a,0x8f,0xc3,0x4f,0x18,0x78,0x2e,0xe7,0xe1,0xb7,0xc5,0x2d,0x37,0x4e,0x7d,0x5e,0x2b,0x5,0xd5,0x22,0xd5,0xb4,0x9d,0x76,0xca,0x39,0x16,0x29,0x27,0xb1,0xbc,0x40,0x9e,0x61,0x8d,0xdd,0x77,0xc6,0xf1,0xa3,0xa8,0x75,0x61,0xb9,0x49,0x23,0xf2,0xbb,0xf6,0x72,0xf8,0x91,0xe0,0x5f,0x88,0x1f,0xa,0x6d,0x6e,0x3c,0x7,0xf6,0x4b,0x3f,0xf,0xe9,0x9,0xf6,0x56,0xb1,0x10,0xfd,0x95,0xf4,0x72,0x83,0x26,0x19,0xa2,0x3c,0xc4,0xcb,0xc9,0x3b,0xb8,0x3f,0x7b,0x24,0x1c,0xd7,0xd3,0x7f,0xf0,0x45,0xcf,0x83,0x3a,0x97,0xed,0x31,0xfb,0x6e,0xff,0x0,0xc2,0xf2,0xb1,0x86,0x61,0xf0,0xbf,0xe1,0xbe,0x81,0x7f,0xe1,0xed,0xb,0x58,0x31,0x95,0x83,0xc4,0xfa,0xb5,0xe4,0x91,0xad,0xd3,0xda,0xb1,0xff,0x0,0x5b,0x6b,0x6f,0xc,0x3e,0x59,0x95,0x72,0x8d,0x2c,0x84,0x2b,0x37,0x96,0xd8,0xf2,0x38,0x4f,0xc4,0x5c,0xef,0x39,0xe2,0x29,0xe5,0xb3,0xc1,0xfb,0x2a,0x34,0xf9,0xb9,0xf9,0x93,0xe6,0x85,0xaf,0xcb,0x7e,0x8a,0x4d,0xd9,0x5b,0xae,0xad,0x68,0x8f,0x53,0x8c,0x3c,0x33,0xc8,0xb2,0x4e,0x1b,0x8e,0x67,0x1c,0x6f,0xb5,0xad,0x3e,0x5e,0x4b,0x35,0xcb,0x2b,0xdb,0x9a,0xdd,0x5a,0x4a,0xee,0xfd,0x34,0x4f,0x53,0xf5,0xe8,0x1c,0x8a,0x28,0x1d,0x28,0xaf,0xda,0xcf,0xc2,0x42,0x8a,0x28,0xa0,0x2,0x8a,0x28,0xa0,0x2,0x8a,0x28,0xa0,0x2,0x8a,0x28,0xa0,0x2,0x8a,0x28,0xa0,0x2,0x8a,0x28,0xa0,0x2,0x8a,0x28,0xa0,0x2,0x8a,0x28,0xa0,0x2,0x8a,0x28,0xa0,0x2,0x8a,0x28,0xa0,0x2,0x8a,0x28,0xa0,0x2,0xbc,0xe7,0xf6,0xb8,0xfd,0xa6,0xbc,0x39,0xfb,0x1a,0x7e,0xcc,0xfe,0x36,0xf8,0xa5,0xe2,0xc9,0xbc,0xad,0x3,0xc0,0xfa,0x4c,0xda,0xa5,0xca,0x7,0x54,0x92,0xe9,0x90,0x62,0x2b,0x78,0xcb,0x71,0xe6,0x4d,0x29,0x48,0x90,0x1e,0xaf,0x22,0x8e,0xf5,0xe8,0xd5,0x9b,0xe2,0xdf,0x7,0xe9,0x5e,0x3d,0xf0,0xf5,0xc6,0x93,0xad,0xe9,0xb6,0x1a,0xbe,0x97,0x78,0x0,0x9e,0xd2,0xf6,0xdd,0x27,0x82,0x6d,0xac,0x18,0x6e,0x46,0x5,0x4e,0x18,0x2,0x32,0x38,0x20,0x1e,0xa2,0x80,0x3f,0x25,0x7f,0xe0,0x8f,0xdf,0xf0,0x47,0xdf,0x2,0xfe,0xdb,0x3f,0xb3,0xce,0xab,0xfb,0x41,0x7e,0xd3,0x9e,0x2,0xd1,0xfc,0x71,0xf1,0x2b,0xe3,0xce,0xb5,0x73,0xe3,0x27,0xfe,0xd3,0x85,0x98,0x69,0x56,0x97,0xd,0x9b,0x6b,0x78,0x46,0x7e,0x58,0xfc,0xa0,0xae,0xab,0xfc,0x2b,0x22,0xa7,0x44,0x18,0xf4,0xdf,0xf8,0x28,0x2f,0xfc,0x1b,0x89,0xf0,0x2b,0xc7,0x9f,0xb1,0xff,0x0,0x8d,0xad,0xbe,0xa,0xfc,0x35,0xd0,0xbc,0xb,0xf1,0x6b,0x4f,0xb2,0xfe,0xd5,0xf0,0x96,0xaf,0xa4,0xee,0xb7,0xb9,0x4d,0x42,0xd9,0x84,0xd1,0x42,0x24,0xdc,0x2,0x89,0x8a,0x79,0x45,0x8f,0xdd,0xf3,0x3,0xf5,0x51,0x5f,0xa4,0xda,0x3e,0x8f,0x6b,0xe1,0xfd,0x32,0x1b,0x3b,0x2b,0x78,0x6d,0x6d,0x6d,0x90,0x47,0x14,0x51,0x20,0x54,0x8d,0x47,0x40,0x0,0xe0,0x1,0x56,0x48,0xcd,0x0,0x7e,0x3f,0xfe,0xd8,0x7f,0xb7,0xad,0xbf,0xfc,0x14,0x73,
-0xfe,0xd,0x4e,0xf8,0x8d,0xf1,0x1a,0x49,0x22,0x5f,0x13,0xff,0x0,0x62,0xd9,0x69,0x1e,0x2a,0xb5,0x55,0xf2,0xda,0xc7,0x57,0xb6,0xd4,0xec,0x92,0xe5,0xa,0x7f,0x0,0x73,0xb6,0x55,0x5e,0xc9,0x32,0x74,0xe9,0x5e,0xc7,0xff,0x0,0x4,0xf9,0xff,0x0,0x82,0xe4,0x7c,0x27,0xf0,0xe7,0xc0,0x5f,0xb,0xfc,0x3f,0xfd,0xa0,0xbc,0x49,0xa6,0xfc,0xf,0xf8,0xcb,0xe0,0xdd,0x16,0xd6,0xd3,0x5b,0xd2,0x7c,0x52,0x4d,0x85,0xae,0xa4,0x8b,0x12,0x88,0xb5,0xb,0x2b,0x96,0x1e,0x44,0xf0,0x5c,0x20,0x12,0x28,0x47,0x2c,0xa4,0xb2,0xe0,0xa8,0x57,0x6f,0x49,0xff,0x0,0x82,0xdb,0xfe,0xca,0xd7,0xdf,0x11,0x3f,0xe0,0x92,0x5f,0x1d,0xbc,0x1f,0xf0,0xb3,0xc1,0x2b,0xa8,0x78,0xa3,0xc5,0xf6,0xf6,0xb7,0x9,0xa5,0xe8,0x96,0x49,0x1d,0xc6,0xa9,0x70,0x2f,0xed,0x64,0x92,0x42,0xaa,0x6,0xf9,0x3c,0xb8,0xd9,0x89,0x3c,0x90,0x9d,0xf8,0xaf,0x67,0xf0,0xa7,0xec,0xab,0xe0,0x5f,0x8d,0x9f,0xb3,0xaf,0x80,0xb4,0x9f,0x89,0x5f,0xf,0xfc,0x29,0xe2,0xa9,0xb4,0x9d,0x16,0xd2,0x2f,0xb3,0x78,0x87,0x45,0xb7,0xbf,0x36,0x72,0x2c,0x4a,0x19,0x40,0x99,0x1b,0x69,0xd,0x9e,0x9d,0xe8,0x3,0xf3,0xaf,0xf6,0xa5,0xfd,0xa5,0x74,0xef,0xf8,0x2f,0x8f,0xed,0xaf,0xf0,0x67,0xe1,0x7f,0xc1,0x14,0xbc,0xf1,0x17,0xc1,0x5f,0x82,0x7e,0x35,0xb7,0xf1,0xdf,0x8e,0x3c,0x70,0xd6,0x72,0x5b,0xe9,0xb7,0xb7,0xf6,0x61,0xd2,0xd6,0xc2,0xc9,0xe4,0x55,0x69,0x78,0x92,0x70,0xec,0x6,0xd6,0x59,0x43,0xa9,0x2a,0x80,0xbf,0xa1,0x7f,0xc1,0x4a,0xe3,0xd7,0xff,0x0,0xe0,0x9a,0x3f,0xf0,0x54,0xbf,0x4,0xfe,0xd9,0x11,0x78,0x6b,0x54,0xf1,0x2f,0xc1,0xed,0x63,0xc2,0x1f,0xf0,0xaf,0xfe,0x27,0x36,0x95,0x6c,0x6e,0x6f,0x3c,0x37,0x1a,0xdc,0x19,0xad,0xb5,0x53,0x18,0x3b,0x9a,0x11,0x98,0xd1,0xf6,0x8c,0x2a,0xc0,0xc0,0xfc,0xd2,0x26,0x7f,0x47,0xfe,0x1f,0xfc,0x2b,0xf0,0xe7,0xc2,0x8d,0x6,0x1d,0x2f,0xc3,0x3a,0x1e,0x93,0xe1,0xfd,0x36,0xdc,0x6d,0x8a,0xd7,0x4f,0xb4,0x4b,0x78,0x63,0x1e,0x81,0x50,0x0,0x7,0xb0,0xad,0xcb,0xcb,0x48,0xef,0xed,0xa4,0x86,0x68,0xd2,0x58,0x65,0x52,0x8e,0x8e,0xbb,0x95,0xd4,0x8c,0x10,0x41,0xea,0x8,0xed,0x40,0x1f,0x17,0x78,0xf7,0xfe,0xe,0x16,0xfd,0x90,0xbc,0x19,0xf0,0xae,0x3f,0x13,0xd9,0x7c,0x64,0xd0,0x7c,0x5d,0x25,0xe4,0x6a,0x74,0xed,0x7,0xc3,0xd1,0xcb,0x7f,0xaf,0x6a,0x53,0x30,0xfd,0xdd,0xba,0x59,0x5,0x12,0xa4,0xae,0xd8,0x50,0x26,0x11,0xa8,0x24,0x6e,0x65,0x1c,0xd7,0xc0,0x5f,0xf0,0x4a,0xcf,0x89,0xde,0x2c,0xf8,0xc3,0xe0,0xef,0xf8,0x2a,0x47,0x8b,0x3c,0x79,0xa0,0xc9,0xe1,0x3f,0x14,0xf8,0x82,0xce,0xf7,0x51,0xbd,0xd1,0x27,0x91,0x5e,0x5d,0x15,0x64,0xd2,0xf5,0x26,0x8a,0xd6,0x46,0x50,0x1,0x78,0xa2,0xd9,0x1b,0x12,0x1,0xca,0x1c,0x80,0xd9,0x3,0xf6,0x3,0xc2,0x7f,0xb1,0xf,0xc1,0xdf,0x1,0x78,0xd6,0x4f,0x12,0x68,0x5f,0xb,0x7e,0x1e,0xe8,0xbe,0x20,0x95,0x8b,0xbe,0xa5,0x61,0xe1,0xeb,0x4b,0x6b,0xa9,0x9,0xea,0x5a,0x48,0xe3,0xc,0xd9,0xf7,0x26,0xbb,0x4b,0x1f,0x86,0x3e,0x1d,0xd2,0xf5,0xd,0x5a,0xea,0xd7,0x43,0xd1,0xed,0xee,0x35,0xf5,0xdb,0xa9,0xc9,0x1d,0x9c,0x6a,0xda,0x80,0xc1,0x5f,0xdf,0x60,0x7e,0xf3,0xe5,0x24,0x7c,0xd9,0xe0,0x91,0x40,0x1f,0x24,0xff,0x0,0xc1,0xbb,0xbb,0x4f,0xfc,0x11,0xa3,0xe0,0x4e,0xdc,0x7f,0xc8,0x5,0xba,0x7f,0xd7,0x79,0x6b,0xc8,0x7f,0x68,0xe9,0x57,0xfe,0x22,0x9a,0xf8,0xa,0xbb,0x97,0x77,0xfc,0x29,0xad,0x4b,0x8c,0xf3,0xff,0x0,0x1f,0x97,0x9f,0xe0,0x7f,0x2a,0xfd,0x20,0xf0,0x8f,0x83,0xb4,0xbf,0x1,0x68,0x30,0xe9,0x7a,0x2e,0x9f,0x65,0xa5,0x69,0xb6,0xa0,0x88,0x6d,0x6d,0x21,0x58,0x61,0x88,0x13,0x9c,0x2a,0x28,0x0,0xf,0xa0,0xa8,0x6f,0xfc,0x1,0xa2,0xea,0x9e,0x2b,0xb3,0xd7,0xae,0x34,0x9d,0x36,0x6d,0x6f,0x4f,0x8d,0xa1,0xb5,0xd4,0x1e,0xd9,0x1a,0xea,0x8,0xdb,0xef,0x22,0xc9,0x8d,0xc1,0x4e,0x4f,0x0,0xe3,0x9a,0x0,0xd6,0x91,0x72,0xb5,0xfc,0xd5,0xff,0x0,0xc1,0x68,0x3c,0x6f,0x3f,0x89,0xff,0x0,0x6f,0x5f,0x8d,0x9a,0x97,0x89,0x35,0x6d,0x56,0xdf,0xe2,0xc7,0x83,0xfc,0x77,0xa5,0x69,0x7e,0xd,0x93,0xcd,0x9a,0x19,0xbc,0x31,0xe1,0x88,0xb4,0xa9,0x66,0x47,0xb4,0x51,0x88,0xc,0x77,0x57,0x37,0x1,0x9f,0x78,0x72,0xc6,0x32,0x31,0x86,0x7c,0xff,0x0,0x4a,0x9b,0x3e,0x4d,0xb5,0xf2,0xd7,0xed,0xfd,0xff,0x0,0x4,0x73,0xf8,0x27,0xff,0x0,0x5,0x1d,0xd6,0x6c,0x75,0xcf,0x1c,0xe9,0x7a,0xc6,0x93,0xe2,0xfd,0x3a,0xdb,0xec,0x50,0x78,0x97,0xc3,0x97,0xe7,0x4f,0xd5,0xd,0xb0,0x62,0xc2,0x9,0x5b,0x6b,0x47,0x3c,0x61,0x89,0x2a,0xb2,0xa3,0xed,0x2c,0xdb,0x76,0xee,0x39,0xdf,0xf,0x2a,0xa,0x76,0xc4,0xc3,0x9e,0xe,0xe9,0xa7,0xd5,0x35,0xe7,0xa1,0x32,0x95,0x58,0xfb,0xd4,0x24,0xe3,0x25,0xaa,0x6a,0xe9,0xa6,0xba,0xdd,0x6a,0x8f,0xe6,0xd3,0xf6,0x82,0xfd,0xb6,0xfc,0x4d,0xf1,0x33,0xe1,0x2e,0x99,0xe1,0x3f,0x16,0x59,0xda,0x59,0x69,0xad,0x78,0x92,0xeb,0x5a,0xe5,0x88,0x22,0xdf,0x54,0x8a,0x32,0xad,0x6f,0x14,0x91,0x72,0x60,0x2d,0x36,0xd6,0x90,0x82,0x51,0xb6,0x28,0x1b,0x43,0x15,0x1c,0x7d,0xad,0xdc,0x57,0xf6,0xb1,0xdc,0x43,0x2c,0x73,0xc3,0x32,0xee,0x8e,0x58,0xd8,0x32,0xc8,0xf,0x70,0x47,0x4,0x57,0xf4,0x85,0xfb,0x27,0xff,0x0,0xc1,0xbd,0x3f,0xb3,0x4f,0xec,0xa3,0xe3,0x1b,0x3f,0x12,0xa7,0x86,0xf5,0x7f,0x88,0x9e,0x24,0xd3,0x64,0xf3,0x6c,0x75,0xf,0x1b,0x5f,0xff,0x0,0x6b,0x8b,0x7,0x18,0x21,0xe1,0xb7,0xda,0x96,0xc9,0x20,0x20,0x11,0x20,0x8b,0x78,0x23,0x21,0x81,0xac,0xdf,0xdb,0x17,0xfe,0xd,0xd0,0xfd,0x9d,0x7f,0x6a,0xff,0x0,0x13,0x5f,0x78,0x8f,0x4d,0xd3,0x75,0xaf,0x84,0xde,0x2a,0xd4,0xa4,0x33,0xde,
-0x5f,0xf8,0x2a,0xe2,0x3b,0x1b,0x6b,0xf9,0x4f,0x59,0x27,0xb1,0x91,0x1e,0xd5,0x9d,0x8e,0x4b,0x48,0xb1,0x24,0x8e,0x49,0x2c,0xe4,0xd6,0xfc,0x33,0x4f,0x29,0xc8,0x21,0x3c,0x2e,0x55,0x87,0xf6,0x74,0xa5,0x27,0x26,0x96,0xf7,0x76,0xbf,0xcb,0xa2,0x5d,0x16,0x8b,0xb1,0xd1,0xc4,0x59,0x96,0x69,0x9e,0xd6,0x8e,0x2b,0x34,0xae,0xea,0x54,0x8c,0x54,0x53,0x7d,0x96,0xdb,0x75,0xea,0xdf,0x57,0xab,0x3f,0x9f,0xff,0x0,0xd9,0x7e,0xff,0x0,0xc1,0xfe,0x12,0xfd,0xac,0x7e,0x1d,0xea,0x5e,0x3c,0xd1,0x47,0x89,0x3e,0x1e,0xea,0x5e,0x23,0xd3,0xf4,0xbf,0x18,0x68,0x72,0x5d,0xdc,0x41,0x6b,0xab,0x59,0xcf,0x3a,0xdb,0xa4,0xb3,0x24,0x2e,0xbe,0x7b,0x5b,0x49,0x32,0xcc,0xb1,0xbe,0x55,0xc2,0xb2,0x30,0x2a,0x71,0x5f,0xd7,0xf,0x86,0x3c,0x29,0xa6,0xf8,0x33,0xc3,0xd6,0x5a,0x3e,0x8f,0xa7,0xd8,0xe9,0x3a,0x4e,0x99,0xa,0x5b,0x59,0xd9,0x59,0x40,0xb0,0x5b,0xda,0xc4,0x83,0xb,0x1c,0x71,0xa8,0xa,0xaa,0xa0,0x0,0x14,0x0,0x0,0x15,0xf9,0xd3,0xfb,0x1d,0xff,0x0,0xc1,0xb2,0x3f,0x8,0x7f,0x66,0x4f,0x8d,0xfa,0x1f,0x8f,0x3c,0x49,0xe3,0x2f,0x1b,0x7c,0x51,0xd4,0xbc,0x2d,0x77,0x1e,0xa3,0xa3,0xd8,0x6b,0x2,0xda,0xd7,0x4d,0xb5,0xbb,0x8d,0xb7,0x45,0x70,0xf0,0xdb,0xc6,0xbe,0x73,0xc6,0xc1,0x59,0x37,0xb1,0x55,0x60,0xe,0xd2,0x71,0x8f,0xd2,0x60,0x31,0x4f,0x33,0xad,0x42,0xbe,0x21,0xd6,0xa1,0x1e,0x5e,0x6b,0x5f,0xbb,0x7b,0x5d,0xdb,0xca,0xcb,0xe4,0x71,0xe1,0xfd,0xb4,0x69,0x2a,0x75,0x65,0x7b,0x6d,0xd9,0x2d,0xec,0x85,0xa2,0x8a,0x2b,0x80,0xd8,0x28,0xa2,0x8a,0x0,0x28,0xa2,0x8a,0x0,0x28,0xa2,0x8a,0x0,0x28,0xa2,0x8a,0x0,0x28,0xa2,0x8a,0x0,0xff,0xd9,0x0};
+#include "asset.h"
+#include "EVE.h"
 
-const /*__flash*/ uint8_t logo2[3844] =
+/*
+ * Inflate an asset into RAM_G at Addr
+ */
+int Asset_load(Asset *Ast, const Asset_Data *Data, uint32_t Addr)
 {
-   0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x01, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x05, 0x03, 0x04, 0x04, 0x04, 0x03, 0x05, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x06, 0x07, 0x0C, 0x08, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x0B, 0x0B, 0x09, 0x0C, 0x11, 0x0F, 0x12, 0x12, 0x11, 0x0F, 0x11, 0x11, 0x13, 0x16, 0x1C, 0x17, 0x13,
-   0x14, 0x1A, 0x15, 0x11, 0x11, 0x18, 0x21, 0x18, 0x1A, 0x1D, 0x1D, 0x1F, 0x1F, 0x1F, 0x13, 0x17, 0x22, 0x24, 0x22, 0x1E, 0x24, 0x1C, 0x1E, 0x1F, 0x1E, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x05, 0x05, 0x05, 0x07, 0x06, 0x07, 0x0E, 0x08, 0x08, 0x0E, 0x1E, 0x14, 0x11, 0x14, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
-   0x1E, 0x138E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0xFF, 0xC0, 0x00, 0x11, 0x08, 0x00, 0x64, 0x00, 0x64, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xFF, 0xC4, 0x00, 0x1B, 0x00, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
-   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x07, 0x04, 0x03, 0x08, 0x01, 0xFF, 0xC4, 0x00, 0x3B, 0x10, 0x00, 0x01, 0x03, 0x03, 0x03, 0x02, 0x04, 0x04, 0x03, 0x06, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x11, 0x00, 0x04, 0x05, 0x06, 0x12, 0x21, 0x07, 0x31, 0x13, 0x22, 0x41, 0x61, 0x32, 0x51, 0x71, 0x81, 0x14, 0x15, 0x17, 0x08, 0x42, 0x54, 0x91, 0xD2, 0xE2,
-   0x66, 0x93, 0xA4, 0xC1, 0x16, 0x23, 0x24, 0x52, 0x82, 0x94, 0xA1, 0xFF, 0xC4, 0x00, 0x1B, 0x01, 0x00, 0x03, 0x00, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x03, 0x04, 0x07, 0x01, 0x02, 0xFF, 0xC4, 0x00, 0x36, 0x11, 0x00, 0x01, 0x02, 0x04, 0x04, 0x03, 0x06, 0x04, 0x05, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03,
-   0x00, 0x04, 0x05, 0x11, 0x21, 0x31, 0x41, 0x51, 0x06, 0x12, 0x71, 0x13, 0x22, 0x61, 0x81, 0x91, 0xF0, 0x14, 0xA1, 0xB1, 0xC1, 0x15, 0x42, 0xD1, 0xE1, 0xF1, 0x16, 0x23, 0x32, 0x33, 0xB2, 0xD2, 0xFF, 0xDA, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00, 0xFB, 0x2E, 0x94, 0xA5, 0x10, 0x42, 0x94, 0xA5, 0x10, 0x42, 0xA0, 0xF5, 0xEE, 0x5D, 0x58, 0x3D, 0x21, 0x92,
-   0xC9, 0xB6, 0xA5, 0xA5, 0xD6, 0x99, 0x29, 0x69, 0x49, 0x48, 0x25, 0x2E, 0x28, 0x84, 0xA0, 0xC1, 0xE2, 0x02, 0x88, 0x27, 0xDB, 0xE7, 0x53, 0x95, 0x90, 0xFE, 0xD1, 0x79, 0x64, 0x86, 0x71, 0xB8, 0x26, 0xD4, 0x82, 0xA5, 0x28, 0xDD, 0x3A, 0x0A, 0x4E, 0xE4, 0x81, 0x29, 0x44, 0x1E, 0xD0, 0x65, 0x7C, 0x77, 0xE0, 0x76, 0xF5, 0xC3, 0x30, 0xE7, 0x66, 0xD9, 0x54, 0x34, 0xA3, 0x49, 0xFC, 0x64,
-   0xF3, 0x6D, 0x11, 0x85, 0xEE, 0x7A, 0x0C, 0x4F, 0xE9, 0x14, 0x8E, 0x91, 0x65, 0xD5, 0x88, 0xD7, 0x96, 0x0A, 0xDC, 0xB0, 0xD5, 0xDA, 0xBF, 0x0A, 0xE8, 0x4A, 0x41, 0x2A, 0x0B, 0x80, 0x91, 0xCF, 0x61, 0xBF, 0x61, 0x31, 0xCC, 0x0F, 0xB5, 0x7D, 0x2B, 0x5F, 0x36, 0x6B, 0x8D, 0x32, 0xBC, 0x2E, 0x0F, 0x0F, 0x75, 0xB9, 0xB2, 0xA0, 0xD7, 0x83, 0x71, 0xB5, 0xBD, 0xA4, 0xB8, 0x54, 0xB5, 0x82,
-   0x4F, 0xAF, 0x07, 0x6F, 0x3C, 0xC2, 0x07, 0xD0, 0x6F, 0xBA, 0x3F, 0x2C, 0x9C, 0xE6, 0x98, 0xC7, 0xE5, 0x42, 0x90, 0x54, 0xFB, 0x20, 0xB9, 0xB1, 0x24, 0x24, 0x38, 0x38, 0x58, 0x00, 0xF3, 0x01, 0x40, 0x8F, 0xB7, 0xAD, 0x2C, 0xA3, 0x4E, 0xB3, 0x34, 0xD9, 0x2D, 0x2A, 0xE3, 0xDD, 0xF3, 0x8A, 0x0E, 0x2D, 0x42, 0x1F, 0xEC, 0xE7, 0x5A, 0xC8, 0xDD, 0x27, 0xC8, 0xE1, 0xEB, 0x8C, 0x4B, 0x52,
-   0x94, 0xA7, 0x31, 0x17, 0x0A, 0x52, 0x94, 0x41, 0x0A, 0x52, 0x94, 0x41, 0x0A, 0x52, 0x94, 0x41, 0x0A, 0x52, 0x94, 0x41, 0x0A, 0xC1, 0x75, 0x1D, 0xC2, 0xB5, 0x47, 0x59, 0x8B, 0x5F, 0xF3, 0x8D, 0xBD, 0x9B, 0xDE, 0x0A, 0x46, 0xD0, 0x0A, 0x12, 0xD4, 0x95, 0x72, 0x3D, 0x0A, 0xF7, 0x19, 0x3C, 0xC1, 0x03, 0x8E, 0x05, 0x6C, 0x9A, 0xC3, 0x2C, 0x9C, 0x1E, 0x98, 0xC8, 0x65, 0x4A, 0x90, 0x14,
-   0xC3, 0x24, 0xB7, 0xBD, 0x24, 0xA4, 0xB8, 0x78, 0x40, 0x20, 0x73, 0x05, 0x44, 0x0F, 0xBF, 0xA5, 0x63, 0x1D, 0x1A, 0xB3, 0x42, 0x15, 0x91, 0xCC, 0xDC, 0x25, 0x28, 0x6D, 0xA4, 0x86, 0xD2, 0xEA, 0x8C, 0x01, 0xFB, 0xCB, 0xFA, 0x40, 0xDB, 0xCF, 0xBF, 0xD6, 0xA6, 0xB8, 0xA6, 0x73, 0xE1, 0xE4, 0x57, 0x6C, 0xC8, 0xB7, 0xAE, 0x03, 0xEB, 0x7F, 0x28, 0xAB, 0xE1, 0xE6, 0xC3, 0x12, 0xEF, 0xCE,
-   0xAB, 0x41, 0xCA, 0x3A, 0x9C, 0xFD, 0x30, 0x8B, 0xA6, 0xBC, 0xB0, 0xFC, 0xC3, 0x49, 0xDF, 0xB0, 0x10, 0xB5, 0xAD, 0x2D, 0xF8, 0x88, 0x08, 0xEE, 0x54, 0x9E, 0x47, 0xD7, 0xB7, 0x6A, 0xF1, 0xFD, 0x9D, 0xF2, 0x5E, 0x3E, 0x9C, 0xBE, 0xC6, 0x2D, 0x6F, 0x29, 0x76, 0x97, 0x01, 0xC4, 0xEE, 0x32, 0x94, 0xA1, 0x63, 0x84, 0xA7, 0x9E, 0x3C, 0xC9, 0x59, 0x23, 0xDF, 0xDC, 0xD7, 0x3E, 0x98, 0xD5,
-   0x6F, 0x66, 0xF2, 0x2B, 0xB0, 0xBC, 0xB7, 0xB7, 0x69, 0xBF, 0x09, 0x45, 0x90, 0x15, 0xC9, 0xE6, 0x76, 0x99, 0xF8, 0x8C, 0x13, 0xDA, 0x3B, 0x1E, 0x3E, 0x55, 0x7E, 0x9E, 0x5C, 0x0D, 0x2F, 0xD5, 0xA5, 0xE3, 0xDD, 0x4A, 0x5A, 0x62, 0xE1, 0xC5, 0xDA, 0x79, 0x81, 0x51, 0x09, 0x59, 0x0A, 0x6E, 0x20, 0xF7, 0x24, 0x20, 0x49, 0x9E, 0x09, 0x9F, 0x98, 0x9C, 0xE1, 0x30, 0xE5, 0x3E, 0x69, 0x72,
-   0x8E, 0xE7, 0x82, 0xBD, 0x45, 0x8F, 0xA1, 0xB0, 0x8F, 0x69, 0x93, 0x2D, 0x55, 0xE9, 0x2F, 0xB6, 0xC9, 0xBF, 0x2F, 0x78, 0x79, 0x67, 0xF2, 0xFA, 0xC6, 0xFF, 0x00, 0x4A, 0x52, 0xBA, 0x44, 0x49, 0xC2, 0x94, 0xA5, 0x10, 0x42, 0x94, 0xA5, 0x10, 0x46, 0x6D, 0xFA, 0xCD, 0xA6, 0x3F, 0x80, 0xCB, 0xFF, 0x00, 0x94, 0xDF, 0xF5, 0xD3, 0xF5, 0x9B, 0x4C, 0x7F, 0x03, 0x97, 0xFF, 0x00, 0x29, 0xBF,
-   0xEB, 0xAA, 0x47, 0x51, 0x3A, 0x65, 0x7D, 0x81, 0xF1, 0x2F, 0xF0, 0xE1, 0xEB, 0xEC, 0x5A, 0x1B, 0xDE, 0xE1, 0x51, 0x05, 0xD6, 0x62, 0x27, 0x70, 0x11, 0xB8, 0x7A, 0xC8, 0x1C, 0x09, 0x98, 0x89, 0x2D, 0x0A, 0x9D, 0x09, 0x97, 0xC7, 0xB3, 0x8E, 0xC9, 0xE2, 0x91, 0x6F, 0x99, 0xDE, 0x96, 0xD0, 0xAF, 0x1D, 0xED, 0xB7, 0x33, 0xD8, 0x88, 0x54, 0x25, 0x5E, 0x84, 0x18, 0x04, 0x9E, 0x3B, 0xC0,
-   0x4B, 0x33, 0x3A, 0xFC, 0xBA, 0x14, 0xA5, 0x8F, 0xF1, 0x17, 0xB5, 0xB1, 0x36, 0xDA, 0x3A, 0x0F, 0xE1, 0x34, 0x65, 0xCB, 0x09, 0x96, 0x52, 0xA5, 0xA7, 0x5E, 0x53, 0x88, 0xEA, 0x30, 0xB7, 0xB3, 0x96, 0x31, 0x68, 0xC8, 0xF5, 0xAE, 0xC5, 0x0F, 0x81, 0x8F, 0xC1, 0x5C, 0x5C, 0x35, 0xB7, 0x95, 0x3E, 0xF0, 0x69, 0x41, 0x5F, 0x28, 0x01, 0x5C, 0x76, 0xE6, 0x7E, 0xD5, 0xCB, 0xFA, 0xDD, 0xFE,
-   0x1A, 0xFF, 0x00, 0x5B, 0xFD, 0x95, 0x3B, 0x8B, 0xD2, 0x1A, 0x7A, 0xD8, 0xAD, 0xAB, 0x6C, 0x3D, 0xA2, 0xCB, 0xD0, 0x0F, 0x8E, 0x3C, 0x5E, 0xDD, 0xA0, 0xAE, 0x76, 0xF7, 0xF4, 0x89, 0xAE, 0x4C, 0xC3, 0x3A, 0x37, 0x11, 0x7A, 0x6C, 0xEF, 0xF1, 0xF8, 0xB6, 0x9F, 0x09, 0x0A, 0x52, 0x05, 0xA2, 0x56, 0x52, 0x0F, 0x69, 0xDA, 0x93, 0x07, 0xDB, 0xE9, 0xF3, 0xA9, 0x94, 0x71, 0x73, 0xCF, 0x8E,
-   0x79, 0x76, 0x56, 0xA4, 0xEE, 0x12, 0x33, 0xDB, 0x0B, 0xC2, 0xD7, 0x5F, 0xE1, 0xF9, 0x71, 0xFD, 0xC6, 0xAC, 0x37, 0x2A, 0xB7, 0xDE, 0xD1, 0x4C, 0xEA, 0x07, 0x52, 0x9D, 0xD5, 0x58, 0x34, 0xE2, 0xDB, 0xC6, 0x2E, 0xC1, 0x3E, 0x32, 0x5C, 0x71, 0x49, 0xBA, 0x2B, 0x0E, 0x24, 0x03, 0xE5, 0x23, 0x68, 0xE2, 0x48, 0x3F, 0x54, 0x8A, 0x96, 0xB4, 0x47, 0xE4, 0xDD, 0x29, 0x69, 0x12, 0x86, 0x9F,
-   0xBD, 0x48, 0x32, 0x91, 0x3B, 0xFC, 0x43, 0x3C, 0xF1, 0xDF, 0xC3, 0xE3, 0xED, 0xF4, 0xAE, 0xBB, 0xBC, 0x9E, 0x85, 0x65, 0xB0, 0xB6, 0xF1, 0x56, 0x77, 0x24, 0x98, 0xDA, 0xDD, 0x8A, 0x41, 0x1E, 0xFE, 0x60, 0x05, 0x43, 0xEB, 0x3D, 0x41, 0x6F, 0x9B, 0x4D, 0xA3, 0x76, 0x89, 0xB9, 0x6D, 0x0D, 0x15, 0x15, 0xA5, 0xC0, 0x00, 0x24, 0xC4, 0x1E, 0x09, 0xED, 0xCF, 0xF3, 0xAD, 0x49, 0x89, 0x89,
-   0xAA, 0xBB, 0xEC, 0xA5, 0xC6, 0x54, 0x94, 0x85, 0x5C, 0x92, 0x36, 0xD2, 0x12, 0xF1, 0x07, 0x12, 0xD3, 0x45, 0x31, 0x52, 0x92, 0x36, 0x1A, 0xD8, 0x2A, 0xF8, 0x9C, 0x33, 0xF3, 0xBE, 0x7A, 0x44, 0x56, 0x15, 0xF7, 0x31, 0xB9, 0x7B, 0x0B, 0xD7, 0x0A, 0x99, 0x6F, 0xC4, 0x0A, 0xDE, 0x51, 0x20, 0xB7, 0x25, 0x2A, 0x23, 0x8E, 0x44, 0x6E, 0x1C, 0x7C, 0x8F, 0xAD, 0x76, 0xF5, 0x82, 0xD5, 0x56,
-   0x39, 0xFB, 0x0C, 0xBD, 0xAB, 0x85, 0x97, 0x5E, 0x47, 0xC4, 0xDC, 0xA5, 0x41, 0x6D, 0x91, 0x0B, 0x91, 0xEB, 0x05, 0x23, 0xFF, 0x00, 0x1A, 0xB1, 0xF5, 0x2F, 0x4D, 0xA3, 0x13, 0xA6, 0xB0, 0x6F, 0x36, 0x86, 0x92, 0xB6, 0x1B, 0xFC, 0x33, 0xE5, 0x2B, 0x51, 0xDC, 0xA3, 0x2B, 0x91, 0x3E, 0x9B, 0xBC, 0x43, 0xE9, 0xF1, 0x0F, 0xB7, 0x3B, 0x7A, 0xAF, 0x06, 0xF6, 0x2A, 0xD6, 0xCF, 0x29, 0x8F,
-   0xB8, 0xBE, 0x53, 0x48, 0x46, 0xF2, 0xEB, 0x48, 0x70, 0x15, 0x84, 0xC1, 0x57, 0x99, 0x5D, 0xFB, 0xF3, 0xEF, 0x5B, 0xB5, 0x99, 0x77, 0xE5, 0x67, 0x9A, 0x9A, 0x65, 0x05, 0x56, 0x04, 0x28, 0x0D, 0xB4, 0xF9, 0xC2, 0x2E, 0x11, 0xAB, 0x22, 0x83, 0x32, 0xB6, 0xE6, 0x4D, 0x93, 0x60, 0x7A, 0xDC, 0x62, 0x3E, 0x9E, 0x91, 0xEA, 0x3A, 0xDD, 0x02, 0x3F, 0xE1, 0xAF, 0xF5, 0xBF, 0xD9, 0x4F, 0xD6,
-   0xEF, 0xF0, 0xD7, 0xFA, 0xDF, 0xEC, 0xAF, 0x6F, 0xC6, 0xE8, 0x1F, 0xE0, 0xF1, 0xDF, 0xFA, 0x1F, 0xDB, 0x53, 0x58, 0x9C, 0x2E, 0x9C, 0xC9, 0x58, 0x7E, 0x63, 0x61, 0x89, 0xC5, 0x3D, 0x6E, 0x14, 0x41, 0x57, 0xE1, 0x9B, 0xE0, 0x8F, 0x42, 0x08, 0x90, 0x7D, 0x88, 0xF5, 0x1F, 0x3A, 0x3F, 0xAA, 0x27, 0x00, 0xB9, 0x97, 0x5D, 0x86, 0x7D, 0xDD, 0x3D, 0x22, 0xCD, 0xB9, 0xFE, 0x1C, 0x75, 0x5C,
-   0xAD, 0xB4, 0x09, 0xF0, 0x59, 0xFF, 0x00, 0xD4, 0x71, 0x59, 0x75, 0xA3, 0x04, 0xBB, 0x64, 0x2A, 0xF7, 0x17, 0x91, 0x65, 0xF3, 0x3B, 0x90, 0xD6, 0xC7, 0x12, 0x39, 0xE2, 0x14, 0x54, 0x92, 0x78, 0x8F, 0x41, 0x5E, 0xDF, 0xAC, 0xDA, 0x63, 0xF8, 0x1C, 0xBF, 0xF9, 0x4D, 0xFF, 0x00, 0x5D, 0x72, 0x64, 0xB4, 0x96, 0x8D, 0xB7, 0x43, 0xF9, 0x2B, 0xFC, 0x7B, 0x2C, 0x32, 0x82, 0x5C, 0x79, 0x5E,
-   0x2B, 0x89, 0x42, 0x64, 0xFF, 0x00, 0xDA, 0x93, 0xC0, 0x93, 0x00, 0x01, 0xEA, 0x00, 0x1D, 0xAB, 0x37, 0xD5, 0x0A, 0xC2, 0xE5, 0x33, 0x27, 0x1B, 0xA3, 0x74, 0xFA, 0xC3, 0x41, 0x50, 0xDB, 0x88, 0x2F, 0x38, 0xF3, 0xF0, 0x0C, 0x90, 0x92, 0xA3, 0x09, 0xF5, 0x88, 0x9E, 0x24, 0x91, 0x24, 0x06, 0x94, 0xCA, 0xF9, 0xA8, 0xA1, 0x4B, 0x68, 0x10, 0x06, 0x18, 0x8C, 0xFA, 0x5A, 0xF0, 0xD6, 0x52,
-   0x95, 0x49, 0x9C, 0x51, 0xEC, 0xDA, 0x58, 0x1A, 0x9B, 0xF7, 0x47, 0x9D, 0xFF, 0x00, 0x78, 0xD4, 0xFF, 0x00, 0x59, 0xB4, 0xC7, 0xF0, 0x19, 0x8F, 0xB3, 0x4D, 0xFF, 0x00, 0x5D, 0x2A, 0x37, 0x4D, 0x74, 0x6E, 0xC9, 0xCC, 0x43, 0x4E, 0xEA, 0x0B, 0xCB, 0xD6, 0xEF, 0x97, 0xE6, 0x53, 0x56, 0xAE, 0x20, 0x25, 0xB1, 0xE8, 0x92, 0x4A, 0x4C, 0x9F, 0x99, 0x1C, 0x7A, 0x09, 0x89, 0x2A, 0x76, 0x0C,
-   0xD9, 0x17, 0xC2, 0x34, 0x5C, 0x47, 0x0D, 0xA1, 0x65, 0x37, 0x51, 0xB6, 0xD7, 0xB4, 0x6B, 0x67, 0x9A, 0xCA, 0xBA, 0x85, 0xD2, 0x96, 0x2F, 0x3F, 0xEB, 0xF4, 0xB3, 0x6D, 0x5A, 0xBE, 0x37, 0x29, 0xDB, 0x55, 0x28, 0x84, 0x39, 0xDC, 0xCA, 0x3D, 0x12, 0x67, 0x88, 0xE1, 0x3D, 0xBE, 0x18, 0xE7, 0x55, 0xA5, 0x6D, 0xB8, 0xD2, 0x5D, 0x16, 0x50, 0x89, 0xB9, 0x0A, 0x8C, 0xC4, 0x83, 0x9D, 0xA3,
-   0x0A, 0xB6, 0xE3, 0x43, 0xD4, 0x47, 0xCF, 0xBA, 0x4F, 0x5D, 0xDF, 0x62, 0xEE, 0x0E, 0x33, 0x51, 0xA6, 0xE1, 0xE4, 0x87, 0x8A, 0x56, 0xF3, 0xA4, 0x97, 0x99, 0x32, 0x77, 0x05, 0x03, 0xCA, 0xA0, 0xFD, 0xC7, 0x3D, 0xF8, 0x15, 0x6C, 0xD5, 0x3A, 0x6E, 0xDF, 0x34, 0xD3, 0x99, 0x5B, 0x07, 0xCA, 0xEE, 0xDC, 0x42, 0x14, 0x88, 0x58, 0x2D, 0xBC, 0x90, 0x20, 0x41, 0xF4, 0x24, 0x44, 0x19, 0x8E,
-   0x3D, 0xE4, 0x5A, 0xFA, 0x83, 0xA1, 0xF1, 0xDA, 0xBA, 0xD9, 0xB2, 0xE2, 0xFF, 0x00, 0x09, 0x7C, 0xD7, 0x0D, 0x5D, 0x25, 0x1B, 0x8E, 0xD9, 0xE5, 0x2A, 0x12, 0x37, 0x0E, 0xF1, 0xCF, 0x07, 0xB7, 0x72, 0x0E, 0x41, 0x67, 0x79, 0xA8, 0xFA, 0x79, 0x99, 0x36, 0x19, 0x5B, 0x77, 0x57, 0x64, 0xA5, 0x94, 0xED, 0x32, 0x5B, 0x70, 0x08, 0x25, 0x6D, 0x28, 0xF1, 0x3C, 0x8F, 0xE7, 0x04, 0x03, 0xDA,
-   0x16, 0xA9, 0x43, 0x7E, 0x4D, 0xE3, 0x39, 0x21, 0x82, 0xB5, 0x1A, 0x2B, 0xCB, 0x7F, 0x78, 0x18, 0xA3, 0x99, 0x92, 0x90, 0xE2, 0x46, 0x08, 0x6D, 0x21, 0x2E, 0x66, 0x53, 0xF7, 0x49, 0xDF, 0xD9, 0xDC, 0xFB, 0x69, 0x75, 0xE1, 0x2D, 0x72, 0xC5, 0x9D, 0x49, 0x60, 0xF3, 0xAC, 0xA8, 0xF8, 0x6A, 0x21, 0xC5, 0x23, 0xC1, 0x33, 0xC9, 0x29, 0x1C, 0x9F, 0x4E, 0x27, 0x81, 0x3C, 0x13, 0x15, 0xAE,
-   0x59, 0xE8, 0x8D, 0x20, 0x7C, 0x1B, 0xAB, 0x7C, 0x6B, 0x6E, 0xA4, 0xC3, 0x8D, 0xAB, 0xC7, 0x5A, 0xD0, 0xA1, 0xDC, 0x18, 0x2A, 0x20, 0x8F, 0xFE, 0x1A, 0xA9, 0xEB, 0x4B, 0x6C, 0x76, 0x53, 0x4D, 0x23, 0x2E, 0xB5, 0xEC, 0x28, 0x65, 0x2E, 0xB0, 0xE8, 0x4C, 0x95, 0x25, 0x70, 0x52, 0x83, 0xEC, 0x49, 0x1F, 0x42, 0x4F, 0xBC, 0xC8, 0xF4, 0x41, 0xCB, 0xF5, 0xE2, 0x2F, 0x52, 0xF3, 0x8A, 0x55,
-   0x93, 0x6E, 0xA5, 0x36, 0xE0, 0x90, 0x42, 0x55, 0x04, 0xAC, 0x0F, 0x50, 0x39, 0x49, 0xF9, 0x72, 0x63, 0xD6, 0x9C, 0x50, 0x6A, 0x6D, 0xD4, 0x10, 0x6E, 0x8B, 0x11, 0x81, 0x04, 0x64, 0x75, 0xF7, 0x9C, 0x73, 0x14, 0x48, 0x09, 0x09, 0xBF, 0x84, 0x79, 0x21, 0x57, 0xC4, 0x1B, 0x0B, 0x8E, 0xBE, 0xFF, 0x00, 0x6B, 0xBE, 0x63, 0x17, 0x61, 0x97, 0xB2, 0x36, 0x79, 0x1B, 0x64, 0xBE, 0xC6, 0xE0,
-   0xAD, 0xA4, 0x90, 0x41, 0x1D, 0x88, 0x23, 0x90, 0x7E, 0x9F, 0x33, 0x54, 0xDD, 0x51, 0x81, 0xD0, 0x3A, 0x76, 0xC9, 0x37, 0x37, 0xF8, 0xD5, 0x12, 0xB3, 0xB5, 0xB6, 0x9B, 0x7D, 0xC2, 0xB5, 0x9F, 0x58, 0x05, 0x43, 0x81, 0xEA, 0x7F, 0xDC, 0x8A, 0xBF, 0x56, 0x17, 0xAB, 0x51, 0x73, 0x7B, 0xD4, 0x47, 0xAC, 0xF3, 0x0F, 0x3D, 0x0A, 0xBA, 0x0D, 0x23, 0x6C, 0x12, 0x96, 0x94, 0x7C, 0x80, 0x7A,
-   0x01, 0x04, 0x7F, 0x32, 0x48, 0x26, 0x69, 0xCC, 0xF3, 0xC8, 0x61, 0xA2, 0xE2, 0x85, 0xED, 0xE1, 0xB4, 0x67, 0xAA, 0x14, 0x21, 0x29, 0x21, 0xB0, 0xA5, 0x28, 0xD8, 0x12, 0x06, 0x11, 0x15, 0x84, 0xC4, 0x3B, 0x9A, 0xCA, 0x29, 0x9B, 0x44, 0x2D, 0xAB, 0x60, 0xA9, 0x5A, 0xD7, 0xE6, 0xF0, 0x91, 0x3C, 0x49, 0xE3, 0x72, 0xBF, 0x94, 0xFB, 0x09, 0x8B, 0xC3, 0xB7, 0x78, 0x8D, 0x0F, 0x82, 0x69,
-   0xAB, 0xA7, 0xDD, 0x58, 0x5B, 0x93, 0xB5, 0x02, 0x5C, 0x75, 0x66, 0x02, 0x8A, 0x52, 0x48, 0x00, 0x00, 0x07, 0xA8, 0x1C, 0x0E, 0x64, 0xF3, 0xE5, 0xAB, 0xF3, 0x56, 0x9A, 0x3B, 0x0E, 0xCA, 0x2C, 0x6C, 0xDA, 0x0F, 0x3F, 0x29, 0x61, 0xB0, 0x98, 0x4C, 0xA4, 0x00, 0x54, 0xA8, 0xE4, 0xF0, 0x47, 0xB9, 0xF9, 0xF7, 0x35, 0x58, 0xD1, 0xDA, 0x17, 0x39, 0xAD, 0x2E, 0xD5, 0x97, 0xCF, 0x5C, 0xDC,
-   0xDB, 0x5A, 0x12, 0x95, 0x07, 0x5C, 0x47, 0x9D, 0xF0, 0x61, 0x50, 0xD8, 0x3C, 0x04, 0xC1, 0xE1, 0x51, 0x1C, 0x88, 0x07, 0x98, 0x80, 0x6D, 0xB9, 0x9E, 0x21, 0x72, 0xE4, 0x14, 0xB0, 0x0E, 0x5A, 0xAB, 0xAF, 0x87, 0xB1, 0x8E, 0x31, 0x5D, 0xC3, 0xBC, 0x2D, 0x2D, 0x20, 0xCF, 0xC6, 0xCE, 0x2E, 0xC3, 0x7D, 0xFC, 0x12, 0x3E, 0xF9, 0xC4, 0x7B, 0x08, 0xD4, 0xFD, 0x49, 0xCD, 0xBB, 0x6F, 0x68,
-   0x7C, 0x2B, 0x44, 0x42, 0xCA, 0x16, 0xB5, 0x0B, 0x76, 0x00, 0x9D, 0xBB, 0xA0, 0x72, 0xA3, 0x24, 0x4C, 0x49, 0x93, 0xD8, 0x0E, 0x36, 0x8D, 0x0F, 0xA2, 0xF0, 0xFA, 0x56, 0xD8, 0x7E, 0x11, 0xAF, 0x16, 0xF5, 0x6D, 0x84, 0x3F, 0x74, 0xBF, 0x89, 0xCE, 0x64, 0xC0, 0xEC, 0x91, 0x3E, 0x83, 0xE4, 0x26, 0x48, 0x9A, 0x9C, 0xC5, 0x63, 0xEC, 0xF1, 0x78, 0xF6, 0x6C, 0x2C, 0x2D, 0xD1, 0x6F, 0x6C,
-   0xCA, 0x76, 0xB6, 0x84, 0x8E, 0x00, 0xFF, 0x00, 0x73, 0xEA, 0x49, 0xE4, 0x9E, 0x4D, 0x74, 0xD5, 0xEC, 0x95, 0x3D, 0xA9, 0x46, 0xC2, 0x10, 0x32, 0xF9, 0x46, 0x6A, 0xA5, 0x75, 0xC9, 0xB4, 0xF6, 0x0C, 0x8E, 0x46, 0x86, 0x83, 0x5E, 0xBB, 0xF4, 0xFA, 0xE7, 0x0A, 0x52, 0x95, 0xBF, 0x08, 0x61, 0x4A, 0x52, 0x88, 0x21, 0x5F, 0x3F, 0xF5, 0x49, 0xE1, 0xA8, 0x7A, 0xB0, 0x8C, 0x5F, 0xE2, 0x19,
-   0x43, 0x48, 0x71, 0x9B, 0x14, 0xBC, 0x8F, 0x36, 0xD9, 0x20, 0xA8, 0xAB, 0x9E, 0x4A, 0x54, 0xB5, 0x02, 0x38, 0xED, 0x15, 0xBD, 0x5F, 0xDD, 0x33, 0x63, 0x63, 0x71, 0x79, 0x72, 0xBF, 0x0D, 0x86, 0x1B, 0x53, 0x8E, 0x2A, 0x09, 0xDA, 0x94, 0x89, 0x26, 0x07, 0x27, 0x81, 0x58, 0x0F, 0x49, 0xD0, 0xF6, 0x53, 0x5B, 0x5E, 0x66, 0xAE, 0xCB, 0xAB, 0x75, 0xB6, 0xDC, 0x79, 0x4E, 0xA5, 0x10, 0x85,
-   0x3A, 0xE1, 0xDA, 0x42, 0xA0, 0x40, 0x94, 0xA9, 0xC2, 0x07, 0x1F, 0x0F, 0xB4, 0x52, 0x9A, 0xC4, 0xCA, 0x65, 0xD8, 0x2A, 0x56, 0x40, 0x13, 0xE9, 0x15, 0x7C, 0x30, 0x9E, 0xC4, 0x3F, 0x38, 0x7F, 0x22, 0x6C, 0x3A, 0x9F, 0xE3, 0xE7, 0x16, 0x7E, 0xA7, 0x5C, 0x22, 0xDF, 0x13, 0x69, 0x60, 0xC2, 0x3C, 0x14, 0xB8, 0xE4, 0x84, 0x34, 0x36, 0xB6, 0x10, 0x81, 0xF0, 0xC0, 0xF4, 0x92, 0x98, 0x1E,
-   0xDE, 0xD5, 0xCD, 0x8B, 0xD5, 0xED, 0xE9, 0xBD, 0x24, 0xCE, 0x2F, 0x16, 0xC2, 0x55, 0x91, 0x7D, 0x2A, 0x75, 0xF7, 0xF7, 0xEE, 0x4B, 0x4A, 0x51, 0xF2, 0xC0, 0xE4, 0x15, 0x6C, 0x09, 0xE3, 0x80, 0x0C, 0x4C, 0x9D, 0xC2, 0xBC, 0x3A, 0x8E, 0xCD, 0xDD, 0xCE, 0xA1, 0xB5, 0xB6, 0x61, 0xB7, 0xDE, 0x26, 0xDB, 0x72, 0x1B, 0x42, 0x4A, 0xBF, 0x79, 0x52, 0x40, 0x1E, 0xC9, 0xE7, 0xE9, 0xED, 0x52,
-   0x5A, 0x77, 0x4E, 0xDA, 0x60, 0x52, 0x8C, 0xBE, 0x59, 0xF6, 0x8B, 0xC8, 0x40, 0x50, 0x4A, 0x87, 0x95, 0x85, 0x77, 0x99, 0xF5, 0x20, 0x7A, 0xF6, 0x06, 0x48, 0x98, 0x0A, 0xA8, 0xEA, 0x54, 0xFB, 0x54, 0x9A, 0x6A, 0x5D, 0x75, 0x5D, 0xE5, 0xDC, 0xDB, 0x53, 0x73, 0xA0, 0xE9, 0x6C, 0x72, 0x8E, 0x77, 0x32, 0xCC, 0xE4, 0xFD, 0x55, 0xC1, 0x2E, 0x32, 0xB2, 0x6F, 0xB0, 0xD7, 0xCC, 0xFA, 0xFD,
-   0x62, 0x23, 0x1B, 0xA8, 0xF5, 0x56, 0x06, 0xEE, 0xCF, 0x23, 0x7A, 0xF5, 0xED, 0xC5, 0xB5, 0xC2, 0x37, 0x25, 0xAB, 0x97, 0x54, 0xA4, 0x3A, 0x89, 0xE6, 0x26, 0x76, 0x9E, 0xC4, 0x1E, 0xF0, 0x41, 0xE4, 0x1E, 0x79, 0xF5, 0xCE, 0x56, 0xD3, 0x2F, 0x95, 0xB6, 0xCE, 0x63, 0xD2, 0xAB, 0x77, 0x1E, 0x69, 0x3E, 0x3A, 0x43, 0x9E, 0x74, 0x3C, 0x83, 0x1F, 0x58, 0xDB, 0xB2, 0x08, 0x00, 0x1F, 0xA8,
-   0x20, 0x5A, 0x2C, 0x75, 0x4E, 0x07, 0x36, 0xED, 0xD6, 0x29, 0x6E, 0x36, 0x52, 0xA3, 0xE1, 0xED, 0x59, 0xE1, 0xD1, 0xDE, 0x47, 0xD2, 0x26, 0x47, 0x62, 0x27, 0xE4, 0x4D, 0x63, 0x53, 0x69, 0x3B, 0x9C, 0x60, 0x17, 0x16, 0x65, 0xCB, 0xCB, 0x63, 0xB8, 0xAB, 0x6A, 0x3C, 0xCD, 0x01, 0x27, 0xCD, 0x1D, 0xC4, 0x7E, 0xF7, 0x1D, 0x8C, 0x81, 0xC4, 0xEE, 0x48, 0x71, 0x0A, 0x27, 0x09, 0x96, 0x7D,
-   0x25, 0x0A, 0x39, 0x05, 0x6B, 0x7C, 0xAC, 0x4D, 0xB1, 0xF0, 0xB4, 0x7C, 0xD6, 0xA8, 0x33, 0xF4, 0xD6, 0xF9, 0x4D, 0xD4, 0x8C, 0x0E, 0x23, 0x10, 0x77, 0xE9, 0xF4, 0xD6, 0x27, 0x3A, 0x8D, 0x66, 0x8C, 0xDE, 0x85, 0xFC, 0xC6, 0xDD, 0xA3, 0xE2, 0x5B, 0xA5, 0x17, 0x68, 0x96, 0xB7, 0x38, 0x50, 0x44, 0x29, 0x32, 0x3E, 0x11, 0x0A, 0xDC, 0x7B, 0x8F, 0x27, 0xB4, 0x89, 0xAE, 0x81, 0x64, 0xBF,
-   0x17, 0xA2, 0x95, 0x62, 0xB5, 0xB3, 0xBE, 0xC6, 0xE1, 0x68, 0x4A, 0x12, 0x7C, 0xDB, 0x15, 0xE7, 0x0A, 0x50, 0x9F, 0x55, 0x29, 0x60, 0x1E, 0x3E, 0x1F, 0x63, 0x5C, 0xBA, 0x35, 0xA3, 0x7F, 0xA3, 0x5B, 0xB3, 0xBC, 0x53, 0xE8, 0x69, 0xF6, 0x9D, 0x61, 0x4E, 0x48, 0x2A, 0x2D, 0xA8, 0xA9, 0x24, 0xA7, 0xBF, 0x60, 0x48, 0x12, 0x3D, 0x3B, 0x76, 0xAA, 0xC7, 0x42, 0xEE, 0x9F, 0xC3, 0xEB, 0xAB,
-   0xFC, 0x0D, 0xE2, 0xFC, 0x15, 0xBC, 0xDA, 0xDA, 0x53, 0x30, 0x15, 0x2F, 0x34, 0xAE, 0xDB, 0x84, 0xF6, 0x4F, 0x89, 0xEB, 0x07, 0xDF, 0x8A, 0xF7, 0x85, 0x1D, 0xEC, 0x79, 0xE5, 0x8F, 0xE4, 0x51, 0x4F, 0x91, 0xC4, 0x7C, 0xEF, 0x1D, 0x22, 0x51, 0xC3, 0x51, 0xA0, 0xAC, 0x1C, 0xD3, 0xCA, 0xB1, 0xE6, 0x31, 0xFB, 0xFA, 0xC6, 0xE9, 0x4A, 0x52, 0xAE, 0xA2, 0x4A, 0x14, 0xA5, 0x28, 0x82, 0x14,
-   0xA5, 0x28, 0x82, 0x29, 0x1D, 0x6E, 0xC9, 0x7E, 0x5F, 0xA0, 0x6E, 0x5B, 0x4A, 0xDE, 0x43, 0x97, 0x8E, 0x22, 0xDD, 0x0A, 0x6C, 0xC4, 0x49, 0xDC, 0xA0, 0x79, 0xEC, 0x52, 0x95, 0x0F, 0x79, 0x8E, 0xD5, 0x59, 0xE9, 0x0E, 0x35, 0x36, 0x5A, 0x40, 0x5F, 0x1D, 0x9E, 0x2E, 0x41, 0xE5, 0x2C, 0x94, 0x92, 0x4F, 0x86, 0x82, 0x50, 0x90, 0x67, 0x80, 0x77, 0x78, 0x87, 0x8F, 0x42, 0x27, 0xDA, 0x2F,
-   0xF6, 0x88, 0xC9, 0xB5, 0x71, 0x9D, 0xC7, 0x62, 0x9B, 0xD8, 0x55, 0x68, 0xCA, 0x9C, 0x71, 0x49, 0x5C, 0x90, 0x5C, 0x23, 0xCA, 0x47, 0xA1, 0x01, 0x00, 0xFB, 0x85, 0x0F, 0xBF, 0xE3, 0xBA, 0xE7, 0x1D, 0x6B, 0x61, 0x65, 0x82, 0xD3, 0xB6, 0xB7, 0x77, 0x4A, 0xB7, 0x6D, 0x16, 0xC8, 0x52, 0x58, 0x0D, 0xFE, 0x21, 0x73, 0x05, 0x49, 0x48, 0x92, 0x37, 0x12, 0x55, 0xC8, 0xDC, 0x49, 0xA8, 0xFE,
-   0x28, 0x4B, 0xF3, 0x12, 0xEB, 0x69, 0x81, 0x72, 0x6C, 0x3E, 0x77, 0x3B, 0x74, 0x31, 0x7B, 0x27, 0x20, 0xFF, 0x00, 0xE1, 0x0D, 0xB4, 0xDA, 0x71, 0x71, 0x45, 0x47, 0x6B, 0x0C, 0xAE, 0x7D, 0x0C, 0x5C, 0xF5, 0x46, 0xA7, 0xB5, 0xC3, 0x63, 0x8F, 0x8E, 0xE1, 0x09, 0x6D, 0x30, 0x94, 0x03, 0xF1, 0x28, 0xF3, 0x1E, 0xE7, 0xDB, 0xDB, 0xD3, 0xBD, 0x52, 0x31, 0xD8, 0xBD, 0x49, 0xD4, 0x7C, 0x83,
-   0x8A, 0x2A, 0x77, 0x1B, 0x84, 0x89, 0x0F, 0x2D, 0xA9, 0x0B, 0x82, 0x40, 0x09, 0x1C, 0x6F, 0x32, 0x0C, 0x80, 0x60, 0x47, 0x3C, 0xC4, 0xD8, 0xB4, 0x87, 0x4E, 0x6F, 0xAF, 0x6F, 0xDA, 0xCD, 0x6B, 0x37, 0x03, 0x8A, 0x42, 0xD4, 0xA6, 0xF1, 0xA0, 0x85, 0x36, 0x9E, 0xD0, 0x54, 0x41, 0x22, 0x38, 0xF8, 0x47, 0x7E, 0x24, 0x9E, 0x45, 0x6A, 0x2C, 0x32, 0xD5, 0xBB, 0x08, 0x61, 0x86, 0xD0, 0xD3,
-   0x4D, 0xA4, 0x25, 0x08, 0x42, 0x61, 0x29, 0x03, 0x80, 0x00, 0x1D, 0x85, 0x62, 0xA2, 0x70, 0xBF, 0x64, 0x52, 0xFC, 0xE9, 0xE6, 0x58, 0xB5, 0xB6, 0x00, 0x64, 0x07, 0x4F, 0xE2, 0xD0, 0xB9, 0xDA, 0x8C, 0xB5, 0x34, 0x14, 0x4A, 0x59, 0x6E, 0x6A, 0xAD, 0x07, 0x4D, 0xCF, 0x8E, 0x5D, 0x63, 0x37, 0xCF, 0xF4, 0x8F, 0x12, 0xE6, 0x3D, 0x8F, 0xC8, 0x1F, 0x73, 0x1F, 0x7F, 0x6E, 0x24, 0x3A, 0xB5,
-   0xA9, 0x61, 0xE5, 0x01, 0xC6, 0xEE, 0x7C, 0xA6, 0x40, 0x32, 0x91, 0xC4, 0x9F, 0x29, 0xE2, 0x2B, 0x18, 0x1D, 0x57, 0x95, 0xD3, 0xF7, 0xC3, 0x0F, 0xAA, 0x6D, 0x9E, 0xB6, 0x7C, 0x39, 0xE5, 0x71, 0x68, 0xDA, 0x22, 0x48, 0x99, 0xED, 0x12, 0x38, 0x50, 0x90, 0x7D, 0xB9, 0x35, 0xB9, 0x54, 0x4E, 0xA7, 0xD3, 0xD8, 0x9D, 0x47, 0x8F, 0x5D, 0x9E, 0x52, 0xD5, 0x0E, 0xCA, 0x48, 0x6D, 0xD0, 0x07,
-   0x88, 0xD1, 0x31, 0xCA, 0x15, 0xE8, 0x78, 0x1E, 0xC6, 0x39, 0x91, 0xC5, 0x38, 0xAB, 0x50, 0x65, 0xAA, 0x2D, 0xD9, 0x42, 0xCA, 0x19, 0x11, 0x98, 0x8D, 0x59, 0x4A, 0xEA, 0x94, 0x9E, 0xC6, 0x7B, 0xBE, 0x83, 0xAF, 0xE6, 0x1D, 0x0E, 0xBD, 0x0C, 0x44, 0xA2, 0xF5, 0x37, 0xCC, 0xB6, 0xE8, 0x56, 0xE2, 0x06, 0xD9, 0xF5, 0xFA, 0x1F, 0x7A, 0xC9, 0xB5, 0xC6, 0xFD, 0x2F, 0xD4, 0xF6, 0x33, 0x36,
-   0xBF, 0x0B, 0xAB, 0x6E, 0xF8, 0x21, 0xB7, 0x54, 0x92, 0xA9, 0x30, 0xEA, 0x49, 0xF4, 0xDC, 0xA4, 0xAF, 0xB4, 0x88, 0x57, 0xDA, 0xA5, 0xF2, 0x38, 0xBD, 0x4B, 0xD3, 0xD7, 0x54, 0xF2, 0xD4, 0xE6, 0x53, 0x0C, 0x36, 0x24, 0x5C, 0xA3, 0x85, 0x35, 0x3C, 0x41, 0x49, 0x26, 0x07, 0x11, 0x1F, 0x0F, 0xC3, 0xC8, 0x26, 0x2A, 0xB7, 0xAF, 0x75, 0x1E, 0x33, 0x52, 0xE3, 0xED, 0x9F, 0x69, 0xB5, 0xDB,
-   0xDF, 0x5A, 0x3A, 0x5B, 0xDA, 0xA6, 0xC1, 0x2F, 0x34, 0xA4, 0x83, 0x3B, 0x87, 0x6D, 0xAA, 0x07, 0xCA, 0x67, 0xE3, 0x90, 0x7B, 0xD4, 0x95, 0x26, 0x42, 0xA1, 0x4F, 0x9F, 0x71, 0x33, 0x18, 0x82, 0x07, 0x7B, 0x72, 0x32, 0xF3, 0xB5, 0xFF, 0x00, 0x58, 0xA5, 0xA4, 0x49, 0x72, 0x3F, 0xCC, 0xD1, 0xE7, 0x65, 0x60, 0x82, 0x47, 0x8E, 0xE3, 0x31, 0xF6, 0xBE, 0xD1, 0xF4, 0x90, 0x32, 0x01, 0xA5,
-   0x55, 0x3A, 0x4B, 0x92, 0xFC, 0xCF, 0x40, 0x63, 0x1C, 0x52, 0xD9, 0x2E, 0x30, 0xDF, 0xE1, 0xD6, 0x96, 0xCF, 0xC3, 0xB0, 0xED, 0x48, 0x3C, 0xF0, 0x4A, 0x42, 0x4F, 0xDE, 0x7B, 0x1A, 0xB5, 0xD7, 0x48, 0x42, 0xB9, 0x92, 0x14, 0x35, 0x8E, 0x7F, 0x34, 0xC2, 0xA5, 0xDE, 0x5B, 0x4A, 0xCD, 0x24, 0x8F, 0x48, 0x52, 0x94, 0xAF, 0xA8, 0xC1, 0x0A, 0x52, 0x94, 0x41, 0x1F, 0x2E, 0xF5, 0x2A, 0xF5,
-   0xDB, 0xFD, 0x7B, 0x9A, 0x79, 0xE4, 0xA1, 0x2A, 0x45, 0xDA, 0xD9, 0x1B, 0x44, 0x0D, 0xAD, 0x9D, 0x89, 0xFB, 0xC2, 0x44, 0xFB, 0xD6, 0xD7, 0xD2, 0xCD, 0x23, 0x84, 0xC5, 0x60, 0x31, 0xF9, 0x66, 0x6D, 0xBC, 0x6B, 0xEB, 0xBB, 0x66, 0xAE, 0x14, 0xFB, 0xD0, 0xA5, 0x36, 0x54, 0xD8, 0x94, 0xA3, 0x8F, 0x28, 0xF3, 0x1F, 0x73, 0x3C, 0x93, 0xC5, 0x29, 0x4A, 0xA5, 0x40, 0x33, 0x0A, 0xBF, 0x8C,
-   0x74, 0x6E, 0x20, 0x5A, 0x9B, 0xA3, 0xB2, 0x10, 0x6C, 0x08, 0x48, 0xC3, 0x6B, 0x08, 0xBB, 0xD2, 0x94, 0xA6, 0xB1, 0xCE, 0x61, 0x4A, 0x52, 0x88, 0x20, 0x40, 0x22, 0x0D, 0x60, 0x5D, 0x70, 0xD2, 0xF8, 0x9D, 0x3F, 0x90, 0xB2, 0xBB, 0xC5, 0xB6, 0xB6, 0x46, 0x41, 0x4F, 0x29, 0xC6, 0x41, 0x1E, 0x1A, 0x0A, 0x76, 0x7C, 0x02, 0x38, 0x07, 0x71, 0x31, 0x31, 0xF2, 0x81, 0xC5, 0x29, 0x5A, 0x53,
-   0xC0, 0x76, 0x57, 0x8A, 0xAE, 0x0F, 0x5A, 0x85, 0x43, 0x94, 0x1C, 0x08, 0x37, 0x8B, 0x17, 0xEC, 0xDF, 0x74, 0xFA, 0xEC, 0xB3, 0x56, 0x6A, 0x5C, 0xB0, 0xD3, 0x8C, 0xB8, 0x84, 0xC0, 0xE1, 0x4B, 0x0B, 0x0A, 0x33, 0xDF, 0x90, 0x84, 0xFF, 0x00, 0x2A, 0xD6, 0xE9, 0x4A, 0xC9, 0x27, 0xFE, 0x94, 0xFB, 0xD6, 0x34, 0xF8, 0x9C, 0x01, 0x54, 0x76, 0xDE, 0x1F, 0xF2, 0x21, 0x4A, 0x52, 0xB6, 0x61,
-   0x0C, 0x7F, 0xFF, 0xD9,
-};
+    int Res = 0;
+
+    if ((Addr & 3) != 0)
+    {
+        Res = -EINVAL;
+        goto Error;
+    }
+
+    EVE_cmdInflate(RAM_G + Addr, Data->Blob, Data->BlobSize);
+    Asset_attach(Ast, Data, Addr);
+
+Error:
+    return Res;
+}
+
+/*
+ * Use an asset image that is already in RAM_G at Addr
+ */
+void Asset_attach(Asset *Ast, const Asset_Data *Data, uint32_t Addr)
+{
+    Ast->Data = Data;
+    Ast->Addr = Addr;
+}
+
+/*
+ * Draw a loaded asset with its top left at X, Y
+ */
+void Asset_draw(Asset *Ast, uint8_t Handle, int16_t X, int16_t Y)
+{
+    const Asset_Data *Data = Ast->Data;
+
+    EVE_burstReserve(40);
+    EVE_cmd(BITMAP_HANDLE(Handle));
+    EVE_cmdSetBitmap(Ast->Addr + Data->PaletteSize, Data->Format, Data->Width, Data->Height);
+    if (Data->PaletteSize != 0)
+    {
+        EVE_cmd(PALETTE_SOURCE(Ast->Addr));
+    }
+    EVE_cmd(DL_BEGIN | BITMAPS);
+    EVE_cmd(VERTEX2F(X, Y));
+    EVE_cmd(DL_END);
+}
@@ -0,0 +1,43 @@
+/************************************************************
+ * asset.h
+ *
+ * Bitmaps for the screen, converted to EVE formats at build
+ * time by tools/mkasset.py and deflated, so they take less
+ * MCU flash than the source JPEGs and upload with
+ * CMD_INFLATE instead of being decoded on the EVE.
+ *
+ ************************************************************/
+
+#ifndef ASSET_H
+#define ASSET_H
+
+#include <stdint.h>
+
+typedef struct Asset_Data
+{
+    const uint8_t *Blob; //deflated RAM_G image for CMD_INFLATE
+    uint32_t BlobSize;
+    uint32_t RamSize; //size once inflated
+    uint32_t Version; //changes whenever the image is rebuilt differently
+    uint32_t PaletteSize; //bytes of palette before the pixels, 0 for none
+    uint16_t Format; //EVE bitmap format
+    uint16_t Width;
+    uint16_t Height;
+
+} Asset_Data;
+
+typedef struct Asset
+{
+    const Asset_Data *Data;
+    uint32_t Addr; //RAM_G address of the image
+
+} Asset;
+
+extern const Asset_Data Asset_logo;
+extern const Asset_Data Asset_logo2;
+
+int Asset_load(Asset *Ast, const Asset_Data *Data, uint32_t Addr);
+void Asset_attach(Asset *Ast, const Asset_Data *Data, uint32_t Addr);
+void Asset_draw(Asset *Ast, uint8_t Handle, int16_t X, int16_t Y);
+
+#endif
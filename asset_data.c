@@ -0,0 +1,1286 @@
+/************************************************************
+ * Generated by tools/mkasset.py, do not edit. Rerun the
+ * tool on the source images instead.
+ *
+ * logo: assets/logo.jpg, 328x240 paletted565, 78784 bytes in RAM_G, 17750 deflated
+ * logo2: assets/logo2.jpg, 100x100 paletted565, 10032 bytes in RAM_G, 2177 deflated
+ ************************************************************/
+
+#include <stdint.h>
+
+#include "asset.h"
+
+static const uint8_t Asset_logoBlob[17750] = {
+0x78,0xda,0xed,0xbd,0xbd,0x6e,0xe4,0x4a,0xd7,0x2e,0xc6,0xea,0x66,0x15,0x25,0x92,
+0x45,0x56,0x57,0x8f,0x4a,0xad,0xaa,0x62,0x33,0x33,0xf0,0xdd,0x85,0xe1,0xc0,0xc1,
+0x49,0xcf,0x65,0x18,0x70,0xe0,0xdc,0x81,0x81,0x73,0x17,0xbe,0x0,0x5f,0x82,0x1,
+0x3,0x6,0x1c,0x38,0x3b,0x89,0x63,0x7,0xf6,0x15,0x18,0xe,0x1d,0x7c,0xc1,0xeb,
+0xf5,0xac,0x55,0xec,0x66,0xff,0x48,0x23,0xcd,0x68,0xe6,0x7d,0x47,0x7b,0x73,0xcf,
+0x9e,0xd1,0x4f,0x4b,0xdd,0xfd,0x70,0xd5,0xfa,0x5f,0xcf,0xfa,0xc7,0x3f,0xfe,0xf1,
+0x8f,0xff,0xe7,0xdf,0xfe,0xf1,0x8f,0xaa,0xfa,0x4f,0xf,0xf4,0xe1,0x3f,0xfe,0x87,
+0x7f,0xff,0x1f,0xf1,0xcf,0x3f,0xfe,0xef,0xff,0xf,0x5f,0xab,0xaa,0xff,0xfa,0xdf,
+0xfe,0xf3,0xbf,0xfd,0xb7,0xff,0xcd,0xff,0xf4,0x9f,0xff,0xcb,0x7f,0xff,0xdf,0xff,
+0xfd,0xf1,0xbf,0xfa,0x3f,0xfe,0xc3,0x7f,0xf1,0xdf,0xfd,0x6f,0xff,0xe7,0x7f,0xfc,
+0x4f,0xff,0xf3,0xff,0xfa,0xbf,0xfc,0x5f,0xff,0xfd,0xff,0x4b,0xdf,0x7e,0xa8,0xfe,
+0x65,0xae,0x6,0x7f,0x29,0xfc,0x4b,0x1f,0x19,0xfa,0xaf,0xa9,0xfe,0xbe,0x7e,0x12,
+0x4f,0xcb,0x80,0x36,0xcd,0xdf,0x58,0xfe,0x10,0x82,0x4a,0x35,0x86,0xfe,0x31,0x2b,
+0xe9,0xfc,0xfb,0xfa,0xe0,0x65,0x80,0x1c,0x49,0xa0,0x25,0xf8,0xc,0xe3,0xa8,0xf8,
+0x7c,0xff,0x7d,0x7d,0x50,0x18,0x4d,0x43,0x7f,0x20,0x82,0xf4,0xc7,0x28,0xfa,0xdb,
+0x54,0xea,0x6f,0x81,0xfc,0x31,0x2c,0x49,0x2,0x6d,0xa3,0xd8,0xd8,0xfc,0xd,0xe1,
+0xf,0x5a,0x97,0x6,0xe7,0xb8,0x32,0x29,0xfa,0xe0,0x63,0x4a,0x93,0xaa,0xac,0xc1,
+0x29,0xff,0xfb,0xfa,0xa0,0x95,0x9e,0x52,0xc,0xba,0x1e,0xc6,0x61,0xa8,0x7,0x5c,
+0x21,0xe6,0xbf,0x71,0xb9,0x67,0x49,0xc4,0x2d,0x14,0xa5,0x47,0xee,0x21,0xf4,0x60,
+0xc3,0x22,0xd7,0x67,0x48,0xa1,0xab,0x87,0xe3,0x70,0xac,0xeb,0x23,0xff,0x7f,0x24,
+0x24,0x8f,0x61,0xa2,0xc7,0x43,0x2e,0xff,0x76,0x80,0x56,0x5e,0xa1,0x29,0xbe,0xc,
+0xe1,0x2,0xab,0x22,0xd0,0x4c,0xc,0xa1,0x6,0x86,0xf4,0x7,0x0,0xf2,0x45,0x1f,
+0xd5,0x40,0x35,0xf1,0x8f,0xda,0xe6,0x6f,0x1c,0x4f,0xce,0x21,0x80,0xb4,0x8d,0xed,
+0xe8,0x52,0xf4,0xa7,0xe9,0x6c,0x2e,0x10,0x42,0xf4,0x0,0x1d,0xae,0x22,0x8d,0x35,
+0x1,0xb,0x24,0x87,0xa0,0x60,0x78,0xd4,0xdf,0x38,0x9e,0x5,0x12,0x50,0x12,0x88,
+0x96,0xa1,0x2c,0x18,0x1e,0x1,0x17,0xe0,0xe3,0x3f,0xb5,0x68,0x46,0x7c,0x8d,0x64,
+0x11,0x72,0x59,0xf,0x6e,0xa2,0x83,0x5f,0xfd,0x2d,0x90,0x27,0xe5,0x68,0xc9,0x99,
+0x69,0xba,0x6,0xb2,0x98,0x63,0x8,0x22,0x87,0x2c,0x81,0x72,0x9c,0x81,0xe9,0xc0,
+0xa,0x12,0x72,0x8,0xc1,0xc4,0x17,0xc7,0x9a,0x80,0x54,0xe6,0x6f,0x1c,0x4f,0xbe,
+0x61,0xc3,0x71,0x73,0xd7,0xf5,0xc9,0xbb,0x5a,0x10,0x13,0x31,0x3c,0xb2,0x18,0x12,
+0x9c,0x9a,0x3c,0x1e,0x72,0x79,0x70,0x45,0x98,0x1d,0x7e,0xc8,0x30,0x38,0xc4,0x36,
+0x7f,0xe3,0x78,0xf6,0x10,0x2d,0xa1,0x49,0xa2,0xa8,0x8f,0xc7,0xf9,0x38,0xe3,0xf,
+0xfd,0x5,0xa4,0x60,0x50,0x42,0x4c,0x79,0xea,0x6d,0xd3,0x75,0x4d,0x83,0xc3,0x3f,
+0x65,0x7a,0x24,0xa1,0x3d,0xd2,0xf7,0x5d,0xb9,0xd,0x7f,0x5f,0x95,0xb8,0xd4,0x2a,
+0xf9,0xc0,0xf8,0x1d,0x17,0x1c,0x21,0x89,0x8c,0x21,0x9d,0x78,0x2,0x90,0xe4,0xae,
+0x5c,0x1d,0x7d,0x32,0xc5,0x9a,0x7c,0xc9,0xb1,0x1e,0xd3,0x5f,0x17,0xc7,0x46,0xb0,
+0x83,0xff,0x47,0xd1,0x32,0x1c,0xc5,0x66,0x8a,0xde,0x8d,0xa3,0x40,0x53,0x8f,0xa3,
+0x18,0x95,0xda,0xc7,0x69,0x95,0x8e,0x80,0x9,0xaa,0xaa,0x96,0xae,0xaa,0x45,0x74,
+0x3,0xd9,0xa5,0x93,0xdd,0x2a,0xba,0x3a,0xf5,0xd7,0xb,0xb8,0xcd,0x92,0xc3,0x51,
+0x70,0xbc,0x61,0xac,0x49,0x2b,0x32,0x86,0xb5,0xc0,0x58,0x53,0xdc,0xa2,0x43,0x9c,
+0x6c,0x49,0x38,0xde,0xe2,0x58,0x35,0xbd,0x52,0xc9,0xb1,0xad,0xc9,0xb6,0x17,0x20,
+0xff,0x72,0xf2,0x68,0x39,0x8b,0x68,0x94,0xe5,0x64,0x6c,0xf6,0x8e,0x2,0xbe,0x91,
+0x84,0x10,0x58,0xd2,0xff,0xf4,0x51,0x48,0x7d,0x43,0x62,0xda,0x57,0xca,0xae,0xf3,
+0x63,0x50,0x8f,0xdb,0xad,0x45,0xd2,0x87,0xfe,0x6e,0x22,0x4,0xb7,0xf6,0xad,0x55,
+0xaa,0xad,0xd4,0xf6,0x2f,0x7,0x23,0xa4,0x51,0x2c,0x74,0x65,0x63,0xa8,0xd9,0xc3,
+0x61,0x8,0x71,0x9c,0x19,0x44,0xae,0x20,0x34,0x9c,0x20,0x5b,0x2b,0x3f,0xc1,0x11,
+0xaa,0x60,0xbb,0xa5,0x1f,0x9f,0x1c,0x14,0x80,0xb6,0x4,0x24,0xfd,0xb6,0xbf,0x1c,
+0x8e,0xe2,0xf2,0x21,0x29,0x3b,0x79,0x8d,0xdc,0x3,0xff,0xc1,0x69,0x1e,0x6b,0xed,
+0x13,0xc5,0xcd,0xc6,0x48,0x7c,0x5d,0x19,0xbb,0xa,0x57,0x80,0x21,0xfe,0x56,0x24,
+0x7f,0x24,0xcb,0xcd,0xd6,0x3a,0x32,0x48,0xf5,0x90,0x95,0xdd,0x6e,0xb7,0xed,0x5f,
+0xcf,0xca,0x20,0x89,0x48,0x30,0x66,0x88,0xe2,0xc8,0x8,0x42,0x1a,0xc9,0x64,0xf8,
+0x5c,0x72,0x8b,0xd,0x1f,0x7d,0x63,0x97,0xf0,0xfb,0x12,0x47,0xc0,0xa8,0xfa,0x66,
+0x9b,0x60,0xd5,0x87,0x31,0x2a,0x82,0xf1,0x2f,0x97,0x1d,0x87,0x97,0x62,0x49,0xeb,
+0x65,0xbf,0xc8,0xa1,0x4,0x7c,0x8e,0x24,0x91,0x4f,0x7d,0xd3,0x98,0xf2,0x40,0x84,
+0x8b,0x17,0xf8,0x0,0xc3,0xed,0x96,0x6e,0x4,0xe1,0x68,0x55,0xd6,0xb3,0x7e,0x79,
+0xa9,0xeb,0xa8,0xda,0x56,0xc,0xd6,0x5f,0xb,0x47,0x3e,0xb5,0x9e,0x6d,0xcb,0x0,
+0xb3,0x42,0x86,0x5a,0xb,0x88,0xec,0x8d,0x17,0x11,0x6c,0xca,0x1f,0x7b,0x83,0x23,
+0xf2,0x6b,0x74,0x65,0x3d,0xcc,0x87,0xfd,0xbe,0x1e,0x5,0xc7,0xbf,0x0,0x8c,0x56,
+0x7c,0x9d,0x92,0x64,0xc4,0x87,0x91,0x33,0xb2,0x30,0xd1,0x48,0xcc,0xba,0x98,0xe1,
+0xe2,0x2c,0x6e,0xf6,0xab,0x6a,0x95,0xd4,0x60,0xd3,0xb4,0x2d,0x61,0x4b,0xff,0xa6,
+0x7a,0x9e,0x5f,0x9e,0x9e,0x5e,0xc6,0x31,0xb5,0x70,0xa0,0xfe,0x2,0xf6,0x5a,0x2a,
+0x2a,0xaa,0xe1,0xcc,0xac,0x82,0x7,0x3d,0xe0,0x44,0xe3,0x40,0xd3,0x9f,0x90,0xb2,
+0x2a,0x36,0xfc,0x4d,0x18,0x71,0x9a,0xb7,0x6,0x38,0xf6,0xdb,0xed,0xe4,0xeb,0x7a,
+0xe,0x4f,0x8c,0x63,0x6e,0x21,0xa1,0x5b,0xf5,0x17,0x10,0x47,0x94,0xa8,0x70,0x46,
+0xe1,0xc6,0xa4,0x0,0xbd,0x38,0xb2,0x8b,0x3,0x14,0xa7,0x8a,0x4f,0xfa,0xf7,0xf5,
+0x5b,0xcb,0x91,0xb,0x79,0xdd,0xdb,0x36,0x11,0x8a,0x74,0xa8,0x1f,0x1e,0xfc,0x4c,
+0x7e,0xcf,0xd6,0x6c,0x9,0xc6,0xaf,0xef,0x87,0xa3,0x4c,0x5,0x87,0x9a,0xce,0x34,
+0xf9,0x8b,0x23,0xa7,0xc4,0xe4,0x48,0xbb,0x64,0xc5,0x42,0x2b,0xfb,0x7d,0x83,0xb,
+0x1c,0xc9,0xbe,0xd8,0x6d,0x72,0xe4,0x69,0xea,0xb0,0xdf,0x3f,0xbc,0xb8,0x79,0x48,
+0x5b,0x3a,0xef,0x7f,0x9,0x1c,0x21,0x89,0x38,0xba,0x6d,0x15,0x39,0x81,0xc3,0x9,
+0xc4,0xe1,0x38,0xba,0xd4,0x2b,0xa9,0xc,0xa8,0xe6,0x1d,0x1d,0x12,0x96,0xfc,0x46,
+0x63,0xbb,0x2e,0xcc,0x84,0xa2,0x7b,0xd9,0x3f,0x3d,0xf9,0x43,0x5d,0xbb,0xde,0xf6,
+0x88,0x15,0x55,0xf7,0x17,0x8,0xa8,0xd,0x40,0x32,0x51,0x97,0x22,0x1,0xa,0x55,
+0x64,0xa3,0x27,0x48,0xa8,0x3a,0x7b,0x39,0x6f,0x7b,0x4b,0x8d,0xed,0x2d,0xe9,0xd8,
+0xa4,0xe7,0x59,0xeb,0xe0,0xf7,0xfb,0xa7,0x97,0xc3,0x7c,0x3c,0x12,0x8c,0x96,0x71,
+0xfc,0xfa,0xfa,0x91,0x42,0x69,0x92,0xc6,0xa4,0xc5,0xae,0xb0,0x79,0x39,0xe,0xe4,
+0x73,0xd3,0x17,0x2d,0xf7,0xec,0xa0,0x5b,0xe2,0x4d,0xfd,0x8,0x18,0x49,0x14,0xd5,
+0xd6,0x78,0x1c,0xe9,0xc3,0x81,0x2c,0x35,0x4b,0x63,0x9d,0x70,0xd6,0x19,0xc7,0xed,
+0x5f,0x0,0xc7,0x4a,0x25,0x27,0xc5,0x67,0x2e,0x10,0x90,0x62,0xcc,0x66,0xe9,0x33,
+0x11,0x4,0x95,0x79,0x1b,0x46,0x63,0xc,0xd9,0xe4,0x3c,0xcf,0x74,0xa4,0xc3,0x61,
+0xf,0x4b,0x7d,0xa0,0xf3,0x1d,0xa1,0x33,0xed,0x57,0xc7,0xd1,0x70,0x7a,0x8c,0x60,
+0xcc,0x81,0xf3,0x89,0xf0,0x19,0xe1,0xf0,0xb8,0x48,0x5e,0x90,0xfa,0x7e,0xfe,0x15,
+0x91,0x20,0x41,0xa8,0xfa,0x9e,0xd,0x49,0x17,0xa1,0x18,0xc3,0xcb,0xfe,0xdb,0xb7,
+0xfd,0xde,0x3b,0xb2,0x55,0x11,0xb7,0xe2,0xcb,0xa7,0x71,0x55,0x11,0x47,0x98,0x17,
+0x58,0x69,0xf6,0xbb,0x9,0xc6,0xd8,0x97,0x4c,0xce,0x3b,0x71,0x34,0xb6,0x27,0x61,
+0x53,0x5d,0x60,0x18,0x49,0x33,0x12,0x8e,0x7,0x3d,0xf,0x43,0x24,0x10,0xd5,0x97,
+0x2f,0x60,0x53,0x70,0xcc,0x25,0x3,0xb8,0xdd,0x35,0x67,0x75,0x38,0x2d,0xe1,0x25,
+0x3,0x69,0xdf,0x21,0x47,0x92,0x93,0xc0,0x99,0xed,0x7b,0x65,0xdd,0x8c,0x23,0xfd,
+0xf2,0x0,0xcd,0xe8,0x34,0x74,0x23,0x6c,0xf8,0xd7,0xef,0xa7,0x30,0x70,0xb,0xab,
+0xc9,0x33,0x84,0x75,0x2d,0x11,0x4c,0x20,0x23,0x6d,0xf8,0xcd,0xbf,0x23,0x43,0xb3,
+0xc6,0x71,0x72,0xf3,0x4c,0x30,0xfa,0x87,0x87,0x97,0x97,0x3,0x50,0x74,0x14,0x4c,
+0xda,0xbf,0x42,0x5b,0x2e,0xe3,0x95,0xf4,0x28,0x49,0x6e,0x88,0x22,0xf9,0xdd,0x25,
+0x4a,0x7c,0x5f,0xb1,0x14,0x75,0x4,0x72,0x2e,0xc9,0x6b,0x6c,0x27,0x82,0xce,0x1d,
+0xf6,0xdf,0x1e,0xa0,0x19,0xf5,0x38,0x8e,0xbe,0xe5,0x48,0xe9,0xeb,0x77,0x9d,0x21,
+0x55,0xa3,0x58,0x18,0xd9,0xdf,0xc1,0x3f,0x11,0x27,0x9a,0x1c,0x18,0xa9,0x2b,0xbc,
+0x1b,0x47,0x6b,0x4c,0x8f,0xa2,0x3f,0x69,0xc6,0x7,0x68,0x46,0x44,0x43,0x89,0xa4,
+0x14,0x36,0xfc,0xab,0x8b,0x23,0x8c,0x88,0xc9,0x8e,0xeb,0x2e,0x83,0x4,0xd3,0x9e,
+0xbb,0x48,0x14,0x7b,0x8d,0xc6,0xbc,0x27,0x9e,0x46,0x6e,0x2,0x99,0x6e,0xab,0xdc,
+0x30,0x53,0x4,0xf3,0xf0,0xb4,0x3f,0x4,0x8,0x63,0x30,0x70,0x77,0x58,0x1a,0xd5,
+0x97,0xc7,0xd1,0x24,0x71,0x73,0xf8,0xaf,0x11,0x47,0xda,0x70,0x47,0xf2,0xaa,0xc3,
+0xec,0x5d,0x38,0x9a,0x96,0xc4,0x5a,0xa4,0xf1,0xe5,0x40,0xd2,0x8,0x77,0xc7,0x9a,
+0x4e,0x2d,0xf9,0xb8,0x2f,0x65,0x51,0x64,0x88,0x40,0x9c,0x19,0x7e,0x7f,0x4d,0xe5,
+0x51,0x2c,0x40,0x1,0xb,0x48,0xc6,0xea,0xe3,0x7e,0x5e,0x4b,0x5e,0x63,0x8f,0x78,
+0x25,0xd5,0xb3,0x96,0x78,0xda,0x51,0x68,0x8e,0xee,0x28,0xa9,0xe1,0x7c,0x35,0x37,
+0x11,0x99,0x45,0xc9,0x34,0x88,0x4f,0x68,0xc9,0x8e,0x4e,0x5a,0x5c,0xef,0x11,0x58,
+0x6,0x88,0xe2,0xf,0xe0,0x48,0x97,0xb5,0xdb,0x2d,0x42,0x41,0x8e,0xa7,0x1d,0xb2,
+0x8e,0x6d,0x6b,0xbe,0x17,0x0,0xfd,0xa9,0x86,0x79,0x89,0xf0,0xb8,0x82,0xc5,0x4a,
+0x2b,0xa1,0x7a,0x35,0x96,0xd2,0x4b,0x62,0xbb,0xf2,0x51,0x18,0xe9,0x4c,0xf7,0x55,
+0x6b,0x3b,0x4b,0xfe,0x37,0x22,0x41,0xb4,0xe5,0xd6,0xb5,0x47,0xfe,0xcc,0x7e,0x49,
+0x1c,0x39,0xf7,0x85,0xa3,0x6c,0x97,0xa4,0xad,0x89,0x70,0xb9,0xd9,0xf3,0x1e,0x10,
+0xbc,0x61,0xd2,0xe0,0xc3,0x1e,0xa,0x72,0xdc,0x80,0x91,0x6e,0x89,0x83,0x34,0x32,
+0x8c,0xb1,0x6a,0x5a,0xd4,0xab,0x9b,0xaf,0x77,0xae,0x8d,0xd4,0xf5,0x2d,0xa2,0x14,
+0x85,0x26,0x88,0xaa,0xa,0x12,0x4c,0x43,0x3f,0x92,0x95,0xb6,0x3f,0x66,0xe,0x80,
+0xa3,0x55,0xaa,0xd7,0xf3,0x7c,0x78,0x78,0xf0,0x64,0xa9,0x8f,0x73,0x84,0x90,0xf6,
+0xb0,0x41,0xf6,0xcb,0x79,0x8e,0xaa,0x11,0xe5,0x68,0x96,0x71,0x8c,0xc9,0xd,0x1c,
+0x48,0x93,0x40,0xba,0xbc,0x58,0x21,0xdb,0xfc,0x0,0x8e,0x4,0xa4,0x8d,0x5c,0x41,
+0xf8,0x6,0x4b,0x3d,0x7,0x14,0x16,0x2c,0xc5,0x88,0x6d,0xdb,0x7f,0x3d,0xf,0x9c,
+0x8c,0x67,0xf2,0x49,0xc6,0xd5,0xe8,0xf,0xc5,0xd3,0xa5,0xf8,0x32,0xf8,0xfe,0x14,
+0x73,0x98,0x1f,0x90,0x47,0x52,0x8f,0xd5,0xb6,0x26,0xcf,0x91,0xfc,0xc6,0xcd,0xe,
+0xe6,0xaa,0xea,0xbb,0x25,0x6b,0x6b,0xbf,0xe0,0xb9,0xb6,0x84,0x9b,0x2f,0x79,0xd9,
+0xc4,0x1,0xc,0x6a,0xd3,0x3a,0x9f,0x67,0xb0,0x7e,0x0,0x48,0xe9,0x91,0x8a,0xc3,
+0x1c,0x9e,0x1e,0xf6,0x87,0x9d,0xae,0x75,0x8f,0xf2,0x84,0xf9,0x7a,0x55,0x84,0x86,
+0xa3,0x13,0x38,0x34,0x43,0x8,0x43,0x90,0x1c,0xd9,0x2,0xe3,0xe0,0xb9,0x90,0xff,
+0xe3,0x81,0x9b,0xed,0xd0,0x8e,0xa7,0xe9,0x54,0x3f,0xbd,0x3c,0x13,0x8c,0x63,0x66,
+0xb,0xd3,0x6e,0x6d,0xdf,0x4b,0xcd,0x4b,0x19,0xd4,0x14,0x70,0xd4,0x1b,0xd2,0x98,
+0xd2,0xd7,0xf7,0xe7,0x5d,0x2c,0x7d,0x3d,0x34,0x63,0x74,0xba,0x9e,0xfc,0x10,0x50,
+0xcd,0x77,0x7c,0xa4,0x91,0xf1,0x6e,0xe8,0x9b,0xe6,0x27,0x12,0x32,0x1d,0xb9,0x8e,
+0x5d,0x9a,0x19,0x47,0xd8,0x6a,0xcf,0x7d,0x13,0x8a,0xbc,0xf3,0x9e,0xe0,0x43,0xd5,
+0x4b,0x19,0x2b,0x38,0xaa,0xa6,0xff,0x73,0x71,0x84,0x3,0xce,0x6e,0x4e,0xd6,0x4,
+0x9c,0x37,0x9e,0xf4,0x97,0xad,0xbc,0x24,0x1a,0x7d,0xc3,0x18,0xff,0x8c,0x12,0xb3,
+0xe8,0x2c,0xb,0xa2,0x1d,0xc9,0x56,0x6b,0x63,0x7a,0xf2,0xca,0x31,0x8a,0x6d,0xd9,
+0x37,0x68,0x49,0x67,0x10,0x98,0x5b,0x48,0x29,0x9d,0x78,0xf5,0xc7,0xe2,0xc8,0xd2,
+0x66,0xad,0x1e,0x7,0x9d,0x86,0x71,0xa2,0x28,0x98,0x80,0xec,0xb9,0xaf,0x36,0xa1,
+0xd2,0x2a,0xc1,0xcd,0xf,0xfb,0x79,0xaa,0xb3,0x5b,0x8a,0x8,0xf,0x4f,0x84,0x23,
+0x89,0x63,0xb2,0xec,0x7,0x91,0x47,0x80,0x1e,0x66,0x65,0x48,0x4f,0x56,0x53,0xce,
+0x99,0xcf,0xf8,0x9f,0x8c,0xa3,0xe2,0xea,0x8b,0x49,0x43,0xf4,0x64,0x98,0xeb,0xda,
+0xaa,0x38,0xd2,0xd1,0x8e,0x43,0x1d,0x26,0x64,0xcd,0xac,0xfd,0xb9,0xfc,0x20,0xfc,
+0x9e,0x30,0xce,0xe8,0x9a,0x20,0x18,0x43,0x47,0x72,0x47,0xd8,0x2,0x4c,0xfa,0x88,
+0x74,0x67,0xf2,0x6e,0x1e,0x8e,0xf3,0x1c,0x62,0x4f,0x11,0x8e,0x69,0xcd,0x1f,0x89,
+0x63,0x91,0xb5,0x8c,0xfc,0x6a,0xe3,0xc7,0x34,0xd,0x9a,0xe,0xf5,0x18,0xd,0x39,
+0xe1,0x53,0x63,0xd0,0x22,0x4b,0x8f,0xf9,0x99,0x73,0x8d,0xfa,0x20,0xfd,0xf2,0xa2,
+0x1d,0x27,0xe0,0xd8,0xa8,0x92,0x21,0xef,0x50,0x80,0xe4,0x80,0x69,0x9e,0x29,0xdc,
+0x49,0xf8,0x9a,0x31,0x7f,0x26,0x8e,0x4d,0xa3,0xd0,0x7f,0xa7,0x11,0xf9,0xd5,0x43,
+0x52,0x83,0xab,0x8,0xd0,0x68,0xad,0x73,0xd5,0x52,0x2b,0xac,0x7e,0x2,0x49,0x32,
+0x23,0x64,0xfc,0xf,0xfb,0xfd,0x3e,0x68,0x32,0x32,0x9d,0xe5,0x76,0x2,0xd2,0x85,
+0x8a,0xcc,0x4a,0x40,0x6f,0xf8,0xec,0xe,0x87,0x3,0x26,0x44,0xea,0x8,0x9b,0xfd,
+0x47,0x16,0xbc,0xe8,0x45,0xab,0xc,0x55,0x8,0x87,0x91,0x40,0xc4,0xff,0x9a,0x80,
+0x1c,0x52,0x95,0xc8,0xe5,0xb1,0xa7,0xb1,0x84,0x1f,0xd6,0x8f,0x4,0x5c,0x18,0xf4,
+0xcb,0x9e,0xac,0x4c,0x3d,0x4e,0x1d,0xfa,0x5a,0x28,0x20,0x44,0x8b,0x4f,0x93,0x90,
+0x12,0x77,0x61,0xcf,0x17,0x4e,0x3d,0x6e,0xdf,0x9f,0x87,0x23,0xe7,0xc6,0xe8,0x2f,
+0x32,0x2c,0xf5,0xe0,0x91,0xaf,0x4d,0x69,0x18,0xa6,0x5c,0x3b,0x7a,0xeb,0x75,0x32,
+0x74,0xb2,0x3f,0x21,0xc3,0xda,0x54,0x1d,0x49,0xdc,0x37,0x8a,0xac,0x75,0xed,0xb6,
+0x96,0x7b,0x70,0x49,0x14,0x1b,0x65,0xf2,0x58,0x93,0x5b,0xf9,0xf2,0xf4,0xf4,0xf0,
+0xf4,0x24,0x1d,0x1,0xf3,0x9c,0xa5,0x3b,0xf0,0x4f,0xe2,0xf6,0x81,0xe3,0x48,0xaf,
+0x36,0x39,0x3d,0x4e,0x13,0x61,0x68,0xfd,0x38,0x64,0x3f,0xd4,0x55,0xae,0x43,0x53,
+0x61,0xc4,0x8a,0xdc,0x9e,0xe6,0x13,0x70,0x24,0x6b,0xed,0x90,0xa1,0xa0,0x73,0xbb,
+0x15,0x14,0xd9,0x52,0xd3,0x31,0xd0,0xfa,0xe0,0x9,0xc6,0x6f,0x2f,0x74,0xc1,0x9e,
+0xcf,0xb3,0x6b,0xb8,0x71,0xe3,0x4f,0x2a,0xc3,0x82,0xbe,0xa4,0x8a,0x5e,0x93,0x6a,
+0xd4,0x55,0xaf,0x87,0xd4,0x84,0xb1,0xce,0x7e,0xc,0xf4,0xc6,0xbd,0x99,0x28,0x44,
+0xc,0xee,0x13,0xea,0x26,0xc8,0xa8,0xcf,0x87,0x87,0x6f,0x38,0xb7,0x13,0xf7,0x3e,
+0x92,0xf5,0x42,0xad,0x91,0x3e,0x77,0x81,0xbc,0xca,0xbd,0xf,0xbb,0x5d,0xe0,0xea,
+0x97,0x9b,0xc7,0xc8,0x25,0xf1,0x3f,0xa8,0x10,0xb,0x6f,0xa6,0x77,0x48,0xe7,0x24,
+0x3f,0xea,0x2a,0x93,0x7a,0xa4,0x28,0xa6,0x9e,0x1c,0xa9,0xc5,0x48,0x61,0x76,0x1a,
+0x6a,0x1d,0xcd,0xcf,0x3,0xd9,0x40,0x3d,0x7a,0xc2,0x51,0xd7,0xc1,0x90,0x5e,0xb4,
+0xb6,0x33,0x1d,0xf9,0x8f,0xe9,0x58,0xeb,0x40,0xd2,0xb8,0x7f,0x9,0xc0,0x31,0x48,
+0x3f,0xe9,0xe8,0x90,0x77,0xfa,0xa3,0x78,0x7d,0x8,0xa1,0x4c,0x71,0x9f,0xa7,0x23,
+0x1d,0xc8,0x48,0x93,0xc3,0x98,0x27,0x12,0x91,0x4a,0x8f,0x99,0x44,0x88,0x2,0x1b,
+0x6d,0x3f,0xe5,0xcd,0xf4,0xfa,0xe8,0xb8,0x3b,0xaf,0xf6,0xf0,0x18,0x31,0xeb,0x8e,
+0x9e,0x0,0x37,0xea,0x1d,0xc5,0x8a,0xf,0x18,0x76,0xd7,0xda,0x85,0x10,0x70,0xb2,
+0xc7,0x9a,0x9c,0x56,0x28,0x6d,0xf3,0x87,0xf8,0xe3,0x64,0x81,0x9b,0xec,0x46,0xd7,
+0x93,0xe0,0xd,0x74,0xb8,0x5d,0xe5,0xc6,0xda,0x66,0xe4,0x25,0xea,0xa1,0xa2,0x4f,
+0x74,0x1c,0x72,0x63,0xfa,0x9f,0x7f,0xa6,0x3c,0x33,0x8e,0x61,0xe6,0x6a,0x35,0xc5,
+0x47,0x2d,0x79,0x89,0x5b,0x32,0x32,0x6e,0x73,0xca,0x8f,0x43,0x36,0x71,0xc6,0xf,
+0xe3,0x18,0xa5,0x55,0xbf,0xfa,0x23,0x70,0x64,0xe7,0x62,0xaa,0x47,0x3d,0xc,0xd1,
+0x12,0x90,0x1,0x23,0xd0,0xa4,0xf7,0x4d,0x1a,0x29,0x72,0xab,0xeb,0x6c,0x47,0xef,
+0xc2,0xa7,0x88,0xe3,0x96,0x33,0xb8,0xfb,0x17,0x57,0x1f,0x93,0xf4,0xe6,0x71,0x80,
+0xe4,0x8f,0x84,0x1c,0x3a,0xa5,0x10,0xe4,0x44,0xd2,0xcc,0x3a,0x1c,0xe2,0xb7,0x17,
+0x8a,0x6b,0x7a,0x94,0x8a,0x58,0x1c,0xbb,0x5f,0x8b,0xc0,0xf7,0x26,0x2,0xde,0x89,
+0x63,0xe,0xac,0x9,0x87,0x88,0xae,0xce,0x40,0x82,0x98,0x7,0xb2,0x31,0x91,0x8c,
+0xe,0xa9,0xc6,0x14,0x90,0x2f,0x6b,0x4c,0xf3,0xd3,0x58,0x2a,0xbf,0xe0,0x38,0xa7,
+0xed,0xb6,0xe0,0xd8,0x4c,0x8e,0x80,0x7b,0xfe,0xf6,0xd,0xde,0x50,0x68,0x2d,0x9d,
+0xf2,0x7a,0x77,0x20,0x2d,0xaa,0x67,0x3a,0x21,0xf4,0xa4,0xdd,0x2f,0x3e,0xd7,0xdc,
+0x8a,0xc9,0xd7,0x8f,0x3,0xd9,0x30,0xc5,0xe,0xe9,0xc3,0xd1,0x4d,0x64,0x4,0xc8,
+0x44,0x92,0x7e,0x24,0x20,0x63,0x42,0x81,0x9a,0x54,0x63,0xa5,0x49,0x4e,0x1d,0xa,
+0x36,0xe6,0xe7,0xcd,0xa6,0xe2,0x3a,0x21,0x70,0x1c,0x32,0xe6,0x63,0x5a,0x54,0x65,
+0xc8,0xf7,0xaf,0x43,0x80,0xf5,0x9,0x48,0x48,0x52,0x94,0x3d,0xb2,0xd5,0x79,0x70,
+0xb3,0x9e,0x7e,0x79,0x2b,0xa4,0x4c,0x5,0x70,0x51,0x4f,0xfd,0xb8,0x48,0x5a,0xe9,
+0x93,0xab,0x75,0x82,0x89,0x41,0xa6,0x91,0xfe,0x1a,0x3,0x1d,0xed,0x14,0xe9,0x54,
+0x13,0xa8,0x29,0xb9,0x9,0x43,0x82,0xcd,0x67,0x0,0x9,0xff,0x46,0x70,0x1c,0x27,
+0xe4,0x2c,0x2a,0xae,0x27,0x0,0xc7,0x83,0xe0,0x48,0xde,0x90,0x21,0x67,0x12,0x7,
+0xfb,0xe1,0xe9,0xb0,0xe0,0xd8,0xfc,0x42,0xcb,0xc0,0xc6,0x41,0xa1,0xe1,0x46,0xfb,
+0xea,0x87,0x71,0x64,0xdf,0x2c,0x92,0x6e,0x84,0x1c,0x1e,0xd3,0xa4,0xc9,0xfd,0x36,
+0x74,0xac,0xdd,0x30,0xd2,0x51,0xd7,0x26,0xf,0x75,0xa8,0x79,0x3e,0x50,0xa9,0x4f,
+0x70,0x3f,0xb6,0xee,0x58,0x70,0x3c,0x4e,0x78,0xc1,0x5b,0x14,0xb9,0xba,0xc,0xc3,
+0x42,0x38,0x4a,0xb0,0xa8,0xd4,0xa4,0xf1,0x85,0x27,0xc2,0x91,0xc,0xf6,0xaf,0x6d,
+0x9b,0x12,0xa6,0x3f,0x1c,0x36,0x54,0xe6,0xe3,0x8f,0xe2,0x68,0x49,0xc4,0x2c,0x79,
+0x8b,0x7a,0x1c,0x7d,0xaf,0xeb,0x63,0x26,0xdc,0xc8,0xbe,0x90,0x4a,0x24,0x68,0xab,
+0x40,0x9e,0xa3,0x1f,0x9c,0x7,0x15,0x8f,0xf9,0x1c,0x37,0x2e,0x9c,0x71,0x24,0x5b,
+0x5d,0x51,0x48,0x43,0xa1,0x35,0xc9,0xdf,0x8e,0xcf,0xf5,0x81,0x2,0x27,0x54,0x14,
+0xdd,0x82,0xa3,0x9e,0x9a,0x5f,0xca,0xd2,0xc5,0x2e,0x71,0xa,0xd1,0x98,0x88,0xca,
+0x49,0xf8,0x51,0x1c,0xf9,0x66,0x4,0x52,0x84,0x9a,0x22,0x16,0xc2,0xb0,0x9e,0x8,
+0xc3,0x60,0xe2,0x10,0x28,0x50,0xf3,0x74,0xc2,0xd3,0x54,0x67,0xc6,0xaf,0xff,0x14,
+0x76,0x41,0xe5,0xb9,0x8f,0xe2,0x5,0xe1,0xc,0xb2,0xba,0xca,0xb6,0x55,0x67,0x49,
+0xfe,0x76,0xbb,0x67,0xee,0x6c,0xa6,0x28,0x54,0x19,0xba,0xa3,0x8e,0xce,0xf5,0x37,
+0xc2,0x51,0xca,0x69,0xbf,0xc,0x48,0xdc,0x25,0xd2,0xc6,0x43,0x46,0xd4,0x81,0x8c,
+0xff,0xf,0xe2,0x48,0xbf,0x87,0x1c,0x1d,0x32,0x2e,0xe4,0xc1,0x11,0x76,0x24,0x8c,
+0x36,0x92,0x8d,0x31,0x24,0x89,0x13,0xe7,0xcd,0x6a,0x47,0xb1,0x76,0x63,0xfb,0x66,
+0xe9,0x96,0xfa,0x34,0x1c,0x31,0xdd,0x80,0x6a,0x42,0xdb,0x75,0x64,0xaf,0xc9,0xf5,
+0x7e,0x81,0xdf,0x43,0xae,0xb7,0x3a,0xd9,0x1d,0x37,0xbb,0xaa,0xf9,0xa5,0xc1,0xc,
+0xde,0x12,0x3a,0xe8,0xa6,0x84,0xc4,0x67,0x3d,0xfd,0x20,0x8e,0xa0,0x61,0xc,0xf0,
+0x1b,0xc9,0xe7,0xa9,0xdd,0x31,0x12,0x86,0x1,0x3d,0x65,0x93,0x22,0x6c,0xd3,0xe0,
+0x1a,0x4f,0x6f,0xb0,0x91,0xae,0x0,0xf3,0x29,0x96,0xd3,0xa3,0x77,0x94,0xfd,0xf0,
+0xc8,0x67,0x5a,0xc1,0x5e,0xb7,0xbe,0xd6,0xbb,0xdd,0xb,0x9d,0xf7,0xa0,0x67,0x8f,
+0x1c,0x3c,0x99,0x19,0x7a,0x94,0x3e,0x7a,0xd3,0x34,0xbf,0x34,0x28,0x64,0x39,0xaa,
+0x5d,0x13,0xd0,0x14,0x1b,0x7e,0xd0,0xce,0x20,0xb7,0x6d,0xdd,0x0,0xe3,0x12,0x2a,
+0xa,0xc8,0x6,0x8e,0xb,0xb9,0x26,0x43,0xae,0x64,0xa2,0xd3,0xed,0xb5,0xe4,0xad,
+0x9a,0xcf,0x6a,0xed,0x24,0x27,0x0,0x1d,0x29,0x88,0xb,0xb7,0xd6,0x48,0xa7,0xb8,
+0xc5,0x8c,0xe6,0x6,0x38,0xee,0x83,0x9b,0xe7,0xdc,0x23,0x67,0x1,0xa9,0xad,0x8f,
+0x71,0x9,0x5a,0x7f,0x9d,0xeb,0x8,0x22,0x2b,0xd2,0x5e,0x38,0xd6,0xe9,0x87,0xfd,
+0x1e,0x63,0x48,0xfc,0x32,0xe,0xb5,0x36,0xda,0x69,0x4e,0x95,0xc1,0x8d,0xf4,0x50,
+0x98,0xca,0xd,0x3a,0x7d,0x6e,0xfa,0xf,0x88,0xe9,0x40,0x38,0xba,0x61,0x9e,0x2a,
+0xcc,0x5d,0x13,0x8e,0xbd,0x99,0x8e,0xc7,0xdd,0x6,0x1e,0x23,0x67,0xcb,0xc8,0x16,
+0x6d,0x36,0x90,0x4e,0xc2,0xf4,0xa6,0xc7,0xa2,0xe1,0x7e,0x19,0x26,0xba,0x38,0x19,
+0xa,0xe9,0xa9,0x36,0x25,0x7e,0x24,0xa7,0xdd,0xd8,0x29,0x83,0xed,0xcb,0x7b,0x4f,
+0xa1,0x3a,0xe8,0xbf,0xa,0xff,0x57,0x42,0x11,0x6d,0x29,0xa0,0xa0,0xd9,0x81,0xe,
+0xc8,0x48,0xd1,0x9b,0x27,0xa1,0x1c,0xf5,0x8f,0xbf,0x51,0xc2,0x28,0xf,0xc1,0xd2,
+0xa1,0x1e,0x5c,0xd2,0xee,0xa8,0x27,0x87,0x92,0xb5,0xab,0x13,0x32,0xe2,0xc1,0x81,
+0x50,0xe2,0x33,0xc7,0x30,0xda,0x8c,0x6e,0xc7,0x17,0xe0,0x45,0x42,0x8f,0x68,0x6,
+0xe7,0xba,0x69,0x28,0x30,0xdc,0x4,0x7c,0x7d,0xef,0x66,0x3a,0x60,0x9a,0x71,0x24,
+0x4c,0x15,0x13,0x5a,0x9c,0x8f,0xb6,0x3d,0x79,0x7d,0x1c,0x5c,0x71,0xad,0xd6,0x82,
+0x38,0x44,0xd0,0xb4,0x7d,0x66,0xae,0x34,0x5d,0x97,0x41,0x70,0x19,0x4b,0xe1,0x7f,
+0x86,0x72,0xd5,0xc8,0x83,0xc4,0x84,0x31,0x7b,0xb2,0x5f,0x13,0xfa,0xbe,0x28,0xf8,
+0x65,0x2b,0xf3,0x13,0x7a,0x9f,0xde,0x3,0x1d,0x6c,0x2,0x8e,0xa2,0x18,0xa0,0x19,
+0x50,0x96,0x21,0x47,0x78,0xc,0xb5,0x46,0x40,0x63,0xb,0x35,0xcf,0x67,0xe1,0xd8,
+0xba,0x51,0x73,0xc7,0x1e,0xe1,0x15,0x58,0x37,0xa2,0xfa,0xf,0x33,0x17,0x36,0xbb,
+0x43,0xa9,0x23,0xea,0xdd,0xe1,0xc0,0xde,0x63,0xbc,0xad,0x5,0xc9,0xfc,0xe2,0xd9,
+0xa9,0x14,0xf6,0x10,0x70,0x6,0x9,0x80,0x83,0xb0,0xf8,0x9,0x3d,0x67,0x5d,0x88,
+0x12,0x85,0x64,0x52,0x88,0x11,0x99,0x28,0x11,0x3a,0x31,0x44,0x92,0xf6,0x4,0x64,
+0xfb,0xc4,0x63,0x2c,0xf9,0x27,0x14,0x8,0xbd,0xce,0x8c,0x2,0x3f,0x39,0xf3,0x24,
+0x91,0x84,0x5d,0x9c,0xc6,0x1,0x85,0x57,0x6,0x11,0x93,0x94,0xf6,0x7d,0x73,0x8,
+0xef,0xc5,0x91,0x6c,0x88,0x74,0x90,0x6a,0x6e,0xad,0x47,0x9f,0x3e,0x3d,0xc3,0xd6,
+0x43,0x6,0xf,0x87,0x6f,0x4f,0x7e,0x26,0xed,0xb8,0x63,0x9b,0x3e,0xeb,0xbe,0x64,
+0xc3,0x9b,0x55,0x7a,0x4f,0xe6,0x4b,0x14,0x22,0x39,0x5b,0x58,0x9,0x72,0x44,0xdc,
+0xc0,0x7d,0xeb,0x3,0xf3,0xf9,0x15,0x42,0xc4,0xa3,0x90,0x4c,0xd6,0xb,0xa6,0xcc,
+0x8d,0x28,0x9f,0xd7,0xcc,0xf8,0x77,0xf4,0xb0,0x2f,0xa1,0xd2,0xe8,0xa5,0xf3,0x3f,
+0xe1,0x8e,0x80,0xe5,0x84,0x4,0x32,0x91,0xb9,0x71,0x4,0x24,0xd9,0x6b,0xb8,0x0,
+0x81,0x2,0xc5,0x90,0x4b,0x4f,0x99,0x29,0x5c,0x31,0x9f,0x13,0xcc,0x5a,0x7b,0x4,
+0xa3,0x4f,0xe9,0x3,0x70,0x99,0xed,0xc,0xfd,0x37,0x69,0xd2,0x8b,0x84,0x24,0xe6,
+0xe4,0x76,0xe1,0xf0,0x8d,0x4e,0xfe,0xf1,0x98,0x9a,0x35,0xdd,0xfd,0x59,0x3f,0x5a,
+0xa1,0x7e,0x35,0xcc,0x56,0x4c,0xc1,0x64,0x19,0x14,0x1d,0xea,0x93,0xe4,0x9d,0xe4,
+0xaf,0x48,0x61,0xf9,0xff,0x28,0x4c,0xbc,0xc7,0x93,0x80,0xf2,0x8,0xb,0xa,0x51,
+0x35,0x7c,0xc8,0x9f,0x98,0x6b,0x44,0x52,0x3f,0xa0,0x28,0xd8,0x93,0xd6,0x18,0x7c,
+0x44,0x96,0xc7,0xf,0x5e,0x45,0x8d,0xf2,0xe0,0xa7,0x53,0x96,0xd8,0xbe,0x83,0xc5,
+0x46,0x5f,0xa,0xd9,0xe6,0x9a,0xa2,0x28,0xa9,0x2e,0x6c,0xb7,0xe9,0xa8,0xdd,0x66,
+0x87,0xd9,0xd7,0xdd,0x8e,0x7c,0x1e,0xb2,0xe8,0x47,0x14,0x84,0x1a,0x25,0x1d,0xfe,
+0xe7,0xb4,0x16,0xb7,0x5a,0x73,0x37,0x82,0x60,0x28,0xa2,0x25,0x72,0x37,0x9c,0xcf,
+0xf1,0x50,0x88,0x62,0x87,0x82,0xd7,0x8a,0xf6,0x14,0xdf,0x2f,0x67,0x9f,0x29,0xaf,
+0x28,0x6e,0x3,0x1b,0x84,0x42,0x2,0xe1,0x7,0xed,0x35,0xb7,0xeb,0x68,0x38,0xe2,
+0xd5,0x34,0x90,0x9d,0x89,0xe4,0x8a,0x27,0x78,0xa6,0xe4,0x90,0xcb,0x89,0x6a,0xaa,
+0xe6,0x13,0xd,0x36,0x3a,0x50,0x48,0x43,0xd6,0x2e,0xa2,0x8b,0x74,0x3,0x7b,0x40,
+0x6a,0x6a,0xea,0x3b,0xd5,0x26,0x66,0x36,0x3,0x8a,0x7,0xd8,0x1b,0x3d,0xeb,0xb6,
+0x10,0xfe,0x18,0x7b,0x4a,0xf,0xf2,0x3e,0x6,0xa8,0xc8,0x29,0xc7,0x50,0xba,0xac,
+0xeb,0xd5,0xd9,0x65,0x8e,0xc4,0xd5,0x25,0x9f,0xcd,0xa7,0xab,0x16,0x50,0xb,0xb7,
+0x31,0xe1,0x8c,0xe1,0xc8,0x1e,0xbf,0x67,0x4c,0x24,0xdf,0xf6,0x87,0xf3,0x14,0x2c,
+0x8e,0xf4,0x6b,0x26,0x53,0xf5,0x68,0xb9,0x85,0xf,0x64,0xbd,0x4e,0x7e,0x32,0x65,
+0x60,0xb0,0xd0,0xcb,0x7c,0x96,0xbf,0x66,0x55,0x1e,0xc5,0x87,0xdc,0x1f,0x36,0x9b,
+0xa0,0x85,0x7,0x4d,0x3b,0xc,0xc6,0xc1,0x6f,0xdc,0x20,0x2f,0xfe,0xb4,0xc7,0x7b,
+0xd6,0x21,0x61,0x24,0x42,0x5d,0x85,0xe,0x64,0x93,0x41,0x88,0x88,0x66,0xf5,0x91,
+0x45,0x4b,0xd4,0xe0,0x71,0x38,0x81,0xc7,0x26,0x39,0x78,0xb8,0x3b,0x8b,0xbf,0x73,
+0xbe,0x62,0x24,0x5f,0xc8,0xd5,0x22,0xb1,0xd0,0xa9,0xc6,0xe3,0x37,0x21,0x2e,0x2e,
+0x9,0xdd,0x8f,0x9,0x6,0x83,0x68,0xbb,0xe,0xcd,0x64,0xa8,0xab,0xaa,0xaa,0x27,
+0x2f,0xa,0xc9,0x89,0x3a,0xd4,0xbd,0xad,0x7e,0x49,0xba,0x8a,0x69,0xcc,0x12,0x44,
+0x48,0xfa,0x9a,0xc9,0xb9,0x23,0xff,0x5f,0x24,0x8a,0xa7,0xd9,0xf,0x2f,0x2f,0xdf,
+0xd8,0xfb,0x1,0x7b,0xa,0xbe,0xe4,0x41,0x5c,0xca,0x6d,0x45,0x7d,0x3f,0x81,0x35,
+0xdb,0x69,0x9e,0x9c,0x3f,0xc9,0x9f,0x88,0xa0,0xfc,0x25,0xf8,0xd1,0x4f,0xe4,0x69,
+0x9a,0x7a,0xd0,0x33,0xa0,0xa1,0x72,0x95,0x9d,0xc5,0xe4,0xb7,0xa5,0xdf,0x43,0xee,
+0xa5,0xf,0x9a,0x87,0x2f,0x82,0xd1,0xac,0x5f,0x61,0xc2,0x53,0xaf,0x16,0xaa,0xe9,
+0xe6,0xe4,0xa2,0x7e,0x3f,0x42,0xb7,0x55,0xa7,0x12,0xb3,0xb9,0xe9,0x89,0x9b,0xe9,
+0x3d,0x5c,0xfb,0x41,0x6b,0xff,0xab,0x46,0x77,0x15,0x8,0x29,0x94,0x47,0xff,0xc9,
+0xe1,0x1,0x93,0xeb,0x70,0x93,0x83,0xb,0xe,0x17,0x7d,0xc4,0x15,0xec,0x7,0xe9,
+0x4b,0xc1,0xff,0x32,0xc5,0xa8,0xf9,0x7b,0x8e,0x69,0xc7,0xf9,0x54,0xe,0x75,0xf1,
+0x69,0xe6,0xe5,0xe0,0xf2,0x14,0xb7,0x0,0x48,0x66,0xab,0x2a,0xc,0x73,0xaf,0xe4,
+0xb7,0x59,0x5b,0x10,0x98,0x9e,0xe,0xe2,0x31,0x27,0x1e,0x20,0x60,0x3e,0xf3,0xa3,
+0x8e,0xac,0x8f,0x8d,0x78,0xa8,0xdf,0x87,0x80,0x2c,0x88,0x61,0xf1,0xc8,0x3c,0x82,
+0x30,0x46,0xa1,0x38,0x21,0x77,0x6a,0x8c,0xe8,0xe9,0x69,0xe4,0x38,0x7d,0x3a,0x96,
+0xaa,0x3,0x45,0x61,0xb,0x46,0xa,0xf6,0x7e,0x50,0xf5,0xdf,0xbf,0x1c,0xf8,0x42,
+0xf9,0xff,0x1,0x15,0x6c,0x4c,0x1b,0x8e,0x50,0x6d,0x4c,0xc0,0x59,0xb3,0x1a,0xac,
+0x79,0xfa,0x69,0x10,0xae,0x71,0x70,0xec,0x8a,0xe3,0xc2,0xd4,0xc4,0x84,0x60,0x82,
+0x0,0xda,0xa6,0x33,0xe7,0xc3,0xd6,0xb6,0xaf,0x14,0x62,0x96,0x3,0x69,0x1a,0x3d,
+0x1e,0x8f,0xc1,0x84,0x41,0x28,0x7b,0x21,0x95,0x14,0xdb,0x24,0xa1,0x56,0x6d,0xca,
+0xec,0xd0,0x3b,0x44,0x83,0x94,0xcf,0x44,0x32,0x5d,0x23,0x30,0x92,0xe6,0x1d,0xd4,
+0x69,0x90,0x5,0xb7,0x6,0x33,0xf9,0xbf,0x22,0x89,0xdf,0x61,0x10,0xa9,0x52,0xb1,
+0x86,0xbc,0xe1,0xc,0x93,0x2e,0x3c,0x5d,0x4f,0x4f,0x4f,0xdf,0x10,0xc5,0xd4,0x21,
+0x45,0x26,0x26,0x15,0xb6,0xb4,0x85,0xd2,0x94,0xfe,0x67,0x7f,0x85,0xfd,0x68,0x9c,
+0x6c,0x64,0x29,0x23,0x43,0xa8,0xb8,0x55,0x52,0x75,0xe0,0x6a,0x31,0xef,0xa8,0xea,
+0xb1,0xd4,0xc1,0xcb,0x1b,0x72,0x2f,0x2,0x2e,0xe4,0x39,0x2c,0xfd,0x69,0xf1,0x58,
+0xbf,0xf,0xa3,0x11,0x25,0x40,0xf7,0x82,0xef,0x7a,0xe2,0x9f,0x68,0x38,0x1b,0x99,
+0xa7,0xa,0xb3,0xbb,0xe6,0x97,0x24,0x7,0x6c,0xaf,0x4c,0x8b,0xc9,0xad,0xac,0x67,
+0xd4,0x57,0xf,0x87,0x82,0x60,0x41,0xf2,0x10,0xf4,0xc,0x67,0x68,0xab,0xfa,0xe4,
+0x48,0x26,0x19,0xc6,0x51,0x84,0x72,0xac,0xeb,0x62,0x1d,0xd8,0xb7,0x71,0x2,0x21,
+0x33,0xd4,0x70,0x4c,0x68,0xcf,0x3a,0x50,0xc,0xbc,0x79,0x8b,0xb7,0x86,0x3c,0x3a,
+0x70,0x42,0x90,0x97,0x7,0x3b,0x57,0xb,0xbd,0xdd,0x28,0xb7,0x2e,0xe1,0x5e,0x34,
+0x56,0xbd,0xd3,0x50,0x53,0x90,0xce,0xa7,0x4,0x3,0x97,0x95,0xe2,0xe0,0x45,0x15,
+0x3e,0x3c,0xf3,0x8b,0xca,0x22,0xd6,0x1a,0x8e,0xa8,0xc9,0xf3,0x86,0x48,0xc2,0x4e,
+0x38,0x3e,0xd1,0x74,0x49,0xbf,0xde,0x7c,0x74,0xd9,0x6e,0x2d,0x92,0x6a,0x93,0xb8,
+0x36,0xf8,0xbf,0x66,0x2a,0x44,0xfa,0x80,0xfd,0x15,0x31,0x3e,0x93,0xcc,0xc6,0x9a,
+0xb6,0xa5,0x7b,0xde,0x1a,0x94,0xcc,0x30,0xea,0x69,0x96,0x55,0x4b,0xf7,0xf3,0x32,
+0x8d,0x18,0x7d,0x83,0xe6,0x58,0xfa,0xdd,0x93,0xe5,0x91,0xd3,0x24,0xf9,0xc7,0xa1,
+0x10,0x80,0xc6,0xa2,0xd6,0xbe,0x3b,0x9a,0x2f,0xe5,0xad,0x24,0x7c,0xe8,0xa1,0x12,
+0x77,0x17,0xf0,0x59,0x53,0xa6,0x80,0xc5,0x71,0xfc,0xec,0xab,0xb3,0x7d,0xdf,0xf0,
+0x94,0x21,0xb9,0xf8,0xd1,0xcd,0xc3,0x0,0x3e,0x6c,0xb2,0xcb,0x6c,0xb3,0x47,0xa1,
+0x56,0x30,0xcb,0x14,0xb6,0xda,0xf2,0x76,0x15,0x72,0x89,0x44,0x39,0xc2,0x7c,0x8b,
+0xc,0x16,0x1e,0x44,0x75,0x2a,0x3a,0x34,0x57,0x36,0x94,0xe5,0xf1,0x75,0xb7,0x9a,
+0xe4,0x85,0xdb,0x70,0xb8,0x73,0x84,0x2e,0x64,0x46,0x1d,0xb,0xa4,0xd0,0x2e,0xba,
+0x6c,0x84,0xe1,0xa1,0xf9,0xee,0xc1,0xa6,0xd7,0x4a,0x7a,0x96,0xb4,0x2b,0xa2,0x58,
+0xc3,0xa7,0xba,0x29,0x10,0x9a,0xc5,0xa6,0x7d,0x3e,0x8e,0x1d,0x79,0x23,0xd,0x2,
+0x98,0x1e,0x76,0x2d,0x7b,0x37,0x8b,0xcd,0xe5,0xb8,0x84,0xdc,0xf3,0xcc,0x13,0x9b,
+0x12,0xc4,0x54,0xdb,0x2d,0xc7,0x0,0x6,0x2d,0xe3,0xe2,0xcb,0x58,0x49,0x28,0x57,
+0x17,0xd8,0x95,0x40,0x41,0x30,0x5d,0x18,0x3b,0xbf,0x7b,0x1c,0x33,0x86,0x59,0x92,
+0xe5,0x1,0x2b,0x8f,0x8,0x49,0x31,0x67,0x60,0x2d,0xb3,0xe5,0x48,0x91,0xbc,0x63,
+0x3f,0x1,0x3f,0x19,0x79,0x8e,0x50,0xb0,0xa9,0xfa,0x9d,0xeb,0xc,0xb6,0x7c,0x81,
+0x1,0x49,0xe2,0xc1,0x29,0x73,0x9a,0x90,0x1d,0xe6,0xac,0xb6,0x6,0x6c,0x90,0x8a,
+0xcf,0x13,0xba,0x4,0xee,0xb4,0x39,0xfc,0x74,0xdb,0x83,0x88,0x91,0xe1,0x94,0x23,
+0x4f,0x58,0x8d,0xc3,0xc4,0xa1,0x66,0x63,0x7d,0x11,0x47,0xa8,0x12,0xa7,0x38,0xad,
+0x64,0xde,0xbe,0x2b,0x24,0x7d,0x19,0x56,0xb0,0x3e,0x86,0xdf,0xcb,0x50,0x72,0x89,
+0x63,0xbf,0xdd,0x2a,0x20,0xc7,0xc,0xe2,0xca,0x76,0x74,0x14,0xcd,0x3d,0x1c,0x57,
+0x78,0x7e,0xa,0x8e,0xf4,0x9e,0x1d,0xeb,0x41,0xd,0x33,0xe6,0x79,0xba,0xbc,0x41,
+0x42,0x21,0xb9,0x41,0xb8,0xe3,0x6b,0x14,0xa0,0x59,0x93,0xbe,0x45,0x2f,0xb,0x2b,
+0x13,0x98,0x8,0xb8,0xce,0x3f,0x32,0x6f,0xf9,0xe3,0xf9,0x4e,0xe1,0x9d,0x81,0x5d,
+0x93,0xa9,0xa3,0xa6,0x21,0x28,0xf9,0x13,0xfc,0x6b,0x98,0xa4,0x2,0x72,0x8a,0xeb,
+0xd4,0x78,0xb3,0x7c,0xb0,0xf2,0x5c,0x7e,0x12,0x46,0x14,0xed,0x75,0xac,0x32,0xdb,
+0x96,0xcc,0x1b,0x6f,0x78,0x24,0xd5,0x54,0x53,0x28,0xfc,0x4e,0xc3,0x10,0x4b,0x4a,
+0xe4,0xd,0x71,0x6c,0xaa,0xc8,0x21,0xfe,0xd1,0x77,0x8d,0xf9,0x7d,0xfd,0x85,0x2b,
+0x1c,0x55,0x89,0xd9,0x2a,0x9e,0x80,0x95,0xc6,0x5c,0x25,0xa8,0x5e,0xe1,0xf8,0x4b,
+0xca,0xff,0xb6,0x9a,0xa6,0x8a,0x82,0x60,0x2e,0x6f,0x55,0x4b,0xbe,0x1a,0xe5,0x7c,
+0x74,0xaa,0xb,0x99,0xe5,0xe8,0x61,0x7f,0xd5,0xeb,0x7d,0x9f,0x4,0x7e,0xcf,0x54,
+0x2f,0x43,0xdd,0x77,0xbf,0xb7,0xd9,0x95,0x59,0x3e,0xcc,0x12,0x9d,0xb5,0xa7,0xa8,
+0xa3,0x29,0xa7,0x1e,0xbe,0x89,0x3a,0x5d,0x2b,0x10,0x3f,0x17,0xcf,0x9e,0xd,0xed,
+0xc4,0xf9,0xb4,0xcc,0x73,0x1a,0x28,0x8b,0xca,0xd6,0x82,0x66,0xe2,0xea,0x21,0x3c,
+0x42,0x37,0x55,0x6f,0xd,0x85,0x93,0x76,0xf4,0x1c,0x57,0xd7,0xa9,0xe9,0x9a,0x5f,
+0x58,0x67,0xff,0x3e,0x8e,0xfc,0xaf,0xb8,0x59,0xf4,0xe1,0x35,0x8e,0x57,0x41,0xf1,
+0x27,0xca,0x23,0x37,0xa8,0xfa,0x41,0xf6,0xdd,0x8,0x49,0x7c,0xa9,0x95,0xd3,0xd7,
+0xfb,0xc8,0xdc,0x44,0x90,0xb3,0x54,0xbd,0x8e,0x24,0xfa,0xf4,0x38,0x83,0x39,0xba,
+0xae,0xb3,0x9f,0x38,0xf5,0xfc,0xe,0x76,0xb3,0xe5,0x5f,0x20,0x6,0x8f,0x1c,0xb,
+0x68,0x58,0x9d,0x83,0xc3,0xf0,0xcc,0xef,0xd3,0xca,0xd9,0xff,0x75,0x65,0x6b,0x9c,
+0xe2,0xcc,0x5e,0x3e,0xf8,0xb0,0x9a,0x7e,0x59,0x9f,0x41,0x86,0xe,0x14,0x31,0x51,
+0x17,0x89,0x1c,0xd2,0x9b,0x75,0xeb,0x20,0xec,0x31,0xa9,0x69,0x3e,0xb1,0xaf,0xb0,
+0x69,0xbe,0x27,0x37,0xd7,0x38,0x2a,0xc6,0x91,0xf7,0x2e,0xa8,0xdf,0x89,0x23,0x9c,
+0x7c,0x43,0xda,0x11,0x62,0x7,0x43,0xad,0x4a,0x79,0x59,0x7c,0x50,0x88,0x27,0x80,
+0x94,0xa5,0x2f,0xf9,0x8e,0x5b,0x58,0xfc,0xff,0x36,0xb3,0xdb,0x5b,0xbb,0x42,0x79,
+0xf2,0xee,0x23,0xc3,0x83,0x93,0x66,0x8b,0xf8,0xca,0xc0,0x59,0x26,0x34,0xc8,0x6b,
+0x81,0x9f,0x3c,0xb5,0x1d,0x99,0xb,0xd3,0x74,0xc8,0xba,0xf0,0xd0,0x2a,0xa6,0x7e,
+0x81,0x91,0x4c,0xbd,0xc1,0x42,0x7f,0xc6,0xbe,0x4,0x61,0x78,0x6,0x75,0x24,0xa6,
+0xe6,0xf8,0x35,0xb5,0x70,0x80,0x3b,0x9e,0xec,0xc6,0x1f,0x3c,0x6f,0xdf,0x1b,0xb3,
+0x45,0xed,0xa7,0xef,0xac,0x81,0x96,0x35,0xa5,0xd4,0x7d,0x3e,0x39,0x14,0x5,0xb0,
+0x76,0x4c,0xf7,0x1a,0xc0,0x50,0x7f,0x74,0x43,0xd9,0xb,0x98,0x38,0x7c,0xbf,0xe2,
+0xcb,0x32,0x6c,0x98,0xbc,0x24,0x8a,0xd2,0x47,0xa9,0x63,0x3a,0x3,0x24,0x99,0x37,
+0x9c,0x7f,0x37,0x7b,0xd1,0xe,0xf3,0x80,0x48,0x0,0x92,0x33,0x9d,0x7b,0x7a,0x80,
+0x31,0x3d,0x73,0xa9,0xd8,0x8e,0xb3,0x9c,0x8c,0x23,0x67,0xd,0xcc,0xcf,0x4b,0x7c,
+0x5b,0xea,0x39,0xa8,0x7c,0x1b,0xbe,0x3f,0x14,0x59,0x57,0xd8,0x4e,0xc5,0xf7,0xb8,
+0x43,0x76,0xa1,0x53,0xfd,0x94,0xa7,0x9e,0xa5,0xba,0xe3,0xc,0x21,0xe7,0xc0,0x9a,
+0x2b,0xd,0x4,0x13,0x81,0x45,0x7f,0xf6,0x6e,0x19,0x15,0x2d,0xca,0xa3,0x54,0xc6,
+0x52,0x29,0xb6,0x99,0xcb,0x80,0xd0,0x54,0x7d,0xcd,0xc5,0x9,0xa7,0x7e,0xc4,0x17,
+0xc3,0x22,0x3d,0xdb,0xa1,0xe3,0x2f,0x7,0xcd,0x69,0x68,0x59,0x76,0x84,0x5b,0x87,
+0xee,0x9d,0xd4,0xd3,0xbb,0x23,0x9c,0xfb,0xc2,0x51,0xa8,0x8c,0xea,0x1b,0xf3,0x39,
+0xbc,0xc1,0xcc,0x18,0xa0,0x4,0x3f,0x9c,0x6,0x11,0x4d,0x3a,0x15,0x74,0x2e,0x4a,
+0x64,0x24,0x99,0x61,0x49,0xb,0x7b,0xec,0x26,0x20,0x39,0xb4,0xf2,0x73,0x67,0x83,
+0xc1,0x59,0x1a,0x2e,0x6f,0x31,0xa5,0x6f,0x73,0x2b,0x8f,0x96,0x7b,0xbd,0xf9,0xd8,
+0x1e,0xe9,0x41,0xcd,0x65,0xdf,0xa2,0xc4,0xa1,0x36,0x72,0xae,0xe8,0x98,0x3e,0xec,
+0xd3,0x36,0x7c,0x82,0xe8,0xd6,0xd3,0x1d,0x20,0xd7,0x7f,0x90,0xc5,0x5b,0x3c,0x5f,
+0xc9,0x17,0x27,0x64,0x50,0xba,0x12,0x82,0xdc,0xe,0xaf,0xdf,0xf0,0x5e,0xa3,0xcf,
+0xc1,0x51,0xdc,0xcc,0xae,0x93,0x48,0xa7,0xe0,0xd8,0xe7,0x8,0xf8,0x90,0x2f,0x97,
+0xf4,0xda,0x8c,0xfc,0xc7,0xcc,0xdb,0x25,0xb1,0x94,0x2e,0x2f,0xd6,0x7f,0x6d,0x78,
+0xc1,0xba,0xc1,0x9d,0x76,0xfd,0xdd,0x63,0x42,0x1,0x82,0x32,0x93,0xe7,0x94,0xe4,
+0x11,0xb6,0xc8,0x5c,0x24,0x24,0x8b,0x6d,0x77,0xb2,0x37,0xb0,0xff,0x30,0xd9,0x84,
+0xaa,0x20,0x8a,0x60,0x36,0x81,0xfa,0x18,0xe6,0x92,0xaf,0x86,0xdf,0x3a,0x62,0xdf,
+0x89,0x14,0xdf,0x91,0xac,0xd6,0x3e,0x66,0x72,0xaf,0xb9,0x97,0xbe,0x57,0x3d,0x16,
+0xbc,0x6e,0x95,0xfd,0x79,0xed,0xd8,0xa9,0x25,0x6e,0x84,0xb4,0xe7,0xb2,0xe6,0x74,
+0x2c,0x6d,0x12,0xc8,0x1d,0x49,0x45,0xa2,0x3e,0x8e,0x7c,0x67,0x9,0x2b,0x1d,0xd2,
+0xb6,0x27,0x6d,0xb3,0x3e,0xd9,0xfc,0x4a,0x72,0x4c,0xe2,0x7d,0xdf,0xcf,0x3f,0xd0,
+0xb9,0xc5,0xe6,0x35,0x5e,0x5e,0x82,0xa3,0xbd,0xbe,0xd,0xbc,0xf,0xa1,0x97,0xa,
+0xaf,0xff,0x91,0x3e,0xc,0xc6,0xb1,0x33,0x11,0xbf,0x2,0x5e,0x3,0xaf,0x30,0xe3,
+0x73,0x2d,0xef,0xe1,0x38,0x4b,0x5,0x10,0xd1,0xbe,0xf6,0x99,0xf9,0xab,0x61,0x9b,
+0xc9,0x37,0xb4,0xbd,0xfa,0x4,0x2b,0xd3,0x15,0x1c,0x1b,0x49,0xa9,0x95,0x36,0x9e,
+0x91,0x97,0xd2,0x1d,0x17,0x1c,0x21,0x8b,0xf3,0x78,0x9c,0xe5,0xf3,0xba,0xe,0x9,
+0x53,0xf2,0x97,0xe7,0xd7,0x9e,0xc2,0xcc,0x7b,0x76,0x16,0xee,0x25,0xc9,0x64,0x14,
+0xff,0xb0,0xae,0x7b,0xa1,0xed,0x58,0x77,0x23,0xd8,0x34,0x70,0x22,0x3d,0xdb,0x1f,
+0xd0,0x4f,0x98,0x62,0x6b,0x27,0x34,0xbb,0x61,0x70,0x7f,0x39,0xcf,0xcb,0x35,0xf2,
+0x35,0x3,0xd3,0x81,0x77,0x3e,0x6a,0xec,0x87,0x23,0x8b,0xd0,0x20,0xf2,0xb3,0x3f,
+0xeb,0x63,0x35,0x55,0x8b,0x59,0x62,0xfa,0x45,0x13,0x98,0x3,0x6a,0xa9,0x50,0x43,
+0xb5,0x70,0x5,0x11,0xeb,0x11,0xe7,0xf9,0xde,0x2b,0x1a,0x75,0xb4,0x6b,0xbf,0xde,
+0x96,0x5,0x8b,0xdc,0x2a,0x62,0x5e,0x71,0x85,0x71,0x7c,0x28,0x48,0x94,0x65,0x6d,
+0xe,0x31,0xd0,0x65,0x6,0x93,0x29,0xb6,0x8e,0x47,0xf7,0x3,0xf3,0x82,0x50,0x4e,
+0x95,0x8,0x63,0x8d,0xd,0x79,0x83,0xd6,0xa1,0x94,0x6,0xf6,0xfe,0x40,0xef,0x8c,
+0xab,0xca,0xc8,0x6a,0x4b,0x15,0x60,0xe6,0xda,0x72,0x20,0x75,0xf,0x4d,0xf9,0xb3,
+0x33,0x30,0x5c,0x59,0x51,0xa4,0xe,0xc3,0xa9,0xee,0x7a,0xda,0x8c,0xb8,0x34,0x46,
+0xcd,0xa0,0xc6,0x87,0x95,0xe1,0x12,0xa4,0x86,0xe6,0xe1,0x7d,0x6b,0x63,0x98,0xd4,
+0x76,0xbb,0xd6,0x8f,0xe6,0xc4,0x44,0xab,0xee,0x6,0x3c,0x68,0xc9,0x2,0xbf,0x37,
+0x53,0xd8,0xd6,0xa3,0xb7,0xab,0xc7,0xb1,0xbf,0xd9,0x3b,0x36,0x33,0xbe,0xfd,0x80,
+0x6e,0x2c,0x44,0x5d,0xf0,0x2a,0x4c,0x3c,0x16,0x9d,0x58,0xeb,0x94,0xb9,0x3a,0x55,
+0xae,0x9c,0x9e,0xc3,0xe,0x4d,0x73,0xc8,0x6b,0xd2,0x23,0x8e,0xf3,0xa2,0xf7,0x8f,
+0xb3,0xb,0x69,0x62,0x2f,0xd2,0x8,0x41,0xf6,0xd2,0x33,0x26,0xe9,0x14,0xd5,0x5c,
+0x1e,0xb0,0x42,0x86,0xaf,0xa4,0x9c,0xdc,0x2c,0x8f,0x30,0x53,0xf6,0x84,0xcd,0x28,
+0xaa,0x3,0xcf,0x73,0xac,0xcf,0x17,0xdd,0xd3,0x98,0xd6,0xaf,0x87,0xe7,0xb8,0xf,
+0xec,0x95,0xd1,0x6b,0x8,0x93,0x51,0xdc,0xc2,0x73,0x3a,0xdf,0xdf,0x7f,0xff,0x40,
+0x2e,0x9,0xe5,0x25,0xd7,0x54,0xb,0xe9,0xe,0x53,0x55,0xb6,0x89,0x5,0x75,0xc8,
+0x1f,0x3b,0x51,0xec,0x31,0xe1,0x8d,0x71,0x61,0x85,0x4e,0x35,0xb2,0xfc,0xb6,0xcd,
+0xab,0xd7,0xfd,0xf8,0x18,0x9f,0x9f,0x9f,0xe1,0x76,0xd4,0xe8,0x54,0x20,0x99,0x67,
+0x49,0x60,0xdb,0xc9,0x94,0x91,0xe8,0x94,0x43,0xae,0x45,0x99,0x32,0xc6,0x6a,0xc5,
+0xc3,0x58,0x87,0x95,0xc5,0x83,0x58,0xf6,0xae,0x98,0x65,0x60,0xa1,0xc1,0xa2,0xd8,
+0x99,0xa5,0x5d,0xf2,0x31,0xb8,0x9b,0xdc,0x13,0x31,0xd6,0x5c,0xe0,0xa6,0xa7,0x4e,
+0xed,0xc5,0xeb,0xc1,0x5,0x6e,0x81,0x72,0x2f,0xc3,0xb4,0x6d,0x6c,0x5f,0xad,0x4e,
+0xf2,0xf7,0xe5,0x8,0x6b,0xee,0xe2,0x20,0xd6,0x66,0x2a,0x2e,0x43,0xa9,0x1a,0x90,
+0xff,0xc9,0xb,0x92,0xfb,0xf,0x14,0x60,0x96,0xa2,0xaf,0x31,0xad,0x97,0x12,0xde,
+0x38,0x3a,0x7a,0xe1,0xd9,0x5e,0xe0,0x68,0x81,0x23,0x5f,0xdc,0xcb,0x49,0x20,0xca,
+0x5a,0x52,0xb6,0xeb,0x78,0xf3,0xd8,0x36,0x55,0x95,0xd,0x7c,0x60,0xec,0x11,0x71,
+0x54,0x85,0xdf,0xef,0x94,0x31,0x69,0x16,0x27,0xb,0x7c,0xc4,0x7c,0xff,0x72,0x74,
+0xd2,0x11,0x2a,0x18,0x42,0xef,0x41,0x16,0x31,0x1c,0xbb,0x59,0x9e,0xf3,0x79,0x13,
+0x7b,0x75,0x8d,0x23,0x63,0xe9,0xa4,0xaf,0xc0,0x6d,0xe5,0xb6,0xd9,0xf,0xa9,0x12,
+0x61,0x61,0xa5,0x77,0x8d,0x29,0x66,0xbe,0xe9,0x4a,0xf6,0x1f,0x38,0x3e,0xc,0xde,
+0x7c,0xb8,0x90,0x85,0x5a,0xac,0x5f,0x5c,0x1d,0xc0,0xf8,0x9c,0xd4,0xe3,0x8d,0x3c,
+0x9e,0xa0,0xe4,0x1d,0xc2,0x8b,0xb6,0x2f,0x75,0x2c,0x64,0x8e,0xa5,0xdc,0xd7,0x2c,
+0xce,0xc5,0x89,0x3,0xb1,0x59,0xfa,0x93,0xb9,0xc7,0x51,0xea,0x44,0x78,0xd9,0x64,
+0x53,0x60,0x96,0xc7,0x72,0x33,0x6a,0xd6,0x82,0x12,0x41,0x85,0x67,0xbf,0x7a,0xc6,
+0x67,0x7f,0x79,0x5f,0xcf,0x32,0xa9,0xa5,0x3f,0x23,0xc8,0xde,0xd9,0xf7,0xdb,0x5,
+0x0,0x47,0x7e,0xa4,0x13,0x5b,0x93,0xba,0x13,0xa3,0x23,0x1d,0x93,0x49,0x8e,0x75,
+0xaa,0xda,0x8f,0xf0,0x56,0xe2,0x88,0xa9,0x86,0x74,0xc2,0x51,0xa4,0x7c,0xc7,0x2f,
+0x3c,0xf6,0x8f,0xe9,0x42,0x1e,0x2f,0xde,0xd6,0xf3,0x33,0xb4,0x25,0xf7,0x79,0x95,
+0xea,0xb3,0xf8,0xc6,0x8,0x4a,0x35,0x8c,0xcf,0x29,0xf7,0xa9,0xc4,0xd,0x59,0xe5,
+0x1b,0xb9,0xbd,0x6,0x65,0x3d,0x2,0x71,0x14,0x26,0x59,0x2e,0xbf,0x16,0x33,0x7c,
+0x48,0xf9,0xfa,0xb9,0x70,0xe5,0xe6,0x31,0x3d,0x3c,0xdd,0x41,0x92,0xb7,0xf9,0xcd,
+0x73,0x34,0xd5,0xc7,0xf8,0x87,0x2c,0x2b,0x6a,0xd0,0xd,0xa2,0x47,0x66,0x32,0x4b,
+0xf4,0x83,0x55,0x5a,0x47,0x6e,0x20,0xc8,0x95,0xfd,0x98,0xbd,0x66,0x71,0x29,0x45,
+0xf3,0x3a,0xc8,0xeb,0x8e,0xd3,0x25,0x8e,0xe9,0xea,0xbd,0xf9,0xe7,0x28,0x96,0x61,
+0x14,0x31,0xae,0x39,0xce,0x2a,0x2b,0xc4,0xa1,0x31,0xc9,0x2d,0x6a,0xae,0xb3,0x6e,
+0x60,0xe9,0x32,0x62,0x59,0xb2,0xd7,0xd2,0xdc,0x5d,0xcb,0x92,0x58,0xb1,0xc7,0x7,
+0xbf,0xcf,0xe0,0x4c,0xba,0xc5,0x31,0xbd,0x86,0x23,0x49,0x24,0xdc,0x88,0x3a,0x7d,
+0xb8,0x7f,0x8e,0x87,0x37,0xbd,0x78,0x71,0xa7,0x96,0x5d,0x9c,0x14,0x2f,0x99,0x5e,
+0xe4,0x49,0x3e,0xe4,0x71,0x34,0x3c,0x28,0x4d,0x6,0x66,0x58,0xa4,0x91,0x70,0xba,
+0xc0,0x31,0xdf,0xe0,0xf8,0xbc,0x49,0x6,0x27,0xed,0x85,0x7c,0x22,0xf6,0x4e,0xe0,
+0x71,0xf1,0x79,0x90,0xee,0x63,0x2e,0xbe,0x73,0x83,0xe,0xe7,0x8c,0xce,0x5,0x67,
+0x3a,0x80,0x39,0x85,0x5a,0x14,0xe2,0x28,0x77,0xf,0xd6,0x6d,0x3e,0x94,0x73,0x3b,
+0xd9,0xe9,0x1e,0x8e,0xf4,0x63,0x4f,0x77,0xaf,0x74,0xe0,0x78,0x31,0xc0,0xcc,0xbd,
+0x5f,0x20,0x1b,0x25,0xe2,0x3b,0x5,0xee,0xa4,0xaa,0x11,0xef,0x2a,0x96,0x48,0x10,
+0xe8,0xe0,0xad,0x84,0xea,0x43,0x73,0x29,0x9c,0xb1,0xb6,0x13,0xf9,0x85,0xe3,0x5c,
+0x74,0xa3,0x1c,0xa4,0xc7,0xf3,0xeb,0x7e,0x20,0xed,0x74,0xf3,0xde,0x48,0x62,0xf7,
+0x22,0x11,0xfb,0x3,0x8c,0x4f,0x69,0xe3,0x94,0x23,0x5e,0x9f,0xd6,0xb,0xf0,0x87,
+0xd2,0xb5,0xc8,0x17,0x2b,0x57,0xee,0xeb,0x59,0xf4,0x22,0x3c,0x53,0xf2,0xea,0x17,
+0xbf,0x86,0x82,0xce,0xb8,0xb9,0x7e,0xb2,0x4d,0x34,0xaf,0xe1,0xb8,0xcf,0x1a,0x7e,
+0x58,0x1d,0xab,0x8f,0xbd,0x71,0xd5,0xc8,0x54,0x47,0xcd,0xc6,0xd9,0x2f,0x8d,0xff,
+0x74,0x38,0x59,0x69,0xe,0xe4,0x96,0x7e,0xc8,0x5e,0xb3,0xd2,0x8f,0xb0,0xc0,0x14,
+0xef,0x1,0x1f,0x11,0xbd,0xbc,0x7e,0xdd,0x4,0xea,0xd,0x8e,0x97,0x12,0xfb,0x48,
+0x76,0xf7,0xd4,0xef,0x28,0x9a,0x93,0x75,0x5e,0x3d,0x4a,0xd7,0x89,0xd8,0x55,0xa4,
+0xa9,0xe1,0xcf,0xcc,0xc7,0xa5,0x7f,0x4f,0xfc,0xc3,0x90,0xd5,0xf4,0xb4,0xe0,0xf8,
+0x58,0xc5,0x5b,0x79,0x8c,0xfd,0x6b,0x38,0x92,0x44,0xe2,0x37,0x61,0x92,0x9c,0x2c,
+0xc7,0xc7,0xe6,0xe2,0xe1,0x72,0x7a,0x4e,0x6a,0x1d,0x33,0xa7,0x21,0x61,0x68,0x7a,
+0xc7,0x5d,0x70,0xfe,0x63,0x55,0x6b,0x76,0xbb,0x1a,0x2d,0xdb,0x0,0x36,0x74,0x5c,
+0xad,0x9a,0xee,0xe0,0x78,0xe7,0xac,0xa5,0x8b,0x93,0xff,0x48,0x6a,0xcd,0x4b,0x33,
+0x23,0x59,0xa0,0x23,0x32,0x44,0x2b,0xa4,0xa,0x6e,0x30,0xc6,0x2c,0xf9,0x25,0x3e,
+0x86,0x7a,0x44,0x7f,0x23,0xb9,0x7,0xd3,0x9,0x95,0xc7,0x26,0xdd,0xe2,0xe8,0x27,
+0xfb,0xf8,0x1a,0x8e,0xa,0xde,0xcf,0x30,0x32,0x59,0xed,0x47,0x71,0xa4,0xa3,0xc8,
+0x41,0xd,0xc1,0x66,0x64,0xc3,0x77,0x93,0x39,0xb4,0x1f,0x63,0x57,0x7d,0x0,0x48,
+0xce,0xfe,0xaa,0x4,0xef,0xbb,0x86,0x8d,0x89,0xd6,0x5a,0xc6,0x31,0xad,0x5f,0x77,
+0x7a,0x34,0x37,0x38,0x6e,0xd2,0xea,0xe4,0xd3,0x23,0xec,0xf9,0xdd,0x6f,0x76,0x3b,
+0x91,0x4d,0xf1,0x8c,0x86,0xf2,0xef,0x72,0x90,0x19,0x65,0xf9,0x78,0x71,0x12,0x53,
+0x6f,0x97,0x73,0xbd,0x7f,0x6c,0xf2,0xf3,0x1d,0x83,0xfd,0x3a,0x8e,0xdb,0x4,0x4d,
+0x82,0xd9,0xe0,0xea,0xa3,0xbc,0x21,0xf8,0x11,0xf8,0xcd,0xe3,0xb1,0x3e,0xb9,0xbf,
+0x49,0x3a,0x32,0xd3,0x87,0x78,0x9a,0x64,0x13,0x45,0xe0,0x28,0x4f,0x13,0x56,0x3d,
+0x48,0x97,0xef,0xe0,0xd8,0x7e,0x17,0xc7,0xfe,0x52,0x8a,0x20,0x99,0x18,0x2a,0x44,
+0xa0,0x22,0xe7,0x7c,0xa8,0x8b,0x93,0x24,0x38,0xb2,0xd6,0x5c,0xbc,0xc4,0x38,0x9d,
+0x71,0xcc,0xcd,0x74,0xe7,0x60,0xa7,0xd7,0x71,0xb4,0x99,0x1b,0x98,0xb1,0x82,0xc0,
+0x7e,0x9c,0xef,0x2,0xb3,0x59,0x88,0x77,0xbd,0x2a,0x9d,0x2a,0x51,0x1a,0x5c,0xf3,
+0x87,0x7c,0x1e,0x4e,0xd9,0x4f,0x68,0x7f,0x1d,0xe8,0x54,0xc3,0x2c,0x9a,0xcc,0x22,
+0x12,0xed,0xf4,0xb6,0x3c,0x6,0x72,0xd5,0xd7,0xda,0xbe,0x4b,0x77,0xce,0x62,0x2e,
+0x3d,0x7b,0x32,0x53,0x80,0xbe,0xc7,0x41,0x2,0x66,0xb7,0xbb,0x32,0x5a,0xdb,0xc5,
+0xcf,0xde,0x27,0xa5,0x6e,0x71,0xdc,0x50,0x64,0xb8,0xdf,0xdf,0xc7,0xb1,0xcb,0x8e,
+0xc7,0x1a,0xe2,0xf,0x16,0x6a,0x3,0xeb,0x43,0xc7,0x23,0x8f,0x4c,0x96,0x8c,0xd2,
+0x6c,0x9d,0x3f,0xb4,0x15,0xb9,0xb3,0xc6,0x1a,0xde,0x39,0x8f,0x70,0xd0,0x63,0x39,
+0xbd,0x2f,0xef,0xec,0x12,0xc7,0x9b,0xb7,0x16,0xe2,0xe3,0x25,0x8e,0xf9,0x8e,0x25,
+0x7a,0x94,0x26,0xd2,0xc3,0x1,0x19,0x1a,0xd2,0x9c,0xd2,0x30,0x7f,0x15,0xac,0xf0,
+0xb1,0x3d,0xe3,0xb8,0xb7,0xb7,0xb7,0x84,0xc,0xf6,0xeb,0x38,0x4e,0x39,0x70,0x37,
+0xaf,0xb3,0xed,0x87,0xeb,0x44,0x68,0x69,0x9b,0xd8,0xbb,0xe0,0xed,0x1c,0x15,0x13,
+0xea,0xf1,0x56,0xe5,0xa9,0x7b,0x7f,0xf9,0x1f,0x85,0x4,0xd3,0x29,0x87,0x6c,0x9b,
+0xe6,0xc3,0xa3,0x6c,0xa,0x5e,0x70,0xec,0x9f,0xf6,0x67,0x94,0xee,0xd8,0xd0,0xab,
+0x47,0xb4,0x39,0x7e,0xc7,0x36,0x3c,0xde,0xf1,0x9e,0x6e,0x71,0x24,0x5c,0xd4,0x1d,
+0x43,0x13,0xa7,0x2a,0xbf,0x82,0xe3,0x63,0x7e,0x66,0xcf,0xb5,0xce,0xe7,0x9e,0xad,
+0x8f,0x40,0x69,0xc5,0xd1,0xf1,0x25,0x9b,0x22,0x8d,0x14,0xae,0xef,0x3e,0x74,0xaa,
+0xd,0xdd,0xfd,0x1,0x79,0x2a,0xc7,0xda,0x91,0xc4,0x31,0xf7,0xf9,0x7d,0x38,0x66,
+0x75,0x81,0xe3,0x8d,0x56,0xf3,0x59,0x5d,0xe1,0x38,0xbd,0x8e,0xe3,0x2a,0xf,0x31,
+0xdd,0xc3,0xfb,0x4d,0x1c,0xbd,0x3e,0x32,0x12,0xed,0xc7,0x71,0x2c,0xe9,0xa,0x12,
+0x68,0x37,0x49,0xfa,0x89,0x7b,0x57,0x86,0xa0,0xba,0x77,0x9d,0x6b,0x44,0xb9,0x9d,
+0x31,0x8a,0x24,0x32,0xb0,0xce,0x82,0xe,0x52,0x76,0x9b,0xbc,0x55,0xbd,0x8,0x13,
+0xa3,0xf4,0x40,0xd7,0xb7,0x7d,0x36,0x71,0x43,0x6a,0x73,0x73,0x9,0x53,0x7b,0x81,
+0xf4,0x3d,0x1c,0xa7,0xf5,0xfb,0xcd,0x8f,0xfd,0xab,0x38,0xa6,0xed,0x39,0x2f,0x72,
+0xff,0x71,0x88,0xb0,0xef,0xe3,0x98,0x1f,0xfd,0xe,0x65,0x80,0xa3,0x6e,0x51,0xab,
+0xe5,0x8a,0xd1,0x87,0x5a,0x30,0xd0,0x79,0x4a,0x7a,0x21,0x71,0x2b,0x6b,0xcf,0x38,
+0x8e,0xa1,0x7b,0x17,0x8e,0x48,0xb8,0xaa,0xce,0xe2,0x60,0xf3,0xc8,0x3c,0x22,0x99,
+0x4d,0xdf,0x41,0xc5,0x67,0x3e,0x56,0x9e,0xe5,0x91,0x51,0xfc,0xc6,0x38,0xee,0x76,
+0x9b,0xe5,0xda,0xd1,0x7f,0x9b,0x40,0x5a,0x60,0x8d,0x63,0x9f,0xfd,0xee,0x99,0xbf,
+0xfd,0x2a,0x8e,0xf6,0xd,0x1c,0xcd,0x9,0xc7,0x7,0xc2,0x31,0xde,0x7d,0xc4,0xdd,
+0x8,0x1b,0xda,0x3b,0x6e,0x46,0x6,0x32,0x4b,0x3,0x4a,0xb5,0xb5,0x1f,0xb1,0x33,
+0x56,0x69,0xae,0x67,0x47,0xe,0x72,0xd0,0x4b,0x85,0x2c,0x39,0xef,0x1b,0x7b,0x57,
+0xa7,0x60,0xc7,0xf5,0x6a,0xf6,0x9f,0x40,0x9f,0xf5,0xec,0xb1,0x51,0x82,0x1c,0x96,
+0x67,0xce,0x55,0x4c,0x3d,0xb8,0x1a,0xe5,0xa2,0x53,0x1b,0x37,0x8c,0xe3,0x6e,0x7,
+0xde,0x3c,0xb1,0xb9,0x71,0x95,0x33,0xdf,0xef,0x53,0x7c,0x76,0xe5,0xa,0x41,0xb2,
+0x1d,0xa9,0xbd,0x96,0xc7,0xf8,0x1a,0x8e,0xab,0xfc,0x12,0xe1,0xb8,0xbd,0x63,0xb0,
+0x23,0xe1,0xf8,0x82,0xfb,0xfa,0x70,0x8b,0x63,0x7a,0x96,0x7e,0xbc,0xd0,0x99,0x16,
+0xe1,0xde,0x47,0xf6,0x94,0x9b,0x53,0xe2,0xd6,0x73,0x12,0x5a,0xf6,0x94,0xd,0xbe,
+0x7b,0x1f,0x2f,0xe,0x7a,0x54,0x1,0x63,0x97,0xc5,0x3c,0x79,0x84,0x32,0x6d,0x9b,
+0x36,0x69,0xca,0x1c,0xdf,0x4e,0x5b,0xec,0xc2,0x3c,0xe1,0x98,0x9e,0x5,0x46,0xcd,
+0xf3,0x97,0x13,0x3d,0xe8,0x59,0x87,0xfd,0xcb,0xc3,0x39,0x3b,0xad,0xdd,0xe9,0xd2,
+0x7a,0x77,0x7,0xc7,0x1b,0x1f,0xf3,0x3e,0x8e,0xf4,0xb8,0xed,0xe5,0xe3,0xf8,0x99,
+0x19,0x47,0x7e,0x35,0xd7,0x48,0x2,0x47,0x27,0x15,0x89,0x2c,0x16,0xf8,0xfd,0xe7,
+0x9a,0xb,0x9,0x36,0x72,0x13,0x8a,0x2b,0x38,0xf2,0x54,0xa2,0x37,0xef,0xc2,0x91,
+0xd5,0x23,0xea,0x7c,0x59,0xf2,0x5,0x3b,0x3a,0x71,0x13,0xe1,0x48,0x7e,0x63,0x5f,
+0x2,0x43,0xb5,0xc2,0x31,0x11,0x8e,0x24,0x8f,0x24,0x8c,0x2e,0xa3,0xfd,0x4d,0x3d,
+0x3e,0x4e,0x39,0xfb,0xf9,0x80,0xbd,0x70,0xf,0x92,0xbf,0x6a,0xa5,0x27,0xc0,0xa2,
+0x33,0xdc,0x71,0x9c,0x92,0x2e,0xed,0xcc,0xfd,0x88,0xef,0x16,0x47,0xd2,0xb5,0xe9,
+0x12,0x44,0xc6,0x71,0x7a,0xcc,0xcb,0xeb,0xb9,0x0,0xf2,0x81,0x2,0x82,0x4d,0x90,
+0x8c,0x47,0x6c,0x39,0xa5,0xfd,0x1,0x3b,0x83,0x80,0xe,0xb5,0x43,0xe4,0xe0,0x79,
+0xf6,0xd,0xf2,0x88,0x38,0xd1,0x74,0xef,0xeb,0x1,0x68,0x0,0x24,0x98,0xb2,0x10,
+0x67,0x70,0x82,0x62,0xbb,0x6d,0xd3,0x2e,0x61,0xab,0xa8,0x67,0x1c,0xd3,0x19,0xc7,
+0x3d,0xe3,0x48,0x30,0x46,0x14,0xfd,0xd,0x26,0xd4,0x7b,0xcc,0x44,0x62,0x2b,0x33,
+0xbf,0xaf,0xfd,0xde,0x81,0x1f,0xa5,0x6d,0xd,0x7d,0x23,0x27,0xaf,0xef,0xe0,0xf8,
+0x4a,0xc4,0xb7,0xf8,0x9a,0x79,0x85,0x63,0x31,0xd8,0x9b,0xf3,0xb5,0xf3,0xf9,0x31,
+0x3f,0xdc,0x3,0x92,0x71,0x7c,0x96,0xee,0xd9,0xc0,0xc9,0xb0,0xe6,0x3,0xe7,0x9a,
+0x47,0x51,0xb8,0xb0,0x75,0xd4,0xdc,0x2b,0x94,0xa5,0x91,0x1c,0x38,0xbe,0x3,0x45,
+0x74,0x4e,0xa0,0x8b,0xcb,0x49,0xfe,0x8f,0xf4,0x59,0x20,0x25,0x4d,0x76,0x80,0x2,
+0x6c,0x65,0x4b,0xa2,0x62,0x85,0xa3,0xca,0xcf,0xa4,0x1a,0x29,0x8,0x6d,0x7a,0x2,
+0xca,0x6e,0xad,0x7d,0xb4,0x8f,0x8f,0x10,0x3c,0xcc,0xc0,0xe1,0x11,0x4e,0x49,0xa7,
+0x18,0xdd,0x1b,0xe0,0x18,0x6e,0x63,0x62,0xd8,0xf4,0xd7,0x70,0xa4,0xc3,0xb0,0xc2,
+0xd1,0x4c,0x7e,0x73,0x81,0x22,0xac,0x17,0xe2,0xd0,0x6f,0x27,0x20,0x1f,0xd6,0x38,
+0x4e,0x1b,0xf,0x1c,0x31,0x96,0xda,0x31,0x84,0xdb,0xf,0x79,0xe2,0x2a,0x71,0xa,
+0x5a,0x73,0x44,0xbd,0xe8,0xc7,0x77,0xfa,0x3d,0x15,0x1f,0x6c,0x2d,0x11,0x2f,0x7c,
+0xc7,0xd8,0x37,0x4d,0xa2,0x77,0x9f,0xa6,0xa9,0x4,0xd8,0x2b,0x1c,0x9f,0xe8,0xac,
+0x3b,0x57,0x47,0xc,0xf1,0x4c,0x79,0x4a,0xe0,0xe0,0x44,0x46,0x23,0x91,0x44,0xb2,
+0x40,0x12,0x8e,0x19,0xf2,0x68,0x30,0x5,0xfc,0x2a,0x8e,0xcd,0xab,0x38,0x6e,0x56,
+0x8f,0x5,0x8e,0xcf,0xbb,0xcd,0xf5,0x75,0x81,0xe3,0xb7,0x6b,0x1c,0x3,0x9f,0x6b,
+0x6e,0xd6,0xfb,0x8,0xcd,0x98,0xec,0xdb,0x89,0x5c,0x80,0x75,0x1c,0xd,0x65,0xc7,
+0x33,0x89,0xbe,0x6a,0xdf,0xde,0x96,0x6e,0xa4,0xeb,0xb3,0x21,0xc9,0x99,0x5c,0xc9,
+0xba,0xe0,0x8d,0x4c,0x8a,0xfd,0xc6,0x73,0x40,0xbb,0xc2,0xf1,0x81,0x7c,0x68,0xef,
+0x74,0x0,0xb3,0x3a,0xc0,0xab,0x49,0x4f,0x62,0xc4,0xd,0x9d,0x60,0x4,0x24,0xc9,
+0xe3,0xcb,0x53,0x74,0x51,0x71,0xc1,0xd5,0x2e,0x38,0x22,0x17,0xbe,0x8e,0xe5,0xe0,
+0xab,0xbf,0xee,0xf8,0xd8,0xc7,0x7d,0x79,0x30,0x69,0x11,0xfb,0x5c,0xbc,0x83,0xdd,
+0xee,0xf4,0x41,0xea,0xa6,0xa7,0x97,0x7b,0x40,0x2,0xc7,0xe7,0x67,0xce,0xd2,0x1d,
+0xc3,0xd6,0xa8,0xb6,0xfa,0xd0,0xb9,0x6,0x8e,0x92,0xb9,0x65,0x58,0x39,0x43,0x7e,
+0xac,0x41,0x98,0xfa,0xc6,0xfd,0x90,0xd8,0x7,0xf5,0x41,0xc2,0x31,0x30,0x8c,0x47,
+0x96,0x9d,0x8,0x1f,0x7c,0xad,0xdd,0xe3,0xa,0xc7,0x6f,0x84,0x23,0x99,0xc4,0xbe,
+0xa2,0x43,0xdf,0x13,0x76,0x35,0xc9,0xe6,0x76,0xdb,0x6f,0x59,0xf4,0x30,0xdd,0x4a,
+0x38,0xa6,0xe4,0x14,0x57,0xed,0x80,0x63,0x20,0xfd,0xb8,0x79,0x8e,0x29,0x31,0x65,
+0x78,0xa9,0xdc,0xef,0xf7,0xe8,0x27,0x38,0xb9,0x98,0x9b,0xc0,0x7e,0xe8,0xa6,0xdc,
+0xb6,0x94,0xf6,0x3c,0x8d,0x48,0x5e,0xff,0x53,0x5f,0xc5,0x4d,0xf1,0xb2,0x1c,0x1,
+0x49,0x20,0xba,0x1d,0xdd,0xa6,0x4b,0x1c,0x1f,0xd6,0xf2,0xf8,0x4c,0x2f,0x6f,0x9e,
+0xc9,0x79,0xc9,0x96,0x7c,0x9f,0xf7,0xdb,0x6b,0xde,0x48,0x6d,0x39,0xa0,0xa1,0xc0,
+0x90,0x9b,0x2d,0x2,0xb7,0x3e,0x92,0xd9,0xb4,0x6f,0x57,0x7,0xd1,0x9f,0x87,0x3d,
+0x12,0xdb,0x20,0x59,0x55,0xae,0xc9,0x4,0xa,0x9,0xfb,0xb0,0x36,0x92,0x57,0x38,
+0x3e,0x86,0x3a,0xa1,0x30,0xdd,0x81,0xfd,0x0,0x38,0xf2,0x64,0x3d,0x84,0xd3,0xd1,
+0xc9,0x7e,0x78,0x79,0x22,0x5d,0xc9,0x2d,0xa6,0xb6,0x11,0x79,0xdc,0x6c,0xe0,0x1,
+0xf1,0xb4,0xa6,0x6c,0xb6,0x3f,0xc0,0xb1,0xd4,0x35,0xfe,0x3,0xcb,0x2,0x76,0x78,
+0x69,0xe6,0x83,0xdc,0x70,0xd6,0x23,0x6,0xa4,0x31,0x64,0x5a,0xfb,0xf1,0x31,0xb2,
+0x55,0x93,0x47,0xd0,0x93,0xe1,0x1f,0x7f,0x29,0x8f,0x67,0x81,0x24,0x1c,0xf1,0xca,
+0x91,0xab,0x40,0x9d,0x86,0xde,0xdf,0x47,0x98,0x89,0x90,0x8c,0x70,0x43,0x61,0xef,
+0x42,0x5d,0xd3,0xcb,0x24,0x7d,0xfe,0xe,0x71,0x82,0xec,0x7e,0x69,0xdb,0x2d,0xfb,
+0xdf,0x74,0x16,0x9c,0x78,0x39,0x56,0xc5,0x4b,0x1c,0xfb,0x5,0x47,0x3a,0xb6,0xf,
+0x39,0x7,0x4d,0xde,0x44,0xdf,0xd9,0x5,0x47,0xae,0x9d,0xe3,0xb3,0x8,0x81,0x64,
+0x1c,0x8d,0xc,0xe2,0x31,0x8e,0x6e,0xa7,0x7d,0x26,0xdf,0x28,0x1e,0x1c,0x8b,0xe4,
+0x8b,0xdb,0xa7,0x14,0xb,0x91,0xc4,0xb3,0x26,0x47,0x74,0x97,0x26,0x79,0x24,0x4c,
+0xa,0x29,0x8d,0x8c,0x4f,0xf,0xe4,0x4a,0xbd,0xa0,0xce,0xb,0x87,0xdf,0xa5,0x1e,
+0xde,0x95,0xae,0xd3,0x44,0xcf,0x49,0xa6,0xe8,0x2,0xc7,0x13,0x90,0x84,0x23,0x2c,
+0xbe,0x3e,0x72,0x7f,0xe4,0xd4,0xd8,0xf,0xec,0x12,0xe1,0x22,0x4d,0x96,0x9,0x86,
+0x2c,0xa3,0x36,0xf1,0x28,0x51,0xe2,0x9b,0x8b,0x64,0x48,0x86,0xd0,0x5e,0x68,0x8c,
+0xc5,0x0,0x1e,0xfa,0xca,0x9c,0xe4,0x12,0x9,0x91,0xcd,0x85,0xcf,0xe6,0xfb,0xc7,
+0xb3,0x3c,0x7e,0xcb,0xe0,0xa4,0x44,0xbf,0xc1,0x9,0x47,0xe9,0xc9,0xc5,0x21,0x26,
+0x81,0x7c,0xfa,0xc6,0xf2,0xc8,0x9d,0xcf,0x7d,0x4f,0xe8,0x51,0xd0,0x93,0xc9,0x27,
+0xe8,0x8b,0x97,0xf9,0xb4,0x7f,0x71,0x55,0xbf,0x55,0xbc,0xdb,0x9e,0xbe,0xe6,0x42,
+0x1d,0xd1,0xfe,0x49,0x1f,0x26,0x16,0x53,0x4d,0x76,0xb,0x16,0x2a,0x47,0xf8,0xa4,
+0x90,0x47,0xb2,0x6a,0xd,0x9d,0x91,0x69,0x52,0x36,0x92,0xd8,0x47,0x2,0xfa,0xa,
+0xc7,0x5,0xc8,0xbd,0xc4,0xe3,0x1b,0xce,0xbf,0x1f,0x3,0x26,0xa5,0xdf,0xdf,0xf,
+0x80,0x62,0x4,0xb9,0xe1,0xd0,0x70,0xdc,0xe0,0x51,0x19,0xd4,0xb4,0x8f,0xbc,0xb1,
+0xec,0xad,0x35,0xa0,0xd2,0xb7,0xde,0xa1,0x17,0x9d,0xbb,0xc6,0x74,0x69,0xfb,0x50,
+0xab,0xd8,0x57,0x54,0xd8,0x5,0x8e,0x74,0x7c,0xdb,0xca,0xc0,0x73,0xec,0x59,0x86,
+0x80,0x63,0xdf,0x8,0x8e,0x5e,0x93,0x56,0x63,0xfd,0xc8,0x4d,0xd1,0x4,0xde,0x14,
+0xeb,0xc0,0x8d,0xcf,0xa6,0x67,0x19,0x3,0x8e,0xa1,0x42,0x9f,0x24,0xfd,0x8,0x79,
+0xf0,0x13,0x94,0x44,0x83,0xec,0xd2,0x4,0x93,0xef,0xe8,0xd1,0x5b,0x8c,0x7e,0xb5,
+0x22,0xde,0x8c,0x63,0xed,0xb9,0xe9,0x97,0x27,0xc2,0x7a,0xa8,0x8f,0x90,0x9b,0xfd,
+0x6b,0x38,0xb2,0x87,0xa1,0xb9,0x6f,0x8b,0x4,0xc9,0x36,0xef,0xa7,0x27,0xc2,0x3,
+0x3,0x9b,0x19,0x27,0xd,0xf7,0x58,0x60,0xcd,0x25,0xcf,0xbb,0x3b,0x31,0x9b,0x53,
+0x3f,0x3d,0xb4,0x47,0x67,0x73,0x21,0xe,0x62,0xdd,0x18,0xd1,0x89,0x1b,0xaf,0x23,
+0x88,0xe9,0x31,0x9d,0x5e,0xf0,0xb7,0xe4,0x3d,0xd6,0x8e,0x92,0x25,0x3c,0xe3,0x88,
+0xd1,0x86,0x6d,0x5f,0x7c,0x9f,0x7,0x7a,0xa7,0x3c,0xcb,0x40,0x31,0x7a,0xaf,0xa2,
+0xc3,0x7e,0x85,0xce,0x92,0x7d,0x67,0xd,0x4a,0x26,0xc4,0x81,0xf1,0xc,0x3f,0x42,
+0xa8,0xb4,0x3a,0x21,0x61,0x7,0x7e,0x43,0x84,0x98,0x4,0x19,0x2c,0x58,0x47,0x4e,
+0x29,0x6c,0xd4,0x61,0x9f,0x6d,0x74,0x5a,0x75,0xaa,0x7,0x1d,0x67,0x45,0xaf,0xe,
+0x5f,0x76,0xc9,0xee,0xf7,0x97,0x38,0x3e,0x14,0x1c,0xc5,0x53,0x43,0x53,0x3b,0x3a,
+0x25,0xa7,0xad,0x7a,0x77,0xc7,0x1d,0xe,0x6f,0x96,0x16,0xa5,0xb8,0xc,0x1c,0x7a,
+0x2e,0x20,0x63,0xbe,0xc6,0xde,0x9f,0x80,0x1,0x8e,0x90,0xc5,0xce,0x4e,0xa5,0x53,
+0xd9,0x15,0x69,0xec,0xd4,0x4d,0x24,0xb6,0x5b,0xe1,0xf8,0xed,0x5b,0x3c,0x24,0x30,
+0x82,0x1b,0xc1,0x91,0xcf,0x35,0x1d,0x3,0xc,0xb6,0xf2,0x3b,0x17,0x1c,0x55,0x27,
+0x5d,0xba,0x14,0x59,0xf6,0xdc,0x3e,0xde,0x5a,0x11,0x58,0x58,0xf,0x17,0x85,0x81,
+0x8f,0x7e,0x44,0xb5,0xb9,0xeb,0x4d,0x5b,0x80,0x24,0xe3,0xdc,0xc1,0x2f,0xb5,0x4d,
+0x67,0xd9,0x93,0x9a,0xf,0xe9,0x31,0x6a,0xa6,0xe3,0x9c,0xe8,0x36,0x19,0xbc,0x5e,
+0x50,0xfb,0xa4,0xe9,0xa,0xc7,0x6f,0xf,0x17,0xf2,0xe8,0xdd,0x91,0xbb,0x54,0xc2,
+0xd4,0xbe,0xbf,0x73,0x91,0x7,0x32,0x39,0x36,0x9f,0x96,0x4e,0xf1,0x28,0x14,0x56,
+0xc1,0x2e,0xbc,0xea,0xa7,0xbe,0x43,0x50,0x35,0x99,0x72,0xaa,0x21,0x91,0x93,0x96,
+0x7a,0x9d,0x48,0x23,0x76,0x61,0x4e,0xd7,0xd2,0x78,0x81,0xe3,0xc3,0x8b,0x77,0x13,
+0xbd,0x67,0xf2,0xcc,0xaa,0x5,0xc7,0x2d,0x4f,0xba,0x48,0xf4,0xe2,0xe,0x8c,0x23,
+0xf2,0x6e,0xf4,0x35,0x6c,0x8a,0x33,0xb2,0x77,0xcf,0xd2,0xc7,0x8c,0xcc,0xcb,0xcb,
+0x61,0x46,0xb,0x32,0xf2,0x2,0x98,0x7f,0x21,0xc,0x29,0xf2,0xc0,0x16,0xaf,0xbe,
+0x62,0x4a,0x62,0x84,0x48,0xbd,0xe1,0x13,0xc,0x1c,0x7d,0x8d,0xd1,0x63,0x50,0xc8,
+0xd4,0x61,0xcb,0x4f,0x42,0xc8,0x4e,0xe9,0x4d,0x1c,0x61,0xb2,0x47,0x54,0xd0,0x7c,
+0xbf,0x14,0x18,0xcc,0x5b,0xf9,0x85,0xb2,0x3,0xa7,0x67,0xe6,0x11,0x18,0xfa,0xd2,
+0x1d,0x9e,0x83,0x6c,0xb1,0x4e,0x67,0xfe,0x85,0xf2,0x7b,0x2c,0x37,0x41,0x73,0x5d,
+0xb2,0x47,0x17,0xb8,0xb4,0x34,0xb0,0xdf,0x88,0xa,0xbb,0xad,0x26,0x7f,0x8b,0x63,
+0x5e,0xe5,0x5,0xc8,0x6b,0xe1,0xee,0xe1,0xf6,0x1a,0xc7,0x2d,0xfc,0xf2,0x8,0xd7,
+0x67,0x4f,0xe7,0xba,0x53,0x98,0x3,0x21,0xff,0x7c,0x32,0x98,0x87,0xe1,0x41,0x61,
+0x7c,0x9f,0x71,0x3c,0x44,0xf4,0x9f,0x83,0xf7,0x88,0x14,0x25,0x6,0x62,0x78,0xa,
+0x11,0xcb,0x5f,0x27,0xe8,0x8,0x9e,0x92,0xb5,0xa2,0x6,0x52,0xf6,0xe,0x9a,0xb1,
+0x87,0xb5,0xd6,0x8e,0x15,0x24,0xe1,0x98,0x6f,0x70,0x7c,0xb8,0xc4,0x31,0xd4,0xd2,
+0xec,0x1c,0xc1,0xc9,0x71,0x1e,0x57,0xb8,0x47,0x21,0xab,0xa4,0xf3,0x96,0x93,0x66,
+0x2c,0x8f,0x69,0xe1,0x9b,0x30,0xe8,0xa7,0x65,0x81,0xec,0xcf,0xbe,0xa2,0x8,0x25,
+0xe1,0x28,0xdd,0x2f,0x18,0x9f,0x5,0x81,0x3,0x47,0x31,0xe2,0xb7,0xc1,0x7,0x3a,
+0xdb,0x98,0x55,0x62,0xe0,0x2,0xc7,0x10,0x2b,0xd6,0x7e,0xc2,0x9e,0x5,0xfd,0xc8,
+0x9b,0x31,0xcd,0xc9,0x85,0x7c,0x21,0x1c,0xb7,0x1d,0xce,0x6d,0x2b,0x19,0x8c,0xc0,
+0xd3,0xf,0x5b,0xb5,0xe0,0xfc,0x72,0x80,0xe0,0x2b,0x52,0xc,0x24,0x66,0x7d,0x7a,
+0x4e,0x80,0xb0,0x22,0xe0,0xc1,0x26,0x15,0xc2,0xd4,0x35,0xb6,0xd8,0xff,0x3,0x70,
+0xc,0x14,0x2f,0x41,0x87,0x50,0xec,0x44,0xe1,0xa8,0x82,0x16,0x8e,0x79,0xe5,0x89,
+0xad,0x4,0xf2,0x8c,0xe3,0xf3,0x6e,0xe4,0xda,0xae,0x8e,0x6c,0x7a,0xdf,0x1e,0x47,
+0xe1,0x26,0x72,0x8b,0x84,0x17,0xba,0x8d,0x1c,0xaf,0xe,0x66,0xc7,0xbc,0x85,0xa5,
+0x81,0xa0,0x25,0x89,0x76,0xa,0xbf,0x48,0xc3,0xf2,0x68,0x4a,0x1b,0x6,0xfd,0xa0,
+0xe6,0x96,0x43,0x96,0xc6,0x4d,0xa2,0xb3,0x68,0x5a,0x1f,0x6e,0x60,0xbc,0xc0,0xf1,
+0xe5,0x65,0xce,0x95,0xba,0x87,0xa3,0x61,0xa6,0x55,0xf8,0x88,0xc0,0x11,0x34,0x7e,
+0xc0,0x31,0x47,0xbc,0x7b,0xb4,0xc8,0xaa,0xbe,0x5f,0xe1,0xd8,0x43,0xa6,0xe1,0xec,
+0x4,0x72,0xc6,0xb7,0x12,0x4b,0xd8,0x9c,0x33,0x3a,0x97,0x3b,0xf2,0x88,0x7a,0x3e,
+0xd7,0x24,0xb9,0xd9,0x7b,0x92,0xf7,0xad,0x84,0x46,0x8e,0x4c,0x27,0xdc,0x2b,0x9f,
+0xf7,0xd7,0x38,0x7e,0xbb,0xc2,0xf1,0xd9,0x49,0x8d,0xdc,0xa5,0x86,0x5b,0x59,0xed,
+0xc2,0x44,0xd1,0xdc,0xda,0x97,0xc2,0x1d,0x13,0x18,0xb3,0x21,0x57,0x27,0x6d,0x58,
+0xb5,0x7e,0xe0,0xb9,0x8f,0xc2,0xc0,0x50,0x9a,0x89,0x81,0x28,0xab,0x71,0xb1,0x3e,
+0xc2,0x23,0xc2,0xfe,0xe,0x72,0x3c,0xf4,0x44,0xbd,0xdf,0xdc,0xc2,0x78,0x8d,0x23,
+0xda,0x36,0x98,0x51,0x67,0x2a,0x38,0x62,0x82,0x8d,0x35,0x24,0x2b,0x48,0xc2,0x71,
+0xef,0x1a,0x19,0x26,0x92,0x47,0x68,0xbf,0x15,0xd6,0xe6,0x33,0x8e,0x6d,0x8f,0xb1,
+0x8,0x16,0x60,0xfc,0x2,0xf4,0x17,0xd2,0xb3,0x4b,0x9c,0x19,0x64,0xb3,0x85,0x3d,
+0xe1,0x48,0x1f,0xb7,0x66,0x62,0x81,0xd4,0xc1,0x30,0x6f,0x59,0xba,0x3e,0xd7,0x7c,
+0xb2,0x1f,0xd6,0x38,0x22,0x7f,0x26,0x3b,0xa8,0xd,0x7a,0x6e,0x96,0x99,0xfa,0xdb,
+0xa9,0x2c,0xee,0xca,0xac,0x38,0x45,0x1,0xcf,0x25,0x8,0x8f,0x3a,0x13,0x78,0x2a,
+0xce,0x55,0x0,0xdd,0xa8,0xca,0xe8,0xf1,0xa,0xcb,0x8a,0x7f,0x71,0xe3,0xb9,0xa1,
+0x6e,0x71,0x1b,0x7b,0x65,0x4d,0x7e,0x7e,0xbe,0x3,0xe3,0x15,0x8e,0x9a,0x34,0xe,
+0x50,0xb9,0xc5,0xd1,0x0,0x8,0xd,0x1c,0x3,0x70,0xb4,0x27,0x1c,0x23,0xe9,0xc1,
+0x4b,0x1c,0xc1,0x96,0xd4,0xd9,0x13,0x8e,0xd2,0xfe,0xcc,0x26,0x44,0x70,0x84,0x9b,
+0xcf,0xe7,0x9a,0x70,0x4,0xf3,0xec,0xe2,0x9e,0x92,0x6c,0x6f,0x71,0xb3,0xf2,0xfe,
+0x6,0x47,0x2,0xf2,0x12,0x47,0x4e,0x44,0x62,0x39,0x47,0xe6,0xc3,0x7,0x14,0x91,
+0xcb,0x33,0x57,0x94,0x22,0x4b,0x2b,0xb8,0x64,0x7a,0x6a,0xf4,0xed,0x35,0xc2,0x6e,
+0x4,0xb5,0xdd,0xf9,0xa3,0x74,0xa9,0x97,0xa0,0x46,0x6,0x39,0x85,0xc3,0x58,0xe1,
+0x45,0x93,0xeb,0xce,0x2d,0xd1,0xa5,0x77,0x19,0x5e,0x4a,0xba,0xf,0x23,0x70,0x4c,
+0x67,0x1c,0x1d,0x3c,0xe2,0xb,0x1c,0x11,0x4a,0xf3,0xb6,0xcc,0x33,0x8e,0x98,0xd9,
+0xb4,0x25,0xff,0x48,0x38,0x92,0x80,0xf5,0xf4,0x13,0x82,0xe3,0xc3,0x9e,0xe4,0x91,
+0x67,0x86,0xa0,0xeb,0x1c,0x85,0x2b,0x5b,0xde,0x8b,0x5d,0xfc,0x7a,0x52,0xa7,0xa8,
+0x16,0x55,0xfd,0x82,0xa3,0xa7,0x18,0x94,0xf4,0x0,0x4,0x12,0xdc,0x87,0xcf,0xde,
+0x53,0x9c,0x49,0xfa,0xf1,0xe1,0x16,0xc8,0x4b,0x1c,0x9f,0x35,0x37,0x12,0x8d,0x21,
+0x57,0x65,0x40,0x89,0xb7,0xa7,0xac,0x8f,0x37,0x6f,0x73,0xc4,0x1,0xab,0x7c,0x2d,
+0xc3,0xd8,0xb1,0x59,0xfa,0xf8,0x2a,0x6c,0x35,0xc0,0x68,0x60,0x7d,0x44,0x67,0xd2,
+0x64,0xa5,0x65,0xfc,0xd4,0xec,0x83,0x83,0x2e,0x9c,0x2c,0x25,0xdf,0xf8,0x3c,0xf1,
+0x39,0x3d,0xf7,0x1a,0x5e,0xa5,0xfb,0xd6,0x7e,0xcf,0xcb,0x21,0xb4,0x98,0x9b,0xbc,
+0x87,0x23,0x2b,0xc0,0x13,0x8e,0xfd,0x49,0x86,0xb4,0x87,0x29,0x3e,0xe1,0xf8,0xd,
+0x38,0x76,0x98,0xc4,0xe4,0xe0,0x64,0xb7,0xab,0x61,0xdd,0xe9,0x2d,0x95,0xdf,0x17,
+0xd0,0xab,0xdb,0xb6,0xb,0x8e,0x11,0x8b,0xa5,0x91,0x7b,0x9f,0xc4,0x3d,0xd0,0xa0,
+0xe8,0xec,0xef,0xe1,0xf8,0xed,0x61,0x9f,0xd7,0x38,0xfa,0x67,0xe1,0xe1,0x1a,0xdc,
+0xa9,0x7b,0x55,0xa8,0x93,0x2e,0x70,0xc4,0x17,0x90,0x37,0x1c,0x78,0xe,0xd5,0x89,
+0x23,0xb4,0xb2,0xea,0xb1,0x66,0x3a,0x4e,0xf6,0xc6,0xa1,0x7d,0x84,0x44,0xa,0x3c,
+0x86,0x18,0xbc,0xf5,0x3c,0xc3,0x8a,0x22,0x54,0x88,0xe8,0x88,0xb2,0xaf,0x9c,0xe9,
+0x5b,0x1c,0x3d,0x7b,0x84,0xbc,0xe5,0x76,0x15,0x5f,0x83,0x49,0x44,0xc,0x32,0xe3,
+0x8,0x56,0x14,0x73,0xc6,0x51,0xa6,0xd6,0xed,0x19,0x47,0xde,0x97,0xcb,0x11,0x90,
+0xe3,0x1b,0x51,0x19,0x20,0x5f,0xe4,0x91,0x1e,0xd,0x96,0x69,0xc6,0x71,0x4f,0x1,
+0xba,0xcc,0xca,0x29,0x9,0x1c,0x1d,0xf2,0x90,0xa9,0xc9,0xb7,0xe7,0x9a,0xab,0x70,
+0x97,0x75,0x48,0xe4,0xc6,0xb9,0x2f,0x30,0x91,0x84,0x93,0x87,0x0,0x9a,0x7,0x73,
+0x22,0xd6,0xc6,0xcd,0xb3,0xf0,0x8a,0xb8,0x71,0x82,0x1b,0x31,0xf4,0xad,0x5b,0x94,
+0x3,0x4e,0x36,0xfb,0x95,0x19,0x9c,0x6,0x56,0x9c,0x22,0xb8,0x14,0x5d,0xef,0x65,
+0xc2,0xc,0x35,0xad,0xd8,0xd0,0xbd,0xee,0x53,0x78,0xd,0xc5,0x1b,0x1c,0x4b,0xac,
+0x72,0x8d,0x63,0xb3,0xc6,0x71,0xdb,0xfd,0x34,0x8e,0x46,0x70,0x7c,0x4c,0x7a,0x32,
+0x2d,0x4f,0xd0,0x8b,0x1d,0x42,0xa2,0x12,0x9d,0xd4,0xf7,0x71,0x6c,0xaf,0xea,0x67,
+0x9a,0xeb,0x56,0x18,0xdd,0xc0,0x44,0x37,0x21,0xd0,0xca,0xda,0xea,0x32,0xc9,0x61,
+0x60,0x64,0x72,0x99,0x60,0x5c,0x8a,0x3a,0x57,0x61,0x34,0xb2,0x15,0x43,0x3d,0x73,
+0xa9,0x46,0xa8,0xe1,0xb8,0xef,0x59,0x75,0x15,0xc1,0xc8,0xbe,0x95,0xf8,0x3b,0x70,
+0x48,0x96,0x33,0xbd,0xd9,0x7c,0x17,0xc7,0xa8,0xd4,0xa,0x47,0x9c,0x6b,0x44,0x78,
+0x98,0xa3,0x12,0x7,0x52,0xec,0xc,0xa0,0xfd,0x51,0x1c,0x15,0xe3,0xa8,0x16,0x1c,
+0x5d,0x64,0x37,0x9d,0x42,0x47,0x7a,0x78,0xd0,0x48,0x8b,0x27,0xf5,0x1a,0x8e,0x37,
+0x75,0x48,0xe6,0x6b,0x27,0x99,0x71,0x13,0x6f,0x70,0xe9,0x4,0xc0,0x86,0xe7,0xbe,
+0x4,0x35,0x4e,0xdd,0x32,0xed,0x99,0x6f,0x6e,0xf2,0x11,0xbc,0xf3,0xb1,0x96,0x2e,
+0x62,0xcc,0xb3,0x94,0x8e,0x15,0xd4,0xfc,0x21,0x8d,0x50,0x1c,0x5a,0x7a,0xbd,0x22,
+0xa1,0xf8,0x86,0x30,0xbe,0x1f,0x47,0xf3,0x6b,0x70,0xcc,0x21,0x80,0x6f,0x8f,0x7e,
+0xde,0x40,0xff,0xd6,0xc8,0x8a,0xbf,0x2a,0x8f,0x77,0xfa,0xb,0xb4,0xe4,0x56,0xeb,
+0x3a,0xf2,0x18,0x69,0x67,0x96,0x6c,0x22,0xf,0xe6,0x99,0xc4,0x23,0xbd,0xdc,0xbf,
+0x9e,0xee,0xc4,0x8f,0x88,0x86,0x7a,0xaf,0x7,0x19,0xb7,0x4,0x4f,0x5a,0xee,0x38,
+0x8f,0x42,0x21,0xb5,0x3f,0x9e,0xdc,0xc6,0x9b,0x22,0xfb,0x77,0x70,0xa4,0xb0,0x30,
+0x36,0xc2,0x58,0x71,0xc6,0x11,0xea,0x57,0xa6,0xc8,0xcf,0x38,0x62,0xfe,0xf5,0xa7,
+0x70,0x34,0xcb,0xb9,0xa6,0xb8,0x1a,0x21,0x37,0x36,0x35,0xf4,0x25,0x2f,0xbc,0x4b,
+0xfd,0xab,0x38,0xfa,0x9b,0xce,0x7c,0x27,0xed,0xd4,0xc7,0xa3,0xce,0xec,0x8,0x18,
+0x26,0xe8,0x62,0xaf,0x71,0x8a,0xba,0x90,0x4f,0xe,0x14,0xfb,0x99,0xdb,0x31,0x19,
+0xb1,0x4e,0x7d,0xd4,0xc2,0x33,0xcb,0x74,0xb3,0x2e,0xa6,0x89,0xc,0xa3,0x15,0x2e,
+0x25,0xfd,0x5e,0x14,0xef,0xe1,0xd8,0x7c,0xf,0x47,0xf3,0x1e,0x1c,0xd5,0x15,0x8e,
+0xd3,0x5d,0x1c,0x7b,0x5f,0xd3,0xcf,0x5b,0x14,0x49,0xe0,0xa9,0x27,0xc6,0xd1,0x66,
+0x7f,0x1f,0xc7,0xe9,0x79,0x73,0x3,0x64,0xa0,0xd3,0xc7,0xf3,0xc6,0x43,0x48,0x5c,
+0x43,0x15,0xfe,0x4c,0x4b,0x4a,0x62,0x28,0xc3,0x26,0x60,0x28,0x2d,0xf3,0x70,0xd7,
+0x38,0x22,0xb3,0x53,0x25,0x57,0x2f,0xa4,0xbd,0x32,0x62,0xe5,0xa3,0xd7,0xc8,0x7d,
+0xeb,0x77,0xa3,0x78,0x73,0xae,0xd,0xf8,0x38,0x61,0x41,0x17,0x1c,0xb9,0x56,0xcd,
+0xb,0x71,0xd7,0x38,0xe2,0x6c,0x7e,0x1c,0x47,0x84,0x2c,0x5b,0x4,0xc4,0xdb,0x5,
+0x47,0x15,0x9d,0x9e,0x28,0x1e,0x81,0xcb,0x59,0x1e,0x2,0x79,0x7c,0xd,0xc7,0xdd,
+0xe6,0x16,0x48,0x56,0x92,0x33,0x7b,0x2f,0x21,0x31,0x39,0x27,0x6,0xf1,0x50,0x7a,
+0x91,0xa1,0x5a,0x12,0xc6,0xa9,0x62,0x53,0xac,0xaa,0x5b,0x1c,0x39,0xfe,0x9e,0x3c,
+0x47,0xda,0xc7,0xb2,0x93,0x80,0x27,0xd6,0x70,0x6f,0xf4,0xbb,0x51,0xbc,0xc1,0x91,
+0x79,0x75,0xef,0xe0,0xa8,0x90,0x43,0x88,0x9f,0x86,0xa3,0x5a,0xe1,0x18,0xe5,0xce,
+0xa1,0x75,0x83,0x4,0x12,0xd5,0x9a,0x37,0x71,0xbc,0x41,0x52,0x76,0x33,0xc8,0x94,
+0x99,0x30,0x60,0x1f,0x25,0x98,0x83,0x8f,0xd,0x61,0x54,0xd5,0xc9,0xc3,0xbc,0x9f,
+0x9a,0x6c,0x1a,0xb4,0x56,0xe,0xa7,0xed,0x3,0xc7,0x32,0x1,0xa9,0x4f,0xcf,0xb7,
+0xf9,0xee,0x75,0xe5,0xf7,0x98,0x2d,0xee,0xdb,0xa,0x47,0xe1,0xd9,0xb2,0xb6,0x2d,
+0x7e,0xcf,0xb,0xc5,0xd7,0x42,0x52,0xf8,0x3a,0x8e,0xdd,0x1d,0xfd,0xb8,0x9c,0x6b,
+0x9c,0xae,0xed,0x9,0x47,0x13,0x77,0x4e,0xf7,0x4c,0xe1,0xd1,0x19,0x79,0xc,0x5,
+0x9a,0x39,0xbe,0x89,0xe3,0xd,0x92,0x61,0x19,0xff,0x14,0x22,0x68,0xc1,0x50,0x56,
+0x31,0x68,0x3f,0x7d,0xaf,0x6f,0x19,0x38,0x76,0xa,0xc3,0x67,0xab,0x85,0xe,0x3c,
+0xe5,0xef,0x76,0xab,0xeb,0x83,0x38,0xa,0xeb,0xd1,0x35,0x8e,0xf4,0x35,0xbb,0xc4,
+0x33,0xce,0xfc,0x38,0x8e,0xee,0xa,0x47,0x14,0xc,0x6b,0xf,0xbf,0x97,0xa2,0xc3,
+0x8a,0x43,0x26,0xe0,0xf8,0x9a,0x3c,0xba,0x73,0xfb,0xca,0xe5,0xc5,0xc1,0xb6,0xf0,
+0x6a,0x1c,0xd9,0xf2,0x72,0x92,0xac,0x2e,0x28,0xbe,0xd,0x24,0xe3,0xd8,0x75,0xd,
+0x69,0x54,0xa6,0x40,0x96,0x75,0xf,0x20,0x3d,0x71,0xa1,0x40,0xf8,0xe,0x30,0x2f,
+0x70,0x7c,0x9,0xaa,0xeb,0xb6,0xcc,0xb2,0xb5,0xb6,0x33,0xf4,0xbe,0x3b,0xce,0xb1,
+0xce,0xa8,0xe0,0x7,0x64,0x2d,0x7e,0x18,0x47,0xf6,0xc3,0xcd,0x82,0x63,0x8f,0xc2,
+0x6b,0xad,0xd0,0x2f,0x6c,0x4d,0x23,0xd1,0xa1,0xff,0xde,0xb9,0xbe,0x83,0xa5,0x2f,
+0xb3,0xb8,0x65,0x9a,0x94,0xb9,0x5d,0x75,0x48,0x32,0x3f,0xff,0xbd,0x3e,0x7a,0xc2,
+0xd1,0x36,0xe8,0x6e,0xa4,0x30,0xd5,0xd5,0x85,0xab,0x80,0xbc,0xca,0x41,0xbb,0x2b,
+0x18,0xdf,0x40,0xf2,0x12,0x47,0xcd,0x29,0x6,0x54,0x64,0x2e,0x70,0x4,0x8b,0x8f,
+0xcd,0xbf,0x0,0x47,0x15,0x77,0xa8,0x69,0x6f,0x6d,0x87,0x84,0x5f,0x8b,0xe7,0xa8,
+0x7d,0x7e,0x87,0x3c,0x5e,0x61,0x19,0xf4,0xc8,0x56,0x1b,0x73,0xa3,0x3c,0x2d,0xef,
+0x7c,0x12,0xda,0x65,0x7b,0xcd,0x44,0xf5,0x46,0x65,0xb6,0xec,0x63,0x62,0x2a,0x9c,
+0x23,0xf7,0x39,0x42,0x22,0x2f,0x60,0x7c,0x27,0x8e,0x33,0xb3,0x92,0x70,0xb5,0xef,
+0x8c,0x23,0xe7,0xa4,0x24,0x61,0x3,0x1c,0x1d,0x3e,0xaf,0x3e,0xea,0x3f,0x5e,0xe0,
+0xa8,0xd6,0x38,0x92,0x40,0xe6,0xaa,0xdd,0x82,0x66,0x8e,0x7d,0x7d,0xc2,0x31,0xbe,
+0x4b,0x1e,0x97,0x77,0x40,0x6f,0xce,0x89,0x3c,0x72,0x8,0xc8,0xa4,0xd0,0xe8,0x5d,
+0x36,0xb,0x51,0x4f,0xf3,0x9e,0x3e,0xaa,0xb2,0x57,0x8,0xa9,0x4,0x85,0xe2,0xd,
+0xa6,0x79,0x79,0x7f,0xc9,0x8f,0xc8,0xe3,0xfc,0xc8,0xb4,0x79,0xd5,0x35,0x8e,0xd,
+0xc5,0x97,0x9c,0xf,0x7f,0x62,0x1c,0x9b,0x9f,0xc5,0xd1,0x9c,0xcf,0x35,0x9a,0x7f,
+0x1d,0x33,0x6f,0x6d,0xc1,0x58,0x87,0xc2,0xeb,0x6b,0xf2,0x98,0x77,0x37,0x8,0x96,
+0x73,0x27,0x26,0x66,0xa8,0x99,0xdb,0x5d,0x15,0xe6,0x3d,0x61,0x24,0x79,0x5f,0xdf,
+0xb2,0x2a,0xf5,0x42,0xd1,0x1,0x14,0xd3,0x54,0x51,0x52,0xc5,0xfa,0x2,0xc3,0xd7,
+0xa1,0x24,0x1c,0xf7,0xab,0xfc,0x63,0x84,0xab,0xd8,0x34,0xe7,0x3c,0x85,0x30,0xba,
+0xb5,0xad,0x54,0x2,0x4,0x47,0x26,0x25,0xfb,0x71,0x1c,0xdb,0x33,0x8e,0xca,0xe3,
+0x55,0xed,0x90,0xc4,0x34,0x76,0x2b,0xd,0x2,0x2e,0x25,0x7f,0x27,0x6f,0xf6,0x2d,
+0x5d,0xe2,0xb8,0x32,0x1,0x4e,0xe2,0xba,0x3a,0x4c,0x46,0xe,0x71,0xe1,0xdd,0x36,
+0x32,0xf8,0xff,0xe,0x42,0x8b,0x55,0xc0,0x68,0xf8,0xb4,0x51,0xa8,0x9e,0x3,0x4f,
+0xdf,0xeb,0xb3,0x3c,0xbe,0x85,0xe3,0x66,0x85,0xa3,0xd4,0xb,0x6d,0x57,0xdd,0xe2,
+0xc8,0xb6,0x74,0x66,0x1c,0x43,0x21,0x1b,0x7b,0x3,0x47,0xf5,0x7d,0x1c,0xd3,0x49,
+0x1e,0xd1,0x47,0x5d,0xd3,0x13,0xe0,0x79,0xd8,0x62,0x93,0x8a,0xfa,0x2e,0x8e,0x17,
+0x3a,0xab,0x78,0x3d,0xbe,0xb7,0x22,0x7f,0x4b,0x76,0xbb,0x24,0x6c,0xab,0x1f,0xe1,
+0x8b,0xb2,0x68,0xed,0x3,0xfd,0x4e,0xad,0xdd,0x72,0xb4,0x37,0x6f,0x9c,0xed,0xb0,
+0xee,0x4b,0x21,0x1c,0xed,0xd6,0x30,0x17,0x73,0xa9,0x3,0x70,0xde,0xc,0xb5,0x55,
+0xc1,0x91,0x65,0xb6,0x30,0x94,0x9d,0xf3,0xb8,0x60,0x73,0x2c,0x38,0x22,0xb6,0xa4,
+0xef,0x61,0x77,0xcc,0x82,0x23,0xa3,0xbc,0xf4,0xb9,0x4,0xce,0xb6,0xb7,0x22,0x8f,
+0x91,0xe2,0x42,0x69,0xdb,0xd7,0x84,0x1,0x19,0xd6,0x8a,0x5d,0xf1,0x88,0xfa,0xcc,
+0xc3,0x1d,0x1c,0xd3,0xee,0x34,0x91,0xb2,0x2,0x12,0x35,0x2f,0x38,0x3b,0xc9,0x2a,
+0x75,0x5e,0xbb,0xf4,0xb3,0xbc,0x80,0x4c,0xec,0x28,0xac,0x5e,0x6b,0x1d,0xf9,0xaa,
+0x44,0x5e,0xf6,0xf7,0x1c,0xe,0x79,0xb,0x12,0x63,0x75,0x85,0x63,0xcf,0x25,0xbd,
+0xc3,0x19,0xc7,0xee,0x2d,0x1c,0xd1,0x45,0x75,0xaa,0x73,0xbd,0x89,0x23,0x79,0xbf,
+0x48,0x81,0xd3,0xc3,0x26,0xdb,0x37,0x5c,0xe5,0x49,0x4e,0x70,0xbc,0x6,0xf2,0x21,
+0xdf,0xe2,0x88,0xbf,0x75,0x71,0xba,0x13,0x53,0xf3,0x7c,0xd2,0x45,0x36,0x82,0x7b,
+0x5,0x12,0xf,0x5a,0x8b,0x44,0x6e,0xde,0xb4,0x36,0xd7,0x38,0x7a,0xf2,0x40,0xc0,
+0x64,0x7d,0xea,0xdb,0x63,0xe9,0x93,0xfe,0x9e,0xb2,0xeb,0x8,0x5f,0x31,0x6c,0x13,
+0xb8,0x3e,0x23,0xec,0x83,0xed,0xaa,0xee,0x8a,0x7e,0xde,0x6a,0x25,0x8f,0xa4,0x1b,
+0xd4,0x19,0x47,0x53,0x2d,0xf5,0xeb,0xf8,0x18,0x75,0x2e,0x95,0x99,0xb0,0xe5,0x6e,
+0x29,0x14,0x5e,0xe3,0xfe,0x5e,0xbe,0xe7,0x81,0xbb,0x25,0x37,0x2b,0x4,0xb,0x8c,
+0x9c,0x8a,0xa8,0xa3,0x92,0x25,0x13,0x9f,0x73,0xd9,0x2d,0xd3,0xea,0xb4,0x1d,0x33,
+0xad,0xd4,0xfa,0xc6,0x8f,0xbc,0xc1,0xf1,0xb2,0x6f,0xf,0x28,0x55,0x5c,0xd6,0xb7,
+0x2b,0x1c,0xb7,0xac,0x2e,0x11,0xcd,0xc8,0x23,0x2e,0x70,0xf4,0xf7,0x70,0xb4,0xaf,
+0xe0,0x18,0x80,0x63,0xbb,0xc6,0xd1,0x2c,0x8e,0x41,0x2e,0x4a,0x37,0xbe,0x82,0xe3,
+0xd3,0x5,0x8e,0xcb,0x25,0x6c,0x4d,0xbc,0x7f,0xb5,0x22,0x4b,0xf5,0x59,0x38,0xa2,
+0xf3,0x6,0x6e,0xae,0xed,0xb2,0xae,0x4f,0x3a,0xf2,0x2d,0x20,0xe3,0x15,0x8e,0x81,
+0x89,0xa2,0xe9,0xd6,0x2e,0xfd,0xb8,0xe0,0x44,0x53,0x52,0x97,0xe2,0xe,0xf1,0xc5,
+0x5e,0xab,0xf3,0xb9,0x86,0x4a,0x2a,0x7d,0x0,0x4f,0xa8,0x5f,0x23,0x92,0x6c,0x57,
+0xe7,0xda,0x9c,0xfc,0x51,0xc6,0xb1,0xd9,0x6e,0x4b,0x3f,0x5,0xe4,0xb1,0x91,0xc7,
+0xe9,0x67,0x74,0x7c,0x18,0x3e,0xd7,0xf7,0x70,0x7c,0x79,0xb2,0x53,0xbc,0x40,0xb1,
+0x1c,0x6a,0x4e,0x8c,0x4d,0xcc,0x53,0xa8,0x3e,0x8d,0x8f,0x5e,0x75,0x42,0xf3,0x4,
+0x8a,0x4a,0xee,0xa7,0xa8,0xd9,0x5a,0xbf,0xe,0xe4,0x2e,0x5e,0x64,0x4d,0xf7,0xfb,
+0xe8,0xc0,0xfe,0xd0,0x9c,0xec,0x35,0x79,0xe0,0xe8,0x75,0x91,0x2e,0xa8,0xd7,0x71,
+0x34,0x17,0x38,0x36,0x97,0x38,0xaa,0x53,0x3f,0x65,0xc1,0x51,0x9d,0x71,0x8c,0x55,
+0xe9,0x10,0xd0,0xa8,0x3a,0xda,0x57,0x71,0x7c,0xc0,0x2c,0xc5,0x35,0x8e,0x32,0xde,
+0x35,0xba,0xcc,0x9d,0x25,0xaa,0xfa,0x34,0xf2,0x7c,0x66,0xed,0xac,0xf8,0xa0,0xa9,
+0xcc,0x9c,0x1e,0x3a,0xec,0x76,0x6f,0x5,0x36,0x57,0x38,0x3e,0x25,0x97,0x1a,0xb6,
+0x2c,0xa5,0xcf,0x9e,0x70,0x44,0xae,0xa7,0x74,0xed,0x31,0x8e,0xbc,0x13,0xa0,0xcc,
+0x7d,0x10,0x8e,0xdc,0x25,0x70,0x69,0x67,0xd6,0x38,0xf2,0xb1,0xb7,0x45,0xdf,0xfa,
+0x20,0x79,0x10,0xf9,0x85,0xc9,0x46,0xfa,0x71,0xfc,0xa2,0x67,0xfa,0x45,0x9,0x8f,
+0x62,0xbf,0xe7,0x1e,0x8e,0x4f,0x4f,0x5b,0xcc,0xf6,0x5c,0x5c,0x8e,0xd9,0x1b,0xe8,
+0x50,0x5b,0x66,0xd2,0x3b,0xad,0x71,0xf8,0x79,0x34,0x3b,0x61,0x8,0x64,0xe,0x5a,
+0x1e,0xbb,0x41,0x9f,0xd4,0x9b,0x91,0xcd,0x45,0x9f,0xfd,0xb7,0x97,0x7d,0xf6,0xee,
+0x84,0x23,0xf7,0xf7,0x98,0xc5,0x9,0x7a,0x39,0xe1,0x88,0x68,0xf8,0x2c,0x8f,0xcc,
+0x54,0x7d,0x6a,0xc5,0x7f,0x1f,0x8e,0x6a,0x91,0x47,0x14,0xb4,0xa7,0x29,0x4f,0x4e,
+0xd7,0xd1,0x72,0x57,0x11,0xf9,0xe1,0xef,0xc1,0x71,0xc3,0x7e,0x23,0xf2,0x3b,0x73,
+0x54,0x9d,0x2c,0x75,0x6b,0xdb,0x4f,0xd3,0x8f,0x85,0xff,0x2,0x55,0x16,0x10,0x1c,
+0x32,0xa7,0x5d,0xb8,0x78,0xf2,0x2b,0x20,0xd3,0x15,0x8e,0x13,0x1d,0xb5,0xce,0x4a,
+0xe3,0x28,0xe6,0x67,0x2a,0xd3,0x59,0xe9,0x56,0x4,0x8c,0x24,0x6e,0xf4,0xb2,0xd1,
+0xa3,0x63,0x61,0x59,0xf0,0x8,0xaf,0xb8,0x2f,0xaa,0x29,0x9d,0xcf,0x87,0x39,0x6f,
+0xa5,0x27,0x52,0x32,0xb7,0x35,0xf2,0x99,0x46,0x7a,0x96,0x6b,0xed,0x99,0xbe,0xa9,
+0xb4,0x9d,0xea,0x38,0x45,0x18,0xb2,0xa,0xcb,0xa,0xa3,0xef,0xd1,0x83,0x41,0x62,
+0x1a,0x5e,0xc5,0xf1,0x52,0x1a,0x3,0x6a,0x5c,0xc7,0xf9,0x48,0x1e,0x46,0xd9,0x71,
+0xd8,0x75,0x9f,0x8d,0x63,0xb5,0x45,0xb7,0x86,0x4a,0xc7,0x7a,0x5c,0xac,0xf6,0x2b,
+0x2,0x99,0x6c,0xba,0xd0,0x8f,0x6d,0x72,0x75,0xea,0x2c,0x92,0xaa,0x4,0xa9,0xce,
+0xc6,0x96,0x66,0xc5,0x3,0x60,0x24,0x71,0xdb,0xab,0x1e,0x38,0x9a,0xa6,0xe5,0xee,
+0x26,0x1d,0x84,0x95,0xba,0xc7,0xa3,0xe8,0xec,0xcf,0x9,0x71,0x89,0x34,0x4a,0x61,
+0xfa,0x1,0x83,0x23,0xf4,0x4a,0x54,0xcb,0x32,0x4d,0xf2,0xc8,0xdf,0xeb,0x95,0x64,
+0x24,0xa2,0x1b,0x55,0xd5,0x53,0xf0,0x8e,0x45,0x36,0x1c,0xc3,0x47,0x9e,0x53,0xbe,
+0x8b,0x63,0xda,0x5d,0x9b,0x6a,0x90,0x99,0x7a,0xd9,0xa8,0x2c,0x38,0x7e,0x96,0x82,
+0x3c,0xe1,0x28,0x4d,0xa7,0xbd,0xb0,0x14,0xba,0xf0,0x3a,0x90,0x49,0x5d,0xe0,0x48,
+0xb0,0xee,0xd8,0x7,0xc1,0x80,0x66,0x45,0x31,0x3f,0xf9,0x37,0xa5,0x63,0x4f,0x4e,
+0xb5,0xb6,0x6a,0x6b,0x79,0xef,0x35,0x99,0xf4,0x3c,0x69,0xad,0xd1,0x7,0x6d,0x44,
+0xc4,0x48,0x43,0x86,0xb6,0xc7,0xaa,0x48,0x30,0xd2,0xf7,0xe4,0x1b,0xea,0x3a,0x73,
+0x1d,0xd7,0xf4,0x6d,0x4e,0xd9,0x79,0x27,0xbb,0xbd,0x54,0x69,0x61,0xf6,0xf4,0x5c,
+0x6d,0xcf,0x9e,0xba,0x6a,0xac,0xb8,0x52,0xb7,0x7d,0xcd,0x82,0xa3,0x4d,0xab,0x18,
+0x97,0x94,0xa3,0xf0,0x7b,0x82,0x86,0x46,0xd4,0x22,0x72,0xb1,0xe6,0x93,0x56,0x43,
+0x9d,0x71,0x4,0x90,0xaa,0xcd,0x4e,0xb8,0x9c,0x5e,0xc7,0x71,0x3d,0x37,0x2c,0xb5,
+0xf6,0x1d,0x29,0xb5,0x24,0x23,0x4,0xec,0xe9,0x71,0xe,0x46,0x8c,0xc,0x70,0x6c,
+0xd9,0xbb,0x64,0x99,0x9b,0x8,0x19,0x80,0x6e,0xb8,0x61,0x10,0xe2,0x29,0x38,0x1a,
+0xe0,0xa8,0xa4,0x1b,0xf,0xf6,0x1c,0x9d,0xf7,0xa2,0x2f,0x7d,0x48,0x5d,0xcf,0x33,
+0xb,0xfd,0x82,0x23,0xfa,0xc9,0xe9,0x9e,0xa0,0x66,0x8a,0x3b,0x31,0x86,0xfc,0xa,
+0x8e,0xd3,0x5,0x8e,0x88,0x6,0x1,0x63,0x2e,0x29,0x1d,0xe0,0xc8,0xb5,0xf6,0xe6,
+0x53,0xcf,0x36,0x77,0xef,0x92,0xf6,0x4d,0x47,0x29,0xd8,0xbc,0x86,0xe3,0xee,0xa,
+0x47,0x92,0x47,0xbc,0xd2,0xfa,0x19,0xc4,0xc2,0x6,0x56,0x79,0xe2,0xc9,0x18,0x81,
+0x91,0x3b,0x4d,0xc9,0x27,0xc0,0x6,0x33,0xf2,0x2,0x9,0x47,0x84,0xc7,0xd2,0x23,
+0xce,0xc8,0x1c,0xe,0x32,0x57,0x8c,0xbd,0x75,0xc5,0x54,0xd5,0x13,0x6f,0xa1,0xc2,
+0xa3,0x93,0xf6,0xd1,0x91,0xa4,0x32,0xb2,0xdc,0xe9,0xe8,0xc9,0x6f,0xc4,0x50,0x8,
+0x4e,0x0,0x8f,0xd5,0xd4,0xfa,0xb9,0x99,0xee,0xfb,0x8f,0x53,0xba,0x3c,0xd5,0xcc,
+0xa2,0x98,0xcf,0x2d,0x62,0xbf,0x2,0x47,0x59,0x79,0xbe,0x55,0xcc,0x54,0x38,0xbe,
+0xa1,0x21,0xaf,0x71,0xcc,0xa,0xcc,0xa,0x98,0x55,0x43,0x11,0x53,0x26,0xb1,0xb0,
+0xfd,0xf6,0xa9,0x34,0xc8,0x92,0x1d,0xf1,0xe7,0x2b,0x4,0x4e,0x33,0x9c,0x3f,0x23,
+0x1c,0xf,0xeb,0xef,0x6b,0x32,0xe8,0xee,0xf4,0x29,0x19,0xa5,0x18,0xdc,0xf9,0x9b,
+0xe0,0x96,0x24,0x7f,0x27,0x67,0x52,0x3f,0x81,0xfe,0x41,0x53,0xae,0x8b,0xe6,0x3d,
+0x38,0x3a,0xf0,0x8b,0xf,0x75,0xb2,0x45,0x35,0x16,0x1c,0xcd,0x27,0xae,0xe2,0x61,
+0xee,0xa8,0x4e,0xaa,0x53,0xdb,0x6d,0xe6,0xa2,0xac,0x7b,0xcd,0xf5,0xb9,0x87,0xa3,
+0x78,0xbb,0xe0,0xa7,0x0,0x45,0x45,0x48,0xf1,0xe5,0xe5,0xdc,0x66,0x7c,0xd8,0x3,
+0x8f,0xd3,0x45,0x1a,0xe3,0x39,0x1e,0x4e,0x17,0xd6,0x41,0x12,0x92,0x98,0x2f,0x5c,
+0xbe,0xbd,0xd3,0xab,0x47,0x93,0xd,0x39,0x3f,0x78,0x9f,0x26,0x2f,0x4e,0xa0,0x96,
+0xa7,0xe3,0xf0,0x2b,0x6e,0xf3,0x2b,0x38,0xc6,0x35,0x8c,0xe0,0xcc,0xae,0xd9,0x57,
+0x20,0x9b,0xba,0xf0,0xef,0x7d,0xea,0x3e,0x23,0x96,0xc7,0xce,0x74,0x5b,0xae,0x11,
+0x74,0x91,0xb9,0x4,0x5e,0xad,0x32,0xdc,0xc7,0x91,0x67,0x4f,0xe5,0x8a,0x39,0x95,
+0x24,0xd6,0x83,0x58,0xf4,0x45,0x2e,0xe4,0xdb,0xf4,0xc6,0x91,0x4a,0x5c,0x50,0x4,
+0x90,0x7b,0x32,0xdc,0x6e,0xf9,0x2e,0x3f,0x70,0xf9,0x5d,0x1b,0xb2,0x21,0xa7,0xc7,
+0x1e,0xf6,0x13,0xd2,0xb8,0xfc,0xed,0xe5,0xd7,0xd1,0xa7,0xf7,0x71,0x7c,0xb9,0xc4,
+0x51,0x73,0x59,0xd5,0x4d,0x96,0x65,0x5,0x73,0x2e,0xa6,0xab,0x7e,0xe1,0x45,0xfe,
+0x46,0x66,0xce,0xea,0xd7,0x2c,0xcd,0x2e,0xdb,0xa7,0xa7,0x35,0x8e,0x26,0x5e,0xfa,
+0xe9,0x2e,0xad,0xe7,0x94,0xa0,0x41,0xab,0x74,0x91,0x49,0xdd,0xc4,0x29,0xcb,0x28,
+0xf0,0x72,0xed,0xf3,0x4d,0xe4,0x51,0xae,0x67,0xb2,0x21,0xe7,0x87,0xed,0x1f,0x1f,
+0x6f,0xe7,0xd8,0x77,0xb1,0xcd,0x4f,0xfb,0x9b,0xac,0x19,0x3d,0xfa,0x8c,0x63,0x70,
+0xbc,0x11,0x45,0x67,0xf5,0xbb,0x16,0x6a,0x61,0x96,0x2f,0xcc,0xc3,0xeb,0x96,0x86,
+0xce,0xf5,0xdb,0x38,0x86,0x6b,0x1c,0x73,0x95,0x2e,0xe3,0xf5,0x34,0xa5,0xf7,0xe2,
+0x18,0x2f,0x71,0xc4,0xe3,0x6e,0x70,0x4c,0x2d,0xc9,0xe3,0x35,0x8e,0x2f,0x17,0x38,
+0x62,0xd1,0xe9,0x7c,0x1c,0x29,0xa4,0xfc,0x7d,0xb,0x7,0x79,0xbd,0x8,0xba,0x4a,
+0xef,0x3,0x9,0x1c,0xef,0x9d,0xeb,0x15,0xef,0xc6,0x3a,0xde,0x1,0xe7,0x54,0x7f,
+0xe9,0xf,0x3f,0x83,0x13,0xff,0x6d,0x1c,0x45,0x78,0x21,0x6b,0x39,0x7f,0xf,0xc7,
+0x90,0x54,0x7e,0x79,0xba,0xec,0xc,0xff,0x26,0x8f,0xf6,0x4b,0x4c,0xa6,0x39,0x3,
+0xae,0xc9,0x77,0xff,0x6d,0x38,0x92,0x67,0x37,0x69,0xd2,0xc8,0xa3,0xbb,0xf,0xe4,
+0xd,0x8e,0x36,0xee,0xde,0xc8,0x7,0x1,0xc7,0xb5,0x9e,0xa2,0x77,0xf5,0x9c,0xbf,
+0x8b,0xe3,0xf2,0x8c,0x8e,0x6c,0xf2,0xea,0x61,0xfb,0xa9,0x3c,0xee,0x92,0xe7,0x43,
+0xa5,0x2b,0x1c,0xbf,0xf1,0xa3,0xd3,0x19,0x47,0x66,0xb7,0xaf,0xd3,0xf4,0xfb,0x70,
+0xe4,0x4a,0xb4,0x47,0x15,0x48,0xbf,0x2,0x64,0x36,0xd7,0xe7,0xfa,0xa,0xc7,0xe6,
+0x42,0xeb,0x3,0x24,0x7f,0x29,0x8f,0x37,0xea,0x51,0xf0,0xd9,0xec,0x76,0x57,0x39,
+0xd7,0x1d,0x74,0xed,0xfa,0x81,0x53,0x7a,0xbe,0x39,0x1f,0xcf,0xd9,0x5e,0xe1,0xf8,
+0xed,0xdb,0xfa,0xe6,0x40,0x1c,0xb9,0x2f,0x2a,0x4c,0xdd,0xef,0x5b,0x24,0xca,0x73,
+0x20,0x92,0xae,0x70,0x9b,0xbb,0x40,0x5e,0xeb,0xc7,0xe6,0xa,0xc7,0x54,0x3d,0xed,
+0x2f,0xde,0xcf,0x63,0xba,0x14,0xb6,0x78,0x1f,0xc7,0xcd,0xd,0x8e,0x9b,0x5d,0x78,
+0x1d,0xc7,0xe5,0xe5,0xec,0xfc,0x74,0x83,0x63,0x11,0xf2,0x14,0x76,0x92,0x94,0xd6,
+0x3,0xf3,0xe4,0x22,0x1e,0xf8,0x5d,0x38,0xb6,0x68,0x41,0x9a,0x2,0x3a,0xa0,0xf5,
+0x9d,0x83,0x46,0xaf,0x2a,0xb7,0x57,0x38,0xfa,0x2b,0x1c,0xdb,0xa7,0x97,0xa2,0xa2,
+0xf8,0x8a,0x8f,0xe9,0x12,0x9d,0x4b,0x6c,0x4e,0x7a,0xef,0xde,0x45,0x38,0xc6,0xb,
+0xbc,0xd3,0xf3,0xcd,0xb,0xf2,0xfd,0xe3,0x5,0x8e,0x67,0x65,0x91,0xc2,0xe2,0x3b,
+0xce,0xf3,0x20,0xed,0xa7,0xed,0x6f,0x5c,0x6c,0x4b,0x57,0xe2,0x4e,0x72,0x77,0x7,
+0xc8,0xdd,0xad,0x3c,0x5e,0xe2,0xb8,0xc9,0x3d,0x58,0xe,0xce,0xef,0x9e,0xa0,0xb8,
+0x54,0x8f,0x29,0xbf,0x1b,0x47,0x9f,0xaf,0x71,0xdc,0xdc,0x3e,0x66,0x2,0x4f,0xdc,
+0x5,0x84,0xb,0x8e,0xa7,0x6a,0x35,0xe8,0xe0,0xa7,0x2d,0xfa,0x2f,0x7e,0x9f,0x9d,
+0xe1,0x9a,0xa8,0x43,0x66,0xe4,0x9c,0x87,0x5c,0xbf,0xfa,0x3c,0x3d,0xbd,0x3c,0xac,
+0x7a,0x3f,0xcc,0x25,0x8e,0x64,0x45,0x9e,0xd6,0x6f,0xe7,0xe9,0x12,0xc7,0x9d,0xa3,
+0x7,0xa4,0x4b,0x14,0x9,0x9f,0xc9,0x87,0xdb,0x67,0xda,0xb1,0xed,0xbf,0xc0,0x31,
+0xde,0xc3,0xf1,0xfa,0xbe,0x5c,0xe0,0xb8,0x9,0x9a,0x77,0x97,0x79,0x85,0xf6,0x8b,
+0xb6,0xfa,0x6d,0x17,0x45,0x35,0x28,0xc3,0x82,0xff,0x57,0x6f,0xee,0xc8,0x48,0x62,
+0x9c,0xce,0xf2,0x38,0x5d,0xe0,0x48,0x9e,0xca,0xe5,0xbb,0x7a,0xca,0x39,0x5e,0xbf,
+0x6f,0xc1,0xa6,0x88,0xf,0x48,0x72,0x83,0x4,0x8e,0x32,0x56,0xb4,0x52,0x92,0xf1,
+0x1d,0x38,0xc6,0xef,0xe0,0xe8,0xc0,0x5a,0x72,0xd4,0x3d,0xaa,0xc3,0xbf,0xf,0x47,
+0xec,0xd7,0x43,0x49,0xca,0xf1,0x4e,0x9e,0x7b,0xce,0xc8,0xa5,0xbc,0xc9,0x91,0x94,
+0x70,0x85,0xf9,0x89,0xe2,0xe3,0x5d,0x9f,0x66,0x1d,0xcd,0x90,0x17,0x2e,0x1c,0xc3,
+0x5a,0x76,0xf8,0x1d,0xa5,0xc9,0x9a,0x19,0x1d,0x46,0x26,0x6d,0x5e,0xf2,0x9f,0x97,
+0x26,0x49,0xc2,0xeb,0xf,0xe2,0xb8,0x93,0x55,0x4e,0xd1,0xf0,0xb8,0xfd,0xef,0xc4,
+0xb1,0xc2,0x44,0x8,0x33,0xf6,0x8d,0xfa,0x2e,0x8e,0xfb,0xcb,0x57,0x1b,0x76,0xeb,
+0x76,0x96,0x78,0x6d,0x8c,0xd7,0xbe,0x4a,0x89,0x66,0xd6,0xa4,0xd7,0xc7,0x13,0xbb,
+0xbd,0x6c,0xac,0x19,0xcb,0xc6,0x28,0x7e,0xf8,0x65,0xe4,0xc3,0xb2,0x7f,0xf3,0x7a,
+0xbe,0x83,0x23,0x28,0xc6,0x64,0xf,0x8d,0xc2,0xa4,0xe5,0xef,0x3b,0xd6,0xa0,0x89,
+0x43,0xcb,0xf,0x6f,0xda,0xd2,0x37,0x5a,0xeb,0x79,0xed,0x19,0x93,0x35,0x3e,0x59,
+0x45,0x79,0xd8,0x73,0xba,0x8c,0xf9,0xd6,0xd1,0x19,0xbf,0xad,0x10,0x3,0x56,0x94,
+0x2d,0xdb,0xa2,0xe6,0xd5,0x6,0x3a,0xac,0x8e,0x5a,0x7a,0x64,0xd1,0x68,0xac,0x99,
+0xc1,0xe3,0xa,0xc7,0xeb,0x83,0xfd,0xc,0x7e,0xcf,0xd7,0x71,0xe4,0xf9,0xf5,0xa1,
+0x9e,0x90,0x5e,0xed,0x9b,0x4f,0xdc,0xb4,0xfc,0xe,0x3e,0xd2,0xce,0xf4,0xa6,0xb0,
+0x3,0xdc,0xda,0x6c,0x7f,0x89,0x63,0xba,0xc2,0xd1,0x4f,0x97,0xb1,0xca,0x45,0x34,
+0x23,0x94,0x5a,0xcc,0xb2,0x74,0x17,0x47,0x11,0x4b,0x3e,0x87,0xfc,0xe4,0xf5,0xec,
+0xa5,0xf3,0xef,0xa4,0x22,0xc2,0x6d,0x26,0xe3,0xd,0x1c,0x5d,0xe9,0x73,0x1c,0xa3,
+0x5a,0xa6,0x7b,0x7f,0x17,0x8c,0xa0,0x95,0x42,0xd7,0x9d,0x55,0x49,0xf3,0x5e,0x8e,
+0x2b,0x20,0xdd,0x95,0x1d,0xb9,0xc0,0x91,0xb5,0xd5,0xd3,0xb5,0x7a,0xf4,0xe7,0x6c,
+0x81,0xb0,0xff,0x43,0xe6,0x96,0x9d,0x14,0xbc,0xff,0x83,0x9b,0xdc,0xd1,0x5d,0xcc,
+0x4b,0xf5,0x8e,0xe7,0xcd,0x54,0xf8,0x2e,0x69,0xcb,0x3,0x36,0xfd,0xe1,0xb9,0x6e,
+0xdd,0x23,0x7,0x92,0xaf,0xd7,0x71,0xd4,0xdc,0xbb,0xec,0x30,0xd1,0xcd,0x5c,0x2c,
+0xdb,0xdf,0x77,0xb0,0x2d,0xd4,0x31,0xf2,0xfe,0x89,0xd9,0x8a,0x19,0xc8,0xcd,0xda,
+0x5c,0xbf,0x89,0x63,0xba,0xc2,0x91,0x9c,0xee,0x20,0xd,0x1a,0xae,0x6c,0x4f,0x29,
+0xbb,0x52,0x16,0x1c,0x91,0xed,0x8e,0xb8,0x38,0xe1,0xcd,0x8b,0x7f,0x16,0x24,0x65,
+0x4f,0x66,0x59,0x2b,0x75,0xc0,0xef,0x2a,0xf2,0xb8,0xb9,0xb8,0xaf,0xf9,0x75,0x1c,
+0x35,0x6f,0x68,0x41,0xd,0x82,0x37,0x9c,0x76,0xdb,0xdf,0x88,0xe3,0xd2,0x90,0xcf,
+0x7b,0xfc,0xf0,0x3a,0x2e,0x1b,0x2c,0xd2,0xa5,0x1d,0x59,0xe3,0xb8,0xd9,0x90,0x74,
+0x5c,0xe9,0xfc,0x34,0x45,0x4e,0xad,0xd3,0x3d,0xc1,0x16,0xb9,0xb2,0x94,0x2,0xd2,
+0xa7,0x43,0x8c,0xf9,0x8a,0x8d,0x9,0xeb,0x2c,0x23,0xc1,0xc9,0xeb,0xbe,0x97,0x51,
+0x2,0x2e,0xde,0x63,0xb4,0xc2,0xc5,0x8b,0x7b,0x26,0x9d,0xb5,0x71,0xba,0xce,0xc2,
+0x2d,0x38,0x3e,0x26,0x2d,0x4b,0x81,0x62,0xf3,0xfb,0xce,0xf3,0x2d,0xab,0x26,0xc9,
+0x65,0x2a,0x27,0xeb,0x4d,0x1c,0xe3,0xe9,0x5d,0x11,0x8e,0xf1,0x4a,0x36,0xe0,0x3d,
+0x3a,0x94,0x0,0xc6,0xb2,0x83,0x55,0xe,0x30,0xef,0xd4,0xad,0x56,0x49,0xd5,0xe6,
+0xd4,0x1f,0x82,0xff,0xb0,0x40,0x53,0xf3,0x28,0xc6,0xb8,0xd8,0xf1,0x5a,0x56,0x7c,
+0xdf,0x4,0xab,0xc0,0x71,0xff,0xa,0x8e,0x51,0xbc,0x0,0xdd,0xff,0xbe,0xf4,0xc4,
+0x3d,0x9e,0x34,0x65,0x4d,0xd4,0xe4,0xdf,0xcd,0xf5,0x2a,0xf7,0xf3,0x9c,0xaf,0x70,
+0x5c,0x47,0x2b,0xc8,0x73,0x5d,0x5b,0x6b,0xbf,0x2c,0x43,0x3a,0x1e,0x65,0xe7,0xcc,
+0xe0,0x7c,0x9a,0x1a,0xd9,0x84,0x75,0xb6,0x9f,0xb,0x8e,0x66,0xd9,0x88,0xcc,0x6b,
+0xe3,0xb0,0x5b,0x72,0xe4,0x19,0x36,0xf9,0x23,0xf4,0xc9,0x17,0xd5,0xf5,0xd7,0x71,
+0xdc,0x43,0x29,0x90,0xf2,0x4d,0xa6,0x52,0xd5,0x3f,0xf,0x47,0x66,0x47,0x4a,0xee,
+0x28,0x1b,0x49,0xb5,0x16,0x3f,0xdb,0xbf,0x81,0x23,0x72,0xb8,0xab,0x33,0xf6,0x80,
+0x58,0x65,0xd9,0x88,0x22,0xbb,0x4a,0xc7,0x91,0xce,0xa6,0xc0,0xa6,0x16,0x22,0xa1,
+0xdb,0x8,0x1f,0xb3,0x90,0xbc,0xd,0x12,0xbb,0x71,0x99,0x81,0xb1,0xdc,0x8,0x19,
+0x8d,0x2c,0xfb,0x55,0x24,0xec,0x81,0xb9,0xbe,0xb,0xe3,0xcb,0x1,0x2d,0x28,0x78,
+0x46,0x25,0x94,0x3d,0xff,0xb4,0xb,0x64,0x84,0x55,0xe,0x98,0x9f,0x7,0xc3,0x6c,
+0xcd,0x61,0x5b,0xca,0xe9,0x75,0x79,0x24,0xe1,0xd8,0x9f,0x62,0xe6,0x83,0x5b,0x36,
+0x2b,0xb3,0x27,0xc3,0xfc,0x41,0x31,0x15,0xd2,0x25,0x59,0x83,0xdc,0xdc,0x5b,0x44,
+0x6d,0x85,0x1b,0x4b,0xe,0xbd,0x62,0x2c,0x79,0x15,0xdf,0x50,0xf6,0x50,0x2d,0x3b,
+0xbe,0xa4,0xb6,0x8,0xb6,0xe6,0x7b,0x38,0xc2,0xd3,0x67,0xc6,0xeb,0x7a,0xaa,0xcc,
+0x3f,0x11,0xc6,0xb2,0x3,0xc8,0xd8,0xc9,0xd7,0xa7,0xad,0xd2,0x5a,0x38,0xff,0x5f,
+0xc7,0x91,0x2b,0x6,0xdf,0xb8,0x96,0xba,0x58,0xdc,0x23,0x2f,0x24,0x1e,0xb1,0xb3,
+0x3d,0x71,0x32,0xa9,0xe1,0xd6,0xc3,0xe6,0x95,0x95,0x94,0xea,0x94,0x76,0x32,0x58,
+0xa,0x89,0x96,0x29,0x50,0xf9,0xb0,0xed,0x39,0xe,0xe2,0x6b,0xf2,0xee,0xf9,0xf2,
+0x7a,0x42,0x7e,0x4c,0xf7,0xce,0xb5,0x93,0xd7,0x8c,0xed,0x97,0xff,0x5c,0x69,0xc4,
+0x34,0x7c,0x83,0x66,0x83,0x3e,0xe9,0xe3,0x79,0xb3,0x34,0xba,0xd1,0xc4,0x9b,0x5b,
+0x70,0xf4,0xe7,0xde,0x8f,0x88,0x90,0x4f,0xd6,0xc3,0xa1,0x7,0x44,0xb6,0xeb,0x91,
+0x62,0x1b,0x87,0x10,0x73,0x5b,0x6e,0x8f,0x51,0x55,0x61,0x3,0x7b,0xa5,0x4,0x2f,
+0xb,0x75,0x2b,0xe1,0x7b,0x1,0xd5,0xe,0x6,0x27,0xd,0xe9,0x4b,0xd0,0xdd,0x15,
+0x37,0xfd,0xbc,0xbf,0x99,0x4c,0x16,0xef,0x91,0x3e,0x9d,0x3,0x8e,0xdc,0xe5,0xdb,
+0x14,0xd9,0x26,0x34,0xdd,0xaa,0x7f,0x26,0x8e,0xcb,0x32,0x5b,0x43,0x31,0xa2,0x44,
+0xc2,0xcb,0x4e,0xe6,0x79,0x76,0x87,0x5,0xc7,0xfc,0xf8,0xec,0x96,0xea,0xb4,0xd6,
+0xe7,0xb8,0x4,0x7e,0x36,0xd8,0x72,0x58,0xa9,0x85,0xb2,0xd3,0xaa,0x35,0xe5,0x20,
+0xab,0xcb,0xfd,0xb8,0x57,0x28,0xca,0xe0,0x73,0x73,0x7a,0x88,0x90,0x92,0x80,0x60,
+0x97,0xcc,0x38,0xb3,0x6b,0x2d,0x5e,0xe5,0xbc,0xf2,0x2e,0x4b,0xee,0x68,0x75,0x12,
+0xe8,0x15,0xa7,0xb2,0x43,0xb6,0xa9,0xfe,0xc9,0x97,0xea,0x48,0x2a,0x60,0xb7,0xe1,
+0x78,0xac,0xe2,0xc,0xb9,0x74,0xd9,0xf1,0x31,0x96,0xb3,0x3b,0xe,0xe7,0x77,0x7,
+0xfe,0x2a,0x38,0x2a,0x21,0x81,0x55,0xc4,0x30,0xc7,0xef,0xcf,0xbd,0x1f,0xb8,0x45,
+0x6c,0x7a,0xca,0xe0,0xb3,0xf8,0x0,0xcb,0xf3,0xb,0x7a,0xbc,0x72,0x92,0xb7,0x49,
+0xe2,0x83,0x24,0x4b,0x8d,0xff,0x5,0x2e,0x90,0xe6,0xda,0xaa,0x65,0x6e,0xb,0x91,
+0x82,0xb1,0x5e,0xef,0x92,0x97,0x18,0xaf,0xe0,0x28,0xdb,0xd1,0x8f,0xa7,0xef,0x90,
+0x75,0xce,0x53,0xe1,0xbf,0xfa,0x69,0x1c,0x97,0x81,0xa1,0xae,0xa3,0x13,0xce,0xbb,
+0x7b,0x8f,0xa7,0x5c,0x91,0x78,0x47,0xf8,0x98,0x5d,0x1d,0x9c,0x1b,0x7a,0xb5,0x7e,
+0x92,0x35,0xc6,0xff,0xa,0x57,0xc3,0x7d,0x30,0xdc,0x62,0x1a,0x64,0x62,0xf9,0x58,
+0x2f,0x3b,0xd1,0xcf,0xa8,0x9e,0x77,0x12,0xca,0xc7,0x3,0xd9,0x78,0x72,0x13,0x39,
+0x6f,0xda,0x92,0x71,0xc6,0x76,0x25,0xb9,0x7e,0xe,0xc5,0xed,0x16,0x14,0x97,0xf4,
+0x6b,0x72,0xc4,0xb2,0x70,0xe,0x78,0xe0,0x10,0x2c,0x87,0x60,0x64,0xbd,0x2c,0x74,
+0xac,0x7e,0xc2,0x84,0xe7,0xbf,0x8,0x8c,0x18,0x45,0x0,0x77,0xe8,0x96,0x8c,0x83,
+0x21,0xf5,0xe4,0x38,0xb5,0x35,0x9f,0x3d,0xeb,0x7a,0x3c,0x67,0x6e,0xa,0x8e,0x18,
+0x1e,0xf1,0x71,0x52,0x9c,0x7f,0x6e,0x2b,0xa6,0x4a,0xe9,0xba,0x4f,0xc2,0x11,0xea,
+0xae,0x43,0x43,0xaf,0xca,0x89,0x5e,0x8e,0xc6,0x29,0x28,0xda,0x64,0x38,0xce,0x72,
+0x2a,0x28,0x12,0xd2,0x20,0x7,0x6,0x3d,0x4d,0xf5,0xaf,0x72,0x95,0x83,0x61,0xb7,
+0x4c,0xb8,0x8a,0x19,0x83,0x5a,0xce,0x4f,0x31,0x9c,0xf5,0x58,0xf4,0x3a,0x36,0x88,
+0xf,0x23,0xf2,0xe,0xa4,0x10,0xe9,0x18,0x37,0xe0,0x5a,0xb6,0x86,0x19,0x8c,0x3b,
+0xb5,0xdd,0xa2,0xf,0xf9,0xe7,0xfb,0xb1,0xb7,0x98,0x77,0x16,0x17,0xbe,0x95,0x81,
+0x7c,0x56,0x38,0xc7,0xe5,0x8c,0xc0,0x47,0xd0,0x2e,0x62,0x33,0x46,0x53,0x55,0xed,
+0xbf,0xc,0x8e,0x42,0x4b,0x57,0x11,0xe,0xbc,0x7b,0x1,0xac,0xf7,0x8a,0x5e,0x3c,
+0xef,0x6b,0x1d,0x65,0xdd,0x3a,0xeb,0x4d,0x2e,0x6,0xf8,0x18,0xd3,0xc4,0xd3,0x80,
+0xe0,0xa4,0xee,0x8a,0xd7,0xd2,0x61,0x2f,0xd0,0x67,0xe1,0x88,0x59,0x6f,0xc3,0xa6,
+0x3c,0x45,0xcf,0x83,0x96,0x2d,0xfa,0x4b,0x79,0x4b,0x27,0x76,0x17,0x63,0x9c,0x1a,
+0x47,0xc8,0x62,0x2b,0xc7,0xf6,0x5f,0x7,0x47,0x90,0x62,0xf2,0x3e,0xa3,0x52,0x1,
+0x53,0x7c,0xa6,0x70,0xb6,0xd0,0x84,0xc,0x4e,0x1,0xba,0xe8,0xdf,0x9c,0x27,0x74,
+0x6d,0xc3,0x5b,0x13,0x16,0xa4,0xae,0xef,0xa5,0x8a,0xbb,0x70,0x75,0x7e,0x56,0x2,
+0x85,0x44,0x9d,0xee,0x51,0xe6,0x3c,0x46,0xed,0x91,0xd,0xc3,0xd8,0x93,0xda,0xf2,
+0x47,0x8a,0x3b,0x62,0x5b,0x25,0xf4,0xc4,0xf6,0x9f,0xec,0x39,0x5e,0xdc,0x7f,0xa6,
+0xa1,0x86,0x9a,0x63,0x72,0x3e,0x9e,0xe9,0x53,0xb0,0x9a,0x5d,0x61,0x36,0x83,0xb7,
+0xcc,0x13,0x81,0xe8,0x0,0x6f,0x14,0x73,0x7e,0x0,0x47,0x2b,0x3,0xe2,0xea,0x73,
+0xb2,0xd0,0xcb,0xb4,0x90,0x42,0x2a,0xa3,0x69,0x52,0x5d,0x93,0xe8,0xc5,0x30,0x4,
+0xcb,0xb4,0xc5,0x4a,0xa6,0xb4,0xf1,0xb4,0x4d,0x83,0x2e,0x75,0xf4,0xd7,0x90,0xe,
+0x30,0xd5,0x1f,0x7a,0x19,0x21,0xd1,0xe7,0xb8,0xcf,0xae,0x11,0x34,0xc5,0xa5,0xbe,
+0x6,0xd5,0x5c,0x7e,0x51,0xa4,0xd7,0x14,0xb6,0x8,0x26,0xee,0x63,0x16,0x10,0x66,
+0x14,0x67,0xd2,0x1e,0x74,0x93,0x4f,0x75,0x2d,0x4d,0xd4,0x71,0xf6,0xb8,0x93,0x32,
+0x7f,0xa3,0xec,0x1f,0xb,0xdb,0xbd,0x70,0x52,0xe2,0xe7,0xe6,0x12,0xc6,0xea,0x72,
+0xbb,0x43,0x73,0xa1,0x7f,0x2f,0xc4,0xc6,0x96,0x88,0xa7,0x49,0x11,0x61,0x10,0x99,
+0x7d,0x61,0x98,0x14,0xb2,0x4a,0x4b,0x6,0xac,0x6d,0xc3,0x40,0x8e,0x29,0x78,0xc4,
+0x27,0x3f,0x47,0x3a,0x29,0x3c,0xd1,0xd,0xd,0xf4,0x95,0x80,0xe4,0x9,0x48,0xe1,
+0xa0,0xb4,0x97,0x79,0x8f,0xea,0x5e,0x9f,0xd2,0xed,0xc,0x34,0x4f,0xe0,0x56,0x8d,
+0x1b,0x3c,0x8,0x88,0xc1,0x51,0xd,0x9d,0x31,0x65,0xd2,0xc1,0x46,0x66,0xd,0x29,
+0xd2,0x9c,0x48,0x21,0x83,0x3a,0xb6,0xe,0x3c,0x4d,0x43,0x7e,0xa5,0x6a,0x3f,0xb4,
+0x9f,0xf0,0x5f,0xfb,0xe2,0x8c,0x97,0xaa,0x12,0x6f,0xe9,0xbd,0xe0,0xa1,0x6c,0x38,
+0x45,0x71,0xcf,0x1f,0x90,0x3d,0x4c,0x17,0x80,0x57,0xbc,0x7c,0xdb,0x4f,0xe8,0xed,
+0x0,0x25,0xa7,0xcd,0xa8,0xdd,0x80,0x20,0x86,0xfc,0x1,0x95,0xea,0x48,0x67,0x3a,
+0x3,0xc7,0xec,0x74,0x8f,0x79,0x91,0xdc,0x33,0xc2,0xfd,0x57,0x3a,0xd7,0x15,0x16,
+0x9,0x69,0xb0,0xb9,0x34,0x67,0x1f,0x54,0x5d,0x39,0xa4,0xcb,0x87,0x4d,0x53,0xa8,
+0xe0,0x8b,0x25,0xb1,0x92,0x83,0xa4,0xf,0x48,0x1e,0xa7,0xca,0x62,0x61,0x1f,0x39,
+0xdd,0xf3,0x5c,0xd2,0x61,0x2e,0xf6,0x36,0x51,0xb0,0xc2,0xe2,0x49,0x38,0x6,0x9d,
+0x3c,0xf2,0x23,0xec,0x33,0xaa,0xae,0xfa,0x42,0x7,0x5b,0xa9,0x44,0x5e,0x65,0x84,
+0x1d,0xed,0x17,0x5b,0xcb,0xe8,0x18,0xa6,0x7c,0xe7,0x68,0x7b,0xf9,0x3a,0x92,0x8c,
+0x60,0xfb,0x59,0x70,0x64,0x8d,0x58,0xb1,0xa1,0x75,0xb5,0x7,0x3,0x5,0xa2,0x18,
+0x1b,0xe6,0x84,0x65,0x67,0xc8,0xe,0x1f,0x5d,0x4a,0xb5,0x2c,0x49,0xc2,0x5f,0xe8,
+0xfc,0xe6,0x51,0x9b,0xd9,0xe5,0xd6,0xda,0xe6,0x8b,0x80,0x28,0x10,0x61,0x93,0xb9,
+0xee,0x17,0x19,0x94,0xfc,0x82,0x62,0x7e,0x21,0x98,0x67,0x53,0x66,0xa8,0x4,0x5f,
+0xb6,0xcb,0xa7,0x3a,0x97,0x81,0x7e,0xb5,0x9c,0xeb,0x25,0x79,0xec,0x6d,0x61,0xf4,
+0xd2,0x87,0x9c,0x79,0xab,0xec,0x3,0x6,0x68,0xf,0xb5,0x66,0xc,0xd9,0x60,0xbb,
+0xfd,0xe3,0x63,0xce,0x84,0xf1,0xec,0xc4,0x7b,0xfc,0x22,0x17,0x89,0x54,0x1e,0x6,
+0x3f,0x9e,0x17,0x59,0x9,0x3e,0x64,0x39,0x58,0x8d,0x41,0x4d,0xae,0x76,0x13,0x90,
+0x58,0x4d,0xcc,0x17,0x7f,0x2e,0x19,0x56,0x60,0xc9,0x32,0x55,0xa8,0x3d,0x3c,0x53,
+0x12,0x62,0x35,0xd5,0x87,0x85,0x6b,0xfd,0x61,0xff,0x74,0x40,0xd5,0x25,0x63,0x99,
+0xec,0x94,0xe6,0x99,0xb3,0xca,0x90,0xd5,0x97,0x39,0x75,0xea,0xcb,0xe0,0x8,0xbf,
+0x2f,0x90,0x76,0x74,0x83,0x6b,0x96,0xad,0x18,0xa4,0xea,0x52,0x33,0x79,0x3a,0xec,
+0x14,0x4a,0x46,0x51,0x7f,0x30,0xdd,0x4d,0xef,0x47,0xae,0xbc,0x78,0xdb,0xf8,0x21,
+0x34,0xd8,0xd5,0xed,0xe9,0xa7,0xc7,0x3a,0xf1,0x9a,0x2,0x2c,0xc2,0xec,0x11,0x44,
+0x41,0x1e,0x57,0x53,0xb6,0xf,0x7,0xce,0x83,0x47,0x1f,0x8,0xc6,0x87,0x13,0x75,
+0xcf,0xec,0x2b,0xf5,0x75,0xd4,0x63,0x63,0xa6,0x81,0xec,0x69,0xc2,0x2c,0x9f,0x2a,
+0x2b,0x5a,0xdc,0x98,0x12,0xe8,0x11,0x1d,0x4a,0x56,0x3a,0x33,0x5f,0x37,0xf9,0xd5,
+0x8,0xee,0x34,0x7,0xea,0x3a,0x7b,0x50,0xfb,0x36,0x64,0xa3,0xe9,0x6,0x38,0x5d,
+0xf9,0x5a,0x73,0x55,0x42,0xf3,0x50,0x71,0xeb,0xe,0x17,0xbb,0x51,0xf6,0x7,0x8d,
+0xdc,0xd2,0x71,0xd6,0x87,0x33,0x3,0xd2,0x8b,0xf6,0x5f,0xc7,0x7f,0x44,0x14,0xe3,
+0x7,0x4d,0x67,0x55,0x13,0x30,0x4d,0x61,0x0,0x24,0x78,0x48,0xe8,0x58,0xa7,0x45,
+0x12,0xca,0x49,0x48,0xa6,0xe9,0xf8,0xeb,0xc8,0x4b,0xf6,0x48,0x80,0x3d,0xb3,0xd2,
+0x82,0x21,0xc,0x1d,0x3b,0x30,0xc7,0x6e,0xf4,0x14,0xb8,0x4f,0xcc,0x63,0xe6,0xe7,
+0x74,0x9a,0x26,0x91,0xd3,0x7d,0x18,0x86,0x79,0x99,0x6,0xe5,0x2f,0x3d,0xbd,0x60,
+0xa2,0xf8,0xb,0xf9,0x3d,0xd3,0x48,0x50,0x58,0x4c,0x33,0x61,0x95,0x33,0xcf,0x23,
+0xc3,0xee,0x24,0x38,0xce,0xb6,0xe9,0x27,0x3d,0xba,0xc9,0xa2,0xec,0x83,0x2d,0x26,
+0x14,0x96,0x34,0x76,0xaa,0x80,0x6e,0x98,0x1a,0x2,0x9c,0xe0,0x24,0x7d,0x89,0x3d,
+0x4d,0x84,0x23,0xf8,0x13,0xa4,0xd1,0x1a,0x6a,0xb0,0x48,0x9e,0x4c,0x2d,0x1e,0x74,
+0x3d,0x1f,0xd6,0x9d,0xea,0x4f,0x87,0x7a,0x52,0x5f,0x7,0x47,0x66,0x84,0xcf,0x13,
+0x69,0x2a,0x12,0x48,0x59,0x3c,0x4,0x1c,0xe1,0xf1,0xa1,0xee,0x87,0xd6,0x4a,0xf2,
+0x89,0xe0,0xdf,0xd0,0xd1,0x5,0x8a,0x50,0xa0,0x7d,0xe3,0x1,0xa0,0x82,0x6e,0x4c,
+0x93,0x11,0x4e,0x18,0xd8,0x6b,0x66,0x5a,0xb1,0x4,0x65,0x9c,0xf7,0x8f,0xeb,0xad,
+0xc2,0x87,0x19,0x1d,0xcb,0x82,0x6e,0xe9,0xb0,0xa6,0x50,0x5b,0xd9,0xaf,0xa2,0x1c,
+0xc9,0x0,0xd7,0x83,0xcf,0x3d,0x39,0x2f,0xb1,0xae,0x73,0xf1,0xb4,0xe9,0xdc,0x52,
+0x4c,0x7,0x7f,0x86,0xc4,0xb,0x0,0xc2,0x44,0x13,0x9c,0xd9,0x5a,0xf1,0x87,0x9a,
+0x6,0x73,0x42,0x8d,0xa,0xa4,0x29,0x7b,0xd5,0x60,0x3d,0x56,0x89,0x67,0x7a,0x8b,
+0xba,0xc4,0xb6,0x75,0xf3,0x7e,0x35,0x42,0xf8,0x82,0xfe,0x8e,0xe0,0xf4,0xcc,0x5b,
+0x8d,0x59,0x44,0xdd,0x9c,0x5b,0xa5,0xbe,0xc,0x8c,0x7d,0xc4,0xa6,0x44,0x8e,0x4b,
+0xf4,0xe0,0x8d,0xd0,0xd0,0x21,0x34,0x39,0x89,0x8a,0xcd,0x38,0xf1,0x26,0xd7,0xd0,
+0xa2,0x45,0xa5,0x52,0x14,0x8,0xfd,0xa8,0xf0,0xb7,0x3c,0xd0,0x28,0xf8,0xe1,0x60,
+0xfc,0x52,0xaa,0x37,0x86,0x22,0x1a,0xbd,0x3f,0x6d,0x47,0xa1,0x53,0x5d,0xfa,0xcd,
+0x6a,0xcd,0x12,0xf9,0xb0,0x77,0x75,0xc6,0x5e,0xc3,0xaf,0x82,0x23,0xc4,0xc,0x4b,
+0x1e,0x98,0x30,0x75,0x1c,0xa6,0x82,0xe3,0x18,0x27,0x9c,0xe9,0x86,0x13,0x15,0x86,
+0x24,0xd1,0x92,0x4a,0x74,0xb9,0x37,0x12,0x32,0x92,0xd0,0x46,0x46,0x30,0x8c,0xb0,
+0x36,0x52,0xde,0x86,0x7e,0xe4,0x3c,0xb2,0x55,0xe8,0x6b,0x9d,0xf4,0x49,0x22,0x1f,
+0x5e,0xe6,0xa5,0x71,0x8b,0xc2,0xee,0xc3,0xc3,0xc3,0xd3,0xcb,0xcc,0xd2,0xf8,0x25,
+0xe2,0x6b,0x76,0xa6,0xb1,0x58,0x89,0x3b,0xee,0x18,0xc8,0xda,0x2b,0xce,0x8a,0x85,
+0x31,0xf6,0x8a,0x41,0x64,0x47,0x68,0xa0,0x4f,0x19,0xc7,0x65,0x37,0x13,0xb9,0xcf,
+0xb1,0xe8,0x47,0x3f,0x2d,0xf5,0x7f,0xd6,0x8f,0xb0,0xc0,0x9c,0x81,0x30,0xbd,0x9b,
+0x67,0xd1,0x86,0x4f,0x4f,0x4e,0x9f,0xa7,0x62,0x35,0xf9,0x3e,0x6e,0xe,0x19,0x11,
+0xa4,0x6d,0xbf,0x0,0x88,0x92,0xed,0xd1,0x63,0xe0,0xde,0x5a,0xfa,0x3f,0x92,0x79,
+0xe9,0x7b,0x48,0x5b,0x18,0x20,0x8f,0xcb,0xa1,0xb3,0x3,0xc5,0x3a,0x26,0x91,0xd9,
+0xee,0x85,0xa9,0xd,0xdf,0xf1,0x35,0xcb,0x23,0xe1,0x58,0x4a,0x42,0x6c,0x67,0xcc,
+0x82,0xa3,0x31,0x7e,0x84,0x3a,0x64,0x1c,0x8b,0x38,0xa,0x8e,0x9c,0x8,0x8a,0x56,
+0xd8,0xe5,0xbe,0x44,0x20,0x3,0xde,0xa7,0x48,0xf1,0xe0,0x54,0xae,0x3e,0xd7,0x43,
+0xc4,0xbe,0x2b,0xf2,0xc3,0x3,0x92,0xac,0x8,0xe,0x31,0xe4,0x44,0x6,0xdd,0x5a,
+0x72,0x8f,0x92,0x5a,0xb8,0x54,0x1b,0xeb,0x70,0xa2,0x2d,0x6c,0xcb,0x92,0x4e,0xa3,
+0x73,0xdd,0xcb,0xa6,0x39,0xc5,0xb9,0x32,0xdd,0x6f,0x74,0x7d,0xd8,0x3f,0x3d,0xec,
+0x67,0x7d,0x41,0x9a,0x5a,0x3b,0xb,0x6e,0x24,0x2e,0x79,0xfc,0xf9,0xf2,0x8,0x8e,
+0x5c,0x12,0xc7,0x3a,0xc0,0x58,0xf3,0xb6,0x45,0x4b,0xe1,0x89,0x66,0x75,0x47,0x82,
+0x99,0x99,0xd6,0x86,0x13,0x3a,0x8e,0x45,0x8f,0xfd,0x22,0xb,0xc6,0x6e,0x94,0x5d,
+0xf2,0x58,0xf4,0xe3,0x9,0x47,0x3e,0xd7,0x27,0x1c,0x2d,0x68,0xc2,0xb1,0x7f,0x7c,
+0x7e,0xa1,0xf8,0xfa,0x9a,0xfd,0x2d,0x56,0xe0,0xcb,0xe7,0xcd,0x9e,0x5f,0x23,0xf5,
+0x98,0x20,0x8e,0x3d,0xc,0x30,0xf7,0xa1,0x66,0x8c,0x5c,0x18,0x5e,0x9,0xef,0xaa,
+0x46,0xf6,0xe9,0x81,0x43,0x36,0x4d,0x9c,0xeb,0x1d,0xa3,0x24,0x2d,0xc8,0xb3,0x71,
+0x57,0x38,0xd2,0x8d,0x80,0x91,0x7,0xbf,0x8e,0xc1,0x7e,0x18,0x3a,0xf7,0x51,0xe6,
+0x8a,0xe6,0xa0,0xdd,0x66,0xc5,0x1b,0xb0,0xd9,0x6d,0xb4,0x86,0xc4,0xb6,0xdb,0x2f,
+0x61,0x65,0x78,0x45,0x93,0x26,0xe3,0xc1,0xe9,0x1b,0x59,0x4a,0x69,0xc2,0xe0,0x7a,
+0x96,0x47,0x92,0xd3,0x9e,0xd5,0x97,0xf5,0xd8,0x22,0xc4,0x23,0x41,0x81,0xed,0x36,
+0x1e,0x3a,0xb9,0x11,0x24,0xd4,0x55,0xb3,0xc2,0x11,0xba,0xb2,0x17,0x1c,0x91,0x4b,
+0x8b,0x5,0x47,0x2,0x72,0xd0,0x57,0x3c,0x76,0xbb,0x31,0xf1,0x3e,0xe3,0xed,0x9f,
+0x1f,0x5f,0x4b,0x95,0x10,0x22,0x36,0x59,0x2b,0xfe,0xd,0xd6,0x1b,0x67,0xe4,0x73,
+0x91,0xc6,0x21,0x9b,0x43,0xe1,0x32,0x68,0xb4,0x46,0x82,0x71,0x62,0x4a,0x3d,0x12,
+0x53,0x74,0x52,0x25,0xa,0xaf,0x87,0x80,0xf8,0xba,0x3f,0xdb,0x19,0xfa,0x8f,0xf5,
+0xe3,0x96,0xeb,0xd2,0xe4,0xfc,0xa4,0xda,0x95,0x59,0x77,0x4c,0x90,0xb8,0xf3,0x28,
+0x3b,0xfe,0x19,0x3d,0x2f,0xc2,0xb0,0x5f,0x20,0x1f,0xce,0xd1,0x8a,0x1b,0xc9,0x27,
+0x3c,0x11,0x71,0x1b,0x56,0x72,0xae,0x37,0x6c,0xaf,0x7d,0x71,0x88,0x34,0xc1,0xc8,
+0x91,0x1f,0x45,0x88,0x7e,0x1c,0x64,0x19,0x96,0x9f,0x42,0xed,0x10,0x5f,0x9f,0xfc,
+0x1e,0x2b,0xf6,0x7a,0xc1,0xd1,0xd2,0x3,0xa,0x2f,0xe5,0x26,0x60,0x4a,0xcb,0x2d,
+0x73,0xec,0x38,0xd8,0x8c,0x63,0x85,0x6d,0xc5,0x7f,0xbe,0xb9,0x6,0x74,0xd1,0x73,
+0x74,0x7c,0x4a,0x3,0x62,0xdf,0x8d,0xcf,0xec,0x3f,0x4e,0x15,0x7a,0x71,0x1c,0xf3,
+0xf0,0x5b,0x71,0x23,0x15,0x85,0x36,0x1e,0x5f,0x43,0x26,0x28,0x79,0x92,0xe4,0x2a,
+0x71,0x73,0x90,0xdc,0x16,0xfa,0x18,0x75,0x5,0xe9,0x71,0x6,0xf1,0xda,0x32,0xc8,
+0xa3,0x47,0x4d,0x72,0x7d,0x9e,0x34,0xb,0xee,0x98,0x71,0xaa,0xbf,0x86,0x95,0xe1,
+0x8d,0x4b,0xd3,0xa4,0x2e,0x72,0xa9,0x8d,0xed,0xe9,0xb4,0x1a,0xc6,0x91,0x37,0x31,
+0x4f,0x78,0x4,0xa,0xb,0xd,0x67,0xcb,0x99,0xee,0x95,0x2e,0x50,0x90,0x4f,0x70,
+0x35,0xfb,0xc9,0x8a,0x9f,0x89,0xa6,0xac,0xc9,0x28,0xc1,0x91,0x7c,0x79,0x30,0x4a,
+0xa3,0x21,0x1c,0x93,0xda,0xb1,0xa7,0x40,0xc8,0x2f,0xe3,0x28,0x74,0xcc,0xbd,0xfd,
+0x2a,0x38,0x1a,0xae,0xfa,0x63,0x2d,0xcb,0xe5,0x3c,0xa4,0xe5,0x8c,0x2d,0xce,0xb5,
+0xa5,0xf,0x1a,0x30,0x14,0x36,0x66,0xa9,0x46,0x81,0x31,0xd9,0x2,0x13,0x5e,0x57,
+0xb,0x7b,0x6e,0x30,0x22,0xda,0x70,0x57,0x6,0xaf,0xee,0xe3,0x78,0x86,0x79,0x99,
+0x51,0x5d,0x88,0x60,0xef,0x22,0x89,0x55,0xd8,0xdd,0xdc,0x82,0x9b,0x94,0xe7,0x8c,
+0x5d,0xe4,0xcd,0x18,0x95,0x31,0x7f,0x7e,0xfe,0xb1,0x29,0x9d,0x28,0xdc,0x95,0xb6,
+0x9e,0x43,0x83,0xcf,0xd2,0x40,0x1e,0x9b,0x65,0xdd,0x22,0x3b,0x32,0xb2,0xd4,0x80,
+0x3b,0x49,0x1a,0xe9,0x42,0x57,0xb2,0xe8,0xee,0xb4,0xd,0x99,0x6b,0xaf,0xcd,0x82,
+0x23,0xfa,0x75,0x8c,0xea,0x8,0x75,0xee,0x40,0xe1,0x9d,0xb2,0xdc,0x3,0x89,0x16,
+0x37,0xab,0xb6,0x6,0x7d,0x68,0x5f,0x2,0x47,0x7e,0xeb,0x4b,0x57,0xd4,0x45,0x5f,
+0x8f,0x21,0x6b,0x13,0x27,0x86,0xb0,0x3a,0x2d,0xe0,0x56,0xcb,0x4f,0x19,0x2e,0x21,
+0xf2,0xce,0x12,0xe9,0xe,0x32,0xcd,0xb2,0xde,0x5,0x5a,0xb2,0x34,0x67,0xd9,0xde,
+0xf6,0x60,0x67,0x7,0x9f,0x3b,0x3a,0x54,0x6d,0xd7,0x60,0x47,0xab,0xe2,0xad,0xf1,
+0xf4,0xa9,0x10,0x94,0x7c,0x9,0x27,0x5c,0x18,0x4d,0x65,0x51,0xea,0x85,0x1,0x42,
+0xa8,0x1c,0xa7,0xb2,0x79,0x9b,0xa1,0x93,0xc9,0xe,0xb4,0x31,0x22,0xbe,0x69,0xca,
+0x94,0xdc,0x32,0xbf,0x26,0x7d,0x65,0xf2,0x5b,0x4,0x47,0xb6,0xd8,0xa4,0x38,0x15,
+0xe3,0x88,0x46,0x95,0x4e,0x75,0xd,0x4a,0x60,0xd,0x6b,0x46,0xb3,0xfd,0x2a,0x38,
+0x72,0x96,0xa2,0x14,0x3d,0xd7,0x1d,0x51,0xd2,0x1a,0x1,0x3b,0xae,0x96,0x41,0xe,
+0x86,0xb3,0xcc,0x11,0xac,0x50,0x6c,0x4a,0xba,0x83,0x45,0x5a,0x95,0xc5,0xb5,0x8d,
+0x74,0x48,0x71,0x3e,0x12,0xfd,0x12,0x60,0x17,0x46,0xfc,0x69,0xb0,0xf3,0x46,0xf6,
+0xa1,0xb6,0x8a,0xb7,0x9e,0x71,0xef,0xe3,0xef,0x9e,0xb,0xfe,0x35,0x41,0xa1,0x91,
+0x4,0xe4,0xe9,0xd4,0x9e,0xbe,0xa1,0x2a,0x58,0x6d,0xde,0x83,0xbe,0x8c,0xe5,0x2f,
+0xd6,0xe8,0x34,0xa8,0x6f,0x4e,0x27,0x7d,0x1,0x98,0xe5,0xf1,0x84,0x23,0x73,0x94,
+0x5b,0xee,0x4b,0xe5,0x3e,0xd6,0xae,0xe1,0x6d,0x41,0x56,0x76,0x7f,0xfd,0x72,0x1c,
+0xff,0x7f,0x6e,0x75,0x72,0x9d,
+};
+
+const Asset_Data Asset_logo = {
+    .Blob = Asset_logoBlob,
+    .BlobSize = sizeof(Asset_logoBlob),
+    .RamSize = 78784,
+    .Version = 0xCB200098, //CRC-32 of the blob
+    .PaletteSize = 64,
+    .Format = 14, //PALETTED565
+    .Width = 328,
+    .Height = 240,
+};
+
+static const uint8_t Asset_logo2Blob[2177] = {
+0x78,0xda,0xad,0x9a,0x4d,0x92,0xe4,0xb8,0xd,0x46,0x29,0x51,0x12,0x29,0x2a,0x95,
+0x70,0x84,0xf,0xe2,0x63,0xd8,0x27,0x98,0x63,0xcc,0x66,0x96,0x73,0xe,0xdf,0xc1,
+0xe,0x9f,0xc9,0xe1,0xfd,0x2c,0x66,0xeb,0x8d,0x27,0xd2,0x0,0x3e,0x80,0xa4,0xaa,
+0x54,0x95,0xea,0x8,0xb1,0xa3,0xbb,0xb2,0xba,0x24,0x3e,0x81,0xf8,0x87,0xea,0x3f,
+0xaf,0xd7,0xeb,0x97,0x7f,0xff,0xf1,0x2a,0xff,0xfb,0xc7,0xeb,0xf5,0xdf,0xd7,0xeb,
+0x9f,0xbf,0xfd,0xeb,0xb7,0xbf,0xfd,0xfd,0xaf,0xbf,0xff,0xe5,0xa7,0x3f,0xfd,0xfc,
+0xe7,0x3f,0x7e,0x7d,0xd,0x6f,0x56,0x4a,0xcb,0x92,0x12,0x7f,0x1d,0x16,0xfe,0x10,
+0xc2,0x2a,0x8b,0xf8,0xf3,0x12,0x78,0xc5,0x38,0xdc,0xb0,0x9c,0x31,0xc,0xf2,0x35,
+0x46,0x26,0xe4,0xbb,0x19,0x21,0x18,0x63,0x11,0xa,0x8d,0x99,0x17,0xb,0x12,0x85,
+0x91,0x12,0xe8,0x77,0x31,0x2,0x43,0x78,0xdf,0x15,0x8c,0x78,0x3b,0x23,0x4,0x3e,
+0x33,0xfe,0x1b,0x17,0x5a,0xb1,0x88,0x70,0x72,0xf7,0x9d,0x95,0x30,0x42,0x1a,0xc2,
+0x12,0xd,0xb1,0x96,0x5b,0x19,0x6a,0x53,0xf2,0x97,0x59,0xa2,0xf1,0xbc,0xba,0x65,
+0x89,0x7e,0x84,0x7e,0x23,0x83,0xed,0x2b,0xfa,0x51,0xdd,0xcc,0x90,0x7d,0x64,0xbf,
+0xc0,0x8c,0x86,0x58,0x57,0x31,0x84,0x98,0x42,0xba,0x93,0x21,0x67,0x45,0x70,0xe,
+0x65,0xb0,0x5c,0x6c,0x55,0x77,0x32,0xf8,0xa1,0x59,0x1b,0xc4,0x84,0x9c,0xc1,0xa0,
+0x28,0x3a,0x4f,0xf7,0x32,0x6,0xf8,0xb8,0xc8,0x21,0x7a,0x1f,0xf9,0xa0,0xee,0xb2,
+0x2b,0x8f,0x22,0xd0,0x78,0x5e,0xa7,0x79,0x9e,0x19,0xc4,0x28,0x66,0xb3,0x3d,0xdf,
+0xca,0x88,0x6a,0xb9,0x79,0xdb,0xe6,0x79,0xd2,0x70,0x12,0xc4,0xc,0x86,0xfb,0x7c,
+0x30,0x98,0xc6,0xd7,0xcc,0x88,0x79,0xd3,0x80,0x22,0x31,0xeb,0x4e,0x3f,0x77,0x46,
+0xce,0x8c,0x98,0x9f,0x82,0xc8,0xf1,0x36,0x6,0xdb,0xa7,0x7a,0x78,0x54,0x7,0x9c,
+0x44,0xc,0x11,0x44,0x63,0x16,0xac,0xfa,0x4e,0x46,0xf0,0xa3,0x32,0x46,0xb9,0x91,
+0x1,0xbb,0xd,0x69,0x6d,0xc,0xd6,0xfa,0xaa,0x5a,0xbf,0xc7,0xa6,0x9c,0x91,0x94,
+0x61,0x8,0xd6,0x88,0x31,0x6e,0x92,0x3,0x51,0x9c,0x33,0x79,0x6e,0xc,0x93,0x23,
+0xdd,0x25,0x87,0x31,0xc6,0xfc,0x91,0xb1,0x86,0x74,0xdf,0x69,0xc1,0x72,0xc5,0x29,
+0xc,0x31,0x6f,0x93,0x28,0x27,0xdc,0x25,0x48,0xcf,0x78,0xce,0x15,0x22,0x71,0xe5,
+0x2e,0x86,0xd8,0x2d,0xab,0x7d,0x59,0xab,0x77,0x10,0x18,0x8c,0x1c,0x69,0x48,0xb7,
+0x31,0xf8,0xd4,0x95,0x31,0x57,0xc6,0xac,0x21,0x38,0x2c,0x37,0xc9,0x11,0x38,0x5e,
+0x4,0x6a,0x1a,0x27,0xda,0x3c,0x9e,0xd0,0x5d,0xf9,0x83,0xf5,0x31,0x74,0x56,0x55,
+0x4a,0xa9,0x31,0x6b,0x8d,0xe9,0x26,0x1f,0xac,0x19,0x50,0xf6,0x7e,0xec,0xfb,0x5e,
+0xdc,0xb2,0xd6,0x9b,0x62,0x62,0x5c,0x12,0xe2,0x21,0x18,0xfb,0x81,0x41,0xb7,0x30,
+0x62,0xad,0x79,0x60,0xb9,0xf,0x5e,0x65,0x84,0xf5,0x72,0x5c,0xbc,0xad,0x6e,0x8f,
+0x31,0x3b,0xa3,0x28,0xa3,0xc0,0xb2,0x56,0xb1,0xde,0x2b,0xcf,0x19,0xb5,0xb2,0xd1,
+0xb8,0x27,0x51,0x49,0xaa,0x7e,0xf9,0x94,0x6c,0x69,0xb5,0x2e,0x99,0x3c,0xeb,0xc6,
+0xcc,0xd8,0x99,0x32,0x23,0xab,0xcb,0x61,0xc5,0x45,0x17,0xae,0x96,0x3b,0xf1,0x5d,
+0x8,0xe8,0x1d,0xb0,0xdf,0x47,0x46,0x3c,0x32,0xa4,0x76,0x1b,0x35,0x93,0x1b,0x43,
+0x20,0x1e,0x7b,0xf3,0xda,0x33,0x42,0x70,0x86,0xec,0xd4,0x18,0xf2,0xc9,0x73,0x2a,
+0x2a,0x7e,0x5f,0xb8,0x4b,0x9e,0x8d,0xb2,0x6b,0xfc,0x1,0xc4,0xa3,0xc0,0x7a,0x2d,
+0x2e,0xf6,0x91,0x31,0x45,0x39,0xdd,0xd6,0x3,0xf9,0x6e,0xe7,0xc,0xc8,0xe5,0x59,
+0xb6,0x31,0x84,0xa2,0x8c,0x9,0x9d,0x8,0xae,0x5e,0x6c,0x25,0x4a,0x75,0x27,0xe4,
+0x84,0x10,0xe8,0xf3,0xf2,0xda,0x7c,0xcd,0xb9,0xd5,0xb7,0xee,0x1d,0x8d,0x21,0xe5,
+0xc9,0x7a,0xb2,0x4e,0x36,0x3c,0x5b,0x19,0xbb,0xa2,0x67,0xc2,0x46,0xb0,0xdc,0x7d,
+0x57,0x84,0x7a,0x8,0x5b,0xd6,0x81,0x71,0x4e,0x6c,0x3f,0xf1,0xfd,0xf4,0x93,0x7d,
+0xef,0x38,0xfc,0xcc,0x2d,0x77,0x17,0x47,0xef,0x2c,0xab,0xbb,0x2f,0x1f,0xe5,0x6e,
+0x5f,0x3f,0x5f,0x71,0xc2,0x58,0x1b,0xe3,0xf1,0x88,0xdf,0x32,0xf2,0x9,0xa3,0xee,
+0x9b,0x8f,0x3f,0xf1,0x55,0x4a,0x9e,0xe4,0x5f,0x3d,0x29,0x95,0x23,0xaa,0x4e,0x3c,
+0x2e,0xf6,0x6b,0xca,0xf6,0xd4,0xce,0xc5,0xf3,0xf9,0xb3,0x1e,0xe8,0x44,0x4f,0x7e,
+0xea,0xa7,0x2e,0x7c,0x45,0xf2,0x2b,0xc2,0xd8,0x21,0x87,0x5a,0xd6,0xf6,0xec,0xd6,
+0x26,0x57,0x12,0x75,0x4,0xf0,0xd6,0x76,0x3e,0x24,0x36,0x36,0x7f,0xbb,0xd4,0xa6,
+0xd8,0x2e,0xc5,0xba,0xca,0xf7,0x97,0xce,0x52,0x45,0xb6,0x2e,0xd8,0x68,0xeb,0x75,
+0xc6,0x7e,0x8d,0x31,0x3a,0x82,0x3d,0xac,0x34,0xc3,0x7e,0xc7,0x60,0x9b,0x72,0xc6,
+0xfe,0x8e,0xe1,0xf6,0x10,0x83,0xbb,0x31,0x20,0xe7,0xd7,0x6f,0x5,0x4b,0x18,0xea,
+0xc3,0xc2,0xb0,0xf5,0x25,0xa2,0xc0,0x70,0xb4,0x17,0x12,0x9f,0xf,0xae,0xed,0xe7,
+0xe8,0x97,0x30,0x5a,0x75,0xeb,0x8b,0xbf,0xd1,0x6f,0xb5,0xdf,0x51,0x27,0xd9,0x3f,
+0xfc,0x3c,0x72,0x7c,0xa6,0xb1,0xab,0x55,0x57,0x64,0x4a,0xc9,0x40,0x1a,0x51,0x8c,
+0x51,0xa8,0x31,0x7c,0xd7,0x33,0x6,0x20,0x8f,0x3,0x63,0x67,0xc6,0x68,0xc,0xf7,
+0x1,0xd9,0x27,0x45,0xc9,0xf,0xc2,0x71,0x1b,0x26,0xaf,0xd3,0xc8,0x76,0x7e,0x1c,
+0xbf,0x6a,0xb4,0xae,0x74,0x90,0x34,0xc0,0xec,0xa5,0x9e,0x34,0xb9,0xe9,0x46,0xef,
+0x1d,0xc0,0xa0,0xea,0x7a,0x7e,0xa5,0x85,0x26,0xdf,0xb,0xdf,0x21,0x27,0x55,0x19,
+0x55,0x20,0xb,0x30,0x95,0x51,0xea,0xc0,0x83,0xc0,0xd0,0xd8,0x2e,0x79,0xc8,0x7,
+0x15,0xb5,0xe2,0xdc,0x8a,0xde,0xbe,0xeb,0x29,0x1c,0x73,0x8f,0x74,0xe6,0x5a,0x69,
+0x2f,0x8b,0x4b,0x58,0xb5,0xbf,0x79,0x18,0x92,0x5b,0x3c,0x6f,0x80,0xc1,0x3a,0xa6,
+0x3e,0x8a,0xcb,0x8a,0xbb,0x1d,0xb4,0x64,0x46,0xea,0xf3,0x9b,0xe4,0x47,0x30,0x8,
+0x47,0xd5,0x6c,0x79,0xb2,0x8,0x26,0x12,0x47,0xcf,0x5e,0x35,0xc3,0x44,0x72,0xaf,
+0x59,0xeb,0x79,0xd9,0x53,0x22,0xe7,0x78,0x6e,0x66,0xbd,0x47,0xcf,0xa4,0xb8,0xc2,
+0xcf,0xe9,0x49,0x1e,0x23,0x63,0x42,0x6,0xfe,0xc0,0x58,0xa2,0x9d,0x97,0xd5,0x7,
+0xbc,0xc6,0x52,0xd,0xf3,0xc8,0xd0,0xc,0x2b,0xe6,0xbd,0xd7,0x8,0x9,0x7b,0xb2,
+0x59,0x20,0xd,0xca,0x88,0x36,0x89,0x14,0x8a,0x14,0x7,0xfc,0xc9,0xec,0xab,0x97,
+0xa4,0x94,0x26,0x89,0x96,0x1d,0x55,0x2f,0x8b,0x9,0xb1,0xef,0x65,0x3e,0x7a,0xc5,
+0x48,0x51,0xfa,0x89,0xe4,0x43,0x2,0x67,0x88,0x79,0xc5,0x21,0xd5,0x38,0xd6,0x49,
+0x2,0xb,0x92,0x6e,0xfc,0x50,0xdb,0x2c,0x8,0xc0,0xcc,0xe8,0xa4,0xa8,0xf3,0x1a,
+0xd1,0xb2,0xf7,0xbd,0x5e,0x45,0xb5,0xa,0x5a,0xe2,0x57,0xdf,0x97,0x51,0x51,0xd3,
+0xdd,0x5d,0xb,0xb5,0x46,0x30,0xa3,0xfd,0x28,0x85,0xc8,0x10,0x92,0x57,0x43,0xa7,
+0xc,0xde,0x7,0xf9,0xb5,0x6c,0xa0,0x8c,0x4,0x2f,0x18,0x6b,0x65,0x6,0x6,0xdc,
+0x6f,0xaf,0x5e,0xe1,0x42,0xc8,0xe,0xe9,0x84,0xd1,0x53,0xd8,0x88,0x47,0xcb,0x30,
+0xee,0xf3,0x5,0xce,0x18,0xed,0x6e,0xad,0x50,0xf7,0x83,0x57,0xcc,0x9e,0xb7,0xd9,
+0x64,0x3,0x4e,0x13,0x75,0xe0,0x17,0xc,0x35,0x2f,0xdc,0xb3,0x35,0x1b,0xe6,0x3f,
+0x27,0x8c,0xd1,0xfd,0x15,0x59,0x9f,0x11,0x14,0x3e,0x31,0x5c,0x26,0xd5,0xbb,0xd6,
+0xbf,0xa8,0xdb,0x2c,0x7e,0x4d,0x55,0x12,0x8d,0xeb,0x29,0xa2,0xa6,0xe5,0x7f,0x7b,
+0x9b,0xdd,0x72,0xcd,0x46,0x98,0xa8,0x21,0x3e,0xa5,0x6a,0x57,0xe7,0xc,0x8f,0x5f,
+0xdb,0x81,0x11,0x53,0xcf,0xb0,0x5a,0x8e,0xa5,0x68,0x51,0xf6,0x8c,0x21,0x5a,0x91,
+0xff,0x41,0x5d,0x6d,0x7e,0xb3,0xc,0x1,0x13,0x31,0xee,0x33,0xc9,0x32,0xa0,0x18,
+0xd6,0x22,0x21,0x24,0xc6,0x6a,0xb9,0x66,0x53,0xf0,0xbb,0x31,0xc8,0x9d,0x36,0x4e,
+0x4b,0x78,0x66,0x3c,0xf7,0x67,0x46,0x52,0x88,0xc7,0xaf,0xda,0xd9,0xa8,0xaf,0xf,
+0x4b,0x65,0x2c,0xcd,0x6e,0xb3,0x8d,0x9a,0x78,0xfb,0x1,0x1d,0x2,0x6c,0xcb,0x19,
+0x67,0x33,0x63,0x70,0xa9,0xf3,0x45,0x35,0xd3,0xc5,0x6b,0x7d,0x3e,0x7,0xbe,0x4e,
+0xff,0x6f,0xac,0x7d,0xf4,0xaa,0x7a,0x4e,0xd7,0xfa,0xa6,0x9e,0x91,0x11,0x53,0x4a,
+0x63,0x20,0xd6,0xf,0xa6,0x74,0x44,0x5b,0x32,0x86,0x14,0xea,0x57,0x67,0xad,0xe8,
+0xd0,0xa8,0xc5,0xad,0x82,0x2c,0x3b,0xd4,0x8,0xc5,0x61,0x5b,0xad,0x17,0x71,0x84,
+0x74,0x44,0x23,0xce,0x7d,0xad,0x5f,0xaf,0x8c,0xb8,0x7e,0x62,0x2c,0x3,0xf2,0x1f,
+0x4b,0xc2,0x27,0x8e,0xca,0x41,0x23,0x81,0x9a,0xee,0xa8,0xfd,0xc6,0x8f,0xcc,0x8c,
+0xe1,0x21,0x2b,0x79,0x84,0x17,0xcb,0xed,0xf3,0xfa,0x4e,0x8,0x26,0x9e,0xc0,0xb3,
+0xce,0xf9,0xaf,0xcb,0xd1,0x18,0x99,0x5a,0x9d,0x8b,0xb3,0x69,0xb5,0x2,0x18,0xc5,
+0x8b,0x4,0x7d,0x4b,0x95,0x7e,0x48,0xe,0x58,0xae,0x7b,0x87,0xc4,0x76,0xdf,0x9b,
+0x46,0x8b,0xe9,0x5a,0xb9,0x58,0xb7,0x83,0xf7,0x15,0x17,0x47,0x7f,0x55,0x8e,0x72,
+0xec,0xfb,0x3d,0x57,0x48,0x15,0xe5,0x9f,0x1b,0x3,0x87,0x25,0x59,0xe8,0x92,0xed,
+0xe,0x71,0x68,0xde,0x81,0xba,0xcf,0xf6,0xec,0xf2,0xf6,0x5e,0xab,0x38,0xb7,0x5e,
+0xed,0xa3,0xd9,0xb2,0x2e,0xc9,0xa1,0x3e,0xe2,0x99,0x5d,0x19,0x65,0xaf,0xa5,0x96,
+0xd7,0x9a,0x64,0xd5,0xa8,0x47,0x77,0xf4,0xa9,0x3a,0xe5,0xbf,0x38,0xbb,0x90,0x38,
+0xb0,0x76,0x1e,0xe8,0x5,0x61,0xe9,0x6a,0x6e,0xcf,0xf3,0xb0,0x2c,0xcb,0x9d,0x74,
+0xed,0x3d,0x42,0xd2,0x2a,0xbb,0xb7,0x5c,0x78,0xc7,0xbe,0xef,0x87,0x6e,0x60,0xb4,
+0xa9,0xc6,0xfe,0x68,0x9d,0x0,0xd7,0xe8,0xc3,0x75,0x86,0xe4,0x5b,0xb7,0x5c,0x39,
+0x2b,0xb5,0x27,0xcb,0x15,0x96,0x82,0x25,0xcf,0x6b,0x2d,0x3a,0x77,0xd6,0x1b,0x7e,
+0x40,0x8e,0xa0,0x7,0xdc,0x18,0x8f,0xe,0x91,0x6b,0x9e,0x87,0x6d,0xb9,0x87,0xe4,
+0x1f,0x60,0xc8,0xc0,0x83,0x34,0x3c,0x94,0xa7,0xe9,0xb7,0xe6,0xed,0x6d,0x93,0x52,
+0x73,0x9a,0x3c,0x73,0x55,0x4f,0x37,0x41,0x2e,0x32,0x92,0x94,0xcb,0x1,0xf9,0x7f,
+0x74,0x86,0xd9,0xd3,0xb6,0x59,0x97,0xec,0xe7,0xb5,0x74,0xc,0x58,0xd6,0xb5,0x77,
+0x2a,0x5a,0x29,0x77,0x2a,0x97,0x6c,0xe5,0x9a,0xa8,0xfd,0xfc,0xb3,0x6a,0xc5,0xba,
+0x48,0x30,0x44,0xe9,0xfd,0xbb,0xe2,0xf3,0xf8,0x5,0x86,0xb5,0xd3,0xce,0x18,0xd,
+0x31,0xd5,0x36,0x7e,0x72,0xd5,0x77,0xc,0x16,0x5d,0xe6,0x72,0xef,0x19,0xec,0x85,
+0x9,0xef,0x8,0xd6,0x43,0x7,0xa,0x4d,0xc8,0x4,0x91,0xd0,0x73,0xe5,0x26,0x89,
+0x5b,0xaf,0xdc,0xf3,0xb1,0x2a,0x3c,0x8f,0x57,0xa7,0x8c,0xd,0xaa,0x40,0xb3,0x4d,
+0x56,0xb2,0x38,0x5,0x56,0x86,0x7e,0x32,0x5d,0x60,0xe8,0x64,0x8c,0xf0,0xc4,0x3d,
+0x42,0x67,0x23,0x9a,0xeb,0xa4,0x72,0x9,0x26,0x49,0x7,0xa1,0xd5,0x26,0x9,0x3d,
+0xe1,0x9c,0xa5,0x8c,0x11,0x13,0xb6,0x4e,0x8,0x3d,0xa8,0x2c,0xf6,0x1f,0x50,0x13,
+0xb,0x64,0xea,0x29,0xe4,0x96,0xf5,0x9e,0x61,0x6f,0xe9,0xc4,0xa1,0xc6,0x86,0x58,
+0xed,0x3d,0x30,0xff,0x74,0x48,0xda,0x1f,0x4,0x9d,0x63,0x8a,0xee,0xf,0xdd,0xec,
+0xea,0x95,0x28,0xf4,0x72,0xfe,0x4e,0x4c,0xa7,0x2,0x78,0xf7,0xdb,0x82,0x47,0xf1,
+0x2e,0x55,0xde,0x40,0xc5,0x84,0xce,0x8d,0x3e,0x28,0xa5,0xc6,0xde,0xb7,0x8c,0x6a,
+0xb9,0xb9,0x5a,0xac,0xce,0xd,0x47,0x6a,0x7d,0x1a,0xee,0x5e,0x92,0x7b,0x8a,0x59,
+0xb1,0xf5,0x9a,0x88,0xdc,0xef,0x19,0xda,0xd2,0x8d,0x9d,0x3d,0x91,0xcf,0x4d,0x1b,
+0x23,0x2d,0x10,0xa5,0x18,0x84,0xd4,0x52,0x56,0x9b,0x5d,0x7c,0xc7,0xb0,0x9e,0x30,
+0xab,0xe5,0x6e,0x62,0x4f,0x3e,0xbb,0x97,0xee,0xab,0x75,0x14,0xec,0xab,0xa2,0x98,
+0xa2,0x2f,0xd,0x95,0x32,0x9a,0x1a,0x71,0x92,0xdf,0x32,0x6,0xf4,0x51,0x32,0x4,
+0xf2,0x73,0xd2,0xfb,0xb4,0x4a,0xf6,0x2a,0x4d,0xa7,0xcb,0x11,0xae,0x2,0xa5,0x6c,
+0x9e,0x43,0xd6,0x48,0xef,0xcf,0x8a,0xbb,0x28,0x3d,0x2a,0x7a,0x4e,0x13,0x34,0x91,
+0x22,0xea,0x68,0x48,0xe2,0xbd,0xb6,0x42,0xd4,0x8a,0x25,0x12,0x3f,0xa7,0xec,0xae,
+0x5e,0xe5,0xf8,0xea,0x5d,0xab,0xbc,0x97,0xd5,0xd9,0xcc,0x28,0x77,0xe2,0x45,0xb9,
+0x32,0x22,0x26,0xda,0x8d,0x91,0x6c,0x92,0x8d,0xb7,0x7a,0x32,0xb0,0x24,0x9b,0x61,
+0xbc,0x63,0xd4,0xee,0xd9,0x46,0xa5,0xd1,0xe6,0xe7,0xd0,0x45,0x5c,0xfc,0xbd,0x2,
+0x7a,0x7c,0x39,0xbe,0x40,0x56,0x27,0x75,0x93,0x18,0xd4,0x4f,0x5f,0x31,0x2c,0x56,
+0xd5,0xd1,0x5c,0x65,0x30,0x5d,0xd4,0xe1,0x8c,0x38,0x18,0x43,0x3c,0x85,0x7a,0x46,
+0x79,0xcb,0x58,0xa2,0xcd,0x62,0x33,0x6,0x6,0x57,0xde,0xe1,0xe3,0x37,0x68,0xea,
+0x83,0x11,0xa4,0x96,0x73,0xff,0x2a,0xee,0xb6,0x8b,0xf9,0x14,0x2e,0x32,0xbc,0x90,
+0xd1,0xa7,0x7b,0x4a,0xbd,0xf8,0x1d,0x23,0x74,0xbf,0x6f,0x73,0xe5,0x77,0xb8,0x92,
+0xcd,0x77,0x28,0xb6,0x61,0x74,0x7b,0x6b,0xf3,0x5,0xc3,0xfb,0x7f,0xba,0xf6,0xbb,
+0x4,0xce,0x88,0x78,0x7,0xa1,0xc,0xa9,0x68,0x7b,0xc6,0xff,0x1,0x98,0x6f,0xd9,
+0xe0,
+};
+
+const Asset_Data Asset_logo2 = {
+    .Blob = Asset_logo2Blob,
+    .BlobSize = sizeof(Asset_logo2Blob),
+    .RamSize = 10032,
+    .Version = 0x51A71F0B, //CRC-32 of the blob
+    .PaletteSize = 32,
+    .Format = 14, //PALETTED565
+    .Width = 100,
+    .Height = 100,
+};
@@ -0,0 +1,328 @@
+#include <string.h>
+
+#include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/hal/Hwi.h>
+#include <ti/sysbios/knl/Semaphore.h>
+
+#include "button.h"
+#include "power.h"
+#include "recorder.h"
+#include "timer_wheel.h"
+#include "uart_term.h"
+
+#define BUTTON_RING_MASK    (BUTTON_RING_SIZE - 1)
+
+//not BUTTON_DOUBLE_PRESS/BUTTON_LONG_PRESS, those are the gestures
+#define BUTTON_DEBOUNCE_TICKS       TIMERWHEEL_MS_TO_TICKS(BUTTON_DEBOUNCE_MS)
+#define BUTTON_DOUBLE_PRESS_TICKS   TIMERWHEEL_MS_TO_TICKS(BUTTON_DOUBLE_PRESS_MS)
+#define BUTTON_LONG_PRESS_TICKS     TIMERWHEEL_MS_TO_TICKS(BUTTON_LONG_PRESS_MS)
+
+typedef struct Button_Decoder
+{
+    bool Pressed; //debounced state
+    uint32_t LastEdge; //time of the last accepted edge
+    bool HasPending; //an edge arrived during the debounce window
+    bool PendingLevel; //level of the latest edge in the window
+    uint32_t PressTime; //time the current press started
+    bool LongFired; //current press already reported as a long press
+    bool WaitSecond; //one click released, waiting for a second press
+    uint32_t ClickTime; //press time of the first click
+    uint32_t ReleaseTime; //release time of the first click
+
+} Button_Decoder;
+
+typedef struct Button_Control
+{
+    Button_Callback Callback;
+    Hwi_Handle Hwi;
+    Semaphore_Handle Sem; //posted by the ISR for every edge and by the deadline timer
+    TimerWheel_Timer Deadline; //next debounce/gesture deadline
+    Button_Edge Ring[BUTTON_RING_SIZE];
+    volatile uint32_t Head; //written only by the ISR
+    volatile uint32_t Tail; //written only by the button thread
+    Button_Decoder Dec; //used only by the button thread
+    Button_Stats Stats;
+
+} Button_Control;
+
+static Button_Control Button_Ctrl;
+
+static void Button_isr(uintptr_t Arg);
+static void Button_emit(Button_Gesture Gesture, uint32_t PressTime);
+static void Button_accept(Button_Decoder *Dec, bool Pressed, uint32_t Time);
+static void Button_sample(Button_Decoder *Dec, Button_Edge *Edge);
+static void Button_expire(Button_Decoder *Dec, uint32_t Now);
+static void Button_deadline(void *Arg);
+static void Button_arm(Button_Decoder *Dec, uint32_t Now);
+
+void Button_init(Button_Callback Callback)
+{
+    Hwi_Params HwiParams;
+    bool Pressed;
+
+    memset(&Button_Ctrl, 0, sizeof(Button_Ctrl));
+    Button_Ctrl.Callback = Callback;
+
+    Button_Ctrl.Sem = Semaphore_create(0, NULL, NULL);
+    if (Button_Ctrl.Sem == NULL)
+    {
+        UART_PRINT("Error creating button semaphore\r\n");
+        while (1);
+    }
+
+    //button pulls the pin low while pressed, so arm for whichever edge comes next
+    MAP_GPIO_setAsInputPinWithPullUpResistor(BUTTON_PORT, BUTTON_PIN);
+    Pressed = MAP_GPIO_getInputPinValue(BUTTON_PORT, BUTTON_PIN) == GPIO_INPUT_PIN_LOW;
+    MAP_GPIO_interruptEdgeSelect(BUTTON_PORT, BUTTON_PIN,
+                                 Pressed ? GPIO_LOW_TO_HIGH_TRANSITION : GPIO_HIGH_TO_LOW_TRANSITION);
+    MAP_GPIO_clearInterruptFlag(BUTTON_PORT, BUTTON_PIN);
+    MAP_GPIO_enableInterrupt(BUTTON_PORT, BUTTON_PIN);
+    MAP_Interrupt_enableInterrupt(INT_PORT6);
+
+    Hwi_Params_init(&HwiParams);
+    HwiParams.priority = 0x41;
+
+    Button_Ctrl.Hwi = Hwi_create(INT_PORT6, Button_isr, &HwiParams, NULL);
+    if (Button_Ctrl.Hwi == NULL)
+    {
+        UART_PRINT("Error creating button interrupt\r\n");
+        while (1);
+    }
+}
+
+/*
+ * Interrupt handler for the okay button, only records the edge
+ */
+static void Button_isr(uintptr_t Arg)
+{
+    uint32_t Status;
+    bool Pressed;
+
+    Status = MAP_GPIO_getEnabledInterruptStatus(BUTTON_PORT);
+    if (Status & BUTTON_PIN)
+    {
+        MAP_GPIO_clearInterruptFlag(BUTTON_PORT, BUTTON_PIN);
+
+        //sample the level and wait for the opposite edge, a spurious
+        //interrupt from changing the edge select just repeats the level
+        Pressed = MAP_GPIO_getInputPinValue(BUTTON_PORT, BUTTON_PIN) == GPIO_INPUT_PIN_LOW;
+        MAP_GPIO_interruptEdgeSelect(BUTTON_PORT, BUTTON_PIN,
+                                     Pressed ? GPIO_LOW_TO_HIGH_TRANSITION : GPIO_HIGH_TO_LOW_TRANSITION);
+
+        Recorder_log(RECORDER_BUTTON, &Pressed, sizeof(Pressed));
+        Button_edge(Pressed);
+    }
+}
+
+/*
+ * Queue an edge for the button thread, from the ISR or a replay
+ */
+void Button_edge(bool Pressed)
+{
+    Button_Edge *Edge;
+
+    Button_Ctrl.Stats.Edges++;
+    if (Button_Ctrl.Head - Button_Ctrl.Tail >= BUTTON_RING_SIZE)
+    {
+        Button_Ctrl.Stats.Overruns++;
+    }
+    else
+    {
+        Edge = &Button_Ctrl.Ring[Button_Ctrl.Head & BUTTON_RING_MASK];
+        Edge->Time = TimerWheel_now();
+        Edge->Pressed = Pressed;
+        Button_Ctrl.Head++;
+    }
+
+    //any press wakes the display, before the gesture is decoded
+    if (Pressed)
+    {
+        SMO_Power_activity();
+    }
+
+    Semaphore_post(Button_Ctrl.Sem);
+}
+
+static void Button_emit(Button_Gesture Gesture, uint32_t PressTime)
+{
+    uint32_t DecodeMs = TIMERWHEEL_TICKS_TO_MS(TimerWheel_now() - PressTime);
+
+    Button_Ctrl.Stats.Gestures[Gesture]++;
+    if (DecodeMs > Button_Ctrl.Stats.MaxDecodeMs)
+    {
+        Button_Ctrl.Stats.MaxDecodeMs = DecodeMs;
+    }
+
+    if (Button_Ctrl.Callback != NULL)
+    {
+        Button_Ctrl.Callback(Gesture, PressTime);
+    }
+}
+
+/*
+ * Advance the gesture state machine with a debounced edge
+ */
+static void Button_accept(Button_Decoder *Dec, bool Pressed, uint32_t Time)
+{
+    if (Pressed)
+    {
+        Dec->PressTime = Time;
+        Dec->LongFired = false;
+    }
+    else if (Dec->LongFired)
+    {
+        //release after a long press was already reported
+    }
+    else if (Dec->WaitSecond)
+    {
+        Dec->WaitSecond = false;
+        Button_emit(BUTTON_DOUBLE_PRESS, Dec->ClickTime);
+    }
+    else
+    {
+        //hold the click back until we know no second press follows
+        Dec->WaitSecond = true;
+        Dec->ClickTime = Dec->PressTime;
+        Dec->ReleaseTime = Time;
+    }
+}
+
+/*
+ * Debounce a raw edge: the first edge of a burst is taken immediately and
+ * anything else within BUTTON_DEBOUNCE_MS is held until the window closes
+ */
+static void Button_sample(Button_Decoder *Dec, Button_Edge *Edge)
+{
+    if (Edge->Time - Dec->LastEdge < BUTTON_DEBOUNCE_TICKS)
+    {
+        Button_Ctrl.Stats.Bounces++;
+        Dec->HasPending = true;
+        Dec->PendingLevel = Edge->Pressed;
+        return;
+    }
+
+    Dec->HasPending = false;
+    if (Edge->Pressed != Dec->Pressed)
+    {
+        Dec->Pressed = Edge->Pressed;
+        Dec->LastEdge = Edge->Time;
+        Button_accept(Dec, Edge->Pressed, Edge->Time);
+    }
+}
+
+/*
+ * Handle every deadline that has passed by the given time
+ */
+static void Button_expire(Button_Decoder *Dec, uint32_t Now)
+{
+    //debounce window closed on a different level than we accepted
+    if (Dec->HasPending && Now - Dec->LastEdge >= BUTTON_DEBOUNCE_TICKS)
+    {
+        Dec->HasPending = false;
+        if (Dec->PendingLevel != Dec->Pressed)
+        {
+            Dec->Pressed = Dec->PendingLevel;
+            Dec->LastEdge = Dec->LastEdge + BUTTON_DEBOUNCE_TICKS;
+            Button_accept(Dec, Dec->Pressed, Dec->LastEdge);
+        }
+    }
+
+    if (Dec->Pressed && !Dec->LongFired && Now - Dec->PressTime >= BUTTON_LONG_PRESS_TICKS)
+    {
+        Dec->LongFired = true;
+        Dec->WaitSecond = false;
+        Button_emit(BUTTON_LONG_PRESS, Dec->PressTime);
+    }
+
+    if (Dec->WaitSecond && !Dec->Pressed && Now - Dec->ReleaseTime >= BUTTON_DOUBLE_PRESS_TICKS)
+    {
+        Dec->WaitSecond = false;
+        Button_emit(BUTTON_CLICK, Dec->ClickTime);
+    }
+}
+
+/*
+ * Deadline timer callback, wakes the button thread
+ */
+static void Button_deadline(void *Arg)
+{
+    Semaphore_post(Button_Ctrl.Sem);
+}
+
+/*
+ * Arm the deadline timer for the earliest pending deadline
+ */
+static void Button_arm(Button_Decoder *Dec, uint32_t Now)
+{
+    uint32_t Wait = UINT32_MAX, Ticks;
+
+    if (Dec->HasPending)
+    {
+        Ticks = Dec->LastEdge + BUTTON_DEBOUNCE_TICKS - Now;
+        Wait = Ticks < Wait ? Ticks : Wait;
+    }
+    if (Dec->Pressed && !Dec->LongFired)
+    {
+        Ticks = Dec->PressTime + BUTTON_LONG_PRESS_TICKS - Now;
+        Wait = Ticks < Wait ? Ticks : Wait;
+    }
+    if (Dec->WaitSecond && !Dec->Pressed)
+    {
+        Ticks = Dec->ReleaseTime + BUTTON_DOUBLE_PRESS_TICKS - Now;
+        Wait = Ticks < Wait ? Ticks : Wait;
+    }
+
+    if (Wait == UINT32_MAX)
+    {
+        TimerWheel_stop(&Button_Ctrl.Deadline);
+    }
+    else
+    {
+        //deadlines already behind us wrap to huge values, run them now
+        Wait = Wait > BUTTON_LONG_PRESS_TICKS ? 0 : Wait;
+        TimerWheel_start(&Button_Ctrl.Deadline, TIMERWHEEL_TICKS_TO_MS(Wait) + 1, 0, Button_deadline, NULL);
+    }
+}
+
+/*
+ * Decode the queued edges and due deadlines, waiting for some if Wait
+ * is set. Returns false if there was nothing to do.
+ */
+bool Button_process(bool Wait)
+{
+    Button_Decoder *Dec = &Button_Ctrl.Dec;
+    Button_Edge *Edge;
+
+    if (!Semaphore_pend(Button_Ctrl.Sem, Wait ? BIOS_WAIT_FOREVER : BIOS_NO_WAIT))
+    {
+        return false;
+    }
+
+    //replay the edges in order so deadlines between them fire in order too
+    while (Button_Ctrl.Tail != Button_Ctrl.Head)
+    {
+        Edge = &Button_Ctrl.Ring[Button_Ctrl.Tail & BUTTON_RING_MASK];
+        Button_expire(Dec, Edge->Time);
+        Button_sample(Dec, Edge);
+        Button_Ctrl.Tail++;
+    }
+    Button_expire(Dec, TimerWheel_now());
+    Button_arm(Dec, TimerWheel_now());
+    return true;
+}
+
+void *buttonThreadProc(void *pArg)
+{
+    while (1)
+    {
+        Button_process(true);
+    }
+}
+
+void Button_getStats(Button_Stats *Stats)
+{
+    UInt Key = Hwi_disable();
+    *Stats = Button_Ctrl.Stats;
+    Hwi_restore(Key);
+}
@@ -0,0 +1,59 @@
+/************************************************************
+ * button.h
+ *
+ * Okay button input. The port interrupt only timestamps
+ * edges into a ring, and the button thread debounces them
+ * and decodes click, double-press and long-press gestures.
+ * Timestamps and deadlines use the timer wheel's ticks.
+ *
+ ************************************************************/
+
+#ifndef BUTTON_H
+#define BUTTON_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define BUTTON_PORT             GPIO_PORT_P6
+#define BUTTON_PIN              GPIO_PIN2
+
+#define BUTTON_RING_SIZE        16 //edges buffered from the ISR, power of 2
+#define BUTTON_DEBOUNCE_MS      20 //edges closer than this to the last one are bounce
+#define BUTTON_DOUBLE_PRESS_MS  350 //max gap between a release and the next press
+#define BUTTON_LONG_PRESS_MS    1500 //press held this long is a long press
+
+typedef enum Button_Gesture
+{
+    BUTTON_CLICK = 0,
+    BUTTON_DOUBLE_PRESS = 1,
+    BUTTON_LONG_PRESS = 2,
+
+} Button_Gesture;
+
+typedef struct Button_Edge
+{
+    uint32_t Time; //timer wheel tick taken in the ISR
+    bool Pressed; //pin level after the edge
+
+} Button_Edge;
+
+typedef struct Button_Stats
+{
+    uint32_t Edges; //raw edges seen by the ISR
+    uint32_t Bounces; //edges rejected by the debounce filter
+    uint32_t Overruns; //edges dropped because the ring was full
+    uint32_t Gestures[3]; //decoded gestures, indexed by Button_Gesture
+    uint32_t MaxDecodeMs; //longest time from press to gesture callback
+
+} Button_Stats;
+
+//called from the button thread, PressTime is the timer wheel tick the gesture began
+typedef void (*Button_Callback)(Button_Gesture Gesture, uint32_t PressTime);
+
+void Button_init(Button_Callback Callback);
+void *buttonThreadProc(void *pArg);
+void Button_edge(bool Pressed); //level after an edge, safe from interrupts
+bool Button_process(bool Wait); //one round of decoding, for callers without a thread
+void Button_getStats(Button_Stats *Stats);
+
+#endif
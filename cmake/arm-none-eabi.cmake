@@ -0,0 +1,31 @@
+# Toolchain for the MSP432P401R firmware with the GNU Arm Embedded toolchain.
+#
+#   cmake -S . -B build-msp432 -DCMAKE_TOOLCHAIN_FILE=cmake/arm-none-eabi.cmake \
+#         -DSMO_SDK_DIR=/opt/ti/simplelink_msp432p4_sdk_3_40_01_02 \
+#         -DSMO_WIFI_PLUGIN_DIR=/opt/ti/simplelink_sdk_wifi_plugin_4_20_00_10 \
+#         -DSMO_KERNEL_DIR=/path/to/tirtos_builds_MSP_EXP432P401R_release_gcc
+
+set(CMAKE_SYSTEM_NAME Generic)
+set(CMAKE_SYSTEM_PROCESSOR arm)
+
+set(SMO_ARM_PREFIX "arm-none-eabi-" CACHE STRING "Prefix of the cross tools")
+if(DEFINED ENV{ARM_GCC_DIR})
+    set(SMO_ARM_PREFIX "$ENV{ARM_GCC_DIR}/bin/arm-none-eabi-" CACHE STRING "" FORCE)
+endif()
+
+set(CMAKE_C_COMPILER ${SMO_ARM_PREFIX}gcc)
+set(CMAKE_ASM_COMPILER ${SMO_ARM_PREFIX}gcc)
+set(CMAKE_AR ${SMO_ARM_PREFIX}gcc-ar)
+set(CMAKE_RANLIB ${SMO_ARM_PREFIX}gcc-ranlib)
+set(CMAKE_SIZE ${SMO_ARM_PREFIX}size)
+set(CMAKE_OBJCOPY ${SMO_ARM_PREFIX}objcopy)
+
+#the compiler cannot link a test program without the board's linker script
+set(CMAKE_TRY_COMPILE_TARGET_TYPE STATIC_LIBRARY)
+
+set(CMAKE_C_FLAGS_INIT "-mcpu=cortex-m4 -march=armv7e-m -mthumb -mfloat-abi=hard -mfpu=fpv4-sp-d16")
+set(CMAKE_EXE_LINKER_FLAGS_INIT "--specs=nano.specs -nostartfiles -static")
+
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
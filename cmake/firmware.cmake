@@ -0,0 +1,77 @@
+# MSP432P401R firmware on TI-RTOS, with the GCC builds of the SDK libraries.
+#
+# SMO_KERNEL_DIR is a TI-RTOS kernel configuration built for GCC, such as
+# the SDK's kernel/tirtos/builds/MSP_EXP432P401R/release/gcc after make.
+# It holds the kernel library, its generated linker.cmd and compiler.opt.
+
+set(SMO_SDK_DIR "" CACHE PATH "SimpleLink MSP432P4 SDK")
+set(SMO_WIFI_PLUGIN_DIR "" CACHE PATH "SimpleLink Wi-Fi plugin for the SDK")
+set(SMO_KERNEL_DIR "" CACHE PATH "TI-RTOS kernel configuration built with GCC")
+option(SMO_CHECK_HEAP "Fail the build if the C heap is linked in" ON)
+
+foreach(Dir SMO_SDK_DIR SMO_WIFI_PLUGIN_DIR SMO_KERNEL_DIR)
+    if(NOT IS_DIRECTORY "${${Dir}}")
+        message(FATAL_ERROR "${Dir} must be set to build the firmware")
+    endif()
+endforeach()
+
+set(SMO_FIRMWARE_SOURCES
+    asset.c asset_data.c alert.c button.c EVE3.c font.c font_data.c get_time.c journal.c LP5018.c load.c lock.c
+    main_tirtos.c MSP_EXP432P401R.c network_if.c peripherals.c power.c profile.c recorder.c rtc.c scene.c
+    sl_wifi_callbacks.c SMO.c smo_app.c smo_wire.c sound.c sound_data.c store.c timer_wheel.c
+    touch.c uart_term.c utils/ustdlib.c
+)
+
+add_executable(smo ${SMO_FIRMWARE_SOURCES})
+set_target_properties(smo PROPERTIES SUFFIX ".out")
+target_include_directories(smo PRIVATE
+    ${PROJECT_SOURCE_DIR}
+    ${SMO_WIFI_PLUGIN_DIR}/source
+    ${SMO_SDK_DIR}/source
+    ${SMO_SDK_DIR}/source/third_party/CMSIS/Include
+    ${SMO_SDK_DIR}/source/ti/posix/gcc
+    ${SMO_SDK_DIR}/kernel/tirtos/packages
+)
+target_compile_definitions(smo PRIVATE __MSP432P401R__ DeviceFamily_MSP432P401x)
+target_compile_options(smo PRIVATE "@${SMO_KERNEL_DIR}/compiler.opt")
+smo_target(smo -Os)
+
+#hot modules run from SRAM, the linker script includes this list
+set(SMO_RAMFUNC_LD ${CMAKE_CURRENT_BINARY_DIR}/smo_ramfunc.ld)
+set(SMO_RAMFUNC_LINES "")
+foreach(Source ${SMO_HOT_SOURCES})
+    string(APPEND SMO_RAMFUNC_LINES "*/${Source}.o*(.text .text.*)\n")
+endforeach()
+file(WRITE ${SMO_RAMFUNC_LD} "${SMO_RAMFUNC_LINES}")
+
+target_link_options(smo PRIVATE
+    -L${CMAKE_CURRENT_BINARY_DIR}
+    -Wl,-T,${PROJECT_SOURCE_DIR}/MSP_EXP432P401R_TIRTOS.lds
+    -Wl,-T,${SMO_KERNEL_DIR}/linker.cmd
+    -Wl,-Map,${CMAKE_CURRENT_BINARY_DIR}/smo.map
+    -Wl,--gc-sections
+)
+target_link_libraries(smo PRIVATE
+    ${SMO_SDK_DIR}/source/ti/display/lib/display.am4fg
+    ${SMO_SDK_DIR}/source/ti/drivers/lib/drivers_msp432p401x.am4fg
+    ${SMO_WIFI_PLUGIN_DIR}/source/ti/net/lib/gcc/m4f/slnetsock_release.a
+    ${SMO_WIFI_PLUGIN_DIR}/source/ti/drivers/net/wifi/slnetif/gcc/Release/slnetifwifi.a
+    ${SMO_WIFI_PLUGIN_DIR}/source/ti/drivers/net/wifi/gcc/rtos/msp432p4/simplelink.a
+    ${SMO_SDK_DIR}/kernel/tirtos/packages/ti/dpl/lib/dpl_msp432p401x.am4fg
+    ${SMO_SDK_DIR}/source/ti/devices/msp432p4xx/driverlib/gcc/msp432p4xx_driverlib.a
+    ${SMO_KERNEL_DIR}/src/sysbios/sysbios.am4fg
+    gcc c m nosys
+)
+set_property(TARGET smo APPEND PROPERTY LINK_DEPENDS
+             ${PROJECT_SOURCE_DIR}/MSP_EXP432P401R_TIRTOS.lds ${SMO_RAMFUNC_LD})
+
+smo_reports(smo)
+if(Python3_FOUND)
+    if(SMO_CHECK_HEAP)
+        set(SMO_HEAP_FLAG --no-heap)
+    endif()
+    add_custom_command(TARGET smo POST_BUILD
+                       COMMAND ${Python3_EXECUTABLE} ${PROJECT_SOURCE_DIR}/tools/mapreport.py
+                               ${CMAKE_CURRENT_BINARY_DIR}/smo.map ${SMO_HEAP_FLAG}
+                       VERBATIM)
+endif()
@@ -0,0 +1,54 @@
+# Host programs, built with the simulated drivers and stub headers in host/.
+
+set(SMO_HOST_INCLUDES ${PROJECT_SOURCE_DIR}/host/include ${PROJECT_SOURCE_DIR}/host ${PROJECT_SOURCE_DIR})
+find_package(Threads REQUIRED)
+
+#schedule decoding, shared with the firmware
+add_library(smo_core STATIC SMO.c smo_wire.c)
+target_include_directories(smo_core PUBLIC ${SMO_HOST_INCLUDES})
+target_compile_definitions(smo_core PUBLIC _GNU_SOURCE)
+smo_target(smo_core -O2)
+
+#event logic on the simulated drivers and virtual clock
+add_library(smo_simhal STATIC smo_app.c alert.c journal.c lock.c host/sim.c host/hal_sim.c)
+target_link_libraries(smo_simhal PUBLIC smo_core Threads::Threads)
+smo_target(smo_simhal -O2)
+
+#schedule pushes for backends
+add_library(smo_push host/aes.c host/smo_push.c)
+target_link_libraries(smo_push PUBLIC smo_core Threads::Threads)
+smo_target(smo_push -O2)
+
+add_executable(smo_sim host/main_sim.c)
+target_link_libraries(smo_sim PRIVATE smo_simhal)
+smo_target(smo_sim -O2)
+smo_reports(smo_sim)
+
+add_executable(smo_replay host/replay.c button.c recorder.c)
+target_link_libraries(smo_replay PRIVATE smo_simhal)
+smo_target(smo_replay -O2)
+smo_reports(smo_replay)
+
+add_executable(smo_fleet host/fleet.c)
+target_link_libraries(smo_fleet PRIVATE smo_push)
+smo_target(smo_fleet -O2)
+smo_reports(smo_fleet)
+
+#micro-benchmarks of the firmware's hot paths, run with the bench target
+add_executable(smo_bench host/bench.c smo_wire.c host/aes.c host/smo_push.c EVE3.c scene.c font.c font_data.c
+               asset.c uart_term.c utils/ustdlib.c)
+target_include_directories(smo_bench PRIVATE ${SMO_HOST_INCLUDES} ${PROJECT_SOURCE_DIR}/utils)
+target_compile_definitions(smo_bench PRIVATE _GNU_SOURCE
+                           SMO_BENCH_BUILD="${CMAKE_BUILD_TYPE} ${SMO_PROFILE} LTO=${SMO_LTO}")
+smo_target(smo_bench -O2)
+add_custom_target(bench
+                  COMMAND smo_bench --json -o ${CMAKE_CURRENT_BINARY_DIR}/bench.json
+                  COMMAND ${CMAKE_COMMAND} -E cat ${CMAKE_CURRENT_BINARY_DIR}/bench.json
+                  USES_TERMINAL)
+
+#the peripheral thread only runs on the MSP432, it is compiled against the
+#stub headers so the screen mailbox path keeps building without the SDK
+add_library(smo_screen_check OBJECT peripherals.c)
+target_include_directories(smo_screen_check PRIVATE ${SMO_HOST_INCLUDES})
+target_compile_definitions(smo_screen_check PRIVATE _GNU_SOURCE)
+smo_target(smo_screen_check -O2)
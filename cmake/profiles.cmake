@@ -0,0 +1,75 @@
+# Per-module optimisation profiles.
+#
+# Hot modules run in interrupts, once per frame or once per packet: the
+# button and RTC interrupts, the timer wheel, the input recorder, the
+# task switch hooks of the load counters and the profiler, the screen's
+# display list and glyph layout, and the validation of each decrypted
+# packet (AES itself runs on the AES256 peripheral). They are
+# built -O2, and on the MSP432 their code is linked into SRAM (see
+# MSP_EXP432P401R_TIRTOS.lds), where it runs without flash wait states.
+# Hot modules are kept out of LTO so their code stays in their own object
+# files for the linker script to place.
+#
+# Cold modules run once at boot or on a user action: board setup, Wi-Fi
+# and SNTP, flash storage, asset upload and logging. They are built -Os.
+#
+# SMO_PROFILE picks how the rest are built:
+#   balanced  hot -O2, everything else -Os (host: -O2)
+#   size      everything -Os
+#   speed     everything -O2
+
+set(SMO_HOT_SOURCES
+    button.c
+    EVE3.c
+    font.c
+    load.c
+    profile.c
+    recorder.c
+    rtc.c
+    scene.c
+    smo_wire.c
+    timer_wheel.c
+)
+
+set(SMO_COLD_SOURCES
+    asset.c
+    get_time.c
+    journal.c
+    LP5018.c
+    main_tirtos.c
+    MSP_EXP432P401R.c
+    network_if.c
+    sl_wifi_callbacks.c
+    store.c
+    uart_term.c
+    utils/ustdlib.c
+)
+
+set(SMO_PROFILE "balanced" CACHE STRING "Optimisation profile: balanced, size or speed")
+set_property(CACHE SMO_PROFILE PROPERTY STRINGS balanced size speed)
+
+#set the optimisation level of every source of a target from its profile
+function(smo_apply_profile Target Default)
+    get_target_property(Sources ${Target} SOURCES)
+    foreach(Source ${Sources})
+        get_filename_component(Path ${Source} ABSOLUTE)
+        file(RELATIVE_PATH Rel ${PROJECT_SOURCE_DIR} ${Path})
+
+        if(SMO_PROFILE STREQUAL "size")
+            set(Opt -Os)
+        elseif(SMO_PROFILE STREQUAL "speed")
+            set(Opt -O2)
+        elseif(Rel IN_LIST SMO_HOT_SOURCES)
+            set(Opt -O2)
+        elseif(Rel IN_LIST SMO_COLD_SOURCES)
+            set(Opt -Os)
+        else()
+            set(Opt ${Default})
+        endif()
+
+        if(Rel IN_LIST SMO_HOT_SOURCES AND SMO_LTO)
+            list(APPEND Opt -fno-lto)
+        endif()
+        set_property(SOURCE ${Source} APPEND PROPERTY COMPILE_OPTIONS ${Opt})
+    endforeach()
+endfunction()
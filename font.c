@@ -0,0 +1,260 @@
+#include <errno.h>
+
+#include "font.h"
+#include "EVE.h"
+
+static const char *Font_lineEnd(Font *Fnt, const char *Str, uint16_t MaxWidth,
+                                uint16_t *Width, const char **Next);
+
+/*
+ * Inflate a font into RAM_G at Addr and point each page's
+ * metric block at its glyphs. Pages use handles Handle onwards.
+ */
+int Font_load(Font *Fnt, const Font_Data *Data, uint32_t Addr, uint8_t Handle)
+{
+    int Res = 0;
+    uint32_t Glyphs;
+    uint8_t Page;
+
+    if (Data->nPages == 0 || Data->nPages > FONT_MAX_PAGES || (Addr & 3) != 0)
+    {
+        Res = -EINVAL;
+        goto Error;
+    }
+
+    EVE_cmdInflate(RAM_G + Addr, Data->Blob, Data->BlobSize);
+
+    //glyph pointers are only known once the load address is
+    Glyphs = Addr + (uint32_t) Data->nPages * FONT_METRIC_SIZE;
+    for (Page = 0; Page < Data->nPages; ++Page)
+    {
+        EVE_write32(RAM_G + Addr + Page*FONT_METRIC_SIZE + FONT_METRIC_SIZE - 4,
+                    Glyphs + (uint32_t) Page*FONT_PAGE_GLYPHS*Data->CellSize);
+    }
+
+    Font_attach(Fnt, Data, Addr, Handle);
+
+Error:
+    return Res;
+}
+
+/*
+ * Use a font image that is already in RAM_G at Addr, such as
+ * one copied from the EVE flash after an earlier Font_load
+ */
+void Font_attach(Font *Fnt, const Font_Data *Data, uint32_t Addr, uint8_t Handle)
+{
+    Fnt->Data = Data;
+    Fnt->Addr = Addr;
+    Fnt->Handle = Handle;
+}
+
+/*
+ * Set up the font's bitmap handles in the current display list
+ */
+void Font_bind(Font *Fnt)
+{
+    uint8_t Page;
+
+    EVE_burstReserve(16 * Fnt->Data->nPages);
+    for (Page = 0; Page < Fnt->Data->nPages; ++Page)
+    {
+        EVE_cmdSetFont2(Fnt->Handle + Page, Fnt->Addr + Page*FONT_METRIC_SIZE, 0);
+    }
+}
+
+/*
+ * Decode one UTF-8 sequence and advance past it. Malformed,
+ * overlong and surrogate sequences decode as FONT_REPLACEMENT.
+ */
+uint32_t Font_decode(const char **Str)
+{
+    const uint8_t *S = (const uint8_t *) *Str;
+    uint32_t Codepoint, Min;
+    uint8_t Len, i;
+
+    if (S[0] < 0x80)
+    {
+        *Str += 1;
+        return S[0];
+    }
+    else if ((S[0] & 0xE0) == 0xC0)
+    {
+        Len = 2;
+        Min = 0x80;
+        Codepoint = S[0] & 0x1F;
+    }
+    else if ((S[0] & 0xF0) == 0xE0)
+    {
+        Len = 3;
+        Min = 0x800;
+        Codepoint = S[0] & 0x0F;
+    }
+    else if ((S[0] & 0xF8) == 0xF0)
+    {
+        Len = 4;
+        Min = 0x10000;
+        Codepoint = S[0] & 0x07;
+    }
+    else
+    {
+        *Str += 1;
+        return FONT_REPLACEMENT;
+    }
+
+    for (i = 1; i < Len; ++i)
+    {
+        //a missing continuation byte (including the terminator) ends the sequence
+        if ((S[i] & 0xC0) != 0x80)
+        {
+            *Str += i;
+            return FONT_REPLACEMENT;
+        }
+        Codepoint = (Codepoint << 6) | (S[i] & 0x3F);
+    }
+
+    *Str += Len;
+    if (Codepoint < Min || Codepoint > 0x10FFFF || (Codepoint >= 0xD800 && Codepoint <= 0xDFFF))
+    {
+        return FONT_REPLACEMENT;
+    }
+    return Codepoint;
+}
+
+/*
+ * Glyph index of a code point, or the fallback glyph. Fonts have
+ * a handful of ranges, so this is constant time in practice.
+ */
+uint16_t Font_glyph(const Font_Data *Data, uint32_t Codepoint)
+{
+    const Font_Range *Range;
+    uint8_t i;
+
+    for (i = 0; i < Data->nRanges; ++i)
+    {
+        Range = &Data->Ranges[i];
+        if (Codepoint < Range->First)
+        {
+            break;
+        }
+        if (Codepoint - Range->First < Range->Count)
+        {
+            return Range->Glyph + (uint16_t) (Codepoint - Range->First);
+        }
+    }
+    return Data->Fallback;
+}
+
+/*
+ * Width of the widest line in pixels, from the cached advances
+ */
+uint16_t Font_measure(Font *Fnt, const char *Str)
+{
+    uint16_t Width, Max = 0;
+
+    while (*Str != '\0')
+    {
+        Font_lineEnd(Fnt, Str, 0, &Width, &Str);
+        if (Width > Max)
+        {
+            Max = Width;
+        }
+    }
+    return Max;
+}
+
+/*
+ * Draw UTF-8 text with its top left at X, Y, breaking lines on
+ * '\n' and, if MaxWidth is not 0, at the last space that fits.
+ * Returns the Y below the last line.
+ */
+int16_t Font_drawText(Font *Fnt, int16_t X, int16_t Y, uint16_t MaxWidth, const char *Str)
+{
+    const Font_Data *Data = Fnt->Data;
+    const char *End, *Next;
+    uint32_t Codepoint;
+    uint16_t Width, Glyph;
+    uint8_t Page, Handle = 0xFF;
+    int16_t Pen;
+
+    EVE_burstReserve(4);
+    EVE_cmd(DL_BEGIN | BITMAPS);
+    while (*Str != '\0')
+    {
+        End = Font_lineEnd(Fnt, Str, MaxWidth, &Width, &Next);
+        Pen = X;
+        while (Str < End)
+        {
+            Codepoint = Font_decode(&Str);
+            if (Codepoint == '\r')
+            {
+                continue;
+            }
+            Glyph = Font_glyph(Data, Codepoint);
+            Page = Glyph / FONT_PAGE_GLYPHS;
+
+            //handle, cell and vertex, the handle only when the page changes
+            EVE_burstReserve(12);
+            if (Page != Handle)
+            {
+                Handle = Page;
+                EVE_cmd(BITMAP_HANDLE(Fnt->Handle + Page));
+            }
+            EVE_cmd(CELL(Glyph % FONT_PAGE_GLYPHS));
+            EVE_cmd(VERTEX2F(Pen, Y));
+            Pen += Data->Advances[Glyph];
+        }
+        Str = Next;
+        Y += Data->Height;
+    }
+    EVE_burstReserve(4);
+    EVE_cmd(DL_END);
+
+    return Y;
+}
+
+/*
+ * Find where the line starting at Str ends. Carriage returns
+ * are dropped, and a line wrapped at a space skips that space.
+ */
+static const char *Font_lineEnd(Font *Fnt, const char *Str, uint16_t MaxWidth,
+                                uint16_t *Width, const char **Next)
+{
+    const char *Cur = Str, *Prev, *Space = NULL;
+    uint16_t Advance, SpaceWidth = 0;
+    uint32_t Codepoint;
+
+    *Width = 0;
+    while (*Cur != '\0' && *Cur != '\n')
+    {
+        Prev = Cur;
+        Codepoint = Font_decode(&Cur);
+        if (Codepoint == '\r')
+        {
+            continue;
+        }
+
+        Advance = Fnt->Data->Advances[Font_glyph(Fnt->Data, Codepoint)];
+        if (MaxWidth != 0 && *Width + Advance > MaxWidth && Prev != Str)
+        {
+            if (Space != NULL)
+            {
+                *Width = SpaceWidth;
+                *Next = Space + 1;
+                return Space;
+            }
+            //a single word wider than the line is split where it overflows
+            *Next = Prev;
+            return Prev;
+        }
+        if (Codepoint == ' ')
+        {
+            Space = Prev;
+            SpaceWidth = *Width;
+        }
+        *Width += Advance;
+    }
+
+    *Next = *Cur == '\n' ? Cur + 1 : Cur;
+    return Cur;
+}
@@ -0,0 +1,68 @@
+/************************************************************
+ * font.h
+ *
+ * Custom fonts for the EVE3, for text the ROM fonts can't
+ * show (accented Latin, Greek, Cyrillic). A font is built by
+ * tools/mkfont.py, inflated into RAM_G once and registered
+ * with CMD_SETFONT2, one bitmap handle per 128 glyphs.
+ * Glyph advances stay in MCU flash, so UTF-8 text is laid
+ * out and measured without reading back from the EVE.
+ *
+ ************************************************************/
+
+#ifndef FONT_H
+#define FONT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define FONT_PAGE_GLYPHS    128 //cells per bitmap handle
+#define FONT_MAX_PAGES      4
+#define FONT_METRIC_SIZE    148 //legacy metric block, gptr is the last word
+#define FONT_REPLACEMENT    0xFFFD //decoded from invalid UTF-8
+
+typedef struct Font_Range
+{
+    uint16_t First; //first code point
+    uint16_t Count;
+    uint16_t Glyph; //glyph index of First
+
+} Font_Range;
+
+typedef struct Font_Data
+{
+    const uint8_t *Blob; //deflated RAM_G image for CMD_INFLATE
+    uint32_t BlobSize;
+    uint32_t RamSize; //size once inflated
+    uint32_t Version; //changes whenever the font is rebuilt differently
+    const Font_Range *Ranges; //sorted runs of code points
+    uint8_t nRanges;
+    const uint8_t *Advances; //pixels, per glyph
+    uint16_t nGlyphs;
+    uint16_t Fallback; //glyph drawn for unmapped code points
+    uint8_t nPages;
+    uint16_t CellSize; //bytes per glyph bitmap
+    uint8_t Height; //line height in pixels
+    uint8_t Baseline; //pixels from the top of a cell
+
+} Font_Data;
+
+typedef struct Font
+{
+    const Font_Data *Data;
+    uint32_t Addr; //RAM_G address of the first metric block
+    uint8_t Handle; //bitmap handle of the first page
+
+} Font;
+
+extern const Font_Data Font_sans;
+
+int Font_load(Font *Fnt, const Font_Data *Data, uint32_t Addr, uint8_t Handle);
+void Font_attach(Font *Fnt, const Font_Data *Data, uint32_t Addr, uint8_t Handle);
+void Font_bind(Font *Fnt); //once per display list, before drawing
+uint32_t Font_decode(const char **Str);
+uint16_t Font_glyph(const Font_Data *Data, uint32_t Codepoint);
+uint16_t Font_measure(Font *Fnt, const char *Str);
+int16_t Font_drawText(Font *Fnt, int16_t X, int16_t Y, uint16_t MaxWidth, const char *Str);
+
+#endif
@@ -0,0 +1,1896 @@
+/************************************************************
+ * Generated by tools/mkfont.py from DejaVuSans.ttf at 28 px, L4.
+ * Do not edit, rerun the tool instead.
+ *
+ * 497 glyphs in 4 pages, 31 x 33 cells, 270928 bytes in RAM_G,
+ * 29035 bytes deflated.
+ ************************************************************/
+
+#include <stdint.h>
+
+#include "font.h"
+
+static const uint8_t Font_sansBlob[29035] = {
+0x78,0xda,0xec,0xbd,0xb,0x94,0x5c,0xc5,0x75,0x2e,0x5c,0xe7,0xf4,0xbb,0xe7,0xa1,
+0x96,0x34,0x20,0x81,0xa4,0x99,0xce,0xbf,0x14,0x47,0x7f,0x8,0x9a,0x59,0xb9,0xc4,
+0x21,0xc1,0x56,0xf,0x62,0xc,0xc2,0xf,0xf5,0x38,0x71,0x12,0xd9,0x38,0xf4,0xd8,
+0xc6,0x36,0x84,0xd8,0x3d,0x70,0x89,0x7f,0x96,0x49,0xe8,0xb1,0x11,0xd0,0x20,0x43,
+0xcb,0xce,0xc3,0xbe,0x8b,0x75,0xe9,0x71,0xec,0xd8,0x4e,0xf8,0x73,0x5b,0xd8,0x4,
+0x84,0xda,0xd0,0x72,0x9c,0xdc,0xdf,0x9,0x49,0x5a,0xe0,0xd8,0x21,0xd7,0x8b,0xb4,
+0x24,0xc0,0x6,0x3f,0x38,0x68,0xde,0x33,0xfd,0xa8,0xff,0x54,0x9d,0x47,0xed,0xbd,
+0x47,0xd3,0xc3,0x58,0xa3,0xd1,0xf4,0xe8,0x14,0xb6,0xe0,0x53,0x9f,0x47,0x9d,0xaa,
+0x5d,0xbb,0xf6,0xde,0xb5,0x1f,0x91,0xb6,0x8e,0x4d,0x1b,0xb6,0x5c,0x18,0x6e,0x6b,
+0xeb,0xdc,0x14,0x89,0x46,0x22,0x1b,0xdc,0x16,0x89,0x6c,0xda,0xb4,0x69,0xdd,0xd6,
+0x8d,0x1b,0xbb,0x2e,0xdc,0x10,0xbb,0xf0,0x82,0x70,0x78,0x43,0x6c,0xf3,0x5,0x17,
+0xae,0xbf,0x70,0xe3,0x86,0xf5,0x5d,0x1b,0xb7,0x6e,0x5c,0xbf,0xb1,0x2d,0xd2,0xb6,
+0xa9,0xb3,0x73,0xfd,0x86,0x75,0x1b,0xd6,0x47,0x37,0x6c,0x8,0x87,0x63,0xe1,0x2d,
+0x1b,0xd6,0x6f,0xd8,0xd0,0xbe,0xae,0x6d,0xc3,0xfa,0x4d,0xeb,0xd7,0xaf,0xdb,0x10,
+0xd9,0xb0,0x29,0xd2,0x26,0x1f,0xd5,0xd9,0xb9,0xb5,0x63,0xfd,0xa6,0xe8,0xd6,0xce,
+0xce,0x4d,0xe6,0x8b,0xc4,0x5f,0xb4,0x75,0xac,0xdf,0xb2,0x65,0xcb,0xba,0x8d,0x3a,
+0x63,0x2c,0x66,0xfe,0xbf,0xc7,0xfc,0xff,0x2f,0x30,0xab,0x6d,0x14,0x6d,0x4b,0x97,
+0xb8,0x33,0x6c,0xb6,0xb,0x2f,0xb8,0x50,0xb4,0x4d,0x17,0x76,0x99,0x6d,0xfd,0xfa,
+0xd,0xeb,0x65,0xdb,0xb2,0x4e,0xfc,0x29,0x7e,0xb7,0xff,0x66,0xd3,0x7a,0x71,0x83,
+0x9,0x36,0xca,0x7f,0xba,0xd6,0x59,0xff,0x5c,0xb8,0xe1,0x42,0xf9,0xb7,0xd6,0x3f,
+0x2,0x89,0x7f,0x2e,0xd8,0x70,0xf1,0xc6,0xb0,0xdb,0xd6,0xc7,0xc4,0xd7,0xc5,0x62,
+0xe6,0x27,0xc4,0xa2,0xb1,0xe8,0xe9,0xfa,0x14,0xb,0x5f,0xb0,0x41,0xfc,0xb3,0xe9,
+0x82,0xd,0xe6,0x18,0x98,0xff,0x74,0x6f,0xdb,0xd8,0x2e,0xfe,0x31,0x3f,0x5f,0xfe,
+0xb3,0xbe,0x4d,0xfc,0xd3,0xb5,0x41,0xfd,0xb3,0xd5,0x1c,0x84,0xf5,0x1b,0xd7,0x89,
+0x7f,0xa2,0x1b,0x23,0x17,0x6c,0x6e,0x33,0xc7,0x33,0xb2,0x71,0x63,0x6c,0xe3,0x86,
+0x8d,0x17,0x5c,0x18,0xde,0xb0,0x71,0xb3,0xf9,0xa8,0xb,0x44,0xe7,0x2f,0xdc,0x68,
+0xe,0xaf,0x18,0xc7,0x48,0xcc,0xec,0xea,0xfa,0x75,0xe6,0x80,0x46,0xcc,0xef,0x8c,
+0xc5,0xc4,0x1f,0x1b,0xd6,0xc7,0xcc,0x3f,0x36,0x9d,0xae,0x4f,0x91,0xd8,0xfa,0xd8,
+0xa6,0xd,0x66,0x7f,0xba,0xc4,0x38,0xf5,0x6c,0xbb,0xb0,0xeb,0x82,0xf5,0x17,0x98,
+0x43,0x67,0x7e,0x65,0xf7,0x86,0xb,0x2e,0xe8,0xba,0xc0,0x9c,0xaf,0xb,0xd6,0x9b,
+0x43,0xb6,0x79,0xe3,0x85,0x1b,0xbb,0x7b,0x36,0x5d,0xb4,0xb1,0xab,0x7b,0xa3,0xd9,
+0xa7,0x75,0x1b,0xd7,0x5f,0xb4,0x4e,0xc,0xca,0x5,0x62,0xbe,0xd6,0xc5,0xd6,0x6f,
+0x36,0xc7,0xeb,0xe2,0x8b,0xbb,0x2e,0x5c,0xbf,0x6e,0xb3,0xf9,0xf3,0x86,0x75,0xeb,
+0xd6,0x99,0xcf,0xbb,0xe8,0x22,0x39,0x64,0x9d,0x5b,0x23,0x66,0x33,0xff,0x6a,0xfd,
+0xd6,0xd,0xc,0xb7,0xd3,0xf5,0xc9,0x6b,0x5e,0x3b,0xbb,0xed,0xc6,0x11,0x8c,0xcb,
+0xaf,0xaf,0x2e,0x5c,0x3a,0x8e,0x71,0xe1,0x18,0xc6,0x79,0x82,0x73,0x47,0x31,0xde,
+0x33,0xb4,0xb2,0xe3,0xd1,0xe2,0x6d,0xc7,0x88,0x96,0x8d,0x1,0x9c,0x7a,0x5d,0xe7,
+0x7d,0x2b,0x88,0xbb,0xfa,0xb5,0x81,0x98,0xb7,0x2a,0x57,0x73,0xd3,0x78,0x9c,0x55,
+0x6,0x15,0xe,0xd4,0x99,0xce,0xc1,0x9c,0x45,0x66,0x59,0xb0,0x6,0xae,0xef,0x98,
+0x64,0xd1,0x19,0x80,0x7b,0xc6,0xc4,0x5f,0x39,0x9b,0x5e,0x36,0x9b,0x7f,0x25,0x9b,
+0x9b,0xc9,0x7e,0xda,0xc2,0x7e,0x6e,0x37,0xfb,0xa,0x5f,0xb1,0xc8,0x9f,0x29,0x1a,
+0x3f,0x28,0x3e,0xf6,0x73,0xbf,0x7e,0x4a,0xfc,0x95,0xd3,0x1e,0x2a,0x96,0x6a,0xc5,
+0xa7,0xeb,0xc5,0xc3,0x36,0xae,0xd8,0xaf,0xab,0xda,0xf8,0xb2,0x81,0xd2,0x97,0x7,
+0x72,0xff,0x3e,0x70,0x95,0x5a,0xe0,0x83,0x2c,0x7f,0xf0,0xe7,0xff,0xfa,0x76,0xf3,
+0xf5,0x33,0x2d,0x3d,0xdf,0xbf,0x4a,0xf0,0x8f,0x96,0x84,0x77,0x94,0x79,0xe3,0x9,
+0x35,0x3e,0x7e,0x43,0x8c,0x76,0xbf,0x8b,0x77,0xd6,0xfb,0x7f,0xa4,0xff,0xa1,0xc2,
+0x99,0x31,0x7c,0xbf,0xc9,0xee,0x31,0x3e,0x8e,0x71,0x7a,0x36,0x86,0xf0,0x36,0xfe,
+0xe3,0x57,0x21,0xff,0xd0,0x4a,0x9c,0xd7,0x6f,0x81,0x52,0xd6,0x1d,0xe6,0x5f,0x40,
+0x8e,0xc3,0x5e,0xb9,0x8e,0x1f,0xc3,0xfd,0xcf,0x4f,0x62,0xdc,0x3b,0x8d,0x71,0x8f,
+0xc2,0xef,0x16,0x38,0x33,0xae,0xfa,0xf7,0xe7,0xb1,0x1f,0xfd,0x6,0x3f,0xa4,0xb6,
+0x27,0x49,0x5c,0xaa,0x47,0xbe,0x3b,0x2a,0xfc,0xff,0xc,0x9e,0xc1,0x78,0xce,0xc7,
+0xe7,0x96,0x19,0xdc,0xf1,0xa4,0x9c,0xbc,0x3b,0x86,0x9c,0xf1,0xe7,0x62,0x70,0x7c,
+0xd,0xfb,0x93,0x4b,0xdf,0xa,0xa,0xfe,0x6e,0xae,0x2,0x6b,0xf4,0xcd,0xd5,0x93,
+0x1f,0x35,0xa7,0xcd,0xde,0xa5,0x3,0xe6,0x52,0x49,0x1d,0x63,0x9a,0x61,0xcf,0x48,
+0xc8,0x5c,0x87,0x89,0xd7,0xd5,0x82,0xd,0x9a,0x38,0x79,0x9c,0x25,0x4e,0x38,0xe4,
+0xd3,0x90,0xf7,0x96,0x9d,0x4d,0x5d,0x33,0x6,0x59,0x79,0x18,0x2c,0xb8,0xf4,0xcc,
+0x67,0xea,0xb1,0x6e,0x35,0x1f,0x21,0x83,0xff,0xbd,0x58,0xbf,0x7f,0xf0,0xa4,0xfd,
+0x86,0xae,0xab,0x44,0xe7,0xb6,0x58,0xdd,0x74,0x97,0x68,0xfe,0xbb,0x41,0x45,0x94,
+0xe9,0xa3,0x9a,0x9,0x72,0x87,0xdc,0x77,0xf4,0x89,0xd7,0x26,0x8f,0xab,0x15,0x2e,
+0xba,0xdd,0x7b,0xca,0xc6,0x66,0xe7,0x4c,0x26,0xc0,0x7a,0x5f,0x57,0xc,0xc3,0x67,
+0x72,0x84,0xd4,0x31,0xf5,0x9,0xcc,0x18,0x62,0x25,0x9b,0x89,0xc8,0xce,0xa5,0x67,
+0xde,0xd7,0x88,0xdb,0x14,0x23,0x4,0x8e,0x10,0xe7,0xdf,0xb5,0xdf,0x66,0x6d,0xbf,
+0x5d,0xb7,0xb5,0x2a,0xbb,0xd8,0x54,0x7c,0xf2,0x3,0x0,0x6,0xc4,0x82,0x8f,0x2b,
+0x9c,0xe0,0x5f,0xb8,0xcf,0x0,0xeb,0xaf,0x30,0x61,0x5e,0x3,0x7e,0xaf,0x10,0xf9,
+0xad,0x72,0x88,0xc8,0x7f,0x63,0x18,0x27,0x6a,0x58,0x5c,0x68,0xe7,0xf8,0x86,0x92,
+0xcb,0xda,0x65,0x8b,0xf2,0xeb,0xb8,0x49,0x7f,0xe1,0x86,0x23,0x7f,0x4c,0xb3,0xd2,
+0x9c,0xf9,0xd7,0xe,0x5,0x55,0x8e,0xb1,0x2d,0xe6,0x5,0x9d,0x33,0xe,0xbd,0x8e,
+0x98,0x2c,0x64,0x96,0x25,0x6d,0x8a,0xf2,0x71,0x93,0xf2,0xb6,0xf2,0x83,0x85,0x43,
+0xe,0x36,0x67,0x4f,0x2b,0x57,0x1d,0x19,0x46,0x93,0xac,0x64,0x2b,0x77,0x37,0x9c,
+0xc2,0x8c,0xbc,0xca,0xdd,0x1,0x76,0xf2,0xbf,0x64,0xfa,0x83,0x9c,0x3b,0x52,0xa6,
+0xcf,0xe0,0x3f,0xa9,0xf0,0x6f,0x57,0xdc,0xb,0x2e,0x32,0x87,0xeb,0xfb,0xec,0x52,
+0x3e,0xec,0x72,0xcc,0xdf,0xdb,0xdd,0xd2,0xf2,0x24,0xc6,0xa9,0xd7,0x57,0x16,0x77,
+0xf5,0x7b,0x2,0xdb,0xb9,0x6d,0xdb,0xe3,0x78,0xc3,0x30,0xf0,0x8c,0x84,0xab,0xf8,
+0xf2,0xde,0x89,0xa6,0xfa,0x9c,0x66,0xc,0x23,0x1c,0xe4,0xf8,0xf1,0x6d,0x35,0x7c,
+0x7b,0xe7,0x2c,0x61,0x17,0x53,0x18,0xa7,0xe9,0xeb,0x8,0x7b,0xc9,0x9f,0x6a,0x8e,
+0xe9,0xf5,0x40,0x14,0x90,0x2d,0x39,0x89,0x71,0xcf,0x34,0xc6,0x1d,0xe4,0xf3,0x5d,
+0xc6,0xe4,0xf0,0x7,0x4e,0x8,0xb8,0x34,0x4a,0x5e,0x40,0x3a,0xd4,0x4e,0x84,0x4d,
+0x77,0x27,0x76,0xda,0x81,0xa1,0x73,0x49,0xd,0x97,0xc5,0xc9,0x7a,0x25,0xea,0x7b,
+0x3b,0x19,0x9f,0x0,0xed,0x7e,0x65,0x98,0x4c,0x0,0x79,0x40,0x62,0xa2,0x39,0x1,
+0x44,0xc9,0x0,0x87,0x8,0x1,0x5,0xf8,0x20,0x99,0x0,0x3c,0x5e,0x3a,0x1f,0x26,
+0x78,0x84,0x5c,0x8f,0x7f,0xf7,0x93,0xfb,0x83,0x48,0xdd,0x35,0xa5,0x9,0x4e,0xf6,
+0xaf,0x6a,0x73,0x82,0x49,0x8f,0x35,0xa5,0x7,0x9d,0x3e,0x9e,0x2e,0x2f,0x42,0x9f,
+0x77,0xc,0xaf,0x36,0x7e,0xf1,0x3f,0x8,0xfe,0x17,0xf4,0x79,0x12,0xab,0x19,0xeb,
+0xf8,0x77,0x13,0xbf,0x4b,0x91,0x40,0xa0,0xf2,0xc5,0x7f,0xb9,0xb8,0xe,0x66,0x30,
+0xf8,0xda,0x6b,0xaf,0xa1,0x9,0xb8,0x98,0x7f,0x11,0x4d,0x97,0x29,0x1f,0x80,0x11,
+0xd3,0xb,0xff,0xfe,0x2f,0xef,0x9a,0x53,0xcf,0xef,0xfc,0x91,0xf9,0xfc,0x3b,0x95,
+0x9,0xca,0x1f,0x37,0xb1,0xde,0xbf,0x60,0xff,0x4e,0x83,0xbd,0xb6,0xd2,0xed,0x72,
+0x42,0xd3,0xe9,0x63,0x2b,0x87,0xd7,0x39,0xf6,0x8b,0xe1,0xd3,0xe3,0x70,0x36,0x9b,
+0x2d,0xbd,0x62,0xfe,0xd1,0x7f,0x6e,0xfa,0xe7,0xb5,0xb5,0xd5,0x2,0x59,0xbc,0x7d,
+0xb4,0x51,0x79,0x88,0xe0,0x8e,0x3a,0xd9,0xf,0x88,0x7c,0x92,0x26,0xea,0x57,0x61,
+0x90,0xec,0xdf,0xde,0x90,0x2f,0x67,0xb,0x15,0x8b,0xc5,0x11,0x24,0xd,0x70,0xa4,
+0xbf,0x6,0x4c,0x4e,0x31,0xe4,0xd,0x93,0xd7,0x7e,0xde,0x16,0xbe,0x17,0xe3,0x75,
+0xf5,0xa5,0xe1,0x35,0xb0,0xc4,0xee,0x22,0xa,0x2,0xd5,0xd8,0xc8,0xee,0x58,0x1e,
+0x69,0x2a,0x50,0x7,0x89,0xfe,0xd0,0x46,0xf4,0x8b,0x1e,0xa2,0x7f,0xa4,0x8e,0x13,
+0x86,0x4a,0xf4,0x37,0x63,0x88,0xa8,0xb,0xb1,0xa6,0xf2,0x7b,0xc7,0xf4,0x22,0x5f,
+0x73,0x74,0x69,0x5f,0x53,0x5f,0xde,0xaf,0xb9,0xbd,0x6f,0xd5,0xd3,0xc3,0x1f,0x14,
+0xff,0xc,0xc2,0x4b,0x4d,0x8e,0xfb,0x28,0x18,0x20,0x63,0x2e,0x5b,0x6,0x36,0x84,
+0xa8,0xa9,0xbe,0x45,0x80,0x4a,0xd7,0x2b,0xe6,0xa3,0xa2,0x46,0x21,0x33,0xe1,0xfc,
+0x61,0xab,0x63,0x42,0x1d,0x4f,0x28,0x1d,0xdc,0x10,0xd4,0xb5,0xce,0x9d,0x44,0x4d,
+0x72,0xf7,0xce,0xba,0x9a,0xf,0x31,0x80,0x1d,0xd,0x85,0x85,0x95,0xb8,0x7d,0x41,
+0xac,0x59,0xd7,0xab,0x59,0xb3,0x9e,0xa7,0x3a,0x5c,0x11,0xef,0xeb,0x99,0x53,0x13,
+0x24,0xe8,0x23,0xa9,0x88,0x26,0x2d,0xfe,0x33,0xaf,0x94,0xc0,0xee,0x7a,0xcc,0x7c,
+0xc9,0x51,0xa0,0xe,0x3f,0xca,0xde,0xa,0x6d,0xe,0x5,0xfe,0x2f,0x1c,0xd2,0x5c,
+0xc8,0xe0,0x75,0x24,0x13,0xf8,0x3f,0xdc,0xd7,0xd2,0xfc,0xe1,0x17,0xb3,0xf0,0x73,
+0x42,0x4f,0xe3,0xd,0xb8,0x93,0x6c,0xc8,0x9d,0xff,0x74,0x3,0x31,0x30,0xb3,0x35,
+0x8d,0xf5,0x81,0x1,0xfe,0xf,0x3,0x57,0xaa,0xfd,0x44,0x2a,0x33,0xe3,0xb,0xe2,
+0x96,0x6f,0xbf,0xfe,0xc8,0x91,0x5b,0x1,0xbc,0x53,0x7c,0x1e,0xe0,0xa1,0xe5,0xc6,
+0xe1,0xcf,0x70,0xb5,0xbc,0xd8,0x3f,0x9b,0x4b,0x65,0x17,0x30,0x19,0xc5,0x25,0xf,
+0x27,0x23,0x6a,0x90,0x2d,0xa6,0x72,0x8c,0x30,0x65,0x7c,0x7d,0x98,0x98,0x8c,0x12,
+0x98,0x49,0xeb,0x6,0x1e,0xee,0x6d,0xd8,0x62,0xa5,0x95,0xb1,0x89,0x73,0x2b,0x7e,
+0x9a,0x56,0x9e,0x26,0x3f,0xf,0xe3,0x9f,0xb1,0xfd,0x70,0xb,0x31,0x6f,0x95,0xaa,
+0x3,0x66,0x53,0xfc,0x41,0x1e,0xe7,0xf2,0xd7,0x17,0xc4,0xad,0xde,0xf4,0x7d,0xc5,
+0xe2,0x7e,0x80,0x93,0xe2,0xf3,0xbe,0xd,0x70,0xed,0x6b,0xf7,0x1b,0xd,0xa5,0x63,
+0xfd,0x62,0x4c,0x98,0x98,0xc8,0xae,0x58,0x21,0xe3,0x51,0x20,0x36,0xdb,0x12,0xfe,
+0xdd,0x87,0xef,0xf7,0xdd,0x59,0x7,0x3a,0x5c,0x80,0xf3,0xc6,0x67,0x19,0xc2,0xfc,
+0x2f,0xe1,0x4,0xe,0xbc,0x2d,0xdf,0xe8,0xc7,0x32,0x85,0x71,0x82,0x8,0x9,0x44,
+0xe9,0x4b,0xcc,0x34,0xc7,0x69,0x45,0x51,0x42,0x3a,0xd1,0x2b,0x4a,0xe8,0xf8,0xcf,
+0x77,0x33,0xfd,0xe3,0x5c,0xf9,0x47,0x54,0xc8,0x79,0xf7,0x1f,0x9b,0xb0,0x6,0xe9,
+0xb3,0x6b,0xcf,0x7b,0x5a,0xdc,0xbf,0x47,0x77,0x7c,0x55,0x5c,0x15,0x1b,0xf,0x67,
+0x1a,0x63,0xdd,0x28,0x4c,0x62,0x11,0x2b,0x8d,0x70,0xfa,0x4,0xc2,0x9a,0x31,0x88,
+0x70,0x74,0x8e,0x21,0x9c,0x3a,0x89,0xb0,0x66,0xca,0x8f,0x10,0x8b,0x83,0x4c,0x88,
+0x53,0x63,0x8,0x6b,0xc2,0x7c,0xe,0x70,0x58,0xb0,0x16,0x80,0x23,0xb6,0xb5,0xaa,
+0x7f,0x1,0xac,0x8b,0xd5,0x9f,0x9b,0xc6,0x2e,0x5a,0x69,0x6a,0x43,0x58,0x22,0x6e,
+0x69,0xed,0xc2,0x54,0xd0,0xb3,0xf7,0x0,0xfd,0x49,0x8c,0x56,0xbd,0x9,0x26,0x4b,
+0x6b,0xc9,0x78,0x76,0xdf,0x3d,0x50,0xde,0x12,0xcf,0xaf,0xf5,0x43,0xfc,0x3,0x3,
+0xca,0x6b,0x91,0x41,0xa6,0xe7,0xc8,0x19,0x52,0x90,0x53,0x25,0x61,0xac,0x39,0x7f,
+0xa0,0x13,0x96,0x9b,0x5c,0xf0,0xfe,0x98,0x94,0x21,0xd5,0xf3,0xff,0xe9,0xdd,0xcc,
+0x57,0x0,0xef,0x97,0xfc,0x1,0x6c,0x50,0xf,0x98,0x70,0xe,0x39,0x0,0xee,0x6b,
+0x71,0xfe,0xe0,0x3f,0x50,0xbc,0x1b,0x7c,0x81,0xaf,0x8c,0x25,0xc8,0xbd,0xfc,0x3f,
+0xef,0x2b,0x1f,0x2,0xdc,0xe1,0x65,0x73,0x55,0xf6,0x3,0x7d,0x3,0xcf,0x55,0xef,
+0x1c,0x99,0x1a,0xa2,0x90,0x95,0x4e,0xf9,0x6e,0xff,0xef,0x70,0xab,0x79,0xb6,0xc4,
+0xf9,0xbf,0x3,0x61,0xee,0x5f,0x79,0xb1,0xa2,0x4,0x4,0x4d,0x28,0x3b,0x1,0x7e,
+0x52,0xfd,0x6e,0xca,0xff,0x2c,0xa3,0x88,0x4c,0xd2,0x4e,0xb7,0x22,0xd8,0x8a,0x78,
+0x5f,0x3b,0x57,0xef,0x1b,0x97,0x1c,0xcf,0xfd,0xc0,0x1c,0xf9,0x3d,0x29,0x1e,0xd5,
+0xa3,0xf4,0x91,0x76,0x71,0x7e,0x97,0x9b,0x6,0xfa,0xed,0xdf,0x9b,0xf4,0x1,0xf6,
+0xa3,0x8c,0x49,0xb0,0xd,0x40,0x0,0x1,0x93,0x42,0xbe,0x8e,0xb6,0xbf,0x6b,0xae,
+0x6c,0x61,0x6a,0xd8,0x27,0xf8,0x43,0x56,0x99,0x20,0x4a,0x1c,0x2f,0x0,0xb,0x8f,
+0x2d,0x49,0x1e,0xec,0x20,0x67,0xa2,0x49,0xa2,0xb4,0x17,0xb0,0x7c,0xa8,0x91,0xe5,
+0x1e,0x22,0x27,0x94,0xed,0xc4,0xe4,0x90,0x20,0x24,0x97,0xc7,0x24,0xa7,0x11,0x69,
+0x36,0x48,0x24,0x44,0x6a,0x71,0xee,0xad,0x36,0x67,0x1e,0x95,0x13,0xc4,0x0,0x72,
+0x10,0xe1,0x28,0x6f,0x6d,0xf5,0x72,0x9e,0xf4,0x70,0x47,0xf1,0xab,0x60,0x80,0x34,
+0xe1,0x20,0x38,0xd,0x3f,0xf7,0xd5,0x6c,0x1e,0x4c,0x50,0xd2,0x5c,0x9f,0x3e,0xe3,
+0x14,0x1e,0x3d,0x30,0x84,0x79,0x41,0x3a,0x29,0x45,0x4f,0xb9,0x71,0xcc,0xaf,0xa5,
+0x28,0x57,0x3a,0x1,0x36,0xf8,0x5b,0xd8,0x2f,0x43,0x7a,0xba,0x93,0xbf,0xc6,0xbf,
+0x7,0xfa,0xf7,0x76,0x53,0xbe,0xfc,0x1c,0xa4,0xbd,0xff,0x18,0x78,0x10,0x28,0x18,
+0xa9,0x39,0xa1,0x23,0x28,0x2,0x2b,0x8b,0x47,0x27,0x66,0x17,0xb2,0x6f,0xcc,0xb7,
+0x57,0x1c,0xc3,0xfc,0xa1,0x2c,0xed,0x27,0x8a,0x80,0x53,0x8d,0x41,0xb6,0x9,0xac,
+0x7,0x53,0x0,0xf9,0x26,0x87,0xfd,0xfd,0x7d,0x73,0xbc,0x1e,0x83,0x3,0xba,0xfd,
+0x13,0xbb,0x5b,0x9a,0x1e,0xe,0x14,0x91,0x81,0x52,0xd0,0xc3,0x41,0xb8,0x9a,0x5e,
+0xc9,0x56,0xc0,0x82,0x4c,0xd7,0x62,0x26,0x8d,0xc,0xa2,0xad,0x57,0x33,0x8e,0xe2,
+0xf1,0xcf,0x8f,0x29,0x55,0xe2,0x20,0x92,0xdf,0xa5,0xbf,0x1a,0x4b,0xcf,0x62,0xfb,
+0x53,0x4e,0x2d,0x51,0x43,0x98,0xb6,0x80,0x1,0x2c,0x3f,0x23,0x56,0xb8,0x9a,0xbf,
+0x9d,0xfc,0x4b,0xbe,0x1c,0x57,0xbf,0xfb,0x84,0xc2,0x97,0x6,0x4b,0x7c,0x73,0x85,
+0x7f,0x89,0x6e,0x5a,0x29,0x62,0xb4,0xcc,0x37,0xe7,0x77,0x5b,0xc0,0x1e,0x18,0xfd,
+0x20,0xb,0x40,0x95,0x54,0xd8,0x63,0xe0,0xf8,0x44,0x4d,0xf8,0x3d,0xc4,0x3f,0x5a,
+0xda,0x5d,0xee,0xac,0xb7,0xa5,0x9e,0x17,0x52,0xec,0xf5,0xd7,0xa3,0x87,0x56,0xea,
+0xaf,0x77,0xde,0xbd,0x40,0xc3,0xc3,0xa8,0x3f,0x80,0x64,0xc2,0x5f,0xaa,0x40,0x19,
+0x51,0xbb,0x99,0xf3,0x57,0xd5,0xb0,0xfa,0xff,0x17,0x6f,0x7c,0x59,0xfd,0xfa,0x1b,
+0x6,0x9f,0x7b,0xb7,0x7a,0xd0,0x9f,0x70,0xfe,0xbf,0x63,0x50,0x1f,0xad,0xdf,0x8a,
+0xf4,0x57,0xfe,0x7d,0xf4,0xe6,0x88,0x79,0x37,0x3e,0x4e,0x30,0x9f,0x8e,0xe,0x68,
+0xc4,0xdb,0x9f,0xef,0x23,0xbd,0xc3,0xf,0xd5,0x1f,0xe0,0x44,0x44,0xbe,0x96,0xb8,
+0x89,0xb2,0xc0,0xa0,0xb7,0xd6,0xcf,0x46,0x6b,0x2b,0xda,0x6d,0x8,0xd8,0x3b,0x88,
+0xbf,0x93,0x6c,0xfd,0x6f,0x50,0x7b,0x1e,0xb0,0x5b,0xfc,0xf4,0xcf,0xa3,0x98,0x5e,
+0xef,0xb5,0x33,0x6b,0x1a,0xc1,0xeb,0xfe,0x8a,0x60,0xfe,0x2a,0x9a,0xc9,0x60,0x99,
+0xd7,0x91,0x39,0x94,0x32,0x0,0xc6,0x2e,0xaf,0xf0,0xea,0xbb,0xd1,0x1c,0x3f,0x4c,
+0x96,0x38,0x7b,0x1f,0xc7,0x3a,0xa9,0xaf,0x80,0xf0,0xe,0xf3,0x9,0xea,0xad,0xda,
+0x1f,0xa2,0x37,0x5c,0x58,0x42,0x3d,0x30,0x1f,0x5,0x7b,0x68,0xca,0x8b,0xe8,0xb,
+0xd6,0xd5,0x3e,0x80,0x75,0xeb,0x35,0x4e,0x37,0xda,0x7b,0x8b,0x4f,0xc0,0xd9,0x78,
+0xd0,0x5c,0x3a,0x2f,0x3,0xcc,0x7f,0x9c,0x2d,0x43,0xd,0xfb,0x47,0x42,0xe5,0x1b,
+0xc5,0xdb,0x4,0x3d,0xbe,0x22,0xd8,0x4f,0x8e,0x3b,0x2e,0x6d,0xa0,0x31,0xd5,0x2b,
+0x78,0xcb,0xbd,0x94,0x38,0x58,0x97,0xf1,0xcf,0x1,0x62,0x9d,0x8,0x93,0xd,0x9d,
+0xfa,0x4b,0x53,0xec,0xcf,0x2e,0x4d,0x80,0x88,0x92,0xe7,0x2f,0x86,0xd7,0x60,0x7b,
+0x13,0xb6,0x58,0xbe,0x5f,0xb0,0x57,0xe5,0x3,0x7d,0x9,0x7f,0xf5,0x86,0x81,0x4f,
+0xba,0x11,0x4c,0x3e,0x43,0xaa,0x5b,0x9b,0x9d,0x49,0xdf,0x35,0x67,0xdd,0xfa,0x56,
+0x4b,0xe7,0xd3,0x2a,0xb6,0x35,0x48,0xb7,0x1c,0x5b,0x84,0xff,0x8a,0x7e,0xe3,0xad,
+0xec,0x2a,0x96,0x94,0x46,0x88,0x1e,0x53,0xf5,0xcb,0x71,0xfe,0xa5,0x1a,0x8b,0x4a,
+0xa5,0x34,0x73,0xd0,0x9c,0xe1,0xef,0x7c,0xa6,0x5e,0x63,0x1,0xa9,0x44,0x96,0xfb,
+0x58,0xaf,0xf9,0xaa,0x4c,0x8d,0x69,0xd2,0xe9,0xa1,0x61,0x39,0xe8,0xb4,0x9b,0x1a,
+0xa7,0x21,0x9e,0x5a,0xb3,0x2,0xe6,0x42,0x0,0x97,0x86,0x64,0x1c,0xa1,0xbc,0x5e,
+0x62,0x93,0x80,0x82,0x35,0xe6,0xaf,0xda,0xf7,0x8b,0x40,0xbe,0x48,0x8d,0xb5,0x4d,
+0xd9,0xcf,0x4f,0x4e,0x88,0xa8,0x31,0xdb,0x53,0x26,0x37,0xc2,0xda,0x1a,0xb7,0x5d,
+0x6d,0xd4,0xaf,0xb3,0xe,0xd9,0x12,0x27,0x98,0x56,0x36,0x97,0x88,0xe3,0x14,0x22,
+0x1c,0x62,0x82,0xc5,0x27,0xd6,0x17,0x6f,0x45,0x9f,0x5,0x74,0x5b,0x5b,0xb7,0x8e,
+0xbb,0xe6,0x30,0x79,0x1a,0xb7,0xd9,0x55,0x79,0xf7,0xf2,0xaf,0x5c,0xe9,0x7b,0xaf,
+0xe1,0xea,0xb0,0xda,0x83,0x78,0x7c,0xc5,0x12,0x2d,0x7e,0xe5,0x1c,0xda,0xbc,0xc9,
+0x71,0x56,0x80,0x4f,0x13,0x89,0x1a,0x8b,0xd0,0xbd,0x35,0x6c,0xa2,0xce,0x8c,0x1b,
+0x68,0xfd,0x57,0xe,0xe5,0x4f,0x20,0xee,0x30,0x94,0x84,0x7,0xd2,0x91,0x46,0xac,
+0x3,0xc6,0xe8,0x74,0xcf,0xe1,0x25,0x9e,0x9e,0xc0,0x21,0x15,0xe5,0xe3,0xd6,0xff,
+0x5d,0x5b,0xc1,0x8,0x3e,0xc0,0x12,0xcc,0xb,0xf8,0xbb,0x74,0x36,0x4c,0x59,0xe3,
+0x1,0xc5,0x13,0x92,0x48,0x5a,0x30,0x89,0xa7,0x2a,0x84,0x15,0xd7,0x60,0x62,0xd9,
+0x4b,0x2c,0xab,0x99,0x68,0x21,0x4b,0x8e,0x74,0xd,0x5a,0xed,0x96,0xa9,0xd5,0x75,
+0xd0,0xb1,0x6d,0xa3,0x21,0x87,0x87,0xd9,0x91,0xc2,0xd4,0x82,0xd1,0xba,0x6d,0x87,
+0x39,0x7c,0xb7,0x81,0xe9,0x90,0xe3,0x7,0x22,0x24,0x92,0x75,0x73,0xf4,0xb8,0xb2,
+0x8,0xb,0x7b,0xbf,0x96,0x6f,0x20,0x6c,0x92,0x4c,0x3f,0xc2,0x41,0x25,0x9d,0x4b,
+0x1c,0x52,0x5b,0x80,0xc4,0xed,0x8a,0x0,0x4,0xf6,0x97,0x66,0xf0,0xfb,0xeb,0xc3,
+0xb,0xe3,0xd9,0x81,0x81,0xab,0x4b,0xea,0xc0,0xd9,0x7e,0xfe,0x8,0xc2,0xc0,0x61,
+0xcb,0xc2,0xa5,0xf1,0xe6,0xd8,0x18,0x23,0xcf,0x3b,0x8a,0xdf,0x7,0xbe,0x4f,0x92,
+0xd7,0xf,0x71,0xff,0x9e,0x58,0x4b,0x5b,0x86,0x7e,0x53,0xf1,0xc8,0x7,0x81,0x40,
+0x51,0x10,0x5f,0xf8,0xd,0x17,0xef,0xe2,0xd5,0xec,0xfd,0x6,0x57,0xf6,0xc0,0xd9,
+0x98,0x38,0xc4,0x71,0x70,0xbb,0xb5,0xf4,0x2e,0x72,0x97,0x37,0x39,0xd,0x28,0xd3,
+0xb3,0x8a,0xe6,0xb2,0x5,0x3d,0x6c,0x8,0xf2,0xe1,0xa6,0xbf,0x7,0xc8,0x69,0x82,
+0x6f,0x9e,0x6b,0xe,0x71,0x8d,0x28,0x90,0xf8,0xc0,0x84,0xc5,0x0,0x34,0x25,0x6e,
+0x7c,0x4b,0x32,0x75,0xf7,0x82,0x52,0xe3,0x56,0xa6,0x5d,0xa7,0xe,0xc0,0x2e,0xe6,
+0xbc,0xc1,0x61,0xcc,0xf1,0xdb,0xc5,0x2,0x82,0x22,0x8f,0x7f,0xcf,0x7b,0x5a,0x9a,
+0x3f,0xdc,0x3b,0xc0,0x8,0x7f,0xa8,0xdd,0x2,0xf9,0xc3,0x53,0xe6,0x8,0xa0,0xf5,
+0x6e,0xe,0xcf,0xc,0x5e,0x5f,0x29,0x97,0x1,0x58,0x38,0xe0,0x4e,0xbb,0x85,0xad,
+0x63,0x1,0x80,0x5d,0x8b,0xb5,0x8d,0x13,0x55,0x8c,0x7b,0xea,0x18,0xaf,0x5b,0x4,
+0xf7,0xd6,0x30,0x4e,0xce,0x61,0xec,0x9e,0x58,0x5a,0x58,0x73,0x19,0x82,0x85,0xa3,
+0x2e,0x59,0x4a,0xac,0x97,0x5c,0x91,0x57,0xf0,0x87,0x7d,0x65,0xfe,0x22,0xe6,0xf,
+0xb3,0x68,0x3f,0xfa,0xc9,0x5f,0xac,0x9d,0xc,0x37,0x3b,0xa4,0x72,0x7f,0x37,0xa6,
+0x7,0xe0,0x20,0x37,0xf,0x13,0x7f,0x86,0x65,0xc7,0xc4,0x1f,0x71,0x1e,0x9e,0x15,
+0xc6,0x82,0x2b,0x57,0xae,0x3f,0xf2,0x7d,0x57,0x91,0xfe,0x34,0x16,0xc4,0x6b,0x83,
+0x1e,0xfa,0xc9,0xf7,0xd,0x2f,0x8c,0x57,0x82,0x1e,0x66,0x9b,0x60,0x31,0x3f,0xbb,
+0xd9,0xca,0xf5,0x67,0x89,0x78,0xd,0x58,0x20,0x6e,0x2a,0x16,0xef,0x6,0x50,0x66,
+0xc4,0x51,0x39,0x7a,0x76,0xf1,0x5a,0xf6,0xbe,0xb2,0xcb,0xff,0x7d,0x86,0xd0,0x8c,
+0xf4,0x7,0x1d,0xdc,0x61,0xd1,0x8a,0x3e,0x7a,0x36,0xe5,0x87,0x47,0x8a,0xc5,0xbf,
+0x83,0xbf,0x57,0x5c,0xf,0xd,0x4b,0x7e,0xb8,0x31,0xeb,0x88,0x5,0x8e,0xfc,0xe0,
+0x9e,0xb8,0x1b,0xc7,0x31,0xb6,0x2f,0x74,0x71,0xa2,0x1e,0x43,0xd8,0x96,0x1f,0x5c,
+0xac,0x9,0xf9,0x81,0xbd,0x49,0xf9,0xec,0x8a,0xfc,0x1f,0x6,0x7,0x41,0xca,0x42,
+0x7e,0x68,0xfc,0x29,0xfc,0xa6,0x6b,0x6e,0x68,0x5d,0xf9,0x72,0x87,0x74,0xa6,0xf5,
+0x65,0xe3,0x88,0xde,0x43,0x44,0x1e,0x58,0x41,0x6c,0x9b,0x93,0x17,0xc4,0x92,0x7f,
+0x5f,0x7b,0xee,0xfa,0xb7,0x8,0x6e,0xf9,0xfd,0x62,0xff,0xea,0xe2,0xb7,0xad,0x8e,
+0x3d,0x7a,0x38,0xcf,0x31,0x4d,0x17,0x42,0xf4,0x59,0xe2,0x1b,0xe8,0xe7,0xc7,0xf1,
+0x76,0x4a,0xce,0x51,0x89,0x2d,0x90,0xdd,0x13,0x3f,0x27,0xf4,0xb0,0xe7,0xde,0x18,
+0xfc,0xde,0x0,0x7f,0x9,0x7d,0x7f,0xba,0x81,0xec,0x4d,0x41,0xa5,0x7e,0x49,0x9c,
+0x1,0xf1,0x13,0x26,0xe,0xf3,0xe7,0xd0,0xf8,0xe5,0x61,0x6,0xb1,0xe4,0x4c,0xd4,
+0xda,0xa1,0x5d,0x5c,0xa8,0xc6,0xb0,0x3c,0xf9,0x28,0x91,0x2f,0x91,0x5,0x22,0x59,
+0x35,0xa6,0xf1,0xfc,0xec,0x42,0x17,0x24,0x67,0x7c,0xe8,0x2,0xf3,0xfd,0xe8,0x2,
+0x13,0xa3,0xb,0x44,0xff,0x77,0x11,0x79,0x19,0x5e,0x20,0xbf,0x1f,0x5c,0x20,0x31,
+0xb8,0xc0,0xa2,0x8f,0x5d,0x7c,0xd8,0xe3,0xf,0xe7,0x7,0x96,0xf2,0xca,0x6e,0xa2,
+0x6f,0x4d,0x2f,0x88,0x5b,0x5f,0xdf,0x94,0x94,0x1d,0x74,0x5c,0xac,0x93,0x96,0xae,
+0xdf,0xe3,0x8,0xf0,0x49,0x4b,0xd9,0x4b,0xbb,0xb8,0x2e,0x75,0xed,0x72,0xc5,0xc1,
+0xd3,0x42,0x94,0xd2,0x79,0xc6,0xc1,0x53,0x22,0xb5,0x5f,0xb8,0x96,0x74,0xb1,0x48,
+0xb0,0xd5,0x39,0xad,0xb0,0x88,0xc0,0x4e,0x9e,0x52,0x38,0x2c,0x8e,0xa4,0x46,0x15,
+0xd6,0x79,0x9f,0xc6,0x7,0x15,0x66,0xe5,0x83,0xc1,0x6,0x3,0x38,0x7d,0xbc,0x7d,
+0x6,0xe2,0x9e,0xc9,0xc4,0x38,0xc4,0xd1,0x6a,0xee,0x28,0xc4,0x7e,0x6e,0xc,0x43,
+0x6c,0xaa,0x27,0x31,0x84,0x73,0x73,0xc,0xe1,0x33,0xf9,0x77,0xeb,0xd3,0x83,0xd8,
+0xa,0xfc,0xee,0x21,0x6f,0x52,0xc6,0x1a,0x84,0xdc,0x23,0xee,0xa4,0xa4,0x7d,0x88,
+0x85,0x81,0x17,0xe0,0x39,0xa1,0x1,0x2,0x3c,0x55,0x1a,0xc3,0x58,0x9c,0xd,0x41,
+0x2c,0xe,0x88,0x21,0x16,0x2e,0xb5,0x10,0x8b,0x68,0x6b,0x84,0x7b,0xab,0x18,0x87,
+0x79,0x3f,0xc2,0x9a,0x71,0x14,0x61,0x96,0x99,0xc4,0xb8,0xbb,0x86,0x71,0x88,0x7f,
+0x14,0x61,0x56,0x79,0x1e,0xe3,0x74,0x1d,0xe3,0xe,0x8e,0x71,0x80,0x60,0x56,0x5e,
+0x43,0x4e,0xf7,0xfa,0x1d,0xc5,0xc3,0x30,0xc3,0x57,0x9,0x1f,0x68,0xed,0xe5,0xaf,
+0x66,0x1f,0x56,0x2e,0x11,0x3e,0x3e,0x23,0x2,0x62,0xdc,0x3,0x1e,0xcb,0xfe,0x10,
+0x74,0xcd,0xa,0xb6,0xfd,0xa1,0xe0,0x70,0x50,0xdb,0x50,0x9d,0xa8,0x61,0xfb,0x43,
+0x87,0x7d,0xa2,0xe5,0xd8,0x1f,0x9c,0xb0,0x1e,0xc7,0xfe,0xe0,0x84,0x74,0x38,0xe7,
+0x17,0x4e,0x4c,0x86,0xf3,0xbb,0x83,0x9d,0xf3,0xb,0xe7,0x7a,0xc7,0xfe,0xd0,0xe6,
+0x4c,0x90,0x7d,0x7e,0xd1,0xe9,0x9c,0x78,0x3a,0xf6,0x7,0xc7,0xe2,0x6a,0x9d,0x5f,
+0x68,0x95,0x9,0xd7,0xfe,0x20,0xc4,0x97,0x2d,0xae,0x59,0x44,0x2b,0xd7,0x7,0x59,
+0xa0,0x52,0x77,0x65,0x9c,0x2d,0x9c,0xbf,0x80,0x64,0x9c,0xf7,0xcb,0x84,0xa4,0xa0,
+0x75,0x7d,0x64,0x77,0x2b,0xf3,0x87,0xec,0xbd,0xbb,0xa9,0x7d,0x10,0x38,0x90,0x5b,
+0xe7,0x17,0x23,0x68,0x7f,0xdd,0xc,0xed,0xc7,0x62,0xbf,0xcd,0xcd,0x62,0xdc,0x5b,
+0xc7,0x78,0x1d,0x39,0xf,0xed,0x21,0xbf,0xa7,0xaa,0x8,0xeb,0x95,0x29,0x20,0x3f,
+0x66,0xb3,0x5,0x10,0xb0,0x93,0x24,0xf1,0xb4,0xe2,0xfc,0x15,0x92,0xb3,0xa7,0x6f,
+0x7a,0xfc,0x61,0x5,0xf8,0x43,0xad,0x39,0x7f,0x98,0xc4,0xfc,0xa1,0x40,0xe2,0x3f,
+0xda,0xc8,0x29,0x2c,0x4d,0x32,0xc0,0x36,0x67,0xe3,0xab,0x88,0x3f,0x5c,0x45,0xf9,
+0xc3,0xf7,0x29,0x7f,0x18,0x45,0xeb,0x61,0x13,0xf8,0x7e,0xb9,0x3e,0x32,0x73,0xcd,
+0xd7,0xff,0x62,0xfc,0x21,0x33,0x4b,0x9e,0x3f,0x86,0xfb,0x3,0xe2,0xfb,0x25,0x7e,
+0xe,0xc9,0xff,0xfb,0x4a,0xf5,0x18,0xc3,0xfa,0xf0,0x21,0xfc,0xfc,0xc2,0x64,0xf3,
+0xf7,0x87,0x89,0xbf,0x6,0xb0,0xaa,0x5b,0xeb,0x3f,0x37,0x85,0xb1,0x7a,0x80,0x85,
+0x23,0xc4,0x8c,0xd0,0xc2,0xcd,0x77,0xa0,0x78,0xf8,0x43,0x80,0x74,0x65,0xc0,0xa6,
+0x3a,0x64,0xd8,0xc6,0x7f,0x9c,0x3d,0x60,0xa8,0xfc,0xd,0x79,0xe1,0xe,0x17,0x50,
+0xe3,0x6d,0xd0,0x54,0x1f,0xa3,0x4d,0x31,0xf0,0x3c,0xb1,0x9f,0x47,0x3c,0x65,0xb7,
+0x71,0x5e,0xfb,0x73,0x60,0x90,0x90,0xde,0x64,0xaf,0xc0,0xb5,0xf5,0x5e,0xb3,0x87,
+0xdf,0x42,0xf7,0xbc,0x9d,0x93,0xe5,0x96,0x22,0xe7,0x8d,0xed,0xf3,0x7c,0x1e,0xfb,
+0x16,0xf8,0x5d,0xbb,0xc5,0x5a,0x4,0xee,0xdb,0x44,0xf7,0x36,0x19,0x2e,0x39,0x68,
+0x26,0x71,0x3e,0xd,0x3,0xb4,0xde,0x2b,0x2,0xbe,0xff,0x11,0xf6,0xef,0x6d,0x77,
+0xb7,0x70,0x3c,0xaf,0xe3,0xcd,0xfe,0x29,0xc7,0x3e,0x66,0xb7,0xf1,0x5,0x30,0x83,
+0xc9,0x9d,0x3c,0x7c,0x3a,0xdc,0xda,0x6d,0x8f,0x74,0x9e,0xc,0xb8,0x4e,0xc7,0x96,
+0x27,0xa1,0xa,0x90,0x6f,0x79,0x3c,0x61,0x31,0x0,0xd7,0x9e,0x2c,0x5,0x1b,0x15,
+0xe0,0x6b,0x45,0x77,0xbb,0xee,0x33,0xe6,0x95,0x62,0x6f,0x2a,0x4d,0x28,0x3,0xf3,
+0xf,0x63,0xec,0xa,0xb0,0x1,0xa5,0x79,0xbd,0xc4,0x81,0xc5,0xd5,0x67,0xb2,0xab,
+0xc6,0xa7,0x10,0x83,0xb8,0xad,0x75,0x95,0xcf,0x7d,0xf6,0x97,0xdc,0x3e,0x4,0x87,
+0x4b,0x5,0xb5,0xdb,0x91,0xcf,0x2e,0x83,0xb5,0xff,0xc3,0xd,0x88,0xb6,0x2f,0x54,
+0x56,0x7b,0xcb,0x73,0xb1,0xec,0x6,0x80,0xcb,0xd0,0x6f,0x90,0x20,0x48,0x8e,0x7f,
+0x58,0xf9,0x23,0xca,0x99,0x53,0xd3,0x63,0x9,0x90,0x29,0xc5,0xff,0x65,0xf4,0x3e,
+0xac,0xa1,0x91,0x1f,0x77,0x9c,0x60,0x1d,0x1,0xc2,0x71,0x82,0x75,0x97,0x6b,0x3b,
+0xcc,0x37,0x10,0xe2,0x83,0x89,0x59,0xb4,0x83,0x1d,0xc2,0x9,0x2,0x4a,0x63,0x78,
+0xcf,0x4b,0xd5,0xb0,0xf1,0xb9,0x93,0xe3,0xdd,0x26,0x8c,0xb,0x74,0x98,0x1f,0xb7,
+0x96,0xd2,0xc3,0xc8,0xd4,0x30,0x37,0xa,0xe3,0xa4,0x26,0xf2,0xcc,0x59,0xcc,0xcf,
+0x98,0x95,0x53,0x3d,0x22,0x4,0xa5,0x3e,0xf1,0xc5,0x75,0x67,0x12,0x65,0xf4,0x43,
+0xb0,0x2e,0x46,0x48,0xce,0xa4,0x8c,0x9f,0x8f,0xce,0x54,0x86,0x44,0xe4,0x8a,0x43,
+0xf,0x9d,0x93,0xa2,0x20,0x95,0x25,0x69,0x89,0x54,0x7e,0x89,0x53,0x22,0x8b,0xbe,
+0x95,0x19,0x44,0x84,0x5a,0xa7,0x8f,0xf6,0x8e,0xd9,0x99,0x8,0xa5,0x6b,0x74,0xe1,
+0xa0,0xa8,0xb7,0x65,0x29,0x95,0xa2,0x3,0xc6,0x60,0x64,0xd6,0x7a,0xbd,0xec,0x80,
+0x8f,0xc7,0x82,0x75,0x73,0x5e,0xfb,0x2d,0x85,0x62,0x38,0x28,0x2a,0x5a,0xc5,0x6d,
+0x16,0x60,0x76,0x20,0x6a,0xf6,0xb6,0x32,0xe8,0xe4,0x18,0xac,0x1c,0xef,0x9c,0x14,
+0x8f,0x74,0x14,0xc1,0xfc,0xb8,0x78,0x59,0xfa,0x98,0x93,0x98,0x24,0x35,0x25,0xd2,
+0x4d,0x27,0xc6,0x4a,0x36,0xc9,0xf6,0xcc,0x15,0xcc,0xce,0x76,0x4e,0x39,0x2e,0xd7,
+0x1d,0xd,0xe1,0x41,0x1f,0xad,0x39,0x3a,0x76,0x44,0x92,0x43,0xc8,0x4d,0x31,0x14,
+0x90,0x83,0xe1,0xe3,0xe,0x7,0xd2,0x2c,0xe7,0x31,0xa3,0xb6,0x26,0xe8,0x41,0xb3,
+0xb2,0xf9,0xee,0x70,0x33,0x6,0x59,0xe,0xe4,0x8a,0x5f,0x6e,0x13,0x6b,0x2d,0xa8,
+0x4,0x28,0xa9,0x20,0xee,0x4,0x2,0xbd,0xb8,0xa1,0x4,0x16,0x9c,0x79,0x43,0x10,
+0xaa,0x57,0xe6,0xd,0xf0,0x72,0x71,0x43,0x69,0x82,0x48,0x90,0x48,0x1b,0xf3,0x73,
+0x74,0xb9,0x39,0xf4,0xd3,0x44,0xf8,0xc3,0xf1,0x3c,0x99,0x39,0x24,0xb3,0xfa,0xf8,
+0x51,0x54,0x2e,0xab,0x9d,0xf7,0x6d,0x83,0xfc,0x22,0x33,0x8d,0x9c,0x70,0x7c,0x82,
+0xc,0x81,0xfe,0xd1,0x2e,0x16,0x40,0xb7,0xba,0x21,0x33,0x2d,0x69,0x60,0x14,0x5e,
+0xe,0x6e,0x68,0xb7,0xf8,0x65,0x77,0x63,0x8d,0x78,0x50,0xde,0x3e,0xc,0xff,0xe5,
+0x64,0xe2,0x51,0x5e,0x4a,0x96,0x1e,0xbf,0x53,0xe5,0xb,0x95,0xbc,0x55,0xb9,0xab,
+0xb3,0xf4,0xc,0x76,0x6a,0x12,0x37,0xec,0x4,0x6b,0x45,0x37,0x9e,0x85,0x97,0xb,
+0x4f,0x5a,0x9c,0xff,0xa5,0x8d,0x7f,0x1c,0x2d,0x2d,0xdd,0x20,0xd9,0x1c,0x53,0xe4,
+0xec,0xd0,0x93,0x27,0xcf,0xa6,0xb6,0x69,0xeb,0x17,0x77,0xbb,0xdb,0xb7,0xd5,0x66,
+0x17,0xc0,0xe,0xcf,0x7c,0x16,0xe1,0x9d,0xd,0x24,0x41,0x69,0x24,0x2,0xaf,0x8d,
+0x38,0xc1,0xe5,0xaa,0x4d,0x9f,0xb6,0xb,0xaf,0xff,0xf9,0x4f,0xc3,0xf4,0x91,0xc7,
+0xc6,0x9f,0x20,0x79,0x5a,0x82,0x46,0x7,0x4e,0x10,0x6e,0xb3,0xc8,0xd3,0x5e,0x1a,
+0x80,0xe,0xb5,0x6d,0xf6,0x78,0x34,0x16,0xc0,0x2d,0xd7,0xb6,0xf,0xe0,0xdc,0x7a,
+0x79,0x8e,0x75,0xf1,0x7c,0xb5,0x88,0xc6,0x2f,0x7f,0x9c,0xd8,0xb,0x3c,0xbc,0x34,
+0xfc,0x52,0xf3,0xf1,0xbe,0xa3,0x58,0x8c,0xaf,0x22,0xf2,0xa0,0xf9,0xb5,0x4b,0xd8,
+0xb0,0xca,0xd2,0xe4,0xf3,0x68,0xb9,0x1f,0x5a,0x1d,0x2a,0x44,0xd2,0x63,0xf8,0x68,
+0xb4,0xeb,0xbc,0x72,0x4b,0x47,0x31,0xa6,0xe5,0xa7,0x3a,0xc9,0x39,0x72,0x84,0x98,
+0x82,0x69,0x3d,0x27,0x51,0xc0,0x71,0x49,0x5f,0x44,0x33,0x92,0x2f,0xf6,0x45,0x34,
+0xe3,0xf9,0xa2,0x5f,0x94,0x20,0x5f,0x14,0xfa,0xf4,0x6a,0xe2,0xf,0x5d,0x24,0xd3,
+0x41,0x92,0x63,0x66,0x7e,0x45,0x91,0x30,0x77,0xe6,0xe1,0x33,0xc1,0x5d,0x3,0x18,
+0xcf,0x1f,0xef,0xe2,0xd0,0x6a,0xdb,0x43,0x6e,0xc4,0x14,0x1b,0xe2,0x75,0x2c,0xc0,
+0x37,0xd0,0x96,0x1c,0xe2,0xcf,0x65,0xa0,0x7,0x5c,0xba,0x66,0x2a,0x14,0xdf,0x2,
+0x3b,0xee,0x17,0x19,0xbb,0x5e,0x5d,0x20,0x23,0xb1,0x7c,0xc6,0xb7,0x5c,0x61,0x41,
+0x2e,0xa7,0x4b,0x9d,0x23,0x4a,0xbf,0xb5,0x33,0x6b,0x5e,0x3e,0xe,0xaf,0x79,0x6d,
+0x5e,0xb3,0x93,0xd5,0xb8,0xab,0x89,0xa4,0x57,0x76,0xce,0x17,0x7e,0xfe,0xc5,0xb3,
+0xe7,0x53,0x18,0x6f,0x23,0xfb,0xaf,0x4e,0x13,0x23,0xed,0x22,0x12,0x82,0xbf,0x4e,
+0x54,0xeb,0x9b,0x87,0xbd,0x69,0xf3,0xda,0x1b,0x6e,0x6f,0x3e,0x70,0x18,0x66,0xd8,
+0x11,0xe5,0x55,0x1a,0x60,0x87,0x4c,0xfc,0x24,0x7b,0x3f,0x34,0xf0,0xbe,0x49,0x5c,
+0xb3,0x58,0xcd,0x53,0x48,0xb3,0x81,0xfb,0x8a,0x45,0x60,0xc0,0xa,0x1a,0x38,0x21,
+0x64,0xba,0xf1,0xf9,0x81,0x1,0x43,0x61,0xb9,0x51,0x29,0xec,0x13,0xde,0x9e,0x9a,
+0xba,0x3e,0x20,0xa4,0x43,0x64,0x6e,0x1b,0x12,0x16,0x32,0x70,0xff,0x8b,0x4c,0x2f,
+0xc3,0xe7,0xf3,0x67,0xca,0xd3,0x6,0x7a,0x7f,0x63,0xc8,0x80,0xf6,0xb7,0x3f,0xea,
+0x6f,0x29,0x7d,0x93,0xf4,0x36,0x73,0x6a,0xb9,0xb1,0xef,0x0,0xcc,0x77,0x9b,0x39,
+0x95,0x47,0xee,0xc7,0x99,0xb9,0x7a,0xf6,0x61,0xa0,0xf3,0x67,0xf8,0x28,0xaa,0x2f,
+0x90,0x11,0xec,0x8,0x1c,0x38,0x48,0xfb,0xa0,0xaa,0x87,0x63,0xd5,0xdb,0x5,0x9,
+0x44,0x32,0x63,0xc,0xd5,0x58,0x95,0xfd,0x1,0xb5,0xdd,0xe7,0xfd,0x2e,0xd4,0x9,
+0x90,0x43,0x48,0xba,0x5e,0x80,0x4,0x25,0x19,0x61,0xae,0x48,0x4f,0x83,0xfe,0x3d,
+0xc7,0x2,0x20,0x69,0x40,0x66,0x9a,0x3f,0x53,0x1,0xfe,0x18,0x99,0x53,0xd7,0xa3,
+0xfa,0x10,0x66,0xbb,0xfa,0xb7,0x3d,0xae,0x0,0xda,0xbe,0xe2,0xe7,0xe1,0xf6,0xf6,
+0x2e,0x6c,0xcd,0xa,0xf2,0x6a,0xf6,0x0,0xd8,0xb3,0x12,0x75,0x73,0xaa,0xba,0x80,
+0x7a,0x48,0xe3,0x3d,0x47,0x89,0xed,0x6a,0x88,0xd8,0x8b,0xfa,0x89,0x2c,0xdc,0xd7,
+0xf4,0x77,0x3f,0x31,0x3f,0x81,0xd4,0xba,0xb6,0x7d,0x80,0xe8,0xb7,0xdd,0xfc,0x16,
+0xa6,0x7d,0x14,0xf0,0x2e,0x83,0x17,0xcb,0x70,0xcf,0xbd,0x68,0x9e,0xfb,0x64,0xeb,
+0x25,0xa8,0xed,0x22,0x1e,0x1b,0xc9,0xf1,0xe5,0xc3,0x82,0x3d,0x40,0x2c,0xd8,0x3,
+0xc0,0x51,0xfe,0xfc,0x7d,0x6,0x8,0x5a,0x4a,0x99,0x8a,0xc6,0x56,0x8e,0xf3,0x4f,
+0xeb,0xa,0x5b,0xa9,0x83,0xd4,0xf5,0x56,0x35,0x67,0x55,0x94,0xdb,0x5a,0xf9,0xa9,
+0x71,0x45,0xf,0x71,0xd4,0x1f,0xfa,0xbb,0x5f,0xde,0xef,0xa6,0x7,0xb2,0xe9,0xd,
+0x4,0x1d,0x8b,0x57,0x5,0x40,0x7f,0x4,0xbd,0xee,0x5,0x38,0xc8,0x6b,0x4f,0x35,
+0x60,0x51,0x70,0xc1,0x1e,0xd0,0x78,0x78,0xec,0x81,0xf2,0x87,0xbb,0x19,0xe1,0xf,
+0xdf,0x86,0xb,0x76,0x2e,0x5b,0x0,0x26,0xe4,0x44,0x2d,0x6e,0xae,0x39,0xb5,0x48,
+0xb,0x82,0x35,0xa7,0xc1,0x7c,0x9,0x7a,0xe8,0x9c,0xc1,0xf3,0xd9,0x3e,0xa7,0x1e,
+0x27,0x5b,0x55,0xd1,0x3,0xc6,0xb4,0x5a,0x37,0xad,0xe6,0xbd,0x28,0x7f,0xd8,0xc6,
+0x4d,0x81,0xfc,0x4d,0xca,0x41,0x4f,0xaf,0xf0,0x67,0x9e,0x82,0xf9,0xfe,0x37,0x1b,
+0x28,0x7f,0x8a,0xb9,0x20,0x5a,0xac,0x40,0xce,0x76,0x6c,0x40,0xfd,0x7d,0x9c,0x8a,
+0xd5,0xc7,0x6b,0x45,0xc8,0x62,0xa3,0xd8,0xfc,0xcf,0x3a,0x88,0x7e,0x42,0xca,0xb5,
+0x77,0xed,0x9d,0x1b,0x80,0xee,0x98,0x29,0x8e,0x72,0xeb,0xb0,0x77,0x94,0xea,0xc5,
+0xc3,0x4d,0xee,0x6f,0x79,0xec,0x35,0xd2,0xfc,0xe6,0x7e,0x1,0xf6,0x23,0x91,0x8e,
+0xa,0xee,0x17,0x6d,0xfc,0xf9,0x2c,0xdc,0x2f,0xd2,0x73,0xc2,0x65,0x59,0xe1,0xca,
+0xb3,0xa8,0x80,0xda,0xfc,0xfd,0xa2,0x1f,0xf1,0x8f,0x37,0xb6,0x5f,0xa8,0xeb,0x7d,
+0x92,0xf8,0xd5,0x7e,0xc1,0xc,0xe1,0x5a,0x53,0x19,0x47,0xfc,0x21,0xc,0xfa,0xd3,
+0xcd,0xf7,0x77,0x15,0xc0,0xef,0x22,0x9f,0x7e,0x35,0x5,0xf6,0x87,0xcd,0x95,0xda,
+0x50,0x8a,0x38,0x85,0xe6,0x88,0x90,0x5d,0x51,0x4c,0xc8,0xc7,0xb0,0xf7,0x6d,0xe4,
+0x3f,0xdf,0x73,0x4d,0x5,0x1c,0xf0,0xca,0x82,0x4e,0xc0,0x7b,0x5b,0x64,0xe7,0xd8,
+0xdf,0xd2,0xfa,0x85,0x7e,0x7,0x74,0xdf,0xcf,0x9c,0xca,0x71,0xe8,0xee,0x9a,0x99,
+0xad,0x7f,0xe1,0x61,0x30,0x1e,0x19,0x53,0x97,0xd3,0x81,0x83,0x52,0x46,0x70,0x93,
+0x1c,0xd0,0x37,0x84,0x6e,0x9a,0x54,0xa,0xaa,0xd4,0x17,0x40,0xd2,0x70,0xf9,0xfe,
+0xde,0xa9,0x55,0x83,0x5b,0x5d,0x94,0xa4,0xa4,0xbd,0x18,0x3e,0xdb,0xcf,0x6f,0x75,
+0xec,0xd1,0x83,0x47,0xf,0xcd,0x70,0x9a,0xf0,0xcf,0xc2,0x71,0x4,0xaf,0x25,0x91,
+0x3a,0xe4,0xe8,0x88,0x15,0x3f,0xd5,0xf2,0xf6,0x28,0xf1,0x92,0xdd,0x8,0x7,0xc0,
+0x71,0x97,0xc0,0x99,0xb9,0x18,0xc4,0x11,0x38,0x26,0x99,0x53,0x5a,0x69,0x1a,0x3d,
+0x6f,0x2b,0xca,0xc5,0x93,0x19,0xaf,0xbc,0x84,0xde,0xd7,0xc0,0xbe,0x38,0x99,0x3a,
+0x4e,0xdd,0x93,0x19,0xc3,0xe5,0x5a,0xc5,0xf3,0x86,0x10,0xc6,0x5,0x5b,0xcd,0xfe,
+0x6c,0x81,0x36,0xa,0x13,0x6b,0xa5,0x19,0xfc,0x7d,0x51,0xd0,0x61,0xf9,0xbd,0x85,
+0xd9,0xf3,0x96,0x3f,0x78,0x78,0x6d,0xed,0x17,0x67,0x5d,0x9b,0xed,0xf7,0x1d,0x78,
+0x22,0xc6,0x7c,0x7,0xec,0x8c,0xdc,0xd2,0x5e,0xfd,0x92,0xd0,0x32,0x5e,0x74,0xe4,
+0xc9,0x6c,0xa9,0x71,0xb1,0xf9,0x87,0x75,0x4e,0x96,0x31,0x15,0x88,0x20,0x2f,0xf,
+0x3b,0x31,0x73,0x52,0x9e,0x94,0x5,0xbb,0xac,0xac,0xd8,0x52,0x9e,0x94,0xfa,0x45,
+0xe9,0xa8,0x2b,0x4f,0x4a,0xf9,0xbd,0x70,0xcc,0x5d,0x9f,0x39,0x11,0x3f,0x96,0x5f,
+0x15,0xd8,0x6b,0x94,0x1e,0x3c,0xfd,0xc2,0x6b,0xa0,0xe9,0x37,0xa1,0xfa,0xf0,0xa2,
+0x98,0x1,0xff,0x2c,0xd4,0xaf,0x5f,0xcd,0x56,0x80,0x85,0x2a,0x55,0x8b,0xa1,0xd,
+0xdb,0xaa,0xd7,0x77,0x5c,0xd9,0x1f,0xc4,0x56,0x9d,0x9b,0x50,0xf6,0x7,0x21,0x1d,
+0xa8,0x24,0x5e,0xd6,0xf9,0x44,0xef,0x8c,0xb2,0x3f,0x8,0x5a,0xec,0x99,0x5d,0xe8,
+0x77,0xcb,0x3e,0x99,0x4,0xf1,0x98,0xb2,0x1e,0x20,0xb0,0x57,0x4f,0x88,0x97,0x2a,
+0x7b,0x41,0xa2,0xd1,0xcf,0xde,0xa,0xe,0x41,0x2,0xbc,0xfe,0x14,0xa,0x0,0x78,
+0xb,0xe7,0x75,0x24,0xb1,0x6c,0xbf,0xad,0xcf,0xa3,0x2,0xb4,0x5f,0x9c,0xcf,0xe7,
+0x9b,0xe6,0xfb,0xd1,0x1,0xc6,0x99,0xca,0xe7,0xd7,0x3d,0xda,0xe2,0x4,0xe1,0xc3,
+0xf6,0xc9,0xf3,0xf2,0x3c,0x6b,0x39,0xcf,0x7,0x45,0xbb,0xe2,0x1b,0xad,0x2c,0x3f,
+0x7c,0xf2,0x31,0x86,0xf9,0x3,0xf4,0x58,0xce,0xcc,0x36,0xbe,0xf6,0x55,0x88,0x41,
+0xe6,0x5f,0x89,0x49,0xdc,0x5b,0x86,0x6c,0xcd,0x99,0xf1,0x15,0xd0,0x97,0xcf,0x0,
+0x7b,0x8d,0xb4,0xcb,0x1f,0x39,0xc,0xaa,0x69,0x88,0x74,0x2a,0xe8,0xc0,0xac,0x54,
+0xcb,0x66,0xcb,0xa,0xfb,0xc4,0xd6,0xa1,0xf7,0x81,0xed,0x19,0x9f,0xd,0x6,0x88,
+0xff,0x82,0xc6,0x5f,0xc1,0xbb,0x73,0x9a,0x37,0x50,0x35,0x12,0x7f,0x81,0x93,0x6c,
+0x10,0xd7,0x94,0x88,0xcd,0x47,0xaf,0x90,0x39,0x4c,0x53,0x1a,0x53,0xdb,0x57,0xe8,
+0xaf,0xc4,0x91,0x85,0x12,0x77,0x43,0xbc,0x56,0xac,0x80,0x3e,0xf9,0x4b,0xa8,0x58,
+0x88,0xd9,0x2e,0xfb,0xc4,0x95,0x6b,0x69,0x3a,0xe9,0x7e,0x95,0x1e,0x5b,0x12,0xee,
+0xca,0x4d,0xa2,0x80,0x9f,0x24,0xcc,0x3d,0x2d,0x38,0x5f,0xa5,0x56,0x2c,0xf6,0xfd,
+0xfc,0xcf,0x3f,0xeb,0x38,0x49,0xc2,0x31,0x7a,0x6a,0x78,0x7a,0x23,0xf8,0x7b,0x18,
+0xbb,0x99,0x73,0xaf,0x14,0x67,0x93,0xfd,0xa2,0xf,0x1b,0xbd,0xa4,0x56,0xe,0xce,
+0x3,0xcf,0x39,0x3e,0x8e,0x19,0x82,0x65,0xca,0x0,0xf2,0xcc,0x94,0x60,0x5a,0xe0,
+0x7c,0xd3,0x94,0x1d,0xaf,0x37,0xa0,0xfc,0x50,0x7f,0x1a,0xc9,0xf,0x77,0x72,0xfe,
+0x75,0x78,0xde,0xa9,0x5d,0xf3,0x5b,0x1e,0x15,0x28,0xfe,0xb9,0x5b,0xfd,0xc9,0x5c,
+0xc9,0x3d,0x31,0x85,0xf5,0xc1,0xfc,0x29,0x24,0x2f,0x6a,0xa0,0x20,0x5b,0xe9,0xb8,
+0x23,0x34,0xda,0xf3,0x63,0xae,0xd7,0x36,0xe0,0x6f,0xdb,0x3d,0x7,0xd5,0x47,0x4b,
+0x55,0x80,0xd3,0x23,0x14,0x4a,0x70,0xbc,0x2c,0xce,0x9a,0x7d,0xd8,0x40,0x3d,0x86,
+0x2b,0x30,0xf6,0xce,0x74,0x22,0x97,0x8e,0xb6,0x7a,0x6a,0x12,0xef,0x58,0xaa,0x18,
+0x97,0x9c,0x6f,0x83,0x4,0xe0,0xe4,0xb9,0xa7,0x5f,0x2e,0xac,0x5d,0x8,0x67,0x98,
+0x81,0x7e,0xfb,0x3f,0x44,0x35,0x3d,0x31,0x45,0x26,0x4f,0xee,0x99,0xb1,0x47,0xb7,
+0xcf,0xd4,0x16,0xa7,0x5c,0xbe,0xac,0x99,0x73,0xd5,0xde,0x30,0x27,0x24,0x67,0xf,
+0x7a,0x79,0x94,0xf5,0x4c,0x9b,0x37,0x95,0xed,0x94,0x1f,0xe6,0xdf,0x27,0x4f,0x88,
+0x8c,0xb5,0xb6,0x8a,0x6a,0x2e,0xc5,0xdc,0x68,0x69,0x38,0xe0,0x4c,0x42,0xcf,0x34,
+0x2b,0xf,0x65,0xe,0x45,0x1c,0x92,0x69,0xaf,0x6a,0x3c,0x9e,0x38,0xee,0xba,0xed,
+0x84,0xf9,0x5,0x75,0xd6,0x39,0xe1,0x5a,0x8c,0xfc,0xfc,0xda,0x59,0x16,0x9d,0x51,
+0x66,0x66,0xe3,0x81,0x49,0x16,0xac,0x29,0xe3,0x62,0xc9,0x94,0x2e,0x7c,0x5c,0x51,
+0x68,0x46,0x18,0x23,0xc,0x45,0x52,0x9,0x41,0xe,0x5,0xa5,0xf0,0x76,0xa,0x69,
+0x22,0x5d,0xf7,0xa6,0xfe,0xf4,0xd6,0x28,0x19,0x67,0x75,0x99,0xbb,0x5f,0x88,0x70,
+0x7f,0x54,0xe4,0x2c,0x35,0x2b,0x52,0x44,0xc4,0xc1,0xfa,0x1e,0x92,0x36,0x20,0xa5,
+0x70,0x9e,0xc,0xa1,0x5,0xb8,0xb3,0x96,0xac,0xe1,0xf5,0xca,0x4f,0x92,0xf5,0x89,
+0xf7,0xef,0x3c,0xf6,0xe8,0xa,0x72,0xe,0xd9,0x85,0xf9,0xbc,0x34,0x3a,0x7d,0x2a,
+0x9f,0x8c,0xc2,0x7,0x44,0xf8,0xa0,0x56,0x1,0x2f,0x10,0xfd,0x4d,0xa8,0xe,0xc8,
+0xef,0x1,0xf9,0xd,0xda,0xe5,0x69,0x5a,0x61,0xc2,0x9b,0xf9,0x37,0xb6,0x5f,0xb4,
+0xcb,0xa1,0x54,0xf6,0x40,0xcb,0x1e,0x50,0x38,0xa1,0xb8,0xef,0x41,0x14,0xf,0xc1,
+0x44,0xed,0x4e,0xe8,0x24,0x2d,0xb6,0x1a,0x58,0xaf,0x53,0x3c,0x10,0xe6,0x8a,0x16,
+0x8c,0xa2,0x0,0x6b,0xe8,0x19,0x7,0x35,0xa4,0x4f,0xe4,0x4e,0x60,0x9f,0xeb,0xde,
+0x29,0x54,0xfe,0x93,0xb5,0xd5,0x70,0xea,0xe9,0x0,0x2f,0xe3,0x92,0x7c,0x15,0xa2,
+0x9e,0x64,0xc8,0xfe,0xd0,0x4b,0x34,0x64,0x9a,0xc9,0xba,0x80,0x1f,0xe7,0xc3,0xdb,
+0xcd,0x65,0x1f,0xc3,0x1,0xc9,0x65,0x8e,0x6f,0x7f,0xe8,0x48,0x7f,0x6b,0xf3,0x7,
+0x9c,0xe,0x3e,0x44,0xd2,0xbf,0x7,0x44,0x35,0xd4,0xa,0x4e,0xf8,0xa2,0x1b,0x78,
+0xc1,0x6f,0x23,0x3,0x5e,0x9a,0x24,0x12,0x3e,0x76,0x99,0xcf,0xd0,0xdc,0x14,0xb8,
+0xe2,0xe2,0x2e,0x1c,0x5f,0x36,0xef,0x65,0x8d,0x25,0xbd,0xac,0x9d,0x7c,0x4f,0xfb,
+0x5a,0x48,0x6f,0xef,0xc3,0x1e,0xb5,0x17,0x11,0x8d,0xa9,0xd0,0x40,0x1e,0xb5,0x1a,
+0x19,0x60,0x1f,0x71,0x51,0xf6,0xcf,0xb,0x71,0x38,0x33,0x4c,0x5d,0xa2,0xdb,0xd0,
+0x2,0xd2,0xf7,0x20,0x77,0x5,0x53,0x3e,0xc0,0xa7,0x7,0xfe,0x3,0xc6,0x4b,0xf8,
+0x6b,0xb7,0x91,0xbd,0x3d,0x44,0x52,0x10,0x2c,0x77,0xff,0x7d,0x64,0xff,0xd2,0x8,
+0x7f,0x61,0xe5,0x39,0x1c,0x7f,0xb9,0x8b,0x6a,0xac,0x7b,0x56,0x30,0x5b,0xad,0xef,
+0x5e,0x32,0x3a,0x75,0xf,0xb7,0x12,0xa6,0xf3,0xb7,0x3c,0x2,0x1f,0x5c,0x5f,0xd,
+0xb4,0x9f,0x5,0x8b,0x6,0xe1,0x7e,0xdb,0xc8,0xfe,0x18,0xe6,0x74,0xbd,0xc5,0x96,
+0x15,0x53,0xfe,0xe0,0xa3,0x9,0x16,0xa,0x73,0xb7,0xa1,0x3b,0x42,0x6,0x5e,0x5f,
+0xe9,0xc6,0x61,0xf8,0x8d,0xb4,0xb6,0x76,0x60,0x5e,0x48,0xd7,0xf2,0xf6,0x9f,0x8e,
+0x4f,0x1b,0x9a,0x51,0x7f,0xb6,0x34,0x8b,0xaf,0xc6,0xc9,0x76,0xfd,0xd9,0xff,0xee,
+0x49,0xa1,0xcd,0x5a,0xe0,0x91,0xa2,0xb0,0x7f,0x7,0xed,0x7d,0xdc,0x57,0x36,0xf7,
+0xeb,0xc7,0xe3,0x17,0x94,0x6d,0xbc,0xae,0xf1,0x85,0xfb,0x45,0x48,0xaf,0x23,0x6,
+0xac,0x33,0xff,0x3e,0x50,0x52,0x19,0x42,0x7d,0xf2,0xcf,0x1,0xcf,0x44,0xe0,0x35,
+0xaf,0xad,0x86,0x76,0x19,0xd1,0x8f,0xca,0xaf,0x2f,0xd,0x5f,0xb6,0x44,0xfd,0xea,
+0x66,0xb2,0x9b,0xd0,0xf4,0x4d,0xd4,0x8d,0x8d,0x38,0x38,0x4b,0x83,0xe8,0x99,0xf4,
+0xf7,0x6c,0xe3,0x55,0xc0,0xa1,0xc9,0xf9,0x4c,0xdb,0xe8,0x92,0x70,0xe0,0xc1,0x57,
+0xe0,0x1,0xa7,0x4c,0xd0,0x30,0x4,0xcd,0x47,0x7f,0xfb,0x7c,0x79,0x18,0x48,0xb,
+0x7f,0xdf,0x36,0xaa,0x2b,0x1a,0xe8,0x6c,0xc4,0xd0,0xf3,0x92,0x33,0xf8,0xf9,0x99,
+0x71,0x8c,0xf3,0xa7,0x30,0x2e,0xbc,0xde,0xfc,0xf7,0xcc,0x4,0xc6,0x89,0x59,0x8c,
+0xdb,0x79,0x1f,0xc2,0x3e,0xfe,0x72,0xdb,0xe8,0x26,0xd0,0xff,0x14,0x7f,0xed,0xa7,
+0x50,0x9,0xd5,0xb,0x9c,0xd7,0x10,0xd,0xbf,0xf3,0x1f,0x62,0x67,0x32,0x7e,0xcc,
+0x17,0x3f,0xa7,0xd3,0xaf,0xfd,0x41,0x11,0x3a,0x34,0x9,0xf5,0x87,0x83,0x3,0x61,
+0xcd,0xa8,0x66,0x1f,0x38,0x5,0xc5,0x27,0x73,0x41,0x82,0xef,0x6f,0x23,0xe2,0x54,
+0x27,0x11,0x88,0xd7,0x55,0xcf,0x8,0x1f,0x28,0x35,0x8a,0x45,0x70,0xe6,0x2a,0xcb,
+0x31,0x80,0xee,0x5c,0x96,0xac,0xd,0xc,0xf4,0x2f,0xdf,0xfb,0x8,0xd6,0x6,0xc4,
+0xf3,0x55,0xfd,0x78,0xbf,0x15,0x2f,0x3c,0xb9,0x10,0x3e,0xef,0xdb,0x7a,0xf0,0xa7,
+0x58,0x2d,0x3f,0x90,0xe5,0x66,0xfe,0x35,0xe6,0xa,0xf3,0x8f,0x5e,0x98,0x7d,0xf7,
+0x56,0xe5,0x60,0x96,0xae,0x19,0xbc,0x1,0x42,0x28,0x82,0xbc,0xfe,0x3f,0xa0,0xff,
+0x99,0x70,0x88,0x88,0x0,0x8b,0x83,0xcc,0x2f,0x8,0xf8,0x89,0xc8,0x74,0xcd,0x32,
+0x6a,0x45,0x75,0x8,0x53,0x71,0x5a,0x69,0x10,0x6d,0x42,0x3b,0xca,0x83,0xfc,0x2d,
+0x8d,0x38,0xca,0x37,0xa3,0xf1,0x1f,0xfe,0x5f,0x77,0x2,0x92,0xdd,0x2a,0xe7,0xd3,
+0xbd,0x5f,0x2b,0xbf,0xfc,0x27,0xfc,0x7f,0xa7,0xdc,0x82,0x4c,0x21,0xd9,0x35,0xa0,
+0x92,0x58,0xb1,0x94,0xbf,0xb3,0x56,0xa7,0x33,0x68,0x25,0xae,0xbe,0xbd,0x1f,0x29,
+0x7b,0xc0,0xc2,0x2b,0xcf,0x95,0xba,0x95,0x8a,0x24,0xce,0x1b,0xa1,0xff,0x73,0x5b,
+0x4d,0xb0,0x90,0x11,0x64,0xad,0x82,0xf3,0x29,0xdc,0xe2,0x7b,0xa1,0x6,0x6b,0x82,
+0x82,0xda,0xd2,0xb5,0xec,0x3,0x8d,0x8d,0xfc,0xf0,0xbd,0x4a,0x39,0xe4,0xfc,0x0,
+0x48,0xf7,0xaa,0xd,0xc,0xe4,0xf9,0x14,0xa,0x19,0xef,0x26,0xfa,0x63,0x18,0xea,
+0x8f,0x3a,0x49,0x17,0xab,0x17,0x8b,0x4f,0xf1,0x67,0x8a,0x47,0x90,0x7e,0x48,0xf5,
+0xcd,0xe5,0xc5,0x6b,0xab,0xad,0x76,0x7b,0x55,0xe0,0x88,0xf7,0x7d,0x67,0xb5,0x5d,
+0x5b,0x3c,0xc,0xe9,0x3b,0x4a,0x76,0xc3,0x4c,0x75,0x60,0xcf,0xf7,0xa0,0xf8,0x6b,
+0xae,0x6d,0xd,0xe2,0x43,0x44,0x9c,0x27,0x5b,0xe9,0xa5,0x1c,0x47,0x20,0x5e,0xcc,
+0x1b,0x48,0x5c,0x2d,0x3f,0x6e,0x54,0x81,0xf4,0x12,0xac,0xc7,0x36,0x73,0x60,0x70,
+0x8e,0xce,0x30,0xf6,0x56,0x60,0x60,0x6e,0x9b,0xb3,0xcf,0xc0,0xdc,0xc5,0x69,0x3e,
+0x2d,0xa7,0xfa,0xa0,0x55,0x66,0x62,0x70,0xbb,0x60,0x5b,0xf8,0xf7,0xfc,0xc8,0xc0,
+0xf5,0x71,0xfe,0x6f,0xe8,0xc4,0x48,0xcb,0x11,0x7b,0x97,0xaf,0x42,0xdc,0xe7,0x76,
+0xd2,0xea,0x68,0xd0,0x40,0x17,0xb7,0x5c,0x32,0xdc,0xf6,0xb7,0x7f,0x71,0xd,0xca,
+0x90,0x5d,0xe0,0x24,0xbf,0xc6,0xed,0x4f,0xde,0xba,0x9a,0xd6,0xbf,0xff,0x2a,0xac,
+0xd1,0xf5,0x54,0x59,0xe9,0x54,0x13,0x1c,0xbe,0x9b,0xed,0x1b,0xf1,0xc4,0xa4,0xf3,
+0xab,0xd,0xc,0x20,0x92,0x31,0x69,0x7a,0xe,0x48,0x60,0x85,0xff,0xd8,0xbd,0xfd,
+0x8f,0x55,0x8,0xee,0xa5,0xb2,0xf6,0xe2,0xf5,0x4e,0xa,0x1d,0xed,0x85,0x38,0xeb,
+0x1a,0x88,0xe9,0x2f,0xd8,0x17,0x44,0x4e,0xb2,0x77,0x8a,0xa,0x99,0x3b,0xed,0x45,
+0x9a,0x18,0xa,0xf1,0x27,0xae,0x7e,0x38,0x16,0xb4,0x57,0xdd,0xff,0x74,0xbc,0xa5,
+0xfe,0xd3,0xc2,0xcf,0xb3,0xc2,0xa8,0xfd,0x83,0x7c,0xdc,0x24,0xb3,0x33,0x50,0xa7,
+0xe4,0x3,0xf5,0x9,0x66,0x2f,0xef,0x64,0xfc,0x74,0x98,0x4d,0xb1,0x8a,0xb5,0xfe,
+0xd2,0xd6,0xf3,0xfe,0x99,0xe5,0x2d,0xb,0xc4,0xff,0x6b,0xe1,0x3b,0x63,0x3b,0xcd,
+0xbe,0xfb,0x62,0xda,0x8f,0x6c,0xf1,0xe3,0xa0,0xdf,0xf8,0xc9,0xfd,0x95,0x58,0xc4,
+0x3e,0x86,0xe,0x4e,0xb2,0xcd,0x15,0xfe,0xff,0xb1,0x94,0xb3,0x8a,0xf3,0xf2,0x3f,
+0x2,0xb3,0x4a,0xa2,0x8d,0xb,0xad,0x52,0xf1,0x9c,0xeb,0x6b,0xd9,0x6c,0xe9,0x65,
+0xa8,0xa0,0x19,0x8d,0xaf,0xac,0x91,0xfa,0x17,0xec,0xc2,0x87,0x8a,0xb7,0x20,0x7e,
+0x5f,0x2d,0xa1,0x13,0xe0,0xf7,0xcc,0xb7,0xf0,0x74,0x40,0x17,0x54,0xfd,0xc6,0xe2,
+0xd3,0x90,0x3f,0xa6,0x4d,0xfe,0x8,0xb0,0xde,0x18,0x62,0xed,0x0,0x7,0x4d,0xde,
+0xda,0x9,0xb1,0xa9,0xdd,0xa5,0xe1,0xf5,0x7c,0xff,0x9e,0x6,0x79,0xde,0x1d,0x13,
+0xe8,0x7d,0xef,0xf6,0x35,0x71,0x60,0xd6,0x88,0xf6,0xa7,0x89,0x6c,0xae,0x9f,0xf6,
+0x56,0xfc,0x6a,0x6a,0x71,0xf9,0x3f,0xb5,0x3,0x1d,0x64,0x11,0xb8,0x3,0xe5,0xf,
+0x6a,0x5,0x80,0xb7,0x34,0xfa,0xb6,0x2,0x8a,0xd4,0xca,0xcf,0xe9,0x15,0x50,0x6f,
+0xf3,0xd2,0x5a,0xec,0xad,0x30,0x7b,0x76,0xf9,0x5b,0xac,0x2,0x5d,0xc2,0xf3,0x2f,
+0xb1,0xc2,0x4b,0x48,0xfb,0x18,0x8a,0xe0,0x84,0x1,0xd3,0xa0,0x9a,0x26,0xb3,0xa,
+0x30,0xa1,0x1d,0x7e,0xef,0x41,0xb6,0x17,0xf6,0xcf,0x37,0x2c,0xfe,0xe7,0xb5,0x73,
+0xd3,0xda,0x8a,0x76,0xb3,0xa7,0x68,0x9d,0x53,0xf1,0xd1,0x9e,0x92,0xb0,0x9d,0xc1,
+0x99,0xa6,0x59,0x2e,0x2f,0x33,0xf6,0x5a,0x4b,0xb6,0x90,0x49,0x39,0x70,0x31,0x47,
+0xa0,0x71,0x49,0xac,0x7e,0x93,0x74,0x86,0xbc,0x61,0x5a,0x61,0x79,0x52,0xec,0xeb,
+0x4a,0x9e,0xf4,0x71,0xde,0xf8,0x4b,0xa6,0xe4,0x49,0x5f,0x63,0xe0,0x93,0xd,0x20,
+0x4f,0xfa,0x84,0xfb,0xf4,0x90,0x92,0x27,0x5,0x2e,0xd,0x2b,0x79,0xd2,0xc4,0x3e,
+0xa3,0x4f,0xc9,0x93,0x3e,0x5e,0xe4,0x3f,0x4,0xf2,0xa4,0x8f,0xdf,0x27,0x4c,0x40,
+0xae,0x3c,0x69,0x5e,0x9f,0x3a,0x9,0xe4,0x49,0x13,0x47,0xaa,0x40,0x9e,0x34,0xb1,
+0x66,0xc,0x2a,0x79,0x52,0xbc,0x2f,0x7d,0x42,0xc9,0x93,0xda,0xbd,0x26,0x5d,0xdd,
+0xe5,0xc9,0x93,0xd6,0x76,0x5d,0x44,0xc7,0x3,0xac,0x7,0x1f,0xf,0x30,0xff,0x0,
+0x3e,0x1e,0xf0,0xda,0x1a,0x6f,0x9b,0x71,0xca,0x2a,0xdd,0xc0,0x29,0xad,0xda,0xa7,
+0xb5,0xc,0xd4,0x2f,0x12,0xa3,0x2c,0xa,0xed,0x35,0xe6,0xb2,0xa,0x42,0x13,0x54,
+0xd2,0x94,0x16,0xa1,0x3e,0xd0,0x31,0xc9,0x52,0xf0,0xc4,0xd9,0xcf,0x5f,0x68,0x20,
+0xfa,0xfa,0xcd,0x17,0xfe,0xd2,0x9b,0x84,0xd6,0x6e,0x97,0x13,0xd9,0x2b,0x7d,0xec,
+0xe7,0xc7,0x82,0xff,0xe4,0x44,0xd,0xbb,0xf8,0xe9,0xe5,0x47,0x8a,0xcf,0xf4,0x7d,
+0xa7,0xc3,0xdb,0x9b,0x78,0x4f,0xf9,0xed,0xa,0x25,0x4b,0xe9,0x5f,0xb,0x37,0xed,
+0xa6,0xe2,0x9f,0x41,0x1c,0xa9,0x7f,0x13,0xb9,0x3,0x7,0xe2,0x2c,0x41,0xcc,0xb7,
+0x6d,0xc4,0x22,0xdd,0x4d,0x22,0x62,0xa1,0xf2,0x28,0x9e,0x48,0xce,0x93,0xf3,0x38,
+0x60,0x38,0x32,0x87,0x76,0x5e,0x8d,0x94,0x3f,0x8b,0xf2,0x62,0xf1,0xef,0xa0,0xfa,
+0x58,0xc4,0xd8,0x6b,0xcb,0x4c,0xf,0x9f,0x2c,0x7e,0x5,0x2d,0x87,0x5a,0xd1,0x80,
+0xfe,0x9d,0x5a,0x8c,0x6d,0xa5,0x15,0xee,0x88,0xbf,0xed,0x5e,0x14,0xd0,0x10,0xe2,
+0x35,0xb8,0xdd,0x30,0x5f,0xb6,0xfc,0x2d,0x72,0x3f,0x49,0xce,0xe7,0x27,0xfe,0xba,
+0xa8,0x82,0x5e,0xf4,0x6b,0xd9,0xd2,0x8b,0x0,0x7,0xcb,0xfc,0xc7,0x9e,0x2f,0xe4,
+0x99,0xb5,0x1d,0x24,0xff,0x71,0x9,0x4f,0x50,0x98,0x14,0x44,0x4a,0xe2,0x80,0x15,
+0xcd,0xc0,0xe2,0x64,0xc8,0x5b,0x9e,0x5e,0x7b,0xe3,0xad,0x25,0xe2,0xfd,0x21,0x96,
+0xf9,0x2,0x71,0x3e,0x73,0xd,0xc4,0xf7,0xe7,0x4d,0xe9,0xf7,0x12,0x3e,0xe5,0x2e,
+0x99,0xfc,0xcf,0x1a,0x4f,0xf1,0x92,0x2a,0x78,0x90,0xff,0x6e,0x85,0xcf,0x46,0x95,
+0x4a,0x96,0x3f,0xe6,0xff,0x70,0x9c,0xfd,0x4e,0x1c,0xbd,0x1f,0x6e,0x97,0x4b,0xc4,
+0x77,0x8c,0xae,0xf8,0xc,0x62,0x93,0xcd,0x3b,0x85,0x70,0xa4,0x34,0xa,0x51,0x60,
+0xe2,0xb6,0x94,0xc2,0xbd,0xa2,0xda,0x5b,0xaf,0xc2,0x39,0x82,0xcb,0x8b,0xe0,0x12,
+0xc1,0x19,0x82,0xb7,0x11,0xec,0xab,0x60,0xcc,0x36,0x95,0x31,0x36,0x5,0x96,0x16,
+0xc3,0x7,0xfa,0x2e,0x39,0xe8,0x31,0x8e,0x37,0xd8,0xc2,0xc4,0x5f,0x65,0x5d,0x7d,
+0x69,0xd8,0x6b,0x5e,0x5b,0x5d,0xad,0x77,0x84,0x50,0x38,0xd1,0xcf,0x2,0x58,0x9e,
+0xde,0xff,0x4e,0x8c,0x69,0x3a,0x83,0x5f,0xbb,0x6d,0x45,0x4d,0x9f,0xdb,0xb3,0x48,
+0x71,0xd6,0x39,0x47,0x1b,0x98,0x76,0x5b,0x2f,0xd9,0xd0,0x7a,0x56,0x16,0x3f,0x52,
+0xae,0xa2,0x7a,0x3a,0x8f,0x14,0x71,0x7d,0x1d,0xaf,0x2d,0xb3,0xc2,0x79,0x33,0xf6,
+0x7f,0xb8,0xb4,0xf1,0x34,0xb2,0x1f,0x96,0xbf,0xc8,0x72,0x20,0x81,0x81,0x28,0x9f,
+0xde,0x36,0x8d,0x95,0xc7,0x20,0xb0,0x30,0x44,0xa7,0x45,0x5,0xd7,0x85,0x71,0xd8,
+0x54,0x26,0x43,0x40,0xa1,0xf4,0xf1,0x3e,0xb6,0xd,0x2a,0xb4,0xf9,0x97,0xdf,0x56,
+0x86,0xbb,0x6d,0x44,0xf8,0xd6,0xc0,0xe,0xfe,0xe2,0x3d,0xf1,0x66,0x9f,0xe3,0xf9,
+0x3f,0xac,0xee,0x16,0xc7,0xce,0xf,0xec,0x7d,0x31,0xf6,0x7,0x10,0xa7,0xbe,0xc5,
+0xd2,0xd0,0x42,0x75,0x69,0x3d,0x7e,0x29,0xf4,0x6f,0xd0,0x4a,0x2f,0x6a,0xe5,0xe7,
+0xa0,0x45,0xa2,0xd1,0xbf,0x5,0x79,0xec,0x98,0x1a,0x2,0x8c,0xb9,0xd2,0x2b,0x47,
+0x7d,0x6,0x38,0xe2,0xdc,0x55,0x8d,0xed,0x5,0x4,0x18,0x30,0xe,0x6,0xa0,0xc5,
+0x2d,0x39,0xc3,0x52,0xd0,0xa0,0x92,0x1a,0x62,0x69,0xe8,0x2e,0xf1,0x3b,0x8c,0xdd,
+0x70,0x5e,0xe9,0x87,0xf6,0x7e,0x71,0xdd,0x41,0xb4,0x5f,0x68,0x95,0x7e,0xb4,0x5f,
+0x84,0xe7,0x30,0x3f,0xef,0x3d,0x89,0x71,0x69,0x18,0xe1,0x40,0xd,0xf3,0xff,0x6d,
+0x13,0x18,0xe7,0x46,0x11,0xd6,0x81,0x83,0xbe,0xc0,0x92,0x3,0xdd,0xde,0xe7,0xee,
+0x17,0x42,0xbf,0xb1,0xf3,0xdf,0x8b,0xfd,0x42,0x76,0x2e,0xa5,0xb2,0x58,0x8a,0xce,
+0xe9,0x3f,0xca,0xbb,0x38,0x61,0x32,0xb4,0xf6,0x43,0xa,0x8b,0xce,0x3d,0x18,0x77,
+0xb1,0xe8,0x9c,0x7f,0x82,0xb9,0xb8,0xdb,0xdc,0xe0,0xbb,0x47,0x14,0xce,0x1d,0xb4,
+0xf3,0x24,0x5a,0x43,0xe0,0x13,0x9d,0xdb,0x91,0xcd,0x96,0xbf,0x66,0x11,0x76,0x9b,
+0xcd,0xce,0x9c,0xeb,0x1d,0xe5,0xcb,0xc1,0x37,0xf6,0x79,0xf4,0xb0,0xfc,0xf4,0xb0,
+0xe7,0xaf,0x6f,0x65,0x80,0x1e,0xda,0xf8,0xbf,0x59,0x5e,0x4e,0x36,0x3d,0x84,0xfa,
+0x41,0x66,0x58,0xab,0x73,0x1d,0x13,0x90,0x1e,0xcc,0x29,0x3e,0x5,0xe9,0x1,0xd8,
+0xd1,0xad,0xce,0x85,0xdd,0x5d,0xae,0x5b,0xa,0x7c,0x39,0xd7,0x4a,0x27,0xe8,0x81,
+0x45,0xdc,0x5d,0x4a,0xd2,0x3,0x53,0xe7,0xdd,0x92,0x1e,0xa2,0xf5,0x6c,0xf6,0x2e,
+0x40,0xf,0xed,0x6a,0x9b,0x6a,0x69,0x7a,0x70,0xed,0xd5,0x36,0x3d,0x38,0xf6,0x6a,
+0x97,0x1e,0x6c,0x7b,0xb5,0xa2,0x7,0xcb,0x5e,0xad,0xe8,0xc1,0xb2,0x57,0xbb,0xf4,
+0x60,0xd9,0xab,0x15,0x3d,0x58,0xf6,0x6a,0x40,0xf,0x52,0xe4,0x0,0xf4,0x20,0xec,
+0xd5,0x90,0x1e,0x84,0xbd,0x5a,0xf1,0x7,0xcb,0x5e,0xad,0xf8,0x83,0xb4,0x57,0x7b,
+0xfc,0xa1,0x95,0x5a,0x17,0x29,0x57,0x9c,0x9c,0x59,0x1a,0xee,0x5a,0xa4,0xdc,0xf1,
+0x25,0xc4,0x60,0xde,0x4b,0xce,0x53,0x12,0xe4,0xbc,0x25,0x45,0xce,0xdf,0xca,0x38,
+0x5b,0x71,0x94,0x9c,0x4c,0xe2,0x74,0x1d,0xa8,0x36,0x92,0x68,0x69,0x72,0xfa,0x52,
+0xc1,0xd9,0xc2,0x18,0x9,0x1e,0x63,0x32,0xd7,0x31,0x10,0xd0,0x4b,0x73,0x31,0xf6,
+0x7e,0xa0,0x42,0xed,0xe2,0xd5,0xa7,0xa1,0x4a,0x27,0xf2,0x5b,0xcc,0x41,0x89,0xcb,
+0x77,0xfb,0xfe,0xe6,0xa,0x67,0xea,0x45,0x8c,0x43,0xe4,0xfc,0x1,0x85,0xa3,0xc8,
+0x5,0xb7,0x48,0x76,0x74,0x22,0x7f,0x7,0x48,0x7a,0xac,0x36,0x8e,0x4d,0x3e,0xbd,
+0x35,0x1c,0xa0,0x96,0x19,0x7,0xe9,0x44,0xc5,0x8,0x1d,0xca,0xc3,0x31,0xf2,0xf3,
+0x21,0x94,0x71,0x2d,0xd2,0x88,0xa1,0x4,0x6f,0xdd,0x73,0xb0,0x7c,0x81,0xf4,0xb6,
+0xd6,0x61,0x84,0x4c,0xf9,0xb8,0xf5,0x7f,0x57,0x21,0x36,0x7f,0x4b,0xab,0x29,0xe,
+0xb,0xef,0xfb,0x1e,0xc5,0xbd,0x3a,0x1b,0xa6,0x42,0xf1,0x80,0x8a,0x31,0x4e,0x92,
+0xd3,0xe8,0x42,0x55,0x38,0x67,0xba,0x55,0x79,0xed,0xe4,0x58,0xae,0xc1,0x3a,0x64,
+0x49,0x29,0x6e,0xc1,0x85,0x76,0x8b,0x73,0x75,0x38,0x1,0x80,0x89,0x39,0xfb,0x32,
+0x5b,0xe6,0xb4,0xc3,0x8f,0x68,0xe,0x9a,0x15,0x6d,0x3a,0xf1,0x25,0x6d,0x23,0x24,
+0x9b,0xc3,0x7d,0xd3,0x8f,0xc4,0x3c,0x7a,0x58,0xc3,0xf4,0xa0,0x1b,0x38,0xfb,0xe5,
+0xb6,0xe9,0xd7,0x90,0x46,0x57,0x18,0x4a,0x42,0x5,0xde,0xff,0x38,0xb,0x3c,0xee,
+0xd1,0xc3,0xda,0xa5,0x87,0x3,0x5f,0x66,0x7,0xc0,0x8a,0xf,0xd7,0xf9,0xe1,0x9f,
+0x81,0x9f,0x3b,0x8e,0x5d,0x4,0x3,0x20,0x99,0xbf,0x8f,0x75,0xc5,0x3c,0x7a,0x58,
+0xb3,0xf4,0xe0,0xcf,0xc6,0x37,0xdf,0xd,0xc5,0x7,0xde,0xdf,0x3b,0xdb,0x4,0xeb,
+0x3,0xb1,0x45,0x24,0x34,0x8f,0x1e,0x5a,0x9a,0x3f,0x4,0x2a,0xff,0x81,0x25,0xde,
+0x9f,0x54,0x46,0x20,0xfe,0x59,0x6c,0x2b,0xa,0xa8,0x9b,0xc1,0xe,0xaf,0xba,0x39,
+0xfe,0x68,0xc3,0x29,0xdd,0xf6,0x71,0x74,0x64,0x70,0x29,0xc7,0x29,0x5b,0x97,0x4c,
+0xf,0x47,0x9b,0xd3,0x3,0x5f,0x84,0x1e,0x26,0x17,0xa1,0x87,0x83,0x4b,0xa2,0x87,
+0xd4,0xda,0x97,0x27,0x97,0xbb,0x5d,0x6e,0x87,0x3c,0x39,0x6c,0xa2,0x64,0x7b,0x88,
+0x8e,0x3b,0x33,0xf0,0x3,0x3,0xe2,0x30,0xef,0x2f,0x40,0x95,0xad,0xbb,0xc6,0x10,
+0x4e,0x4f,0x61,0x5c,0x3e,0x81,0xb0,0xdf,0x9c,0x6c,0x88,0xa3,0x26,0x31,0x40,0xdc,
+0x53,0xb5,0x82,0xe4,0x1d,0x27,0xc,0x51,0x0,0xd,0xe2,0x8a,0x49,0xbc,0x85,0x49,
+0xe1,0xe1,0xda,0x67,0x71,0x33,0x73,0xaa,0xc1,0xfd,0x6d,0xfc,0xb,0xd9,0x2c,0x28,
+0x80,0x93,0xe0,0x38,0xc1,0x50,0x5e,0xd0,0x83,0xe1,0x62,0x4d,0x52,0x86,0xba,0xdf,
+0xa,0xdd,0x53,0xd8,0x22,0x4,0xeb,0x7d,0xbb,0x5d,0xe5,0xb8,0xe0,0x66,0x29,0x2e,
+0x8c,0x61,0xbc,0x6,0x9a,0x7e,0x53,0xf1,0x8,0x48,0x0,0xa6,0xc9,0x8f,0xfb,0x6,
+0x54,0x90,0xb3,0xf7,0x1b,0x6e,0x8e,0x4d,0x9f,0x31,0x1b,0x13,0x3c,0xca,0xc1,0xed,
+0xd6,0xd2,0xbb,0xc8,0xa5,0x6,0xe2,0x3e,0x5b,0xc6,0xa7,0xbd,0x1a,0x3e,0x3e,0x35,
+0xa9,0x3,0xf1,0x16,0x98,0x3a,0xde,0xc6,0xc3,0x4d,0x7f,0xf,0x10,0xf3,0x80,0x6f,
+0x9e,0xfe,0x4f,0xec,0x3,0x5,0x62,0x9d,0x48,0x58,0xc,0x40,0x53,0xec,0x4b,0xda,
+0x29,0xf7,0x2a,0xf6,0xd9,0xb8,0x95,0x69,0xd7,0xa9,0x1c,0xa3,0x17,0x73,0xde,0xe0,
+0x1c,0x7c,0xe5,0xdb,0xcd,0xe1,0xaa,0xc2,0x23,0xf,0xff,0xde,0x7f,0xc0,0xef,0x8,
+0x12,0xb,0x88,0xf,0x27,0x94,0xd8,0xff,0xe,0x8c,0xd,0x8e,0x2d,0xa,0x97,0x35,
+0x37,0x40,0x94,0xc8,0x17,0x6f,0x9b,0xa6,0xfa,0x7,0x31,0x90,0x5d,0xd1,0xcc,0x1b,
+0x67,0x87,0x64,0xd,0x4a,0x20,0xb1,0xf6,0xdb,0xb9,0x85,0xf1,0x12,0xad,0x4b,0x4b,
+0xc6,0x90,0x15,0x9d,0xe,0xcf,0xe,0xc0,0xfc,0x5e,0x67,0xbf,0x3f,0xf2,0x7d,0x57,
+0x91,0xfe,0x34,0x16,0xc4,0xe7,0xa0,0x5,0x71,0x81,0x7,0x96,0xc0,0xe4,0xa4,0x55,
+0x70,0xbe,0xc0,0x60,0x53,0x6d,0xd3,0xa3,0x87,0x56,0xa7,0x87,0x30,0xae,0xef,0xc1,
+0x52,0xff,0x84,0xec,0x51,0xfa,0xcf,0x62,0x85,0x21,0x28,0xbf,0x7d,0x5d,0xfc,0xcf,
+0xa3,0x87,0xb5,0x4a,0xf,0xa1,0x7b,0xd9,0x1e,0xa8,0x20,0x76,0xd6,0xa1,0x7b,0xf0,
+0x7c,0xec,0xbb,0x8a,0x6d,0xbf,0xd2,0xa3,0x87,0x35,0x4a,0xf,0x6d,0x44,0x5c,0xd3,
+0x2a,0x24,0x4e,0x6c,0x27,0xf1,0xd6,0xf3,0x3d,0xd9,0xfc,0x81,0x34,0x38,0xe3,0xac,
+0x8f,0xef,0x1a,0xc7,0x2b,0xde,0x32,0xd8,0xdd,0xd2,0x47,0xea,0xbb,0x6c,0x23,0xb2,
+0xec,0x1d,0x43,0x1e,0x3d,0xac,0x65,0x7a,0xc8,0xe1,0xe8,0xb6,0x40,0xd,0x9f,0x66,
+0xee,0x7c,0x36,0x8a,0x14,0xaa,0x87,0xe2,0xec,0xa1,0x98,0x47,0xf,0x6b,0x96,0x1e,
+0x6e,0x1f,0xf2,0xa3,0x62,0x3a,0xc6,0xb1,0x8,0xca,0xae,0x48,0xf1,0x65,0x7d,0xfa,
+0x80,0x47,0xf,0x6b,0x79,0xbf,0x58,0xe6,0xb6,0x39,0x9b,0xbd,0x17,0x52,0x8c,0x88,
+0xbf,0xe2,0x75,0x25,0xb0,0xf6,0x36,0x8a,0x4f,0x99,0x7f,0xe3,0x5a,0x81,0x7a,0x45,
+0x42,0xd0,0xf7,0x29,0x1,0xb3,0x57,0xfe,0xd7,0x5e,0xd7,0x6c,0x64,0x61,0x3f,0x3f,
+0x81,0xb0,0x32,0x3,0xd9,0x38,0x59,0xc5,0xb8,0xc7,0xb6,0x89,0xdf,0x98,0xab,0x65,
+0x5,0xc1,0x77,0xda,0x6,0xa0,0x8a,0xed,0xa7,0xd4,0xc1,0xf1,0xef,0xe,0x76,0xee,
+0x5f,0xd7,0xc0,0xd8,0x2d,0x7a,0x67,0x63,0xd7,0x8d,0xc5,0xc6,0x6e,0xce,0x50,0xb,
+0x2b,0x9d,0x4d,0x62,0xbd,0xe0,0x2e,0xaa,0xde,0xea,0xc0,0xc0,0x9e,0x92,0x3a,0x21,
+0xec,0xb5,0xe4,0xeb,0x38,0xc4,0xd5,0xaf,0xc4,0xcf,0xe1,0xc,0x5e,0x74,0xa4,0x2f,
+0x2,0x4d,0x52,0x85,0xca,0x1c,0xf2,0x78,0xa8,0xe9,0x5,0x24,0x53,0x5c,0xc5,0xb4,
+0xfe,0x66,0xfa,0x85,0xf8,0xd1,0x9f,0x8d,0xb9,0xf2,0xb2,0x98,0x49,0x95,0xc0,0x3a,
+0x29,0xcd,0xb0,0x10,0xb,0x83,0x1e,0xc0,0x73,0x82,0x56,0x0,0x9e,0x2a,0x8d,0x61,
+0x2c,0xce,0x2,0x20,0x16,0x6,0x6a,0x88,0x75,0x3e,0x8a,0x30,0xcb,0x8f,0x63,0xdc,
+0x5b,0xc5,0x38,0xcc,0xfb,0x11,0xd6,0x8c,0xa3,0x8,0xb3,0xcc,0x24,0xc6,0xdd,0x35,
+0x8c,0x43,0xfc,0xa3,0x8,0xb3,0xca,0xf3,0x18,0xa7,0xeb,0x18,0x77,0x70,0x8c,0x3,
+0x4,0xb3,0xf2,0x39,0xac,0xd1,0xab,0x55,0x88,0xbd,0x71,0x27,0x35,0x87,0xbe,0x46,
+0xc8,0xf5,0x1d,0x23,0xcd,0x9e,0xa7,0xdf,0x51,0x3c,0xc,0xbe,0x46,0x17,0xc7,0x17,
+0x55,0xf5,0x17,0x7b,0xf9,0xab,0xd9,0x87,0xf9,0xcb,0xca,0x20,0x3c,0x13,0x13,0x51,
+0x97,0xe,0x89,0x75,0x48,0xce,0x10,0x74,0xcd,0xd0,0xb6,0xbd,0xba,0xe0,0x18,0x4d,
+0xcb,0xd6,0x42,0x74,0x4a,0x9a,0x3a,0xf6,0xea,0xe,0xfb,0x8,0xcb,0xb1,0x57,0x47,
+0xed,0x7,0x3a,0xf6,0x68,0xdb,0x9b,0xda,0xb5,0x57,0x87,0xec,0x7f,0x3b,0xbf,0x3b,
+0xd8,0xb1,0x57,0x3b,0xd7,0x3b,0xf6,0xea,0x36,0x67,0x82,0x6c,0x7b,0x75,0xa7,0x73,
+0xc2,0x65,0x33,0xaa,0x94,0xc3,0xe0,0x2c,0x7b,0xb5,0xe6,0xf2,0x8b,0x8,0x17,0xde,
+0xff,0x5b,0x5c,0x33,0xba,0x56,0xae,0xf,0xb2,0x40,0x45,0xf9,0xa0,0x6d,0xe1,0xfc,
+0x5,0xce,0x41,0x88,0xc0,0xfb,0xcd,0xf1,0xfa,0x3e,0x1c,0xd0,0xae,0x8f,0xec,0x5e,
+0x61,0x8b,0x14,0xf1,0x90,0x4b,0x61,0x95,0x43,0x7f,0xd,0x13,0x6b,0xb8,0x79,0x84,
+0xbe,0x47,0xf,0x2d,0x4e,0xf,0x51,0x72,0x66,0x93,0x39,0x82,0x64,0x1a,0x7f,0x2d,
+0x56,0x82,0x1b,0x44,0xf4,0x8b,0xec,0xe2,0x2f,0x7a,0xf4,0xb0,0x66,0xe9,0xc1,0x5f,
+0xbc,0x45,0x87,0x47,0x12,0x3b,0xeb,0x8d,0x3,0x70,0xc7,0x48,0xf,0xfe,0x3e,0x3a,
+0x34,0xdc,0x1e,0x63,0xbf,0xea,0xf1,0x87,0xb5,0x4b,0xf,0xe1,0x7b,0xd8,0x3e,0x98,
+0x12,0x6e,0x5d,0x15,0xfb,0x1b,0x50,0x4c,0x33,0xda,0x7b,0xf4,0xb0,0xd6,0xe4,0x87,
+0x55,0xd5,0x42,0xd6,0xbc,0xba,0x14,0x67,0x65,0xab,0xdf,0xeb,0x9e,0xb9,0xe6,0xc5,
+0xc8,0xfb,0xd,0x17,0x47,0xc4,0x50,0xef,0x5,0x1a,0x50,0x61,0xe,0xfe,0x2c,0x48,
+0x63,0x74,0x2f,0x52,0x90,0xa,0x55,0xe3,0x45,0xbc,0x5f,0x62,0x9b,0xac,0x9f,0x63,
+0xff,0x81,0x5d,0x1c,0xf1,0x47,0x9f,0xf1,0x62,0x1e,0x5e,0xb0,0xab,0xd1,0x17,0x1,
+0x17,0xf8,0xc4,0xc3,0xc1,0x5,0xbb,0xc4,0xc3,0xc1,0x5,0x15,0xf9,0xee,0xbc,0x6b,
+0xe5,0x7b,0xab,0x7c,0x77,0x64,0xad,0x65,0xf4,0xd0,0x20,0x7f,0x78,0xa2,0x8f,0xdd,
+0xd9,0x8f,0xf8,0xc3,0x2f,0xba,0x43,0x6e,0xf1,0x87,0xd7,0x26,0x10,0x7f,0x50,0x35,
+0x44,0x2c,0xfe,0xb0,0x8d,0xf0,0x87,0x82,0x5b,0xa5,0x5e,0xf2,0x87,0x70,0x3d,0x89,
+0xf8,0x43,0xfa,0x64,0x87,0xbd,0x5e,0x25,0x7f,0xf0,0x73,0x73,0x86,0x0,0x7f,0x30,
+0x15,0x26,0xc8,0x1f,0xb4,0xca,0x8,0xe2,0xf,0xa2,0x26,0xa,0xe4,0xf,0xa2,0xbe,
+0x1,0xe0,0xf,0x32,0x1e,0x45,0xf1,0x87,0xe3,0x52,0xda,0x56,0xfc,0x61,0x46,0xe6,
+0xc3,0x52,0xfc,0x41,0xf6,0x14,0xf2,0x87,0x67,0x11,0x7f,0x88,0xf2,0xfa,0x10,0xe4,
+0xf,0xb9,0x1f,0x20,0xfe,0x10,0x68,0xc4,0x11,0x7f,0xd0,0xbe,0xb4,0xe2,0xfc,0x21,
+0x4a,0xf2,0xb1,0x69,0x65,0xa2,0x4e,0xd2,0x23,0x8c,0xa6,0x1,0x18,0xd6,0x59,0x69,
+0x20,0xeb,0xda,0xc3,0xc7,0x2d,0x76,0x1b,0x5b,0x2b,0x58,0x4e,0x74,0xbb,0xeb,0xdf,
+0x94,0x96,0x1b,0x99,0x2a,0x2,0xd8,0x5b,0xb5,0xac,0x28,0xe,0x6e,0x97,0x84,0x59,
+0x9a,0x50,0xcc,0xe7,0x87,0x31,0x76,0x5,0x90,0xe0,0xd3,0xbc,0x5e,0xe2,0x20,0x2,
+0xdd,0x67,0xae,0x9f,0x6,0xdc,0xbf,0xb5,0xb7,0xdd,0xb6,0xc2,0xc6,0x8,0x12,0xa1,
+0xa5,0x93,0xc,0x70,0xed,0xc4,0x25,0xec,0xba,0x66,0xa9,0x32,0x3d,0x7a,0x68,0x79,
+0x7a,0x48,0x63,0xf3,0x83,0xbf,0x8e,0x3,0xb2,0x76,0x9e,0xc,0x23,0xfd,0xf3,0x40,
+0x1f,0x3b,0x10,0xf7,0xe8,0x61,0xcd,0xd2,0xc3,0x8d,0xc3,0x3e,0x74,0xa4,0x55,0x7e,
+0x3d,0x84,0xa,0x7e,0x50,0x7c,0x59,0x7f,0xb3,0x23,0x2d,0x8f,0x1e,0x5a,0x9e,0x3f,
+0xec,0x24,0xe,0xb4,0x24,0xc5,0x6f,0x98,0xb8,0xcc,0x5c,0xd2,0xcc,0x18,0x75,0xfb,
+0x30,0xfc,0x97,0xa9,0x48,0xce,0x40,0xad,0xce,0x91,0xcb,0x76,0xd6,0xd5,0xde,0x24,
+0xe4,0xc1,0x92,0x72,0xba,0x49,0xcf,0x60,0xa7,0x67,0x71,0xc3,0xce,0x1a,0xdc,0xcc,
+0x9e,0x85,0x97,0x8b,0x93,0xa5,0x10,0xf2,0x99,0x6e,0xe3,0x1f,0xaf,0xe1,0xdd,0x8f,
+0x63,0x97,0x9e,0x14,0x71,0xb1,0xee,0x20,0xce,0x48,0xab,0xd,0xb7,0x76,0x3b,0xe3,
+0xf3,0xee,0x7a,0x11,0x99,0x2f,0xa4,0xff,0x18,0xc8,0xf8,0x94,0xac,0x66,0xb3,0x5,
+0xe0,0xf1,0x29,0xee,0xd7,0x2b,0x53,0xf8,0x79,0xa9,0x2a,0xc6,0x3d,0x75,0x8c,0xd7,
+0x35,0x30,0xee,0x25,0xbf,0xe7,0x66,0x11,0xde,0x3c,0xcf,0xdf,0x6e,0x18,0xe3,0x7f,
+0x64,0xb0,0x7f,0xfb,0x77,0x9f,0xc9,0xf7,0xb7,0xfc,0x79,0xb7,0xf,0xef,0x1e,0xbf,
+0x8c,0xcb,0x91,0x9b,0xcb,0xf3,0x29,0x58,0x10,0xad,0xdd,0x54,0xe4,0xde,0x2,0x56,
+0x40,0x42,0xcc,0x27,0xd8,0x8f,0xd2,0xe3,0xb8,0x3e,0x6f,0x66,0x4c,0x68,0xac,0x4a,
+0xbd,0xcf,0x9c,0x62,0xbb,0x6a,0xef,0x66,0x10,0xa3,0x7c,0x61,0x99,0x53,0x1a,0x2e,
+0x6f,0x75,0x4a,0x47,0xd5,0xac,0xcc,0xeb,0x8d,0xe7,0x30,0xce,0x34,0x86,0x10,0xe,
+0x43,0xfa,0x13,0x59,0x63,0xde,0xc9,0x9f,0x43,0x98,0xe5,0xea,0x18,0x87,0xd5,0x71,
+0xa4,0xc4,0x7e,0xd5,0x5,0x89,0x41,0x7d,0xe6,0xcc,0xa9,0xff,0x26,0x92,0xac,0xc5,
+0x14,0x4e,0x55,0x8b,0x7c,0xa,0x3c,0x6f,0x2f,0xe7,0x75,0xe4,0xd1,0xfe,0x6b,0xfb,
+0x57,0x71,0x46,0x10,0x2c,0x6b,0x8,0x5e,0x7f,0x94,0x68,0xa7,0x24,0x5b,0x80,0x6e,
+0x60,0x77,0x7d,0xb6,0xeb,0x24,0xb1,0x97,0x37,0xcf,0xf7,0xf7,0xe6,0x3,0x87,0x3f,
+0x0,0xe0,0xa5,0xc2,0xdb,0x14,0xcc,0x5f,0xe2,0x27,0xd9,0xfb,0x61,0x2,0xb8,0x37,
+0x89,0x6b,0x8,0xc7,0xf5,0xd1,0xa,0xc8,0x30,0xc1,0x41,0xe0,0xbe,0x62,0x11,0x4,
+0xe1,0x4,0x65,0xec,0x98,0xc2,0xe9,0xc6,0xe7,0x7,0x6,0x40,0xc1,0x56,0x99,0xed,
+0x46,0x61,0x9f,0x98,0x79,0x4d,0x5d,0x1f,0x10,0x94,0x11,0x54,0xd8,0x2f,0x88,0x71,
+0x1b,0x78,0x9e,0xf1,0x22,0xd3,0xcb,0xf0,0xf9,0xfc,0x99,0xf2,0xb4,0x81,0xde,0xdf,
+0x18,0x2,0x98,0xf9,0xff,0xa8,0x7f,0xb5,0x9b,0x9e,0x6e,0xc7,0x33,0x1c,0x25,0xc7,
+0xa3,0x69,0xe2,0x91,0x49,0xd4,0x57,0x6a,0xce,0xb8,0x79,0xd8,0xa3,0x87,0x56,0xa6,
+0x87,0x10,0x49,0xbf,0x98,0xc1,0xf2,0xa6,0xde,0x28,0xf,0x21,0xeb,0xc5,0xe4,0x4e,
+0x14,0xe2,0x96,0x3e,0x18,0x80,0xd6,0x5e,0xed,0x88,0xd4,0x60,0x3d,0x7a,0x68,0x5d,
+0xfe,0x80,0xdb,0x45,0x8f,0xb3,0x2d,0x70,0x85,0x9b,0x1f,0x9b,0x4,0x6,0x4e,0xdf,
+0xec,0x96,0x5a,0x5,0xcc,0x77,0x60,0x92,0xe5,0x97,0x24,0x32,0x79,0xf4,0xd0,0x5a,
+0xf4,0x30,0x40,0x3c,0x6c,0x17,0xf3,0xc8,0x15,0x1e,0xbc,0x31,0x8f,0x1e,0x5a,0x87,
+0x1e,0x2e,0xbf,0x1b,0x6f,0xf,0xb8,0x0,0x25,0x4b,0x7e,0xfb,0x97,0x91,0xbd,0x22,
+0x17,0x67,0x3f,0x85,0x38,0x1f,0x63,0x2f,0xa0,0xfd,0x61,0x4,0x27,0xdc,0x6e,0xaf,
+0x97,0x91,0x7c,0xa1,0x3d,0xf0,0xe3,0xb8,0x47,0xf,0x6b,0x87,0x3f,0x9c,0xed,0x66,
+0xd2,0x83,0xa9,0x5e,0xfe,0xfa,0x23,0xf7,0xc4,0x14,0x3d,0xc,0x5e,0x62,0xfe,0xf9,
+0xb2,0xa2,0x87,0x19,0xa3,0x9a,0x7d,0xd8,0xd2,0xf1,0x24,0x3d,0xf0,0x46,0x3f,0xd3,
+0xca,0x27,0xd4,0xa4,0x9,0x82,0xe9,0x9d,0x1,0x3c,0x4b,0x18,0xae,0x6a,0x98,0x1e,
+0xc2,0xd,0x45,0xf,0x56,0x53,0xf4,0xa0,0xb0,0x45,0xf,0x23,0x84,0x1e,0x46,0x9,
+0x3d,0x9c,0x20,0xf4,0xe0,0x4a,0x4c,0x9a,0xa4,0x87,0x7f,0xe6,0x7f,0xc9,0xec,0x2c,
+0x5c,0x82,0x1e,0xea,0xbf,0x50,0xe2,0xcf,0x7c,0xd3,0x52,0x3a,0xc5,0xfb,0x3f,0xcb,
+0x82,0x15,0x53,0xe9,0xfc,0x9c,0xf5,0x84,0x8f,0x88,0x60,0x42,0xfd,0x9a,0x1b,0xe2,
+0x1e,0x2d,0xc8,0xb6,0xaf,0xf8,0x79,0x38,0x14,0xef,0x32,0x27,0x6,0x30,0x9c,0x20,
+0xaf,0x66,0xf,0x0,0x1,0x35,0x51,0x37,0x27,0xa4,0xb,0xa8,0xc3,0x34,0x5f,0xc4,
+0x28,0xc2,0x1,0x64,0x9c,0x10,0x8f,0xeb,0x27,0xdc,0xb1,0xaf,0xe9,0xef,0x7e,0x62,
+0xec,0xd4,0xc,0xa2,0x7e,0xe7,0xc9,0x61,0x60,0x37,0xbf,0x85,0x69,0x1f,0x85,0xda,
+0x17,0x2f,0x96,0xa1,0x80,0x7d,0xd1,0x3c,0x77,0x98,0x34,0x9,0x9f,0x8e,0xd0,0x82,
+0x7,0x48,0x1e,0xd3,0xf6,0xbf,0x1f,0x63,0xce,0x9f,0x43,0x97,0xff,0xda,0x6d,0xcb,
+0x3b,0x3d,0x44,0x3d,0xbc,0x94,0xd8,0x1b,0x7c,0xd4,0xde,0x40,0xea,0x67,0xb1,0x60,
+0x8d,0x88,0xf,0x8b,0x84,0x0,0xee,0x2b,0xa2,0xd,0x4c,0xd0,0xc3,0xb7,0xe1,0x4,
+0xcd,0x65,0xb,0x20,0x61,0x41,0xa2,0x16,0x37,0xbb,0xa0,0x26,0xa5,0x70,0xc2,0x36,
+0x72,0x39,0xa3,0x23,0x96,0x76,0xe7,0x8c,0x9a,0x4f,0xd1,0xdb,0xf6,0x39,0xf5,0x38,
+0xd9,0xaa,0x60,0xb7,0x44,0x38,0x48,0xe8,0xc3,0x4f,0xe8,0x69,0x51,0x7a,0xd8,0xc6,
+0x3f,0x65,0x32,0x31,0x35,0x43,0x7a,0x85,0x3f,0xf3,0x14,0x7,0x9,0x99,0x36,0x9b,
+0xc,0xa2,0x6,0x4b,0x4,0xf8,0xf6,0xbc,0x67,0x95,0x17,0xeb,0xdd,0x71,0x17,0x1e,
+0x83,0x32,0xf6,0xc7,0x8d,0x90,0x9,0x4f,0x61,0xfa,0x9c,0xe7,0xae,0xfd,0x18,0xf3,
+0xe8,0xa1,0x85,0xe9,0x41,0x27,0x15,0x88,0x68,0x82,0xde,0xd4,0xbf,0x21,0x7e,0xa6,
+0xbd,0xb6,0x1d,0x9d,0x2f,0x45,0x27,0x59,0xe,0xde,0x70,0xc9,0x8,0x8b,0x3e,0xea,
+0xd1,0x43,0x2b,0xf3,0x7,0xd4,0xba,0x76,0x63,0xf7,0xda,0xde,0x59,0x98,0xbe,0x6d,
+0x3e,0xde,0x7c,0x37,0xbb,0x71,0x49,0xb5,0x67,0x3d,0x7a,0x58,0xc5,0xf4,0x40,0x78,
+0x3,0xa3,0xb1,0x5d,0xbb,0x88,0x31,0xda,0x4f,0x72,0x11,0xb1,0x34,0xa9,0xa6,0x1a,
+0x7a,0x7c,0x11,0x72,0x23,0xb9,0x47,0x52,0x63,0xe7,0x17,0x5e,0xf5,0x4d,0xcf,0xe2,
+0x15,0xb2,0x95,0xd6,0x4f,0xc6,0x13,0x1e,0xa8,0x63,0x82,0xd8,0x49,0xb2,0xa7,0x1f,
+0xe8,0xf7,0xe8,0xa1,0x95,0xe9,0x61,0x7,0xe1,0xf5,0x5,0xec,0x4c,0x13,0xa8,0xe1,
+0x6c,0x74,0xdd,0x27,0x51,0xf2,0x6b,0x56,0x18,0xc,0xa3,0x1b,0xe,0x33,0xf6,0x48,
+0xcc,0xa3,0x87,0x16,0xe6,0xf,0xb8,0xd,0xc4,0x7d,0x3,0x10,0xf3,0x83,0xed,0x8d,
+0x66,0x38,0x3b,0x18,0xbc,0x77,0x69,0xe2,0x89,0x47,0xf,0xad,0xd5,0xb6,0x93,0xe0,
+0x80,0x9d,0x8d,0xb8,0x76,0x13,0xb2,0x47,0x7c,0xbf,0x84,0xe,0x34,0xb,0xfc,0x71,
+0xc0,0x11,0x82,0xa5,0x1a,0x32,0x11,0x75,0x3c,0x1e,0xcb,0xcd,0x50,0x5,0x6,0xca,
+0x6c,0xc1,0x32,0x4c,0x7,0x26,0x8c,0xbf,0x1c,0x26,0x40,0xde,0xca,0xbf,0xcc,0xde,
+0xe,0x34,0x1e,0xf9,0xb0,0x8a,0x4a,0x5a,0x2a,0xe5,0x3d,0x95,0x20,0xcd,0x27,0x2f,
+0x55,0x9,0x90,0x2d,0x7b,0x93,0x32,0x65,0x5a,0xf6,0xa8,0x9e,0xd9,0x85,0x7e,0xb7,
+0xe4,0xc9,0xe4,0x34,0xb6,0x77,0x81,0x4,0x6c,0x85,0x71,0xe1,0x2,0x72,0x14,0xc,
+0x4f,0x3f,0x7b,0x2b,0x30,0x6a,0x5,0x78,0xfd,0x9b,0x1c,0xca,0x9c,0x57,0x60,0x7f,
+0x22,0x73,0x80,0x6f,0x6b,0x29,0xcb,0xa4,0xfe,0xc8,0x20,0xa,0xff,0x6c,0xe7,0xb3,
+0x7e,0xb8,0x25,0x24,0x3f,0x5b,0xfa,0x57,0xe4,0xef,0x38,0x18,0xe1,0x4b,0xd0,0x2f,
+0xb6,0xf7,0xeb,0x77,0x40,0xff,0xb9,0xcc,0xa9,0x1c,0xe7,0x80,0x60,0x32,0xb3,0xf5,
+0x2f,0x3c,0xc,0x8,0x26,0xc3,0xf,0xda,0x4e,0x99,0x36,0x16,0xe2,0x4d,0x4e,0x2d,
+0xba,0x8c,0x10,0x78,0x93,0x4a,0xea,0xcd,0x88,0x9f,0x7a,0x1,0x16,0xfe,0x4c,0xbd,
+0x53,0xab,0x6,0xaf,0xfa,0x46,0x9c,0x61,0x58,0x6a,0x82,0x28,0xc,0x54,0xa3,0xc8,
+0x93,0xfc,0xb7,0x51,0xb2,0xfc,0xb5,0x47,0x9a,0xd2,0xbf,0x7e,0xd3,0x91,0x5b,0x21,
+0x16,0x5,0xbe,0x3f,0xb,0x8c,0x5f,0xfc,0xd5,0x6c,0x5,0x88,0xb4,0xa9,0x5a,0x8c,
+0x6d,0x1,0x4,0x57,0x1e,0x13,0x4a,0xa0,0xab,0xf0,0xca,0xf4,0xe5,0xb6,0x93,0xb4,
+0xb5,0x3c,0x7,0xd1,0xfa,0xfe,0x39,0xf9,0xc3,0x94,0xe2,0xf,0xe2,0x6b,0xf3,0x80,
+0x3f,0x4c,0x88,0x97,0x2a,0xfe,0x90,0x98,0xcf,0x1f,0x9e,0x42,0x99,0xaa,0xdf,0x42,
+0xdd,0xe5,0xb6,0xdf,0xb6,0xda,0xb,0x68,0xed,0x43,0x15,0x57,0x4d,0x9e,0x8b,0x75,
+0xf0,0x6d,0x64,0xc2,0xb,0xa3,0x8,0x52,0x7b,0xf5,0x96,0x47,0x99,0x47,0xf,0x2d,
+0x4c,0xf,0x7e,0x7c,0x1e,0xce,0xba,0x89,0x89,0xa6,0x80,0x3d,0x2a,0x3,0xd5,0xc8,
+0x34,0xd6,0x38,0xb4,0xa,0x64,0x8,0x37,0xf7,0xb3,0x2b,0x46,0x3c,0x7a,0x68,0x65,
+0xfe,0x80,0x97,0xfb,0x93,0xf1,0x10,0x5c,0xe1,0x29,0x7e,0xb2,0x1d,0xda,0x23,0x4b,
+0xbf,0xd8,0x28,0x43,0x6,0xf1,0x53,0xb6,0xb7,0xbe,0x14,0x1,0xc9,0xa3,0x87,0xd6,
+0xa2,0x87,0xed,0x57,0x6a,0x3,0x70,0x7e,0x33,0x13,0x3a,0xaa,0x19,0x40,0xf1,0x9e,
+0x4f,0x6b,0xd9,0x41,0x8f,0x1e,0xd6,0x2c,0x3d,0xac,0x84,0x8,0x8b,0xcf,0x53,0x99,
+0x31,0xd5,0x1c,0x17,0xff,0xee,0x8d,0x3f,0x7b,0x9d,0xe3,0xfc,0x32,0x7c,0x7a,0x1c,
+0xb6,0x8b,0xbb,0x64,0xfb,0x97,0xaf,0x7f,0xc6,0x94,0x37,0xa7,0x4b,0x6b,0xbf,0x8a,
+0xf9,0x83,0xfe,0x33,0xcc,0x1f,0x3e,0x33,0x89,0xf9,0x3,0x88,0xef,0x13,0xfc,0x61,
+0x2b,0xe1,0xf,0x29,0xe,0xf8,0xc3,0x28,0xf3,0xd5,0x21,0x7f,0x18,0x62,0x3b,0xc7,
+0x13,0x90,0x3f,0x68,0xe5,0x41,0xc5,0xf,0x4c,0xfe,0x60,0xea,0x43,0x88,0x3f,0x64,
+0xe,0x21,0xfe,0xf0,0xe1,0x7a,0xc,0xf1,0x87,0x7f,0x3b,0x89,0xf9,0x83,0xc9,0xb,
+0x9a,0xf1,0x87,0x3c,0xe6,0xf,0xc1,0xea,0x3b,0x11,0x7f,0x88,0x3c,0xcb,0xb6,0xa3,
+0x70,0x9c,0x55,0x77,0xb4,0x75,0x3b,0x56,0x26,0x58,0x92,0x10,0x7b,0x80,0xea,0x9b,
+0x99,0x67,0x31,0x8e,0xcc,0x91,0x27,0x3e,0xd4,0x8c,0x1f,0x6e,0xef,0xc3,0x46,0xca,
+0xbc,0x30,0x2d,0xa4,0xc6,0x57,0xf,0x16,0xa4,0xa6,0xce,0x4f,0x59,0xee,0x94,0x6d,
+0x84,0x72,0xe8,0x73,0x4a,0x28,0x60,0xa,0x77,0x9b,0xf4,0x70,0xbd,0xa1,0x70,0x90,
+0xd7,0x9f,0x6e,0x64,0x80,0x81,0xe6,0x4e,0xce,0xbf,0xe,0x9e,0xcf,0xb4,0x6b,0x7e,
+0x6b,0xb5,0xaf,0xde,0x3d,0x9f,0xc2,0x3b,0xbc,0x81,0xf5,0x83,0xf6,0xb9,0xa6,0x6,
+0x88,0x0,0x9,0xdf,0xb9,0xf8,0xeb,0xcc,0xa3,0x87,0x16,0xa6,0x7,0xdf,0x3d,0x18,
+0x6f,0x23,0x2e,0x85,0xb9,0x12,0x62,0x8,0xbe,0xfa,0x66,0xe4,0x51,0xd7,0xf1,0x22,
+0x43,0xe9,0xb,0xaf,0x1b,0x62,0x97,0x1c,0xf4,0xe8,0xa1,0x95,0xf9,0x3,0x6a,0xe6,
+0x5c,0xd,0x40,0x86,0x9f,0x9e,0xc2,0x35,0xc8,0x29,0xbe,0xfc,0x2e,0x96,0x1d,0x5a,
+0x82,0xfa,0xe2,0xd1,0xc3,0xaa,0xa7,0x7,0x22,0x42,0x84,0x48,0xc9,0x8c,0x24,0xb6,
+0x60,0x6b,0x15,0x7c,0x79,0x1b,0x31,0x5f,0xbe,0xa3,0x59,0x6a,0x35,0xff,0x6e,0xf5,
+0xa7,0xdc,0x8b,0x6a,0x58,0x66,0xb1,0xfc,0x95,0xa,0xae,0x7f,0xbb,0x26,0x42,0x17,
+0x40,0x3c,0x4,0x13,0xb5,0x3b,0xa1,0x93,0x74,0xc2,0xbc,0x15,0xd6,0xeb,0x14,0xf,
+0x84,0x22,0x90,0x70,0x98,0x2f,0xc0,0x0,0x43,0xe3,0xa0,0x86,0xf4,0xe5,0xdc,0x9,
+0xec,0x73,0xdd,0x3b,0x85,0xca,0x7f,0xb2,0xb6,0x1a,0x96,0xa8,0x2,0xbc,0x8c,0x4b,
+0xf2,0x55,0x48,0x9,0xbf,0xc,0xb1,0xe7,0xf5,0xd6,0x9a,0xb,0x68,0x85,0x13,0xc4,
+0x3a,0x8c,0x76,0xeb,0xcb,0x3e,0xd6,0x40,0xdb,0x71,0x99,0xe3,0xdb,0x1f,0x3a,0xd2,
+0x7f,0x76,0xcd,0xf,0xe4,0xf1,0x99,0x53,0xcb,0x8d,0x7d,0x7,0xbe,0x1a,0x87,0x38,
+0x8f,0x2a,0x53,0x66,0xe6,0xea,0xd9,0x87,0x81,0x3e,0x91,0x31,0x15,0x8,0xbd,0x2,
+0xce,0xaf,0x84,0xb4,0x92,0x50,0x3b,0x56,0x46,0xdc,0xb,0xce,0xe0,0xe5,0xd2,0x4,
+0x5,0x5c,0xe5,0xf9,0x56,0x90,0xc4,0xef,0x3,0x2f,0xfb,0x79,0xbf,0x4f,0x48,0x25,
+0x47,0xc5,0xef,0x8b,0x57,0x1,0xa,0xc9,0x8,0xf1,0x3a,0x3d,0xd,0xfa,0xf7,0x1c,
+0xb,0x80,0xa2,0x8d,0x99,0x69,0xfe,0x4c,0xa5,0xd1,0xf,0xbe,0xef,0x7a,0xe4,0xf,
+0x68,0xbe,0xff,0xea,0xdf,0x5e,0xc6,0xf1,0xbc,0xee,0xd1,0xb3,0xcc,0x2c,0x68,0xfa,
+0xa0,0xf2,0xeb,0x41,0x92,0x6e,0x8,0xe3,0x1b,0x47,0x7c,0xd9,0x37,0x6e,0x60,0xf1,
+0xf8,0xc3,0x4a,0xf3,0x7,0xdd,0xae,0x14,0xeb,0xb4,0x30,0x2a,0x77,0x66,0x8e,0x78,
+0xb1,0x58,0x7c,0x62,0x49,0x14,0xe2,0xd5,0xef,0xf6,0xea,0x35,0x2b,0x69,0x41,0xc,
+0xf,0xa0,0x50,0x4d,0x8c,0x1e,0xa4,0x58,0x51,0x5e,0x6e,0x29,0xf,0xf4,0xe2,0x37,
+0xfb,0x57,0x74,0x2,0x3,0x33,0x4c,0xfb,0x2f,0x38,0xa1,0xc6,0xd7,0x1e,0x40,0xa,
+0xe2,0x2e,0x94,0x5d,0x59,0x98,0x1f,0x3e,0xe4,0xf1,0x7,0x8f,0x3f,0x2c,0xc4,0xf,
+0xee,0x62,0x6c,0x7,0xd8,0x0,0xb5,0xaa,0xf9,0x51,0x70,0x43,0x2c,0x1d,0xfe,0x24,
+0x9a,0x7f,0x73,0x81,0x63,0x17,0xeb,0x7d,0x77,0xc7,0x3c,0xfe,0xb0,0x7a,0xf8,0xc3,
+0xf2,0x37,0x8f,0x3f,0x2c,0x3b,0x7f,0xf0,0x13,0x99,0xb2,0xf3,0x28,0x91,0x39,0x89,
+0xce,0x9e,0x7c,0xf9,0x6a,0x6c,0x32,0xe6,0x24,0x2a,0x2,0xe9,0x2c,0x2d,0xd5,0x3c,
+0xfe,0xd0,0x4f,0xa9,0xa1,0x7b,0x31,0x6a,0xf8,0xde,0x99,0x51,0x43,0x88,0x38,0xa8,
+0x24,0x69,0x41,0x77,0x3c,0x9c,0x8b,0x84,0x54,0xe9,0x37,0x15,0x8f,0x7c,0x10,0xdc,
+0x5d,0x10,0x3,0xfc,0xd,0x20,0x8e,0x54,0xb3,0xf7,0x1b,0x6e,0x7e,0x57,0x9f,0x31,
+0x6b,0xae,0x98,0x40,0x45,0xf5,0x5d,0xce,0xd5,0x45,0xee,0x78,0x91,0x4f,0x29,0xd3,
+0xf8,0xfd,0x63,0x78,0x21,0x91,0x78,0xfe,0x20,0xd6,0xc6,0xdc,0xfa,0x17,0xb,0xfd,
+0x1e,0x20,0xca,0xa0,0x8f,0x6e,0xe4,0xc6,0x9,0xa2,0xfd,0x91,0xb9,0xb2,0xea,0x5f,
+0xa8,0x74,0xff,0x11,0x2e,0xe3,0x93,0xf6,0xaa,0xfd,0xb3,0x71,0x2b,0xd3,0xae,0x73,
+0xbf,0x9f,0x5d,0x6c,0xd2,0x37,0x87,0x13,0xf6,0x76,0x11,0x1f,0x8,0x35,0x74,0xff,
+0x9e,0xf7,0xac,0xee,0x25,0x7b,0x39,0x89,0xef,0xae,0xe0,0x31,0x8b,0x12,0x7,0xc9,
+0x74,0xf3,0xf8,0xee,0xc8,0xa2,0xf1,0xdd,0xe7,0x79,0xfe,0x87,0xdf,0x5b,0xe1,0x72,
+0x28,0x3e,0x3,0x1b,0x98,0xb7,0x4d,0xe3,0x82,0x7a,0xa5,0x41,0x14,0x63,0x15,0x78,
+0xdc,0x4e,0x6d,0xe2,0xf1,0x7,0x8f,0x3f,0x48,0xb,0x63,0x1f,0x19,0x42,0xbc,0x24,
+0xba,0x6b,0x58,0x7e,0x2c,0x7c,0x0,0xf9,0xcf,0x6,0xe6,0x58,0x2,0xde,0x10,0x7d,
+0x94,0x5,0x1f,0xf3,0xf8,0xc3,0x2a,0xe2,0xf,0xf3,0xe2,0xef,0x2b,0xc7,0x9b,0xe3,
+0xa6,0xe5,0xb3,0x3c,0xfe,0x70,0xde,0xc9,0xf,0xa4,0xd,0xc4,0xc9,0x14,0xd,0x2f,
+0x9,0x2f,0xd6,0x3c,0xfe,0xb0,0xc2,0xe5,0x37,0x27,0xd9,0x4e,0xe8,0xc1,0xa2,0x95,
+0x77,0xff,0x17,0x9a,0xe1,0x9d,0x3f,0xc3,0x49,0x1d,0xfc,0xc5,0x61,0x8f,0x3f,0x78,
+0xfc,0xc1,0x51,0x2e,0xfa,0x59,0x10,0xfa,0xcb,0x6d,0x3b,0xc9,0x52,0x70,0xe,0xfc,
+0x35,0xfd,0x35,0xa4,0x5f,0xe4,0x3f,0x83,0xc9,0x69,0x1b,0x99,0x32,0x7f,0x31,0xee,
+0xf1,0x87,0x55,0xc4,0x1f,0x72,0x43,0x1a,0xe2,0x7,0x6d,0x93,0x5b,0x27,0xb0,0x3a,
+0x49,0x1c,0x5a,0xae,0x68,0x96,0x90,0x7e,0x47,0x36,0x7b,0x2f,0x3c,0xaf,0x92,0xf6,
+0x3c,0x90,0xff,0x26,0x59,0x2f,0x3e,0x5,0x2d,0x4a,0xa2,0xde,0x83,0xb9,0x5c,0x66,
+0x20,0x16,0x1e,0xd1,0x83,0x8,0x7,0x5c,0x36,0x60,0xd7,0x87,0x28,0x4f,0x60,0x9c,
+0x9e,0xc5,0x38,0x51,0xc5,0xd8,0xad,0x80,0x61,0xe3,0x75,0x8b,0x60,0xf7,0xd0,0xd9,
+0xc6,0x6e,0xc1,0x1b,0x1b,0xe7,0xa6,0x11,0xd6,0x8c,0x31,0x84,0xa3,0x2e,0xd9,0x49,
+0xac,0x97,0x5c,0x27,0xe3,0xe4,0xec,0xc0,0xc0,0xbe,0xb2,0x32,0xd9,0x5b,0xf6,0xce,
+0x59,0x64,0xff,0xfc,0xc9,0x5f,0xb4,0x52,0xc2,0xa8,0xd3,0xb4,0x2e,0x12,0x93,0x93,
+0x1c,0xc7,0xeb,0x28,0x39,0x1e,0x46,0x26,0xc3,0xe4,0x78,0xdb,0x1c,0xc6,0x9d,0x93,
+0x18,0xf7,0xba,0x6e,0x1c,0xc2,0x1d,0x26,0x9,0x16,0xb9,0x70,0x87,0x1,0x38,0xca,
+0x9f,0xbf,0xcf,0x80,0xfe,0x69,0x55,0xe1,0x6f,0xaf,0xb0,0x70,0x3e,0xd0,0x15,0xb6,
+0x4c,0xd7,0xea,0x7a,0x2b,0x1e,0x47,0xf9,0xab,0x59,0xfe,0x14,0xca,0x5f,0x2d,0x24,
+0x4d,0xdf,0xc9,0x5,0x7f,0xb7,0xf2,0x4f,0xe5,0xc6,0x31,0xff,0x29,0xe3,0x78,0xff,
+0x0,0xe8,0x8f,0xe0,0x5f,0x7b,0x39,0xf4,0x97,0xab,0x3d,0x85,0xfc,0xe5,0x84,0x3b,
+0xc,0xfc,0xde,0x16,0x36,0x2d,0x8b,0xb6,0x59,0xf0,0x7,0x40,0xde,0xbd,0x82,0xfc,
+0xeb,0xea,0x44,0xa3,0xb7,0x21,0xf8,0x83,0xda,0xb5,0x7b,0x4d,0xc2,0xd0,0xde,0xa7,
+0x3c,0x2e,0x7a,0xe5,0x7f,0xed,0x75,0xd9,0xb0,0x85,0xfd,0x6e,0xc6,0x57,0xb,0xab,
+0x6d,0xdb,0xc6,0xc9,0x2a,0xc6,0xe,0x3f,0xb8,0x31,0x57,0xcb,0x8a,0x8a,0x1d,0x9d,
+0xf6,0x86,0x5d,0x11,0xdd,0xe9,0x17,0x65,0x3e,0xf1,0xef,0xe,0x76,0xee,0x77,0x2b,
+0xe8,0xd8,0xd8,0xe5,0x17,0x36,0x76,0xf9,0x91,0x8d,0xdd,0x7a,0x9b,0x16,0xe,0xbb,
+0x3a,0xb8,0xc4,0x7a,0xc1,0xdd,0x76,0x7a,0xab,0x3,0x3,0x7b,0x4a,0xfc,0x25,0x34,
+0x3e,0x7c,0x2e,0xe,0x71,0xf5,0x2b,0xf1,0x56,0xe7,0xf,0x18,0x23,0xfa,0x66,0x97,
+0xd,0x64,0xa6,0xe0,0x5,0xa2,0x40,0x2b,0x64,0x7,0x37,0x66,0xb,0xb3,0x77,0x2d,
+0x78,0xbf,0xc7,0x1f,0x56,0x96,0x3f,0xf8,0x6,0x6,0x6,0xe0,0x6c,0x75,0x98,0xb3,
+0x5,0xe5,0x87,0x68,0xb1,0x58,0xfc,0xc6,0x1b,0x7f,0xdc,0xe,0x19,0xdc,0x76,0x37,
+0x96,0x1f,0x80,0xc3,0xd5,0x3c,0x7c,0x86,0xf5,0xa5,0x16,0xc5,0xf2,0x7d,0xe3,0xb,
+0xe3,0xd9,0x1,0x34,0x0,0x67,0xbd,0x3f,0xf2,0x7d,0x57,0x91,0xfe,0x34,0x16,0xc4,
+0x2d,0xdf,0xda,0x4c,0xfa,0x81,0x11,0x36,0x3d,0xe6,0xe7,0xc1,0x9c,0x48,0x7e,0x42,
+0x7f,0x6f,0xc0,0xfe,0xe0,0xe5,0x9f,0x5c,0xc1,0xf9,0x5b,0x77,0x88,0x5,0x61,0x9f,
+0xa3,0xb5,0x2c,0xf2,0xd8,0xd4,0x4a,0xbc,0x8e,0x74,0x2c,0x7d,0xa0,0xcf,0xe3,0xf,
+0x1e,0x7f,0x58,0xa8,0x25,0x46,0x58,0x10,0xee,0x2f,0x9d,0x2f,0xb1,0x5d,0xa7,0x90,
+0xc6,0xce,0xb1,0x8e,0x7e,0x1d,0xff,0x3b,0xe6,0xf1,0x87,0x55,0xcb,0x1f,0x98,0x9e,
+0xa5,0x26,0x96,0x91,0xa6,0x58,0x1b,0x88,0x7b,0xfc,0xc1,0xe3,0xf,0xb,0x36,0x8d,
+0x54,0x6f,0xf6,0xcf,0x33,0xe1,0x35,0xc7,0x1e,0x7f,0x58,0x53,0xf9,0xcc,0x3d,0xfe,
+0x70,0xd6,0xf9,0x83,0xfe,0x2a,0x11,0xd9,0xc9,0x19,0x4a,0x2f,0x39,0x63,0xe9,0x9d,
+0xba,0x6,0xe1,0x28,0xe5,0x37,0x6f,0xfe,0x50,0xb,0xf3,0x1f,0x8f,0x3f,0xe4,0xc9,
+0xf9,0xe1,0xb,0x18,0xfa,0x49,0x45,0x1a,0x7f,0xe3,0x3d,0xb8,0x53,0x65,0xe2,0xa1,
+0xe2,0xfb,0x70,0x13,0x8d,0x20,0x32,0xc5,0xb6,0xa2,0xa,0x36,0xa5,0xc1,0x12,0xca,
+0x5f,0xb4,0xad,0x86,0x49,0xdc,0x57,0x3c,0xe8,0xf1,0x7,0x4f,0x7e,0x70,0x6d,0x91,
+0x7d,0x4c,0x87,0xf6,0x83,0xf6,0x71,0xb6,0x13,0x92,0x9f,0xaf,0x1e,0x2b,0x23,0xf2,
+0xcb,0xfc,0x35,0x1e,0x92,0x76,0xfe,0x2c,0xa1,0xaf,0x7e,0x8f,0x3f,0xac,0x26,0xf9,
+0x41,0xab,0xe0,0x3e,0xb7,0xcd,0x60,0x87,0xea,0xdc,0xc8,0x4e,0xc8,0x40,0xf4,0xc3,
+0xcc,0xd7,0xec,0x84,0x53,0xbb,0xa9,0x8,0x67,0x50,0xcb,0x8b,0x1,0x7d,0xd5,0xfd,
+0xa4,0x5d,0xbc,0x96,0xbd,0xaf,0xec,0x9e,0x57,0xfa,0xc,0x61,0xbb,0xd7,0x1f,0x3c,
+0xe6,0x9a,0x47,0x25,0x73,0xd4,0x47,0x6d,0x7c,0x56,0xfc,0x1f,0x1e,0x29,0x3a,0x29,
+0xc7,0xac,0xdf,0x2b,0xdc,0x89,0x7a,0xb5,0xfc,0x1f,0x6e,0xcc,0x3a,0xe7,0x23,0x8e,
+0xff,0x43,0xca,0x19,0x22,0x3b,0x55,0x9d,0x8b,0xed,0xb,0x5d,0x9c,0xb0,0xb2,0xdf,
+0xb8,0xd8,0xf6,0x7f,0x70,0xb1,0x26,0xfc,0x1f,0xd8,0x9b,0xca,0xee,0x90,0x8b,0xf3,
+0x6d,0x93,0x4,0xbe,0xe8,0x76,0x51,0xf8,0x3f,0x34,0xfe,0x14,0x7e,0xd3,0xea,0xae,
+0xad,0x17,0xd8,0x4f,0xc,0x10,0x38,0xa0,0x98,0x95,0x4b,0x68,0x4a,0x42,0xb3,0x6d,
+0xe8,0xec,0xb2,0xf7,0x59,0xec,0x1f,0x71,0xa0,0x8f,0xbd,0x63,0xa8,0xc9,0xeb,0xfc,
+0x7,0xbe,0x1a,0x7,0xe7,0x23,0xc2,0xbd,0x6,0x9e,0x5f,0xb4,0xf1,0xe7,0xb3,0xf0,
+0xfc,0x22,0x6d,0x2e,0xf5,0x2d,0x60,0x3f,0xa8,0x3c,0x2b,0x12,0x1a,0x35,0x39,0xbf,
+0xe8,0x47,0xfc,0xe3,0x8d,0x9d,0x5f,0xa4,0x41,0x3e,0x74,0xd1,0x77,0x90,0xbf,0xdc,
+0x10,0xf4,0x53,0x19,0x47,0xfc,0x21,0xc,0xf3,0x81,0xf0,0xfd,0x5d,0x5,0xf0,0xbb,
+0xcf,0xa4,0x85,0x2a,0xcc,0xff,0xb1,0xb9,0x52,0x1b,0xa2,0x49,0xee,0x73,0x24,0x68,
+0xbf,0xa2,0x98,0x90,0x4f,0xd2,0x9c,0x1a,0xc0,0xc8,0x7f,0xbe,0xe7,0x9a,0xa,0x88,
+0x4f,0x8a,0x88,0xd5,0xf8,0x28,0x5e,0xad,0xfb,0x9b,0xce,0x6f,0x6a,0x98,0xb5,0xc1,
+0xf7,0x75,0xcf,0x65,0x51,0x81,0x34,0x5f,0x85,0x57,0xd1,0x8c,0xfb,0x9a,0x1a,0x20,
+0x3c,0xfe,0x70,0x9e,0xf1,0x7,0x4a,0x4e,0x83,0x2c,0x2,0xc9,0xb9,0xe7,0xbb,0xec,
+0x7a,0x38,0x47,0x22,0x7f,0x0,0x92,0x4f,0x6f,0x6e,0x3c,0xb6,0x94,0xe7,0x7b,0xfc,
+0x61,0x85,0xf9,0x83,0x29,0xb1,0xe1,0x7c,0x71,0xac,0x30,0xd6,0x1c,0x6f,0xbf,0xd2,
+0xe3,0xf,0x1e,0x7f,0x58,0xa8,0xf9,0xae,0xc2,0xb8,0x63,0x6e,0x69,0xd8,0xe3,0xf,
+0xab,0x8d,0x3f,0x2c,0xb3,0xba,0xe2,0xf1,0x87,0x15,0xe6,0xf,0x9b,0x49,0xc5,0x81,
+0x34,0x29,0x49,0x92,0x27,0x3a,0x30,0x89,0xc7,0xd5,0xab,0xcb,0x4b,0x0,0xd1,0x51,
+0xd2,0x1d,0x82,0x89,0x3b,0x2e,0x55,0xe1,0xa3,0x45,0x8f,0x3f,0xac,0x2a,0xfe,0xb0,
+0xb,0x4f,0x90,0x56,0xb9,0x13,0x19,0x8c,0xda,0x26,0xfd,0x88,0x80,0xae,0x1b,0x62,
+0xd7,0x2d,0x9c,0xa0,0x7e,0x87,0x7c,0x99,0x2f,0x1b,0x47,0xf6,0xb9,0x10,0xf1,0x97,
+0x5e,0x41,0x6c,0xa7,0x27,0x5f,0x10,0x4b,0x7b,0xe1,0xb5,0xe7,0xae,0x7f,0x8b,0xe0,
+0x15,0x6e,0x5a,0x19,0x7,0x5b,0x46,0x67,0x31,0x33,0xc9,0x1c,0xbc,0x14,0x19,0xb3,
+0x9f,0x14,0xe6,0x28,0x24,0x5b,0x12,0xe3,0xe2,0xf2,0xe7,0x1b,0xf4,0xea,0x67,0xb5,
+0x74,0xb,0xc9,0x74,0xc6,0xaa,0xc6,0x45,0x67,0xcd,0xe2,0xd3,0x7,0x4f,0x8f,0xbb,
+0xf6,0xd6,0xc5,0x2,0xbd,0x9a,0x3f,0xd6,0x87,0xd6,0x2f,0xb7,0x73,0xd2,0x53,0xbc,
+0xd8,0xf3,0xe6,0x63,0xfb,0xf6,0x5,0xb1,0xfd,0xfe,0x37,0xfc,0xbc,0x15,0xc6,0x2d,
+0xd6,0x74,0xa2,0x5d,0x44,0x71,0x32,0x20,0xdf,0x67,0x1a,0x59,0x58,0xfe,0x24,0x20,
+0xa6,0x2,0xc8,0x17,0xfe,0xa7,0x79,0xb1,0x38,0xb2,0xf0,0xfd,0x2,0x5f,0xe,0xb,
+0xa2,0x44,0xeb,0x17,0x9b,0x4f,0x18,0x2,0xb8,0xf4,0xfc,0xfd,0x1c,0xfa,0x5b,0x4f,
+0x81,0xe8,0x19,0x81,0xcd,0xa7,0xb7,0x35,0x0,0x8e,0x3b,0x52,0x81,0x85,0x1b,0xb2,
+0x57,0x71,0xf4,0xfe,0x80,0xda,0x41,0xcf,0x35,0x5e,0xe1,0xf6,0x9b,0x87,0x63,0x5b,
+0xe0,0x69,0xaa,0x51,0x79,0xb5,0x0,0xc5,0xbf,0x69,0x7f,0x19,0x9,0xf,0x57,0x32,
+0x5f,0xf3,0xae,0xee,0x20,0xc2,0xca,0x59,0x3f,0x2f,0x5c,0xe3,0xb8,0xc5,0xda,0x6f,
+0x3e,0xc6,0xde,0x1,0x25,0x8,0x83,0xf,0x65,0x20,0x9e,0xba,0xb4,0x86,0x4e,0x2b,
+0xc6,0xb4,0xd2,0xcb,0x4b,0x7a,0x81,0x57,0x9f,0x77,0x45,0x9b,0xd8,0x3b,0x63,0x68,
+0x3e,0x39,0xe2,0x55,0x22,0x79,0xda,0x92,0x8c,0x63,0x1e,0x7f,0x38,0xaf,0xf9,0x3,
+0x6d,0x82,0x7e,0x20,0x16,0xe2,0x2,0xa5,0x3f,0x8f,0x3f,0xac,0x5e,0xfe,0x60,0xa,
+0x5e,0x19,0xa8,0xea,0x96,0xbe,0x73,0x3f,0x3a,0xbe,0xde,0xc2,0xf9,0x77,0xb1,0x7e,
+0x79,0x95,0xc7,0x1f,0x3c,0xfe,0xb0,0x60,0x33,0x15,0xf7,0x3c,0xdc,0x4f,0xea,0x7d,
+0x81,0x9f,0x21,0xcb,0x1a,0xe,0xd5,0x64,0xc1,0xd2,0x4f,0xfa,0x3d,0xfe,0xb0,0x7a,
+0xf9,0xc3,0xb2,0x37,0x8f,0x3f,0x2c,0x2f,0xe,0xe3,0xf3,0x1a,0x96,0x20,0x76,0x89,
+0x1c,0x31,0x64,0xe6,0xfe,0x1,0x27,0x93,0xd9,0xc9,0xf1,0x3,0xb5,0x6b,0xce,0x6e,
+0x76,0x91,0x33,0x5d,0xbf,0x1e,0x7f,0x68,0x8e,0xb7,0x1d,0x25,0xf3,0x4d,0xd4,0xfd,
+0xa,0x19,0xaf,0xca,0x7e,0x54,0xbd,0x96,0xa5,0x39,0x7e,0xa0,0xfe,0x7b,0x57,0x2e,
+0xeb,0x7a,0xee,0xda,0xed,0xf1,0x7,0x4f,0x7e,0x38,0x77,0xcd,0x93,0x1f,0x5a,0x5f,
+0x7e,0x8,0xdd,0x83,0xe9,0x7d,0x5d,0xcd,0xc3,0x4d,0x71,0x75,0x61,0x2c,0x5a,0x2f,
+0xf1,0x20,0x4a,0xe3,0x33,0x48,0xbd,0x82,0x64,0x8c,0x4b,0xca,0xd8,0x7,0x24,0xc1,
+0xe7,0x90,0xfb,0xeb,0xe6,0x7b,0xfb,0xce,0xf2,0xfa,0xdd,0xde,0x87,0xe9,0x5b,0xd6,
+0x20,0x7c,0x83,0xf8,0x6c,0x3f,0xbf,0xd5,0xb1,0x68,0x14,0x17,0x8e,0x11,0x99,0x1,
+0xc5,0xeb,0xf9,0xde,0x87,0x63,0x42,0xda,0x48,0x76,0xfb,0x70,0x71,0xa8,0xc9,0x78,
+0xe7,0x70,0xf5,0xae,0x40,0x2d,0x8f,0x4,0xd8,0x5d,0xcf,0x46,0xd1,0xd9,0xeb,0x43,
+0x71,0xf6,0x50,0xcc,0x93,0x1f,0xce,0x22,0x9e,0x26,0xbc,0x80,0x56,0x53,0xc3,0xfa,
+0x86,0x9f,0x63,0x5a,0x29,0x93,0xf8,0x20,0x52,0x7b,0x84,0xdd,0x13,0x5f,0xee,0xfd,
+0x80,0xc4,0x12,0x16,0xa6,0x9,0x3d,0x19,0x88,0x1b,0x75,0x9f,0x44,0xb9,0xd0,0x59,
+0x61,0x30,0x8c,0x6e,0x38,0xcc,0xd8,0x23,0x31,0x4f,0x7e,0x78,0xe3,0x38,0x4d,0xfc,
+0x43,0xa,0x98,0x1e,0xae,0x25,0xe7,0xe4,0x9c,0x94,0xb2,0x28,0x7e,0xea,0x9c,0xd8,
+0x1f,0xf6,0xdc,0x1b,0x83,0xf4,0x1f,0x50,0xf9,0xd4,0x24,0x4e,0xab,0x82,0x93,0x2,
+0x7,0x41,0x5,0x25,0x81,0x33,0xe0,0x23,0x4c,0x1c,0xe6,0xcf,0xa1,0xf5,0x94,0x87,
+0xf5,0x14,0x92,0x33,0x51,0xcb,0x43,0xd1,0xc5,0x5,0x14,0x2d,0x92,0x24,0xd5,0xbf,
+0x92,0x24,0x3b,0x49,0xb2,0x6a,0x4c,0xe3,0xf5,0xba,0xb,0x5d,0x90,0x9c,0xf1,0xa1,
+0xb,0xcc,0xf7,0xa3,0xb,0x4c,0x8c,0x2e,0x10,0xfd,0x87,0x17,0x8,0xc,0x2f,0x90,
+0xdf,0xf,0x2e,0x90,0x18,0x5c,0x60,0xf1,0x8b,0x5d,0x4b,0xc9,0xe9,0xac,0x17,0x69,
+0xce,0x5d,0xe2,0x90,0x48,0xc4,0x8f,0x4e,0x42,0x62,0x9b,0x87,0x96,0x71,0xfe,0xcf,
+0xbe,0x7f,0x94,0x78,0xc9,0x6e,0x84,0x3,0x80,0x2,0x4,0xce,0x0,0x81,0xc9,0xc4,
+0x11,0xb8,0x46,0x32,0xa7,0xb4,0xd2,0x34,0x7a,0xde,0x56,0xe4,0x8b,0x96,0x19,0xaf,
+0xbc,0x84,0xde,0xd7,0xc0,0xd5,0x86,0x33,0x75,0xec,0xba,0x96,0x19,0x2b,0x4f,0x31,
+0xf2,0xbc,0x21,0x84,0xb1,0xcb,0x99,0xd9,0x9f,0x2d,0x70,0x72,0x4d,0xac,0x95,0x66,
+0xf0,0xf7,0x45,0x41,0x87,0xe5,0xf7,0x16,0x66,0x97,0x32,0x5,0x7,0x48,0x89,0x55,
+0x5c,0x6e,0x8a,0xe9,0x1c,0xb3,0x88,0x20,0x79,0x78,0xe0,0xd3,0xad,0xa4,0xaf,0x48,
+0x7a,0x5b,0x8c,0x1e,0xaa,0x4d,0xe9,0xa1,0x30,0xdd,0x6c,0xfe,0x96,0x4a,0xf,0xe3,
+0x95,0xd5,0x46,0xf,0xcb,0xdb,0x22,0xa4,0x9a,0x4d,0xaa,0x79,0x35,0x9b,0xf0,0x63,
+0x9e,0x3d,0xea,0x8c,0xb0,0xf4,0xdf,0xdd,0xd,0xf7,0x2f,0xe,0xb,0x50,0x53,0xbc,
+0xe2,0x6d,0x1b,0xa1,0xc5,0xfc,0x21,0x22,0x20,0x62,0x72,0xd9,0xf2,0x75,0x4f,0xde,
+0xf3,0xec,0x51,0x4b,0x95,0x27,0x3d,0x7e,0xb0,0x82,0xfc,0xe1,0x11,0x2a,0x2f,0x60,
+0xf9,0x30,0x48,0x3d,0x52,0x89,0x6,0x1b,0x1c,0x5e,0xce,0xf9,0xf7,0xf8,0xc3,0xb9,
+0xe5,0xf,0x5b,0x48,0x6d,0xf5,0x14,0x39,0xf,0xcd,0x8f,0x12,0xdb,0x15,0x31,0x4e,
+0xde,0x73,0xf6,0xf9,0x43,0xf0,0x1e,0xbc,0x3e,0xd6,0xcd,0x62,0x9c,0x98,0xc0,0x38,
+0x7d,0x1c,0xe3,0xdc,0x28,0xc6,0x7,0x6,0x3d,0xfe,0xd0,0x32,0x8d,0x96,0x3a,0x48,
+0x8d,0xe1,0x52,0x7,0xa9,0x31,0x5c,0xea,0x20,0x35,0x86,0x4b,0x1d,0xa4,0xc6,0x70,
+0xa9,0x83,0xd4,0xd8,0x96,0x47,0x3d,0xfe,0xe0,0xc9,0xf,0xcb,0x89,0x53,0x33,0x4b,
+0xc3,0x97,0xef,0xf7,0xf8,0xc3,0x9a,0x95,0x1f,0x26,0x70,0x72,0xbd,0x45,0xf1,0x78,
+0x76,0xc8,0xe3,0xf,0x67,0xaf,0xd1,0xd8,0x73,0x7a,0x56,0xbb,0xc,0xf8,0xe2,0x7e,
+0x84,0xfd,0x28,0xa5,0x5b,0xef,0x5c,0x7e,0x16,0x6a,0xc8,0xbd,0xbc,0xd1,0x8f,0xee,
+0x7,0x91,0xf5,0x42,0x18,0x2f,0xe1,0xc3,0xbf,0xeb,0x39,0x7e,0x5f,0x25,0x87,0xf1,
+0x7f,0x3b,0xe3,0xfe,0x57,0x31,0x7f,0xb0,0xea,0xa1,0xcc,0x2e,0x88,0x5b,0x9d,0x3f,
+0x24,0x27,0xce,0x36,0xc6,0xf6,0x90,0xe4,0xf4,0x7f,0x60,0x4c,0x78,0x6d,0xaa,0x8e,
+0x4,0xea,0x20,0xa9,0x45,0x5c,0xe0,0x18,0xdf,0x9c,0x9e,0x58,0xe9,0xef,0x69,0x8e,
+0xcf,0x41,0xd3,0x2a,0x23,0x58,0x41,0xa5,0xee,0x17,0xdf,0xc2,0x97,0x17,0x9b,0x1d,
+0x48,0xee,0x90,0xd9,0xd1,0xfd,0x59,0xf7,0x3c,0x4b,0x56,0x3a,0x52,0x65,0xea,0xac,
+0xf9,0x82,0x58,0xf8,0xf7,0x3,0x3c,0x27,0x2,0x2e,0x1,0x9e,0x2a,0x8d,0x61,0x9c,
+0x98,0xc5,0x58,0x44,0x64,0x42,0xac,0xf3,0x51,0x84,0x59,0x7e,0x1c,0xe3,0xde,0x2a,
+0xc6,0x61,0xde,0x8f,0xb0,0x66,0x1c,0x45,0x98,0x65,0x26,0x31,0xee,0xae,0x61,0x1c,
+0xe2,0x1f,0x45,0x98,0x55,0x9e,0xc7,0x38,0x5d,0xc7,0xb8,0x83,0x63,0x1c,0x20,0x98,
+0x95,0xcf,0x59,0x0,0xe7,0xcf,0xd1,0x54,0x72,0x7,0xab,0x6d,0x23,0xf4,0x53,0x38,
+0x4a,0xec,0x21,0x98,0x7e,0x12,0x27,0xf1,0xe5,0xf,0x35,0xfd,0xf4,0xed,0xfd,0x5e,
+0xbc,0x7f,0x4b,0xeb,0x17,0x1e,0x7f,0x58,0x69,0xfe,0x10,0x2c,0xe2,0x8b,0xdb,0xb0,
+0x8b,0x13,0xeb,0xa1,0x5b,0x12,0x5e,0xaf,0xec,0xf2,0x16,0xe2,0x45,0x1e,0x7f,0x58,
+0x7c,0xbb,0x2f,0xe2,0xed,0x9e,0xd6,0x93,0x8,0x13,0x6f,0xcc,0x76,0x42,0x1e,0xa1,
+0x21,0x8c,0xaf,0x1b,0x14,0x5e,0x70,0xe0,0xfa,0xc9,0xc8,0x34,0x16,0x2f,0xa,0xd8,
+0xe6,0x79,0x45,0x33,0x1,0xc2,0xe3,0xf,0xe7,0x99,0xfc,0x70,0x79,0x3f,0xb,0x40,
+0xa7,0xab,0xf6,0x93,0x2c,0x89,0xd2,0xd9,0xd6,0xd6,0xbf,0x86,0xe4,0x8b,0xdc,0x43,
+0x98,0xda,0xb7,0x91,0x92,0xd8,0xcd,0xeb,0x35,0x7b,0xfc,0xa1,0xb5,0x9b,0x86,0xcd,
+0x3b,0x4c,0x23,0xb5,0x17,0x28,0xa6,0x9,0xe2,0xc3,0xe4,0x34,0xae,0x7d,0xd2,0x77,
+0x15,0xdb,0x73,0xe4,0x3,0xee,0x66,0x78,0xb4,0xbd,0xba,0x85,0x43,0xa3,0x42,0x7b,
+0xad,0xfc,0x9d,0x3,0x5c,0x9,0xa9,0xed,0xfc,0x65,0x73,0x58,0x67,0x0,0x36,0xdf,
+0xd0,0xa1,0xf6,0xd4,0x76,0x61,0x3f,0x8f,0x34,0xc0,0xfd,0x92,0x61,0x29,0x5c,0x5d,
+0x5d,0xb8,0xe5,0xed,0xd5,0xbf,0x54,0x3c,0x1c,0x7,0xf6,0x5a,0x51,0x32,0x60,0xa,
+0xe0,0x1c,0x4c,0xef,0xc6,0x92,0xd5,0xc6,0x2d,0xec,0x2d,0x2a,0x8b,0x64,0x52,0xf8,
+0x52,0x6a,0x6e,0xb9,0x5b,0x13,0xb,0x7a,0x49,0xab,0xfa,0xde,0xd,0x6c,0xe5,0xb1,
+0x52,0x3,0xa9,0x88,0x6,0xcb,0x3e,0xdc,0x59,0x5f,0x2b,0xd8,0x6a,0xf3,0x30,0x11,
+0x19,0x13,0xd8,0x80,0x75,0x75,0x79,0x12,0xaf,0x41,0xcc,0x92,0xb5,0xe2,0xe3,0x2d,
+0x4b,0x5f,0xde,0x7e,0x81,0xfb,0x67,0x4d,0x3f,0xc1,0x69,0x68,0xe4,0xf6,0xd,0x5c,
+0x63,0xc0,0x0,0x8d,0x76,0xab,0x42,0xb5,0xdb,0x22,0xc5,0xe2,0xe7,0x9a,0x8d,0xb8,
+0x28,0x90,0xa,0xaf,0xa7,0x5,0x54,0xb7,0x14,0x8b,0xc5,0x47,0x97,0x30,0x83,0xfa,
+0x1d,0x45,0x38,0x81,0xba,0x28,0xcf,0x5c,0x55,0x7f,0xb1,0x97,0xbf,0x9a,0x7d,0x98,
+0xbb,0x49,0x83,0x7c,0x7c,0x26,0x26,0x66,0xd1,0xe9,0x81,0x95,0x9f,0x36,0xe8,0x32,
+0xc,0x3b,0x3f,0xad,0xeb,0x3,0x59,0xb6,0x38,0x47,0xa2,0xe6,0x90,0xfe,0x31,0xfb,
+0xb6,0xb8,0xbd,0xfd,0x58,0xb2,0x6f,0xd4,0x7e,0xa0,0x93,0x9f,0x36,0x6c,0x93,0x4c,
+0xd0,0xf6,0x65,0xc,0xd9,0xff,0x76,0x7e,0x77,0x70,0xc0,0x76,0x65,0x74,0xae,0x77,
+0xf2,0xd3,0xb6,0x39,0x2,0x9e,0x61,0xd5,0xae,0xea,0xe4,0xb6,0xc0,0xec,0xe4,0xa7,
+0x75,0x18,0x96,0x55,0xfd,0x41,0x31,0xb8,0x88,0x74,0xef,0xde,0xe2,0x86,0x4c,0x69,
+0xe5,0xfa,0x20,0xb,0x54,0x94,0x4d,0xc6,0xdc,0xfc,0x5e,0x40,0x3e,0xe0,0xef,0x37,
+0xc7,0xeb,0xfb,0xc8,0x4,0xfc,0x91,0xdd,0x2d,0xbc,0x61,0xdc,0x6c,0x92,0xf,0xf4,
+0xb8,0xc9,0xe1,0x84,0x72,0x6c,0xbb,0x49,0x7e,0xf1,0xa5,0x90,0xd7,0x4d,0x47,0x50,
+0xc4,0xb2,0x78,0xde,0x67,0x1,0xb5,0x9b,0xe4,0x55,0x1,0x1a,0x55,0xaa,0x16,0x43,
+0xe,0xac,0xe5,0x31,0x51,0xb4,0xe6,0xb8,0xfb,0x34,0x39,0xdf,0x39,0x77,0x3b,0xb2,
+0xea,0x77,0xab,0x20,0x18,0xeb,0xb0,0xbe,0xd7,0x65,0x40,0x96,0x22,0xd1,0x33,0xbb,
+0xd0,0xef,0x96,0xf8,0x93,0x9c,0x52,0xac,0x59,0xd0,0x4f,0x1e,0xd4,0xef,0x9e,0x10,
+0x2f,0x55,0x32,0x53,0xc2,0x94,0x7c,0xde,0xa,0xd6,0x6b,0x80,0xd7,0x9f,0x42,0x26,
+0xf6,0xb7,0x70,0x5e,0x47,0x1e,0xbc,0xdb,0x6f,0x5b,0x59,0x5d,0x23,0x71,0x90,0x85,
+0xa1,0x4a,0xda,0x5e,0xcd,0x96,0x20,0xbf,0xd1,0xcb,0xbc,0x86,0x26,0xb0,0x79,0x81,
+0x5e,0x8f,0x3f,0x9c,0xdf,0xfc,0xa1,0x10,0x63,0x1d,0x50,0x65,0x48,0x7f,0x51,0xcb,
+0x8d,0x20,0xf5,0x92,0x37,0x20,0x39,0x69,0xff,0xb3,0xfe,0x39,0xe6,0xf1,0x87,0xd5,
+0xcb,0x1f,0x58,0xa8,0xfe,0xb,0x15,0x18,0xe5,0x95,0x7c,0x11,0x9d,0x68,0x69,0x95,
+0x7e,0x74,0xa2,0x15,0x7a,0xbc,0xf9,0x89,0x96,0xc7,0x1f,0xce,0x33,0xfe,0x70,0x7b,
+0xfc,0x72,0x28,0x20,0x4,0xeb,0xac,0x2,0x71,0xc7,0x44,0x10,0x69,0x43,0xe9,0xd1,
+0x6e,0xe4,0xe3,0xf9,0x5f,0xf1,0xc,0xbc,0xdc,0xff,0x38,0xfb,0x1b,0x8f,0x3f,0xac,
+0x26,0xfe,0xb0,0xec,0x6d,0xe0,0x46,0x59,0x84,0x33,0x7b,0xaf,0x44,0x9b,0xca,0x4e,
+0x6,0x6a,0x69,0x3a,0x8,0x19,0x1c,0xe1,0x2,0x7f,0x3c,0xe,0xec,0x7,0x11,0x19,
+0xea,0xa9,0x70,0x42,0x6e,0x36,0xa,0x5b,0xeb,0xd1,0xc5,0x9a,0x34,0x87,0x2b,0xec,
+0xb7,0xd6,0xb3,0x8b,0x3,0xd6,0xfa,0x5f,0xe7,0x78,0xa1,0xd9,0xfc,0x1,0x60,0xeb,
+0xf7,0x9a,0xed,0xa5,0x62,0xf3,0x7,0xf7,0x7e,0x7b,0x2a,0xd5,0xfb,0x2b,0x63,0x18,
+0xe7,0x88,0xfd,0xa3,0x5b,0xbe,0x40,0x61,0x3f,0xaf,0xc6,0x51,0xc6,0x87,0xbd,0xbc,
+0x76,0xef,0x40,0x52,0xbe,0x4f,0x66,0xfe,0xb4,0xea,0x83,0x58,0x4d,0xf2,0x38,0xed,
+0xa6,0xa7,0x11,0xf6,0xda,0x69,0xf8,0x83,0xfe,0xc9,0x27,0x3f,0xa0,0xf8,0xc3,0x88,
+0xa8,0x82,0x61,0xcd,0xac,0xe4,0xf,0x73,0x97,0xf2,0xef,0x64,0x2b,0x33,0x8a,0x3f,
+0x18,0xa6,0x82,0x7e,0xb1,0x5c,0xda,0x16,0x7f,0x10,0xd7,0x6a,0x22,0xae,0xd1,0xe6,
+0xf,0x92,0xa9,0xe7,0x8e,0xbb,0xfc,0x41,0x32,0x18,0x11,0x3a,0x6d,0xaf,0x7f,0x6b,
+0x3a,0xdc,0x83,0x93,0x1e,0x17,0xdb,0xbf,0xcf,0x11,0xfe,0x50,0x27,0xfc,0x41,0x1d,
+0x3f,0x58,0xfc,0x41,0x31,0x8,0x8b,0x3f,0x94,0x6a,0xe6,0x5,0xef,0x3b,0xe8,0xf0,
+0x87,0xa9,0x28,0x6f,0x14,0xcb,0x16,0x29,0xa,0xfe,0xd0,0x2f,0x37,0x8d,0x57,0xfb,
+0x0,0x7f,0xd8,0xfe,0x89,0x15,0xdb,0x34,0xc2,0xc4,0x41,0x21,0x85,0x1d,0x14,0xe6,
+0x45,0xec,0xfd,0x5d,0x53,0xfb,0xa4,0xc9,0x16,0x60,0x8a,0x4a,0xe9,0x1f,0xa,0xb6,
+0xc3,0x64,0xbd,0xf8,0x14,0x54,0x40,0x85,0x3d,0x6e,0x13,0xc8,0x49,0x28,0xed,0x73,
+0x19,0x52,0xbf,0xb7,0xa7,0x8e,0xf1,0xba,0x46,0xf3,0xdf,0x33,0xb3,0xe4,0xf9,0x63,
+0xb8,0x3f,0xc0,0xda,0x2d,0x31,0x8c,0x1f,0x9f,0x1d,0xd8,0x57,0x2,0x3,0x62,0xc5,
+0x9f,0x1f,0xc2,0xcf,0x2f,0x4c,0x36,0x7f,0x7f,0x58,0x19,0xc8,0x24,0x6,0x55,0x7c,
+0x2c,0xfb,0x63,0x6e,0xa,0xe3,0x1e,0x62,0x9f,0x8c,0x10,0x2b,0xfe,0xaa,0x6e,0x2b,
+0xed,0xf,0xf3,0x49,0x18,0x32,0x9a,0x39,0x95,0x47,0x19,0xf4,0x32,0xb3,0x8d,0xaf,
+0x7d,0x15,0x62,0xec,0x1f,0xc9,0x32,0xc4,0xb2,0x9b,0x21,0xa6,0xbf,0xc,0x89,0x5f,
+0x39,0x2b,0xf1,0xe9,0x67,0x80,0x5b,0xbd,0x79,0xfc,0x61,0xc5,0xf9,0x83,0xbf,0x88,
+0x73,0x50,0x86,0x49,0x81,0xdc,0x76,0xe2,0xf2,0xdf,0x73,0x82,0x4c,0xd9,0x60,0xb,
+0xd1,0x97,0xc7,0x1f,0x9a,0xb7,0x4b,0xc8,0xd1,0x54,0x9a,0xd6,0xca,0x24,0xf9,0x4b,
+0xd,0xcc,0xdb,0xb5,0xbb,0xe7,0x3d,0xf0,0xa0,0xa8,0x88,0x5,0xd8,0xfb,0x9c,0x1f,
+0x87,0x74,0x17,0xfe,0x17,0x66,0xf0,0x17,0x37,0xad,0xbf,0xee,0xf1,0x87,0xf3,0x4b,
+0x7e,0x8,0xd,0x33,0x1d,0xd2,0x54,0x70,0x86,0xb5,0xa3,0x25,0x56,0x1a,0xcc,0xa1,
+0x80,0xe1,0x9d,0x3f,0xc4,0x2b,0x34,0xc4,0xc9,0x8a,0x7c,0x64,0xd8,0xe3,0xf,0xab,
+0x4a,0x7e,0x58,0x56,0xfd,0x82,0xf9,0xe,0x14,0xf,0x7f,0x8,0x30,0x24,0x61,0x9e,
+0x4,0x45,0x32,0xb7,0xf1,0x1f,0x67,0xf,0x18,0xaf,0xbb,0x38,0x2f,0x72,0xfd,0x4,
+0xd4,0xfa,0x33,0x70,0x2e,0x3d,0x9d,0xd4,0xd3,0xa4,0x98,0x19,0x84,0x3f,0xe6,0x1b,
+0x7f,0x86,0x85,0x5d,0xce,0x6b,0x7f,0xe,0xbe,0x4f,0x7b,0xd0,0xec,0xce,0x2b,0x90,
+0x63,0xbe,0xd7,0xec,0x21,0x8e,0x28,0x78,0x3b,0xc9,0xf9,0xcc,0x52,0xd,0x8c,0xdb,
+0x89,0x65,0x20,0x4a,0xdc,0xdb,0xd4,0xef,0xda,0x2d,0xc,0xeb,0xa3,0xa2,0x7b,0x9b,
+0xc,0x60,0xbf,0xe2,0x8d,0xa7,0x39,0xc8,0xf,0xf3,0xde,0x8a,0xd9,0xbf,0x7f,0x84,
+0xfd,0x7b,0xdb,0xdd,0x57,0x7a,0xfa,0x85,0x6a,0x97,0x3f,0x72,0xf8,0x83,0x0,0x6e,
+0xe1,0xa8,0x7c,0x16,0x2b,0xd5,0xb2,0xd9,0xb2,0xc2,0x3e,0x61,0x69,0xd0,0xfb,0x80,
+0xf9,0xf,0xbf,0x3c,0x40,0x9c,0x4d,0x35,0xfe,0xa,0x7e,0x7d,0x9a,0x37,0x9e,0x80,
+0x9f,0xe7,0x2f,0x70,0x42,0x1d,0xd7,0x94,0x48,0xe,0x37,0xbd,0x42,0xd6,0x74,0x9a,
+0xf2,0x1c,0x45,0xb3,0xa1,0xbf,0x12,0xd9,0xc3,0x8e,0x1,0x6e,0x59,0x2b,0x56,0x40,
+0x9f,0xfc,0x62,0xf9,0x7c,0x3,0xde,0x7c,0xd9,0x27,0x56,0x98,0x1c,0xa2,0x64,0xc9,
+0x65,0x8a,0xc8,0x9d,0xd6,0x5f,0x5b,0x5f,0x82,0x63,0x78,0xf1,0x17,0xc5,0xff,0x3c,
+0xfe,0xe0,0xf1,0x7,0xbb,0xed,0xc3,0xea,0x89,0x6e,0xe0,0xf5,0xde,0x56,0xc5,0xfe,
+0xdd,0xe9,0x51,0x54,0xa0,0x4d,0xff,0x59,0x6c,0x1b,0xbc,0x21,0xf4,0x18,0xf3,0x3d,
+0xe1,0xf1,0x87,0x55,0xc4,0x1f,0x96,0x7b,0x37,0xf1,0xf8,0xc3,0x32,0xf3,0x87,0x1c,
+0x61,0xc7,0x51,0xf2,0xc9,0x41,0x1c,0x1e,0x71,0xdb,0xfb,0xa7,0xf1,0x88,0x71,0x54,
+0x6e,0x99,0xfd,0xda,0x6d,0x2d,0x4d,0x5f,0xe7,0x3d,0x7f,0xf8,0x63,0x22,0x6f,0xf9,
+0x68,0x45,0x4,0xec,0x6b,0xfb,0xe1,0x6b,0x31,0x2e,0x71,0xac,0x51,0x6d,0xff,0xa3,
+0x78,0xd3,0xf1,0x36,0xb9,0x77,0x6a,0x14,0x31,0xf4,0xed,0x58,0x0,0x4c,0xfe,0x17,
+0xee,0x50,0xa8,0x38,0xe8,0xf1,0x7,0x4f,0x7e,0x70,0x16,0xd8,0xa7,0x99,0xf6,0x9,
+0x38,0xfd,0x35,0x16,0x41,0xde,0xbe,0xb9,0x91,0x14,0x72,0xee,0xee,0x98,0xc2,0xe1,
+0x39,0x7e,0x42,0xaf,0xec,0x8e,0x83,0x1e,0x7f,0x58,0xb3,0xf2,0x43,0xd6,0x6e,0x4e,
+0x4,0x97,0x73,0x92,0x3f,0xbe,0x0,0x16,0x4,0x43,0x16,0x9f,0x87,0x31,0xd6,0x7f,
+0x4c,0xc6,0x38,0x43,0xf8,0x73,0x2,0xb1,0xcc,0xf0,0x40,0x9,0xe1,0x4e,0x8e,0x13,
+0xee,0xfa,0xf6,0x9d,0x53,0xfa,0xba,0x8e,0xb8,0xea,0x53,0xfb,0xfa,0x22,0xb8,0x2b,
+0x37,0x89,0xa,0xc6,0x26,0x51,0x30,0xf,0x63,0x57,0x54,0x6a,0x45,0x14,0xde,0xbc,
+0xc4,0xe7,0x9f,0x75,0x4c,0xf3,0x7b,0xf4,0xd4,0xf0,0x74,0x44,0xf0,0xf7,0x30,0x76,
+0x33,0xc1,0xec,0x41,0x62,0x9f,0xe9,0xc6,0xe6,0x1d,0xd6,0x86,0xde,0xe8,0xbf,0x1,
+0xf7,0x20,0x84,0xbd,0xdb,0x99,0x76,0xf5,0x87,0x9a,0x4f,0xd8,0x15,0x23,0xec,0x66,
+0xd8,0x81,0xc8,0x4c,0x10,0x2b,0x8c,0xa5,0x2,0x96,0x4f,0xb7,0x14,0xfb,0x3c,0xfe,
+0xb0,0x82,0x78,0xb5,0x37,0x3f,0x39,0xcf,0xa,0x91,0x2d,0x3a,0x5a,0xc5,0xfc,0xa1,
+0x63,0x1a,0xaf,0x9f,0x9e,0x31,0x8c,0xbb,0xfa,0x3d,0xfe,0xd0,0x8c,0x3f,0xb4,0x74,
+0x5b,0xf5,0xfc,0x41,0x1f,0x78,0x57,0x3,0xa4,0xf3,0x12,0xfc,0x14,0x9,0x8c,0x14,
+0x7b,0xfc,0x61,0x4d,0xcb,0xf,0x2b,0xce,0x6f,0x5a,0x8f,0x3f,0xfc,0xf2,0x93,0xf1,
+0xb6,0x11,0x80,0x2b,0x95,0xd9,0x2,0xc0,0xbe,0x59,0x5f,0x19,0x3a,0x44,0x68,0xbb,
+0xa1,0x3e,0x37,0xaf,0xed,0x91,0xd5,0x35,0x2,0x59,0x57,0xfd,0x94,0x9c,0xa0,0xcd,
+0xdd,0x53,0x5a,0x1e,0x4f,0x58,0x6,0x6,0x77,0xfe,0xe5,0x6e,0xa8,0xe2,0xaf,0x7b,
+0xe5,0x6e,0x99,0x9c,0x53,0xa6,0x8,0xb1,0x1d,0x96,0x26,0x94,0xba,0xfd,0xc3,0x18,
+0xbb,0x2,0x38,0x54,0xa4,0x79,0xbd,0xc4,0xc1,0x0,0xfb,0x4c,0x8d,0xb3,0xf1,0x29,
+0x64,0x80,0x68,0x29,0x87,0x7b,0xff,0x91,0xbe,0x0,0x54,0x98,0x7b,0xf9,0x24,0xaa,
+0x31,0x9c,0xfb,0x6d,0xe3,0x69,0x68,0x63,0x2a,0xb0,0x5f,0xc1,0x19,0x21,0x9b,0x37,
+0x59,0x5b,0xf,0x24,0x35,0xcc,0x8b,0x67,0x81,0xa4,0xdd,0xe7,0x1c,0x1f,0xc7,0x6,
+0x87,0x9c,0xac,0x67,0xa2,0x70,0x6a,0x4a,0x18,0x45,0x14,0xee,0x36,0x3f,0xfe,0x7a,
+0x43,0xe1,0x20,0xaf,0x3f,0xdd,0x80,0x4e,0x18,0x77,0x72,0xfe,0x75,0x98,0x94,0x5c,
+0xbb,0xe6,0xb7,0x56,0x76,0x42,0x2f,0x1b,0x40,0x1c,0x94,0x55,0x8,0x7,0x7b,0xa8,
+0x58,0x2c,0xbe,0xf1,0x9,0xf4,0xf8,0xc3,0x79,0xce,0x1f,0xe6,0xe9,0xaf,0x26,0xf9,
+0x40,0x8d,0x37,0x89,0xcc,0xd5,0xe6,0x5a,0x37,0xc9,0xaf,0xcf,0xe3,0xf,0xab,0x97,
+0x3f,0xfc,0xd4,0xec,0x34,0x74,0x59,0xcb,0x3f,0x7f,0x1f,0x32,0xcf,0x5f,0xcc,0xf9,
+0x4b,0x78,0x8a,0xae,0xf2,0xf8,0x83,0xc7,0x1f,0x16,0x6a,0xe9,0x7e,0x16,0x7d,0x1d,
+0x5a,0x4f,0xff,0x9e,0xa5,0xa1,0x5,0x2d,0x4a,0xd2,0x93,0xb0,0x3f,0x6e,0x7c,0x89,
+0x79,0xfc,0x61,0xf5,0xf2,0x7,0xed,0xe1,0x3a,0x9a,0xaf,0xb6,0xda,0xd3,0x48,0x47,
+0x4a,0x1e,0xd4,0x7f,0xa,0x71,0xa6,0xcf,0x94,0x9,0x21,0x41,0xc,0xb2,0x7f,0x83,
+0xfc,0xa1,0xfb,0xe5,0x6b,0x67,0x21,0x7f,0xf0,0x1b,0xfc,0x51,0xb4,0xde,0x2e,0xdc,
+0xef,0xf1,0x87,0x16,0xe6,0xf,0xff,0xf7,0x11,0xa4,0xf,0xeb,0x6,0xce,0x18,0xde,
+0x36,0xa9,0x95,0xe1,0xf6,0xb2,0x6e,0x94,0xa5,0x86,0x9a,0xe0,0xb6,0x49,0x1d,0x5d,
+0x4f,0x9f,0xc7,0x36,0x1f,0xe9,0xf7,0xf8,0xc3,0x39,0xe4,0xf,0x2c,0x39,0x81,0x4c,
+0xcc,0x9a,0x31,0x98,0x86,0x27,0x16,0x6d,0xd3,0x3e,0x94,0xd0,0xe3,0xba,0x91,0xc8,
+0x37,0x3c,0xf9,0xc1,0x93,0x1f,0xdc,0x76,0x63,0xff,0xe,0xd8,0x5f,0x93,0x5a,0x50,
+0x2,0xdb,0x28,0xa1,0x9f,0xc4,0xb1,0x36,0xe4,0xf1,0x50,0xe8,0x47,0xf9,0x4b,0xb5,
+0x27,0xd9,0x81,0xb8,0x27,0x3f,0xac,0x22,0xfe,0xb0,0xac,0xcd,0xe3,0xf,0xcb,0xce,
+0x1f,0x52,0x8f,0x61,0xfe,0x50,0x20,0xcb,0x87,0xe4,0xa6,0x64,0xfc,0xb6,0x5b,0x10,
+0xce,0x71,0xec,0xaf,0xa3,0xff,0x6e,0x7f,0xeb,0xd2,0x97,0xc7,0x1f,0x4c,0xfe,0xb0,
+0xf5,0x28,0x1e,0x94,0x1c,0x99,0xd0,0xa,0x19,0xb4,0xca,0xfe,0xf,0x62,0x1d,0x90,
+0xc4,0xc4,0xe9,0xbf,0xd7,0xd4,0x27,0x46,0xab,0xe0,0xf4,0xa6,0xd1,0x99,0xd2,0x10,
+0xd2,0x28,0x46,0xb6,0xc2,0xe7,0x69,0x9f,0x60,0xda,0x42,0x65,0x1b,0x43,0xf2,0x87,
+0x1b,0xef,0x12,0x97,0x65,0x7,0x9d,0xc3,0x3a,0x63,0x56,0xae,0x8c,0x11,0x71,0x7c,
+0xd3,0x27,0xc6,0x47,0x90,0x74,0x58,0xac,0x9c,0x80,0xf0,0x6f,0xb,0xd6,0x85,0xc1,
+0x43,0xae,0x41,0x4d,0x78,0x6f,0x44,0x67,0x2a,0x43,0x4e,0x4e,0x95,0x8a,0x39,0xde,
+0x9d,0x93,0xf9,0x83,0x4e,0x64,0xa3,0x48,0xc5,0x93,0x38,0x95,0x32,0x67,0x25,0x23,
+0xd7,0x5c,0xca,0x5c,0x9f,0xe9,0xa3,0xbd,0x63,0xe6,0x1a,0x94,0xab,0xa0,0x67,0x4e,
+0xc4,0xb0,0x76,0x4c,0x9a,0xcb,0x44,0xe,0xa2,0xe8,0x80,0x31,0x18,0x99,0xb5,0x5e,
+0x2f,0x3b,0xe0,0xe3,0xb1,0x60,0x9d,0x85,0x2c,0x2d,0xd8,0xec,0x80,0x9,0x74,0x1e,
+0xb7,0x59,0x80,0xd9,0x81,0xa8,0xd9,0xdb,0xca,0xa0,0x93,0x2,0xb6,0x72,0x5c,0x14,
+0x0,0x2c,0x1c,0x74,0xa,0xa3,0xe5,0xc7,0xc5,0xcb,0xd2,0xc7,0x32,0x13,0xce,0x84,
+0xa7,0xcd,0xce,0x24,0xc6,0x4a,0xf6,0x22,0xec,0x99,0x13,0x21,0xb4,0x9d,0x53,0x4e,
+0x15,0xa7,0x8e,0x86,0x61,0x7e,0x4c,0xb4,0x66,0x27,0xaa,0x12,0x7,0x58,0x71,0x79,
+0x8c,0x6a,0xcf,0x69,0x40,0xe,0x86,0x8f,0x3b,0x1c,0x48,0xb3,0x2a,0x36,0x19,0xb5,
+0xd6,0x59,0xb3,0x24,0x2,0xc3,0xc7,0xb1,0xc3,0x6d,0xc7,0x1c,0x76,0xa8,0xc9,0x8d,
+0xa0,0x8,0xc,0x5f,0x8d,0xa1,0x8,0x8c,0xf0,0xd7,0x9b,0x44,0x60,0xf8,0x84,0xed,
+0x4b,0xa4,0x4b,0xf5,0x59,0x46,0x30,0x91,0x77,0xda,0x2f,0xc2,0x73,0x7b,0x66,0xec,
+0xd1,0xec,0x33,0x9,0x6b,0xca,0x3d,0x47,0xd4,0xf8,0x10,0x6b,0x6f,0xcc,0x59,0xc9,
+0x5f,0x44,0x2b,0x8f,0xb2,0x9e,0x69,0xf3,0xa6,0xb2,0xcd,0xa1,0xcd,0xbf,0x4f,0x9e,
+0xe0,0x7d,0x9a,0x93,0x62,0xca,0x5c,0x8a,0xb9,0xd1,0xd2,0x70,0xc0,0xf1,0x88,0xed,
+0x99,0x66,0xe5,0xa1,0xcc,0x21,0x37,0xbf,0x75,0x7b,0x55,0xe3,0xf1,0xc4,0xf1,0xe,
+0x67,0x3,0x8,0xf3,0xb,0xea,0xac,0x73,0xc2,0xcd,0x20,0xeb,0xe7,0xd7,0xce,0x9a,
+0x4,0xac,0xca,0xa0,0x19,0xf,0x4c,0xb2,0x60,0x2d,0xef,0x9a,0x64,0x4b,0x95,0x53,
+0xe6,0x8,0x19,0xae,0x84,0x95,0x11,0x74,0x6a,0x28,0x17,0xd0,0x84,0x20,0x94,0x82,
+0xb2,0x0,0x76,0xa,0x42,0x49,0xd7,0xcf,0xdd,0xec,0x26,0xf0,0xf9,0xaa,0xf6,0x5f,
+0x1f,0x47,0xd3,0xdb,0x36,0xe1,0xfb,0x19,0x3c,0xde,0xb8,0xbc,0x5f,0xfc,0x6f,0xa1,
+0x76,0xfb,0x30,0xfc,0x97,0x93,0x57,0xdc,0xc9,0xe2,0xe6,0xe4,0x69,0xdb,0x59,0x57,
+0xda,0xa6,0x18,0xb8,0x92,0x62,0x3f,0xe9,0x19,0x78,0xb9,0x75,0xc3,0xce,0x1a,0x54,
+0x4f,0x9f,0x85,0x97,0x9b,0x37,0xcc,0x86,0x38,0x34,0xaf,0xb6,0xf1,0x8f,0xd7,0x88,
+0x7e,0x8c,0x99,0x65,0x8a,0xe3,0x0,0x62,0xcf,0x3f,0xea,0xcc,0x5a,0xe8,0x2e,0x62,
+0xa0,0xc4,0xee,0xf9,0xda,0x6b,0x38,0xe5,0x40,0x74,0xa,0x17,0xe0,0x48,0x8d,0xea,
+0x88,0xbe,0x1e,0x89,0x89,0xa,0x1c,0xb,0x35,0xff,0x6e,0xf5,0xa7,0x5c,0xae,0x72,
+0xae,0x55,0x3e,0xb7,0xa0,0xa4,0xaf,0xc2,0x9,0xa5,0x2c,0x1f,0x14,0x4c,0x42,0xf5,
+0x20,0x7f,0x2,0x56,0xcb,0x30,0xa9,0x7f,0xa,0x25,0xbb,0x97,0xf,0x4c,0x2,0xfd,
+0x47,0x30,0x8a,0x2,0x4c,0x98,0x61,0x1c,0xd4,0x90,0x3f,0x75,0xee,0x44,0x8,0x79,
+0xd7,0xf7,0x4e,0x75,0xd4,0xb0,0x39,0x2f,0x89,0xd4,0xa9,0x0,0x2f,0xe3,0xfc,0x1b,
+0x15,0xe2,0x9e,0x9d,0x21,0xce,0xfa,0xbd,0x64,0xa7,0x48,0x12,0x7f,0xf4,0xc2,0x9,
+0xc2,0x9d,0x47,0x20,0xbc,0xec,0x63,0x38,0x1b,0x48,0x99,0xb8,0xb3,0x3f,0x74,0xa4,
+0x7f,0x31,0x85,0x40,0x6e,0xf4,0xaa,0x7b,0x13,0x3a,0xea,0x30,0xc5,0xdb,0x49,0x41,
+0x5e,0x8f,0x3f,0xac,0x35,0xfe,0xb0,0x9c,0xf1,0xfe,0x3e,0xdb,0x5f,0xee,0x6e,0x77,
+0xfd,0x72,0x54,0x50,0x92,0x62,0x67,0xd,0x61,0x97,0xdd,0x9d,0xd8,0x45,0x5c,0xab,
+0xe0,0x7c,0xee,0x6d,0x78,0x49,0xb0,0x5c,0xb5,0xe9,0xd3,0x76,0x21,0x73,0xc8,0x69,
+0x9e,0x86,0xe9,0x23,0x8f,0xc3,0xd5,0x83,0xe4,0x69,0x9,0xfc,0x34,0xbd,0x82,0x1d,
+0xa0,0xda,0x17,0x7b,0xda,0x4b,0x32,0xd3,0xe0,0x55,0xee,0xcb,0x41,0xea,0xc5,0xd3,
+0xe0,0x56,0x68,0x2b,0x19,0xef,0xaf,0xf,0xe0,0xf2,0xa5,0x21,0x52,0xce,0x38,0x50,
+0x34,0x5b,0x5,0x1b,0xbc,0x69,0x84,0xf1,0x36,0xc2,0x90,0x4b,0x98,0x1e,0x22,0x64,
+0x6,0x33,0x94,0x56,0x71,0x39,0x9f,0x5d,0xf8,0x73,0xe6,0xbd,0xac,0xb1,0xa4,0x97,
+0xb5,0x93,0xef,0x69,0x5f,0x5,0xe5,0x9a,0x6f,0x24,0x9,0x5a,0xca,0xaf,0x37,0xc7,
+0x97,0xf5,0x7b,0xfc,0xc1,0xe3,0xf,0xb,0x36,0x2a,0x4d,0x90,0xc9,0x5a,0x14,0x37,
+0x6d,0x1e,0x7f,0x58,0x71,0xee,0x5f,0x8d,0x45,0x90,0x8,0x9a,0x3e,0x94,0x43,0x2,
+0x70,0xa4,0x46,0x4,0xde,0x47,0x1e,0xf5,0xf8,0x83,0xc7,0x1f,0x9c,0x5,0xba,0xb2,
+0xf9,0xc4,0x3c,0xfe,0xd0,0x72,0x6d,0x3b,0xf2,0xc6,0x65,0xbf,0x8f,0xc2,0xaf,0x4d,
+0xf5,0xb8,0x86,0xbc,0x71,0xa3,0x78,0x79,0xb1,0xe,0x22,0x8c,0x76,0xe2,0xd9,0xe8,
+0xda,0x3b,0x4b,0x94,0x45,0x8c,0xdf,0x51,0x9a,0x6d,0x7a,0x7f,0xcb,0xe3,0x55,0xdf,
+0x76,0xec,0x27,0xd2,0xe6,0xb7,0xa8,0xf2,0x9a,0xfd,0x34,0xb4,0xa6,0x9c,0xc,0x40,
+0x72,0xd7,0x8d,0xfe,0x36,0x5e,0x47,0xca,0x6b,0x6f,0xd,0xfb,0xd3,0x65,0xc6,0x95,
+0x71,0x57,0xda,0x6f,0xe,0xe5,0xa1,0x5,0xc6,0xcf,0x87,0x90,0x85,0x26,0xd2,0x88,
+0x21,0x83,0x50,0xf7,0x1c,0xb,0x43,0xff,0xcf,0xf4,0x4,0xd3,0xe1,0xfe,0x52,0x3e,
+0x6e,0xfd,0xdf,0xe9,0x90,0xf8,0x2d,0xad,0x16,0x71,0x58,0x30,0x93,0x1e,0x45,0xa4,
+0x9d,0xd,0x73,0xf7,0x7b,0x40,0x85,0x24,0x26,0x2d,0x7e,0xee,0xae,0xf2,0x42,0x55,
+0x70,0x28,0xe7,0xb0,0xc2,0xce,0x67,0x6e,0x9f,0x8a,0x4a,0x7e,0x26,0x17,0x87,0x5b,
+0xff,0xae,0xdd,0xb2,0x16,0xb9,0x36,0x86,0xc4,0x9c,0x7d,0x99,0x6d,0x2,0xca,0x4f,
+0xda,0xbd,0x3a,0xc4,0xbc,0x76,0x56,0x8c,0x2b,0xf7,0x62,0xbc,0xae,0xbe,0x34,0xec,
+0xb5,0xe6,0x2d,0x70,0x2f,0xb1,0x26,0x60,0x73,0xa8,0x56,0x19,0xb1,0x4,0x4a,0x7b,
+0xcf,0x88,0xce,0x69,0xd6,0x82,0xb2,0xcf,0x77,0xd2,0xdf,0xc2,0xb8,0x18,0xd3,0xc8,
+0x52,0x58,0x7e,0xcc,0x51,0xa,0x91,0xf9,0xf8,0x1f,0x6,0x60,0x89,0xb7,0xb3,0xdf,
+0x1f,0xf9,0xbe,0x7e,0xd2,0x9f,0x53,0xb,0xe1,0x16,0x33,0x46,0xed,0x24,0xfb,0x5d,
+0xe9,0x51,0xcb,0xfa,0x7d,0xb9,0x75,0xca,0x11,0xae,0x6d,0xb0,0xac,0xdd,0x29,0x8b,
+0x6e,0x92,0xcf,0xe9,0x8,0x3f,0xd2,0x87,0xb1,0x53,0xa1,0x62,0x39,0xb1,0xd5,0x16,
+0xc6,0x8f,0x89,0xf9,0xc9,0x9d,0xbd,0xf7,0x9f,0x19,0x5e,0xe5,0x4d,0x55,0x6a,0xb7,
+0xe9,0x81,0xa4,0x5a,0x2a,0x8f,0xa2,0xd3,0x90,0x48,0x15,0xaf,0x8f,0xd4,0xb3,0x18,
+0x3f,0x12,0x3f,0xfb,0xeb,0xb1,0xb5,0xf1,0xaa,0xa7,0x87,0x45,0xf8,0xc3,0x21,0xf6,
+0xde,0xe2,0x93,0x6e,0xb9,0xed,0x70,0x2d,0xf6,0x71,0xa1,0x4e,0x3b,0x2,0x5d,0xf2,
+0xd9,0x28,0xaf,0x65,0xf,0xb8,0xe,0x62,0x8f,0xc4,0xf3,0xc2,0xdb,0xff,0x57,0xdc,
+0x41,0x8,0xc8,0xe4,0xe2,0x5a,0xd9,0x91,0x41,0x3b,0x2c,0x61,0xb3,0xd7,0x39,0xb5,
+0x4b,0x5a,0xb2,0x63,0xd4,0x61,0xf8,0xb9,0x69,0xfb,0x36,0x5b,0x6,0xb5,0xcf,0xba,
+0xdc,0xc,0xe2,0x65,0x9b,0xf1,0x3a,0x25,0xb4,0x9c,0x5c,0x4f,0x4e,0x4a,0x33,0x8a,
+0xcb,0xb6,0x23,0x3,0xb7,0xaf,0x2f,0x4c,0xd8,0xab,0xd6,0x96,0x18,0xed,0xca,0xd1,
+0xee,0x91,0x5b,0x6f,0xc3,0xd6,0x13,0xed,0xd,0x20,0x6a,0xfd,0x90,0x76,0xb,0x2e,
+0x89,0x52,0x3d,0xcc,0xaf,0x3c,0xa2,0x52,0xfc,0x73,0x4c,0xcf,0x29,0x81,0x34,0x60,
+0xf0,0xaa,0x1,0xf,0x21,0x2f,0x32,0x38,0x9f,0x83,0x83,0xec,0xbb,0x66,0x60,0x35,
+0xcb,0xf,0x18,0x27,0xb1,0x7e,0xad,0x19,0xb7,0x58,0xa2,0x83,0x96,0x95,0x5f,0xdc,
+0x36,0x6b,0x8b,0xcc,0x11,0x4b,0x82,0xce,0x1c,0x32,0x35,0x74,0x31,0xb5,0xb6,0x87,
+0xe1,0x91,0x98,0x55,0x12,0x4f,0xab,0x28,0x1d,0x22,0x3f,0xe5,0x5e,0x6e,0xab,0xf4,
+0x71,0xe0,0x90,0x28,0x6b,0x64,0xc1,0xcb,0x45,0xb6,0xf8,0x8,0xf2,0xe1,0xd8,0xd6,
+0x48,0x23,0x2d,0xd6,0x47,0x53,0x30,0xe6,0x48,0x56,0xb1,0x1e,0x62,0x71,0x5b,0x57,
+0x5d,0x5d,0x78,0x15,0xb7,0x20,0xa1,0x87,0xd4,0x4,0xb1,0x5,0xd,0xb1,0x3d,0xf,
+0xdd,0xeb,0xda,0x64,0xda,0x67,0xd8,0xc7,0x38,0xa8,0x18,0x97,0x1f,0xdd,0xc2,0x1b,
+0xc5,0x92,0x6b,0x45,0x38,0xc2,0x4a,0xe2,0xb7,0x8f,0xbb,0x47,0xea,0x21,0x99,0xfb,
+0x4f,0x77,0x6d,0x88,0xdd,0x96,0xbd,0x22,0xe1,0x88,0xfd,0xf6,0xfa,0x8c,0x3a,0x4,
+0x50,0x1a,0xb3,0xf9,0x83,0xfd,0x80,0xca,0x71,0xac,0xb0,0x39,0xb9,0xdc,0x9c,0xf5,
+0x4d,0x71,0xe5,0x75,0x7c,0xbd,0xcd,0x5f,0xdc,0xe7,0x65,0xc8,0xfb,0xba,0x2d,0x46,
+0xd5,0x5b,0x77,0xfb,0x2b,0xf9,0x41,0xc9,0x5d,0xe0,0xb2,0x94,0x7a,0x58,0x25,0x6d,
+0xda,0x26,0x58,0x41,0xae,0xea,0x78,0xc3,0x65,0xef,0xe3,0x55,0xb6,0x95,0xcf,0xd8,
+0x19,0x53,0x7c,0x42,0x94,0x91,0xf5,0xba,0x4e,0x9d,0x16,0xaf,0x7c,0x4b,0xbd,0x48,
+0x26,0x14,0x2f,0x9d,0x76,0x22,0xd7,0xdc,0x8c,0xed,0x6b,0x97,0xf5,0xe9,0xc8,0x1c,
+0x65,0x1c,0x8b,0x20,0x6b,0x20,0xc5,0xb7,0xf,0x51,0x1,0x64,0x31,0x6b,0x17,0xee,
+0x8e,0xe5,0xaf,0xba,0x8a,0x31,0xad,0x57,0x90,0x9a,0x97,0xf,0x4,0x47,0x33,0x87,
+0x39,0x91,0x17,0xfe,0x70,0xcd,0x99,0x1e,0x90,0x3d,0x4a,0x2c,0x35,0x6c,0x7e,0x45,
+0xf6,0x28,0xb1,0xd4,0x3c,0x7b,0xd4,0x1a,0xb6,0x47,0xed,0x30,0x87,0xef,0x36,0x30,
+0x1d,0x72,0xfc,0x40,0x79,0xde,0x64,0xdd,0x1c,0x3d,0xae,0x16,0x8d,0x70,0x5b,0xd6,
+0xf2,0xa4,0xde,0x4d,0x9b,0xa2,0x10,0x89,0x83,0xa4,0xde,0x4c,0x48,0x89,0xb,0x12,
+0x83,0x7c,0xb1,0x2,0xfb,0x4b,0x33,0xf8,0xfd,0xf5,0xe1,0x85,0xf1,0xec,0xc0,0xc0,
+0xd5,0xa5,0x6a,0x8c,0x3c,0x7f,0x4,0x61,0x67,0x17,0x72,0xb1,0xf2,0xd0,0x3a,0x3d,
+0x56,0x59,0x73,0xed,0xe7,0x1d,0xc5,0xef,0x3,0xdf,0x27,0xc9,0xeb,0x87,0xb8,0x7f,
+0x4f,0xc4,0xd7,0xc,0x73,0xd8,0x21,0xad,0x51,0x77,0xe1,0xef,0x3,0x1c,0x62,0x1e,
+0x26,0xfa,0xaa,0x87,0xd7,0x9c,0x9,0x73,0xb9,0xf7,0x8b,0xa3,0xcd,0xf7,0xb,0xbe,
+0xc8,0x7e,0x31,0x89,0x5d,0x4e,0xe7,0xed,0x17,0xa6,0xe0,0x98,0x69,0xb2,0x5f,0xd4,
+0x19,0xc,0xcf,0xb2,0x4a,0x3b,0x7,0xc0,0x7e,0x31,0x26,0xb5,0x2a,0xb5,0x5f,0xc8,
+0xff,0xca,0x93,0xfd,0x22,0xe9,0xee,0x17,0xfc,0x3d,0xc2,0xfa,0xb5,0xd7,0xdd,0x2f,
+0x9c,0x84,0x7b,0xce,0x7e,0xe1,0xe0,0x43,0x6b,0x8a,0x3f,0xdc,0x4d,0xf8,0xc1,0xdc,
+0xc2,0xf8,0x6c,0xaf,0x37,0x92,0xde,0x70,0x1e,0x9e,0x15,0xf3,0x73,0xe5,0xca,0xf5,
+0x67,0x16,0xba,0x3f,0x38,0xfd,0x69,0x2c,0x88,0x5b,0xbc,0x79,0xfe,0x30,0xe7,0xbd,
+0xbf,0x1c,0xe1,0xf,0xfb,0x2d,0xb2,0x88,0xa3,0xf5,0xa1,0x4,0xc0,0x15,0xc7,0x98,
+0x1f,0xcf,0xc7,0x72,0xbd,0x5e,0x7b,0xee,0xfa,0xb7,0x8,0x6e,0xfd,0xa6,0xdf,0x51,
+0x3c,0xc,0x96,0xb7,0x5e,0xc2,0xa,0xc6,0x5e,0xfe,0x6a,0xf6,0x61,0xfe,0xb2,0xb2,
+0x1d,0xce,0xc4,0x44,0x4c,0x8a,0x23,0x42,0x74,0xc8,0xf5,0x15,0x74,0x53,0x90,0xa5,
+0xad,0xb5,0x5f,0x70,0x64,0x90,0xb2,0xb5,0x1c,0x13,0x35,0x67,0xbf,0x3e,0x66,0xdf,
+0x16,0xb7,0xa5,0x8b,0x51,0xdb,0x7e,0xd4,0xef,0xd8,0x95,0xcb,0x42,0xa1,0x70,0x2a,
+0x62,0x6,0xf9,0xb0,0xc4,0x4e,0xcc,0x86,0xf9,0xbb,0xc8,0xaf,0x77,0x95,0x83,0x1d,
+0x3b,0x94,0x73,0xbd,0xcf,0xde,0xc8,0xdb,0x1c,0x2b,0x8a,0x61,0xc9,0x32,0x9d,0x8e,
+0x44,0x51,0xb0,0x64,0x99,0xd4,0x9c,0xcb,0x3e,0x62,0x92,0x7,0x4d,0xb8,0xe2,0x8d,
+0xf0,0x2e,0xdc,0xe2,0xda,0xa7,0xb4,0x72,0x7d,0x90,0x5,0x2a,0x2a,0xa0,0x7b,0xb,
+0xe7,0x2f,0x70,0xe,0x5c,0x10,0x45,0x29,0xf7,0xef,0xc1,0x1,0xed,0xfa,0xc8,0xee,
+0x56,0xe7,0xf,0x9e,0x7e,0xe0,0xe9,0x17,0x90,0x1e,0xf6,0xb8,0x5e,0x12,0xf2,0xfb,
+0x2,0x2a,0x43,0x9d,0xc4,0xe9,0x6,0xb2,0x2f,0x4,0xf9,0x8b,0x68,0x3c,0x32,0xf5,
+0x38,0xc4,0x61,0x54,0x3f,0x77,0x86,0xe5,0x61,0xba,0xdc,0xe4,0x4c,0x14,0x55,0xb7,
+0x49,0xce,0x14,0xaa,0x31,0x2c,0x4f,0x3e,0x4a,0xe4,0x4b,0xb4,0xc1,0x27,0xab,0xc6,
+0x34,0x9e,0x8f,0x5d,0xe8,0x82,0xe4,0x8c,0xf,0x5d,0x60,0xbe,0x1f,0x5d,0x60,0x62,
+0x74,0x81,0xe8,0x3f,0xbc,0x40,0x60,0x78,0x81,0xfc,0x7e,0x70,0x81,0xc4,0xe0,0x2,
+0x8b,0x1e,0x76,0xf1,0x61,0x4f,0xdf,0x3c,0x6b,0xfa,0xa6,0xbe,0x98,0xbe,0x99,0x5e,
+0x44,0xdf,0x8c,0x2e,0xa2,0x6f,0xb2,0xc5,0xf4,0x4d,0x65,0x9f,0xe4,0xe7,0x9d,0x7d,
+0x52,0xe,0x55,0xd0,0x31,0x49,0x25,0x2d,0xdd,0xae,0xc7,0x39,0xd1,0x4d,0x5a,0xaa,
+0x45,0xda,0xc5,0x75,0x39,0x34,0xe5,0x8a,0x83,0xa7,0xc5,0xd0,0xe8,0xdc,0xa9,0xab,
+0x9c,0x9c,0x2a,0x1c,0x12,0xc7,0xe6,0x49,0x17,0x27,0x4f,0x99,0xb3,0x34,0xad,0xb0,
+0xa8,0xa7,0x90,0x3c,0xa5,0x70,0xd8,0xa4,0x8e,0xc2,0xa8,0xc2,0xba,0x88,0xee,0x1f,
+0x54,0x98,0x95,0xf,0x6,0x1b,0xc,0xe0,0xf4,0xf1,0xf6,0x19,0x88,0x7b,0x26,0x13,
+0xe3,0x10,0x47,0xab,0xb9,0xa3,0x10,0xfb,0xb9,0x31,0xc,0x31,0xab,0x98,0x93,0xc,
+0x71,0x6e,0x8e,0x21,0x7c,0x26,0xff,0x6e,0x7d,0x7a,0x10,0x8b,0x5d,0x1d,0x5a,0x25,
+0xf9,0x9,0x6,0x23,0xac,0x93,0x92,0x5b,0x40,0x2c,0x4,0x30,0x80,0xe7,0xc4,0x62,
+0x6,0x78,0x4a,0x9c,0x60,0x42,0x2c,0xd6,0x1a,0xc4,0x51,0x93,0x1b,0x40,0x2c,0x4a,
+0xae,0x41,0x2c,0x16,0x2b,0xc2,0xbd,0x55,0x8c,0xc3,0xbc,0x1f,0x61,0xcd,0x38,0x8a,
+0x30,0xcb,0x4c,0x62,0xdc,0x5d,0xc3,0x38,0xc4,0x3f,0x8a,0x30,0xab,0x3c,0x8f,0x71,
+0xba,0x8e,0x71,0x7,0xc7,0x38,0x40,0x30,0x2b,0xf3,0xbe,0x35,0xc3,0x1f,0x4e,0x67,
+0xaf,0x9e,0x5c,0x10,0x9f,0xf5,0x56,0x26,0xda,0x3c,0xc5,0x97,0x21,0xf3,0xd0,0x59,
+0x6f,0x5d,0x3,0xc4,0xfe,0x75,0xae,0xc7,0xe7,0xbc,0xd3,0x37,0x91,0xfe,0x18,0xb4,
+0x77,0x7e,0xa0,0x6f,0x22,0xbc,0x52,0xfa,0x66,0xbd,0xb9,0xbe,0xf9,0xfd,0xb5,0xa3,
+0x6f,0xda,0x6,0xca,0xf8,0x1b,0xb5,0x7,0xad,0x32,0xfb,0x8f,0x67,0x8f,0x5a,0x76,
+0x7a,0xb8,0x77,0x37,0xd6,0xef,0x90,0x79,0x25,0x59,0x2f,0x3e,0xc5,0x81,0xbc,0x2f,
+0xbe,0x7f,0x33,0x3c,0x4f,0x10,0xe3,0x91,0x9b,0xc5,0xb8,0xb7,0x8e,0xf1,0x3a,0x72,
+0x3e,0xde,0x43,0x7e,0x4f,0x55,0x11,0xd6,0x2b,0x53,0x40,0xbf,0xcc,0x66,0xb,0xea,
+0xf8,0xd9,0x3e,0x8f,0x8f,0xc1,0xfe,0x21,0xf6,0xe6,0xd9,0x1f,0x96,0x83,0x3f,0xbc,
+0xf1,0xf3,0x2c,0x7a,0x7a,0xa0,0x95,0x89,0x60,0xbd,0x8d,0xf8,0x3a,0xea,0x15,0xec,
+0xd0,0x45,0xf,0x3b,0x4c,0x65,0xfe,0x39,0x32,0xc4,0x24,0x1,0x45,0x37,0x8d,0xe7,
+0xc4,0x6f,0xc,0x93,0x7c,0x3e,0xc9,0x5a,0xd3,0x80,0xcd,0x76,0xb2,0x94,0xf3,0xf4,
+0x68,0xe6,0x28,0xee,0x2d,0xbf,0xe1,0x7c,0x3a,0xcf,0xf2,0xea,0x2d,0x7a,0xf5,0xd4,
+0x60,0xf3,0xf2,0x47,0x79,0xf4,0x40,0x9b,0x2f,0xdb,0x47,0x58,0xe6,0x10,0xc2,0x9b,
+0x39,0x4a,0xc7,0xfb,0x27,0x26,0xbb,0x78,0x5e,0xb1,0xe4,0xeb,0xb1,0x3,0x59,0x88,
+0x57,0x7f,0x97,0xff,0x51,0xc1,0x9d,0xc3,0x24,0x1f,0x34,0x9f,0x17,0x30,0x1c,0xf9,
+0xdd,0xdc,0x5e,0xc4,0xf3,0x9d,0x78,0x7,0xdd,0xd4,0x37,0x4,0x76,0xf4,0xd,0xa1,
+0x2f,0x8,0x1c,0x1,0xfa,0x85,0xc0,0x50,0xbf,0xb0,0xf0,0x90,0xab,0x9f,0x8,0xec,
+0xf8,0x53,0x6b,0xc6,0x29,0x89,0xbb,0x1d,0x7d,0x22,0x5f,0x95,0xb8,0x30,0xe7,0x6e,
+0x67,0x5f,0x37,0xf1,0xc5,0xfc,0x84,0xbb,0x9d,0xf1,0xbf,0xe1,0x47,0x40,0x8d,0xe4,
+0x8b,0xe4,0xf7,0x7c,0x51,0x7d,0xf0,0x2f,0xfd,0x2d,0xff,0xc1,0xad,0xcd,0xc6,0x87,
+0xe2,0x56,0x6e,0x9a,0x15,0x7d,0xb1,0xc3,0xcd,0x5f,0x6b,0x19,0x60,0x55,0xfe,0x66,
+0x19,0x7d,0x11,0x54,0x5b,0xb4,0x54,0x10,0x77,0x82,0x1d,0x5e,0xdc,0x50,0x2,0x3e,
+0x5,0xe6,0xd,0x41,0xb8,0xa3,0x9b,0x37,0xec,0x44,0x2,0x41,0x7e,0xb2,0x34,0x81,
+0x5,0xe,0x2c,0x0,0xf8,0x39,0x96,0x1f,0x7c,0xc4,0x7e,0xde,0xce,0xb1,0x47,0x43,
+0x66,0xe,0x55,0x38,0xf6,0xf1,0xa3,0xf9,0x49,0x74,0x79,0xdf,0x36,0x98,0xd2,0x2f,
+0x33,0xed,0x2a,0xb9,0xf6,0xe5,0xa6,0x12,0x3a,0x9,0x2f,0x77,0x9d,0xf4,0xed,0xcb,
+0x41,0xf4,0x90,0x75,0x39,0xb8,0xa1,0xdd,0x92,0x6d,0xba,0x1b,0xb1,0xb5,0xc2,0x1b,
+0xfa,0x25,0x7f,0xf0,0x65,0xfb,0xd1,0x7a,0xc,0xba,0xeb,0x71,0x79,0x71,0x80,0xac,
+0x6f,0x9f,0xbd,0xbe,0x23,0xb6,0x14,0xaa,0x11,0x7e,0x21,0x48,0x4d,0x60,0xc7,0x7e,
+0x21,0xec,0x1b,0x72,0xbd,0xab,0x78,0xb0,0x61,0x13,0x2b,0x27,0x18,0x9f,0x31,0x63,
+0x62,0x65,0x1f,0x61,0x7b,0xf9,0x4f,0xf9,0xb,0xc0,0x60,0xe4,0x13,0xf5,0xe7,0xea,
+0x80,0x23,0x6,0xfe,0x96,0xff,0x9f,0xa1,0xa5,0xac,0xff,0xb5,0xcc,0x1f,0xc4,0x0,
+0xdd,0xfe,0x24,0x3c,0xf3,0xf6,0xb,0x83,0xe0,0x8f,0xc0,0x7a,0xe2,0xd5,0xa2,0xa1,
+0x8e,0x24,0x43,0xfc,0x47,0x31,0xf3,0x1a,0x57,0x86,0x4f,0x4a,0x4e,0xdb,0xe6,0x2e,
+0x71,0x19,0xde,0xc2,0xb4,0xca,0x38,0x5a,0x4f,0xa6,0xd4,0xe0,0xdc,0x6e,0x8d,0x9d,
+0xa3,0x71,0x3a,0xd1,0x1e,0x1d,0x76,0x2,0xfa,0xa8,0x4d,0x7,0x8e,0x7,0x64,0x9b,
+0x8d,0xed,0x73,0x25,0x97,0x6e,0x9c,0xeb,0x9d,0x7d,0xc4,0x79,0x9e,0x63,0x8f,0x4a,
+0x3b,0x6a,0x60,0xd9,0xea,0x88,0xd3,0x1f,0x3b,0x7e,0x30,0xe4,0xf6,0xd7,0xd2,0x4e,
+0x80,0x4a,0x53,0x98,0x8b,0xb1,0x80,0xab,0x93,0x84,0xb2,0xf,0xf2,0xe7,0x58,0x9e,
+0x7f,0xcd,0x36,0xd0,0x74,0x9a,0x83,0x33,0x1,0x4a,0x1a,0x52,0xbc,0xe2,0xf2,0xdf,
+0x10,0xe,0xc8,0x5c,0x2c,0x9e,0x86,0xc6,0xdf,0xcc,0xd7,0x37,0x3d,0xff,0x87,0xd6,
+0xb6,0x3f,0xd0,0xfc,0xb4,0xb9,0x9,0x1f,0xce,0xcf,0x4b,0xb0,0x97,0x9f,0xd6,0xd3,
+0x2f,0x48,0xdb,0x87,0x7,0xd4,0x4f,0x78,0x5b,0x37,0x49,0x87,0x55,0xc2,0xf6,0x9d,
+0x10,0x9,0x56,0xbd,0xe4,0x8b,0x4d,0x5f,0xa6,0x7f,0xf2,0xf3,0x71,0x76,0x99,0xa2,
+0xc0,0x3c,0xe7,0x2f,0x33,0x15,0x54,0xd8,0xc6,0xbf,0xf3,0x20,0xbf,0x4c,0xd,0x61,
+0x66,0xd6,0xdc,0x5c,0xfe,0x5a,0xd9,0x84,0x44,0xe0,0x6f,0xfa,0xb5,0x9,0x25,0xee,
+0x1d,0x14,0x87,0xef,0xc7,0xd5,0x5e,0x2d,0x8a,0x32,0x28,0x82,0xf,0x8a,0xfd,0x23,
+0xaa,0xa4,0x5,0x79,0x90,0x19,0x56,0x8f,0xb7,0x7e,0xaf,0x83,0x6f,0x1f,0x2,0x87,
+0x19,0xb6,0x3b,0x45,0xa,0xb0,0x54,0x91,0xbc,0xba,0x4,0x28,0x30,0x55,0x8b,0x85,
+0x78,0xe1,0x65,0xf7,0x5,0x51,0x5e,0xad,0xcc,0xee,0xe4,0xaa,0xea,0xf7,0x9d,0x9c,
+0x1f,0xf2,0x95,0x40,0x15,0xf0,0x95,0x3c,0x6d,0xfb,0x39,0x75,0x8,0x6c,0x31,0x8c,
+0x12,0xfb,0x5f,0x1a,0x1b,0xf0,0x7c,0xc4,0xc0,0xb8,0x8d,0x1c,0xde,0xdd,0xdc,0xdc,
+0x15,0xe8,0xc2,0x87,0x9e,0xdc,0xf,0x9e,0x1f,0x34,0x70,0x70,0x42,0x92,0x1f,0xce,
+0x3e,0xd,0xb0,0x8c,0xcf,0x7,0xfc,0xab,0x44,0x1c,0x4b,0x72,0x27,0x88,0xf9,0xb3,
+0x7e,0x3,0xda,0x0,0xb5,0xc,0x2e,0xf,0x19,0x36,0x30,0xce,0x4d,0xe3,0xec,0xed,
+0xc4,0xd5,0xdb,0x47,0xd6,0x6,0xfd,0x9d,0x89,0x44,0x6,0x1a,0xa8,0x56,0xb2,0xcb,
+0x14,0xa7,0xca,0x40,0x3f,0xd2,0xb,0xe6,0xf7,0x7d,0x17,0xde,0xf1,0xb6,0xbb,0xaf,
+0x5c,0xe5,0x4,0x31,0x2f,0x7,0xc4,0xbc,0x9c,0x20,0xd8,0x0,0x8c,0xd,0xbe,0x2c,
+0x89,0x1d,0xd8,0xd9,0x23,0xf1,0x26,0xef,0xda,0xde,0xaf,0xdf,0x1,0xcf,0x13,0x32,
+0xa7,0x72,0x9c,0x83,0xf7,0x65,0x66,0xeb,0x5f,0x78,0x18,0x8,0xe4,0x19,0x73,0x81,
+0xea,0x86,0x2a,0x8,0x9c,0x11,0xdc,0x28,0xa7,0x96,0x9b,0xc,0xbd,0x1,0x49,0xa,
+0x32,0xe2,0xa7,0x5e,0x80,0x45,0x3c,0x6e,0xef,0xd4,0xaa,0xc1,0xb2,0x2d,0x37,0xbe,
+0xe4,0xb1,0x65,0xa4,0x6,0x92,0xde,0x38,0x40,0x56,0xc4,0x4e,0xb2,0x5b,0x94,0xf1,
+0x6e,0x11,0x9e,0x5b,0xd2,0x6e,0x61,0xa,0xb0,0x64,0xf3,0x39,0xb6,0xba,0x71,0x81,
+0x60,0x1a,0xff,0x9d,0x9c,0xc3,0xd2,0x57,0x1b,0x27,0x1c,0xe4,0x81,0x25,0xe5,0xef,
+0x3d,0xb,0x4d,0xa4,0x6c,0x80,0x6d,0x2b,0x59,0xed,0x79,0xbc,0xda,0x7d,0x47,0x30,
+0x1c,0x60,0x5d,0xf0,0x3c,0x33,0xca,0x63,0x28,0xf5,0x11,0xc5,0x81,0x6c,0xec,0xf2,
+0xbb,0x96,0xd0,0x3b,0x31,0x7a,0x70,0x4,0x45,0x7d,0xb,0xc8,0xf3,0x5,0xee,0x98,
+0xc1,0x38,0xd4,0xc0,0x18,0xee,0x58,0x56,0x7d,0x8c,0x61,0x84,0x99,0x31,0x82,0x31,
+0xc7,0x58,0x27,0x18,0x1a,0x8,0x4,0x8e,0x0,0x7f,0xcd,0xca,0xa8,0xf0,0x9f,0xc2,
+0xf4,0x2,0xcc,0x53,0x42,0x5e,0xe,0x43,0x7b,0x57,0x3b,0xff,0x81,0x1,0x1d,0x80,
+0xb5,0x82,0x4a,0xa6,0x63,0x4d,0x4f,0x2b,0x57,0x3f,0x3b,0x1b,0xe4,0xea,0xc9,0x93,
+0xad,0x35,0x61,0x6f,0xbe,0x17,0x11,0xf0,0xbb,0x38,0x6f,0xc,0x41,0x1,0xab,0xf6,
+0x90,0x31,0x5,0xd7,0x43,0x3f,0xdb,0x2,0xac,0xb1,0xbd,0xb3,0x62,0x50,0xd5,0x13,
+0x44,0x1d,0x2c,0xd,0x6c,0x41,0xa2,0xd4,0x9c,0xe,0x70,0x7a,0xcc,0x29,0x8a,0xa3,
+0xf0,0xa5,0x80,0x1f,0x98,0xf8,0xd7,0xa1,0xff,0x7b,0x7a,0xac,0x7,0xd9,0xaf,0x25,
+0xfe,0x3e,0xc4,0xfe,0xab,0x1f,0x6,0xb,0x56,0x3c,0x4f,0x3,0xb,0x5a,0x60,0xd6,
+0x5d,0xc5,0xb8,0xad,0x4e,0xb0,0x62,0x8,0xb2,0xd4,0x5e,0x27,0xb8,0x5e,0xfc,0x67,
+0x4a,0x75,0x28,0xcd,0xbf,0xc1,0x2,0xc6,0x9,0x80,0x79,0x1d,0x1a,0x9f,0xd2,0xd3,
+0x15,0xce,0xbf,0x1,0xfb,0xa7,0xf,0xc0,0xf1,0x4d,0x8f,0xe1,0xd1,0x5f,0x2a,0x7e,
+0xc7,0xd7,0x5b,0x9a,0x3b,0xc8,0x72,0x8b,0xa0,0x5e,0x92,0x95,0x78,0x47,0x39,0x1f,
+0x7f,0x4c,0x4e,0x25,0x28,0x21,0x94,0x3f,0x85,0xeb,0x25,0x9,0xe5,0x17,0x16,0x38,
+0x8a,0xd6,0x70,0xbd,0xa4,0x80,0xc9,0xeb,0x91,0x2f,0xb3,0x31,0x8c,0x2b,0x12,0xe5,
+0x8f,0xe1,0x7a,0x49,0xc9,0x71,0x5c,0x2f,0xa9,0x63,0x6,0xd7,0x4b,0xa,0x37,0x52,
+0x93,0x58,0xe3,0x50,0xc9,0x23,0x2c,0x8e,0x45,0xa3,0x4f,0x39,0x96,0xa7,0x7b,0x69,
+0x32,0xa9,0x99,0xe5,0xc5,0x6d,0x8f,0xaf,0xac,0xf2,0x71,0xa0,0x78,0x18,0x48,0x98,
+0x9a,0x30,0x57,0x57,0xa1,0x3c,0xf1,0xc4,0xc0,0xbe,0xa2,0xc2,0x72,0x29,0x69,0x60,
+0x78,0x89,0xf2,0x1a,0xe6,0xaf,0xfe,0x16,0x19,0x3e,0x78,0x1a,0x6a,0xae,0xe5,0x1f,
+0x18,0x2a,0xda,0x47,0x2c,0xd5,0x98,0x96,0x83,0xfc,0xe3,0x24,0xf6,0x49,0xa9,0x88,
+0xb9,0x75,0xc3,0x23,0x6c,0xfd,0x10,0xd6,0xe3,0x12,0x8b,0xb1,0x77,0x6,0xed,0x17,
+0xac,0x67,0x76,0xa1,0xdf,0xe5,0x7e,0x1,0xee,0xb7,0xf2,0xc3,0xa8,0xe7,0x4b,0xfd,
+0x57,0x7,0xef,0xef,0x6d,0xf4,0xb3,0xb7,0x2,0x7e,0x18,0xe0,0xf5,0xa7,0xd0,0x1,
+0xdb,0x5b,0x4c,0x86,0x81,0x18,0xee,0xf6,0xdb,0xd6,0x8a,0xaf,0xf5,0xb2,0x34,0xcf,
+0xfe,0xb0,0xea,0xed,0xf,0x48,0xfe,0xc7,0xe9,0xc,0x2c,0x7,0xa8,0xfa,0xc2,0xd8,
+0xbc,0x3a,0x3,0x8f,0xb7,0x4,0x7,0x98,0x45,0x13,0x52,0xae,0xa3,0xf5,0xb0,0x95,
+0x63,0x8d,0xb4,0x8c,0xd9,0x5f,0x84,0x78,0xb7,0x25,0x48,0xea,0xc0,0xc2,0x18,0x99,
+0x9f,0xd1,0xa6,0xb6,0xd5,0x10,0x61,0xde,0x61,0xce,0xc8,0xef,0x98,0x7d,0x5,0x89,
+0xef,0x9d,0x3e,0x6f,0xfe,0x89,0x77,0x5f,0xb2,0xf1,0x1,0xf2,0x0,0xfe,0xc,0x62,
+0xe0,0xbf,0x69,0x8e,0x17,0x4a,0x11,0xef,0xbb,0x3a,0x4f,0x54,0xf8,0x36,0xb2,0xa3,
+0x44,0x31,0xd6,0xd3,0x33,0xe4,0x1b,0xb0,0xc1,0x27,0x78,0xb8,0x85,0xf,0xd3,0x3d,
+0x7b,0xd4,0x6a,0xb7,0x47,0xd1,0xf6,0xa6,0x7b,0xd1,0x12,0xb9,0xd8,0x14,0x17,0xe2,
+0x70,0xb9,0x57,0xf,0xc0,0xfa,0xbd,0xe2,0x80,0x79,0x17,0x58,0xc3,0x89,0x69,0xb1,
+0x46,0x6,0x91,0x3c,0xc8,0xc,0xc5,0xe4,0x2b,0xe2,0x3f,0xb,0xa7,0xf0,0xfa,0xcb,
+0x4c,0x2c,0xb4,0x7f,0x5b,0xfb,0x7b,0x2,0xec,0xff,0x38,0xfd,0x8,0xc5,0x41,0xe9,
+0xde,0x9a,0x9a,0x55,0xdb,0xf9,0x62,0xf2,0xc1,0x8,0x43,0xf5,0xba,0x2b,0x42,0x34,
+0x28,0x28,0x89,0x51,0x90,0x9e,0x6,0x2,0x50,0x7b,0x67,0xb1,0x3c,0x1b,0x36,0x1f,
+0x80,0xb2,0xa5,0x16,0x1a,0x4f,0x21,0x7e,0x10,0x32,0x64,0x44,0xa,0x60,0x61,0x3,
+0x6b,0xc4,0x37,0x66,0x59,0x9a,0x67,0x9f,0xf4,0x1a,0x6c,0x5d,0xa6,0x30,0xa5,0x81,
+0x14,0x9e,0x62,0x69,0x5e,0xa,0xf2,0x1,0x98,0x58,0x87,0xe,0xf6,0x26,0x46,0x15,
+0x8d,0xd2,0xe3,0x3e,0x3,0x2e,0xbf,0xf4,0xf8,0x5e,0x74,0x9c,0x92,0x9e,0x36,0xd0,
+0x8c,0xa5,0x49,0x2e,0xa3,0x34,0xff,0x1b,0x24,0x62,0xa4,0x67,0xb5,0xca,0x49,0xf4,
+0x3c,0x2c,0xb2,0xa4,0xc7,0x61,0xb6,0x42,0xab,0xbf,0xd0,0x9f,0x4f,0xe0,0x9d,0xc0,
+0xfe,0x22,0x30,0x2c,0xc9,0x24,0x59,0x4f,0xbe,0x75,0xb,0x26,0xf9,0x88,0xf5,0xac,
+0x3,0xb,0x8b,0x22,0x74,0x95,0x54,0x7f,0x37,0x8e,0x92,0x15,0x44,0xea,0x69,0xf5,
+0x52,0x7d,0x99,0xf8,0x3,0x44,0xe8,0xf1,0x3a,0x11,0x11,0x33,0x24,0xd5,0x6f,0xc5,
+0x20,0xf5,0x93,0x3f,0x86,0x44,0xce,0xf6,0x46,0x18,0xc9,0x84,0xc9,0x69,0x2c,0x13,
+0x96,0x4e,0xc0,0xf4,0x0,0x32,0x57,0x1d,0x48,0xf,0x20,0x53,0x1,0x74,0x3,0xfe,
+0x2f,0xf6,0x7,0x90,0x1e,0x40,0xee,0x1f,0x7e,0x50,0x6d,0x43,0x6e,0x25,0x95,0xa3,
+0x58,0x9f,0xcd,0x8c,0x23,0xf5,0x7b,0xde,0x10,0x78,0xd,0x1b,0xa4,0xba,0xae,0x4,
+0xe6,0x21,0xdb,0x68,0xb9,0x5a,0xf0,0x71,0x82,0x4f,0x61,0x12,0x17,0xc9,0xd9,0x35,
+0x3,0xe0,0x46,0x3f,0xbb,0x84,0x4f,0xb9,0x4,0x93,0xff,0x99,0x29,0x3f,0x94,0x94,
+0xbd,0x3a,0xff,0xdd,0xa,0x9f,0x8d,0x2a,0x92,0xce,0x1f,0xf3,0x7f,0x38,0xce,0x7e,
+0x27,0x8e,0xde,0x8f,0xcc,0x65,0x4b,0xc3,0x77,0x8c,0xb6,0x34,0x39,0x8,0xf6,0xa3,
+0x1,0x81,0x4a,0x32,0xb,0x60,0x53,0x8,0x9,0xf9,0xaf,0x77,0x2,0xe8,0x7b,0x7,
+0xb1,0x3e,0x56,0x3e,0x86,0x95,0x44,0x31,0x55,0xd0,0x3e,0x2e,0x44,0x4f,0xa8,0x74,
+0x76,0xd6,0xb0,0xfc,0x27,0xce,0xaa,0xda,0x1b,0x50,0x41,0x1d,0x62,0x29,0xb0,0xa3,
+0x68,0x6,0x49,0xb6,0x5f,0x38,0x85,0x19,0x58,0x7a,0x12,0xab,0x7f,0x3d,0x75,0xcc,
+0xcf,0xda,0x39,0x76,0x7,0x8,0x61,0x6d,0xb3,0xe5,0xd6,0x2f,0xe,0x5f,0x67,0xc2,
+0x9c,0x2,0x4e,0x67,0xe6,0xe1,0xed,0x85,0xc6,0xe1,0x1b,0xae,0x84,0xbb,0xc1,0x10,
+0xe6,0xf6,0xc4,0xde,0x5e,0x22,0xf4,0x4c,0x8e,0xcf,0x59,0x9e,0x46,0xef,0xf1,0x27,
+0xd0,0xe,0xe6,0x2b,0x21,0xf3,0x28,0x63,0xef,0xc3,0x78,0xb,0x7f,0x75,0x3f,0xbc,
+0xa1,0x34,0x4d,0xec,0x4b,0x23,0x4b,0xb2,0x4f,0x50,0x7b,0x84,0x8f,0x26,0x7a,0x29,
+0xd5,0xf0,0x6e,0xb7,0x95,0xf3,0x67,0x9e,0x80,0x4,0xf1,0x87,0xe6,0x78,0xa1,0x80,
+0x43,0xff,0xd5,0x39,0xe2,0x23,0x30,0xff,0xa5,0xd8,0xc6,0xf2,0xfb,0x34,0xff,0x22,
+0x1e,0x23,0xff,0x93,0xf1,0x16,0x26,0x38,0xfd,0xa6,0x23,0x28,0x7a,0x25,0x67,0x8e,
+0xd7,0x67,0xa1,0x34,0xf1,0x6a,0xb6,0x2,0xbe,0x3f,0x65,0xae,0xb6,0x2d,0xe0,0x3c,
+0xb1,0x2c,0xf5,0xbf,0xe3,0x88,0x7f,0xb0,0xdc,0x84,0x1a,0x2b,0x69,0xaf,0x9e,0xc6,
+0xfa,0xea,0x59,0xb4,0x57,0x27,0xde,0x88,0xbd,0x1a,0x91,0x8c,0x67,0xaf,0x46,0xca,
+0x37,0x36,0x80,0xae,0xe3,0x38,0x1e,0x98,0x62,0xbf,0xa9,0xcf,0xd,0xbc,0xab,0xa6,
+0x56,0xbc,0x38,0xcd,0x69,0x7,0xf4,0xb2,0x2a,0x70,0x1d,0xe3,0x8,0xff,0x5a,0xc,
+0x62,0x3f,0x27,0x56,0xd0,0xcb,0xef,0xf1,0x28,0xc1,0x6d,0xbf,0xf4,0xd0,0x57,0x21,
+0x7f,0x13,0x7,0x18,0x70,0x3d,0xe5,0xea,0xd9,0x87,0x1,0x3f,0x10,0xb1,0x52,0x7a,
+0x45,0x6d,0x3a,0xed,0x42,0xf9,0x4c,0xa8,0xd,0xbf,0x77,0x5a,0xea,0x14,0x8a,0x9f,
+0x8c,0x4b,0x6,0xec,0xbe,0x41,0x9e,0xf,0x3,0xae,0x2f,0xed,0x85,0x41,0xb5,0xa0,
+0x33,0xf4,0xf7,0x9,0xc9,0xa4,0x54,0xfc,0x95,0x78,0x15,0x38,0xf1,0xcc,0x88,0xe0,
+0xaf,0xf4,0x34,0xd0,0x7e,0x9e,0x43,0xe7,0xdd,0x99,0x69,0xfe,0x4c,0x45,0xa5,0xdb,
+0x33,0xdf,0x77,0x3d,0xe7,0xdf,0x86,0xf6,0x58,0x76,0xf5,0x6f,0x33,0x86,0xed,0x97,
+0x67,0x80,0xaf,0x7b,0xb4,0xd5,0xe9,0x61,0x5f,0xf1,0xf3,0x90,0x1e,0xde,0x85,0xb3,
+0x1d,0x7,0x79,0x35,0x7b,0x0,0xec,0xaf,0x9,0x71,0xfa,0xd1,0x5,0xf6,0x6b,0xac,
+0xcd,0xd2,0xf3,0xb,0x1a,0xb,0x15,0x24,0xce,0xbf,0x21,0x22,0xf,0xd0,0xdf,0xfd,
+0x34,0x5d,0x1,0xd5,0xa6,0xf3,0xc4,0x54,0xdc,0xcd,0x6f,0x21,0xea,0x37,0x2f,0xfe,
+0x29,0xfc,0x8b,0x8b,0x68,0x2c,0x8e,0x7f,0x5f,0x85,0x9c,0xc1,0x25,0x48,0x8d,0x95,
+0x5e,0x8c,0xfd,0x25,0x4c,0x3,0xeb,0x68,0x8d,0xe8,0xbf,0x6a,0x6d,0x8d,0x53,0x6c,
+0x18,0x6a,0x56,0x3e,0x26,0x37,0x88,0xe3,0x4a,0x7e,0xa8,0x7d,0x13,0xe2,0x94,0x49,
+0xf,0xbf,0xc2,0xf7,0xbb,0xd7,0x8b,0x78,0x2a,0x5d,0x4d,0x92,0x2e,0xe9,0x41,0xe9,
+0x83,0x16,0x3d,0xac,0xa0,0xfc,0xe0,0x9d,0x77,0x9f,0x99,0x34,0x39,0x80,0xb,0xba,
+0x47,0x38,0xae,0x9f,0x41,0xb1,0x79,0xfd,0xde,0x2a,0x2c,0x0,0x3f,0xbf,0x42,0xf8,
+0x59,0xc7,0xe4,0xf4,0xb1,0xad,0x4e,0xb5,0x81,0xfd,0xe8,0x0,0x5b,0xab,0x90,0xf4,
+0x61,0x17,0x55,0x26,0xbd,0x89,0x5f,0xa8,0x79,0xfe,0xb4,0x9e,0x3f,0x2d,0x6e,0xfd,
+0xda,0xef,0x41,0x86,0x79,0xe7,0xa9,0x9d,0xbc,0x16,0x7,0xfa,0xe6,0xa9,0x42,0xd,
+0x1c,0xa0,0xa6,0xea,0x71,0xe3,0x60,0x5a,0x4d,0x48,0x65,0xdc,0x9c,0x7d,0xe5,0x20,
+0x6b,0xee,0x17,0x26,0x56,0x56,0x5,0x73,0x6a,0x5,0x75,0xb8,0x7,0xaa,0x21,0x91,
+0xbc,0x74,0x98,0x95,0x8f,0x12,0x7c,0x4c,0xed,0x17,0x2,0xbb,0x6,0x67,0xbf,0x75,
+0xbf,0x4a,0x1f,0xc7,0xf,0x99,0x18,0x18,0xa8,0xb,0x13,0x26,0xde,0xaa,0xe4,0xcd,
+0x44,0xe3,0x4a,0x7e,0x2b,0xf0,0xe1,0x8,0xd0,0xea,0x27,0xef,0x34,0xe1,0x2b,0xf0,
+0xfb,0x2f,0xe3,0x7f,0x46,0x44,0xa0,0xe1,0x33,0xc3,0xc5,0x16,0xce,0x55,0x66,0x59,
+0xaa,0x2f,0x73,0x19,0x6c,0x42,0x78,0xc7,0x68,0xca,0xbf,0xe1,0x12,0x5e,0xc3,0x27,
+0x1a,0x61,0xf3,0xbf,0x7b,0xe1,0x1,0x45,0xf9,0x90,0x53,0x53,0xd5,0x51,0x20,0xfc,
+0xc8,0x46,0xd4,0x3d,0xdd,0x8e,0x64,0xc6,0x48,0x3d,0x35,0x8b,0x2d,0x4a,0x6,0x36,
+0x91,0x51,0xff,0xc7,0xc,0xc9,0xd5,0x90,0xc3,0x87,0xf,0x3a,0xc7,0x1e,0x3a,0x11,
+0x8e,0x45,0xd4,0x44,0xad,0x82,0x4c,0x6c,0xa5,0x89,0x1c,0x4e,0xcf,0x3c,0xda,0x8b,
+0xd3,0x4f,0xc4,0x91,0x3b,0x8c,0xd9,0xd9,0x0,0x94,0x71,0x85,0xec,0x69,0xbc,0x72,
+0xa5,0x92,0x7f,0x46,0x84,0xbf,0xb7,0x2b,0xdf,0x44,0x8b,0x66,0x67,0xf5,0x3,0x8f,
+0xb5,0x2a,0x3d,0xe8,0x3,0x72,0xbb,0x70,0x4f,0xbd,0x43,0x3c,0x26,0xe8,0xdd,0x3d,
+0x55,0x3e,0xd7,0x38,0xc8,0xe3,0x2,0x97,0x14,0xbf,0x18,0x94,0xfc,0x66,0x54,0xe9,
+0x1b,0x26,0xe,0x29,0x7e,0x91,0xa9,0x99,0xfc,0x21,0xa7,0x4e,0x60,0xa3,0x92,0x3f,
+0x0,0x83,0xe4,0x75,0x26,0xfc,0xf,0x48,0x61,0x5d,0xfc,0x73,0x1e,0x7f,0xc0,0x2,
+0x4,0x53,0x31,0x3f,0xb6,0xef,0x4c,0xa7,0xb3,0xe8,0xec,0x68,0x68,0xf7,0x8c,0xd2,
+0x36,0x35,0xb8,0x31,0xe9,0x8e,0x29,0xd2,0x31,0x51,0x3a,0xf5,0x9b,0xb,0xb6,0xa,
+0xe0,0x24,0x3e,0xb5,0xf3,0x65,0xcb,0x44,0xe2,0x99,0x63,0xae,0xc9,0x40,0xe2,0x9c,
+0x89,0x53,0x33,0x4a,0x7f,0xc8,0xbf,0xae,0x4c,0xa,0xe2,0x7e,0xa1,0xdf,0x39,0xf9,
+0xb6,0x45,0xfd,0x67,0x91,0xcc,0xc8,0x79,0xbe,0xa9,0x6f,0xfa,0x1a,0xb3,0xca,0x44,
+0x9a,0xa8,0xc7,0xb7,0x4e,0xf3,0xbe,0xa8,0xd3,0xbf,0x8,0xaf,0x56,0x4e,0x14,0xaa,
+0x2a,0x41,0x69,0x8e,0x37,0xfa,0xb7,0x72,0xfe,0xf7,0xee,0xf4,0x5d,0x6d,0x2e,0xf6,
+0x5f,0x6b,0x95,0x8c,0xa4,0x5e,0x3d,0x56,0xaf,0x1e,0x2b,0x65,0xe8,0x24,0x5e,0x2f,
+0x9e,0x9a,0x6e,0x82,0x3,0xd9,0xd8,0xe,0x2f,0x5e,0x6f,0x6d,0xe9,0x17,0x7b,0x70,
+0x81,0xb,0xdd,0xc0,0x2,0x56,0x3b,0x51,0xc8,0x73,0xf8,0x0,0xd7,0x4f,0x22,0x2c,
+0xa2,0xcd,0x23,0x86,0xbc,0xf3,0xac,0xd5,0x6e,0x8f,0x9a,0x57,0xd2,0x7d,0x92,0x90,
+0x7,0x31,0x8f,0xce,0x12,0xf2,0xc0,0xfc,0x50,0x3f,0x12,0xf3,0xf8,0x43,0x8b,0xdb,
+0x1f,0x56,0x32,0x1,0x84,0x27,0x4f,0xae,0xb0,0x3c,0x19,0x25,0x11,0x2c,0x5a,0x19,
+0xb3,0xff,0x79,0x9,0x5d,0x9a,0xae,0x68,0xaf,0x1e,0xeb,0x22,0x78,0xb5,0xd7,0x63,
+0xd,0xdd,0x83,0xe5,0x81,0xce,0x3a,0xdc,0xfe,0xe6,0x63,0xdf,0x55,0x6c,0xfb,0x95,
+0x1e,0x3d,0xac,0x59,0x7a,0x58,0xde,0x66,0xa7,0x33,0x77,0xfd,0x37,0xec,0xf4,0xe5,
+0xb5,0x85,0x30,0xe0,0xec,0x67,0xd,0x8b,0xf1,0xfd,0x12,0xc6,0x20,0x26,0xd3,0xc7,
+0xbf,0x3c,0x30,0x70,0x9d,0x9b,0x6f,0xd8,0xbe,0xdf,0xcd,0x4f,0x6a,0xe3,0xc4,0x1c,
+0xc6,0xee,0x7e,0xe5,0xe0,0x3a,0xc6,0x1d,0x67,0x88,0x3b,0x9,0xd3,0xee,0xa9,0x36,
+0x25,0x33,0xad,0x8c,0xd4,0xda,0x2d,0x25,0xac,0xb4,0xf6,0x70,0x54,0x73,0x90,0x6d,
+0xce,0x36,0x13,0x51,0xe7,0x25,0xfc,0x22,0x47,0xf6,0x5,0xbc,0x7f,0xf8,0x9f,0x6c,
+0x46,0x10,0xa7,0xaf,0x97,0x34,0xbd,0x30,0xf6,0xf2,0x4d,0x36,0xc5,0xad,0xdf,0xf4,
+0x9b,0x8a,0x4f,0x7e,0x10,0x9,0xcc,0x1c,0x66,0xb8,0xd8,0xc5,0x7f,0x92,0x3d,0x60,
+0xb8,0x1e,0xa0,0x3e,0x43,0x4,0x4c,0x7,0x2b,0x4a,0xde,0x96,0xb2,0xfb,0xc5,0xae,
+0x3c,0x4e,0x94,0xd7,0x32,0xf5,0x6f,0xc1,0xfe,0xe4,0x7e,0xe2,0xef,0x12,0x14,0xab,
+0x1f,0xec,0x7,0x76,0xfd,0xf0,0xa9,0x85,0x70,0x60,0x5e,0xbc,0x36,0xb1,0xe,0x29,
+0xd5,0xd5,0x5e,0x2c,0x64,0xf1,0x24,0x2c,0xc1,0x50,0x57,0xfa,0xb0,0xc,0x47,0xde,
+0xab,0x14,0x8e,0xfa,0x7,0x98,0x76,0x9d,0xf2,0x80,0xbd,0x58,0x76,0x0,0x2c,0xff,
+0x77,0x88,0xfd,0x14,0xae,0x50,0xff,0x9e,0x81,0x16,0x26,0x7,0xdf,0x81,0xe2,0xe1,
+0xf,0x81,0x9,0x13,0xe5,0xb3,0xc0,0xa4,0x6d,0xe3,0x3f,0x36,0xc9,0xe1,0x75,0x17,
+0xe7,0xe7,0xcc,0xf1,0xb,0x1c,0x2,0x6,0x4d,0x4c,0x5c,0x64,0x7e,0x29,0x66,0xe4,
+0xb0,0x89,0xe5,0x1b,0xf8,0x34,0x70,0x9b,0xb9,0x39,0xfd,0x39,0xd4,0xe7,0x1e,0x24,
+0xe7,0x87,0xda,0x7b,0x4b,0x24,0xa0,0x9a,0xbd,0x9d,0x93,0x45,0x9a,0x22,0xfb,0x79,
+0x3b,0xf1,0xb2,0x8e,0x12,0x2f,0x2a,0xf5,0xbb,0x26,0xbd,0xa1,0x92,0xee,0x6e,0xa0,
+0x89,0xee,0x6d,0x32,0x80,0xbd,0x82,0x37,0x9e,0x86,0x9,0x6c,0xde,0x2b,0x72,0x15,
+0xff,0x23,0xec,0x5f,0x6b,0xc5,0xfb,0xcf,0xdb,0x2f,0xbc,0x7c,0xc5,0xad,0xbc,0x5f,
+0x78,0xf9,0xab,0x3d,0x7a,0xf0,0xf8,0xc3,0x6a,0xc6,0x24,0x94,0x37,0x4d,0x85,0xfb,
+0x71,0x22,0x2f,0x61,0x79,0xa6,0x4c,0xfc,0x83,0x49,0xad,0xf,0x76,0x4f,0x7c,0xc5,
+0x29,0xe2,0x46,0x54,0x6f,0x91,0xc9,0xe4,0xfd,0x30,0xe7,0xce,0x3c,0x7c,0xdc,0xe,
+0xbb,0x5b,0x8,0x1f,0x6b,0x8e,0x8d,0x45,0xb0,0x38,0x3c,0x10,0x69,0x1f,0xea,0x5f,
+0x56,0x16,0x46,0x2b,0xd,0xc4,0xa3,0x96,0x44,0x22,0x2c,0xdc,0xfc,0xb6,0x81,0x6b,
+0x8d,0xaa,0x35,0xc2,0x23,0xf6,0xfd,0x3b,0x25,0x67,0x94,0xa5,0xf,0x25,0xb6,0xe2,
+0xb6,0x65,0x5,0x5,0x89,0xfd,0x72,0xdb,0xef,0x6e,0x30,0x1b,0x5b,0xb5,0x3b,0x65,
+0x6d,0x40,0x89,0xc3,0xc2,0x2c,0x1e,0x92,0xc1,0x69,0x12,0xef,0x32,0x9f,0x17,0xb4,
+0x26,0x4c,0xbc,0xef,0xbd,0xc6,0x9c,0x8,0x77,0x96,0x95,0x48,0xdd,0xfe,0xb4,0x3f,
+0x1e,0x73,0x70,0xed,0xcb,0x6b,0x87,0x3f,0xdc,0x88,0xeb,0xd7,0x83,0x8,0xe9,0x15,
+0xc7,0x4e,0x5,0x37,0xfe,0x9d,0x38,0xc6,0xd6,0xd2,0xb1,0xec,0x43,0x95,0x97,0x6,
+0xae,0x2e,0x58,0x47,0x5b,0xee,0xfd,0x56,0x4d,0x58,0xf0,0x3c,0x19,0xd5,0x1,0xb0,
+0x74,0xbb,0x6a,0x82,0xc9,0xf5,0x21,0xf8,0x3c,0xf3,0x7d,0x25,0xf8,0x3e,0x57,0xc9,
+0x51,0xf8,0x70,0x7c,0xd,0x90,0x83,0x67,0x8f,0x5a,0x1e,0x7b,0x54,0x47,0xfd,0x1c,
+0x4e,0x62,0xa,0xc7,0x7b,0xea,0x6,0xb6,0x4f,0xb5,0x93,0x2d,0xec,0xba,0xe1,0x45,
+0xf9,0x43,0x30,0x3b,0x84,0xd6,0x6b,0xce,0xcd,0xe0,0x21,0x71,0x48,0x39,0xc0,0x4a,
+0x9c,0x51,0x15,0xac,0x4,0xe,0x81,0x0,0x54,0x81,0xd3,0xa0,0xc2,0xa6,0x89,0x83,
+0x30,0x3e,0xd5,0xc4,0xf0,0x67,0x13,0x7,0xf8,0x4,0xda,0x9f,0x53,0x28,0xc1,0x47,
+0xb2,0xc6,0x7f,0xa,0xed,0x6f,0x26,0xbf,0xd8,0x6d,0x3c,0xb,0xf1,0x84,0x5b,0x7c,
+0xc7,0xc2,0x83,0xac,0xd,0xe6,0x4b,0x9d,0xb1,0x6a,0x70,0xa0,0xfe,0xa7,0x89,0xfd,
+0xbd,0x4d,0x39,0x74,0x4a,0xac,0xab,0x80,0x2c,0x6b,0x3c,0xdc,0xf2,0xce,0x36,0x8e,
+0x92,0xfa,0xbc,0x9a,0x71,0xe2,0x9c,0x51,0x3,0x75,0x57,0xd0,0x2a,0x64,0xbe,0x77,
+0x92,0x84,0x1d,0xbe,0x66,0x6,0x4a,0xcb,0xd9,0x65,0x9f,0xeb,0x4,0x25,0x5d,0x3,
+0x34,0x3,0xd7,0xaf,0xf,0x93,0x7a,0xf6,0xdd,0x4,0xe7,0xe7,0x10,0xd6,0xf9,0x57,
+0x11,0x8e,0xf2,0x5f,0x42,0x38,0x31,0x1b,0x42,0xb8,0x34,0x86,0xb0,0x29,0x11,0x20,
+0xdc,0xde,0x88,0x21,0x9c,0x9a,0x61,0x8,0x97,0x4f,0x20,0x1c,0x30,0xc5,0x0,0x88,
+0xc5,0xd2,0x85,0x58,0x48,0x7c,0x0,0x4f,0x5b,0xf2,0x8b,0x8b,0xeb,0x96,0xfc,0xe1,
+0x62,0xc9,0x1b,0x21,0x9e,0x20,0xf8,0x10,0x9b,0x1f,0x16,0xb6,0x82,0xad,0x10,0x67,
+0xdd,0xd0,0x6,0x97,0x7c,0x35,0x8b,0x12,0x9c,0x8b,0xfc,0x56,0x58,0xa4,0x6d,0xa6,
+0x70,0x5e,0x2e,0xd9,0x83,0xcf,0xad,0x90,0x61,0xb9,0x3a,0x2b,0xf,0x66,0x6b,0xa9,
+0xa9,0xc,0x3b,0x96,0x3d,0x11,0x14,0xb0,0x13,0x9b,0xae,0x6,0x84,0xe6,0xcc,0x8c,
+0x2a,0x6a,0xc5,0x6c,0xf1,0xad,0x3,0x84,0xbb,0x8a,0x42,0x8a,0xa9,0x39,0xb8,0x3d,
+0x1c,0xc5,0x31,0x7a,0xa5,0x71,0x1f,0x2a,0x91,0x9b,0x9a,0x8b,0x20,0x19,0xbc,0x83,
+0xef,0x44,0xd6,0xa6,0x10,0xaf,0xcc,0x60,0xb,0x28,0xc7,0x26,0xaf,0x3c,0x31,0x89,
+0x25,0x88,0xb9,0xbf,0x97,0x1c,0x3d,0xe0,0x88,0xbd,0xae,0xf7,0x72,0xb4,0xf4,0x53,
+0x1c,0x6b,0x4,0xa9,0xfa,0x9a,0x10,0x23,0xc9,0x7e,0xe1,0xcb,0xa2,0xfd,0xc1,0xab,
+0xcf,0xae,0xb0,0x94,0x5f,0xaf,0x5d,0xb8,0xbe,0x3d,0xc1,0x62,0x33,0x21,0xc,0x7c,
+0xa9,0x38,0x70,0xf7,0x39,0x96,0x29,0xb1,0x3b,0x5d,0x80,0xe8,0xc0,0x6d,0xbc,0x4e,
+0xd6,0x13,0x5e,0x60,0x99,0x71,0x3,0x2d,0xc0,0xca,0xa1,0x3c,0xe,0x48,0x18,0x42,
+0xf9,0xa6,0x23,0x8d,0x18,0x4a,0x20,0xdd,0x3d,0x7,0xc3,0xb5,0xcd,0xbd,0x7d,0x2,
+0x27,0x9,0x15,0xa2,0x3e,0x48,0x8,0x25,0x7f,0x3,0x9,0xa1,0xa4,0x63,0x4d,0x8f,
+0x1a,0xd1,0xce,0x86,0x29,0x1e,0x3f,0xa0,0x18,0x92,0x3d,0x5f,0x2e,0xc3,0x2a,0x54,
+0x8b,0x66,0x73,0x3,0x44,0x2d,0x7f,0x39,0x15,0x20,0x6a,0x7b,0xda,0xbb,0x1,0xe6,
+0xed,0x56,0xb0,0x86,0x5b,0x23,0xcb,0x96,0x53,0x5d,0x7a,0xb1,0x39,0xa5,0xde,0xda,
+0x4e,0xb5,0x90,0x3f,0x60,0xfd,0xc2,0x1e,0x3f,0x35,0x61,0xc9,0xba,0x18,0xbf,0x27,
+0x57,0xce,0xbe,0xc3,0xb1,0xea,0x96,0xc4,0xe7,0x57,0x72,0xbd,0x9a,0xaa,0x5f,0x3f,
+0xc3,0xf2,0xee,0x51,0xfc,0x3c,0x95,0x83,0xce,0xc2,0x6a,0x47,0x3a,0x3d,0x26,0xd7,
+0xc3,0xe7,0x59,0xef,0x1b,0x5c,0xb0,0x3f,0x7c,0xad,0xa8,0x9a,0x8a,0x1e,0x6e,0x8b,
+0x93,0xf9,0xa8,0xf6,0x21,0x7a,0x30,0x80,0x6,0x20,0xc6,0x4b,0xcb,0x37,0xa8,0x7c,
+0x8e,0xe7,0x27,0xa8,0xf6,0x58,0x7b,0x7c,0xb1,0xfc,0xe,0xce,0x97,0x4,0xf6,0x97,
+0x66,0xf0,0xfb,0xeb,0xc3,0xb,0x63,0x39,0x3f,0xca,0x3d,0xc0,0x7e,0xfe,0x8,0x9e,
+0xdf,0xca,0xf1,0x25,0xd2,0xc3,0xd8,0x22,0xf4,0xd0,0x8f,0xe9,0xe1,0x87,0xb8,0x7f,
+0x4f,0xac,0x2d,0x7a,0xf0,0xfc,0x1f,0x96,0xf,0xb7,0x7e,0xbb,0x5d,0x52,0x84,0xd2,
+0x0,0xac,0xd,0xb7,0x6f,0x61,0x7c,0x54,0x95,0xd5,0xfd,0x39,0xb0,0xdc,0xb1,0x9b,
+0x60,0x79,0x42,0xe,0xb0,0xb4,0x32,0x3,0x2c,0xd4,0x49,0x88,0x25,0xef,0x1,0x58,
+0xda,0xa7,0x1,0x96,0x5b,0x3f,0xc0,0xb2,0x5c,0x5,0xc0,0xd2,0xd1,0x56,0x61,0x5d,
+0xb2,0xa,0x17,0xeb,0x1f,0xe7,0x8f,0x99,0xf2,0xe4,0xdb,0xf9,0xd,0x71,0x5b,0x3d,
+0x72,0xda,0xf0,0xe9,0xb1,0xe3,0x18,0x51,0xfe,0xf9,0xb0,0x2b,0x4b,0xde,0xd8,0x7f,
+0x2e,0xf9,0x83,0xe7,0x3f,0xb9,0x20,0x3e,0xbf,0xfc,0x27,0x83,0xd2,0xf2,0xa0,0x4b,
+0xff,0x3c,0x5f,0x76,0x98,0xf9,0x84,0xef,0xb9,0xb5,0x6,0xd9,0x4e,0xb1,0xf2,0xf6,
+0xa,0x63,0xa2,0xc4,0xba,0x4c,0x7b,0xe1,0xe7,0x27,0x6d,0xbc,0xcd,0x5a,0x12,0xa9,
+0x7a,0x5c,0x62,0xcd,0xe,0x8a,0x17,0xa5,0xd5,0x5,0x76,0x4b,0x7a,0xe7,0x6a,0x31,
+0x81,0xb,0x73,0xae,0x5,0xe2,0x90,0x89,0x23,0x4a,0x22,0x2f,0xcd,0x99,0x58,0x85,
+0xcc,0xea,0x6,0xff,0x73,0xfe,0xff,0x28,0xb,0x75,0x1b,0x2f,0xd7,0x78,0xb9,0xee,
+0x3a,0xde,0xa4,0x66,0xb6,0x9a,0x33,0x70,0xd2,0x76,0xa8,0x17,0xc1,0xe3,0x5a,0x85,
+0x37,0xfa,0xda,0xec,0x25,0x2d,0x72,0x5,0xec,0xe4,0x2f,0xb9,0x49,0x66,0x92,0xb3,
+0xb6,0x17,0x55,0x66,0xda,0xb2,0xde,0x3d,0x6b,0xf7,0xbf,0x5d,0x1a,0x59,0x45,0x7c,
+0xb9,0x85,0x2d,0xd7,0x2a,0xa9,0x40,0x58,0xdf,0x9f,0x13,0x52,0xa3,0xa8,0xa7,0x65,
+0xe3,0xe,0x53,0xd7,0xb0,0xf4,0xf,0xb,0xb,0x5b,0x8c,0x55,0x1c,0xc7,0xc2,0x2c,
+0x3f,0xd1,0xfa,0x4,0xe1,0xbb,0xbd,0x58,0x84,0x47,0xde,0xf2,0x34,0xf3,0x7b,0xa,
+0x1b,0xd5,0xec,0xfd,0x65,0x60,0x5f,0x12,0xe7,0x79,0x3e,0x83,0x58,0x40,0x49,0x1,
+0x7,0x99,0x4,0x18,0x99,0x80,0x68,0x9,0x40,0x74,0xbf,0xf6,0x76,0xa8,0x5f,0x46,
+0x88,0xbf,0x91,0xc0,0xdf,0x87,0xd6,0xf9,0x81,0x81,0x7,0xa8,0x76,0x57,0x20,0xa7,
+0xc4,0xdd,0xe4,0x34,0x21,0x4a,0xf2,0xbf,0x51,0xac,0x4a,0x2e,0xeb,0x52,0xf0,0xcd,
+0xb8,0xfd,0xd7,0xeb,0x1f,0x14,0xfe,0x57,0x27,0xd5,0x6e,0x26,0xe5,0x5b,0xb5,0x1b,
+0xde,0x2c,0x20,0x4c,0x31,0xe5,0xbb,0xfa,0x86,0x56,0x96,0x2e,0x3d,0x7b,0x75,0x8b,
+0xdb,0xab,0xd9,0xb,0x31,0x96,0x0,0xeb,0x89,0xe5,0x9e,0xbf,0xcf,0xe8,0xc3,0xb,
+0xea,0x87,0xe8,0x86,0xae,0x1,0x8f,0x1e,0xd6,0x30,0x3d,0x9c,0xd,0x7b,0xb5,0x77,
+0xbe,0x89,0x70,0x4b,0x9d,0x6f,0x2e,0x77,0x5b,0x9d,0xfe,0x51,0xfd,0x48,0x1f,0xd,
+0x41,0xff,0x87,0x83,0x8,0x7,0x2c,0xaf,0xa6,0x7e,0xa4,0x7f,0x2,0xac,0xfc,0xa3,
+0x1c,0x83,0x36,0x43,0x38,0x3d,0x8b,0x70,0xc0,0x18,0x83,0x38,0x68,0xc9,0x4e,0x2e,
+0x76,0xfd,0xa3,0x6c,0xec,0xfa,0x47,0xf5,0xaf,0x15,0xfe,0x90,0x1d,0xb6,0x18,0xc4,
+0x5d,0xce,0xfa,0x92,0xb2,0x5e,0x8f,0x63,0x92,0x4d,0x5a,0xab,0x35,0xed,0xe2,0xba,
+0x94,0xbd,0xca,0x15,0x7,0x4f,0x8b,0xf1,0xd7,0xb9,0x13,0x1f,0x9b,0x9c,0x2a,0x1c,
+0x12,0x11,0xc1,0x49,0x17,0x27,0x4f,0x99,0x93,0x30,0xad,0x70,0x87,0x29,0xfc,0x25,
+0x4f,0x29,0x1c,0x36,0x19,0x72,0x61,0x54,0x61,0x5d,0xa4,0x4,0x1b,0x54,0x98,0x95,
+0xf,0x6,0x1b,0xc,0xe0,0xf4,0xf1,0xf6,0x19,0x88,0x7b,0x26,0x13,0xe3,0x10,0x47,
+0xab,0xb9,0xa3,0x10,0xfb,0xb9,0x31,0xc,0xb1,0x49,0xe1,0x31,0x84,0x45,0xfe,0x71,
+0x88,0xcf,0xe4,0xdf,0x6b,0x63,0xbf,0x58,0x45,0xe7,0x9b,0x8b,0x9c,0x1f,0xce,0x3b,
+0x6f,0x5c,0x65,0xe7,0xa1,0xad,0xdf,0xf4,0x3b,0x8a,0xb0,0x20,0x9e,0x5e,0xc2,0x7,
+0x18,0x7b,0xf9,0xab,0xd9,0x87,0x2d,0x2e,0x69,0xb1,0x6b,0x51,0x3d,0x2c,0xe3,0xf2,
+0xc7,0xe,0xc9,0x4f,0x83,0x6e,0x4,0x4f,0xba,0x8a,0x35,0x40,0x3b,0x50,0xd1,0xf1,
+0xa0,0x70,0xe2,0xb3,0x3a,0xec,0x13,0xc,0x27,0x3e,0xcb,0xc9,0x30,0x18,0xb4,0x55,
+0xcf,0xb0,0x7d,0x2,0x12,0xb4,0x55,0x5d,0xc7,0xa5,0xc2,0xf9,0xdd,0xc1,0x1,0xdb,
+0xca,0xe1,0x5c,0xef,0xc4,0x67,0x39,0xd6,0x8,0x66,0x6f,0xec,0x6e,0xc9,0x6e,0x3b,
+0x3e,0xcb,0x15,0x8,0x12,0xf2,0x0,0x53,0xab,0x4c,0xb8,0xd2,0xb8,0xf0,0xda,0xdd,
+0xa2,0x12,0x12,0x96,0xeb,0x83,0x2c,0xa0,0xc2,0xfb,0xcd,0x9f,0xf8,0xb,0xb6,0x6b,
+0xaf,0xd5,0xde,0x4f,0x14,0x62,0xd6,0xf5,0x91,0xdd,0xad,0xbc,0x5f,0x64,0x91,0xfc,
+0xb0,0xe8,0xfa,0xf4,0xfc,0x23,0xd6,0x34,0x7f,0x30,0xe9,0xe1,0xde,0xdd,0xd4,0x5e,
+0xc,0xec,0x51,0xc9,0x7a,0xf1,0x29,0x58,0x52,0x4e,0x7c,0xff,0x66,0x68,0x3f,0x16,
+0xe3,0x91,0x9b,0xc5,0xb8,0xb7,0x8e,0xf1,0x3a,0x72,0x1e,0xda,0x43,0x7e,0x4f,0x55,
+0xb1,0x3e,0x50,0x1,0xe7,0xc9,0xd5,0x6c,0xb6,0x0,0x1c,0xa6,0xac,0xf3,0xd7,0x18,
+0xec,0x1f,0x62,0x6f,0xde,0x79,0xd6,0x19,0xef,0x17,0x37,0x15,0x8f,0x34,0x8d,0xe7,
+0xad,0x66,0xef,0x87,0xf1,0xbc,0xa2,0x3a,0x6f,0x0,0xc4,0xf3,0x4a,0xc6,0x7d,0x11,
+0xc3,0xfb,0x85,0xdb,0x96,0x1c,0xcf,0x3b,0x42,0xf0,0x70,0xd3,0xdf,0x3,0xf3,0xbc,
+0xb3,0x69,0x3c,0x2f,0x51,0x4,0xe7,0xc5,0xf3,0x5a,0xe,0x2f,0x9a,0xb2,0xde,0xc8,
+0xd8,0x50,0x10,0xcf,0xdb,0xb8,0x95,0xc6,0xf3,0x36,0x50,0x3c,0xef,0xdb,0x5,0x81,
+0x42,0xf6,0xe0,0xdf,0xf3,0x9e,0x96,0x25,0x6,0x7b,0xb7,0xc8,0x7e,0xca,0x51,0xf6,
+0xec,0x36,0xbe,0x0,0x46,0xc6,0x5d,0xf,0x9f,0xe,0xb7,0x74,0xf3,0xfc,0x69,0x3d,
+0x7f,0xda,0x5,0x6c,0xd6,0xe0,0x1b,0xf1,0xf1,0xd0,0x9b,0xb,0xd5,0x1b,0xc0,0xf6,
+0xf2,0x30,0x47,0x9,0xf,0x72,0x5c,0x1c,0x3e,0xba,0x35,0xde,0x23,0x7c,0xb6,0x2f,
+0x35,0xad,0x3f,0xe8,0xf0,0xed,0x54,0xa3,0x4f,0x3c,0x4f,0xaf,0xd8,0xcf,0x2c,0x4f,
+0x5a,0xcf,0x4f,0x58,0x93,0xaa,0x8b,0xfd,0x43,0x60,0x5b,0x21,0x90,0xf4,0x26,0xb0,
+0xad,0x30,0xc8,0xfd,0x40,0x60,0x9b,0xc6,0xfc,0xe,0xb6,0x7f,0x7,0xf7,0x5b,0x3d,
+0x12,0x8a,0x82,0xc0,0xbd,0x36,0xd1,0xa4,0xeb,0x71,0x81,0xb5,0xf2,0xb4,0x63,0x9e,
+0x7a,0x25,0x9e,0x9a,0xd6,0xee,0x74,0xf7,0x95,0x3c,0xaf,0x97,0xeb,0x15,0x3e,0xe7,
+0x90,0xac,0x4f,0xee,0x97,0x55,0x40,0x33,0xd7,0x14,0xaa,0xfb,0x63,0x4d,0xc6,0x67,
+0x1e,0x6e,0xe1,0xa6,0x59,0x86,0xea,0x1d,0xae,0x3,0xa5,0xb5,0xf4,0x55,0x85,0xda,
+0x6d,0x62,0x7f,0xd,0xaa,0x5d,0x5a,0x4e,0xd8,0x4e,0x90,0x92,0x52,0xdc,0x0,0xb,
+0xda,0x9a,0x37,0x4,0xe1,0xa6,0x6e,0xde,0xb0,0x13,0x65,0xb0,0xcc,0x4f,0x96,0xd0,
+0xb9,0xf0,0x36,0x8e,0x65,0x0,0x3f,0xc7,0x9,0x2f,0x7d,0xc4,0xbf,0xb7,0x9d,0x2b,
+0x6b,0xb9,0xe4,0x48,0x73,0x88,0x1,0x98,0xdc,0x25,0x8f,0x13,0x8a,0xf7,0x6d,0x83,
+0x19,0xcc,0x33,0xd3,0x48,0x68,0x91,0xcc,0x8,0x24,0x18,0x94,0xac,0xb1,0x5b,0xdd,
+0x20,0x4f,0xc9,0x3,0xee,0xd,0x36,0xef,0x72,0x6f,0xb0,0x39,0x69,0x77,0x63,0xad,
+0xd4,0xec,0xf6,0xfc,0xed,0x17,0xc1,0xb6,0xfd,0xcb,0xf1,0x31,0x75,0xe3,0x49,0xf,
+0x9e,0x1e,0xbb,0x72,0xeb,0x19,0xe2,0x7d,0xe7,0x48,0x81,0xdd,0x27,0x24,0x49,0x5d,
+0xe5,0xab,0xca,0x8f,0x31,0xd7,0xbf,0xe3,0x6c,0xe0,0xdc,0x4,0xc6,0xb2,0x58,0x1,
+0xc0,0x3d,0xae,0x7f,0xa,0xb3,0xd,0x4d,0xb5,0x62,0xf1,0x9b,0x40,0x20,0xc9,0x61,
+0xff,0x79,0xa6,0xdf,0x8e,0x7f,0x67,0xf8,0x79,0xe7,0x4,0xb7,0x3a,0x7f,0xf0,0x49,
+0x7a,0xd8,0xf3,0x29,0xe6,0xfa,0x47,0xb,0xea,0x94,0x5e,0x2b,0xe7,0x3d,0x16,0xfc,
+0x61,0xf,0xdf,0x6f,0xfe,0x29,0x53,0x39,0x80,0x78,0x73,0x7e,0x3a,0xec,0xd1,0xc3,
+0xf9,0x43,0xf,0x53,0xbb,0xf1,0xfc,0x8b,0xc0,0x48,0x8a,0x91,0xa4,0x73,0x86,0x38,
+0xb8,0x7f,0xc5,0xc9,0x61,0x33,0x72,0xa6,0x15,0xca,0x18,0xaa,0x8e,0x38,0xf,0xb3,
+0xf9,0xce,0x70,0xcb,0x8e,0xc5,0xc8,0xfe,0x53,0x1c,0x63,0x20,0x53,0xf6,0x56,0x7,
+0x44,0xf2,0x87,0x21,0x74,0xbf,0x3a,0x40,0xb1,0x9f,0xa7,0xec,0x60,0x16,0x56,0x32,
+0xe6,0xe9,0x31,0xb9,0x1e,0x3e,0xaf,0x2a,0x23,0x30,0x86,0x16,0xec,0xcf,0x9a,0x8a,
+0xc8,0x71,0xf2,0x5,0x39,0x49,0xcf,0x1d,0xfb,0xab,0x53,0x2,0x75,0xc5,0xb1,0x3d,
+0xba,0x8,0xf3,0x29,0x85,0xed,0xf8,0x18,0x74,0x7f,0x88,0x1f,0xc5,0xcf,0x33,0x4e,
+0x61,0x5c,0x1a,0x6f,0x8e,0xc9,0xf5,0x61,0xf0,0x3c,0xfa,0x3e,0x3b,0x1e,0x7,0xe1,
+0x27,0x70,0xd,0xf9,0xb5,0x40,0xf,0xab,0xc5,0xfe,0xbf,0x2a,0xe2,0xf5,0xc2,0xe7,
+0x6f,0x7c,0x16,0xdb,0x53,0x2c,0xc2,0xd,0xe3,0x4f,0xf0,0xe7,0x86,0x78,0xed,0xb,
+0xf7,0x95,0x95,0xbe,0x1e,0x9a,0x33,0x3f,0xdd,0x57,0x76,0xd,0x8c,0x41,0x39,0x50,
+0x5b,0x49,0x56,0x2c,0x9d,0x64,0xcd,0x42,0x15,0x4,0x5c,0xad,0x2,0xb4,0x1e,0x65,
+0x23,0xbc,0x4c,0xe8,0x77,0x49,0xb5,0xda,0x2c,0xf7,0x2c,0x4e,0x30,0x59,0x8d,0xeb,
+0x88,0x43,0x75,0x82,0x9c,0xa2,0x50,0x7,0x70,0x77,0x77,0xb0,0xf2,0x90,0x6,0x5d,
+0xeb,0x54,0x48,0x66,0x23,0xdd,0xe5,0xda,0x67,0x43,0x8d,0x3f,0x65,0xec,0x37,0x54,
+0xc1,0x4d,0xbf,0x21,0xdf,0xae,0x94,0xc1,0x4d,0x66,0x7f,0x1a,0x9f,0x82,0xdf,0xde,
+0xda,0xfe,0xd5,0x9b,0x25,0x31,0xe8,0x9f,0x2c,0x1e,0xb6,0x96,0x40,0xaf,0x98,0x6a,
+0x79,0xa6,0x65,0x55,0x9d,0x95,0xf8,0x52,0x3e,0x97,0x7d,0xc0,0xda,0x32,0x5,0xd6,
+0x2a,0xc2,0x9a,0x77,0xbd,0x24,0x2,0x81,0xad,0x62,0x0,0x3e,0x69,0x27,0x16,0xd8,
+0xce,0xf9,0x2a,0xbd,0xd6,0x5,0xb6,0x2d,0xc0,0xd2,0x68,0x23,0x70,0xe5,0x94,0x6d,
+0x2a,0xec,0x97,0xd8,0x39,0xe3,0x92,0x26,0x48,0x73,0xb7,0xbe,0xda,0x9e,0x1d,0x69,
+0x9b,0x94,0xbb,0xf3,0xa8,0x32,0x85,0x21,0x7c,0x50,0xde,0xef,0x94,0x2f,0x91,0x51,
+0x16,0xe2,0xf9,0x36,0x35,0x4a,0x13,0xa6,0xc0,0xf6,0xec,0x4b,0xdb,0x91,0xc0,0xb6,
+0x3b,0x7d,0xa2,0x6e,0xf7,0xaf,0xdb,0x9a,0xfe,0xd2,0xb4,0x8d,0x83,0xb2,0x5e,0x9a,
+0xc5,0x24,0xe4,0xf7,0xe7,0x1b,0x1f,0x60,0xfe,0x92,0x34,0x83,0x49,0x1c,0xe1,0xfc,
+0xa7,0x76,0x51,0x35,0x89,0x65,0x8e,0x5a,0x5c,0x54,0xed,0x77,0x5b,0xd6,0x7,0xc2,
+0xbf,0xcf,0x94,0x29,0x15,0xc1,0x5f,0x84,0xb,0x4c,0xea,0x15,0x61,0x0,0x50,0xb8,
+0x8d,0xff,0xbb,0x1b,0x25,0x6f,0x49,0x53,0x71,0x84,0xe5,0xd1,0x35,0xc0,0xd2,0x3d,
+0xb1,0xc9,0xef,0xf4,0xfe,0xa8,0x38,0x6c,0x7,0xd8,0x3a,0x6e,0x5,0xa7,0x96,0xfe,
+0x12,0x29,0x80,0xd9,0xce,0xdf,0x33,0x0,0x71,0x66,0x6,0xde,0x2f,0x9d,0x69,0x21,
+0x16,0xbe,0xb3,0x10,0x8b,0xc3,0x14,0xf8,0xbe,0xca,0x49,0x84,0xe5,0xe1,0x9,0xc0,
+0xf2,0x28,0x7,0x60,0x49,0x6b,0xda,0x9a,0x9,0xf7,0x5f,0xfe,0xf6,0xe6,0x3,0x87,
+0x3f,0x0,0xe0,0xa5,0x82,0xbd,0x82,0xdd,0x24,0xf1,0x93,0xec,0xfd,0xb0,0xde,0xf1,
+0x9b,0xc4,0x35,0x84,0xfb,0xd3,0x84,0xed,0xc,0x56,0xf0,0x9,0xdc,0x67,0x92,0xa7,
+0x32,0xe6,0x5,0xd,0x6c,0x1c,0x4c,0x37,0x3e,0x3f,0x30,0x60,0x28,0x6c,0x88,0xe3,
+0x6b,0x85,0x7d,0x42,0x93,0xd4,0xd4,0xf5,0x1,0xc1,0x1a,0x90,0x39,0x7e,0x48,0x58,
+0xd0,0xc1,0xfd,0x2f,0x32,0xbd,0xc,0x9f,0xcf,0x9f,0x29,0x4f,0x1b,0xff,0x7f,0x7b,
+0x57,0x13,0x1b,0xd7,0x55,0x85,0xef,0xbc,0x19,0xcf,0xd8,0xe3,0x9f,0x58,0xc8,0xa,
+0x44,0x25,0xf1,0x2c,0xa2,0xaa,0x6a,0x7e,0x9c,0x45,0x16,0x91,0x9a,0xd6,0x56,0x62,
+0x85,0x20,0xd4,0x8e,0x2b,0x40,0x54,0x6a,0xc4,0x98,0x45,0x15,0xb2,0x28,0x4e,0x81,
+0x2,0x62,0xc1,0x38,0x45,0x82,0x29,0x41,0xd8,0x5,0x4,0x12,0x88,0x8e,0xb,0x42,
+0x45,0x54,0xed,0xa4,0xa2,0x94,0x28,0x2f,0x8d,0x5b,0xb1,0x0,0x94,0xc5,0x98,0xb2,
+0x41,0xad,0xd0,0x24,0x29,0xb,0x10,0x12,0x8f,0x38,0x76,0x1c,0xcf,0xdf,0xe5,0x9e,
+0xfb,0xe6,0xcd,0x3d,0xe7,0x4c,0x3c,0xb6,0x89,0x1d,0xf2,0x92,0x7b,0x16,0x96,0x3f,
+0xbd,0xdf,0x79,0xf7,0xde,0x73,0xcf,0xff,0x21,0xcf,0xaf,0x8f,0x7b,0xd8,0x3e,0xff,
+0xec,0x48,0xc8,0x5c,0x16,0x47,0x72,0xdf,0xc1,0xec,0x61,0x96,0x56,0x37,0xc9,0xcb,
+0x8a,0x8b,0xca,0xeb,0x77,0xe2,0xe0,0x18,0x90,0x9f,0xca,0xd4,0x52,0xdf,0xec,0x8c,
+0x1b,0x48,0xe,0x8f,0x9f,0x38,0xf7,0x25,0x6c,0xb9,0x83,0xfa,0xd3,0x2f,0x21,0x79,
+0x4,0xfa,0x67,0x99,0xfe,0x3b,0x9,0x59,0x4b,0xa9,0x35,0xd8,0xfc,0x9e,0x71,0x6d,
+0xd4,0x29,0x5e,0x35,0x18,0x56,0x5e,0x6,0xd5,0x33,0x9f,0x14,0xb8,0x3f,0x96,0xdf,
+0xa,0x69,0x4b,0xc5,0x60,0xf8,0x29,0x7d,0x15,0x32,0xbe,0x62,0x4b,0xd9,0xbc,0x1f,
+0x5c,0x6f,0xfa,0x69,0xe9,0xe8,0x6f,0x91,0x35,0x13,0x14,0x92,0xf4,0x70,0xf4,0xfc,
+0xe,0x75,0x83,0xdd,0x48,0x3c,0x8a,0x79,0xf5,0xf3,0x44,0x3,0x7f,0x48,0xed,0xac,
+0x44,0x7a,0xda,0xf9,0xac,0xed,0xe7,0x8e,0xbe,0x86,0x92,0x6,0xb1,0x3c,0x95,0x95,
+0xf4,0x7b,0x65,0x2b,0xee,0x79,0x6c,0xb7,0x81,0x7e,0x87,0x98,0x3f,0x0,0x4e,0xa0,
+0x7a,0x31,0x80,0xbb,0xe8,0xf1,0x28,0xee,0xa8,0xab,0xef,0x3f,0x46,0x31,0x6c,0x69,
+0xf8,0xfa,0x83,0x28,0x5b,0x6,0x70,0x4,0x15,0xb4,0xd1,0xfd,0x16,0x4b,0x6f,0xd3,
+0xe3,0x92,0xe2,0x63,0xc8,0x1c,0x9d,0xa5,0xe9,0xcd,0x1a,0xbf,0x37,0x66,0xc7,0xbd,
+0xdd,0x7c,0x40,0xe9,0xd7,0xfe,0xf7,0x43,0xfb,0x43,0x56,0x49,0x23,0xee,0x1b,0x74,
+0xbc,0x30,0x85,0x1d,0x5b,0x62,0xe4,0xd0,0xfc,0x78,0xbf,0xb4,0x6f,0xd,0x63,0xd7,
+0xbd,0x40,0x70,0xbf,0x48,0xb6,0xc1,0x9d,0x2d,0x58,0x10,0x9c,0xac,0x53,0xdc,0x53,
+0xa5,0xb8,0xaf,0x4c,0xf1,0xf0,0x12,0xc5,0xd9,0x6b,0x4,0x47,0x80,0x57,0x20,0x7c,
+0x1f,0x6c,0x40,0x6,0x77,0x36,0x2c,0xd3,0xb5,0x95,0x70,0xa3,0xad,0xdb,0x5a,0x71,
+0xfc,0xb7,0xfe,0x53,0xcf,0xdd,0xbd,0x13,0xe2,0x9,0x62,0xcf,0x10,0x8f,0xaa,0xaf,
+0xf5,0x7b,0x3,0xe3,0x4a,0x75,0x2d,0xa0,0x0,0x86,0xe1,0x6a,0x4a,0x44,0x3d,0xc3,
+0x9f,0xb,0xb0,0x75,0x4f,0x34,0xcd,0x45,0x11,0xbd,0xdf,0xf7,0xa1,0xfe,0x99,0xc0,
+0x9b,0x4d,0x9,0xce,0x46,0x7f,0x94,0xa,0x99,0x7d,0x8,0xc7,0x59,0x62,0x65,0x8c,
+0x59,0x4a,0x22,0x1e,0x95,0x7f,0x58,0x74,0x14,0xc8,0x96,0xa7,0x94,0xd0,0x6b,0xfa,
+0x75,0x2b,0x7d,0xeb,0xe2,0x5b,0x38,0x2,0xeb,0x23,0x4a,0xa0,0xad,0x92,0x4,0xef,
+0xa3,0x9f,0xea,0xb7,0x6c,0x21,0x20,0xe8,0x6e,0xec,0x0,0x7b,0x68,0x34,0x71,0x83,
+0xbc,0x2d,0x58,0x5e,0x31,0xef,0x4c,0x63,0x41,0x8d,0x69,0xfc,0x48,0x10,0x23,0x9d,
+0x5f,0x4,0xec,0x78,0xef,0x34,0x15,0xce,0x11,0x85,0xf7,0x98,0x98,0x98,0xd9,0xf,
+0x92,0xb5,0x48,0xc9,0x8c,0xc8,0x8e,0xfa,0x83,0xb5,0x8f,0xa2,0x61,0x9e,0x90,0xef,
+0xd7,0x66,0x8d,0x44,0xea,0x78,0xaf,0x2a,0x8d,0xc6,0x94,0x62,0xe8,0xae,0x7f,0xc8,
+0x93,0xb,0xdd,0xcd,0xfb,0x4d,0x2c,0x8a,0x47,0xe4,0x98,0x13,0xa8,0x4,0x8e,0x92,
+0x25,0xe0,0x7d,0x26,0x16,0x82,0xd3,0x7d,0x76,0x14,0x5c,0x0,0xa5,0xec,0x0,0x37,
+0x2e,0x80,0xd3,0x7d,0x76,0xe1,0x5f,0x0,0xa7,0xfb,0xb8,0xbb,0x66,0x67,0xc1,0x4d,
+0x68,0xe0,0x79,0xf7,0x47,0xf8,0xc3,0x14,0x24,0x4d,0x37,0x7f,0xed,0x6c,0x6e,0x16,
+0xab,0x33,0x60,0xee,0xf4,0x78,0x39,0x7,0xba,0x66,0x23,0x25,0x1c,0x2b,0x32,0x30,
+0xfa,0x74,0xd,0xb,0xac,0xc3,0x52,0x9e,0x12,0x14,0x33,0x63,0xe4,0x87,0x79,0xac,
+0xa,0xef,0xe1,0x9d,0x66,0x8e,0xea,0xac,0x59,0xfe,0xce,0xe7,0x88,0x6f,0x4b,0xe9,
+0xab,0x17,0x5d,0xf,0xe5,0x23,0x3b,0x50,0xc9,0xfc,0xe7,0xf8,0x65,0xc3,0xdd,0x1e,
+0x67,0xe3,0xe5,0x49,0xd0,0xbe,0xf7,0x1f,0x22,0xf2,0x96,0xe3,0x95,0x9,0x4e,0x4a,
+0x8a,0xd3,0xc,0x97,0x5e,0x25,0x38,0x51,0xdf,0x43,0xf0,0xde,0xa5,0x5e,0x82,0xb,
+0x73,0x4,0xc7,0xe4,0x8,0xc1,0xa,0x10,0x9c,0xbd,0x42,0xf0,0xbc,0x77,0x92,0xe0,
+0x8a,0x5a,0xec,0x18,0x43,0xf6,0x39,0xc1,0x33,0x14,0xc3,0xde,0xd7,0x5b,0xe,0xf1,
+0x2,0x4e,0x89,0x8,0x9e,0xc1,0x83,0x33,0x22,0x81,0xe3,0x19,0xbb,0x97,0x47,0xb3,
+0x38,0xa2,0xd8,0xf1,0x24,0x4d,0x3e,0xda,0xfa,0x93,0x2f,0xda,0xf9,0x70,0xf7,0xcc,
+0x87,0xdb,0xc1,0x1f,0x46,0x47,0xd8,0xf8,0x8f,0x13,0x8c,0xcb,0xfb,0x28,0xdc,0x85,
+0xa3,0xcd,0x14,0xce,0x2f,0x11,0x7d,0x8e,0x1c,0x56,0x38,0x4f,0x7c,0x61,0xd9,0x65,
+0x49,0x62,0x59,0xb3,0x72,0x99,0x6c,0x3f,0x59,0x39,0x49,0x5a,0xd6,0x64,0x6f,0x28,
+0x8d,0x24,0x45,0x9e,0x47,0x64,0x4a,0x3d,0x3f,0x99,0x7d,0xa4,0x4b,0xd2,0xdf,0xa3,
+0x6b,0x50,0x61,0x7d,0x73,0x78,0xd9,0xe,0xfc,0x4a,0x14,0x5,0x7d,0x13,0x39,0x73,
+0x7a,0x24,0xd,0xa9,0xe9,0xa9,0xbb,0xee,0x2c,0xc6,0x4a,0x17,0xe8,0x5b,0x7,0x86,
+0xb5,0x88,0x31,0xfc,0x8f,0xf1,0x96,0x1b,0x14,0xf,0x5d,0xa7,0x38,0x73,0x8d,0xe2,
+0xfc,0x25,0x82,0xa3,0xb0,0xfe,0xd,0x8e,0x7e,0xf,0x26,0x8f,0xc1,0x7d,0xf2,0xef,
+0x82,0xe0,0xdf,0xf5,0xb,0x7a,0x3f,0x4b,0xcc,0x1e,0xd5,0xaf,0x85,0xbe,0x94,0x59,
+0x9f,0x5a,0x7,0x98,0x6e,0x62,0xd8,0x8c,0x4a,0x6,0x57,0xd5,0x78,0xc5,0x6a,0x4d,
+0xf,0x40,0xf6,0xba,0xe2,0xd7,0x49,0xe3,0x21,0xc8,0x5e,0x2d,0x8d,0x88,0xa1,0xcb,
+0x8,0x67,0x67,0xc4,0xd4,0x34,0xc2,0x83,0xf3,0x11,0x6f,0x1f,0xc2,0x5d,0x37,0xe2,
+0x15,0x81,0x70,0xb4,0xde,0xb3,0x88,0xb1,0x28,0xe6,0xe7,0x8,0xce,0x28,0x6,0x84,
+0x31,0xe4,0x82,0x63,0xc,0xb4,0x66,0x6c,0xe9,0x26,0xfb,0x45,0xf4,0x30,0xe5,0xa7,
+0xdd,0x95,0xcd,0xc3,0xac,0x3d,0x6a,0xb,0xde,0xec,0xe7,0x33,0x6c,0x89,0xdb,0x27,
+0x4f,0x9c,0x23,0xf2,0x26,0xc4,0xc7,0xbf,0x60,0x60,0x17,0xf8,0xb3,0xd0,0xe7,0xcb,
+0x54,0xfb,0xc5,0x7d,0x48,0x42,0x28,0x42,0xfe,0x9f,0x69,0xaa,0xeb,0xf8,0x3d,0xcf,
+0x9a,0x2,0xaf,0xef,0xaf,0x32,0x4d,0xed,0xe2,0x7a,0x6b,0x37,0xfe,0x29,0xbf,0xb0,
+0x97,0xf1,0x77,0xf1,0xe3,0xbe,0x3d,0x2a,0x8d,0xfa,0xab,0x82,0xb0,0x81,0xea,0x1f,
+0x42,0x53,0x2d,0x7,0xf9,0x2f,0x86,0xeb,0x23,0xe2,0x61,0x24,0x3f,0x74,0xc8,0xda,
+0x5b,0x24,0x41,0xe8,0x20,0xf5,0x9f,0xa8,0x15,0xf1,0x65,0xeb,0xcf,0xc2,0xfb,0x5,
+0xb5,0x57,0xb7,0xac,0x57,0xf0,0x5f,0x5c,0xf8,0xff,0xad,0x5f,0xcb,0x1f,0x6e,0xf7,
+0x7e,0x11,0x3d,0xfd,0x32,0x91,0xdf,0xf3,0x38,0x18,0x59,0x64,0xcb,0xb5,0xdc,0x8b,
+0xc4,0x5f,0x38,0x23,0x9c,0x92,0x31,0x0,0x65,0xc1,0xcc,0x87,0xe4,0x75,0x9d,0x2f,
+0x87,0x82,0x55,0xc1,0xdd,0x80,0x1b,0x66,0x68,0xdb,0x11,0xb2,0x4a,0xeb,0xf1,0x89,
+0x9b,0x5,0xdd,0x72,0x7c,0x41,0x33,0x29,0x93,0x8f,0x7,0x8f,0x42,0xd,0x39,0xb4,
+0xfe,0x38,0xb1,0x84,0xde,0xef,0x5d,0xd1,0x81,0xfc,0xdf,0xd9,0x25,0x79,0xb1,0x54,
+0xc7,0xfa,0xc6,0x67,0x89,0x3d,0x5e,0x3d,0xff,0xc8,0x27,0x5,0xd5,0x4f,0xc4,0x2d,
+0xe0,0x27,0x5f,0xf,0xfb,0x8c,0x78,0xc2,0xfd,0x31,0xb6,0x1f,0x3e,0x4a,0xd5,0x8b,
+0xb8,0xac,0xe4,0x4e,0x23,0x75,0x7d,0x18,0x6a,0xbd,0xe,0x18,0x3c,0xcb,0xeb,0x45,
+0xcc,0x10,0xdc,0xc1,0xfc,0xf,0x71,0x16,0x3a,0xc3,0xb,0x41,0xf2,0xe3,0x31,0x96,
+0x49,0xb5,0xaa,0xff,0x62,0x87,0x7c,0x46,0x44,0x8e,0x23,0xf5,0xc9,0x93,0x6e,0x11,
+0x9b,0x1b,0xb6,0xb5,0x94,0xb,0xfa,0xcc,0x21,0xcb,0x16,0x9a,0x1f,0x43,0x6f,0x17,
+0x46,0xdf,0x1c,0x96,0x34,0x5b,0x61,0x97,0xeb,0x16,0x6b,0xae,0xfb,0x26,0x36,0x88,
+0xb1,0x11,0x8,0x3b,0xb6,0x84,0xd7,0xdf,0x21,0xf3,0x57,0x5b,0xf,0x34,0x27,0x4e,
+0xa3,0xf8,0x26,0x58,0xbf,0x85,0xcb,0x66,0x7d,0x4e,0x93,0xf8,0x35,0x1,0xbd,0x96,
+0xf0,0x22,0x1f,0xbe,0x4e,0xd8,0xb9,0xbe,0x21,0xae,0xed,0x7,0x1,0x6f,0x5,0x6c,
+0x4f,0xf5,0xa6,0x23,0xc4,0x5f,0x31,0x75,0x99,0xf2,0x8c,0xa1,0xeb,0xa4,0x5d,0x93,
+0xe8,0xae,0xd2,0x52,0x81,0x1d,0xb2,0x48,0x4b,0xca,0x94,0x98,0xfb,0x23,0xcb,0x58,
+0x10,0xaf,0x1f,0xc1,0x2b,0xf,0x16,0xe8,0xed,0xa2,0xb4,0xc2,0xcd,0xfe,0xa7,0x69,
+0x6a,0x78,0x51,0xd2,0xcb,0x7f,0x7a,0x6e,0xe4,0xb6,0xf,0xe2,0x3,0xcf,0xb1,0x5f,
+0xb4,0x70,0xb,0x78,0xeb,0xaf,0xc7,0xd3,0xb,0xea,0x4f,0xa0,0x20,0x94,0x64,0x35,
+0xb3,0x50,0x94,0x41,0x88,0x5c,0xaf,0xfc,0x55,0xbe,0x54,0x5b,0x3e,0x1d,0x88,0xf0,
+0x59,0xa8,0xf,0xa9,0x98,0x7a,0x50,0xbf,0xb2,0x74,0xc6,0xf7,0x89,0xfa,0x13,0x49,
+0x7d,0xbd,0x71,0xff,0xfe,0x8d,0x98,0xa9,0xe,0xe0,0xff,0x80,0x3b,0xfc,0x8d,0x40,
+0x8f,0x35,0xe0,0xa8,0xbf,0x91,0xe8,0xd3,0x10,0x8e,0x7,0xc7,0x7d,0x47,0x79,0xcb,
+0xf5,0xe,0xec,0x1f,0x80,0x3b,0x1b,0x22,0x45,0x71,0x4e,0x8d,0xa0,0xda,0xdf,0x76,
+0x34,0x44,0xc4,0x89,0x72,0x7f,0x97,0x94,0x93,0x91,0x20,0x63,0x20,0x29,0xff,0x55,
+0x2a,0x94,0x6b,0x17,0x9a,0x93,0x24,0x2f,0x97,0xd2,0xb,0x53,0xc6,0x87,0xe6,0x7c,
+0x3a,0x95,0x5e,0x70,0x9e,0x4a,0x6d,0xd4,0xf7,0x54,0xf4,0xd0,0x6f,0xc2,0xab,0x6d,
+0x6a,0x43,0xd4,0xfe,0xa6,0x83,0x44,0x97,0xa,0xc6,0x45,0x9d,0x20,0xf3,0x62,0x3b,
+0x32,0x18,0x43,0xfc,0x72,0x1,0xff,0xfe,0xe2,0x95,0x4,0x59,0x41,0x7b,0xab,0xe9,
+0x2a,0x5d,0xbf,0xa6,0x78,0x72,0x63,0x40,0x68,0xb8,0x5a,0x9e,0x96,0x87,0x88,0x4b,
+0x52,0x6e,0x46,0xdd,0x6f,0x82,0x58,0x13,0x8b,0x57,0x92,0xf8,0x6,0x5d,0x72,0x4c,
+0x87,0x58,0xe3,0xf7,0x35,0xe5,0x71,0xfc,0xdf,0x83,0x8a,0x58,0xf5,0x68,0x5f,0x67,
+0x61,0x41,0x58,0xba,0x43,0xec,0x51,0xb7,0x1b,0xb3,0x6,0xd6,0xd9,0x96,0x86,0xd6,
+0x7a,0xc3,0x5c,0x27,0x6e,0xdb,0x32,0x37,0xd4,0x4,0xfc,0xc1,0x41,0x5,0xf5,0xbd,
+0x49,0x3f,0xc4,0x6d,0xcd,0x78,0x9a,0xe2,0xd2,0xc,0xc5,0x85,0x79,0x8a,0xd3,0xf5,
+0x5c,0xee,0xb4,0x24,0xec,0x0,0x67,0x73,0xa9,0xfd,0x8b,0x1e,0x17,0x82,0x5e,0xbf,
+0x19,0xd8,0x12,0xe5,0xf,0x7a,0x3e,0xec,0x1c,0x69,0xae,0x2f,0x8,0x89,0xc,0x14,
+0xeb,0xd0,0xe3,0x66,0x72,0xff,0xcd,0xb1,0xa5,0x7b,0x75,0x3e,0xf8,0x13,0x80,0x63,
+0x43,0x7d,0xeb,0xc4,0xc9,0xd7,0xef,0xc2,0xe9,0x0,0xf6,0x7,0xac,0x3f,0xd,0xd1,
+0x64,0x1f,0xb1,0xcb,0x3d,0xcf,0xc4,0xbf,0xe8,0x2d,0x63,0x45,0x7f,0xe8,0xa7,0x58,
+0xbe,0x4b,0xce,0x77,0xf2,0x15,0x7a,0x7d,0xb7,0x31,0x50,0x6a,0x8c,0xc,0x9e,0x1a,
+0xf7,0xd0,0xe3,0xd1,0x42,0xb9,0xcd,0xfd,0xa5,0xac,0xbf,0x69,0x63,0x27,0xdb,0xc9,
+0x93,0xea,0x2b,0x1d,0xa2,0xf6,0xd7,0xde,0xe5,0xcd,0xc2,0xe0,0x1d,0x19,0xa7,0x58,
+0x56,0xe8,0xf9,0x7,0xe5,0x49,0x82,0x23,0xde,0x19,0x7a,0xbf,0xd2,0x1c,0x3d,0x2e,
+0xe9,0xf1,0x63,0x72,0x9c,0xde,0xbf,0x4c,0x9f,0xf7,0xde,0x98,0xc1,0x96,0x6e,0x3a,
+0x1f,0xa8,0x7c,0xbe,0x99,0xd8,0x9f,0xf,0x54,0xfe,0xaf,0xd0,0xf3,0xf,0x62,0x7f,
+0x89,0x3f,0x1f,0xe8,0xfd,0x4a,0x73,0xf4,0xb8,0xa4,0xc7,0x8f,0xe1,0xf8,0x2e,0x9b,
+0x9f,0xb5,0x2e,0xba,0xff,0xf4,0xd9,0xc7,0xa9,0xb5,0x80,0xa4,0xf3,0x26,0xaa,0xb9,
+0xe7,0x3d,0xb4,0x96,0xa2,0x29,0x48,0x79,0x19,0x27,0xb7,0x88,0x78,0x73,0x6c,0xcc,
+0x99,0x7a,0x8f,0xdb,0xf5,0xb5,0x84,0x5f,0xb1,0xf1,0x2,0x1a,0x64,0x8b,0x37,0xcd,
+0xea,0x87,0xd2,0x76,0x7f,0x2,0xd7,0xc7,0xed,0x78,0x46,0x88,0x2f,0x20,0x83,0x64,
+0x42,0xbe,0x7f,0x1,0x5b,0x10,0xa3,0x45,0xd2,0x1c,0x22,0xf4,0xe5,0x1f,0x36,0x5e,
+0x80,0x0,0x53,0x14,0x4a,0xc9,0xc9,0x28,0xfd,0xf0,0x61,0x35,0x44,0x7f,0x31,0x38,
+0xea,0x55,0x72,0xb3,0x41,0xcc,0xba,0xc2,0xbd,0x6a,0x87,0xee,0x8,0x62,0xda,0x15,
+0xd6,0x9d,0x35,0xa7,0xae,0x37,0x71,0x1,0x96,0xf0,0x60,0x63,0xcd,0x67,0x16,0x47,
+0xb5,0xb,0x2a,0x70,0x79,0x66,0x1a,0xe5,0x20,0x92,0x72,0x5,0x3c,0x2f,0x3c,0x86,
+0xc1,0x4,0x29,0x7a,0x6b,0x4d,0xac,0xa7,0x43,0x50,0xc5,0x4a,0x61,0xdd,0x82,0x33,
+0x30,0x31,0x29,0x9c,0x94,0x2f,0x88,0x6d,0xcd,0x7a,0xbb,0xf3,0x22,0x52,0x94,0x6e,
+0xb3,0x66,0x2a,0xfc,0xbe,0x6d,0x34,0xc4,0x3,0x3a,0x60,0xd8,0x98,0xfb,0x26,0xed,
+0xa7,0x19,0xbd,0xdf,0xa0,0xe5,0x22,0x93,0xb2,0xe2,0xba,0x8,0xf,0x57,0xfb,0x15,
+0x7f,0x36,0x18,0xd2,0x5c,0x8,0xbe,0x46,0x71,0xba,0x4c,0x71,0x8f,0xfc,0x6b,0x2e,
+0x87,0x70,0x24,0x4f,0x9f,0x27,0x1c,0xef,0x8f,0xf8,0xb8,0xe8,0x92,0x29,0x7c,0x3d,
+0xb8,0x1b,0x30,0x86,0xbd,0x4,0x63,0x8,0xbe,0x25,0xef,0xb3,0x48,0x9e,0xaf,0xf3,
+0x73,0x22,0x21,0x2a,0x3f,0x89,0x4a,0x8d,0x36,0x98,0xe3,0x9f,0x29,0xe6,0xb1,0x1c,
+0x91,0x22,0xfb,0x71,0x7b,0x18,0xb7,0x8e,0xae,0x92,0x6b,0x68,0xf3,0xf5,0x42,0x95,
+0xaf,0x17,0x3b,0x4c,0x65,0xbe,0x2d,0x15,0x6d,0xf3,0x5b,0x11,0x77,0x7e,0xcb,0xaf,
+0x61,0xbb,0x66,0xb2,0xf3,0x21,0x4c,0xf3,0x21,0xc6,0x82,0x35,0x78,0xa8,0xf8,0x2d,
+0xe2,0x81,0xc7,0xca,0x6a,0xbb,0x30,0xf3,0x2d,0xa3,0x87,0xe7,0x3f,0x4d,0xfc,0x89,
+0xd9,0x9a,0xeb,0xba,0x67,0xd6,0x75,0xff,0xa3,0xb9,0x11,0x8c,0x77,0xab,0xef,0x6f,
+0xe6,0x53,0x5f,0xb9,0xf4,0xa7,0x9f,0xa1,0x84,0x3a,0x1d,0x10,0x8f,0x9a,0x9e,0xf4,
+0xc1,0x4,0x1a,0x34,0x2,0x66,0x1f,0xc8,0xd,0x3d,0x35,0x74,0xbd,0xf0,0x73,0xc4,
+0xf1,0xf3,0x5b,0x70,0x8d,0x62,0x94,0x7f,0xa3,0xf1,0x10,0x2b,0x97,0x96,0xe7,0x4d,
+0x5f,0xa8,0xd2,0xf5,0x18,0x4d,0x28,0x7c,0x80,0x39,0xd4,0xb,0xb4,0x9d,0xae,0xf8,
+0xea,0x46,0x4f,0xaf,0x3,0xcf,0xb1,0x35,0x31,0xdd,0x76,0xc7,0xc8,0xbe,0x43,0x7f,
+0x4d,0x8d,0xa,0xcc,0xc9,0xb6,0xde,0x57,0x5b,0xff,0xc1,0x12,0xdf,0x2f,0xda,0xc7,
+0xcb,0x95,0x73,0xdf,0x25,0xf1,0x72,0xea,0xe4,0x9d,0x6,0xaf,0x12,0x2f,0x17,0x6b,
+0x89,0x97,0xa3,0xee,0xab,0x4,0xc3,0xeb,0x8f,0x97,0x63,0x4b,0x7d,0xd5,0x78,0xb9,
+0x7,0x5b,0xe2,0xe5,0x8e,0xdb,0x78,0x39,0xcc,0x8c,0x5e,0x39,0x8b,0xba,0x71,0x41,
+0x7b,0x42,0xd2,0x51,0x66,0xb6,0x9a,0xcb,0x15,0xc7,0x91,0xae,0xaf,0xc6,0xc7,0xd9,
+0x87,0xec,0x15,0x94,0x39,0x76,0xb0,0xf1,0x8c,0xc8,0x7f,0x50,0x81,0x60,0x42,0xd6,
+0x49,0x35,0xd0,0x58,0x81,0xe7,0x77,0x7f,0x6c,0x96,0xf1,0x63,0xa7,0xc4,0xd6,0xf4,
+0xc4,0xca,0xf9,0xdd,0x89,0x5f,0xc2,0x14,0x98,0x43,0xf3,0xad,0xea,0x96,0xd0,0x3b,
+0xe9,0xea,0x5b,0x84,0x61,0xee,0xff,0x4a,0xa8,0x74,0xcd,0x1,0xf6,0xb6,0x99,0xf9,
+0xf5,0xe1,0xcd,0xbe,0x7f,0xd8,0x71,0xc8,0x68,0x34,0x15,0x1d,0xc5,0x58,0x4e,0xd3,
+0xc2,0xcb,0x1c,0xe7,0xc6,0x82,0xc2,0xd6,0x76,0x3e,0xdc,0x8d,0xf3,0xc1,0xf2,0x87,
+0xdb,0x8c,0x27,0xd8,0xde,0x54,0xb8,0x44,0xe0,0xc7,0xd9,0x5e,0x26,0x99,0xf0,0xee,
+0x9e,0x12,0x21,0xa7,0x28,0x53,0x30,0x7a,0x58,0xa7,0x10,0xc8,0xef,0x2e,0x61,0x5c,
+0xf1,0x73,0xae,0xd7,0x8a,0x41,0xd7,0xc3,0x18,0x14,0x46,0xa5,0xd5,0xd6,0x83,0x36,
+0x77,0x90,0xdf,0xad,0xb5,0xdc,0x49,0x1f,0x43,0x7e,0xb7,0x3a,0xbf,0x23,0x78,0x66,
+0x66,0xc1,0xbf,0x3e,0x48,0xea,0x87,0x80,0x6e,0xc0,0xd,0x27,0x87,0xce,0xef,0x6,
+0xac,0xad,0xe6,0x8d,0xfc,0x6e,0x85,0xb7,0x7a,0xd7,0x9a,0xea,0xac,0x7f,0x7f,0x2d,
+0x98,0xfa,0xf9,0xdd,0xa,0x57,0x7f,0x60,0x45,0xc7,0x9b,0xea,0x9b,0x23,0x82,0x38,
+0x39,0xb5,0x3e,0x86,0x94,0xb2,0xd,0xc7,0x41,0x81,0xb7,0x5f,0x50,0x1c,0x8,0xb1,
+0xc1,0xf9,0x71,0x6f,0x9e,0x5e,0xdf,0xa8,0xa,0xd1,0xc4,0xc3,0x4b,0x6d,0x8f,0xdf,
+0xef,0x5d,0x45,0xd8,0x74,0xb0,0xe,0x70,0xf5,0xfb,0xe1,0x1c,0xaf,0x50,0xda,0xa3,
+0xc6,0x56,0xb3,0x47,0xbd,0xcd,0xec,0x51,0x8b,0xed,0xed,0x51,0xdd,0x55,0x66,0x8f,
+0xaa,0xb5,0xb7,0x3f,0xad,0x3,0x87,0x81,0x3e,0x7f,0xb2,0xad,0xe,0xb7,0x97,0x99,
+0x68,0x8b,0x93,0x4,0x76,0x32,0xef,0xf1,0xae,0x97,0x56,0xe5,0xf,0xb6,0x3e,0xcc,
+0x1d,0x4b,0x2d,0xfe,0xac,0x29,0x9a,0xbd,0x20,0x92,0x2d,0xfe,0x2c,0x3a,0x1d,0xc4,
+0x76,0xe6,0xcf,0x72,0xce,0xad,0x3a,0x1f,0x6c,0xfd,0xa8,0xf0,0x90,0x1a,0xaa,0x18,
+0x96,0x61,0xff,0xa6,0x98,0x3a,0x5e,0x80,0xf9,0x37,0x8e,0x78,0xf8,0xf8,0x76,0xc9,
+0xfa,0xa1,0x9e,0x38,0xbb,0x6f,0xb5,0xed,0xc8,0xe6,0xeb,0x61,0x8d,0x22,0x74,0xf9,
+0x7a,0x1b,0x2e,0x4f,0xde,0xf5,0xf9,0x38,0x2b,0x63,0x98,0x40,0x54,0x65,0x5c,0x15,
+0xbf,0x92,0xb2,0x6a,0xc8,0x46,0x51,0xc2,0x5,0x32,0xfc,0xad,0x8b,0xf5,0xca,0xd5,
+0xd5,0xb4,0x47,0xed,0x7,0xbf,0xb7,0xe6,0x43,0x83,0x4e,0x6,0xf3,0xc1,0xb4,0x50,
+0xf6,0xe7,0x43,0x83,0xec,0xb4,0x58,0x3,0x1d,0xd8,0xd7,0x96,0x9b,0x75,0x30,0x55,
+0x8a,0x8b,0x4e,0x13,0x6c,0xb7,0xcc,0x2f,0xb4,0xc7,0x3b,0x6d,0x64,0xe1,0x9d,0x6d,
+0x4e,0x64,0xfa,0x47,0x82,0x39,0x84,0x13,0xcc,0xc1,0x9c,0x64,0x9d,0xec,0xfb,0x58,
+0xac,0xf2,0xf0,0x65,0x36,0x5f,0x4e,0xda,0x6f,0x6c,0x29,0xbc,0x14,0x63,0xeb,0xa3,
+0x93,0xad,0x7,0x8e,0x93,0xcc,0x41,0xdf,0x77,0x63,0x95,0xf5,0xc1,0xb4,0xf9,0x9d,
+0x77,0x58,0x6c,0xdd,0x51,0x56,0xb,0x64,0x6a,0xb1,0x3d,0x1e,0x62,0xbf,0xb7,0x8b,
+0x69,0x5b,0xe,0xfb,0x3e,0x22,0x6f,0x93,0x55,0xc2,0x26,0x3f,0x1c,0xa7,0xf2,0x43,
+0xac,0x42,0xe5,0x87,0xee,0x25,0x2a,0x3f,0x90,0xf2,0x25,0x4a,0x7e,0x28,0x5e,0xa2,
+0xf2,0x82,0x9c,0x6b,0x83,0x95,0xfc,0x30,0x6a,0xeb,0x33,0xde,0xd1,0xfc,0x31,0xf1,
+0x6d,0xca,0xf,0x7b,0x65,0x1b,0x9c,0x94,0xa9,0x41,0x3c,0x5f,0x7a,0x97,0x69,0xfb,
+0x88,0xa1,0x79,0x31,0x35,0x43,0xf9,0x63,0x71,0x1f,0xe5,0x8f,0x87,0xed,0x57,0xb7,
+0x74,0xf7,0xae,0x8f,0xfe,0xc1,0x32,0x95,0x1f,0xb0,0x37,0x1e,0xe4,0x87,0x96,0xf5,
+0x91,0xba,0xa7,0xd7,0xc7,0x56,0xda,0x31,0x3e,0xee,0x49,0x12,0xbf,0x3d,0xcc,0xac,
+0x7b,0xd0,0x50,0x7,0x33,0x94,0x22,0xab,0x18,0xc0,0x8f,0x67,0x48,0xb7,0x36,0xdd,
+0xe1,0xec,0x3,0x2a,0x21,0xbd,0x6c,0x93,0xf1,0x2d,0xfd,0xaf,0x14,0xcf,0xa9,0xd9,
+0x73,0xe0,0x9b,0x42,0x44,0x72,0x5a,0x91,0xe8,0x81,0xca,0x10,0x50,0x24,0xb7,0x51,
+0xd4,0x7a,0x35,0x1c,0x7e,0x72,0xbe,0xee,0xfe,0x90,0x68,0x14,0x34,0xa1,0xaa,0x5b,
+0xfe,0x33,0xf7,0x22,0x8a,0xa9,0x9c,0xaa,0xf4,0x8b,0xc8,0x6b,0x48,0x9f,0x0,0xdf,
+0x6f,0x27,0x5a,0x9e,0x54,0x9f,0xe8,0xa5,0xbd,0x98,0x7,0xd2,0x55,0xd2,0x1e,0x43,
+0x67,0x5b,0xa2,0xf0,0xa9,0xaf,0x15,0x2a,0xb9,0x5c,0xe,0xa9,0x74,0x19,0x66,0xef,
+0x62,0xf8,0xc9,0x52,0x8d,0xa4,0x73,0x0,0x37,0x91,0x58,0xbe,0xdd,0xc2,0xf4,0x9f,
+0x6e,0xa6,0xff,0xf8,0xb5,0xe2,0x22,0x48,0x9e,0x86,0x97,0xd9,0x6d,0x70,0xba,0x3e,
+0x2e,0xe2,0xff,0x46,0x2,0xb6,0x94,0x2e,0xe1,0x68,0x2d,0xd,0x7a,0x7,0x9e,0xb2,
+0x2,0xb3,0x25,0x4b,0x96,0x2c,0x59,0xb2,0x64,0xc9,0x92,0x25,0x4b,0x96,0x2c,0x59,
+0xb2,0x64,0xc9,0x92,0x25,0x4b,0x96,0x2c,0x59,0xb2,0x64,0xc9,0x92,0x25,0x4b,0x96,
+0x2c,0x59,0xb2,0xd4,0x8e,0xfe,0xb,0x93,0x3,0xff,0xd1,
+};
+
+static const Font_Range Font_sansRanges[12] = {
+    //First  Count  Glyph
+    { 0x0020,   95,     0 },
+    { 0x00A0,  224,    95 },
+    { 0x0386,    5,   319 },
+    { 0x038C,    1,   324 },
+    { 0x038E,   20,   325 },
+    { 0x03A3,   44,   345 },
+    { 0x0400,   96,   389 },
+    { 0x2013,    2,   485 },
+    { 0x2018,    7,   487 },
+    { 0x2022,    1,   494 },
+    { 0x2026,    1,   495 },
+    { 0x20AC,    1,   496 },
+};
+
+static const uint8_t Font_sansAdvances[497] = {
+0x9,0xb,0xd,0x17,0x12,0x1b,0x16,0x8,0xb,0xb,0xe,0x17,0x9,0xa,0x9,0x9,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x9,0x9,0x17,0x17,0x17,0xf,
+0x1c,0x13,0x13,0x14,0x16,0x12,0x10,0x16,0x15,0x8,0x8,0x12,0x10,0x18,0x15,0x16,
+0x11,0x16,0x13,0x12,0x11,0x14,0x13,0x1c,0x13,0x11,0x13,0xb,0x9,0xb,0x17,0xe,
+0xe,0x11,0x12,0xf,0x12,0x11,0xa,0x12,0x12,0x8,0x8,0x10,0x8,0x1b,0x12,0x11,
+0x12,0x12,0xc,0xf,0xb,0x12,0x11,0x17,0x11,0x11,0xf,0x12,0x9,0x12,0x17,0x9,
+0xb,0x12,0x12,0x12,0x12,0x9,0xe,0xe,0x1c,0xd,0x11,0x17,0xa,0x1c,0xe,0xe,
+0x17,0xb,0xb,0xe,0x12,0x12,0x9,0xe,0xb,0xd,0x11,0x1b,0x1b,0x1b,0xf,0x13,
+0x13,0x13,0x13,0x13,0x13,0x1b,0x14,0x12,0x12,0x12,0x12,0x8,0x8,0x8,0x8,0x16,
+0x15,0x16,0x16,0x16,0x16,0x16,0x17,0x16,0x14,0x14,0x14,0x14,0x11,0x11,0x12,0x11,
+0x11,0x11,0x11,0x11,0x11,0x1b,0xf,0x11,0x11,0x11,0x11,0x8,0x8,0x8,0x8,0x11,
+0x12,0x11,0x11,0x11,0x11,0x11,0x17,0x11,0x12,0x12,0x12,0x12,0x11,0x12,0x11,0x13,
+0x11,0x13,0x11,0x13,0x11,0x14,0xf,0x14,0xf,0x14,0xf,0x14,0xf,0x16,0x12,0x16,
+0x12,0x12,0x11,0x12,0x11,0x12,0x11,0x12,0x11,0x12,0x11,0x16,0x12,0x16,0x12,0x16,
+0x12,0x16,0x12,0x15,0x12,0x1a,0x13,0x8,0x8,0x8,0x8,0x8,0x8,0x8,0x8,0x8,
+0x8,0x11,0x10,0x8,0x8,0x12,0x10,0x10,0x10,0x8,0x10,0x8,0x10,0xa,0x10,0xa,
+0x10,0x8,0x15,0x12,0x15,0x12,0x15,0x12,0x17,0x15,0x12,0x16,0x11,0x16,0x11,0x16,
+0x11,0x1e,0x1d,0x13,0xc,0x13,0xc,0x13,0xc,0x12,0xf,0x12,0xf,0x12,0xf,0x12,
+0xf,0x11,0xb,0x11,0xb,0x11,0xb,0x14,0x12,0x14,0x12,0x14,0x12,0x14,0x12,0x14,
+0x12,0x14,0x12,0x1c,0x17,0x11,0x11,0x11,0x13,0xf,0x13,0xf,0x13,0xf,0xa,0x13,
+0x9,0x15,0x18,0xb,0x17,0x17,0x17,0x9,0x13,0x13,0x10,0x13,0x12,0x13,0x15,0x16,
+0x8,0x12,0x13,0x18,0x15,0x12,0x16,0x15,0x11,0x12,0x11,0x11,0x16,0x13,0x16,0x15,
+0x8,0x11,0x12,0xf,0x12,0x9,0x10,0x12,0x12,0x11,0x11,0xf,0xf,0x12,0x11,0x9,
+0x11,0x11,0x12,0x10,0x10,0x11,0x11,0x12,0x10,0x12,0x11,0x10,0x12,0x10,0x12,0x17,
+0x9,0x10,0x11,0x10,0x17,0x12,0x12,0x16,0x11,0x14,0x12,0x8,0x8,0x8,0x1f,0x1d,
+0x16,0x14,0x15,0x11,0x15,0x13,0x13,0x13,0x11,0x16,0x12,0x1e,0x12,0x15,0x15,0x14,
+0x15,0x18,0x15,0x16,0x15,0x11,0x14,0x11,0x11,0x18,0x13,0x16,0x13,0x1e,0x1f,0x17,
+0x19,0x13,0x14,0x1e,0x13,0x11,0x11,0x11,0xf,0x13,0x11,0x19,0xf,0x12,0x12,0x11,
+0x12,0x15,0x12,0x11,0x12,0x12,0xf,0x10,0x11,0x18,0x11,0x13,0x11,0x1a,0x1a,0x14,
+0x16,0x11,0xf,0x18,0x11,0x11,0x11,0x12,0xf,0xf,0xf,0x8,0x8,0x8,0x19,0x19,
+0x12,0x11,0x12,0x11,0x12,0xe,0x1c,0x9,0x9,0x9,0x9,0xf,0xf,0xf,0x11,0x1c,
+0x12,
+};
+
+const Font_Data Font_sans = {
+    .Blob = Font_sansBlob,
+    .BlobSize = sizeof(Font_sansBlob),
+    .RamSize = 270928,
+    .Version = 0xD3BCAFAD, //CRC-32 of the blob
+    .Ranges = Font_sansRanges,
+    .nRanges = 12,
+    .Advances = Font_sansAdvances,
+    .nGlyphs = 497,
+    .Fallback = 31,
+    .nPages = 4,
+    .CellSize = 528,
+    .Height = 33,
+    .Baseline = 26,
+};
@@ -50,6 +50,8 @@
 #include <ti/devices/msp432p4xx/driverlib/aes256.h>
 
 #include <ti/sysbios/hal/Hwi.h>
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/knl/Semaphore.h>
 
 #include <ti/drivers/apps/Button.h>
 
@@ -67,30 +69,45 @@
 
 #include "rtc.h"
 #include "SMO.h"
+#include "smo_app.h"
+#include "smo_wire.h"
 #include "peripherals.h"
+#include "journal.h"
+#include "button.h"
+#include "touch.h"
+#include "alert.h"
+#include "timer_wheel.h"
+#include "power.h"
+#include "recorder.h"
+#include "load.h"
+#include "profile.h"
+#include "lock.h"
 
 //*****************************************************************************
 //                      LOCAL FUNCTION PROTOTYPES
 //*****************************************************************************
 
 /* General application functions */
-void TimerPeriodicIntHandler(sigval val);
+void TimerPeriodicIntHandler(void *Arg);
 void LedTimerConfigNStart();
 void LedTimerDeinitStop();
 
 void RTC_C_IRQHandler(uintptr_t Arg);
-void PORT6_IRQHandler(void);
 
 static void *udpServerThreadProc(void *pArg);
 extern void *peripheralThreadProc(void *pArg);
 
-static void SMO_okayButtonHandler(Button_Handle handle, Button_EventMask events);
-static void SMO_setButtonIRQ(void);
+static void SMO_housekeepingTick(void *Arg);
+static void SMO_printLoad(void);
+#ifdef SMO_LOCK_CHECK
+static void SMO_printLocks(void);
+#endif
 
-static int SMO_scheduleNextEvent(SMO_Control *Ctrl, uint8_t Hour, uint8_t Min);
-static int SMO_handleEvent(SMO_Control *Ctrl);
-static void SMO_stopEvent(void);
-static void SMO_handleTimeout(void);
+static int SMO_sendJournal(int32_t Sd, SlSockAddrIn_t *ClientAddr, SlSocklen_t ClientSize, const uint8_t *Req);
+static int SMO_sendRecording(int32_t Sd, SlSockAddrIn_t *ClientAddr, SlSocklen_t ClientSize, const uint8_t *Req);
+static int SMO_sendLoad(int32_t Sd, SlSockAddrIn_t *ClientAddr, SlSocklen_t ClientSize);
+static int SMO_sendProfile(int32_t Sd, SlSockAddrIn_t *ClientAddr, SlSocklen_t ClientSize, const uint8_t *Req);
+static int SMO_sendEncrypted(int32_t Sd, SlSockAddrIn_t *ClientAddr, SlSocklen_t ClientSize, uint8_t *Pkt, int Len);
 
 /****************************************************************************************************************
                    GLOBAL VARIABLES
@@ -115,20 +132,19 @@ const uint8_t SNTPserver[30] = "time-c.nist.gov";
 //RTC calendar
 static volatile RTC_C_Calendar newTime;
 
+//wakes the main loop for periodic housekeeping
+static TimerWheel_Timer HousekeepingTimer;
+static Semaphore_Handle HousekeepingSem;
+
 //booleans to notify threads to stop
 volatile bool udpThreadStop;
 volatile bool peripheralThreadStop;
 volatile bool speakerStop;
 
-//controller for smart medication organizer
-static SMO_Control SMO_Ctrl;
-static pthread_mutex_t SMO_Mutex;
-
 //handle for okay button (msp button)
 static Button_Handle okayButtonHandle;
 
 //handle for button hwi (external button)
-static Hwi_Handle ButtonHwi;
 
 static const uint8_t AesKey256[32] = {
     0xB3, 0x85, 0xBB, 0x33, 0x0C, 0x98, 0xAA, 0x5D,
@@ -139,6 +155,14 @@ static const uint8_t AesKey256[32] = {
 
 //buffer to hold decrypted SMO_Packet
 static uint8_t DataAESdecrypted[16][AES256_BLOCKSIZE];
+_Static_assert(SMO_WIRE_SCHEDULE_SIZE(SMO_PACKET_MAX_MEDS) <= sizeof(DataAESdecrypted), "schedule packet is read in place");
+
+//buffer to build an encrypted journal, recording export, load or profile response, word aligned for the records
+static uint32_t JournalPkt[(SMO_JOURNAL_EXPORT_HEADER_SIZE
+                            + SMO_JOURNAL_EXPORT_MAX_RECORDS*sizeof(SMO_JournalRecord)) / sizeof(uint32_t)];
+_Static_assert(SMO_WIRE_RRSP_RECORDS + RECORDER_EXPORT_MAX_BYTES <= sizeof(JournalPkt), "recording export buffer");
+_Static_assert(SMO_WIRE_LRSP_TASKS + LOAD_MAX_TASKS*SMO_WIRE_LTASK_SIZE <= sizeof(JournalPkt), "load response buffer");
+_Static_assert(SMO_WIRE_PRSP_TASKS + LOAD_MAX_TASKS*SMO_WIRE_PTASK_SIZE <= sizeof(JournalPkt), "profile response buffer");
 
 extern bool speakerOn;
 
@@ -195,7 +219,7 @@ void printBorder(char ch, int n)
 // Periodic Timer Interrupt Handler
 //
 //*****************************************************************************
-void TimerPeriodicIntHandler(sigval val)
+void TimerPeriodicIntHandler(void *Arg)
 {
     /* Increment our interrupt counter.                                       */
     App_CB.timerInts++;
@@ -220,21 +244,9 @@ void TimerPeriodicIntHandler(sigval val)
 //*****************************************************************************
 void LedTimerConfigNStart()
 {
-    struct itimerspec value;
-    sigevent sev;
-
-    /* Create Timer                                                           */
-    sev.sigev_notify = SIGEV_SIGNAL;
-    sev.sigev_notify_function = &TimerPeriodicIntHandler;
-    timer_create(2, &sev, &App_CB.timer);
-
-    /* start timer                                                            */
-    value.it_interval.tv_sec = 0;
-    value.it_interval.tv_nsec = TIMER_EXPIRATION_VALUE;
-    value.it_value.tv_sec = 0;
-    value.it_value.tv_nsec = TIMER_EXPIRATION_VALUE;
-
-    timer_settime(App_CB.timer, 0, &value, NULL);
+    /* start periodic timer on the timer wheel                                */
+    TimerWheel_start(&App_CB.timer, TIMER_EXPIRATION_VALUE, TIMER_EXPIRATION_VALUE,
+                     TimerPeriodicIntHandler, NULL);
 }
 
 //*****************************************************************************
@@ -245,7 +257,7 @@ void LedTimerConfigNStart()
 void LedTimerDeinitStop()
 {
     /* Disable the LED blinking Timer as Device is connected to AP.           */
-    timer_delete(App_CB.timer);
+    TimerWheel_stop(&App_CB.timer);
 }
 
 //*****************************************************************************
@@ -481,6 +493,7 @@ static int32_t getSNTPTime(int16_t gmt_hr, int16_t gmt_min)
         App_CB.timeElapsedSec  += dataBuf[42];
         App_CB.timeElapsedSec  <<= 8;
         App_CB.timeElapsedSec  += dataBuf[43];
+        Recorder_log(RECORDER_SNTP, &App_CB.timeElapsedSec, sizeof(App_CB.timeElapsedSec));
     }
 
     return 0;
@@ -598,44 +611,57 @@ static void *udpServerThreadProc(void* pArg)
             AES256_decryptData(AES256_BASE, DataBuf[i], DataAESdecrypted[i]);
         }
 
-        //check packet type
-        if (DataAESdecrypted[0][0] != SMO_PACKET_TYPE_HEADER)
+        //fields are read in place at their smo_wire.h offsets
+        const uint8_t *Pkt = DataAESdecrypted[0];
+        int Len = nBlocks*AES256_BLOCKSIZE;
+        Recorder_log(RECORDER_PACKET, Pkt, Len);
+
+        //app is requesting adherence history
+        if (Pkt[SMO_WIRE_TYPE] == SMO_PACKET_TYPE_JOURNAL && Len >= SMO_WIRE_JREQ_SIZE)
         {
-            UART_PRINT("Invalid packet type recieved\r\n");
+            Res = SMO_sendJournal(sd, &ClientAddr, ClientSize, Pkt);
+            if (Res < 0)
+            {
+                UART_PRINT("Error sending journal\r\n");
+            }
             continue;
         }
 
-        uint8_t nMeds = DataAESdecrypted[0][1];
-        if (nMeds == 0 || nMeds > SMO_PACKET_MAX_MEDS)
+        //app is fetching the input recording
+        if (Pkt[SMO_WIRE_TYPE] == SMO_PACKET_TYPE_RECORDING && Len >= SMO_WIRE_RREQ_SIZE)
         {
-            UART_PRINT("Invalid number of meds recieved\r\n");
+            Res = SMO_sendRecording(sd, &ClientAddr, ClientSize, Pkt);
+            if (Res < 0)
+            {
+                UART_PRINT("Error sending recording\r\n");
+            }
             continue;
         }
 
-        //copy received data into packet
-        SMO_Packet Pkt;
-        memcpy(&Pkt, DataAESdecrypted, SMO_PACKET_HEADER_SIZE + nMeds*sizeof(SMO_PacketMed));
-
-        newTime = MAP_RTC_C_getCalendarTime();
-
-        //configure SMO from user data
-        pthread_mutex_lock(&SMO_Mutex);
-        Res = SMO_Control_configure(&SMO_Ctrl, &Pkt);
-        pthread_mutex_unlock(&SMO_Mutex);
-        if (Res < 0)
+        //app is reading CPU load and stack use
+        if (Pkt[SMO_WIRE_TYPE] == SMO_PACKET_TYPE_LOAD && Len >= SMO_WIRE_LREQ_SIZE)
         {
-            UART_PRINT("Error configuring SMO\r\n");
+            Res = SMO_sendLoad(sd, &ClientAddr, ClientSize);
+            if (Res < 0)
+            {
+                UART_PRINT("Error sending load\r\n");
+            }
             continue;
         }
 
-        //schedule next event
-        pthread_mutex_lock(&SMO_Mutex);
-        Res = SMO_scheduleNextEvent(&SMO_Ctrl, newTime.hours, newTime.minutes);
-        pthread_mutex_unlock(&SMO_Mutex);
-        if (Res < 0)
+        //app is starting, stopping or reading the profiler
+        if (Pkt[SMO_WIRE_TYPE] == SMO_PACKET_TYPE_PROFILE && Len >= SMO_WIRE_PREQ_SIZE)
         {
-            UART_PRINT("Error scheduling event\r\n");
+            Res = SMO_sendProfile(sd, &ClientAddr, ClientSize, Pkt);
+            if (Res < 0)
+            {
+                UART_PRINT("Error sending profile\r\n");
+            }
+            continue;
         }
+
+        //schedule or tones, errors are reported by the handler
+        SMO_App_handlePacket(Pkt, Len);
     }
 
     retVal = sl_Close(sd);
@@ -687,17 +713,24 @@ void mainThread(void *args)
     RTC_init();
 
     /* Initalize the SMO data structure */
-    SMO_Control_init(&SMO_Ctrl);
+    SMO_App_init();
 
     /* Configure the UART */
     tUartHndl = InitTerm();
     /* remove uart receive from LPDS dependency */
     UART_control(tUartHndl, UART_CMD_RXDISABLE, NULL);
 
-    pthread_mutexattr_t Attr;
-    pthread_mutexattr_init(&Attr);
-    pthread_mutexattr_settype(&Attr, PTHREAD_MUTEX_RECURSIVE);
-    pthread_mutex_init(&SMO_Mutex, &Attr);
+    /* Recover the adherence journal from flash */
+    SMO_Journal_init();
+
+    /* Start the timer wheel that all software timers run on */
+    TimerWheel_init();
+
+    /* Count CPU time per task from here on */
+    Load_init();
+
+    /* Set up the profiler, it stays off until the app starts it */
+    Profile_init();
 
     /* Create the sl_Task */
     pthread_attr_init(&pAttrs_spawn);
@@ -705,6 +738,7 @@ void mainThread(void *args)
     retc |= pthread_attr_setschedparam(&pAttrs_spawn, &priParam);
     retc |= pthread_attr_setstacksize(&pAttrs_spawn, TASK_STACK_SIZE);
     retc |= pthread_attr_setdetachstate(&pAttrs_spawn, PTHREAD_CREATE_DETACHED);
+    Load_nameNext("sl");
     retc |= pthread_create(&spawn_thread, &pAttrs_spawn, sl_Task, NULL);
     if (retc != 0)
     {
@@ -730,17 +764,58 @@ void mainThread(void *args)
         while (1);
     }
 
-    /*
-    Button_Params_init(&buttonParams);
-    okayButtonHandle = Button_open(CONFIG_BUTTON_0, SMO_okayButtonHandler, &buttonParams);
-    if (okayButtonHandle == NULL)
+    /* Start the alert state machine for medication events */
+    SMO_Alert_init(SMO_App_beginAlert, SMO_App_endAlert);
+    pthread_t alertThread;
+    pthread_attr_t alertThreadAttr;
+    pthread_attr_init(&alertThreadAttr);
+    priParam.sched_priority = ALERT_TASK_PRIORITY;
+    retc |= pthread_attr_setschedparam(&alertThreadAttr, &priParam);
+    retc |= pthread_attr_setstacksize(&alertThreadAttr, TASK_STACK_SIZE);
+    retc |= pthread_attr_setdetachstate(&alertThreadAttr, PTHREAD_CREATE_DETACHED);
+    Load_nameNext("alert");
+    retc |= pthread_create(&alertThread, &alertThreadAttr, alertThreadProc, NULL);
+    if (retc < 0)
+    {
+        UART_PRINT("Alert thread create failed\r\n");
+        while (1);
+    }
+
+    /* Set external button interrupt and start decoding gestures */
+    Button_init(SMO_App_handleGesture);
+    pthread_t buttonThread;
+    pthread_attr_t buttonThreadAttr;
+    pthread_attr_init(&buttonThreadAttr);
+    priParam.sched_priority = BUTTON_TASK_PRIORITY;
+    retc |= pthread_attr_setschedparam(&buttonThreadAttr, &priParam);
+    retc |= pthread_attr_setstacksize(&buttonThreadAttr, TASK_STACK_SIZE);
+    retc |= pthread_attr_setdetachstate(&buttonThreadAttr, PTHREAD_CREATE_DETACHED);
+    Load_nameNext("button");
+    retc |= pthread_create(&buttonThread, &buttonThreadAttr, buttonThreadProc, NULL);
+    if (retc < 0)
+    {
+        UART_PRINT("Button thread create failed\r\n");
+        while (1);
+    }
+
+    /* Stream UART profile samples when the CPU has nothing else to do */
+    pthread_t profileThread;
+    pthread_attr_t profileThreadAttr;
+    pthread_attr_init(&profileThreadAttr);
+    priParam.sched_priority = PROFILE_TASK_PRIORITY;
+    retc |= pthread_attr_setschedparam(&profileThreadAttr, &priParam);
+    retc |= pthread_attr_setstacksize(&profileThreadAttr, TASK_STACK_SIZE);
+    retc |= pthread_attr_setdetachstate(&profileThreadAttr, PTHREAD_CREATE_DETACHED);
+    Load_nameNext("profile");
+    retc |= pthread_create(&profileThread, &profileThreadAttr, profileThreadProc, NULL);
+    if (retc < 0)
     {
-        UART_PRINT("Button open failed\r\n");
+        UART_PRINT("Profile thread create failed\r\n");
+        while (1);
     }
-    */
 
-    /* Set external button interrupt */
-    SMO_setButtonIRQ();
+    /* Touch screen presses are read by the peripheral thread */
+    Touch_init(SMO_App_handleTouch);
 
     /* Initialize LEDs */
     LED_init();
@@ -751,6 +826,18 @@ void mainThread(void *args)
     /* Initialize speaker */
     Speaker_init();
 
+    /* Sleep between events and blank the display after inactivity */
+    SMO_Power_init(SMO_App_displayWake);
+
+    HousekeepingSem = Semaphore_create(0, NULL, NULL);
+    if (HousekeepingSem == NULL)
+    {
+        UART_PRINT("Housekeeping semaphore create failed\r\n");
+        while (1);
+    }
+    TimerWheel_start(&HousekeepingTimer, HOUSEKEEPING_INTERVAL_MS, HOUSEKEEPING_INTERVAL_MS,
+                     SMO_housekeepingTick, NULL);
+
     /* Main application loop */
     while (1)
     {
@@ -770,6 +857,7 @@ void mainThread(void *args)
         pthread_attr_init(&udpThreadAttr);
         retc |= pthread_attr_setstacksize(&udpThreadAttr, TASK_STACK_SIZE);
         retc |= pthread_attr_setdetachstate(&udpThreadAttr, PTHREAD_CREATE_DETACHED);
+        Load_nameNext("udp");
         retc |= pthread_create(&udpServerThread, &udpThreadAttr, udpServerThreadProc, NULL);
         if (retc < 0)
         {
@@ -784,6 +872,7 @@ void mainThread(void *args)
         pthread_attr_init(&peripheralThreadAttr);
         retc |= pthread_attr_setstacksize(&peripheralThreadAttr, TASK_STACK_SIZE);
         retc |= pthread_attr_setdetachstate(&peripheralThreadAttr, PTHREAD_CREATE_DETACHED);
+        Load_nameNext("screen");
         retc |= pthread_create(&peripheralThread, &peripheralThreadAttr, peripheralThreadProc, NULL);
         if (retc < 0)
         {
@@ -853,22 +942,11 @@ void mainThread(void *args)
             Pkt.Meds[2] = Med3;
         }
 
-        pthread_mutex_lock(&SMO_Mutex);
-        retc = SMO_Control_configure(&SMO_Ctrl, &Pkt);
-        pthread_mutex_unlock(&SMO_Mutex);
+        retc = SMO_App_handlePacket((const uint8_t *) &Pkt, SMO_WIRE_SCHEDULE_SIZE(Pkt.nMeds));
         if (retc < 0)
         {
             UART_PRINT("Error configuring SMO\r\n");
         }
-
-        newTime = MAP_RTC_C_getCalendarTime();
-        pthread_mutex_lock(&SMO_Mutex);
-        retc = SMO_scheduleNextEvent(&SMO_Ctrl, newTime.hours, newTime.minutes);
-        pthread_mutex_unlock(&SMO_Mutex);
-        if (retc < 0)
-        {
-            UART_PRINT("Error scheduling event\r\n");
-        }
         */
 
         UART_PRINT("Starting main loop\r\n");
@@ -876,15 +954,30 @@ void mainThread(void *args)
         while (App_CB.resetApplication == false)
         {
             char *Date = RTC_getDate();
+            SMO_PowerStats Stats;
 
             /* Print date periodically so we know app is still alive */
             UART_PRINT("Date: %s\r\n", Date);
 
-            sleep(10);
+            SMO_Power_getStats(&Stats);
+            UART_PRINT("Power: active %us, LPM0 %us (%u), LPM3 %us (%u)\r\n",
+                       Stats.Ticks[SMO_POWER_ACTIVE] / TIMERWHEEL_TICKS_PER_SEC,
+                       Stats.Ticks[SMO_POWER_LPM0] / TIMERWHEEL_TICKS_PER_SEC, Stats.Entries[SMO_POWER_LPM0],
+                       Stats.Ticks[SMO_POWER_LPM3] / TIMERWHEEL_TICKS_PER_SEC, Stats.Entries[SMO_POWER_LPM3]);
+            SMO_printLoad();
+#ifdef SMO_LOCK_CHECK
+            SMO_printLocks();
+#endif
+
+            /* Write journal records to flash once a batch has built up */
+            SMO_Journal_flush((uint32_t) RTC_getTime(), false);
+
+            Semaphore_pend(HousekeepingSem, BIOS_WAIT_FOREVER);
         }
 
         udpThreadStop = true;
         peripheralThreadStop = true;
+        Screen_refresh();
 
         pthread_join(udpServerThread, NULL);
         pthread_join(peripheralThread, NULL);
@@ -901,269 +994,366 @@ extern void RTC_C_IRQHandler(uintptr_t Arg)
     Status = MAP_RTC_C_getEnabledInterruptStatus();
     MAP_RTC_C_clearInterruptFlag(Status);
 
-    newTime = MAP_RTC_C_getCalendarTime();
+    Recorder_log(RECORDER_RTC, &Status, sizeof(Status));
+    SMO_App_rtcInterrupt(Status);
+}
 
-    if (Status & RTC_C_CLOCK_READ_READY_INTERRUPT)
+/*
+ * Log CPU load and each task's share of the CPU and stack use
+ */
+static void SMO_printLoad(void)
+{
+    static Load_Stats Stats; //kept off the main thread's stack
+    char Name[LOAD_NAME_SIZE + 1];
+    uint64_t Cycles;
+    uint32_t Permille;
+    int i;
+
+    Load_getStats(&Stats);
+    Cycles = (uint64_t) Stats.Ticks*Stats.CyclesPerTick;
+    Cycles = Cycles == 0 ? 1 : Cycles;
+
+    UART_PRINT("Load: %u.%u%%, peak %u.%u%%, interrupt stack %u/%u\r\n",
+               Stats.Load / 10, Stats.Load % 10, Stats.PeakLoad / 10, Stats.PeakLoad % 10,
+               Stats.HwiStackPeak, Stats.HwiStackSize);
+    for (i = 0; i < Stats.nTasks; i++)
     {
-
+        Permille = Stats.Tasks[i].Cycles*1000 / Cycles;
+        memcpy(Name, Stats.Tasks[i].Name, LOAD_NAME_SIZE);
+        Name[LOAD_NAME_SIZE] = '\0';
+        UART_PRINT("  %s: cpu %u.%u%%, stack %u/%u\r\n", Name[0] ? Name : "?",
+                   Permille / 10, Permille % 10, Stats.Tasks[i].StackPeak, Stats.Tasks[i].StackSize);
     }
+}
 
-    if (Status & RTC_C_TIME_EVENT_INTERRUPT)
-    {
-        UART_PRINT("RTC Int: Minute Passed\r\n");
-
-        //update screen time display every minute
-        uint_fast8_t Hour = newTime.hours;
-        UART_PRINT("Updating screen time: %02d:%02d %s\r\n",
-                   Hour>12?Hour-12:Hour, newTime.minutes, Hour>=12?"PM":"AM");
-        Screen_updateTime(newTime.hours, newTime.minutes);
+#ifdef SMO_LOCK_CHECK
+/*
+ * Log how long each lock was waited for and held, and the call
+ * sites that held a lock longest. The wait of the app lock is
+ * how late the alert thread started an alarm.
+ */
+static void SMO_printLocks(void)
+{
+    static const char *Errors[] = {"ok", "order", "nested", "interrupt"};
+    static Lock_Stats Stats; //kept off the main thread's stack
+    uint32_t CyclesPerUs = MAP_CS_getMCLK() / 1000000;
+    Lock_Info *Info;
+    int i;
 
-        //on a new day, update the date
-        if (newTime.hours == 0 && newTime.minutes == 0)
-        {
-            char *Date = RTC_getDate();
-            char DateStr[20], MonthStr[4] = {0};
-            sprintf(MonthStr, "%c%c%c", Date[4], Date[5], Date[6]);
-            snprintf(DateStr, sizeof(DateStr), "%s %d, %d", MonthStr, newTime.dayOfmonth, newTime.year-70);
-            UART_PRINT("Update screen date: %s\r\n", DateStr);
-            Screen_updateDate(DateStr);
-        }
+    Lock_getStats(&Stats);
+    CyclesPerUs = CyclesPerUs == 0 ? 1 : CyclesPerUs;
 
-        if (SMO_Ctrl.Timer.Timing)
-        {
-            SMO_Ctrl.Timer.Count++;
-            if (SMO_Ctrl.Timer.Count == SMO_EVENT_TIMEOUT_MINS)
-            {
-                SMO_Timer_stop(&SMO_Ctrl.Timer);
-                pthread_mutex_lock(&SMO_Mutex);
-                SMO_handleTimeout();
-                pthread_mutex_unlock(&SMO_Mutex);
-            }
-        }
-        //leave the lights and screen on for an extra minute
-        if (SMO_Ctrl.Timer.Delaying)
-        {
-            SMO_Ctrl.Timer.Delay--;
-            if (SMO_Ctrl.Timer.Delay <= 0)
-            {
-                SMO_Ctrl.Timer.Delaying = false;
-                SMO_Ctrl.Timer.Delay = 0;
-                pthread_mutex_lock(&SMO_Mutex);
-                SMO_stopEvent();
-                pthread_mutex_unlock(&SMO_Mutex);
-            }
-        }
+    UART_PRINT("Locks: %u errors\r\n", Stats.Errors);
+    if (Stats.Errors != 0)
+    {
+        UART_PRINT("  last: %s taking %s holding %s from 0x%08x\r\n", Errors[Stats.LastError],
+                   Stats.LastLock, Stats.LastHeld != NULL ? Stats.LastHeld : "none",
+                   (uint32_t) (uintptr_t) Stats.LastSite);
     }
-
-    if (Status & RTC_C_CLOCK_ALARM_INTERRUPT)
+    for (i = 0; i < Stats.nLocks; i++)
     {
-        int Res = 0;
-        UART_PRINT("RTC Int: Alarm Triggered\r\n");
-
-        pthread_mutex_lock(&SMO_Mutex);
-        if (SMO_Ctrl.Timer.Timing)
-        {
-            SMO_Timer_stop(&SMO_Ctrl.Timer);
-            SMO_stopEvent();
-        }
-        Res = SMO_handleEvent(&SMO_Ctrl);
-        pthread_mutex_unlock(&SMO_Mutex);
-        if (Res < 0)
-        {
-            UART_PRINT("Error handling event\r\n");
-        }
-        else
-        {
-            SMO_Timer_start(&SMO_Ctrl.Timer);
-        }
-
-        pthread_mutex_lock(&SMO_Mutex);
-        Res = SMO_scheduleNextEvent(&SMO_Ctrl, newTime.hours, newTime.minutes);
-        pthread_mutex_unlock(&SMO_Mutex);
-        if (Res < 0)
-        {
-            UART_PRINT("Error scheduling next event\r\n");
-        }
+        Info = &Stats.Locks[i];
+        UART_PRINT("  %s: taken %u, contended %u, wait max %uus, hold max %uus from 0x%08x\r\n",
+                   Info->Name, Info->Taken, Info->Contended, Info->MaxWait / CyclesPerUs,
+                   Info->MaxHold / CyclesPerUs, (uint32_t) (uintptr_t) Info->MaxHoldSite);
     }
-}
-
-/*
- * Interrupt handler for MSP button
- */
-/*
-static void SMO_okayButtonHandler(Button_Handle handle, Button_EventMask events)
-{
-    if (Button_EV_CLICKED == (events & Button_EV_CLICKED))
+    for (i = 0; i < Stats.nSections; i++)
     {
-        UART_PRINT("Okay button clicked\r\n");
-        //user presses button to acknowledge event
-        if (SMO_Ctrl.Timer.Timing)
-        {
-            SMO_Timer_stop(&SMO_Ctrl.Timer);
-            if (!SMO_Ctrl.Timer.Delaying)
-            {
-                SMO_Ctrl.Timer.Delaying = true;
-                SMO_Ctrl.Timer.Delay = 1;
-            }
-            pthread_mutex_lock(&SMO_Mutex);
-            SMO_stopEvent();
-            pthread_mutex_lock(&SMO_Mutex);
-        }
+        UART_PRINT("  longest %s from 0x%08x: %uus, %u times\r\n", Stats.Sections[i].Name,
+                   (uint32_t) (uintptr_t) Stats.Sections[i].Site,
+                   Stats.Sections[i].MaxHold / CyclesPerUs, Stats.Sections[i].Count);
     }
 }
-*/
+#endif
 
 /*
- * Create interrupt for external button handler
+ * Timer wheel callback, wakes the main loop
  */
-static void SMO_setButtonIRQ(void)
+static void SMO_housekeepingTick(void *Arg)
 {
-    MAP_GPIO_setAsInputPinWithPullUpResistor(GPIO_PORT_P6, GPIO_PIN2);
-    MAP_GPIO_clearInterruptFlag(GPIO_PORT_P6, GPIO_PIN2);
-    MAP_GPIO_enableInterrupt(GPIO_PORT_P6, GPIO_PIN2);
-    MAP_GPIO_interruptEdgeSelect(GPIO_PORT_P6, GPIO_PIN2, GPIO_LOW_TO_HIGH_TRANSITION);
-    MAP_Interrupt_enableInterrupt(INT_PORT6);
-
-    Hwi_Params HwiParams;
-    Hwi_Params_init(&HwiParams);
-    HwiParams.priority = 0x41;
-
-    ButtonHwi = (Hwi_Handle) Hwi_create(INT_PORT6, PORT6_IRQHandler, &HwiParams, NULL);
-    if (ButtonHwi == NULL)
-    {
-        UART_PRINT("Error creating button interrupt\r\n");
-        while (1);
-    }
+    Semaphore_post(HousekeepingSem);
 }
 
 /*
- * Interrupt handler for external button
+ * Answer a journal export request with the records following the cursor
  */
-void PORT6_IRQHandler(void)
+static int SMO_sendJournal(int32_t Sd, SlSockAddrIn_t *ClientAddr, SlSocklen_t ClientSize, const uint8_t *Req)
 {
-    uint32_t Status;
-
-    Status = GPIO_getEnabledInterruptStatus(GPIO_PORT_P6);
-
-    if (Status & GPIO_PIN2)
+    /*
+     * Expected SMO Journal Request Structure
+     * ======================================================
+     * 1 byte -- Journal packet header type (0x99)
+     * ------------------------------------------------------
+     * 4 bytes -- cursor of first record wanted (little endian)
+     * ------------------------------------------------------
+     * 2 bytes -- max records to return, 0 for as many as fit
+     * ======================================================
+     * SMO Journal Response Structure
+     * ======================================================
+     * 1 byte -- Journal packet header type (0x99)
+     * 1 byte -- size of each record (8)
+     * 2 bytes -- how many records, n, follow
+     * 4 bytes -- cursor of first record returned, the oldest
+     *            one when the cursor wanted was overwritten or
+     *            is not the start of a record
+     * 4 bytes -- cursor to request next
+     * 4 bytes -- cursor of the newest record + 1
+     * ======================================================
+     * n * (8) bytes -- array of journal records
+     * ======================================================
+     * Journal Record Data Structure
+     * ======================================================
+     * 4 bytes -- RTC seconds when the event started
+     * 1 byte -- compartments that were due (bit per compartment)
+     * 1 byte -- outcome (0 taken, 1 missed, 2 superseded, 3 snoozed)
+     * 2 bytes -- seconds until acknowledged or timed out
+     * ======================================================
+     * All fields are little endian, the response is padded to
+     * a multiple of 16 bytes and AES-256 encrypted
+     */
+    uint8_t *Pkt = (uint8_t *) JournalPkt;
+    SMO_JournalRecord *Records, Rec;
+    uint32_t Cursor, FirstCursor, HeadCursor;
+    int MaxRecords, nRecords, Len, i;
+
+    Cursor = SMO_Wire_get32(&Req[SMO_WIRE_JREQ_CURSOR]);
+    MaxRecords = SMO_Wire_get16(&Req[SMO_WIRE_JREQ_MAX]);
+    if (MaxRecords == 0 || MaxRecords > SMO_JOURNAL_EXPORT_MAX_RECORDS)
     {
-        GPIO_clearInterruptFlag(GPIO_PORT_P6, GPIO_PIN2);
-        UART_PRINT("Button clicked\r\n");
-        //user pressed button to acknowledge event
-        if (SMO_Ctrl.Timer.Timing)
-        {
-            SMO_Timer_stop(&SMO_Ctrl.Timer);
-            if (!SMO_Ctrl.Timer.Delaying)
-            {
-                SMO_Ctrl.Timer.Delaying = true;
-                SMO_Ctrl.Timer.Delay = 1;
-            }
-            pthread_mutex_lock(&SMO_Mutex);
-            SMO_stopEvent();
-            pthread_mutex_lock(&SMO_Mutex);
-        }
+        MaxRecords = SMO_JOURNAL_EXPORT_MAX_RECORDS;
     }
-}
 
-static void SMO_handleTimeout(void)
-{
-    UART_PRINT("Event timer timed out\r\n");
-    //when timer goes off, stop peripherals
-    SMO_stopEvent();
-}
-
-static void SMO_stopEvent(void)
-{
-    UART_PRINT("Stopping SMO event\r\n");
+    Records = (SMO_JournalRecord *) &Pkt[SMO_WIRE_JRSP_RECORDS];
+    nRecords = SMO_Journal_read(Cursor, Records, MaxRecords, &FirstCursor, &HeadCursor);
 
-    //turn off speaker
-    if (speakerOn)
+    //records are read in native order, rewrite each in place as little endian
+    for (i = 0; i < nRecords; ++i)
     {
-        UART_PRINT("Turning off speaker\r\n");
-        Speaker_off();
+        Rec = Records[i];
+        SMO_Wire_putJournalRecord(&Pkt[SMO_WIRE_JRSP_RECORDS + i*SMO_WIRE_JREC_SIZE],
+                                  Rec.Epoch, Rec.Compartments, Rec.Outcome, Rec.Latency);
     }
 
-    //delay so user doesn't forget which meds to take
-    if (!SMO_Ctrl.Timer.Delaying)
-    {
-        //stop LEDs
-        UART_PRINT("Turning off LEDs\r\n");
-        LED_allOff();
+    Pkt[SMO_WIRE_TYPE] = SMO_PACKET_TYPE_JOURNAL;
+    Pkt[SMO_WIRE_JRSP_RECORD_SIZE] = SMO_WIRE_JREC_SIZE;
+    SMO_Wire_put16(&Pkt[SMO_WIRE_JRSP_COUNT], nRecords);
+    SMO_Wire_put32(&Pkt[SMO_WIRE_JRSP_FIRST], FirstCursor);
+    SMO_Wire_put32(&Pkt[SMO_WIRE_JRSP_NEXT], FirstCursor + nRecords);
+    SMO_Wire_put32(&Pkt[SMO_WIRE_JRSP_HEAD], HeadCursor);
 
-        //remove med info from screen
-        UART_PRINT("Removing med info\r\n");
-        Screen_removeMedInfo();
-    }
+    Len = SMO_WIRE_JRSP_RECORDS + nRecords*SMO_WIRE_JREC_SIZE;
+    UART_PRINT("Sending %d journal records from %d\r\n", nRecords, FirstCursor);
+    return SMO_sendEncrypted(Sd, ClientAddr, ClientSize, Pkt, Len);
 }
 
-static int SMO_scheduleNextEvent(SMO_Control *Ctrl, uint8_t Hour, uint8_t Min)
+/*
+ * Answer a recording export request with the input records following the cursor
+ */
+static int SMO_sendRecording(int32_t Sd, SlSockAddrIn_t *ClientAddr, SlSocklen_t ClientSize, const uint8_t *Req)
 {
-    int Res = 0;
-
-    SMO_Event *NextEvent = SMO_Control_nextEvent(Ctrl, Hour, Min);
-    if (NextEvent == NULL)
+    /*
+     * Expected SMO Recording Request Structure
+     * ======================================================
+     * 1 byte -- Recording packet header type (0x9C)
+     * ------------------------------------------------------
+     * 4 bytes -- cursor of first byte wanted (little endian),
+     *            0 or a next cursor from an earlier response
+     * ------------------------------------------------------
+     * 2 bytes -- max bytes to return, 0 for as many as fit,
+     *            at least one whole record is always returned
+     * ======================================================
+     * SMO Recording Response Structure
+     * ======================================================
+     * 1 byte -- Recording packet header type (0x9C)
+     * 1 byte -- reserved (0)
+     * 2 bytes -- bytes of records, n, that follow
+     * 4 bytes -- cursor of first record returned, the oldest
+     *            one when the cursor wanted was overwritten or
+     *            is not the start of a record
+     * 4 bytes -- cursor to request next
+     * 4 bytes -- cursor just past the newest record
+     * ======================================================
+     * n bytes -- whole input records
+     * ======================================================
+     * Input Record Structure
+     * ======================================================
+     * 1 byte -- type (1 packet, 2 RTC status, 3 button, 4 SNTP)
+     * 1 byte -- reserved (0)
+     * 2 bytes -- length of the data
+     * 4 bytes -- timer wheel tick the input arrived at
+     * ------------------------------------------------------
+     * length bytes -- data as the firmware saw it
+     * ======================================================
+     * All fields are little endian, the response is padded to
+     * a multiple of 16 bytes and AES-256 encrypted
+     */
+    uint8_t *Pkt = (uint8_t *) JournalPkt;
+    uint32_t Cursor, FirstCursor, HeadCursor;
+    int MaxBytes, nBytes;
+
+    Cursor = SMO_Wire_get32(&Req[SMO_WIRE_RREQ_CURSOR]);
+    MaxBytes = SMO_Wire_get16(&Req[SMO_WIRE_RREQ_MAX]);
+    if (MaxBytes == 0 || MaxBytes > RECORDER_EXPORT_MAX_BYTES)
     {
-        UART_PRINT("No event available\r\n");
-        Res = -EINVAL;
-        goto Error;
+        MaxBytes = RECORDER_EXPORT_MAX_BYTES;
     }
 
-    UART_PRINT("Scheduling next event for %02d:%02d\r\n", NextEvent->AlarmHour, NextEvent->AlarmMin);
-    //set an alarm for the next event
-    RTC_setAlarm(NextEvent->AlarmMin, NextEvent->AlarmHour, RTC_C_ALARMCONDITION_OFF, RTC_C_ALARMCONDITION_OFF);
+    nBytes = Recorder_read(Cursor, &Pkt[SMO_WIRE_RRSP_RECORDS], MaxBytes, &FirstCursor, &HeadCursor);
 
-    //save the event so we know what to do when alarm triggers
-    Ctrl->CurrentEvent = NextEvent;
+    Pkt[SMO_WIRE_TYPE] = SMO_PACKET_TYPE_RECORDING;
+    Pkt[SMO_WIRE_TYPE + 1] = 0;
+    SMO_Wire_put16(&Pkt[SMO_WIRE_RRSP_LENGTH], nBytes);
+    SMO_Wire_put32(&Pkt[SMO_WIRE_RRSP_FIRST], FirstCursor);
+    SMO_Wire_put32(&Pkt[SMO_WIRE_RRSP_NEXT], FirstCursor + nBytes);
+    SMO_Wire_put32(&Pkt[SMO_WIRE_RRSP_HEAD], HeadCursor);
 
-Error:
-    return Res;
+    UART_PRINT("Sending %d recording bytes from %d\r\n", nBytes, FirstCursor);
+    return SMO_sendEncrypted(Sd, ClientAddr, ClientSize, Pkt, SMO_WIRE_RRSP_RECORDS + nBytes);
 }
 
-static int SMO_handleEvent(SMO_Control *Ctrl)
+static int SMO_sendLoad(int32_t Sd, SlSockAddrIn_t *ClientAddr, SlSocklen_t ClientSize)
 {
-    int Res = 0;
-    char ScreenStr[255];
-    char *BeginStr = &ScreenStr[0], *CurrentStr = &ScreenStr[0], *MedStr = NULL;
-    uint8_t Tmp, Index, Compartments = Ctrl->CurrentEvent->Compartments;
-
-    if (Ctrl->CurrentEvent == NULL)
+    /*
+     * Expected SMO Load Request Structure
+     * ======================================================
+     * 1 byte -- Load packet header type (0x9A)
+     * ======================================================
+     * SMO Load Response Structure
+     * ======================================================
+     * 1 byte -- Load packet header type (0x9A)
+     * 1 byte -- tasks, n, that follow
+     * 1 byte -- task id of the idle task
+     * 1 byte -- reserved (0)
+     * 2 bytes -- CPU load over the last second, permille
+     * 2 bytes -- highest CPU load over a second, permille
+     * 4 bytes -- timer wheel ticks since counting started
+     * 4 bytes -- CPU cycles per timer wheel tick
+     * 4 bytes -- system (interrupt) stack size in bytes
+     * 4 bytes -- most system stack bytes used
+     * ======================================================
+     * n * (24) bytes -- tasks, indexed by task id
+     * ======================================================
+     * Task Record Structure
+     * ======================================================
+     * 8 bytes (chars) -- name, zero padded
+     * 8 bytes -- cycles run since counting started
+     * 4 bytes -- stack size in bytes
+     * 4 bytes -- most stack bytes used
+     * ======================================================
+     * All fields are little endian, the response is padded to
+     * a multiple of 16 bytes and AES-256 encrypted
+     */
+    static Load_Stats Stats; //only the UDP thread asks, kept off its stack
+    uint8_t *Pkt = (uint8_t *) JournalPkt;
+    uint8_t *Task;
+    int i;
+
+    Load_getStats(&Stats);
+
+    memset(Pkt, 0, SMO_WIRE_LRSP_TASKS);
+    Pkt[SMO_WIRE_TYPE] = SMO_PACKET_TYPE_LOAD;
+    Pkt[SMO_WIRE_LRSP_NTASKS] = Stats.nTasks;
+    Pkt[SMO_WIRE_LRSP_IDLE] = Stats.IdleTask;
+    SMO_Wire_put16(&Pkt[SMO_WIRE_LRSP_LOAD], Stats.Load);
+    SMO_Wire_put16(&Pkt[SMO_WIRE_LRSP_PEAK], Stats.PeakLoad);
+    SMO_Wire_put32(&Pkt[SMO_WIRE_LRSP_TICKS], Stats.Ticks);
+    SMO_Wire_put32(&Pkt[SMO_WIRE_LRSP_CYCLES_PER_TICK], Stats.CyclesPerTick);
+    SMO_Wire_put32(&Pkt[SMO_WIRE_LRSP_HWI_SIZE], Stats.HwiStackSize);
+    SMO_Wire_put32(&Pkt[SMO_WIRE_LRSP_HWI_PEAK], Stats.HwiStackPeak);
+    for (i = 0; i < Stats.nTasks; i++)
     {
-        UART_PRINT("No event ready\r\n");
-        Res = -EINVAL;
-        goto Error;
+        Task = &Pkt[SMO_WIRE_LRSP_TASKS + i*SMO_WIRE_LTASK_SIZE];
+        memcpy(&Task[SMO_WIRE_LTASK_NAME], Stats.Tasks[i].Name, LOAD_NAME_SIZE);
+        SMO_Wire_put32(&Task[SMO_WIRE_LTASK_CYCLES], (uint32_t) Stats.Tasks[i].Cycles);
+        SMO_Wire_put32(&Task[SMO_WIRE_LTASK_CYCLES + 4], (uint32_t) (Stats.Tasks[i].Cycles >> 32));
+        SMO_Wire_put32(&Task[SMO_WIRE_LTASK_STACK_SIZE], Stats.Tasks[i].StackSize);
+        SMO_Wire_put32(&Task[SMO_WIRE_LTASK_STACK_PEAK], Stats.Tasks[i].StackPeak);
     }
 
-    UART_PRINT("Starting SMO event\r\n");
+    return SMO_sendEncrypted(Sd, ClientAddr, ClientSize, Pkt, SMO_WIRE_LRSP_TASKS + Stats.nTasks*SMO_WIRE_LTASK_SIZE);
+}
 
-    while (Compartments != 0ULL)
+static int SMO_sendProfile(int32_t Sd, SlSockAddrIn_t *ClientAddr, SlSocklen_t ClientSize, const uint8_t *Req)
+{
+    /*
+     * Expected SMO Profile Request Structure
+     * ======================================================
+     * 1 byte -- Profile packet header type (0x9D)
+     * ------------------------------------------------------
+     * 1 byte -- mode (0 off, 1 UART, 2 SWO, 0xFF unchanged)
+     * ------------------------------------------------------
+     * 2 bytes -- samples per second, 0 for the default
+     * ======================================================
+     * SMO Profile Response Structure
+     * ======================================================
+     * 1 byte -- Profile packet header type (0x9D)
+     * 1 byte -- mode now running
+     * 1 byte -- tasks, n, that follow
+     * 1 byte -- reserved (0)
+     * 2 bytes -- samples per second in use
+     * 2 bytes -- reserved (0)
+     * 4 bytes -- UART samples taken since the profiler started
+     * 4 bytes -- UART samples dropped
+     * ======================================================
+     * n * (16) bytes -- tasks, indexed by the stream's task id
+     * ======================================================
+     * Task Record Structure
+     * ======================================================
+     * 8 bytes (chars) -- name, zero padded
+     * 8 bytes -- cycles run since the profiler started
+     * ======================================================
+     * All fields are little endian, the response is padded to
+     * a multiple of 16 bytes and AES-256 encrypted
+     */
+    uint8_t *Pkt = (uint8_t *) JournalPkt;
+    Profile_Stats Stats;
+    uint8_t *Task;
+    int i;
+
+    if (Req[SMO_WIRE_PREQ_MODE] != SMO_WIRE_PREQ_QUERY
+        && Profile_setMode(Req[SMO_WIRE_PREQ_MODE], SMO_Wire_get16(&Req[SMO_WIRE_PREQ_RATE])) < 0)
     {
-        Tmp = Compartments & -Compartments;
-        Index = 31 - __CLZ(Tmp);
+        UART_PRINT("Unknown profile mode %d\r\n", Req[SMO_WIRE_PREQ_MODE]);
+    }
+    Profile_getStats(&Stats);
+
+    memset(Pkt, 0, SMO_WIRE_PRSP_TASKS);
+    Pkt[SMO_WIRE_TYPE] = SMO_PACKET_TYPE_PROFILE;
+    Pkt[SMO_WIRE_PRSP_MODE] = Stats.Mode;
+    Pkt[SMO_WIRE_PRSP_NTASKS] = Stats.nTasks;
+    SMO_Wire_put16(&Pkt[SMO_WIRE_PRSP_RATE], Stats.Rate);
+    SMO_Wire_put32(&Pkt[SMO_WIRE_PRSP_SAMPLES], Stats.Samples);
+    SMO_Wire_put32(&Pkt[SMO_WIRE_PRSP_DROPPED], Stats.Dropped);
+    for (i = 0; i < Stats.nTasks; i++)
+    {
+        Task = &Pkt[SMO_WIRE_PRSP_TASKS + i*SMO_WIRE_PTASK_SIZE];
+        memcpy(&Task[SMO_WIRE_PTASK_NAME], Stats.Tasks[i].Name, LOAD_NAME_SIZE);
+        SMO_Wire_put32(&Task[SMO_WIRE_PTASK_CYCLES], (uint32_t) Stats.Tasks[i].Cycles);
+        SMO_Wire_put32(&Task[SMO_WIRE_PTASK_CYCLES + 4], (uint32_t) (Stats.Tasks[i].Cycles >> 32));
+    }
 
-        //handle LEDs
-        UART_PRINT("Lighting LED %d\r\n", Index);
-        LED_on(Index);
+    UART_PRINT("Profile mode %d at %d/s\r\n", Stats.Mode, Stats.Rate);
+    return SMO_sendEncrypted(Sd, ClientAddr, ClientSize, Pkt, SMO_WIRE_PRSP_TASKS + Stats.nTasks*SMO_WIRE_PTASK_SIZE);
+}
 
-        //add med info to screen string
-        MedStr = SMO_Control_getMedStr(Ctrl, Index);
-        if (MedStr != NULL)
-        {
-            char CmptChar = 'A' + Index;
-            CurrentStr += sprintf(CurrentStr, "%s, Compartment: %c, Pills: %d\r\n",
-                                  MedStr, CmptChar, Ctrl->CurrentEvent->nPills[Index]);
-        }
+/*
+ * Pad a response to whole AES blocks, encrypt it in place and send it
+ */
+static int SMO_sendEncrypted(int32_t Sd, SlSockAddrIn_t *ClientAddr, SlSocklen_t ClientSize, uint8_t *Pkt, int Len)
+{
+    int i;
 
-        Compartments ^= Tmp;
+    memset(&Pkt[Len], 0, (AES256_BLOCKSIZE - Len % AES256_BLOCKSIZE) % AES256_BLOCKSIZE);
+    Len += (AES256_BLOCKSIZE - Len % AES256_BLOCKSIZE) % AES256_BLOCKSIZE;
+    AES256_setCipherKey(AES256_BASE, AesKey256, AES256_KEYLENGTH_256BIT);
+    for (i = 0; i < Len; i += AES256_BLOCKSIZE)
+    {
+        AES256_encryptData(AES256_BASE, &Pkt[i], &Pkt[i]);
     }
 
-    //display med info
-    UART_PRINT("Displaying on screen:\r\n%s", BeginStr);
-    Screen_printMedInfo(ScreenStr);
-
-    //turn on speaker
-    UART_PRINT("Turning speaker on\r\n");
-    Speaker_on();
-
-Error:
-    return Res;
+    if (sl_SendTo(Sd, Pkt, Len, 0, (SlSockAddr_t *) ClientAddr, ClientSize) != Len)
+    {
+        return -EIO;
+    }
+    return 0;
 }
@@ -42,6 +42,7 @@
 
 /* Application includes */
 #include "SMO.h"
+#include "timer_wheel.h"
 
 /* Application Name and Version*/
 #define APPLICATION_NAME        "6 Ohms Apart Capstone"
@@ -55,6 +56,9 @@
 #define SLNET_IF_WIFI_PRIO       (5)
 
 #define SPAWN_TASK_PRIORITY     (9)
+#define BUTTON_TASK_PRIORITY    (3)
+#define ALERT_TASK_PRIORITY     (2)
+#define PROFILE_TASK_PRIORITY   (1)
 #define TASK_STACK_SIZE         (2048)
 
 /* CC3220 Specific */
@@ -82,8 +86,9 @@
 #define AES256_BLOCKSIZE    16
 #define DATE_BLOCKS         2
 
-/* Expiration value for the timer that is being used to toggle the Led.       */
-#define TIMER_EXPIRATION_VALUE   100 * 1000000
+/* Expiration value (ms) for the timer that is being used to toggle the Led.  */
+#define TIMER_EXPIRATION_VALUE   100
+#define HOUSEKEEPING_INTERVAL_MS (10*60*1000UL) //date print and journal flush
 
 /* Loop forever, user can change it as per application's requirement          */
 #define LOOP_FOREVER() \
@@ -195,7 +200,7 @@ typedef struct Application_ControlBlock_t
 
     /* General */
     uint16_t    timerInts;
-    timer_t     timer;
+    TimerWheel_Timer timer;
 
     /* Security */
     uint8_t     lockUDID[16];
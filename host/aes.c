@@ -0,0 +1,403 @@
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "aes.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define AES_X86
+#include <immintrin.h>
+#endif
+
+static const uint8_t Aes_Sbox[256] = {
+    0x63, 0x7C, 0x77, 0x7B, 0xF2, 0x6B, 0x6F, 0xC5, 0x30, 0x01, 0x67, 0x2B, 0xFE, 0xD7, 0xAB, 0x76,
+    0xCA, 0x82, 0xC9, 0x7D, 0xFA, 0x59, 0x47, 0xF0, 0xAD, 0xD4, 0xA2, 0xAF, 0x9C, 0xA4, 0x72, 0xC0,
+    0xB7, 0xFD, 0x93, 0x26, 0x36, 0x3F, 0xF7, 0xCC, 0x34, 0xA5, 0xE5, 0xF1, 0x71, 0xD8, 0x31, 0x15,
+    0x04, 0xC7, 0x23, 0xC3, 0x18, 0x96, 0x05, 0x9A, 0x07, 0x12, 0x80, 0xE2, 0xEB, 0x27, 0xB2, 0x75,
+    0x09, 0x83, 0x2C, 0x1A, 0x1B, 0x6E, 0x5A, 0xA0, 0x52, 0x3B, 0xD6, 0xB3, 0x29, 0xE3, 0x2F, 0x84,
+    0x53, 0xD1, 0x00, 0xED, 0x20, 0xFC, 0xB1, 0x5B, 0x6A, 0xCB, 0xBE, 0x39, 0x4A, 0x4C, 0x58, 0xCF,
+    0xD0, 0xEF, 0xAA, 0xFB, 0x43, 0x4D, 0x33, 0x85, 0x45, 0xF9, 0x02, 0x7F, 0x50, 0x3C, 0x9F, 0xA8,
+    0x51, 0xA3, 0x40, 0x8F, 0x92, 0x9D, 0x38, 0xF5, 0xBC, 0xB6, 0xDA, 0x21, 0x10, 0xFF, 0xF3, 0xD2,
+    0xCD, 0x0C, 0x13, 0xEC, 0x5F, 0x97, 0x44, 0x17, 0xC4, 0xA7, 0x7E, 0x3D, 0x64, 0x5D, 0x19, 0x73,
+    0x60, 0x81, 0x4F, 0xDC, 0x22, 0x2A, 0x90, 0x88, 0x46, 0xEE, 0xB8, 0x14, 0xDE, 0x5E, 0x0B, 0xDB,
+    0xE0, 0x32, 0x3A, 0x0A, 0x49, 0x06, 0x24, 0x5C, 0xC2, 0xD3, 0xAC, 0x62, 0x91, 0x95, 0xE4, 0x79,
+    0xE7, 0xC8, 0x37, 0x6D, 0x8D, 0xD5, 0x4E, 0xA9, 0x6C, 0x56, 0xF4, 0xEA, 0x65, 0x7A, 0xAE, 0x08,
+    0xBA, 0x78, 0x25, 0x2E, 0x1C, 0xA6, 0xB4, 0xC6, 0xE8, 0xDD, 0x74, 0x1F, 0x4B, 0xBD, 0x8B, 0x8A,
+    0x70, 0x3E, 0xB5, 0x66, 0x48, 0x03, 0xF6, 0x0E, 0x61, 0x35, 0x57, 0xB9, 0x86, 0xC1, 0x1D, 0x9E,
+    0xE1, 0xF8, 0x98, 0x11, 0x69, 0xD9, 0x8E, 0x94, 0x9B, 0x1E, 0x87, 0xE9, 0xCE, 0x55, 0x28, 0xDF,
+    0x8C, 0xA1, 0x89, 0x0D, 0xBF, 0xE6, 0x42, 0x68, 0x41, 0x99, 0x2D, 0x0F, 0xB0, 0x54, 0xBB, 0x16,
+};
+
+static const uint8_t Aes_InvSbox[256] = {
+    0x52, 0x09, 0x6A, 0xD5, 0x30, 0x36, 0xA5, 0x38, 0xBF, 0x40, 0xA3, 0x9E, 0x81, 0xF3, 0xD7, 0xFB,
+    0x7C, 0xE3, 0x39, 0x82, 0x9B, 0x2F, 0xFF, 0x87, 0x34, 0x8E, 0x43, 0x44, 0xC4, 0xDE, 0xE9, 0xCB,
+    0x54, 0x7B, 0x94, 0x32, 0xA6, 0xC2, 0x23, 0x3D, 0xEE, 0x4C, 0x95, 0x0B, 0x42, 0xFA, 0xC3, 0x4E,
+    0x08, 0x2E, 0xA1, 0x66, 0x28, 0xD9, 0x24, 0xB2, 0x76, 0x5B, 0xA2, 0x49, 0x6D, 0x8B, 0xD1, 0x25,
+    0x72, 0xF8, 0xF6, 0x64, 0x86, 0x68, 0x98, 0x16, 0xD4, 0xA4, 0x5C, 0xCC, 0x5D, 0x65, 0xB6, 0x92,
+    0x6C, 0x70, 0x48, 0x50, 0xFD, 0xED, 0xB9, 0xDA, 0x5E, 0x15, 0x46, 0x57, 0xA7, 0x8D, 0x9D, 0x84,
+    0x90, 0xD8, 0xAB, 0x00, 0x8C, 0xBC, 0xD3, 0x0A, 0xF7, 0xE4, 0x58, 0x05, 0xB8, 0xB3, 0x45, 0x06,
+    0xD0, 0x2C, 0x1E, 0x8F, 0xCA, 0x3F, 0x0F, 0x02, 0xC1, 0xAF, 0xBD, 0x03, 0x01, 0x13, 0x8A, 0x6B,
+    0x3A, 0x91, 0x11, 0x41, 0x4F, 0x67, 0xDC, 0xEA, 0x97, 0xF2, 0xCF, 0xCE, 0xF0, 0xB4, 0xE6, 0x73,
+    0x96, 0xAC, 0x74, 0x22, 0xE7, 0xAD, 0x35, 0x85, 0xE2, 0xF9, 0x37, 0xE8, 0x1C, 0x75, 0xDF, 0x6E,
+    0x47, 0xF1, 0x1A, 0x71, 0x1D, 0x29, 0xC5, 0x89, 0x6F, 0xB7, 0x62, 0x0E, 0xAA, 0x18, 0xBE, 0x1B,
+    0xFC, 0x56, 0x3E, 0x4B, 0xC6, 0xD2, 0x79, 0x20, 0x9A, 0xDB, 0xC0, 0xFE, 0x78, 0xCD, 0x5A, 0xF4,
+    0x1F, 0xDD, 0xA8, 0x33, 0x88, 0x07, 0xC7, 0x31, 0xB1, 0x12, 0x10, 0x59, 0x27, 0x80, 0xEC, 0x5F,
+    0x60, 0x51, 0x7F, 0xA9, 0x19, 0xB5, 0x4A, 0x0D, 0x2D, 0xE5, 0x7A, 0x9F, 0x93, 0xC9, 0x9C, 0xEF,
+    0xA0, 0xE0, 0x3B, 0x4D, 0xAE, 0x2A, 0xF5, 0xB0, 0xC8, 0xEB, 0xBB, 0x3C, 0x83, 0x53, 0x99, 0x61,
+    0x17, 0x2B, 0x04, 0x7E, 0xBA, 0x77, 0xD6, 0x26, 0xE1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0C, 0x7D,
+};
+
+static uint8_t Aes_xtime(uint8_t a)
+{
+    return (uint8_t) ((a << 1) ^ ((a & 0x80) ? 0x1B : 0));
+}
+
+static Aes_Engine Aes_Current = AES_ENGINE_COUNT; //picked by the first Aes_init
+
+static void Aes_addRoundKey(uint8_t *s, const uint8_t *k)
+{
+    int i;
+
+    for (i = 0; i < AES_BLOCK_SIZE; ++i)
+    {
+        s[i] ^= k[i];
+    }
+}
+
+//the state is column major, byte r of column c is s[4*c + r]
+static void Aes_subShift(uint8_t *s, const uint8_t *Box, int Dir)
+{
+    uint8_t t[AES_BLOCK_SIZE];
+    int r, c;
+
+    for (c = 0; c < 4; ++c)
+    {
+        for (r = 0; r < 4; ++r)
+        {
+            t[4*c + r] = Box[s[4*((c + Dir*r + 4) % 4) + r]];
+        }
+    }
+    memcpy(s, t, sizeof(t));
+}
+
+static void Aes_mixColumns(uint8_t *s)
+{
+    uint8_t a0, a1, a2, a3;
+    int c;
+
+    for (c = 0; c < 4; ++c)
+    {
+        a0 = s[4*c]; a1 = s[4*c + 1]; a2 = s[4*c + 2]; a3 = s[4*c + 3];
+        s[4*c + 0] = Aes_xtime(a0) ^ Aes_xtime(a1) ^ a1 ^ a2 ^ a3;
+        s[4*c + 1] = a0 ^ Aes_xtime(a1) ^ Aes_xtime(a2) ^ a2 ^ a3;
+        s[4*c + 2] = a0 ^ a1 ^ Aes_xtime(a2) ^ Aes_xtime(a3) ^ a3;
+        s[4*c + 3] = Aes_xtime(a0) ^ a0 ^ a1 ^ a2 ^ Aes_xtime(a3);
+    }
+}
+
+//InvMixColumns as a cheap premultiply followed by MixColumns (The Design of Rijndael, 4.1.3)
+static void Aes_invMixColumns(uint8_t *s)
+{
+    uint8_t u, v;
+    int c;
+
+    for (c = 0; c < 4; ++c)
+    {
+        u = Aes_xtime(Aes_xtime(s[4*c] ^ s[4*c + 2]));
+        v = Aes_xtime(Aes_xtime(s[4*c + 1] ^ s[4*c + 3]));
+        s[4*c + 0] ^= u;
+        s[4*c + 1] ^= v;
+        s[4*c + 2] ^= u;
+        s[4*c + 3] ^= v;
+    }
+    Aes_mixColumns(s);
+}
+
+static void Aes_encryptSoft(const Aes_Key *Key, uint8_t *Buf, size_t nBlocks)
+{
+    int r;
+
+    for (; nBlocks > 0; --nBlocks, Buf += AES_BLOCK_SIZE)
+    {
+        Aes_addRoundKey(Buf, Key->Round[0]);
+        for (r = 1; r <= AES_ROUNDS; ++r)
+        {
+            Aes_subShift(Buf, Aes_Sbox, 1);
+            if (r < AES_ROUNDS)
+            {
+                Aes_mixColumns(Buf);
+            }
+            Aes_addRoundKey(Buf, Key->Round[r]);
+        }
+    }
+}
+
+static void Aes_decryptSoft(const Aes_Key *Key, uint8_t *Buf, size_t nBlocks)
+{
+    int r;
+
+    for (; nBlocks > 0; --nBlocks, Buf += AES_BLOCK_SIZE)
+    {
+        Aes_addRoundKey(Buf, Key->Round[AES_ROUNDS]);
+        for (r = AES_ROUNDS - 1; r >= 0; --r)
+        {
+            Aes_subShift(Buf, Aes_InvSbox, -1);
+            Aes_addRoundKey(Buf, Key->Round[r]);
+            if (r > 0)
+            {
+                Aes_invMixColumns(Buf);
+            }
+        }
+    }
+}
+
+#ifdef AES_X86
+
+/*
+ * AES-NI, eight blocks in flight to cover the latency of each round
+ */
+#define AES_NI_ECB(Name, Op, OpLast)                                                \
+__attribute__((target("aes,sse2")))                                                 \
+static void Name(const uint8_t (*Rk)[AES_BLOCK_SIZE], uint8_t *Buf, size_t nBlocks) \
+{                                                                                   \
+    __m128i k[AES_ROUNDS + 1], b[8];                                                \
+    int r, i;                                                                       \
+                                                                                    \
+    for (r = 0; r <= AES_ROUNDS; ++r)                                               \
+    {                                                                               \
+        k[r] = _mm_load_si128((const __m128i *) Rk[r]);                             \
+    }                                                                               \
+    for (; nBlocks >= 8; nBlocks -= 8, Buf += 8*AES_BLOCK_SIZE)                     \
+    {                                                                               \
+        for (i = 0; i < 8; ++i)                                                     \
+        {                                                                           \
+            b[i] = _mm_xor_si128(_mm_loadu_si128((const __m128i *) &Buf[16*i]), k[0]); \
+        }                                                                           \
+        for (r = 1; r < AES_ROUNDS; ++r)                                            \
+        {                                                                           \
+            for (i = 0; i < 8; ++i)                                                 \
+            {                                                                       \
+                b[i] = Op(b[i], k[r]);                                              \
+            }                                                                       \
+        }                                                                           \
+        for (i = 0; i < 8; ++i)                                                     \
+        {                                                                           \
+            _mm_storeu_si128((__m128i *) &Buf[16*i], OpLast(b[i], k[AES_ROUNDS]));  \
+        }                                                                           \
+    }                                                                               \
+    for (; nBlocks > 0; --nBlocks, Buf += AES_BLOCK_SIZE)                           \
+    {                                                                               \
+        b[0] = _mm_xor_si128(_mm_loadu_si128((const __m128i *) Buf), k[0]);         \
+        for (r = 1; r < AES_ROUNDS; ++r)                                            \
+        {                                                                           \
+            b[0] = Op(b[0], k[r]);                                                  \
+        }                                                                           \
+        _mm_storeu_si128((__m128i *) Buf, OpLast(b[0], k[AES_ROUNDS]));             \
+    }                                                                               \
+}
+
+AES_NI_ECB(Aes_encryptNi, _mm_aesenc_si128, _mm_aesenclast_si128)
+AES_NI_ECB(Aes_decryptNi, _mm_aesdec_si128, _mm_aesdeclast_si128)
+
+/*
+ * VAES on 512 bit registers, four blocks per instruction and four
+ * registers in flight, with a masked load for the last few blocks
+ */
+#define AES_VAES_ECB(Name, Op, OpLast)                                              \
+__attribute__((target("vaes,avx512f")))                                             \
+static void Name(const uint8_t (*Rk)[AES_BLOCK_SIZE], uint8_t *Buf, size_t nBlocks) \
+{                                                                                   \
+    __m512i k[AES_ROUNDS + 1], b[4];                                                \
+    __mmask16 Mask;                                                                 \
+    int r, i;                                                                       \
+                                                                                    \
+    for (r = 0; r <= AES_ROUNDS; ++r)                                               \
+    {                                                                               \
+        k[r] = _mm512_broadcast_i32x4(_mm_load_si128((const __m128i *) Rk[r]));     \
+    }                                                                               \
+    for (; nBlocks >= 16; nBlocks -= 16, Buf += 16*AES_BLOCK_SIZE)                  \
+    {                                                                               \
+        for (i = 0; i < 4; ++i)                                                     \
+        {                                                                           \
+            b[i] = _mm512_xor_si512(_mm512_loadu_si512(&Buf[64*i]), k[0]);          \
+        }                                                                           \
+        for (r = 1; r < AES_ROUNDS; ++r)                                            \
+        {                                                                           \
+            for (i = 0; i < 4; ++i)                                                 \
+            {                                                                       \
+                b[i] = Op(b[i], k[r]);                                              \
+            }                                                                       \
+        }                                                                           \
+        for (i = 0; i < 4; ++i)                                                     \
+        {                                                                           \
+            _mm512_storeu_si512(&Buf[64*i], OpLast(b[i], k[AES_ROUNDS]));           \
+        }                                                                           \
+    }                                                                               \
+    for (; nBlocks > 0; nBlocks -= nBlocks < 4 ? nBlocks : 4, Buf += 64)            \
+    {                                                                               \
+        Mask = nBlocks >= 4 ? 0xFFFF : (__mmask16) ((1u << (4*nBlocks)) - 1);       \
+        b[0] = _mm512_xor_si512(_mm512_maskz_loadu_epi32(Mask, Buf), k[0]);         \
+        for (r = 1; r < AES_ROUNDS; ++r)                                            \
+        {                                                                           \
+            b[0] = Op(b[0], k[r]);                                                  \
+        }                                                                           \
+        _mm512_mask_storeu_epi32(Buf, Mask, OpLast(b[0], k[AES_ROUNDS]));           \
+    }                                                                               \
+}
+
+AES_VAES_ECB(Aes_encryptVaes, _mm512_aesenc_epi128, _mm512_aesenclast_epi128)
+AES_VAES_ECB(Aes_decryptVaes, _mm512_aesdec_epi128, _mm512_aesdeclast_epi128)
+
+#endif
+
+static bool Aes_supported(Aes_Engine Engine)
+{
+    switch (Engine)
+    {
+    case AES_ENGINE_SOFT:
+        return true;
+
+#ifdef AES_X86
+    case AES_ENGINE_AESNI:
+        return __builtin_cpu_supports("aes") && __builtin_cpu_supports("sse2");
+
+    case AES_ENGINE_VAES:
+        return __builtin_cpu_supports("vaes") && __builtin_cpu_supports("avx512f");
+#endif
+
+    default:
+        return false;
+    }
+}
+
+Aes_Engine Aes_bestEngine(void)
+{
+    Aes_Engine Engine = AES_ENGINE_COUNT;
+
+    while (!Aes_supported(--Engine));
+    return Engine;
+}
+
+int Aes_setEngine(Aes_Engine Engine)
+{
+    if (!Aes_supported(Engine))
+    {
+        return -ENOTSUP;
+    }
+    Aes_Current = Engine;
+    return 0;
+}
+
+Aes_Engine Aes_getEngine(void)
+{
+    return Aes_Current == AES_ENGINE_COUNT ? Aes_bestEngine() : Aes_Current;
+}
+
+const char *Aes_engineName(Aes_Engine Engine)
+{
+    static const char *const Names[AES_ENGINE_COUNT] = { "soft", "aesni", "vaes" };
+
+    return Engine < AES_ENGINE_COUNT ? Names[Engine] : "none";
+}
+
+/*
+ * Expand the 32 byte key into 15 round keys, FIPS-197 section 5.2
+ */
+void Aes_init(Aes_Key *Key, const uint8_t Raw[AES_KEY_SIZE])
+{
+    uint8_t *w = &Key->Round[0][0];
+    uint8_t t[4], Rcon = 1, Tmp;
+    int i;
+
+    memcpy(w, Raw, AES_KEY_SIZE);
+    for (i = 8; i < 4*(AES_ROUNDS + 1); ++i)
+    {
+        memcpy(t, &w[4*(i - 1)], 4);
+        if (i % 8 == 0)
+        {
+            Tmp = t[0];
+            t[0] = Aes_Sbox[t[1]] ^ Rcon;
+            t[1] = Aes_Sbox[t[2]];
+            t[2] = Aes_Sbox[t[3]];
+            t[3] = Aes_Sbox[Tmp];
+            Rcon = Aes_xtime(Rcon);
+        }
+        else if (i % 8 == 4)
+        {
+            t[0] = Aes_Sbox[t[0]];
+            t[1] = Aes_Sbox[t[1]];
+            t[2] = Aes_Sbox[t[2]];
+            t[3] = Aes_Sbox[t[3]];
+        }
+        w[4*i + 0] = w[4*(i - 8) + 0] ^ t[0];
+        w[4*i + 1] = w[4*(i - 8) + 1] ^ t[1];
+        w[4*i + 2] = w[4*(i - 8) + 2] ^ t[2];
+        w[4*i + 3] = w[4*(i - 8) + 3] ^ t[3];
+    }
+
+    //the equivalent inverse cipher runs the round keys backwards through InvMixColumns
+    memcpy(Key->InvRound[0], Key->Round[AES_ROUNDS], AES_BLOCK_SIZE);
+    for (i = 1; i < AES_ROUNDS; ++i)
+    {
+        memcpy(Key->InvRound[i], Key->Round[AES_ROUNDS - i], AES_BLOCK_SIZE);
+        Aes_invMixColumns(Key->InvRound[i]);
+    }
+    memcpy(Key->InvRound[AES_ROUNDS], Key->Round[0], AES_BLOCK_SIZE);
+
+    if (Aes_Current == AES_ENGINE_COUNT)
+    {
+        Aes_Current = Aes_bestEngine();
+    }
+}
+
+void Aes_encryptEcb(const Aes_Key *Key, uint8_t *Buf, size_t Len)
+{
+    switch (Aes_getEngine())
+    {
+#ifdef AES_X86
+    case AES_ENGINE_VAES:
+        Aes_encryptVaes(Key->Round, Buf, Len/AES_BLOCK_SIZE);
+        break;
+
+    case AES_ENGINE_AESNI:
+        Aes_encryptNi(Key->Round, Buf, Len/AES_BLOCK_SIZE);
+        break;
+#endif
+
+    default:
+        Aes_encryptSoft(Key, Buf, Len/AES_BLOCK_SIZE);
+        break;
+    }
+}
+
+void Aes_decryptEcb(const Aes_Key *Key, uint8_t *Buf, size_t Len)
+{
+    switch (Aes_getEngine())
+    {
+#ifdef AES_X86
+    case AES_ENGINE_VAES:
+        Aes_decryptVaes(Key->InvRound, Buf, Len/AES_BLOCK_SIZE);
+        break;
+
+    case AES_ENGINE_AESNI:
+        Aes_decryptNi(Key->InvRound, Buf, Len/AES_BLOCK_SIZE);
+        break;
+#endif
+
+    default:
+        Aes_decryptSoft(Key, Buf, Len/AES_BLOCK_SIZE);
+        break;
+    }
+}
+
+void Aes_encrypt(const Aes_Key *Key, const uint8_t In[AES_BLOCK_SIZE], uint8_t Out[AES_BLOCK_SIZE])
+{
+    memmove(Out, In, AES_BLOCK_SIZE);
+    Aes_encryptEcb(Key, Out, AES_BLOCK_SIZE);
+}
+
+void Aes_decrypt(const Aes_Key *Key, const uint8_t In[AES_BLOCK_SIZE], uint8_t Out[AES_BLOCK_SIZE])
+{
+    memmove(Out, In, AES_BLOCK_SIZE);
+    Aes_decryptEcb(Key, Out, AES_BLOCK_SIZE);
+}
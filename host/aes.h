@@ -0,0 +1,54 @@
+/************************************************************
+ * aes.h
+ *
+ * AES-256 for host programs that talk to the device, which
+ * encrypts every UDP packet with its AES256 peripheral one
+ * 16 byte block at a time (ECB). Encryption and decryption
+ * keep separate round keys, as the AES256 peripheral has
+ * separate cipher and decipher keys.
+ *
+ * Blocks are encrypted with the widest engine the CPU has:
+ * VAES on AVX-512 registers, AES-NI, or portable C. The
+ * first Aes_init picks it, so call Aes_init (or
+ * Aes_setEngine) before sharing keys between threads.
+ *
+ ************************************************************/
+
+#ifndef AES_H
+#define AES_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define AES_BLOCK_SIZE  16
+#define AES_KEY_SIZE    32
+#define AES_ROUNDS      14
+
+typedef enum Aes_Engine
+{
+    AES_ENGINE_SOFT = 0,
+    AES_ENGINE_AESNI = 1,
+    AES_ENGINE_VAES = 2,
+    AES_ENGINE_COUNT
+
+} Aes_Engine;
+
+typedef struct Aes_Key
+{
+    _Alignas(16) uint8_t Round[AES_ROUNDS + 1][AES_BLOCK_SIZE];
+    _Alignas(16) uint8_t InvRound[AES_ROUNDS + 1][AES_BLOCK_SIZE]; //decryption keys for AESDEC
+
+} Aes_Key;
+
+void Aes_init(Aes_Key *Key, const uint8_t Raw[AES_KEY_SIZE]);
+void Aes_encrypt(const Aes_Key *Key, const uint8_t In[AES_BLOCK_SIZE], uint8_t Out[AES_BLOCK_SIZE]);
+void Aes_decrypt(const Aes_Key *Key, const uint8_t In[AES_BLOCK_SIZE], uint8_t Out[AES_BLOCK_SIZE]);
+void Aes_encryptEcb(const Aes_Key *Key, uint8_t *Buf, size_t Len); //in place, Len a multiple of 16
+void Aes_decryptEcb(const Aes_Key *Key, uint8_t *Buf, size_t Len);
+
+Aes_Engine Aes_bestEngine(void);
+int Aes_setEngine(Aes_Engine Engine); //-ENOTSUP if this CPU lacks it
+Aes_Engine Aes_getEngine(void);
+const char *Aes_engineName(Aes_Engine Engine);
+
+#endif
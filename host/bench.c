@@ -0,0 +1,770 @@
+/************************************************************
+ * bench.c
+ *
+ * Micro-benchmarks of the firmware's hot paths, built for
+ * the host with the firmware's own sources: the event
+ * vector in SMO.c at every schedule size,
+ * SMO_Control_configure, packet decrypt and validation,
+ * frame serialisation with scene.c and EVE3.c,
+ * EVE_writeString, Report from uart_term.c and the ustdlib
+ * formatter. SPI and UART writes go to sinks that only
+ * count bytes.
+ *
+ * Each benchmark is calibrated to run for --min-time-ms, then
+ * timed --repeat times, and the median, fastest and slowest
+ * time per operation are reported. With --json the results
+ * are one JSON document, for tools/benchcmp.py to compare
+ * two builds. Host times are not device times: they are for
+ * catching regressions and comparing implementations.
+ *
+ * Build and run from the repository root:
+ *   cmake -S . -B build && cmake --build build --target bench
+ *   build/smo_bench --filter screen --repeat 9
+ *
+ ************************************************************/
+
+#include <errno.h>
+#include <getopt.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "aes.h"
+#include "smo_push.h"
+#include "smo_wire.h"
+#include "EVE.h"
+#include "scene.h"
+#include "font.h"
+#include "peripherals.h"
+#include "touch.h"
+#include "uart_term.h"
+#include "ustdlib.h"
+
+//the event vector functions are static, so the benchmark builds SMO.c itself
+#include "SMO.c"
+
+#define BENCH_MAX_CASES     64
+#define BENCH_MAX_REPEAT    31
+#define BENCH_NAME_SIZE     40
+
+//frame layout, as Screen_buildScene in peripherals.c
+#define BENCH_GRAY          0x919191UL
+#define BENCH_BLACK         0x222222UL
+#define BENCH_HIGHLIGHT     0xFFB000UL
+#define BENCH_LAYOUT_Y1     120
+#define BENCH_TILE_W        120
+#define BENCH_TILE_H        70
+#define BENCH_TILE_Y        (VSIZE - BENCH_TILE_H - 10)
+#define BENCH_TEXT_WIDTH    (HSIZE - 20)
+#define BENCH_CACHE_SIZE    3072
+
+//Screen_update variants
+#define BENCH_FRAME_MINUTE  0 //the clock changed
+#define BENCH_FRAME_ALERT   1 //alert progress and due compartments changed
+#define BENCH_FRAME_FULL    2 //every node laid out again, as after a reset
+
+typedef void (*Bench_Fn)(uint64_t nIters, int Param);
+
+typedef struct Bench_Case
+{
+    char Name[BENCH_NAME_SIZE];
+    Bench_Fn Fn;
+    int Param;
+
+} Bench_Case;
+
+typedef struct Bench_Result
+{
+    uint64_t Iters; //per sample
+    double Median; //ns per operation
+    double Min;
+    double Max;
+
+} Bench_Result;
+
+static struct
+{
+    const char *Filter;
+    int Repeat;
+    int MinTimeMs;
+    bool Json;
+    bool List;
+    const char *Output;
+    const char *Label;
+
+} Opts = { NULL, 5, 50, false, false, NULL, "" };
+
+static const uint8_t Bench_RawKey[AES_KEY_SIZE] = {
+    0xB3, 0x85, 0xBB, 0x33, 0x0C, 0x98, 0xAA, 0x5D,
+    0xFA, 0x02, 0x6E, 0x2B, 0xE3, 0x78, 0xBA, 0x53,
+    0xAF, 0xDF, 0xAF, 0xBE, 0xA5, 0x05, 0x5D, 0x52,
+    0xC5, 0x5C, 0xCE, 0xCE, 0x6C, 0x1E, 0x84, 0x47
+}; //AesKey256 in get_time.c
+
+static const char *Bench_MedNames[SMO_MAX_COMPARTMENTS] = {
+    "Ibuprofène 200 mg",
+    "Metformin 500 mg with food",
+    "Ασπιρίνη 100 mg",
+    "Лизиноприл 10 мг",
+    "Vitamin D3 1000 IU",
+    "Levothyroxine 50 µg",
+};
+
+static Bench_Case Bench_Cases[BENCH_MAX_CASES];
+static int Bench_nCases;
+static volatile uintptr_t Bench_Sink; //results the compiler may not discard
+
+//sinks for the drivers EVE3.c and uart_term.c write to
+DIO_PORT_Type SimHal_ports[11];
+static uint64_t Bench_SpiBytes;
+static uint64_t Bench_UartBytes;
+static int Bench_Uart;
+
+//schedules and packets, built once
+static SMO_WireMed Bench_Meds[SMO_VECTOR_MAX_SIZE];
+static uint8_t Bench_Plain[SMO_PACKET_MAX_MEDS + 1][SMO_PUSH_PACKET_MAX];
+static int Bench_PlainLen[SMO_PACKET_MAX_MEDS + 1];
+static uint8_t Bench_Cipher[SMO_PUSH_PACKET_MAX];
+static int Bench_CipherLen;
+static Aes_Key Bench_Key;
+
+//the screen's scene
+static Scene Bench_Scene;
+static Scene_Node Bench_Divider, Bench_Time, Bench_AmPm, Bench_Date, Bench_DeviceId;
+static Scene_Node Bench_MedInfo, Bench_MedList, Bench_Progress, Bench_Upcoming, Bench_Snooze;
+static Scene_Node Bench_Tiles[SCREEN_COMPARTMENTS];
+static uint8_t Bench_Cache[BENCH_CACHE_SIZE];
+static uint16_t Bench_CacheUsed;
+static Font Bench_Font;
+static char Bench_TimeStr[10] = "10:42";
+static char Bench_AmPmStr[3] = "AM";
+static char Bench_DateStr[SCREEN_TEXT_SIZE] = "Monday, October 19 2026";
+static char Bench_DeviceIdStr[SCREEN_TEXT_SIZE] = "Device ID: 5A3F-19C2";
+static char Bench_MedInfoStr[SCREEN_TEXT_SIZE];
+static char Bench_TileLabels[SCREEN_COMPARTMENTS][2];
+
+/*
+ * The EVE's coprocessor FIFO always reads as empty, so bursts are
+ * never held back waiting for space
+ */
+bool SPI_transfer(SPI_Handle Handle, SPI_Transaction *Transaction)
+{
+    uint8_t *Rx = Transaction->rxBuf;
+
+    Bench_SpiBytes += Transaction->count;
+    if (Rx != NULL && Transaction->count >= 6 && Transaction->count <= 8)
+    {
+        Rx[4] = 0xFC;
+        Rx[5] = 0x0F;
+    }
+    return true;
+}
+
+void UART_init(void)
+{
+}
+
+void UART_Params_init(UART_Params *Params)
+{
+    memset(Params, 0, sizeof(*Params));
+}
+
+UART_Handle UART_open(uint_least8_t Index, UART_Params *Params)
+{
+    return (UART_Handle) &Bench_Uart;
+}
+
+int_fast16_t UART_control(UART_Handle Handle, uint_fast16_t Cmd, void *Arg)
+{
+    return 0;
+}
+
+int_fast32_t UART_write(UART_Handle Handle, const void *Buf, size_t Size)
+{
+    Bench_UartBytes += Size;
+    return Size;
+}
+
+int_fast32_t UART_writePolling(UART_Handle Handle, const void *Buf, size_t Size)
+{
+    Bench_UartBytes += Size;
+    return Size;
+}
+
+int_fast32_t UART_readPolling(UART_Handle Handle, void *Buf, size_t Size)
+{
+    return 0;
+}
+
+static uint64_t Bench_ns(void)
+{
+    struct timespec Ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    return (uint64_t) Ts.tv_sec*1000000000ULL + (uint64_t) Ts.tv_nsec;
+}
+
+static void Bench_add(Bench_Fn Fn, int Param, const char *Format, ...)
+{
+    Bench_Case *Case;
+    va_list Args;
+
+    if (Bench_nCases >= BENCH_MAX_CASES)
+    {
+        return;
+    }
+    Case = &Bench_Cases[Bench_nCases++];
+    va_start(Args, Format);
+    vsnprintf(Case->Name, sizeof(Case->Name), Format, Args);
+    va_end(Args);
+    Case->Fn = Fn;
+    Case->Param = Param;
+}
+
+/*
+ * Meds at distinct times, spread over the day in an order that
+ * makes SMO_Vector_addMed insert at the front, back and middle
+ */
+static int Bench_buildSchedules(void)
+{
+    static const uint8_t Order[SMO_VECTOR_MAX_SIZE] = { 5, 0, 9, 2, 7, 1, 8, 4, 3, 6 };
+    int i, n;
+
+    for (i = 0; i < SMO_VECTOR_MAX_SIZE; ++i)
+    {
+        Bench_Meds[i].Hour = 6 + Order[i]*16/10;
+        Bench_Meds[i].Min = (Order[i]*37) % 60;
+        Bench_Meds[i].nPills = 1 + i % 3;
+        Bench_Meds[i].Cmptmt = i % SMO_MAX_COMPARTMENTS;
+        Bench_Meds[i].Payload = Bench_MedNames[i % SMO_MAX_COMPARTMENTS];
+        Bench_Meds[i].Length = strlen(Bench_Meds[i].Payload);
+    }
+    for (n = 1; n <= SMO_PACKET_MAX_MEDS; ++n)
+    {
+        Bench_PlainLen[n] = SMO_Push_encode(Bench_Meds, n, Bench_Plain[n]);
+        if (Bench_PlainLen[n] < 0)
+        {
+            return Bench_PlainLen[n];
+        }
+    }
+
+    Aes_init(&Bench_Key, Bench_RawKey);
+    Bench_CipherLen = SMO_Push_build(&Bench_Key, Bench_Meds, SMO_PACKET_MAX_MEDS, Bench_Cipher);
+    return Bench_CipherLen < 0 ? Bench_CipherLen : 0;
+}
+
+static void Bench_addNode(Scene_Node *Node, uint16_t CacheSize)
+{
+    uint8_t *Cache = NULL;
+
+    if (Bench_CacheUsed + CacheSize <= BENCH_CACHE_SIZE)
+    {
+        Cache = &Bench_Cache[Bench_CacheUsed];
+        Bench_CacheUsed += CacheSize;
+    }
+    Scene_add(&Bench_Scene, Node, Cache, CacheSize);
+}
+
+/*
+ * The screen's scene, node for node, with its custom font taken as
+ * already in RAM_G
+ */
+static void Bench_buildScene(void)
+{
+    uint8_t i;
+
+    spiTransaction.txBuf = txBuf;
+    spiTransaction.rxBuf = rxBuf;
+    txIdx = 0;
+    Font_attach(&Bench_Font, &Font_sans, 0, 1);
+    snprintf(Bench_MedInfoStr, sizeof(Bench_MedInfoStr), "Take 2 of %s and 1 of %s",
+             Bench_MedNames[0], Bench_MedNames[3]);
+
+    Scene_init(&Bench_Scene);
+    Bench_CacheUsed = 0;
+    Scene_rect(&Bench_Divider, 0, BENCH_LAYOUT_Y1-2, HSIZE, 1, 0, BENCH_GRAY);
+    Bench_addNode(&Bench_Divider, 32);
+    Scene_text(&Bench_Time, 580, 20, 31, 0, BENCH_GRAY, Bench_TimeStr);
+    Bench_addNode(&Bench_Time, 32);
+    Scene_text(&Bench_AmPm, 750, 40, 28, 0, BENCH_GRAY, Bench_AmPmStr);
+    Bench_addNode(&Bench_AmPm, 24);
+    Scene_text(&Bench_Date, 580, 65, 29, 0, BENCH_GRAY, Bench_DateStr);
+    Bench_addNode(&Bench_Date, 48);
+    Scene_text(&Bench_DeviceId, 10, 65, 28, 0, BENCH_GRAY, Bench_DeviceIdStr);
+    Bench_addNode(&Bench_DeviceId, 48);
+    Scene_text(&Bench_MedInfo, 10, 150, 30, 0, BENCH_GRAY, Bench_MedInfoStr);
+    Scene_setFont(&Bench_MedInfo, &Bench_Font, BENCH_TEXT_WIDTH);
+    Bench_addNode(&Bench_MedInfo, SCENE_MAX_CACHE);
+    Scene_list(&Bench_MedList, 10, 150, 30, 40, BENCH_GRAY, Bench_MedNames, SCREEN_COMPARTMENTS);
+    Scene_setFont(&Bench_MedList, &Bench_Font, BENCH_TEXT_WIDTH);
+    Scene_setHidden(&Bench_MedList, true);
+    Bench_addNode(&Bench_MedList, SCENE_MAX_CACHE);
+    Scene_progress(&Bench_Progress, 10, BENCH_TILE_Y - 30, HSIZE - 20, 12, 1, BENCH_HIGHLIGHT);
+    Bench_addNode(&Bench_Progress, 40);
+    Scene_button(&Bench_Upcoming, 250, 30, 150, 50, 28, BENCH_BLACK, "Upcoming");
+    Scene_setTag(&Bench_Upcoming, TOUCH_TAG_UPCOMING);
+    Bench_addNode(&Bench_Upcoming, 48);
+    Scene_button(&Bench_Snooze, 410, 30, 150, 50, 28, BENCH_BLACK, "Snooze");
+    Scene_setTag(&Bench_Snooze, TOUCH_TAG_SNOOZE);
+    Bench_addNode(&Bench_Snooze, 48);
+    for (i = 0; i < SCREEN_COMPARTMENTS; ++i)
+    {
+        Bench_TileLabels[i][0] = 'A' + i;
+        Bench_TileLabels[i][1] = '\0';
+        Scene_tile(&Bench_Tiles[i], (HSIZE - SCREEN_COMPARTMENTS*BENCH_TILE_W - (SCREEN_COMPARTMENTS-1)*10)/2
+                   + i*(BENCH_TILE_W + 10), BENCH_TILE_Y, BENCH_TILE_W, BENCH_TILE_H,
+                   BENCH_HIGHLIGHT, Bench_TileLabels[i]);
+        Scene_setTag(&Bench_Tiles[i], TOUCH_TAG_COMPARTMENT + i);
+        Bench_addNode(&Bench_Tiles[i], 96);
+    }
+}
+
+/*
+ * One frame, as Screen_update in peripherals.c
+ */
+static void Bench_frame(void)
+{
+    EVE_startBurst();
+    EVE_cmd(CMD_DLSTART);
+    EVE_cmd(DL_CLEAR_RGB | BENCH_BLACK);
+    EVE_cmd(DL_CLEAR | CLR_COL | CLR_STN | CLR_TAG);
+    EVE_cmdBGColor(BENCH_BLACK);
+    Scene_draw(&Bench_Scene);
+    EVE_burstReserve(8);
+    EVE_cmd(DL_DISPLAY);
+    EVE_cmd(CMD_SWAP);
+    EVE_sendBurst();
+}
+
+static void Bench_vectorAdd(uint64_t nIters, int Size)
+{
+    SMO_Vector Vec;
+    uint64_t n;
+    int i;
+
+    for (n = 0; n < nIters; ++n)
+    {
+        SMO_Vector_init(&Vec);
+        for (i = 0; i < Size; ++i)
+        {
+            SMO_Vector_addMed(&Vec, &Bench_Meds[i]);
+        }
+        Bench_Sink += Vec.Size;
+    }
+}
+
+static void Bench_vectorNext(uint64_t nIters, int Size)
+{
+    SMO_Vector Vec;
+    uint64_t n;
+    uint32_t Minute = 0;
+    int i;
+
+    SMO_Vector_init(&Vec);
+    for (i = 0; i < Size; ++i)
+    {
+        SMO_Vector_addMed(&Vec, &Bench_Meds[i]);
+    }
+    for (n = 0; n < nIters; ++n)
+    {
+        //walk the day in steps that land between and on events
+        Minute = (Minute + 37) % (24*60);
+        Bench_Sink += (uintptr_t) SMO_Vector_findNextEvent(&Vec, Minute/60, Minute % 60);
+    }
+}
+
+static void Bench_configure(uint64_t nIters, int nMeds)
+{
+    SMO_Control Ctrl;
+    uint64_t n;
+
+    SMO_Control_init(&Ctrl);
+    for (n = 0; n < nIters; ++n)
+    {
+        Bench_Sink += SMO_Control_configure(&Ctrl, Bench_Plain[nMeds], Bench_PlainLen[nMeds]);
+    }
+}
+
+/*
+ * The whole packet path of udpServerThreadProc up to configure:
+ * decrypt every block, then check the header and each med
+ */
+static void Bench_decode(uint64_t nIters, int Engine)
+{
+    uint8_t Buf[SMO_PUSH_PACKET_MAX];
+    SMO_WireMed Med;
+    uint64_t n;
+    int nMeds, i;
+
+    Aes_setEngine(Engine);
+    for (n = 0; n < nIters; ++n)
+    {
+        memcpy(Buf, Bench_Cipher, Bench_CipherLen);
+        Aes_decryptEcb(&Bench_Key, Buf, Bench_CipherLen);
+        nMeds = SMO_Wire_schedule(Buf, Bench_CipherLen);
+        for (i = 0; i < nMeds; ++i)
+        {
+            Bench_Sink += SMO_Wire_med(Buf, i, &Med);
+        }
+    }
+    Aes_setEngine(Aes_bestEngine());
+}
+
+static void Bench_validate(uint64_t nIters, int nMeds)
+{
+    SMO_WireMed Med;
+    uint64_t n;
+    int i, Count;
+
+    for (n = 0; n < nIters; ++n)
+    {
+        Count = SMO_Wire_schedule(Bench_Plain[nMeds], Bench_PlainLen[nMeds]);
+        for (i = 0; i < Count; ++i)
+        {
+            Bench_Sink += SMO_Wire_med(Bench_Plain[nMeds], i, &Med);
+        }
+    }
+}
+
+static void Bench_screenUpdate(uint64_t nIters, int Kind)
+{
+    Scene_Node *Node;
+    uint64_t n;
+    uint8_t i;
+
+    Bench_buildScene();
+    Bench_frame();
+    for (n = 0; n < nIters; ++n)
+    {
+        switch (Kind)
+        {
+        case BENCH_FRAME_MINUTE:
+            Bench_TimeStr[4] = '0' + n % 10;
+            Scene_invalidate(&Bench_Time);
+            Scene_invalidate(&Bench_AmPm);
+            break;
+        case BENCH_FRAME_ALERT:
+            Scene_setValue(&Bench_Progress, n % 180);
+            Scene_setRange(&Bench_Progress, 180);
+            for (i = 0; i < SCREEN_COMPARTMENTS; ++i)
+            {
+                Scene_setHighlight(&Bench_Tiles[i], ((n + i) & 1) != 0);
+                Scene_setValue(&Bench_Tiles[i], 1 + (n + i) % 3);
+            }
+            break;
+        default:
+            for (Node = Bench_Scene.First; Node != NULL; Node = Node->Next)
+            {
+                Scene_invalidate(Node);
+            }
+            break;
+        }
+        Bench_frame();
+    }
+    Bench_Sink += Bench_SpiBytes;
+}
+
+static void Bench_writeString(uint64_t nIters, int Len)
+{
+    char Str[SCREEN_TEXT_SIZE];
+    uint64_t n;
+
+    memset(Str, 'x', Len);
+    Str[Len] = '\0';
+    for (n = 0; n < nIters; ++n)
+    {
+        txIdx = 3;
+        EVE_writeString(Str);
+        Bench_Sink += txIdx;
+    }
+    txIdx = 0;
+}
+
+static void Bench_report(uint64_t nIters, int Kind)
+{
+    char Long[300];
+    uint64_t n;
+
+    memset(Long, 'x', sizeof(Long) - 1);
+    Long[sizeof(Long) - 1] = '\0';
+    for (n = 0; n < nIters; ++n)
+    {
+        switch (Kind)
+        {
+        case 0:
+            Bench_Sink += UART_PRINT("Creating new event for med at %02d:%02d in Cmptmt %d\r\n",
+                                     (int) (n % 24), (int) (n % 60), (int) (n % 6));
+            break;
+        case 1:
+            Bench_Sink += UART_PRINT("Adding med info in %d, %s\r\n", (int) (n % 6), Bench_MedNames[n % 6]);
+            break;
+        default:
+            Bench_Sink += UART_PRINT("%s\r\n", Long);
+            break;
+        }
+    }
+}
+
+static void Bench_uvsnprintf(uint64_t nIters, int Kind)
+{
+    char Buf[SCREEN_TEXT_SIZE];
+    uint64_t n;
+
+    for (n = 0; n < nIters; ++n)
+    {
+        switch (Kind)
+        {
+        case 0:
+            Bench_Sink += usnprintf(Buf, sizeof(Buf), "%02d:%02d", (int) (n % 12), (int) (n % 60));
+            break;
+        case 1:
+            Bench_Sink += usnprintf(Buf, sizeof(Buf), "%s, %s %d %d", "Monday", "October",
+                                    (int) (n % 31), 2026);
+            break;
+        default:
+            Bench_Sink += usnprintf(Buf, sizeof(Buf), "%d.%d.%d.%d:%u %08x",
+                                    192, 168, (int) (n & 0xFF), 17, 5004u, (unsigned) n);
+            break;
+        }
+    }
+}
+
+static void Bench_register(void)
+{
+    static const int Sizes[] = { 1, 2, 4, 6, SMO_VECTOR_MAX_SIZE };
+    static const int Lens[] = { 1, 4, 7, 30, 255 };
+    static const char *Frames[] = { "minute", "alert", "full" };
+    static const char *Reports[] = { "event", "medinfo", "truncated" };
+    static const char *Formats[] = { "time", "date", "address" };
+    unsigned i;
+    int Engine;
+
+    for (i = 0; i < sizeof(Sizes)/sizeof(Sizes[0]); ++i)
+    {
+        Bench_add(Bench_vectorAdd, Sizes[i], "vector_add/%d", Sizes[i]);
+    }
+    for (i = 0; i < sizeof(Sizes)/sizeof(Sizes[0]); ++i)
+    {
+        Bench_add(Bench_vectorNext, Sizes[i], "vector_next/%d", Sizes[i]);
+    }
+    for (i = 1; i <= SMO_PACKET_MAX_MEDS; i += i < 2 ? 1 : 2)
+    {
+        Bench_add(Bench_configure, i, "configure/%u", i);
+    }
+    Bench_add(Bench_validate, SMO_PACKET_MAX_MEDS, "validate/%d", SMO_PACKET_MAX_MEDS);
+    for (Engine = 0; Engine < AES_ENGINE_COUNT; ++Engine)
+    {
+        if (Aes_setEngine(Engine) == 0)
+        {
+            Bench_add(Bench_decode, Engine, "decode/%s", Aes_engineName(Engine));
+        }
+    }
+    Aes_setEngine(Aes_bestEngine());
+    for (i = 0; i < sizeof(Frames)/sizeof(Frames[0]); ++i)
+    {
+        Bench_add(Bench_screenUpdate, i, "screen_update/%s", Frames[i]);
+    }
+    for (i = 0; i < sizeof(Lens)/sizeof(Lens[0]); ++i)
+    {
+        Bench_add(Bench_writeString, Lens[i], "write_string/%d", Lens[i]);
+    }
+    for (i = 0; i < sizeof(Reports)/sizeof(Reports[0]); ++i)
+    {
+        Bench_add(Bench_report, i, "report/%s", Reports[i]);
+    }
+    for (i = 0; i < sizeof(Formats)/sizeof(Formats[0]); ++i)
+    {
+        Bench_add(Bench_uvsnprintf, i, "uvsnprintf/%s", Formats[i]);
+    }
+}
+
+static int Bench_cmpDouble(const void *A, const void *B)
+{
+    double X = *(const double *) A, Y = *(const double *) B;
+
+    return (X > Y) - (X < Y);
+}
+
+/*
+ * Double the iterations until a run takes --min-time-ms, then take
+ * --repeat samples of that many
+ */
+static void Bench_run(const Bench_Case *Case, Bench_Result *Res)
+{
+    double Samples[BENCH_MAX_REPEAT];
+    uint64_t MinNs = (uint64_t) Opts.MinTimeMs*1000000ULL;
+    uint64_t nIters = 1, Start, Ns;
+    int i;
+
+    for (;;)
+    {
+        Start = Bench_ns();
+        Case->Fn(nIters, Case->Param);
+        Ns = Bench_ns() - Start;
+        if (Ns >= MinNs || nIters >= (1ULL << 40))
+        {
+            break;
+        }
+        nIters *= 2;
+    }
+
+    for (i = 0; i < Opts.Repeat; ++i)
+    {
+        Start = Bench_ns();
+        Case->Fn(nIters, Case->Param);
+        Samples[i] = (double) (Bench_ns() - Start)/nIters;
+    }
+    qsort(Samples, Opts.Repeat, sizeof(Samples[0]), Bench_cmpDouble);
+    Res->Iters = nIters;
+    Res->Median = Samples[Opts.Repeat/2];
+    Res->Min = Samples[0];
+    Res->Max = Samples[Opts.Repeat - 1];
+}
+
+static void Bench_jsonString(FILE *Out, const char *Str)
+{
+    fputc('"', Out);
+    for (; *Str; ++Str)
+    {
+        if (*Str == '"' || *Str == '\\')
+        {
+            fputc('\\', Out);
+        }
+        if ((unsigned char) *Str >= 0x20)
+        {
+            fputc(*Str, Out);
+        }
+    }
+    fputc('"', Out);
+}
+
+static void Bench_usage(const char *Name)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --filter STR         only benchmarks whose name contains STR\n"
+            "  --repeat N           timed samples per benchmark, odd is best (%d)\n"
+            "  --min-time-ms MS     length of each sample (%d)\n"
+            "  --json               print one JSON document\n"
+            "  -o, --output FILE    write the results to FILE instead of stdout\n"
+            "  --label STR          recorded with the results, such as the commit\n"
+            "  --list               print the benchmark names and exit\n",
+            Name, Opts.Repeat, Opts.MinTimeMs);
+}
+
+int main(int argc, char **argv)
+{
+    static const struct option Long[] = {
+        { "filter", required_argument, NULL, 'f' },
+        { "repeat", required_argument, NULL, 'r' },
+        { "min-time-ms", required_argument, NULL, 'm' },
+        { "json", no_argument, NULL, 'j' },
+        { "output", required_argument, NULL, 'o' },
+        { "label", required_argument, NULL, 'L' },
+        { "list", no_argument, NULL, 'l' },
+        { NULL, 0, NULL, 0 }
+    };
+    Bench_Result Res;
+    FILE *Out = stdout;
+    bool First = true;
+    int Opt, i;
+
+    while ((Opt = getopt_long(argc, argv, "o:", Long, NULL)) != -1)
+    {
+        switch (Opt)
+        {
+        case 'f': Opts.Filter = optarg; break;
+        case 'r': Opts.Repeat = atoi(optarg); break;
+        case 'm': Opts.MinTimeMs = atoi(optarg); break;
+        case 'j': Opts.Json = true; break;
+        case 'o': Opts.Output = optarg; break;
+        case 'L': Opts.Label = optarg; break;
+        case 'l': Opts.List = true; break;
+
+        default:
+            Bench_usage(argv[0]);
+            return 2;
+        }
+    }
+    if (Opts.Repeat <= 0 || Opts.Repeat > BENCH_MAX_REPEAT || Opts.MinTimeMs <= 0)
+    {
+        Bench_usage(argv[0]);
+        return 2;
+    }
+
+    InitTerm();
+    if (Bench_buildSchedules() < 0)
+    {
+        fprintf(stderr, "benchmark schedules are not valid packets\n");
+        return 1;
+    }
+    Bench_buildScene();
+    Bench_register();
+    if (Opts.List)
+    {
+        for (i = 0; i < Bench_nCases; ++i)
+        {
+            printf("%s\n", Bench_Cases[i].Name);
+        }
+        return 0;
+    }
+    if (Opts.Output != NULL)
+    {
+        Out = fopen(Opts.Output, "w");
+        if (Out == NULL)
+        {
+            fprintf(stderr, "%s: %s\n", Opts.Output, strerror(errno));
+            return 1;
+        }
+    }
+
+    if (Opts.Json)
+    {
+        fprintf(Out, "{\n  \"label\": ");
+        Bench_jsonString(Out, Opts.Label);
+        fprintf(Out, ",\n  \"build\": ");
+        Bench_jsonString(Out, SMO_BENCH_BUILD);
+        fprintf(Out, ",\n  \"compiler\": ");
+        Bench_jsonString(Out, __VERSION__);
+        fprintf(Out, ",\n  \"aes_engine\": \"%s\",\n  \"repeat\": %d,\n  \"benchmarks\": [",
+                Aes_engineName(Aes_getEngine()), Opts.Repeat);
+    }
+    else
+    {
+        fprintf(Out, "%-24s %12s %12s %12s %12s\n", "benchmark", "iterations", "ns/op", "min", "max");
+    }
+    for (i = 0; i < Bench_nCases; ++i)
+    {
+        if (Opts.Filter != NULL && strstr(Bench_Cases[i].Name, Opts.Filter) == NULL)
+        {
+            continue;
+        }
+        Bench_run(&Bench_Cases[i], &Res);
+        if (Opts.Json)
+        {
+            fprintf(Out, "%s\n    {\"name\": \"%s\", \"iterations\": %llu, \"ns_per_op\": %.3f, "
+                    "\"min_ns\": %.3f, \"max_ns\": %.3f}", First ? "" : ",", Bench_Cases[i].Name,
+                    (unsigned long long) Res.Iters, Res.Median, Res.Min, Res.Max);
+        }
+        else
+        {
+            fprintf(Out, "%-24s %12llu %12.1f %12.1f %12.1f\n", Bench_Cases[i].Name,
+                    (unsigned long long) Res.Iters, Res.Median, Res.Min, Res.Max);
+        }
+        fflush(Out);
+        First = false;
+    }
+    if (Opts.Json)
+    {
+        fprintf(Out, "\n  ]\n}\n");
+    }
+
+    if (Out != stdout)
+    {
+        fclose(Out);
+    }
+    return 0;
+}
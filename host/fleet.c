@@ -0,0 +1,845 @@
+/************************************************************
+ * fleet.c
+ *
+ * Runs thousands of simulated organisers on one Linux host
+ * to load test a backend that pushes schedules over UDP.
+ * Each device has its own socket on a loopback port and its
+ * own SMO_Control, and handles a packet the way
+ * udpServerThreadProc does: AES-256 decrypt whole blocks,
+ * check it with SMO_Wire_schedule, apply it with
+ * SMO_Control_configure and look up the next event. Devices
+ * are spread over a few worker threads, each waiting on its
+ * devices' sockets with epoll.
+ *
+ * The firmware does not answer schedule pushes, so for load
+ * testing the devices can acknowledge them (--respond ack)
+ * with one encrypted block: the packet type, 0 or the errno
+ * the push failed with, the next event's hour and minute,
+ * and an FNV-1a checksum of the packet as received, so the
+ * sender can match the answer to its push. Devices can also
+ * drop a share of packets (--drop) or answer late
+ * (--delay-ms).
+ *
+ * With --push the program is its own backend: it builds every
+ * device a schedule per round with SMO_Push_batch, then sends
+ * them keeping up to --window pushes in flight at --rate
+ * pushes a second, and reports build time, throughput,
+ * acknowledgement latency percentiles and loss. Without it
+ * the devices serve an external backend for --duration
+ * seconds and report what they received.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -std=c11 -D_GNU_SOURCE -Ihost/include -I. \
+ *      host/fleet.c host/aes.c host/smo_push.c SMO.c smo_wire.c \
+ *      -lpthread -o smo_fleet
+ *   ./smo_fleet -n 5000 -t 4 --push 10
+ *   ./smo_fleet -n 5000 --drop 1 --delay-ms 20 --duration 60
+ *
+ ************************************************************/
+
+#include <errno.h>
+#include <getopt.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+
+#include "aes.h"
+#include "SMO.h"
+#include "smo_push.h"
+#include "smo_wire.h"
+
+#define FLEET_MAX_WORKERS       64
+#define FLEET_EPOLL_EVENTS      64
+#define FLEET_RECV_BUDGET       8 //datagrams taken from one device per wakeup
+#define FLEET_PACKET_MAX        (16*AES_BLOCK_SIZE) //udpServerThreadProc decrypts at most 16 blocks
+#define FLEET_TONE_COUNT        6 //Speaker_toneCount() with the stock sounds
+#define FLEET_DELAY_SLOTS       4096 //acks waiting out --delay-ms, per worker
+#define FLEET_IDLE_MS           100 //longest epoll wait, bounds how long a stop takes
+
+//acknowledgement, only sent by the simulated devices
+#define FLEET_ACK_TYPE          0 //type of the packet answered
+#define FLEET_ACK_STATUS        1 //0 applied, else the errno it failed with
+#define FLEET_ACK_HOUR          2 //next event, 0xFF for none
+#define FLEET_ACK_MIN           3
+#define FLEET_ACK_CHECKSUM      4 //FNV-1a of the datagram
+#define FLEET_ACK_SIZE          AES_BLOCK_SIZE
+
+typedef struct Fleet_Device
+{
+    int Sd;
+    SMO_Control Ctrl;
+
+} Fleet_Device;
+
+typedef struct Fleet_Delayed
+{
+    uint64_t Due; //monotonic ns
+    int Sd;
+    struct sockaddr_in To;
+    uint8_t Ack[FLEET_ACK_SIZE];
+
+} Fleet_Delayed;
+
+typedef struct Fleet_Stats
+{
+    uint64_t Datagrams;
+    uint64_t Applied;
+    uint64_t Invalid;
+    uint64_t Dropped; //thrown away by --drop
+    uint64_t Acks;
+    uint64_t DelayFull; //acked at once, the delay ring was full
+    uint64_t HandleNs; //decrypt, decode and schedule
+
+} Fleet_Stats;
+
+typedef struct Fleet_Worker
+{
+    pthread_t Thread;
+    int Epoll;
+    uint32_t Rand; //xorshift state for --drop
+    Fleet_Delayed *Delayed; //ring of FLEET_DELAY_SLOTS
+    uint32_t DelayHead;
+    uint32_t DelayTail;
+    Fleet_Stats Stats;
+
+} Fleet_Worker;
+
+typedef struct Fleet_Push
+{
+    uint32_t Device;
+    uint64_t Sent; //monotonic ns
+
+} Fleet_Push;
+
+static struct
+{
+    int nDevices;
+    int BasePort;
+    int nWorkers;
+    bool Respond;
+    double DropPct;
+    int DelayMs;
+    int Rounds; //0 to serve an external backend
+    int Rate; //pushes a second, 0 for as fast as the window allows
+    int BuildThreads; //0 for one per CPU
+    int Window;
+    int TimeoutMs;
+    int DurationSecs;
+    bool Verbose;
+
+} Opts = { 1000, 20000, 4, true, 0.0, 0, 0, 0, 0, 256, 1000, 10, false };
+
+static const uint8_t DefaultKey[AES_KEY_SIZE] = {
+    0xB3, 0x85, 0xBB, 0x33, 0x0C, 0x98, 0xAA, 0x5D,
+    0xFA, 0x02, 0x6E, 0x2B, 0xE3, 0x78, 0xBA, 0x53,
+    0xAF, 0xDF, 0xAF, 0xBE, 0xA5, 0x05, 0x5D, 0x52,
+    0xC5, 0x5C, 0xCE, 0xCE, 0x6C, 0x1E, 0x84, 0x47
+}; //AesKey256 in get_time.c
+
+static Aes_Key Fleet_Key;
+static Fleet_Device *Fleet_Devices;
+static Fleet_Worker Fleet_Workers[FLEET_MAX_WORKERS];
+static uint32_t Fleet_DropThreshold;
+static atomic_bool Fleet_Stop;
+
+/*
+ * UART_PRINT for SMO.c, every device shares stdout
+ */
+int Report(const char *Format, ...)
+{
+    va_list Args;
+
+    if (!Opts.Verbose)
+    {
+        return 0;
+    }
+    va_start(Args, Format);
+    flockfile(stdout);
+    vprintf(Format, Args);
+    funlockfile(stdout);
+    va_end(Args);
+    return 0;
+}
+
+static uint64_t Fleet_ns(void)
+{
+    struct timespec Ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    return (uint64_t) Ts.tv_sec*1000000000ULL + (uint64_t) Ts.tv_nsec;
+}
+
+static uint32_t Fleet_hash(const uint8_t *Buf, int Len)
+{
+    uint32_t Hash = 2166136261u;
+    int i;
+
+    for (i = 0; i < Len; ++i)
+    {
+        Hash = (Hash ^ Buf[i])*16777619u;
+    }
+    return Hash;
+}
+
+static uint32_t Fleet_rand(Fleet_Worker *W)
+{
+    W->Rand ^= W->Rand << 13;
+    W->Rand ^= W->Rand >> 17;
+    W->Rand ^= W->Rand << 5;
+    return W->Rand;
+}
+
+/*
+ * Apply a decrypted packet to one device, as SMO_App_handlePacket does,
+ * and fill in its acknowledgement
+ */
+static int Fleet_apply(Fleet_Device *Dev, const uint8_t *Pkt, int Len, uint8_t *Ack)
+{
+    SMO_Event *Next;
+    struct tm Now;
+    time_t Secs;
+    int Res;
+
+    memset(Ack, 0, FLEET_ACK_SIZE);
+    Ack[FLEET_ACK_TYPE] = Pkt[SMO_WIRE_TYPE];
+    Ack[FLEET_ACK_HOUR] = 0xFF;
+    Ack[FLEET_ACK_MIN] = 0xFF;
+
+    if (Len >= SMO_WIRE_TONES_SIZE && Pkt[SMO_WIRE_TYPE] == SMO_PACKET_TYPE_TONES)
+    {
+        Res = SMO_Control_setTones(&Dev->Ctrl, &Pkt[SMO_WIRE_TONES], FLEET_TONE_COUNT);
+        goto Error;
+    }
+
+    Res = SMO_Wire_schedule(Pkt, Len);
+    if (Res < 0)
+    {
+        goto Error;
+    }
+
+    Res = SMO_Control_configure(&Dev->Ctrl, Pkt, Len);
+    if (Res < 0)
+    {
+        goto Error;
+    }
+
+    Secs = time(NULL);
+    localtime_r(&Secs, &Now);
+    Next = SMO_Control_nextEvent(&Dev->Ctrl, Now.tm_hour, Now.tm_min);
+    if (Next != NULL)
+    {
+        Ack[FLEET_ACK_HOUR] = Next->AlarmHour;
+        Ack[FLEET_ACK_MIN] = Next->AlarmMin;
+    }
+
+Error:
+    Ack[FLEET_ACK_STATUS] = Res < 0 ? (uint8_t) -Res : 0;
+    return Res;
+}
+
+static void Fleet_send(Fleet_Worker *W, int Sd, const struct sockaddr_in *To, const uint8_t *Ack)
+{
+    if (sendto(Sd, Ack, FLEET_ACK_SIZE, 0, (const struct sockaddr *) To, sizeof(*To)) == FLEET_ACK_SIZE)
+    {
+        W->Stats.Acks++;
+    }
+}
+
+/*
+ * Send the delayed acks that are due, returns the ms until the next one
+ */
+static int Fleet_flushDelayed(Fleet_Worker *W)
+{
+    Fleet_Delayed *Slot;
+    uint64_t Now = Fleet_ns();
+
+    while (W->DelayHead != W->DelayTail)
+    {
+        //every ack waits the same time, so the ring is in due order
+        Slot = &W->Delayed[W->DelayTail % FLEET_DELAY_SLOTS];
+        if (Slot->Due > Now)
+        {
+            return (int) ((Slot->Due - Now + 999999)/1000000);
+        }
+        Fleet_send(W, Slot->Sd, &Slot->To, Slot->Ack);
+        W->DelayTail++;
+    }
+    return FLEET_IDLE_MS;
+}
+
+static void Fleet_receive(Fleet_Worker *W, Fleet_Device *Dev)
+{
+    uint8_t Buf[FLEET_PACKET_MAX], Ack[FLEET_ACK_SIZE];
+    struct sockaddr_in From;
+    socklen_t FromLen;
+    Fleet_Delayed *Slot;
+    uint64_t Start;
+    uint32_t Hash;
+    int nBytes, Len, Budget;
+
+    for (Budget = 0; Budget < FLEET_RECV_BUDGET; ++Budget)
+    {
+        FromLen = sizeof(From);
+        nBytes = recvfrom(Dev->Sd, Buf, sizeof(Buf), 0, (struct sockaddr *) &From, &FromLen);
+        if (nBytes <= 0)
+        {
+            break;
+        }
+        W->Stats.Datagrams++;
+
+        if (Fleet_DropThreshold != 0 && Fleet_rand(W) < Fleet_DropThreshold)
+        {
+            W->Stats.Dropped++;
+            continue;
+        }
+
+        //decrypt whole blocks, a short last block is zero padded
+        Start = Fleet_ns();
+        Hash = Fleet_hash(Buf, nBytes);
+        Len = (nBytes + AES_BLOCK_SIZE - 1)/AES_BLOCK_SIZE*AES_BLOCK_SIZE;
+        memset(&Buf[nBytes], 0, Len - nBytes);
+        Aes_decryptEcb(&Fleet_Key, Buf, Len);
+
+        if (Fleet_apply(Dev, Buf, Len, Ack) < 0)
+        {
+            W->Stats.Invalid++;
+        }
+        else
+        {
+            W->Stats.Applied++;
+        }
+        SMO_Wire_put32(&Ack[FLEET_ACK_CHECKSUM], Hash);
+        Aes_encryptEcb(&Fleet_Key, Ack, sizeof(Ack));
+        W->Stats.HandleNs += Fleet_ns() - Start;
+
+        if (!Opts.Respond)
+        {
+            continue;
+        }
+        if (Opts.DelayMs == 0)
+        {
+            Fleet_send(W, Dev->Sd, &From, Ack);
+        }
+        else if (W->DelayHead - W->DelayTail == FLEET_DELAY_SLOTS)
+        {
+            W->Stats.DelayFull++;
+            Fleet_send(W, Dev->Sd, &From, Ack);
+        }
+        else
+        {
+            Slot = &W->Delayed[W->DelayHead++ % FLEET_DELAY_SLOTS];
+            Slot->Due = Fleet_ns() + (uint64_t) Opts.DelayMs*1000000ULL;
+            Slot->Sd = Dev->Sd;
+            Slot->To = From;
+            memcpy(Slot->Ack, Ack, sizeof(Ack));
+        }
+    }
+}
+
+static void *Fleet_workerProc(void *Arg)
+{
+    Fleet_Worker *W = Arg;
+    struct epoll_event Events[FLEET_EPOLL_EVENTS];
+    int n, i;
+
+    while (!atomic_load(&Fleet_Stop))
+    {
+        n = epoll_wait(W->Epoll, Events, FLEET_EPOLL_EVENTS, Fleet_flushDelayed(W));
+        for (i = 0; i < n; ++i)
+        {
+            Fleet_receive(W, Events[i].data.ptr);
+        }
+    }
+    return NULL;
+}
+
+static int Fleet_socket(uint16_t Port)
+{
+    struct sockaddr_in Addr;
+    int Sd;
+
+    Sd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+    if (Sd < 0)
+    {
+        return -errno;
+    }
+
+    memset(&Addr, 0, sizeof(Addr));
+    Addr.sin_family = AF_INET;
+    Addr.sin_port = htons(Port);
+    Addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(Sd, (struct sockaddr *) &Addr, sizeof(Addr)) < 0)
+    {
+        close(Sd);
+        return -errno;
+    }
+    return Sd;
+}
+
+/*
+ * Open every device's socket and start the workers
+ */
+static int Fleet_start(void)
+{
+    struct epoll_event Event;
+    struct rlimit Limit;
+    Fleet_Worker *W;
+    int i, Sd;
+
+    //one descriptor per device, most shells start with a soft limit of 1024
+    getrlimit(RLIMIT_NOFILE, &Limit);
+    Limit.rlim_cur = Limit.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &Limit);
+    if (Limit.rlim_cur < (rlim_t) Opts.nDevices + 64)
+    {
+        fprintf(stderr, "open file limit %lu is too low for %d devices\n",
+                (unsigned long) Limit.rlim_cur, Opts.nDevices);
+        return -EMFILE;
+    }
+
+    Fleet_Devices = calloc(Opts.nDevices, sizeof(Fleet_Device));
+    if (Fleet_Devices == NULL)
+    {
+        return -ENOMEM;
+    }
+
+    for (i = 0; i < Opts.nWorkers; ++i)
+    {
+        W = &Fleet_Workers[i];
+        W->Epoll = epoll_create1(0);
+        W->Rand = 2463534242u + i;
+        W->Delayed = calloc(FLEET_DELAY_SLOTS, sizeof(Fleet_Delayed));
+        if (W->Epoll < 0 || W->Delayed == NULL)
+        {
+            return -ENOMEM;
+        }
+    }
+
+    for (i = 0; i < Opts.nDevices; ++i)
+    {
+        Sd = Fleet_socket(Opts.BasePort + i);
+        if (Sd < 0)
+        {
+            fprintf(stderr, "device %d: port %d: %s\n", i, Opts.BasePort + i, strerror(-Sd));
+            return Sd;
+        }
+        Fleet_Devices[i].Sd = Sd;
+        SMO_Control_init(&Fleet_Devices[i].Ctrl);
+
+        Event.events = EPOLLIN;
+        Event.data.ptr = &Fleet_Devices[i];
+        if (epoll_ctl(Fleet_Workers[i % Opts.nWorkers].Epoll, EPOLL_CTL_ADD, Sd, &Event) < 0)
+        {
+            return -errno;
+        }
+    }
+
+    for (i = 0; i < Opts.nWorkers; ++i)
+    {
+        if (pthread_create(&Fleet_Workers[i].Thread, NULL, Fleet_workerProc, &Fleet_Workers[i]) != 0)
+        {
+            return -EAGAIN;
+        }
+    }
+    return 0;
+}
+
+static void Fleet_stop(Fleet_Stats *Total)
+{
+    Fleet_Stats *S;
+    int i;
+
+    atomic_store(&Fleet_Stop, true);
+    memset(Total, 0, sizeof(*Total));
+    for (i = 0; i < Opts.nWorkers; ++i)
+    {
+        pthread_join(Fleet_Workers[i].Thread, NULL);
+        S = &Fleet_Workers[i].Stats;
+        Total->Datagrams += S->Datagrams;
+        Total->Applied += S->Applied;
+        Total->Invalid += S->Invalid;
+        Total->Dropped += S->Dropped;
+        Total->Acks += S->Acks;
+        Total->DelayFull += S->DelayFull;
+        Total->HandleNs += S->HandleNs;
+    }
+}
+
+/*
+ * Make up the schedule for one device and round
+ */
+static uint8_t Fleet_schedule(uint32_t Device, uint32_t Round, SMO_WireMed *Meds,
+                              char (*Payloads)[SMO_PACKET_MED_PAYLOAD_SIZE + 1])
+{
+    uint8_t nMeds, i;
+    int Len;
+
+    nMeds = 1 + (Device + Round) % SMO_PACKET_MAX_MEDS;
+    for (i = 0; i < nMeds; ++i)
+    {
+        Meds[i].Hour = (Device + Round*5 + i*4) % 24;
+        Meds[i].Min = (Device*7 + i*13) % 60;
+        Meds[i].nPills = 1 + i % 5;
+        Meds[i].Cmptmt = i % SMO_MAX_COMPARTMENTS;
+        Len = snprintf(Payloads[i], sizeof(Payloads[i]), "Med %d, device %u round %u", i, Device, Round);
+        Meds[i].Length = Len < SMO_PACKET_MED_PAYLOAD_SIZE ? Len : SMO_PACKET_MED_PAYLOAD_SIZE;
+        Meds[i].Payload = Payloads[i];
+    }
+    return nMeds;
+}
+
+/*
+ * Build every round's packets up front, as a backend would before a
+ * nightly update, returns the jobs or NULL
+ */
+static SMO_PushJob *Fleet_build(uint64_t Total)
+{
+    SMO_WireMed *Meds;
+    char (*Payloads)[SMO_PACKET_MED_PAYLOAD_SIZE + 1];
+    SMO_PushJob *Jobs;
+    SMO_PushPool *Pool;
+    uint64_t i, Start, Elapsed;
+    size_t Built;
+
+    Meds = malloc(Total*SMO_PACKET_MAX_MEDS*sizeof(SMO_WireMed));
+    Payloads = malloc(Total*SMO_PACKET_MAX_MEDS*sizeof(*Payloads));
+    Jobs = malloc(Total*sizeof(SMO_PushJob));
+    Pool = SMO_Push_createPool(Opts.BuildThreads);
+    if (Meds == NULL || Payloads == NULL || Jobs == NULL || Pool == NULL)
+    {
+        free(Jobs);
+        Jobs = NULL;
+        goto Error;
+    }
+
+    for (i = 0; i < Total; ++i)
+    {
+        Jobs[i].Meds = &Meds[i*SMO_PACKET_MAX_MEDS];
+        Jobs[i].nMeds = Fleet_schedule(i % Opts.nDevices, i / Opts.nDevices,
+                                       &Meds[i*SMO_PACKET_MAX_MEDS], &Payloads[i*SMO_PACKET_MAX_MEDS]);
+        Jobs[i].Key = NULL;
+    }
+
+    Start = Fleet_ns();
+    Built = SMO_Push_batch(Pool, &Fleet_Key, Jobs, Total);
+    Elapsed = Fleet_ns() - Start;
+    printf("built %zu packets in %.1f ms, %.0f/s (%s, %d threads)\n", Built, Elapsed/1e6,
+           Built/(Elapsed/1e9), Aes_engineName(Aes_getEngine()), SMO_Push_threads(Pool));
+
+Error:
+    SMO_Push_destroyPool(Pool);
+    free(Payloads);
+    free(Meds);
+    return Jobs;
+}
+
+static int Fleet_cmpU32(const void *A, const void *B)
+{
+    uint32_t a = *(const uint32_t *) A, b = *(const uint32_t *) B;
+
+    return (a > b) - (a < b);
+}
+
+static double Fleet_percentile(const uint32_t *Sorted, uint64_t n, double P)
+{
+    return n == 0 ? 0.0 : Sorted[(uint64_t) (P*(n - 1) + 0.5)];
+}
+
+/*
+ * Be the backend: push every device a schedule per round and wait
+ * for the acknowledgements
+ */
+static int Fleet_push(void)
+{
+    uint64_t Total = (uint64_t) Opts.Rounds*Opts.nDevices;
+    uint64_t Next = 0, Head = 0, nLatencies = 0, Outstanding = 0;
+    uint64_t Lost = 0, Rejected = 0, Stale = 0, Start, Now, Elapsed;
+    uint64_t Timeout = (uint64_t) Opts.TimeoutMs*1000000ULL;
+    uint8_t Pkt[FLEET_PACKET_MAX];
+    uint64_t *Sent; //per device, 0 when nothing is in flight
+    uint32_t *Checksum, *Latencies, Device;
+    SMO_PushJob *Jobs;
+    Fleet_Push *Fifo; //pushes in the order they were sent
+    struct sockaddr_in To, From;
+    socklen_t FromLen;
+    struct pollfd Poll;
+    int Sd, Len, Buffer = 4 << 20;
+    Fleet_Stats Devices;
+
+    Jobs = Fleet_build(Total);
+    Sd = Fleet_socket(0);
+    Sent = calloc(Opts.nDevices, sizeof(uint64_t));
+    Checksum = calloc(Opts.nDevices, sizeof(uint32_t));
+    Latencies = malloc(Total*sizeof(uint32_t));
+    Fifo = malloc(Total*sizeof(Fleet_Push));
+    if (Jobs == NULL || Sd < 0 || Sent == NULL || Checksum == NULL || Latencies == NULL || Fifo == NULL)
+    {
+        fprintf(stderr, "push setup failed\n");
+        return 1;
+    }
+    setsockopt(Sd, SOL_SOCKET, SO_RCVBUF, &Buffer, sizeof(Buffer));
+    setsockopt(Sd, SOL_SOCKET, SO_SNDBUF, &Buffer, sizeof(Buffer));
+
+    memset(&To, 0, sizeof(To));
+    To.sin_family = AF_INET;
+    To.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    Poll.fd = Sd;
+    Poll.events = POLLIN;
+
+    Start = Fleet_ns();
+    while (Next < Total || Outstanding > 0)
+    {
+        Now = Fleet_ns();
+        while (Next < Total && Outstanding < (uint64_t) Opts.Window
+               && (Opts.Rate == 0 || Next < (Now - Start)*Opts.Rate/1000000000ULL + 1))
+        {
+            //a device only has one push in flight, as the app would
+            Device = Next % Opts.nDevices;
+            if (Sent[Device] != 0)
+            {
+                break;
+            }
+
+            Len = Jobs[Next].Len;
+            To.sin_port = htons(Opts.BasePort + Device);
+            if (sendto(Sd, Jobs[Next].Pkt, Len, 0, (struct sockaddr *) &To, sizeof(To)) != Len)
+            {
+                break;
+            }
+            Checksum[Device] = Fleet_hash(Jobs[Next].Pkt, Len);
+            Sent[Device] = Now;
+            Fifo[Next] = (Fleet_Push) { Device, Now };
+            ++Outstanding;
+            ++Next;
+        }
+
+        //wait a little for acks only when nothing else can be sent
+        poll(&Poll, 1, Outstanding >= (uint64_t) Opts.Window || Next == Total ? 1 : 0);
+        while ((FromLen = sizeof(From),
+                Len = recvfrom(Sd, Pkt, sizeof(Pkt), 0, (struct sockaddr *) &From, &FromLen)) > 0)
+        {
+            Now = Fleet_ns();
+            Device = ntohs(From.sin_port) - Opts.BasePort;
+            Aes_decryptEcb(&Fleet_Key, Pkt, FLEET_ACK_SIZE);
+            if (Len != FLEET_ACK_SIZE || Device >= (uint32_t) Opts.nDevices || Sent[Device] == 0
+                || SMO_Wire_get32(&Pkt[FLEET_ACK_CHECKSUM]) != Checksum[Device])
+            {
+                //late answer to a push already counted as lost
+                ++Stale;
+                continue;
+            }
+            Rejected += Pkt[FLEET_ACK_STATUS] != 0;
+            Latencies[nLatencies++] = (uint32_t) ((Now - Sent[Device])/1000);
+            Sent[Device] = 0;
+            --Outstanding;
+        }
+
+        //pushes time out in the order they were sent
+        Now = Fleet_ns();
+        while (Head < Next)
+        {
+            if (Sent[Fifo[Head].Device] != Fifo[Head].Sent)
+            {
+                ++Head;
+            }
+            else if (Now - Fifo[Head].Sent > Timeout)
+            {
+                Sent[Fifo[Head].Device] = 0;
+                --Outstanding;
+                ++Lost;
+                ++Head;
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+    Elapsed = Fleet_ns() - Start;
+    Fleet_stop(&Devices);
+
+    qsort(Latencies, nLatencies, sizeof(uint32_t), Fleet_cmpU32);
+    printf("pushed %llu schedules in %.3f s, %.0f pushes/s, %.0f acked/s\n",
+           (unsigned long long) Total, Elapsed/1e9, Total/(Elapsed/1e9), nLatencies/(Elapsed/1e9));
+    printf("acked %llu, rejected %llu, lost %llu (%.3f%%), stale acks %llu\n",
+           (unsigned long long) nLatencies, (unsigned long long) Rejected, (unsigned long long) Lost,
+           Total ? 100.0*Lost/Total : 0.0, (unsigned long long) Stale);
+    printf("latency us: p50 %.0f, p90 %.0f, p99 %.0f, p99.9 %.0f, max %.0f\n",
+           Fleet_percentile(Latencies, nLatencies, 0.50), Fleet_percentile(Latencies, nLatencies, 0.90),
+           Fleet_percentile(Latencies, nLatencies, 0.99), Fleet_percentile(Latencies, nLatencies, 0.999),
+           Fleet_percentile(Latencies, nLatencies, 1.0));
+    printf("devices: datagrams %llu, applied %llu, invalid %llu, dropped %llu, acks %llu, %.2f us each\n",
+           (unsigned long long) Devices.Datagrams, (unsigned long long) Devices.Applied,
+           (unsigned long long) Devices.Invalid, (unsigned long long) Devices.Dropped,
+           (unsigned long long) Devices.Acks,
+           Devices.Applied + Devices.Invalid ? Devices.HandleNs/1000.0/(Devices.Applied + Devices.Invalid) : 0.0);
+
+    free(Jobs);
+    free(Fifo);
+    free(Latencies);
+    free(Checksum);
+    free(Sent);
+    close(Sd);
+    return Lost != 0;
+}
+
+/*
+ * Serve an external backend for the configured time
+ */
+static int Fleet_serve(void)
+{
+    Fleet_Stats Devices;
+
+    printf("serving for %d s\n", Opts.DurationSecs);
+    fflush(stdout);
+    sleep(Opts.DurationSecs);
+    Fleet_stop(&Devices);
+
+    printf("datagrams %llu (%.0f/s), applied %llu, invalid %llu, dropped %llu\n",
+           (unsigned long long) Devices.Datagrams, (double) Devices.Datagrams/Opts.DurationSecs,
+           (unsigned long long) Devices.Applied, (unsigned long long) Devices.Invalid,
+           (unsigned long long) Devices.Dropped);
+    printf("acks %llu (%llu not delayed, ring full), %.2f us per packet\n",
+           (unsigned long long) Devices.Acks, (unsigned long long) Devices.DelayFull,
+           Devices.Applied + Devices.Invalid ? Devices.HandleNs/1000.0/(Devices.Applied + Devices.Invalid) : 0.0);
+    return 0;
+}
+
+static bool Fleet_parseKey(const char *Hex, uint8_t *Key)
+{
+    unsigned int Byte;
+    int i;
+
+    if (strlen(Hex) != 2*AES_KEY_SIZE)
+    {
+        return false;
+    }
+    for (i = 0; i < AES_KEY_SIZE; ++i)
+    {
+        if (sscanf(&Hex[2*i], "%2x", &Byte) != 1)
+        {
+            return false;
+        }
+        Key[i] = Byte;
+    }
+    return true;
+}
+
+static void Fleet_usage(const char *Name)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  -n, --devices N      simulated devices (%d)\n"
+            "  -p, --port PORT      port of the first device (%d)\n"
+            "  -t, --threads N      worker threads (%d)\n"
+            "  --respond ack|none   answer each packet or stay silent like the firmware (ack)\n"
+            "  --drop PCT           share of packets each device ignores (0)\n"
+            "  --delay-ms MS        hold each ack this long (0)\n"
+            "  --push ROUNDS        push every device ROUNDS schedules and report, else serve\n"
+            "  --rate N             pushes a second, 0 for no limit (0)\n"
+            "  --build-threads N    threads building the pushes, 0 for one per CPU (0)\n"
+            "  --window N           pushes in flight (%d)\n"
+            "  --timeout-ms MS      a push without an ack by then is lost (%d)\n"
+            "  --duration SECS      how long to serve an external backend (%d)\n"
+            "  --key HEX            AES-256 key, the firmware's by default\n"
+            "  --engine NAME        AES engine: soft, aesni or vaes (the best this CPU has)\n"
+            "  -v                   print what SMO.c logs\n",
+            Name, Opts.nDevices, Opts.BasePort, Opts.nWorkers, Opts.Window, Opts.TimeoutMs, Opts.DurationSecs);
+}
+
+int main(int argc, char **argv)
+{
+    static const struct option Long[] = {
+        { "devices", required_argument, NULL, 'n' },
+        { "port", required_argument, NULL, 'p' },
+        { "threads", required_argument, NULL, 't' },
+        { "respond", required_argument, NULL, 'r' },
+        { "drop", required_argument, NULL, 'd' },
+        { "delay-ms", required_argument, NULL, 'D' },
+        { "push", required_argument, NULL, 'P' },
+        { "rate", required_argument, NULL, 'R' },
+        { "window", required_argument, NULL, 'w' },
+        { "timeout-ms", required_argument, NULL, 'T' },
+        { "duration", required_argument, NULL, 's' },
+        { "key", required_argument, NULL, 'k' },
+        { "build-threads", required_argument, NULL, 'b' },
+        { "engine", required_argument, NULL, 'e' },
+        { NULL, 0, NULL, 0 }
+    };
+    uint8_t Key[AES_KEY_SIZE];
+    int Opt, Res, Engine = -1;
+
+    memcpy(Key, DefaultKey, sizeof(Key));
+    while ((Opt = getopt_long(argc, argv, "n:p:t:v", Long, NULL)) != -1)
+    {
+        switch (Opt)
+        {
+        case 'n': Opts.nDevices = atoi(optarg); break;
+        case 'p': Opts.BasePort = atoi(optarg); break;
+        case 't': Opts.nWorkers = atoi(optarg); break;
+        case 'r': Opts.Respond = strcmp(optarg, "none") != 0; break;
+        case 'd': Opts.DropPct = atof(optarg); break;
+        case 'D': Opts.DelayMs = atoi(optarg); break;
+        case 'P': Opts.Rounds = atoi(optarg); break;
+        case 'R': Opts.Rate = atoi(optarg); break;
+        case 'w': Opts.Window = atoi(optarg); break;
+        case 'T': Opts.TimeoutMs = atoi(optarg); break;
+        case 's': Opts.DurationSecs = atoi(optarg); break;
+        case 'b': Opts.BuildThreads = atoi(optarg); break;
+        case 'v': Opts.Verbose = true; break;
+        case 'k':
+            if (!Fleet_parseKey(optarg, Key))
+            {
+                fprintf(stderr, "key must be %d hex digits\n", 2*AES_KEY_SIZE);
+                return 2;
+            }
+            break;
+        case 'e':
+            for (Engine = 0; Engine < AES_ENGINE_COUNT && strcmp(optarg, Aes_engineName(Engine)) != 0; ++Engine);
+            break;
+
+        default:
+            Fleet_usage(argv[0]);
+            return 2;
+        }
+    }
+    if (Opts.nDevices <= 0 || Opts.BasePort <= 0 || Opts.BasePort + Opts.nDevices > 65536
+        || Opts.nWorkers <= 0 || Opts.nWorkers > FLEET_MAX_WORKERS || Opts.Window <= 0
+        || Opts.DropPct < 0 || Opts.DropPct > 100 || Opts.DurationSecs <= 0)
+    {
+        Fleet_usage(argv[0]);
+        return 2;
+    }
+
+    Aes_init(&Fleet_Key, Key);
+    if (Engine >= 0 && Aes_setEngine(Engine) < 0)
+    {
+        fprintf(stderr, "AES engine not available on this CPU\n");
+        return 2;
+    }
+    Fleet_DropThreshold = (uint32_t) (Opts.DropPct/100.0*4294967295.0);
+
+    Res = Fleet_start();
+    if (Res < 0)
+    {
+        fprintf(stderr, "fleet start failed: %s\n", strerror(-Res));
+        return 1;
+    }
+    printf("%d devices on 127.0.0.1:%d-%d, %d threads, %s, drop %.2f%%, delay %d ms, AES %s\n",
+           Opts.nDevices, Opts.BasePort, Opts.BasePort + Opts.nDevices - 1, Opts.nWorkers,
+           Opts.Respond ? "acking" : "silent", Opts.DropPct, Opts.DelayMs, Aes_engineName(Aes_getEngine()));
+
+    return Opts.Rounds > 0 ? Fleet_push() : Fleet_serve();
+}
@@ -0,0 +1,507 @@
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+
+#include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/knl/Mailbox.h>
+#include <ti/sysbios/knl/Semaphore.h>
+#include <ti/sysbios/hal/Hwi.h>
+#include <ti/drivers/NVS.h>
+
+#include "hal_sim.h"
+#include "sim.h"
+#include "peripherals.h"
+#include "power.h"
+#include "rtc.h"
+#include "timer_wheel.h"
+#include "uart_term.h"
+
+struct Mailbox_Object
+{
+    uint8_t Buf[SIMHAL_MAILBOX_BYTES];
+    size_t MsgSize;
+    UInt NumMsgs;
+    UInt Head;
+    UInt Count;
+
+};
+
+struct Semaphore_Object
+{
+    Int Count;
+
+};
+
+struct Hwi_Object
+{
+    Hwi_FuncPtr Fxn;
+
+};
+
+struct NVS_Config
+{
+    uint8_t Flash[SIMHAL_NVS_SECTORS*SIMHAL_NVS_SECTOR_SIZE];
+
+};
+
+static struct
+{
+    bool Verbose;
+    struct Mailbox_Object Mailboxes[SIMHAL_MAILBOXES];
+    int nMailboxes;
+    struct Semaphore_Object Semaphores[SIMHAL_SEMAPHORES];
+    int nSemaphores;
+    struct Hwi_Object Hwi;
+    struct NVS_Config Nvs;
+    time_t RtcOffset; //RTC_setTime relative to the virtual clock
+    uint_fast8_t AlarmMin;
+    uint_fast8_t AlarmHour;
+    bool AlarmSet;
+    bool MinuteTick;
+    time_t CalendarTime; //second the cached calendar was made for
+    RTC_C_Calendar Calendar;
+    bool Busy;
+    uint64_t BusySince;
+    SimHal_Stats Stats;
+
+} SimHal;
+
+DWT_Type SimHal_dwt;
+
+void SimHal_init(bool Verbose)
+{
+    memset(&SimHal, 0, sizeof(SimHal));
+    SimHal.Verbose = Verbose;
+    SimHal.MinuteTick = true;
+    SimHal.CalendarTime = (time_t) -1;
+    memset(SimHal.Nvs.Flash, 0xFF, sizeof(SimHal.Nvs.Flash));
+}
+
+bool SimHal_alarmMatches(const RTC_C_Calendar *Now)
+{
+    //day of week and day of month are always off, so the alarm repeats daily
+    return SimHal.AlarmSet
+        && (SimHal.AlarmMin == RTC_C_ALARMCONDITION_OFF || SimHal.AlarmMin == Now->minutes)
+        && (SimHal.AlarmHour == RTC_C_ALARMCONDITION_OFF || SimHal.AlarmHour == Now->hours);
+}
+
+bool SimHal_minuteTickEnabled(void)
+{
+    return SimHal.MinuteTick;
+}
+
+void SimHal_getStats(SimHal_Stats *Stats)
+{
+    *Stats = SimHal.Stats;
+    if (SimHal.Busy)
+    {
+        Stats->BusyTicks += (uint32_t) (Sim_now() - SimHal.BusySince);
+    }
+}
+
+int Report(const char *pcFormat, ...)
+{
+    va_list Args;
+    int Res = 0;
+
+    if (SimHal.Verbose)
+    {
+        time_t Now = RTC_getTime();
+        char Stamp[32];
+
+        strftime(Stamp, sizeof(Stamp), "%Y-%m-%d %H:%M:%S", gmtime(&Now));
+        printf("[%s] ", Stamp);
+        va_start(Args, pcFormat);
+        Res = vprintf(pcFormat, Args);
+        va_end(Args);
+    }
+    return Res;
+}
+
+/*
+ * Mailboxes are rings in static storage, the simulator is single
+ * threaded so an empty mailbox never blocks
+ */
+Mailbox_Handle Mailbox_create(size_t MsgSize, UInt NumMsgs, void *Params, void *Eb)
+{
+    Mailbox_Handle Mbx;
+
+    if (SimHal.nMailboxes == SIMHAL_MAILBOXES || MsgSize*NumMsgs > SIMHAL_MAILBOX_BYTES)
+    {
+        return NULL;
+    }
+
+    Mbx = &SimHal.Mailboxes[SimHal.nMailboxes++];
+    Mbx->MsgSize = MsgSize;
+    Mbx->NumMsgs = NumMsgs;
+    return Mbx;
+}
+
+Bool Mailbox_post(Mailbox_Handle Mbx, Ptr Msg, UInt Timeout)
+{
+    if (Mbx->Count == Mbx->NumMsgs)
+    {
+        return false;
+    }
+
+    memcpy(&Mbx->Buf[((Mbx->Head + Mbx->Count) % Mbx->NumMsgs)*Mbx->MsgSize], Msg, Mbx->MsgSize);
+    ++Mbx->Count;
+    return true;
+}
+
+Bool Mailbox_pend(Mailbox_Handle Mbx, Ptr Msg, UInt Timeout)
+{
+    if (Mbx->Count == 0)
+    {
+        return false;
+    }
+
+    memcpy(Msg, &Mbx->Buf[Mbx->Head*Mbx->MsgSize], Mbx->MsgSize);
+    Mbx->Head = (Mbx->Head + 1) % Mbx->NumMsgs;
+    --Mbx->Count;
+    return true;
+}
+
+Int Mailbox_getNumPendingMsgs(Mailbox_Handle Mbx)
+{
+    return (Int) Mbx->Count;
+}
+
+Semaphore_Handle Semaphore_create(Int Count, void *Params, void *Eb)
+{
+    Semaphore_Handle Sem;
+
+    if (SimHal.nSemaphores == SIMHAL_SEMAPHORES)
+    {
+        return NULL;
+    }
+
+    Sem = &SimHal.Semaphores[SimHal.nSemaphores++];
+    Sem->Count = Count;
+    return Sem;
+}
+
+void Semaphore_post(Semaphore_Handle Sem)
+{
+    ++Sem->Count;
+}
+
+Bool Semaphore_pend(Semaphore_Handle Sem, UInt Timeout)
+{
+    if (Sem->Count == 0)
+    {
+        return false;
+    }
+
+    --Sem->Count;
+    return true;
+}
+
+void Hwi_Params_init(Hwi_Params *Params)
+{
+    Params->priority = 0;
+}
+
+Hwi_Handle Hwi_create(Int IntNum, Hwi_FuncPtr Fxn, Hwi_Params *Params, void *Eb)
+{
+    SimHal.Hwi.Fxn = Fxn;
+    return &SimHal.Hwi;
+}
+
+/*
+ * NVS in RAM, writes can only clear bits like the flash they stand in for
+ */
+void NVS_init(void)
+{
+
+}
+
+void NVS_Params_init(NVS_Params *Params)
+{
+    Params->custom = NULL;
+}
+
+NVS_Handle NVS_open(uint_least8_t Index, NVS_Params *Params)
+{
+    return Index == 0 ? &SimHal.Nvs : NULL;
+}
+
+void NVS_getAttrs(NVS_Handle Handle, NVS_Attrs *Attrs)
+{
+    Attrs->regionBase = Handle->Flash;
+    Attrs->regionSize = sizeof(Handle->Flash);
+    Attrs->sectorSize = SIMHAL_NVS_SECTOR_SIZE;
+}
+
+int_fast16_t NVS_read(NVS_Handle Handle, size_t Offset, void *Buf, size_t Size)
+{
+    if (Offset + Size > sizeof(Handle->Flash))
+    {
+        return NVS_STATUS_ERROR;
+    }
+
+    memcpy(Buf, &Handle->Flash[Offset], Size);
+    return NVS_STATUS_SUCCESS;
+}
+
+int_fast16_t NVS_erase(NVS_Handle Handle, size_t Offset, size_t Size)
+{
+    if (Offset % SIMHAL_NVS_SECTOR_SIZE || Size % SIMHAL_NVS_SECTOR_SIZE || Offset + Size > sizeof(Handle->Flash))
+    {
+        return NVS_STATUS_ERROR;
+    }
+
+    memset(&Handle->Flash[Offset], 0xFF, Size);
+    SimHal.Stats.NvsErases += (uint32_t) (Size/SIMHAL_NVS_SECTOR_SIZE);
+    return NVS_STATUS_SUCCESS;
+}
+
+int_fast16_t NVS_write(NVS_Handle Handle, size_t Offset, void *Buf, size_t Size, uint_fast16_t Flags)
+{
+    const uint8_t *Src = Buf;
+    size_t i;
+
+    if (Offset + Size > sizeof(Handle->Flash))
+    {
+        return NVS_STATUS_ERROR;
+    }
+
+    if (Flags & NVS_WRITE_ERASE)
+    {
+        size_t First = Offset - Offset % SIMHAL_NVS_SECTOR_SIZE;
+        size_t Last = (Offset + Size + SIMHAL_NVS_SECTOR_SIZE - 1) / SIMHAL_NVS_SECTOR_SIZE * SIMHAL_NVS_SECTOR_SIZE;
+        NVS_erase(Handle, First, Last - First);
+    }
+
+    for (i = 0; i < Size; ++i)
+    {
+        Handle->Flash[Offset + i] &= Src[i];
+    }
+    ++SimHal.Stats.NvsWrites;
+
+    if ((Flags & NVS_WRITE_POST_VERIFY) && memcmp(&Handle->Flash[Offset], Src, Size) != 0)
+    {
+        return NVS_STATUS_ERROR;
+    }
+    return NVS_STATUS_SUCCESS;
+}
+
+/*
+ * RTC on the virtual clock
+ */
+RTC_C_Calendar RTC_C_getCalendarTime(void)
+{
+    time_t Now = RTC_getTime();
+    struct tm Tm;
+
+    //handlers read the calendar several times a second of virtual time
+    if (Now != SimHal.CalendarTime)
+    {
+        gmtime_r(&Now, &Tm);
+        SimHal.Calendar.seconds = (uint_fast8_t) Tm.tm_sec;
+        SimHal.Calendar.minutes = (uint_fast8_t) Tm.tm_min;
+        SimHal.Calendar.hours = (uint_fast8_t) Tm.tm_hour;
+        SimHal.Calendar.dayOfWeek = (uint_fast8_t) Tm.tm_wday;
+        SimHal.Calendar.dayOfmonth = (uint_fast8_t) Tm.tm_mday;
+        SimHal.Calendar.month = (uint_fast8_t) (Tm.tm_mon + 1);
+        //the firmware RTC counts years from 1900 on top of the Unix epoch
+        SimHal.Calendar.year = (uint_fast16_t) (Tm.tm_year + 1900 + 70);
+        SimHal.CalendarTime = Now;
+    }
+    return SimHal.Calendar;
+}
+
+void RTC_setTime(time_t Seconds)
+{
+    SimHal.RtcOffset = Seconds - Sim_time();
+}
+
+time_t RTC_getTime(void)
+{
+    return Sim_time() + SimHal.RtcOffset;
+}
+
+char *RTC_getDate(void)
+{
+    static char Date[32];
+    time_t Now = RTC_getTime();
+    struct tm Tm;
+
+    //same layout as ctime on the device
+    gmtime_r(&Now, &Tm);
+    strftime(Date, sizeof(Date), "%a %b %d %H:%M:%S %Y\n", &Tm);
+    return Date;
+}
+
+void RTC_setAlarm(uint_fast8_t Minutes,
+                   uint_fast8_t Hours,
+                   uint_fast8_t DoW,
+                   uint_fast8_t DoM)
+{
+    SimHal.AlarmMin = Minutes;
+    SimHal.AlarmHour = Hours;
+    SimHal.AlarmSet = true;
+    ++SimHal.Stats.AlarmsSet;
+}
+
+void RTC_enableMinuteTick(bool Enable)
+{
+    SimHal.MinuteTick = Enable;
+}
+
+/*
+ * Timer wheel timers are simulator events, Expires and Period keep
+ * their meaning so callers that read them see the same values
+ */
+static void SimHal_timerExpired(void *Arg)
+{
+    TimerWheel_Timer *Timer = Arg;
+
+    if (Timer->Period != 0)
+    {
+        Timer->Expires += Timer->Period;
+        Sim_at(Sim_now() + Timer->Period, SIM_TIMER, SimHal_timerExpired, Timer);
+    }
+    else
+    {
+        Timer->Active = false;
+    }
+    Timer->Callback(Timer->Arg);
+}
+
+void TimerWheel_init(void)
+{
+
+}
+
+void TimerWheel_start(TimerWheel_Timer *Timer, uint32_t DelayMs, uint32_t PeriodMs,
+                      TimerWheel_Callback Callback, void *Arg)
+{
+    uint32_t Delay = TIMERWHEEL_MS_TO_TICKS(DelayMs);
+
+    TimerWheel_stop(Timer);
+    Timer->Callback = Callback;
+    Timer->Arg = Arg;
+    Timer->Period = TIMERWHEEL_MS_TO_TICKS(PeriodMs);
+    Timer->Expires = TimerWheel_now() + (Delay == 0 ? 1 : Delay);
+    Timer->Active = true;
+    Sim_at(Sim_now() + (Delay == 0 ? 1 : Delay), SIM_TIMER, SimHal_timerExpired, Timer);
+}
+
+void TimerWheel_stop(TimerWheel_Timer *Timer)
+{
+    if (Timer->Active)
+    {
+        Sim_cancel(SimHal_timerExpired, Timer);
+        Timer->Active = false;
+    }
+}
+
+bool TimerWheel_isActive(TimerWheel_Timer *Timer)
+{
+    return Timer->Active;
+}
+
+uint32_t TimerWheel_now(void)
+{
+    return (uint32_t) Sim_now();
+}
+
+/*
+ * The alert holds the CPU awake while it runs
+ */
+void SMO_Power_setBusy(bool Busy)
+{
+    if (Busy && !SimHal.Busy)
+    {
+        SimHal.BusySince = Sim_now();
+    }
+    else if (!Busy && SimHal.Busy)
+    {
+        SimHal.Stats.BusyTicks += (uint32_t) (Sim_now() - SimHal.BusySince);
+    }
+    SimHal.Busy = Busy;
+}
+
+void SMO_Power_activity(void)
+{
+    ++SimHal.Stats.Activity;
+}
+
+/*
+ * Peripherals only count what they were asked to do
+ */
+void LED_off(int nLed)
+{
+    ++SimHal.Stats.LedWrites;
+}
+
+void LED_allOff(void)
+{
+    ++SimHal.Stats.LedWrites;
+}
+
+void LED_setBrightness(int nLed, uint8_t brightness)
+{
+    ++SimHal.Stats.LedWrites;
+}
+
+void Screen_updateTime(int Hour, int Min)
+{
+    ++SimHal.Stats.ScreenUpdates;
+}
+
+void Screen_printMedInfo(char *MedInfo)
+{
+    ++SimHal.Stats.ScreenUpdates;
+}
+
+void Screen_showMedList(const char *const *Lines, uint8_t Shown)
+{
+    ++SimHal.Stats.ScreenUpdates;
+}
+
+void Screen_removeMedInfo(void)
+{
+    ++SimHal.Stats.ScreenUpdates;
+}
+
+void Screen_showCompartments(uint8_t Due, const uint8_t *nPills)
+{
+    ++SimHal.Stats.ScreenUpdates;
+}
+
+void Screen_clearCompartment(uint8_t Index)
+{
+    ++SimHal.Stats.ScreenUpdates;
+}
+
+void Screen_setAlertProgress(uint16_t Value, uint16_t Range)
+{
+    ++SimHal.Stats.ScreenUpdates;
+}
+
+void Screen_updateDate(char *Date)
+{
+    ++SimHal.Stats.ScreenUpdates;
+}
+
+void Speaker_setTone(uint8_t tone)
+{
+
+}
+
+uint8_t Speaker_toneCount(void)
+{
+    return 6;
+}
+
+void Speaker_play(uint8_t vol, uint16_t periodMs)
+{
+    if (vol != 0)
+    {
+        ++SimHal.Stats.SpeakerPlays;
+    }
+}
@@ -0,0 +1,45 @@
+/************************************************************
+ * hal_sim.h
+ *
+ * Simulated drivers for the host build. The RTC reads the
+ * simulator's virtual clock, timer wheel timers are queued
+ * as simulator events, NVS is a RAM region that behaves
+ * like flash, and the LEDs, screen and speaker only count
+ * what they were asked to do. UART output is dropped
+ * unless the run is verbose.
+ *
+ ************************************************************/
+
+#ifndef HAL_SIM_H
+#define HAL_SIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+
+#define SIMHAL_MAILBOXES        4 //mailboxes that can be created
+#define SIMHAL_SEMAPHORES       4
+#define SIMHAL_MAILBOX_BYTES    1024 //message storage of each mailbox
+#define SIMHAL_NVS_SECTOR_SIZE  4096 //as MSP432 main flash
+#define SIMHAL_NVS_SECTORS      4
+
+typedef struct SimHal_Stats
+{
+    uint32_t ScreenUpdates; //calls that change what is on the screen
+    uint32_t SpeakerPlays;
+    uint32_t LedWrites;
+    uint32_t NvsWrites;
+    uint32_t NvsErases;
+    uint32_t AlarmsSet;
+    uint32_t BusyTicks; //virtual ticks the alert held the CPU awake
+    uint32_t Activity; //button presses that would wake the display
+
+} SimHal_Stats;
+
+void SimHal_init(bool Verbose);
+bool SimHal_alarmMatches(const RTC_C_Calendar *Now); //RTC alarm would fire at this minute
+bool SimHal_minuteTickEnabled(void);
+void SimHal_getStats(SimHal_Stats *Stats);
+
+#endif
@@ -0,0 +1,67 @@
+/************************************************************
+ * driverlib.h (host)
+ *
+ * The parts of MSP432 driverlib the portable modules use,
+ * with the RTC calendar read from the simulator's clock.
+ *
+ ************************************************************/
+
+#ifndef DRIVERLIB_H
+#define DRIVERLIB_H
+
+#include <stdint.h>
+
+#define RTC_C_ALARMCONDITION_OFF    0x80
+#define RTC_C_CLOCK_ALARM_INTERRUPT         0x0020
+#define RTC_C_TIME_EVENT_INTERRUPT          0x0040
+
+typedef struct _RTC_C_Calendar
+{
+    uint_fast8_t seconds;
+    uint_fast8_t minutes;
+    uint_fast8_t hours;
+    uint_fast8_t dayOfWeek;
+    uint_fast8_t dayOfmonth;
+    uint_fast8_t month;
+    uint_fast16_t year;
+
+} RTC_C_Calendar;
+
+RTC_C_Calendar RTC_C_getCalendarTime(void);
+
+#define MAP_RTC_C_getCalendarTime   RTC_C_getCalendarTime
+
+#define GPIO_PORT_P6                    6
+#define GPIO_PIN2                       0x0004
+#define GPIO_INPUT_PIN_LOW              0x00
+#define GPIO_INPUT_PIN_HIGH             0x01
+#define GPIO_LOW_TO_HIGH_TRANSITION     0x00
+#define GPIO_HIGH_TO_LOW_TRANSITION     0x01
+#define INT_PORT6                       56
+
+//pins read as released and never interrupt, edges are injected instead
+#define MAP_GPIO_setAsInputPinWithPullUpResistor(Port, Pins)    ((void) 0)
+#define MAP_GPIO_getInputPinValue(Port, Pins)                   GPIO_INPUT_PIN_HIGH
+#define MAP_GPIO_interruptEdgeSelect(Port, Pins, Edge)          ((void) (Edge))
+#define MAP_GPIO_clearInterruptFlag(Port, Pins)                 ((void) 0)
+#define MAP_GPIO_enableInterrupt(Port, Pins)                    ((void) 0)
+#define MAP_GPIO_getEnabledInterruptStatus(Port)                0
+#define MAP_Interrupt_enableInterrupt(Num)                      ((void) 0)
+
+//the cycle counter stands still, so critical sections time as 0
+typedef struct DWT_Type
+{
+    volatile uint32_t CYCCNT;
+
+} DWT_Type;
+
+extern DWT_Type SimHal_dwt;
+
+#define DWT     (&SimHal_dwt)
+
+static inline uint32_t __CLZ(uint32_t Value)
+{
+    return Value == 0 ? 32 : (uint32_t) __builtin_clz(Value);
+}
+
+#endif
@@ -0,0 +1,30 @@
+/************************************************************
+ * msp.h (host)
+ *
+ * The MSP432 registers the EVE driver touches: the power
+ * down and chip select port pins. Writes go to plain
+ * memory, provided by the host program.
+ *
+ ************************************************************/
+
+#ifndef MSP_H
+#define MSP_H
+
+#include <stdint.h>
+
+typedef struct DIO_PORT_Type
+{
+    volatile uint8_t IN;
+    volatile uint8_t OUT;
+    volatile uint8_t DIR;
+
+} DIO_PORT_Type;
+
+extern DIO_PORT_Type SimHal_ports[11];
+
+#define P6  (&SimHal_ports[6])
+#define P9  (&SimHal_ports[9])
+
+#define __nop()     ((void) 0)
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef TI_DRIVERS_I2C_H
+#define TI_DRIVERS_I2C_H
+
+#include <stdint.h>
+
+//declared for the compile check of peripherals.c, nothing the simulated modules use
+
+typedef struct I2C_Config *I2C_Handle;
+
+typedef enum I2C_BitRate
+{
+    I2C_100kHz = 0,
+    I2C_400kHz = 1
+
+} I2C_BitRate;
+
+typedef struct I2C_Params
+{
+    I2C_BitRate bitRate;
+
+} I2C_Params;
+
+void I2C_init(void);
+void I2C_Params_init(I2C_Params *Params);
+I2C_Handle I2C_open(uint_least8_t Index, I2C_Params *Params);
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef TI_DRIVERS_NVS_H
+#define TI_DRIVERS_NVS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define NVS_STATUS_SUCCESS      0
+#define NVS_STATUS_ERROR        (-1)
+#define NVS_WRITE_ERASE         0x1
+#define NVS_WRITE_PRE_VERIFY    0x2
+#define NVS_WRITE_POST_VERIFY   0x4
+
+typedef struct NVS_Config *NVS_Handle;
+
+typedef struct NVS_Params
+{
+    void *custom;
+
+} NVS_Params;
+
+typedef struct NVS_Attrs
+{
+    void *regionBase;
+    size_t regionSize;
+    size_t sectorSize;
+
+} NVS_Attrs;
+
+//a RAM region in the simulator, erased to 0xFF like flash
+void NVS_init(void);
+void NVS_Params_init(NVS_Params *Params);
+NVS_Handle NVS_open(uint_least8_t Index, NVS_Params *Params);
+void NVS_getAttrs(NVS_Handle Handle, NVS_Attrs *Attrs);
+int_fast16_t NVS_read(NVS_Handle Handle, size_t Offset, void *Buf, size_t Size);
+int_fast16_t NVS_write(NVS_Handle Handle, size_t Offset, void *Buf, size_t Size, uint_fast16_t Flags);
+int_fast16_t NVS_erase(NVS_Handle Handle, size_t Offset, size_t Size);
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef TI_DRIVERS_PWM_H
+#define TI_DRIVERS_PWM_H
+
+//included by Board.h, nothing the simulated modules use
+
+#endif
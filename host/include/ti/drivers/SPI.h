@@ -0,0 +1,34 @@
+#ifndef TI_DRIVERS_SPI_H
+#define TI_DRIVERS_SPI_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct SPI_Config *SPI_Handle;
+
+typedef struct SPI_Params
+{
+    uint32_t bitRate;
+    void *custom;
+
+} SPI_Params;
+
+typedef struct SPI_Transaction
+{
+    size_t count;
+    void *txBuf;
+    void *rxBuf;
+    void *arg;
+
+} SPI_Transaction;
+
+//declared for the compile check of peripherals.c
+void SPI_init(void);
+void SPI_Params_init(SPI_Params *Params);
+SPI_Handle SPI_open(uint_least8_t Index, SPI_Params *Params);
+
+//EVE3.c clocks its bursts out through this, the host program decides where to
+bool SPI_transfer(SPI_Handle Handle, SPI_Transaction *Transaction);
+
+#endif
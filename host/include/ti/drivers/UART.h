@@ -0,0 +1,33 @@
+#ifndef TI_DRIVERS_UART_H
+#define TI_DRIVERS_UART_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define UART_DATA_BINARY    0
+#define UART_RETURN_FULL    0
+#define UART_ECHO_OFF       0
+#define UART_CMD_RXDISABLE  0x7
+
+typedef struct UART_Config *UART_Handle;
+
+typedef struct UART_Params
+{
+    unsigned int writeDataMode;
+    unsigned int readDataMode;
+    unsigned int readReturnMode;
+    unsigned int readEcho;
+    uint32_t baudRate;
+
+} UART_Params;
+
+//only for programs that build uart_term.c, the simulator prints with its own Report
+void UART_init(void);
+void UART_Params_init(UART_Params *Params);
+UART_Handle UART_open(uint_least8_t Index, UART_Params *Params);
+int_fast16_t UART_control(UART_Handle Handle, uint_fast16_t Cmd, void *Arg);
+int_fast32_t UART_write(UART_Handle Handle, const void *Buf, size_t Size);
+int_fast32_t UART_writePolling(UART_Handle Handle, const void *Buf, size_t Size);
+int_fast32_t UART_readPolling(UART_Handle Handle, void *Buf, size_t Size);
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef TI_SYSBIOS_BIOS_H
+#define TI_SYSBIOS_BIOS_H
+
+#include <xdc/std.h>
+
+#define BIOS_WAIT_FOREVER   (~(UInt) 0)
+#define BIOS_NO_WAIT        ((UInt) 0)
+
+typedef enum BIOS_ThreadType
+{
+    BIOS_ThreadType_Hwi,
+    BIOS_ThreadType_Swi,
+    BIOS_ThreadType_Task,
+    BIOS_ThreadType_Main
+
+} BIOS_ThreadType;
+
+//the simulator calls past the interrupt handlers from its own thread
+static inline BIOS_ThreadType BIOS_getThreadType(void)
+{
+    return BIOS_ThreadType_Task;
+}
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef TI_SYSBIOS_HAL_HWI_H
+#define TI_SYSBIOS_HAL_HWI_H
+
+#include <xdc/std.h>
+
+typedef struct Hwi_Object *Hwi_Handle;
+typedef void (*Hwi_FuncPtr)(uintptr_t Arg);
+
+typedef struct Hwi_Params
+{
+    UInt priority;
+
+} Hwi_Params;
+
+//interrupts are never raised, the simulator calls past the handlers
+void Hwi_Params_init(Hwi_Params *Params);
+Hwi_Handle Hwi_create(Int IntNum, Hwi_FuncPtr Fxn, Hwi_Params *Params, void *Eb);
+
+//nothing preempts the simulator, so critical sections are empty
+static inline UInt Hwi_disable(void)
+{
+    return 0;
+}
+
+static inline void Hwi_restore(UInt Key)
+{
+    (void) Key;
+}
+
+#endif
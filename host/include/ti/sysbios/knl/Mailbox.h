@@ -0,0 +1,14 @@
+#ifndef TI_SYSBIOS_KNL_MAILBOX_H
+#define TI_SYSBIOS_KNL_MAILBOX_H
+
+#include <xdc/std.h>
+
+typedef struct Mailbox_Object *Mailbox_Handle;
+
+//fixed-size message queue, the simulator is single threaded so pend never blocks
+Mailbox_Handle Mailbox_create(size_t MsgSize, UInt NumMsgs, void *Params, void *Eb);
+Bool Mailbox_post(Mailbox_Handle Mbx, Ptr Msg, UInt Timeout);
+Bool Mailbox_pend(Mailbox_Handle Mbx, Ptr Msg, UInt Timeout);
+Int Mailbox_getNumPendingMsgs(Mailbox_Handle Mbx);
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef TI_SYSBIOS_KNL_SEMAPHORE_H
+#define TI_SYSBIOS_KNL_SEMAPHORE_H
+
+#include <xdc/std.h>
+
+typedef struct Semaphore_Object *Semaphore_Handle;
+
+typedef enum Semaphore_Mode
+{
+    Semaphore_Mode_COUNTING,
+    Semaphore_Mode_BINARY
+
+} Semaphore_Mode;
+
+typedef struct Semaphore_Params
+{
+    Semaphore_Mode mode;
+
+} Semaphore_Params;
+
+//only compiled against by the peripheral thread's check, the simulator passes NULL
+void Semaphore_Params_init(Semaphore_Params *Params);
+
+//counting semaphore, the simulator is single threaded so pend never blocks
+Semaphore_Handle Semaphore_create(Int Count, void *Params, void *Eb);
+void Semaphore_post(Semaphore_Handle Sem);
+Bool Semaphore_pend(Semaphore_Handle Sem, UInt Timeout);
+
+#endif
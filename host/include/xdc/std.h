@@ -0,0 +1,22 @@
+/************************************************************
+ * xdc/std.h (host)
+ *
+ * The XDC base types used by the TI-RTOS headers, for
+ * building the portable modules against host/hal_sim.c.
+ *
+ ************************************************************/
+
+#ifndef XDC_STD_H
+#define XDC_STD_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef int Int;
+typedef unsigned int UInt;
+typedef uint32_t UInt32;
+typedef bool Bool;
+typedef void *Ptr;
+
+#endif
@@ -0,0 +1,390 @@
+/************************************************************
+ * main_sim.c
+ *
+ * Runs the medication event logic (smo_app.c, SMO.c,
+ * alert.c, journal.c) on the host against simulated
+ * drivers, over months of virtual time. Each day has a
+ * number of evenly spaced doses, rotating through the
+ * compartments, and the app pushes the next few of them as
+ * a schedule packet every couple of hours, since a packet
+ * holds at most SMO_PACKET_MAX_MEDS. A random user answers
+ * each alert with a click, a snooze or compartment taps, or
+ * ignores it. The report covers alarms, outcomes, doses that
+ * never alerted, journal records that lost their event (a
+ * schedule pushed during an alert) and the host time spent
+ * per event. The run fails if any dose never alerted or any
+ * record was orphaned.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -std=c11 -D_DEFAULT_SOURCE -Ihost/include -I. \
+ *      host/sim.c host/hal_sim.c host/main_sim.c SMO.c smo_wire.c \
+ *      smo_app.c alert.c journal.c lock.c -lpthread -o smo_sim
+ *   ./smo_sim --days 365 --per-day 50
+ *
+ ************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sim.h"
+#include "hal_sim.h"
+#include "smo_app.h"
+#include "SMO.h"
+#include "smo_wire.h"
+#include "alert.h"
+#include "journal.h"
+#include "rtc.h"
+#include "touch.h"
+
+#define SIM_HOUSEKEEPING_SECS   (10*60) //HOUSEKEEPING_INTERVAL_MS in get_time.h
+#define SIM_START               1767225600 //2026-01-01 00:00 UTC
+
+typedef struct Sim_Options
+{
+    int Days;
+    int PerDay; //doses per day, spread evenly
+    int PushMins; //minutes between schedule packets
+    unsigned Seed;
+    double Ack; //chance the user clicks the button
+    double Snooze; //chance the user snoozes first
+    double Touch; //chance the user taps each compartment
+    bool Verbose;
+
+} Sim_Options;
+
+typedef struct Sim_Dose
+{
+    uint8_t Hour;
+    uint8_t Min;
+    uint8_t Cmptmt;
+
+} Sim_Dose;
+
+static Sim_Options Opts = { 365, 50, 120, 1, 0.6, 0.1, 0.2, false };
+static Sim_Dose Doses[24*60];
+static int nDoses;
+
+static struct
+{
+    uint32_t Alarms; //RTC alarm matches
+    uint32_t Begun; //events the alert machine started
+    uint32_t Outcomes[SMO_JOURNAL_SNOOZED + 1];
+    uint32_t Presses;
+    uint32_t Taps;
+    uint32_t Packets;
+    uint32_t BadPackets;
+    uint32_t Due; //planned doses that have come round
+    uint32_t Unalerted; //planned doses with no alarm at their minute
+    uint32_t Orphans; //journal records with no event time or compartments
+
+} Stats;
+
+static uint64_t Rng;
+
+static double Sim_random(void)
+{
+    //xorshift64*, so runs repeat for a given seed
+    Rng ^= Rng >> 12;
+    Rng ^= Rng << 25;
+    Rng ^= Rng >> 27;
+    return (double) ((Rng*0x2545F4914F6CDD1DULL) >> 11) / (double) (1ULL << 53);
+}
+
+static uint32_t Sim_delaySecs(uint32_t Min, uint32_t Max)
+{
+    return Min + (uint32_t) (Sim_random()*(Max - Min + 1));
+}
+
+static void Sim_click(void *Arg)
+{
+    ++Stats.Presses;
+    SMO_App_handleGesture((Button_Gesture) (uintptr_t) Arg, TimerWheel_now());
+}
+
+static void Sim_tap(void *Arg)
+{
+    ++Stats.Taps;
+    SMO_App_handleTouch((uint8_t) (uintptr_t) Arg, TimerWheel_now());
+}
+
+/*
+ * Decide how the user answers an alert that just started
+ */
+static void Sim_respond(uint8_t Compartments)
+{
+    double Pick = Sim_random();
+    uint64_t At = Sim_now() + SIM_SECS_TO_TICKS(Sim_delaySecs(5, 200));
+    uint8_t Index;
+
+    if (Pick < Opts.Snooze)
+    {
+        Sim_at(At, SIM_INPUT, Sim_click, (void *) (uintptr_t) BUTTON_LONG_PRESS);
+        //snoozed alerts ring again, and the user takes them then
+        At += SIM_SECS_TO_TICKS(5*60 + Sim_delaySecs(10, 120));
+        Sim_at(At, SIM_INPUT, Sim_click, (void *) (uintptr_t) BUTTON_CLICK);
+    }
+    else if (Pick < Opts.Snooze + Opts.Touch)
+    {
+        for (Index = 0; Index < SMO_MAX_COMPARTMENTS; ++Index)
+        {
+            if (Compartments & (1 << Index))
+            {
+                Sim_at(At, SIM_INPUT, Sim_tap, (void *) (uintptr_t) (TOUCH_TAG_COMPARTMENT + Index));
+                At += SIM_SECS_TO_TICKS(Sim_delaySecs(1, 5));
+            }
+        }
+    }
+    else if (Pick < Opts.Snooze + Opts.Touch + Opts.Ack)
+    {
+        Sim_at(At, SIM_INPUT, Sim_click, (void *) (uintptr_t) BUTTON_CLICK);
+    }
+}
+
+static int Sim_beginAlert(void)
+{
+    int Res = SMO_App_beginAlert();
+
+    if (Res >= 0)
+    {
+        ++Stats.Begun;
+        Sim_respond((uint8_t) Res);
+    }
+    return Res;
+}
+
+static bool Sim_drain(void)
+{
+    return SMO_Alert_process(false);
+}
+
+static void Sim_endAlert(uint8_t Outcome, uint32_t Time)
+{
+    if (Outcome <= SMO_JOURNAL_SNOOZED)
+    {
+        ++Stats.Outcomes[Outcome];
+    }
+    SMO_App_endAlert(Outcome, Time);
+}
+
+/*
+ * RTC interrupt: the minute tick, then the alarm if it matches
+ */
+static void Sim_minute(void *Arg)
+{
+    RTC_C_Calendar Now = MAP_RTC_C_getCalendarTime();
+    uint32_t Alarms = Stats.Alarms;
+    int i;
+
+    if (SimHal_minuteTickEnabled())
+    {
+        SMO_App_minuteTick();
+    }
+    if (SimHal_alarmMatches(&Now))
+    {
+        ++Stats.Alarms;
+        SMO_App_alarm();
+    }
+
+    //doses are sorted, so this is a short scan on the doses of this minute
+    for (i = 0; i < nDoses && Doses[i].Hour*60 + Doses[i].Min <= Now.hours*60 + Now.minutes; ++i)
+    {
+        if (Doses[i].Hour == Now.hours && Doses[i].Min == Now.minutes)
+        {
+            ++Stats.Due;
+            Stats.Unalerted += Stats.Alarms == Alarms;
+        }
+    }
+
+    Sim_at(Sim_now() + SIM_SECS_TO_TICKS(60), SIM_MINUTE, Sim_minute, NULL);
+}
+
+/*
+ * The app pushes the doses due after now, as many as a packet holds
+ */
+static void Sim_push(void *Arg)
+{
+    uint8_t Pkt[SMO_WIRE_SCHEDULE_SIZE(SMO_PACKET_MAX_MEDS)];
+    RTC_C_Calendar Now = MAP_RTC_C_getCalendarTime();
+    int Mins = Now.hours*60 + Now.minutes;
+    int First = 0, n, i;
+    uint8_t *Med;
+
+    while (First < nDoses && Doses[First].Hour*60 + Doses[First].Min <= Mins)
+    {
+        ++First;
+    }
+
+    n = nDoses < SMO_PACKET_MAX_MEDS ? nDoses : SMO_PACKET_MAX_MEDS;
+    memset(Pkt, 0, sizeof(Pkt));
+    Pkt[SMO_WIRE_TYPE] = SMO_PACKET_TYPE_HEADER;
+    Pkt[SMO_WIRE_NMEDS] = (uint8_t) n;
+    for (i = 0; i < n; ++i)
+    {
+        const Sim_Dose *Dose = &Doses[(First + i) % nDoses];
+
+        Med = &Pkt[SMO_WIRE_MEDS + i*SMO_WIRE_MED_SIZE];
+        Med[SMO_WIRE_MED_HOUR] = Dose->Hour;
+        Med[SMO_WIRE_MED_MIN] = Dose->Min;
+        Med[SMO_WIRE_MED_NPILLS] = 1 + Dose->Cmptmt % 3;
+        Med[SMO_WIRE_MED_CMPTMT] = Dose->Cmptmt;
+        Med[SMO_WIRE_MED_LENGTH] = (uint8_t) snprintf((char *) &Med[SMO_WIRE_MED_PAYLOAD],
+                                                      SMO_PACKET_MED_PAYLOAD_SIZE, "Med %c", 'A' + Dose->Cmptmt);
+    }
+
+    ++Stats.Packets;
+    if (SMO_App_handlePacket(Pkt, SMO_WIRE_SCHEDULE_SIZE(n)) < 0)
+    {
+        ++Stats.BadPackets;
+    }
+
+    Sim_at(Sim_now() + SIM_SECS_TO_TICKS(Opts.PushMins*60), SIM_PACKET, Sim_push, NULL);
+}
+
+static void Sim_housekeeping(void *Arg)
+{
+    SMO_Journal_flush((uint32_t) RTC_getTime(), false);
+    Sim_at(Sim_now() + SIM_SECS_TO_TICKS(SIM_HOUSEKEEPING_SECS), SIM_HOUSEKEEPING, Sim_housekeeping, NULL);
+}
+
+/*
+ * Spread the doses over the day, one compartment after another, so
+ * every packet has distinct compartments
+ */
+static void Sim_plan(void)
+{
+    int i, Min;
+
+    nDoses = 0;
+    for (i = 0; i < Opts.PerDay; ++i)
+    {
+        Min = (int) ((long) i*24*60 / Opts.PerDay);
+        Doses[nDoses++] = (Sim_Dose) { (uint8_t) (Min/60), (uint8_t) (Min%60), (uint8_t) (i % SMO_MAX_COMPARTMENTS) };
+    }
+}
+
+/*
+ * Count journal records that lost their event, as written when
+ * the event's fields were cleared while its alert was running
+ */
+static void Sim_checkJournal(void)
+{
+    static SMO_JournalRecord Records[64];
+    uint32_t Cursor = 0, First, Head;
+    int n, i;
+
+    do
+    {
+        n = SMO_Journal_read(Cursor, Records, 64, &First, &Head);
+        for (i = 0; i < n; ++i)
+        {
+            Stats.Orphans += Records[i].Epoch == 0 || Records[i].Compartments == 0;
+        }
+        Cursor = First + n;
+    } while (n > 0 && Cursor < Head);
+}
+
+static void Sim_report(double WallSecs)
+{
+    static const char *const Kinds[SIM_KIND_COUNT] = { "minute", "timer", "packet", "input", "housekeeping" };
+    static const char *const Outcomes[] = { "taken", "missed", "superseded", "snoozed" };
+    SMO_JournalRecord Record;
+    uint32_t First, Head;
+    SimHal_Stats Hal;
+    Sim_Cost Cost;
+    int i;
+
+    SimHal_getStats(&Hal);
+    SMO_Journal_read(0, &Record, 1, &First, &Head);
+
+    printf("simulated %d days, %d doses/day, %.3f s wall\n", Opts.Days, Opts.PerDay, WallSecs);
+    printf("doses due %u, alarms %u, events %u, never alerted %u\n",
+           Stats.Due, Stats.Alarms, Stats.Begun, Stats.Unalerted);
+    for (i = 0; i <= SMO_JOURNAL_SNOOZED; ++i)
+    {
+        printf("  %-11s %8u\n", Outcomes[i], Stats.Outcomes[i]);
+    }
+    printf("packets %u (%u rejected), presses %u, taps %u\n", Stats.Packets, Stats.BadPackets, Stats.Presses, Stats.Taps);
+    printf("journal cursors %u..%u on flash, %u writes, %u sector erases, %u orphaned records\n",
+           First, Head, Hal.NvsWrites, Hal.NvsErases, Stats.Orphans);
+    printf("alarms set %u, screen updates %u, speaker plays %u, LED writes %u, alert busy %.1f h\n",
+           Hal.AlarmsSet, Hal.ScreenUpdates, Hal.SpeakerPlays, Hal.LedWrites,
+           Hal.BusyTicks / (3600.0*TIMERWHEEL_TICKS_PER_SEC));
+
+    printf("%-13s %10s %10s %10s\n", "handler", "count", "mean us", "max us");
+    for (i = 0; i < SIM_KIND_COUNT; ++i)
+    {
+        Sim_getCost((Sim_Kind) i, &Cost);
+        printf("%-13s %10u %10.3f %10.3f\n", Kinds[i], Cost.Count,
+               Cost.Count ? Cost.TotalNs / 1000.0 / Cost.Count : 0.0, Cost.MaxNs / 1000.0);
+    }
+}
+
+static void Sim_usage(const char *Name)
+{
+    fprintf(stderr, "usage: %s [--days N] [--per-day N] [--push-every MINS] [--seed N]\n"
+                    "          [--ack P] [--snooze P] [--touch P] [-v]\n", Name);
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    struct timespec Start, End;
+    int i;
+
+    for (i = 1; i < argc; ++i)
+    {
+        const char *Arg = argv[i], *Val = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if (strcmp(Arg, "-v") == 0)
+        {
+            Opts.Verbose = true;
+            continue;
+        }
+        if (Val == NULL)
+        {
+            Sim_usage(argv[0]);
+        }
+        if (strcmp(Arg, "--days") == 0) Opts.Days = atoi(Val);
+        else if (strcmp(Arg, "--per-day") == 0) Opts.PerDay = atoi(Val);
+        else if (strcmp(Arg, "--push-every") == 0) Opts.PushMins = atoi(Val);
+        else if (strcmp(Arg, "--seed") == 0) Opts.Seed = (unsigned) strtoul(Val, NULL, 0);
+        else if (strcmp(Arg, "--ack") == 0) Opts.Ack = atof(Val);
+        else if (strcmp(Arg, "--snooze") == 0) Opts.Snooze = atof(Val);
+        else if (strcmp(Arg, "--touch") == 0) Opts.Touch = atof(Val);
+        else Sim_usage(argv[0]);
+        ++i;
+    }
+    if (Opts.Days <= 0 || Opts.PerDay <= 0 || Opts.PerDay > 24*60 || Opts.PushMins <= 0)
+    {
+        Sim_usage(argv[0]);
+    }
+    Rng = 0x9E3779B97F4A7C15ULL ^ Opts.Seed;
+
+    Sim_init(SIM_START, Sim_drain);
+    SimHal_init(Opts.Verbose);
+    Sim_plan();
+
+    SMO_App_init();
+    SMO_Alert_init(Sim_beginAlert, Sim_endAlert);
+    if (SMO_Journal_init() < 0)
+    {
+        fprintf(stderr, "journal init failed\n");
+        return 1;
+    }
+
+    //the RTC minute changes on the minute, the app connects straight away
+    Sim_at(SIM_SECS_TO_TICKS(60), SIM_MINUTE, Sim_minute, NULL);
+    Sim_at(SIM_SECS_TO_TICKS(1), SIM_PACKET, Sim_push, NULL);
+    Sim_at(SIM_SECS_TO_TICKS(SIM_HOUSEKEEPING_SECS), SIM_HOUSEKEEPING, Sim_housekeeping, NULL);
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    while (Sim_step(SIM_SECS_TO_TICKS((uint64_t) Opts.Days*24*60*60)));
+    SMO_Journal_flush((uint32_t) RTC_getTime(), true);
+    clock_gettime(CLOCK_MONOTONIC, &End);
+
+    Sim_checkJournal();
+    Sim_report((End.tv_sec - Start.tv_sec) + (End.tv_nsec - Start.tv_nsec) / 1e9);
+    return Stats.Unalerted == 0 && Stats.BadPackets == 0 && Stats.Orphans == 0 ? 0 : 1;
+}
@@ -0,0 +1,348 @@
+/************************************************************
+ * replay.c
+ *
+ * Feeds an input recording from the device (recorder.h)
+ * back into the event logic on the host, each input at the
+ * timer wheel tick it was recorded at. Virtual time starts
+ * at tick 0 like the timer wheel does at boot, so alerts,
+ * button deadlines and journal flushes fall on the same
+ * ticks as they did on the device. Packets go through the
+ * same type checks as the UDP server, RTC status through
+ * SMO_App_rtcInterrupt, button levels through the real
+ * gesture decoder, and the SNTP time sets the RTC.
+ *
+ * The report ends with a checksum of the adherence journal,
+ * so two runs, or two versions of the code, can be compared
+ * at a glance, and -v prints the full UART trace to diff.
+ *
+ * A recording file is "SMOR", the little endian cursor of
+ * the first record, then the records as the device exports
+ * them. tools/smorecord.py fetches one over UDP.
+ *
+ * Build and run from the repository root:
+ *   cc -O2 -std=c11 -D_DEFAULT_SOURCE -Ihost/include -I. \
+ *      host/sim.c host/hal_sim.c host/replay.c SMO.c smo_wire.c \
+ *      smo_app.c alert.c journal.c lock.c button.c recorder.c -lpthread -o smo_replay
+ *   ./smo_replay field.smor
+ *
+ ************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sim.h"
+#include "hal_sim.h"
+#include "smo_app.h"
+#include "SMO.h"
+#include "smo_wire.h"
+#include "alert.h"
+#include "button.h"
+#include "journal.h"
+#include "recorder.h"
+#include "rtc.h"
+
+#define REPLAY_MAGIC            "SMOR"
+#define REPLAY_HEADER_SIZE      8
+#define REPLAY_NTP_TO_UNIX      2208988800UL //seconds from 1900 to 1970
+#define REPLAY_TZ_OFFSET_SECS   18000 //TZ_EST_OFFSET_SECS in get_time.h
+#define REPLAY_SETTLE_SECS      (15*60) //run on after the last input so alerts can end
+
+static struct
+{
+    uint32_t Inputs[RECORDER_SNTP + 1]; //records replayed, by Recorder_type
+    uint32_t Requests; //journal, recording, load and profiler requests, not replayed
+    uint32_t Gestures[BUTTON_LONG_PRESS + 1];
+    uint32_t Begun;
+    uint32_t Outcomes[SMO_JOURNAL_SNOOZED + 1];
+
+} Stats;
+
+static struct
+{
+    const uint8_t *Buf; //records, after the file header
+    size_t Len;
+    size_t Offset; //next record to queue
+    uint64_t Tick; //its tick, unwrapped
+    uint32_t Last; //device tick of the record before it
+
+} Replay;
+
+static void Replay_packet(const uint8_t *Rec)
+{
+    const uint8_t *Pkt = &Rec[SMO_WIRE_REC_DATA];
+
+    //the UDP server answers these itself
+    switch (Pkt[SMO_WIRE_TYPE])
+    {
+    case SMO_PACKET_TYPE_JOURNAL:
+    case SMO_PACKET_TYPE_LOAD:
+    case SMO_PACKET_TYPE_RECORDING:
+    case SMO_PACKET_TYPE_PROFILE:
+        ++Stats.Requests;
+        break;
+    default:
+        SMO_App_handlePacket(Pkt, SMO_Wire_get16(&Rec[SMO_WIRE_REC_LENGTH]));
+        break;
+    }
+}
+
+static void Replay_queue(void);
+
+/*
+ * Apply one recorded input, then queue the next, so only one input
+ * is waiting in the simulator at a time
+ */
+static void Replay_input(void *Arg)
+{
+    const uint8_t *Rec = Arg;
+    uint8_t Type = Rec[SMO_WIRE_REC_TYPE];
+
+    ++Stats.Inputs[Type];
+    switch (Type)
+    {
+    case RECORDER_PACKET:
+        Replay_packet(Rec);
+        break;
+
+    case RECORDER_RTC:
+        SMO_App_rtcInterrupt(SMO_Wire_get32(&Rec[SMO_WIRE_REC_DATA]));
+        break;
+
+    case RECORDER_BUTTON:
+        Button_edge(Rec[SMO_WIRE_REC_DATA] != 0);
+        break;
+
+    case RECORDER_SNTP:
+    default:
+        //the host RTC counts from 1970, the device's from 1900
+        RTC_setTime((time_t) SMO_Wire_get32(&Rec[SMO_WIRE_REC_DATA]) - REPLAY_NTP_TO_UNIX - REPLAY_TZ_OFFSET_SECS);
+        break;
+    }
+
+    Replay_queue();
+}
+
+static void Replay_queue(void)
+{
+    static const Sim_Kind Kinds[RECORDER_SNTP + 1] = { SIM_PACKET, SIM_PACKET, SIM_MINUTE, SIM_INPUT, SIM_PACKET };
+    const uint8_t *Rec = &Replay.Buf[Replay.Offset];
+    uint32_t Tick;
+
+    if (Replay.Offset >= Replay.Len)
+    {
+        return;
+    }
+
+    //ticks are 32 bit on the device and wrap after 48 days
+    Tick = SMO_Wire_get32(&Rec[SMO_WIRE_REC_TICK]);
+    Replay.Tick += (uint32_t) (Tick - Replay.Last);
+    Replay.Last = Tick;
+    Replay.Offset += SMO_WIRE_REC_DATA + SMO_Wire_get16(&Rec[SMO_WIRE_REC_LENGTH]);
+
+    Sim_at(Replay.Tick, Kinds[Rec[SMO_WIRE_REC_TYPE]], Replay_input, (void *) Rec);
+}
+
+static bool Replay_drain(void)
+{
+    bool Busy = Button_process(false);
+
+    Busy |= SMO_Alert_process(false);
+    return Busy;
+}
+
+static void Replay_gesture(Button_Gesture Gesture, uint32_t PressTime)
+{
+    ++Stats.Gestures[Gesture];
+    SMO_App_handleGesture(Gesture, PressTime);
+}
+
+static int Replay_beginAlert(void)
+{
+    int Res = SMO_App_beginAlert();
+
+    Stats.Begun += Res >= 0;
+    return Res;
+}
+
+static void Replay_endAlert(uint8_t Outcome, uint32_t Time)
+{
+    if (Outcome <= SMO_JOURNAL_SNOOZED)
+    {
+        ++Stats.Outcomes[Outcome];
+    }
+    SMO_App_endAlert(Outcome, Time);
+}
+
+/*
+ * Check that the records are whole and of known types, and find the
+ * tick of the last one
+ */
+static bool Replay_check(const uint8_t *Buf, size_t Len, uint64_t *LastTick)
+{
+    size_t Offset = 0, Size;
+    uint64_t Tick;
+    uint32_t Last;
+    uint8_t Type;
+
+    if (Len < SMO_WIRE_REC_DATA)
+    {
+        fprintf(stderr, "no inputs to replay\n");
+        return false;
+    }
+
+    Last = SMO_Wire_get32(&Buf[SMO_WIRE_REC_TICK]);
+    Tick = Last;
+    while (Offset + SMO_WIRE_REC_DATA <= Len)
+    {
+        Type = Buf[Offset + SMO_WIRE_REC_TYPE];
+        Size = SMO_WIRE_REC_DATA + SMO_Wire_get16(&Buf[Offset + SMO_WIRE_REC_LENGTH]);
+        if (Type < RECORDER_PACKET || Type > RECORDER_SNTP || Offset + Size > Len)
+        {
+            break;
+        }
+        Tick += (uint32_t) (SMO_Wire_get32(&Buf[Offset + SMO_WIRE_REC_TICK]) - Last);
+        Last = SMO_Wire_get32(&Buf[Offset + SMO_WIRE_REC_TICK]);
+        Offset += Size;
+    }
+
+    if (Offset != Len)
+    {
+        fprintf(stderr, "bad record at byte %zu\n", Offset);
+        return false;
+    }
+    *LastTick = Tick;
+    return true;
+}
+
+/*
+ * FNV-1a over every journal record, the outcome of the run
+ */
+static uint32_t Replay_journalHash(uint32_t *nRecords)
+{
+    SMO_JournalRecord Records[32];
+    uint32_t Hash = 2166136261u, Cursor = 0, First, Head;
+    const uint8_t *Bytes;
+    int n, i;
+
+    *nRecords = 0;
+    while ((n = SMO_Journal_read(Cursor, Records, 32, &First, &Head)) > 0)
+    {
+        Bytes = (const uint8_t *) Records;
+        for (i = 0; i < n*(int) sizeof(SMO_JournalRecord); ++i)
+        {
+            Hash = (Hash ^ Bytes[i])*16777619u;
+        }
+        *nRecords += n;
+        Cursor = First + n;
+    }
+    return Hash;
+}
+
+int main(int argc, char **argv)
+{
+    static const char *const Outcomes[] = { "taken", "missed", "superseded", "snoozed" };
+    static const char *const Kinds[SIM_KIND_COUNT] = { "rtc", "timer", "packet", "input", "housekeeping" };
+    const char *Path = NULL;
+    bool Verbose = false;
+    struct timespec Start, End;
+    uint8_t *Buf;
+    long Len;
+    uint64_t LastTick;
+    uint32_t nRecords, Hash;
+    Sim_Cost Cost;
+    FILE *File;
+    int i;
+
+    for (i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-v") == 0)
+        {
+            Verbose = true;
+        }
+        else
+        {
+            Path = argv[i];
+        }
+    }
+    if (Path == NULL)
+    {
+        fprintf(stderr, "usage: %s [-v] recording.smor\n", argv[0]);
+        return 2;
+    }
+
+    File = fopen(Path, "rb");
+    if (File == NULL || fseek(File, 0, SEEK_END) != 0 || (Len = ftell(File)) < REPLAY_HEADER_SIZE)
+    {
+        fprintf(stderr, "%s: not a recording\n", Path);
+        return 1;
+    }
+    Buf = malloc(Len);
+    rewind(File);
+    if (Buf == NULL || fread(Buf, 1, Len, File) != (size_t) Len || memcmp(Buf, REPLAY_MAGIC, 4) != 0)
+    {
+        fprintf(stderr, "%s: not a recording\n", Path);
+        return 1;
+    }
+    fclose(File);
+
+    //the ring overwrites its oldest records, so a late export misses the boot
+    if (SMO_Wire_get32(&Buf[4]) != 0)
+    {
+        fprintf(stderr, "%s: recording starts at cursor %u, inputs before it are lost\n",
+                Path, SMO_Wire_get32(&Buf[4]));
+    }
+
+    Sim_init(0, Replay_drain);
+    SimHal_init(Verbose);
+    SMO_App_init();
+    SMO_Alert_init(Replay_beginAlert, Replay_endAlert);
+    Button_init(Replay_gesture);
+    if (SMO_Journal_init() < 0)
+    {
+        fprintf(stderr, "journal init failed\n");
+        return 1;
+    }
+
+    Replay.Buf = &Buf[REPLAY_HEADER_SIZE];
+    Replay.Len = Len - REPLAY_HEADER_SIZE;
+    if (!Replay_check(Replay.Buf, Replay.Len, &LastTick))
+    {
+        return 1;
+    }
+    Replay.Last = SMO_Wire_get32(&Replay.Buf[SMO_WIRE_REC_TICK]);
+    Replay.Tick = Replay.Last;
+    Replay_queue();
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    while (Sim_step(LastTick + SIM_SECS_TO_TICKS(REPLAY_SETTLE_SECS)));
+    SMO_Journal_flush((uint32_t) RTC_getTime(), true);
+    clock_gettime(CLOCK_MONOTONIC, &End);
+
+    Hash = Replay_journalHash(&nRecords);
+    printf("replayed %.1f s of inputs in %.3f s\n", (double) LastTick / TIMERWHEEL_TICKS_PER_SEC,
+           (End.tv_sec - Start.tv_sec) + (End.tv_nsec - Start.tv_nsec) / 1e9);
+    printf("packets %u (%u requests), rtc %u, button edges %u, sntp %u\n",
+           Stats.Inputs[RECORDER_PACKET], Stats.Requests, Stats.Inputs[RECORDER_RTC],
+           Stats.Inputs[RECORDER_BUTTON], Stats.Inputs[RECORDER_SNTP]);
+    printf("clicks %u, double presses %u, long presses %u, events %u\n",
+           Stats.Gestures[BUTTON_CLICK], Stats.Gestures[BUTTON_DOUBLE_PRESS],
+           Stats.Gestures[BUTTON_LONG_PRESS], Stats.Begun);
+    for (i = 0; i <= SMO_JOURNAL_SNOOZED; ++i)
+    {
+        printf("  %-11s %8u\n", Outcomes[i], Stats.Outcomes[i]);
+    }
+    printf("journal %u records, checksum %08x\n", nRecords, Hash);
+
+    printf("%-13s %10s %10s %10s\n", "handler", "count", "mean us", "max us");
+    for (i = 0; i < SIM_KIND_COUNT; ++i)
+    {
+        Sim_getCost((Sim_Kind) i, &Cost);
+        printf("%-13s %10u %10.3f %10.3f\n", Kinds[i], Cost.Count,
+               Cost.Count ? Cost.TotalNs / 1000.0 / Cost.Count : 0.0, Cost.MaxNs / 1000.0);
+    }
+
+    free(Buf);
+    return 0;
+}
@@ -0,0 +1,164 @@
+#include <string.h>
+#include <time.h>
+
+#include "sim.h"
+#include "timer_wheel.h"
+
+typedef struct Sim_Event
+{
+    uint64_t Tick;
+    uint64_t Seq; //keeps events at the same tick in the order they were queued
+    Sim_Handler Handler;
+    void *Arg;
+    Sim_Kind Kind;
+
+} Sim_Event;
+
+static struct
+{
+    Sim_Event Heap[SIM_MAX_EVENTS]; //binary min-heap on Tick then Seq
+    int Size;
+    uint64_t Seq;
+    uint64_t Now;
+    time_t Start;
+    Sim_Drain Drain;
+    Sim_Cost Costs[SIM_KIND_COUNT];
+
+} Sim;
+
+static bool Sim_before(const Sim_Event *A, const Sim_Event *B)
+{
+    return A->Tick != B->Tick ? A->Tick < B->Tick : A->Seq < B->Seq;
+}
+
+static void Sim_siftUp(int i)
+{
+    Sim_Event Event = Sim.Heap[i];
+
+    while (i > 0 && Sim_before(&Event, &Sim.Heap[(i - 1)/2]))
+    {
+        Sim.Heap[i] = Sim.Heap[(i - 1)/2];
+        i = (i - 1)/2;
+    }
+    Sim.Heap[i] = Event;
+}
+
+static void Sim_siftDown(int i)
+{
+    Sim_Event Event = Sim.Heap[i];
+    int Child;
+
+    while ((Child = 2*i + 1) < Sim.Size)
+    {
+        if (Child + 1 < Sim.Size && Sim_before(&Sim.Heap[Child + 1], &Sim.Heap[Child]))
+        {
+            ++Child;
+        }
+        if (!Sim_before(&Sim.Heap[Child], &Event))
+        {
+            break;
+        }
+        Sim.Heap[i] = Sim.Heap[Child];
+        i = Child;
+    }
+    Sim.Heap[i] = Event;
+}
+
+static void Sim_remove(int i)
+{
+    Sim.Heap[i] = Sim.Heap[--Sim.Size];
+    if (i < Sim.Size)
+    {
+        Sim_siftDown(i);
+        Sim_siftUp(i);
+    }
+}
+
+static uint64_t Sim_ns(void)
+{
+    struct timespec Ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    return (uint64_t) Ts.tv_sec*1000000000ULL + (uint64_t) Ts.tv_nsec;
+}
+
+void Sim_init(time_t Start, Sim_Drain Drain)
+{
+    memset(&Sim, 0, sizeof(Sim));
+    Sim.Start = Start;
+    Sim.Drain = Drain;
+}
+
+bool Sim_at(uint64_t Tick, Sim_Kind Kind, Sim_Handler Handler, void *Arg)
+{
+    if (Sim.Size == SIM_MAX_EVENTS)
+    {
+        return false;
+    }
+
+    //nothing runs in the past, late events run now
+    Sim.Heap[Sim.Size] = (Sim_Event) { Tick < Sim.Now ? Sim.Now : Tick, Sim.Seq++, Handler, Arg, Kind };
+    Sim_siftUp(Sim.Size++);
+    return true;
+}
+
+void Sim_cancel(Sim_Handler Handler, void *Arg)
+{
+    int i = 0;
+
+    while (i < Sim.Size)
+    {
+        if (Sim.Heap[i].Handler == Handler && Sim.Heap[i].Arg == Arg)
+        {
+            //the last event moves into this slot, so look at it again
+            Sim_remove(i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+bool Sim_step(uint64_t Until)
+{
+    Sim_Event Event;
+    Sim_Cost *Cost;
+    uint64_t Start, Elapsed;
+
+    if (Sim.Size == 0 || Sim.Heap[0].Tick >= Until)
+    {
+        return false;
+    }
+
+    Event = Sim.Heap[0];
+    Sim_remove(0);
+    Sim.Now = Event.Tick;
+
+    Start = Sim_ns();
+    Event.Handler(Event.Arg);
+    //threads get the CPU as soon as the poster returns
+    while (Sim.Drain != NULL && Sim.Drain());
+    Elapsed = Sim_ns() - Start;
+
+    Cost = &Sim.Costs[Event.Kind];
+    ++Cost->Count;
+    Cost->TotalNs += Elapsed;
+    Cost->MaxNs = Elapsed > Cost->MaxNs ? Elapsed : Cost->MaxNs;
+    return true;
+}
+
+uint64_t Sim_now(void)
+{
+    return Sim.Now;
+}
+
+time_t Sim_time(void)
+{
+    return Sim.Start + (time_t) (Sim.Now/TIMERWHEEL_TICKS_PER_SEC);
+}
+
+void Sim_getCost(Sim_Kind Kind, Sim_Cost *Cost)
+{
+    *Cost = Sim.Costs[Kind];
+}
@@ -0,0 +1,59 @@
+/************************************************************
+ * sim.h
+ *
+ * Discrete-event scheduler for the host simulator. Virtual
+ * time is counted in timer wheel ticks from the start of
+ * the run and only moves when the next queued event is
+ * taken, so a year of schedules runs in well under a
+ * second. Handlers stand in for interrupts, and the queues
+ * of the simulated threads are drained after each one, as
+ * those threads would run as soon as the poster returns.
+ * The time spent in each kind of handler is measured for
+ * the report.
+ *
+ ************************************************************/
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "timer_wheel.h"
+
+#define SIM_MAX_EVENTS  256 //queued events, the run keeps a handful
+
+#define SIM_SECS_TO_TICKS(Secs)     ((uint64_t) (Secs)*TIMERWHEEL_TICKS_PER_SEC)
+
+typedef void (*Sim_Handler)(void *Arg);
+typedef bool (*Sim_Drain)(void); //runs a thread's queued work, false once it is idle
+
+typedef enum Sim_Kind
+{
+    SIM_MINUTE = 0, //RTC minute tick and alarm match
+    SIM_TIMER = 1, //timer wheel expiry
+    SIM_PACKET = 2, //schedule packet from the app
+    SIM_INPUT = 3, //button gesture or screen touch
+    SIM_HOUSEKEEPING = 4, //main loop housekeeping
+    SIM_KIND_COUNT
+
+} Sim_Kind;
+
+typedef struct Sim_Cost
+{
+    uint32_t Count; //handlers run
+    uint64_t TotalNs; //including the alert mailbox drain
+    uint64_t MaxNs;
+
+} Sim_Cost;
+
+void Sim_init(time_t Start, Sim_Drain Drain);
+bool Sim_at(uint64_t Tick, Sim_Kind Kind, Sim_Handler Handler, void *Arg);
+void Sim_cancel(Sim_Handler Handler, void *Arg); //drops every queued event with this handler and arg
+bool Sim_step(uint64_t Until); //runs the next event before Until, false if there is none
+uint64_t Sim_now(void); //ticks since the start of the run
+time_t Sim_time(void); //Unix seconds
+void Sim_getCost(Sim_Kind Kind, Sim_Cost *Cost);
+
+#endif
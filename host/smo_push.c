@@ -0,0 +1,229 @@
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "smo_push.h"
+
+struct SMO_PushPool
+{
+    pthread_t Threads[SMO_PUSH_MAX_THREADS];
+    int nThreads; //pool threads, not counting the caller
+    pthread_mutex_t Lock;
+    pthread_cond_t Start; //a batch is ready or the pool is stopping
+    pthread_cond_t Done; //every pool thread left the batch
+    uint64_t Batch; //bumped for every batch
+    int Busy; //pool threads still on the batch
+    bool Stop;
+
+    //the current batch
+    SMO_PushJob *Jobs;
+    size_t nJobs;
+    const Aes_Key *Key;
+    atomic_size_t Next; //first job not yet taken
+    atomic_size_t Built;
+};
+
+/*
+ * Lay out a schedule packet and pad it to whole AES blocks
+ */
+int SMO_Push_encode(const SMO_WireMed *Meds, uint8_t nMeds, uint8_t *Pkt)
+{
+    SMO_WireMed Check;
+    uint8_t *Rec;
+    int Len, i;
+
+    if (nMeds == 0 || nMeds > SMO_PACKET_MAX_MEDS)
+    {
+        return -EINVAL;
+    }
+
+    Pkt[SMO_WIRE_TYPE] = SMO_PACKET_TYPE_HEADER;
+    Pkt[SMO_WIRE_NMEDS] = nMeds;
+    for (i = 0; i < nMeds; ++i)
+    {
+        if (Meds[i].Length > SMO_PACKET_MED_PAYLOAD_SIZE)
+        {
+            return -EINVAL;
+        }
+
+        Rec = &Pkt[SMO_WIRE_MEDS + i*SMO_WIRE_MED_SIZE];
+        Rec[SMO_WIRE_MED_HOUR] = Meds[i].Hour;
+        Rec[SMO_WIRE_MED_MIN] = Meds[i].Min;
+        Rec[SMO_WIRE_MED_NPILLS] = Meds[i].nPills;
+        Rec[SMO_WIRE_MED_CMPTMT] = Meds[i].Cmptmt;
+        Rec[SMO_WIRE_MED_LENGTH] = Meds[i].Length;
+        memcpy(&Rec[SMO_WIRE_MED_PAYLOAD], Meds[i].Payload, Meds[i].Length);
+        memset(&Rec[SMO_WIRE_MED_PAYLOAD + Meds[i].Length], 0, SMO_PACKET_MED_PAYLOAD_SIZE - Meds[i].Length);
+
+        //the firmware's own range checks
+        if (SMO_Wire_med(Pkt, i, &Check) < 0)
+        {
+            return -EINVAL;
+        }
+    }
+
+    Len = SMO_WIRE_SCHEDULE_SIZE(nMeds);
+    memset(&Pkt[Len], 0, (AES_BLOCK_SIZE - Len % AES_BLOCK_SIZE) % AES_BLOCK_SIZE);
+    return Len + (AES_BLOCK_SIZE - Len % AES_BLOCK_SIZE) % AES_BLOCK_SIZE;
+}
+
+int SMO_Push_build(const Aes_Key *Key, const SMO_WireMed *Meds, uint8_t nMeds, uint8_t *Pkt)
+{
+    int Len = SMO_Push_encode(Meds, nMeds, Pkt);
+
+    if (Len > 0)
+    {
+        Aes_encryptEcb(Key, Pkt, Len);
+    }
+    return Len;
+}
+
+/*
+ * Build chunks of the current batch until none are left
+ */
+static void SMO_Push_work(SMO_PushPool *Pool)
+{
+    SMO_PushJob *Job;
+    size_t First, Last, Built;
+
+    while ((First = atomic_fetch_add(&Pool->Next, SMO_PUSH_CHUNK)) < Pool->nJobs)
+    {
+        Last = First + SMO_PUSH_CHUNK < Pool->nJobs ? First + SMO_PUSH_CHUNK : Pool->nJobs;
+        Built = 0;
+        for (Job = &Pool->Jobs[First]; Job < &Pool->Jobs[Last]; ++Job)
+        {
+            Job->Len = SMO_Push_build(Job->Key != NULL ? Job->Key : Pool->Key, Job->Meds, Job->nMeds, Job->Pkt);
+            Built += Job->Len > 0;
+        }
+        atomic_fetch_add(&Pool->Built, Built);
+    }
+}
+
+static void *SMO_Push_threadProc(void *Arg)
+{
+    SMO_PushPool *Pool = Arg;
+    uint64_t Seen = 0;
+
+    pthread_mutex_lock(&Pool->Lock);
+    while (1)
+    {
+        while (!Pool->Stop && Pool->Batch == Seen)
+        {
+            pthread_cond_wait(&Pool->Start, &Pool->Lock);
+        }
+        if (Pool->Stop)
+        {
+            break;
+        }
+        Seen = Pool->Batch;
+        pthread_mutex_unlock(&Pool->Lock);
+
+        SMO_Push_work(Pool);
+
+        pthread_mutex_lock(&Pool->Lock);
+        if (--Pool->Busy == 0)
+        {
+            pthread_cond_signal(&Pool->Done);
+        }
+    }
+    pthread_mutex_unlock(&Pool->Lock);
+    return NULL;
+}
+
+SMO_PushPool *SMO_Push_createPool(int nThreads)
+{
+    SMO_PushPool *Pool;
+
+    if (nThreads <= 0)
+    {
+        nThreads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    nThreads = nThreads < 1 ? 1 : nThreads > SMO_PUSH_MAX_THREADS ? SMO_PUSH_MAX_THREADS : nThreads;
+
+    Pool = calloc(1, sizeof(*Pool));
+    if (Pool == NULL)
+    {
+        return NULL;
+    }
+    pthread_mutex_init(&Pool->Lock, NULL);
+    pthread_cond_init(&Pool->Start, NULL);
+    pthread_cond_init(&Pool->Done, NULL);
+
+    //the thread calling SMO_Push_batch is the last worker
+    for (Pool->nThreads = 0; Pool->nThreads < nThreads - 1; ++Pool->nThreads)
+    {
+        if (pthread_create(&Pool->Threads[Pool->nThreads], NULL, SMO_Push_threadProc, Pool) != 0)
+        {
+            SMO_Push_destroyPool(Pool);
+            return NULL;
+        }
+    }
+    return Pool;
+}
+
+void SMO_Push_destroyPool(SMO_PushPool *Pool)
+{
+    int i;
+
+    if (Pool == NULL)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&Pool->Lock);
+    Pool->Stop = true;
+    pthread_cond_broadcast(&Pool->Start);
+    pthread_mutex_unlock(&Pool->Lock);
+    for (i = 0; i < Pool->nThreads; ++i)
+    {
+        pthread_join(Pool->Threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&Pool->Done);
+    pthread_cond_destroy(&Pool->Start);
+    pthread_mutex_destroy(&Pool->Lock);
+    free(Pool);
+}
+
+int SMO_Push_threads(const SMO_PushPool *Pool)
+{
+    return Pool->nThreads + 1;
+}
+
+/*
+ * Encode and encrypt every job, returns how many were built. Jobs
+ * with a bad schedule get Len -EINVAL and the rest are still built.
+ */
+size_t SMO_Push_batch(SMO_PushPool *Pool, const Aes_Key *Key, SMO_PushJob *Jobs, size_t nJobs)
+{
+    pthread_mutex_lock(&Pool->Lock);
+    Pool->Jobs = Jobs;
+    Pool->nJobs = nJobs;
+    Pool->Key = Key;
+    atomic_store(&Pool->Next, 0);
+    atomic_store(&Pool->Built, 0);
+
+    //small batches are not worth waking the pool
+    Pool->Busy = nJobs > SMO_PUSH_CHUNK ? Pool->nThreads : 0;
+    if (Pool->Busy > 0)
+    {
+        Pool->Batch++;
+        pthread_cond_broadcast(&Pool->Start);
+    }
+    pthread_mutex_unlock(&Pool->Lock);
+
+    SMO_Push_work(Pool);
+
+    pthread_mutex_lock(&Pool->Lock);
+    while (Pool->Busy > 0)
+    {
+        pthread_cond_wait(&Pool->Done, &Pool->Lock);
+    }
+    pthread_mutex_unlock(&Pool->Lock);
+
+    return atomic_load(&Pool->Built);
+}
@@ -0,0 +1,54 @@
+/************************************************************
+ * smo_push.h
+ *
+ * Builds encrypted schedule packets for a backend that pushes
+ * schedules to many organisers. Packets are laid out at the
+ * smo_wire.h offsets the firmware decodes, and every med is
+ * checked with SMO_Wire_med, so a packet built here is one
+ * the device accepts. Packets are encrypted with the widest
+ * AES engine the CPU has (aes.h).
+ *
+ * SMO_Push_batch builds a whole fleet's packets at once on a
+ * pool of threads. Jobs are handed out a chunk at a time, so
+ * threads stay busy however the schedule sizes vary, and the
+ * calling thread works through the batch too.
+ *
+ ************************************************************/
+
+#ifndef SMO_PUSH_H
+#define SMO_PUSH_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "aes.h"
+#include "SMO.h"
+#include "smo_wire.h"
+
+//largest schedule, padded to whole AES blocks
+#define SMO_PUSH_PACKET_MAX     ((SMO_WIRE_SCHEDULE_SIZE(SMO_PACKET_MAX_MEDS) + AES_BLOCK_SIZE - 1) \
+                                 / AES_BLOCK_SIZE * AES_BLOCK_SIZE)
+#define SMO_PUSH_CHUNK          64 //jobs a pool thread takes at a time
+#define SMO_PUSH_MAX_THREADS    64
+
+typedef struct SMO_PushJob
+{
+    const SMO_WireMed *Meds; //schedule for one device
+    uint8_t nMeds;
+    const Aes_Key *Key; //device's key, NULL for the batch key
+    int Len; //bytes to send, or -EINVAL for a bad schedule
+    uint8_t Pkt[SMO_PUSH_PACKET_MAX]; //encrypted packet
+
+} SMO_PushJob;
+
+typedef struct SMO_PushPool SMO_PushPool;
+
+int SMO_Push_encode(const SMO_WireMed *Meds, uint8_t nMeds, uint8_t *Pkt); //padded length, or -EINVAL
+int SMO_Push_build(const Aes_Key *Key, const SMO_WireMed *Meds, uint8_t nMeds, uint8_t *Pkt); //encode and encrypt
+
+SMO_PushPool *SMO_Push_createPool(int nThreads); //0 for one thread per CPU
+void SMO_Push_destroyPool(SMO_PushPool *Pool);
+int SMO_Push_threads(const SMO_PushPool *Pool); //calling thread included
+size_t SMO_Push_batch(SMO_PushPool *Pool, const Aes_Key *Key, SMO_PushJob *Jobs, size_t nJobs); //jobs built
+
+#endif
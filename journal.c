@@ -0,0 +1,346 @@
+#include <string.h>
+#include <errno.h>
+
+#include <ti/drivers/NVS.h>
+#include <ti/sysbios/hal/Hwi.h>
+
+#include "journal.h"
+#include "lock.h"
+#include "Board.h"
+#include "uart_term.h"
+
+#define SMO_JOURNAL_MAX_SECTORS     4
+#define SMO_JOURNAL_NO_SECTOR       0xFFFFFFFF
+#define SMO_JOURNAL_RING_MASK       (SMO_JOURNAL_RING_SIZE - 1)
+
+typedef struct SMO_JournalHeader
+{
+    uint32_t Magic; //SMO_JOURNAL_MAGIC when the sector is in use
+    uint32_t BaseSeq; //sequence number of the first record in the sector
+
+} SMO_JournalHeader;
+
+typedef struct SMO_Journal
+{
+    NVS_Handle Nvs;
+    Lock_Mutex Mutex; //serializes flash access between flush and read
+    uint32_t SectorSize;
+    uint32_t nSectors;
+    uint32_t RecordsPerSector;
+    uint32_t SectorBase[SMO_JOURNAL_MAX_SECTORS]; //base sequence of each sector
+    uint32_t HeadSector; //sector currently being filled
+    volatile uint32_t FlashSeq; //sequence number of the next record written to flash
+
+    SMO_JournalRecord Ring[SMO_JOURNAL_RING_SIZE];
+    volatile uint32_t RingSeq; //sequence number of the next record appended
+    volatile uint32_t Overruns; //records dropped because the ring was full
+
+} SMO_Journal;
+
+static SMO_Journal Journal;
+
+static int SMO_Journal_openSector(uint32_t Sector, uint32_t BaseSeq);
+static uint32_t SMO_Journal_countRecords(uint32_t Sector);
+static uint32_t SMO_Journal_oldestSeq(void);
+static uint32_t SMO_Journal_findSector(uint32_t Seq);
+static uint32_t SMO_Journal_offset(uint32_t Sector, uint32_t Seq);
+
+static int SMO_Journal_openSector(uint32_t Sector, uint32_t BaseSeq)
+{
+    int Res = 0;
+    SMO_JournalHeader Header;
+
+    Journal.SectorBase[Sector] = SMO_JOURNAL_NO_SECTOR;
+    if (NVS_erase(Journal.Nvs, Sector*Journal.SectorSize, Journal.SectorSize) != NVS_STATUS_SUCCESS)
+    {
+        UART_PRINT("Error erasing journal sector %d\r\n", Sector);
+        Res = -EIO;
+        goto Error;
+    }
+
+    Header.Magic = SMO_JOURNAL_MAGIC;
+    Header.BaseSeq = BaseSeq;
+    if (NVS_write(Journal.Nvs, Sector*Journal.SectorSize, &Header, sizeof(Header),
+                  NVS_WRITE_POST_VERIFY) != NVS_STATUS_SUCCESS)
+    {
+        UART_PRINT("Error writing journal sector %d\r\n", Sector);
+        Res = -EIO;
+        goto Error;
+    }
+    Journal.SectorBase[Sector] = BaseSeq;
+
+Error:
+    return Res;
+}
+
+static uint32_t SMO_Journal_countRecords(uint32_t Sector)
+{
+    SMO_JournalRecord Record;
+    uint32_t Low = 0, High = Journal.RecordsPerSector, Mid;
+
+    //records are written in order, so binary search for the first erased slot
+    while (Low < High)
+    {
+        Mid = (Low + High) / 2;
+        NVS_read(Journal.Nvs, SMO_Journal_offset(Sector, Journal.SectorBase[Sector] + Mid),
+                 &Record, sizeof(Record));
+        if (Record.Epoch == 0xFFFFFFFF)
+        {
+            High = Mid;
+        }
+        else
+        {
+            Low = Mid + 1;
+        }
+    }
+
+    return Low;
+}
+
+static uint32_t SMO_Journal_oldestSeq(void)
+{
+    uint32_t Oldest = Journal.FlashSeq;
+    uint32_t i;
+
+    for (i = 0; i < Journal.nSectors; ++i)
+    {
+        if (Journal.SectorBase[i] != SMO_JOURNAL_NO_SECTOR && Journal.SectorBase[i] < Oldest)
+        {
+            Oldest = Journal.SectorBase[i];
+        }
+    }
+
+    return Oldest;
+}
+
+static uint32_t SMO_Journal_findSector(uint32_t Seq)
+{
+    uint32_t i;
+
+    for (i = 0; i < Journal.nSectors; ++i)
+    {
+        if (Journal.SectorBase[i] != SMO_JOURNAL_NO_SECTOR
+            && Seq >= Journal.SectorBase[i]
+            && Seq - Journal.SectorBase[i] < Journal.RecordsPerSector)
+        {
+            return i;
+        }
+    }
+
+    return SMO_JOURNAL_NO_SECTOR;
+}
+
+static uint32_t SMO_Journal_offset(uint32_t Sector, uint32_t Seq)
+{
+    return Sector*Journal.SectorSize + SMO_JOURNAL_HEADER_SIZE
+           + (Seq - Journal.SectorBase[Sector])*sizeof(SMO_JournalRecord);
+}
+
+int SMO_Journal_init(void)
+{
+    int Res = 0;
+    NVS_Params Params;
+    NVS_Attrs Attrs;
+    SMO_JournalHeader Header;
+    uint32_t i, Count = 0;
+
+    memset(&Journal, 0, sizeof(Journal));
+    Lock_init(&Journal.Mutex, "journal", LOCK_RANK_JOURNAL);
+
+    NVS_init();
+    NVS_Params_init(&Params);
+    Journal.Nvs = NVS_open(Board_NVS0, &Params);
+    if (Journal.Nvs == NULL)
+    {
+        UART_PRINT("Error opening journal flash\r\n");
+        Res = -ENODEV;
+        goto Error;
+    }
+
+    NVS_getAttrs(Journal.Nvs, &Attrs);
+    Journal.SectorSize = Attrs.sectorSize;
+    Journal.nSectors = Attrs.regionSize / Attrs.sectorSize;
+    if (Journal.nSectors > SMO_JOURNAL_MAX_SECTORS)
+    {
+        Journal.nSectors = SMO_JOURNAL_MAX_SECTORS;
+    }
+    Journal.RecordsPerSector = (Journal.SectorSize - SMO_JOURNAL_HEADER_SIZE) / sizeof(SMO_JournalRecord);
+
+    //the sector with the highest base sequence holds the newest records
+    Journal.HeadSector = SMO_JOURNAL_NO_SECTOR;
+    for (i = 0; i < Journal.nSectors; ++i)
+    {
+        Journal.SectorBase[i] = SMO_JOURNAL_NO_SECTOR;
+        if (NVS_read(Journal.Nvs, i*Journal.SectorSize, &Header, sizeof(Header)) == NVS_STATUS_SUCCESS
+            && Header.Magic == SMO_JOURNAL_MAGIC)
+        {
+            Journal.SectorBase[i] = Header.BaseSeq;
+            if (Journal.HeadSector == SMO_JOURNAL_NO_SECTOR
+                || Header.BaseSeq > Journal.SectorBase[Journal.HeadSector])
+            {
+                Journal.HeadSector = i;
+            }
+        }
+    }
+
+    if (Journal.HeadSector == SMO_JOURNAL_NO_SECTOR)
+    {
+        UART_PRINT("Formatting journal flash\r\n");
+        Res = SMO_Journal_openSector(0, 0);
+        if (Res < 0)
+        {
+            goto Error;
+        }
+        Journal.HeadSector = 0;
+    }
+    else
+    {
+        Count = SMO_Journal_countRecords(Journal.HeadSector);
+    }
+
+    Journal.FlashSeq = Journal.SectorBase[Journal.HeadSector] + Count;
+    Journal.RingSeq = Journal.FlashSeq;
+    UART_PRINT("Journal holds records %d to %d\r\n", SMO_Journal_oldestSeq(), Journal.FlashSeq);
+
+Error:
+    return Res;
+}
+
+void SMO_Journal_append(uint32_t Epoch, uint8_t Compartments, uint8_t Outcome, uint16_t Latency)
+{
+    SMO_JournalRecord *Record;
+    UInt Key;
+
+    //may be called from interrupts, the ring is only touched with them disabled
+    Key = Hwi_disable();
+    if (Journal.RingSeq - Journal.FlashSeq >= SMO_JOURNAL_RING_SIZE)
+    {
+        Journal.Overruns++;
+    }
+    else
+    {
+        Record = &Journal.Ring[Journal.RingSeq & SMO_JOURNAL_RING_MASK];
+        Record->Epoch = Epoch;
+        Record->Compartments = Compartments;
+        Record->Outcome = Outcome;
+        Record->Latency = Latency;
+        Journal.RingSeq++;
+    }
+    Hwi_restore(Key);
+}
+
+int SMO_Journal_flush(uint32_t Now, bool Force)
+{
+    int Res = 0;
+    uint32_t End, Room, Next, Run, Index;
+    SMO_JournalRecord *Oldest;
+
+    if (Journal.Nvs == NULL)
+    {
+        Res = -ENODEV;
+        goto Error;
+    }
+
+    Lock_acquire(&Journal.Mutex);
+
+    End = Journal.RingSeq;
+    Oldest = &Journal.Ring[Journal.FlashSeq & SMO_JOURNAL_RING_MASK];
+    if (End == Journal.FlashSeq
+        || (!Force && End - Journal.FlashSeq < SMO_JOURNAL_FLUSH_BATCH
+            && Now - Oldest->Epoch < SMO_JOURNAL_FLUSH_MAX_AGE_SECS))
+    {
+        goto Unlock;
+    }
+
+    while (Journal.FlashSeq != End)
+    {
+        Room = Journal.RecordsPerSector - (Journal.FlashSeq - Journal.SectorBase[Journal.HeadSector]);
+        if (Room == 0)
+        {
+            //head sector is full, recycle the oldest sector
+            Next = (Journal.HeadSector + 1) % Journal.nSectors;
+            Res = SMO_Journal_openSector(Next, Journal.FlashSeq);
+            if (Res < 0)
+            {
+                goto Unlock;
+            }
+            Journal.HeadSector = Next;
+            Room = Journal.RecordsPerSector;
+        }
+
+        //write the longest run that is contiguous in both the ring and the sector
+        Index = Journal.FlashSeq & SMO_JOURNAL_RING_MASK;
+        Run = End - Journal.FlashSeq;
+        Run = Run > Room ? Room : Run;
+        Run = Run > SMO_JOURNAL_RING_SIZE - Index ? SMO_JOURNAL_RING_SIZE - Index : Run;
+
+        if (NVS_write(Journal.Nvs, SMO_Journal_offset(Journal.HeadSector, Journal.FlashSeq),
+                      &Journal.Ring[Index], Run*sizeof(SMO_JournalRecord),
+                      NVS_WRITE_POST_VERIFY) != NVS_STATUS_SUCCESS)
+        {
+            UART_PRINT("Error writing journal records\r\n");
+            Res = -EIO;
+            goto Unlock;
+        }
+        Journal.FlashSeq += Run;
+    }
+
+Unlock:
+    Lock_release(&Journal.Mutex);
+Error:
+    return Res;
+}
+
+int SMO_Journal_read(uint32_t Cursor, SMO_JournalRecord *Records, int MaxRecords,
+                     uint32_t *FirstCursor, uint32_t *HeadCursor)
+{
+    int nRecords = 0;
+    uint32_t Sector, Run, End;
+    UInt Key;
+
+    Lock_acquire(&Journal.Mutex);
+
+    //records before the oldest sector have been recycled
+    if (Cursor < SMO_Journal_oldestSeq())
+    {
+        Cursor = SMO_Journal_oldestSeq();
+    }
+    *FirstCursor = Cursor;
+
+    //records already flushed to flash
+    while (nRecords < MaxRecords && Cursor < Journal.FlashSeq)
+    {
+        Sector = SMO_Journal_findSector(Cursor);
+        if (Sector == SMO_JOURNAL_NO_SECTOR)
+        {
+            break;
+        }
+
+        Run = Journal.SectorBase[Sector] + Journal.RecordsPerSector - Cursor;
+        Run = Run > Journal.FlashSeq - Cursor ? Journal.FlashSeq - Cursor : Run;
+        Run = Run > (uint32_t) (MaxRecords - nRecords) ? (uint32_t) (MaxRecords - nRecords) : Run;
+
+        if (NVS_read(Journal.Nvs, SMO_Journal_offset(Sector, Cursor), &Records[nRecords],
+                     Run*sizeof(SMO_JournalRecord)) != NVS_STATUS_SUCCESS)
+        {
+            break;
+        }
+        nRecords += Run;
+        Cursor += Run;
+    }
+
+    //records still waiting in the RAM ring
+    Key = Hwi_disable();
+    End = Journal.RingSeq;
+    while (Cursor >= Journal.FlashSeq && Cursor < End && nRecords < MaxRecords)
+    {
+        Records[nRecords++] = Journal.Ring[Cursor & SMO_JOURNAL_RING_MASK];
+        Cursor++;
+    }
+    Hwi_restore(Key);
+    *HeadCursor = End;
+
+    Lock_release(&Journal.Mutex);
+
+    return nRecords;
+}
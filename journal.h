@@ -0,0 +1,52 @@
+/************************************************************
+ * journal.h
+ *
+ * Adherence journal for medication events. Every event that
+ * is acknowledged or times out is logged as a fixed-size
+ * record into a RAM ring, which is flushed to the NVS flash
+ * region in batches. Records are numbered with a sequence
+ * number (cursor) so they can be exported incrementally.
+ *
+ ************************************************************/
+
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SMO_JOURNAL_RING_SIZE           64 //records buffered in RAM, power of 2
+#define SMO_JOURNAL_FLUSH_BATCH         16 //pending records that trigger a flush
+#define SMO_JOURNAL_FLUSH_MAX_AGE_SECS  (6*60*60) //flush older records regardless
+
+#define SMO_JOURNAL_MAGIC               0x4A4F4D53 //"SMOJ"
+#define SMO_JOURNAL_HEADER_SIZE         8
+
+#define SMO_JOURNAL_EXPORT_HEADER_SIZE  16
+#define SMO_JOURNAL_EXPORT_MAX_RECORDS  180 //keeps a response within one UDP datagram
+
+typedef enum SMO_JournalOutcome
+{
+    SMO_JOURNAL_TAKEN = 0, //user acknowledged the event
+    SMO_JOURNAL_MISSED = 1, //event timed out without acknowledgement
+    SMO_JOURNAL_SUPERSEDED = 2, //next event started before this one ended
+    SMO_JOURNAL_SNOOZED = 3, //user snoozed the event, another record follows
+
+} SMO_JournalOutcome;
+
+typedef struct SMO_JournalRecord
+{
+    uint32_t Epoch; //RTC seconds when the event started
+    uint8_t Compartments; //indices set indicate which compartments were due
+    uint8_t Outcome; //SMO_JournalOutcome
+    uint16_t Latency; //seconds from event start to acknowledgement/timeout
+
+} SMO_JournalRecord;
+
+int SMO_Journal_init(void);
+void SMO_Journal_append(uint32_t Epoch, uint8_t Compartments, uint8_t Outcome, uint16_t Latency);
+int SMO_Journal_flush(uint32_t Now, bool Force);
+int SMO_Journal_read(uint32_t Cursor, SMO_JournalRecord *Records, int MaxRecords,
+                     uint32_t *FirstCursor, uint32_t *HeadCursor);
+
+#endif
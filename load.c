@@ -0,0 +1,283 @@
+#include <string.h>
+
+#include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/hal/Hwi.h>
+
+#include "load.h"
+#include "profile.h"
+#include "timer_wheel.h"
+
+#define LOAD_WINDOW_TICKS   TIMERWHEEL_MS_TO_TICKS(LOAD_WINDOW_MS)
+
+_Static_assert(LOAD_MAX_TASKS < 0xFF, "task ids are bytes");
+
+typedef struct Load_Control
+{
+    Int HookId; //set by the kernel before main
+    char Next[LOAD_NAME_SIZE]; //name for the next task created
+    uint8_t nTasks;
+    Task_Handle Handles[LOAD_MAX_TASKS]; //NULL once deleted
+    Load_Task Tasks[LOAD_MAX_TASKS];
+    uint8_t Current; //task the cycles since LastSwitch belong to
+    uint8_t IdleTask;
+    uint32_t LastSwitch; //DWT cycle count at the last switch
+    uint64_t Busy; //cycles spent in tasks other than idle
+    uint32_t CyclesPerTick; //0 until Load_init
+    uint32_t Start; //tick of Load_init
+    uint32_t WindowStart; //tick the current load window started
+    uint64_t WindowBusy; //Busy when it started
+    uint16_t Load;
+    uint16_t PeakLoad;
+
+} Load_Control;
+
+//zero initialised, the hooks run from before main
+static Load_Control Load_Ctrl;
+
+static uint8_t Load_slot(Task_Handle Task);
+static void Load_charge(void);
+static void Load_readStack(uint8_t Slot);
+
+void Load_init(void)
+{
+    UInt Key;
+    int i;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    Key = Hwi_disable();
+    Load_Ctrl.IdleTask = Load_slot(Task_getIdleTask());
+    strncpy(Load_Ctrl.Tasks[Load_Ctrl.IdleTask].Name, "idle", LOAD_NAME_SIZE);
+
+    //whatever was counted before the counter was known to run is dropped
+    for (i = 0; i < LOAD_MAX_TASKS; i++)
+    {
+        Load_Ctrl.Tasks[i].Cycles = 0;
+    }
+    Load_Ctrl.Busy = 0;
+    Load_Ctrl.LastSwitch = DWT->CYCCNT;
+    Load_Ctrl.Start = Load_Ctrl.WindowStart = TimerWheel_now();
+    Load_Ctrl.WindowBusy = 0;
+    Load_Ctrl.CyclesPerTick = MAP_CS_getMCLK() / TIMERWHEEL_TICKS_PER_SEC;
+    Hwi_restore(Key);
+}
+
+/*
+ * Task id of a task, given out the first time it is seen. Once
+ * the table is full, later tasks share its last entry.
+ */
+static uint8_t Load_slot(Task_Handle Task)
+{
+    uintptr_t Slot;
+    UInt Key;
+
+    Slot = (uintptr_t) Task_getHookContext(Task, Load_Ctrl.HookId);
+    if (Slot != 0)
+    {
+        return Slot - 1;
+    }
+
+    Key = Hwi_disable();
+    if (Load_Ctrl.nTasks < LOAD_MAX_TASKS)
+    {
+        Slot = ++Load_Ctrl.nTasks;
+    }
+    else
+    {
+        Slot = LOAD_MAX_TASKS;
+        strncpy(Load_Ctrl.Tasks[Slot - 1].Name, "other", LOAD_NAME_SIZE);
+    }
+    Load_Ctrl.Handles[Slot - 1] = Task;
+    Task_setHookContext(Task, Load_Ctrl.HookId, (Ptr) Slot);
+    Hwi_restore(Key);
+
+    return Slot - 1;
+}
+
+/*
+ * Charge the cycles since the last switch to the running task,
+ * with interrupts disabled
+ */
+static void Load_charge(void)
+{
+    uint32_t Now = DWT->CYCCNT;
+    uint32_t Delta = Now - Load_Ctrl.LastSwitch;
+
+    Load_Ctrl.Tasks[Load_Ctrl.Current].Cycles += Delta;
+    if (Load_Ctrl.Current != Load_Ctrl.IdleTask)
+    {
+        Load_Ctrl.Busy += Delta;
+    }
+    Load_Ctrl.LastSwitch = Now;
+}
+
+/*
+ * Timer wheel counter overflow, charges whichever task is running
+ * so a task that runs without a switch for longer than the 32 bit
+ * cycle counter takes to wrap is not short of whole wraps
+ */
+void Load_overflow(void)
+{
+    UInt Key = Hwi_disable();
+
+    Load_charge();
+    Hwi_restore(Key);
+}
+
+void Load_nameNext(const char *Name)
+{
+    strncpy(Load_Ctrl.Next, Name, LOAD_NAME_SIZE);
+}
+
+void Load_taskRegister(Int Id)
+{
+    Load_Ctrl.HookId = Id;
+}
+
+/*
+ * Task create hook, runs in the creating task
+ */
+void Load_taskCreate(Task_Handle Task, Error_Block *Eb)
+{
+    uint8_t Slot = Load_slot(Task);
+
+    if (Load_Ctrl.Next[0] != '\0')
+    {
+        memcpy(Load_Ctrl.Tasks[Slot].Name, Load_Ctrl.Next, LOAD_NAME_SIZE);
+        Load_Ctrl.Next[0] = '\0';
+    }
+}
+
+/*
+ * Task delete hook, keeps the stack figures of the task
+ */
+void Load_taskDelete(Task_Handle Task)
+{
+    uint8_t Slot = Load_slot(Task);
+
+    if (Load_Ctrl.Handles[Slot] == Task)
+    {
+        Load_readStack(Slot);
+        Load_Ctrl.Handles[Slot] = NULL;
+        Load_Ctrl.Tasks[Slot].Deleted = true;
+    }
+}
+
+/*
+ * Task switch hook, runs on every context switch
+ */
+void Load_taskSwitch(Task_Handle Prev, Task_Handle Next)
+{
+    Load_charge();
+    Load_Ctrl.Current = Load_slot(Next);
+    Profile_taskSwitch(Load_Ctrl.Current);
+}
+
+/*
+ * Close the load window once it is LOAD_WINDOW_MS old
+ */
+void Load_idle(void)
+{
+    uint32_t Now = TimerWheel_now();
+    uint32_t Ticks = Now - Load_Ctrl.WindowStart;
+    uint64_t Busy, Load;
+    UInt Key;
+
+    if (Load_Ctrl.CyclesPerTick == 0 || Ticks < LOAD_WINDOW_TICKS)
+    {
+        return;
+    }
+
+    Key = Hwi_disable();
+    Load_charge();
+    Busy = Load_Ctrl.Busy;
+    Hwi_restore(Key);
+
+    Load = (Busy - Load_Ctrl.WindowBusy)*1000 / ((uint64_t) Ticks*Load_Ctrl.CyclesPerTick);
+    Load_Ctrl.Load = Load > 1000 ? 1000 : Load;
+    Load_Ctrl.PeakLoad = Load_Ctrl.Load > Load_Ctrl.PeakLoad ? Load_Ctrl.Load : Load_Ctrl.PeakLoad;
+    Load_Ctrl.WindowStart = Now;
+    Load_Ctrl.WindowBusy = Busy;
+}
+
+uint8_t Load_currentTask(void)
+{
+    return Load_Ctrl.Current;
+}
+
+uint8_t Load_taskCount(void)
+{
+    return Load_Ctrl.nTasks;
+}
+
+const char *Load_taskName(uint8_t Task)
+{
+    return Load_Ctrl.Tasks[Task].Name;
+}
+
+void Load_getCycles(uint64_t *Cycles)
+{
+    UInt Key;
+    int i;
+
+    Key = Hwi_disable();
+    Load_charge();
+    for (i = 0; i < LOAD_MAX_TASKS; i++)
+    {
+        Cycles[i] = Load_Ctrl.Tasks[i].Cycles;
+    }
+    Hwi_restore(Key);
+}
+
+/*
+ * Update a task's stack figures from the kernel's paint, with the
+ * task kept from being deleted
+ */
+static void Load_readStack(uint8_t Slot)
+{
+    Task_Stat Stat;
+
+    Task_stat(Load_Ctrl.Handles[Slot], &Stat);
+    Load_Ctrl.Tasks[Slot].StackSize = Stat.stackSize;
+    if (Stat.used > Load_Ctrl.Tasks[Slot].StackPeak)
+    {
+        Load_Ctrl.Tasks[Slot].StackPeak = Stat.used;
+    }
+}
+
+void Load_getStats(Load_Stats *Stats)
+{
+    Hwi_StackInfo HwiStack;
+    UInt Key;
+    int i;
+
+    memset(Stats, 0, sizeof(*Stats));
+
+    //scanning the paint takes a while, so only task switches are held off
+    Key = Task_disable();
+    for (i = 0; i < Load_Ctrl.nTasks; i++)
+    {
+        if (Load_Ctrl.Handles[i] != NULL)
+        {
+            Load_readStack(i);
+        }
+    }
+    Task_restore(Key);
+    Hwi_getStackInfo(&HwiStack, TRUE);
+
+    Key = Hwi_disable();
+    Load_charge();
+    Stats->Ticks = TimerWheel_now() - Load_Ctrl.Start;
+    Stats->CyclesPerTick = Load_Ctrl.CyclesPerTick;
+    Stats->Load = Load_Ctrl.Load;
+    Stats->PeakLoad = Load_Ctrl.PeakLoad;
+    Stats->nTasks = Load_Ctrl.nTasks;
+    Stats->IdleTask = Load_Ctrl.IdleTask;
+    memcpy(Stats->Tasks, Load_Ctrl.Tasks, sizeof(Stats->Tasks));
+    Hwi_restore(Key);
+
+    Stats->HwiStackSize = HwiStack.hwiStackSize;
+    Stats->HwiStackPeak = HwiStack.hwiStackPeak;
+}
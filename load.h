@@ -0,0 +1,94 @@
+/************************************************************
+ * load.h
+ *
+ * CPU load and per-task run time and stack use. A task
+ * switch hook charges the DWT cycle counter to the task that
+ * was running, and the power policy calls Load_idle from the
+ * idle loop to close one load window a second. Load is the
+ * share of wall time (timer wheel ticks) spent running tasks
+ * other than idle. Interrupts are charged to the task they
+ * interrupted, so ISRs that wake the CPU from idle count as
+ * idle time.
+ *
+ * The kernel paints every task stack and the system (Hwi)
+ * stack when it creates them, and the high-water marks are
+ * read from the paint when stats are asked for, so stack
+ * sizes can be cut to what is really used. Stats go out in
+ * load responses (type 0x9A) and the housekeeping log.
+ *
+ * The hooks are installed by the kernel configuration, add
+ * to the .cfg:
+ *   var Task = xdc.useModule('ti.sysbios.knl.Task');
+ *   Task.initStackFlag = true;
+ *   Task.addHookSet({registerFxn: '&Load_taskRegister',
+ *                    createFxn: '&Load_taskCreate',
+ *                    deleteFxn: '&Load_taskDelete',
+ *                    switchFxn: '&Load_taskSwitch'});
+ *   var Hwi = xdc.useModule('ti.sysbios.family.arm.m3.Hwi');
+ *   Hwi.initStackFlag = true;
+ * The cycle counter stops in LPM3, which only shows up as
+ * idle wall time here, see the power stats for sleep.
+ *
+ * The counter wraps every 89 s at 48 MHz, so a task that runs
+ * that long without a switch would lose whole wraps. The timer
+ * wheel's 16 bit counter overflows every 64 s, which wakes the
+ * device from LPM3 anyway, and calls Load_overflow to charge
+ * the running task, so no wakeup is added for it.
+ *
+ ************************************************************/
+
+#ifndef LOAD_H
+#define LOAD_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <xdc/std.h>
+#include <xdc/runtime/Error.h>
+#include <ti/sysbios/knl/Task.h>
+
+#define LOAD_MAX_TASKS      12 //tasks with their own counts, later ones share the last
+#define LOAD_NAME_SIZE      8 //task name bytes, not terminated when full
+#define LOAD_WINDOW_MS      1000 //load is measured over windows this long
+
+typedef struct Load_Task
+{
+    char Name[LOAD_NAME_SIZE];
+    uint64_t Cycles; //cycles spent running the task since Load_init
+    uint32_t StackSize; //bytes
+    uint32_t StackPeak; //most bytes of stack the task has used
+    bool Deleted; //stack figures are from when it was deleted
+
+} Load_Task;
+
+typedef struct Load_Stats
+{
+    uint32_t Ticks; //timer wheel ticks since Load_init
+    uint32_t CyclesPerTick; //CPU cycles in one timer wheel tick
+    uint16_t Load; //permille busy over the last window
+    uint16_t PeakLoad; //busiest window since Load_init
+    uint32_t HwiStackSize; //system stack, shared by every interrupt
+    uint32_t HwiStackPeak;
+    uint8_t nTasks;
+    uint8_t IdleTask; //task id of the kernel's idle task
+    Load_Task Tasks[LOAD_MAX_TASKS];
+
+} Load_Stats;
+
+void Load_init(void);
+void Load_nameNext(const char *Name); //names the next task created, call just before creating it
+uint8_t Load_currentTask(void); //id of the running task, safe from interrupts
+uint8_t Load_taskCount(void);
+const char *Load_taskName(uint8_t Task); //LOAD_NAME_SIZE bytes
+void Load_getCycles(uint64_t *Cycles); //LOAD_MAX_TASKS counts, safe from interrupts
+void Load_getStats(Load_Stats *Stats); //reads the stack paint, tasks only
+void Load_idle(void); //called by the power policy
+void Load_overflow(void); //called by the timer wheel's overflow interrupt
+
+//task hooks, see the .cfg lines above
+void Load_taskRegister(Int Id);
+void Load_taskCreate(Task_Handle Task, Error_Block *Eb);
+void Load_taskDelete(Task_Handle Task);
+void Load_taskSwitch(Task_Handle Prev, Task_Handle Next);
+
+#endif
@@ -0,0 +1,281 @@
+#include <string.h>
+#include <pthread.h>
+
+#include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/hal/Hwi.h>
+
+#include "lock.h"
+
+typedef struct Lock_Control
+{
+    uint8_t nLocks;
+    Lock_Mutex *Locks[LOCK_MAX_LOCKS];
+#ifdef SMO_LOCK_CHECK
+    Lock_Section Sections[LOCK_SECTIONS]; //in the order the call sites were seen
+    uint32_t Errors;
+    uint8_t LastError;
+    const char *LastLock;
+    const char *LastHeld;
+    void *LastSite;
+#endif
+
+} Lock_Control;
+
+static Lock_Control Lock_Ctrl;
+
+int Lock_init(Lock_Mutex *Lock, const char *Name, uint8_t Rank)
+{
+    int Res;
+    pthread_mutexattr_t Attr;
+    UInt Key;
+
+    memset(Lock, 0, sizeof(*Lock));
+    Lock->Info.Name = Name;
+    Lock->Info.Rank = Rank;
+
+    pthread_mutexattr_init(&Attr);
+    Res = pthread_mutexattr_setprotocol(&Attr, PTHREAD_PRIO_INHERIT);
+    if (Res == 0)
+    {
+        Res = pthread_mutex_init(&Lock->Mutex, &Attr);
+    }
+    pthread_mutexattr_destroy(&Attr);
+    if (Res != 0)
+    {
+        Res = -Res;
+        goto Error;
+    }
+
+    Key = Hwi_disable();
+    if (Lock_Ctrl.nLocks < LOCK_MAX_LOCKS)
+    {
+        Lock_Ctrl.Locks[Lock_Ctrl.nLocks++] = Lock;
+    }
+    Hwi_restore(Key);
+
+Error:
+    return Res;
+}
+
+#ifdef SMO_LOCK_CHECK
+
+static bool Lock_inInterrupt(void)
+{
+    BIOS_ThreadType Type = BIOS_getThreadType();
+
+    return Type == BIOS_ThreadType_Hwi || Type == BIOS_ThreadType_Swi;
+}
+
+static void Lock_error(uint8_t Error, Lock_Mutex *Lock, Lock_Mutex *Held, void *Site)
+{
+    UInt Key = Hwi_disable();
+
+    Lock_Ctrl.Errors++;
+    Lock_Ctrl.LastError = Error;
+    Lock_Ctrl.LastLock = Lock->Info.Name;
+    Lock_Ctrl.LastHeld = Held != NULL ? Held->Info.Name : NULL;
+    Lock_Ctrl.LastSite = Site;
+    Hwi_restore(Key);
+}
+
+/*
+ * Keep the longest hold of each call site. Once the table is
+ * full, a new site only displaces one that was held for less.
+ */
+static void Lock_recordSection(Lock_Mutex *Lock, void *Site, uint32_t Hold)
+{
+    Lock_Section *Section, *Shortest = NULL;
+    UInt Key;
+    int i;
+
+    Key = Hwi_disable();
+    for (i = 0; i < LOCK_SECTIONS; i++)
+    {
+        Section = &Lock_Ctrl.Sections[i];
+        if (Section->Count == 0)
+        {
+            Shortest = Section;
+            break;
+        }
+        if (Section->Site == Site && Section->Name == Lock->Info.Name)
+        {
+            break;
+        }
+        if (Shortest == NULL || Section->MaxHold < Shortest->MaxHold)
+        {
+            Shortest = Section;
+        }
+    }
+
+    if (i == LOCK_SECTIONS || Section->Count == 0)
+    {
+        if (Shortest->Count != 0 && Hold <= Shortest->MaxHold)
+        {
+            goto Restore;
+        }
+        Section = Shortest;
+        Section->Name = Lock->Info.Name;
+        Section->Site = Site;
+        Section->Count = 0;
+        Section->MaxHold = 0;
+    }
+
+    Section->Count++;
+    if (Hold > Section->MaxHold)
+    {
+        Section->MaxHold = Hold;
+    }
+
+Restore:
+    Hwi_restore(Key);
+}
+
+static void Lock_checkedAcquire(Lock_Mutex *Lock, void *Site)
+{
+    pthread_t Self;
+    Lock_Mutex *Other;
+    uint32_t Start, Wait;
+    int i;
+
+    if (Lock_inInterrupt())
+    {
+        Lock_error(LOCK_INTERRUPT, Lock, NULL, Site);
+        return;
+    }
+
+    //a non-recursive mutex would deadlock here
+    Self = pthread_self();
+    if (Lock->Held && pthread_equal(Lock->Owner, Self))
+    {
+        Lock_error(LOCK_NESTED, Lock, Lock, Site);
+        Lock->Depth++;
+        return;
+    }
+
+    for (i = 0; i < Lock_Ctrl.nLocks; i++)
+    {
+        Other = Lock_Ctrl.Locks[i];
+        if (Other != Lock && Other->Held && pthread_equal(Other->Owner, Self)
+            && Other->Info.Rank >= Lock->Info.Rank)
+        {
+            Lock_error(LOCK_ORDER, Lock, Other, Site);
+            break;
+        }
+    }
+
+    Start = DWT->CYCCNT;
+    if (pthread_mutex_trylock(&Lock->Mutex) != 0)
+    {
+        pthread_mutex_lock(&Lock->Mutex);
+        Wait = DWT->CYCCNT - Start;
+        Lock->Info.Contended++;
+        if (Wait > Lock->Info.MaxWait)
+        {
+            Lock->Info.MaxWait = Wait;
+        }
+    }
+
+    Lock->Info.Taken++;
+    Lock->Owner = Self;
+    Lock->Site = Site;
+    Lock->Held = true;
+    Lock->Acquired = DWT->CYCCNT;
+}
+
+static void Lock_checkedRelease(Lock_Mutex *Lock)
+{
+    uint32_t Hold;
+
+    if (Lock_inInterrupt())
+    {
+        Lock_error(LOCK_INTERRUPT, Lock, NULL, Lock->Site);
+        return;
+    }
+
+    if (Lock->Depth > 0)
+    {
+        Lock->Depth--;
+        return;
+    }
+
+    Hold = DWT->CYCCNT - Lock->Acquired;
+    if (Hold > Lock->Info.MaxHold)
+    {
+        Lock->Info.MaxHold = Hold;
+        Lock->Info.MaxHoldSite = Lock->Site;
+    }
+    Lock_recordSection(Lock, Lock->Site, Hold);
+
+    Lock->Held = false;
+    pthread_mutex_unlock(&Lock->Mutex);
+}
+
+#endif
+
+//the call site is the caller's, so the take must not be inlined
+#ifdef SMO_LOCK_CHECK
+__attribute__((noinline))
+#endif
+void Lock_acquire(Lock_Mutex *Lock)
+{
+#ifdef SMO_LOCK_CHECK
+    Lock_checkedAcquire(Lock, __builtin_return_address(0));
+#else
+    pthread_mutex_lock(&Lock->Mutex);
+#endif
+}
+
+void Lock_release(Lock_Mutex *Lock)
+{
+#ifdef SMO_LOCK_CHECK
+    Lock_checkedRelease(Lock);
+#else
+    pthread_mutex_unlock(&Lock->Mutex);
+#endif
+}
+
+void Lock_getStats(Lock_Stats *Stats)
+{
+    UInt Key;
+    int i;
+#ifdef SMO_LOCK_CHECK
+    Lock_Section Section;
+    int j;
+#endif
+
+    memset(Stats, 0, sizeof(*Stats));
+
+    Key = Hwi_disable();
+    Stats->nLocks = Lock_Ctrl.nLocks;
+    for (i = 0; i < Lock_Ctrl.nLocks; i++)
+    {
+        Stats->Locks[i] = Lock_Ctrl.Locks[i]->Info;
+    }
+#ifdef SMO_LOCK_CHECK
+    for (i = 0; i < LOCK_SECTIONS && Lock_Ctrl.Sections[i].Count != 0; i++)
+    {
+        Stats->Sections[i] = Lock_Ctrl.Sections[i];
+    }
+    Stats->nSections = i;
+    Stats->Errors = Lock_Ctrl.Errors;
+    Stats->LastError = Lock_Ctrl.LastError;
+    Stats->LastLock = Lock_Ctrl.LastLock;
+    Stats->LastHeld = Lock_Ctrl.LastHeld;
+    Stats->LastSite = Lock_Ctrl.LastSite;
+#endif
+    Hwi_restore(Key);
+
+#ifdef SMO_LOCK_CHECK
+    //longest first
+    for (i = 1; i < Stats->nSections; i++)
+    {
+        Section = Stats->Sections[i];
+        for (j = i; j > 0 && Stats->Sections[j - 1].MaxHold < Section.MaxHold; j--)
+        {
+            Stats->Sections[j] = Stats->Sections[j - 1];
+        }
+        Stats->Sections[j] = Section;
+    }
+#endif
+}
@@ -0,0 +1,106 @@
+/************************************************************
+ * lock.h
+ *
+ * Mutexes shared between tasks. They are pthread mutexes with
+ * priority inheritance, so a low priority task holding one
+ * (the UDP thread applying a schedule) runs at the priority
+ * of the highest task waiting for it (the alert thread at an
+ * alarm) instead of being preempted by everything in between.
+ * They may only be taken from tasks: interrupts hand their
+ * work to a task through a mailbox or semaphore, or use
+ * Hwi_disable for the few words they share.
+ *
+ * Every lock has a rank, and a task holding locks may only
+ * take one of a higher rank. Locks are not recursive.
+ *
+ * Built with SMO_LOCK_CHECK (Debug builds, or the
+ * SMO_LOCK_CHECK CMake option), every take is checked for
+ * its rank, for nesting and for interrupt context, and timed
+ * with the cycle counter: how long it waited, how long it was
+ * held and where from. The longest critical sections bound
+ * how late an alarm can start while a schedule is applied,
+ * see the housekeeping log. Checked locks that are nested or
+ * taken from an interrupt are reported and skipped rather
+ * than deadlocking.
+ *
+ ************************************************************/
+
+#ifndef LOCK_H
+#define LOCK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+//ranks, locks are taken in increasing rank
+#define LOCK_RANK_APP       1 //medication controller, smo_app.c
+#define LOCK_RANK_JOURNAL   2 //journal flash, journal.c
+#define LOCK_RANK_SCREEN    3 //EVE power and redraws, peripherals.c
+
+#define LOCK_MAX_LOCKS      8 //locks the checker keeps stats for
+#define LOCK_SECTIONS       8 //call sites with the longest critical sections
+
+typedef enum Lock_Error
+{
+    LOCK_OK = 0,
+    LOCK_ORDER = 1, //taken while holding a lock of the same or a higher rank
+    LOCK_NESTED = 2, //taken again by the task holding it
+    LOCK_INTERRUPT = 3, //taken or released from an interrupt
+
+} Lock_Error;
+
+typedef struct Lock_Info
+{
+    const char *Name;
+    uint8_t Rank;
+    uint32_t Taken;
+    uint32_t Contended; //times it was held by another task when taken
+    uint32_t MaxWait; //cycles
+    uint32_t MaxHold; //cycles
+    void *MaxHoldSite; //return address of the take that held it longest
+
+} Lock_Info;
+
+typedef struct Lock_Mutex
+{
+    pthread_mutex_t Mutex;
+    Lock_Info Info;
+#ifdef SMO_LOCK_CHECK
+    bool Held;
+    uint8_t Depth; //nested takes skipped
+    pthread_t Owner;
+    uint32_t Acquired; //cycle count when taken
+    void *Site;
+#endif
+
+} Lock_Mutex;
+
+typedef struct Lock_Section
+{
+    const char *Name; //lock held
+    void *Site; //return address of the take
+    uint32_t Count;
+    uint32_t MaxHold; //cycles
+
+} Lock_Section;
+
+typedef struct Lock_Stats
+{
+    uint8_t nLocks;
+    Lock_Info Locks[LOCK_MAX_LOCKS];
+    uint8_t nSections;
+    Lock_Section Sections[LOCK_SECTIONS]; //longest first
+    uint32_t Errors;
+    uint8_t LastError; //Lock_Error
+    const char *LastLock; //lock being taken
+    const char *LastHeld; //lock held that it clashed with, if any
+    void *LastSite;
+
+} Lock_Stats;
+
+int Lock_init(Lock_Mutex *Lock, const char *Name, uint8_t Rank);
+void Lock_acquire(Lock_Mutex *Lock);
+void Lock_release(Lock_Mutex *Lock);
+void Lock_getStats(Lock_Stats *Stats); //only counts with SMO_LOCK_CHECK
+
+#endif
@@ -36,12 +36,19 @@
 #include <ti/sysbios/BIOS.h>
 #include <ti/drivers/GPIO.h>
 #include "Board.h"
+#include "load.h"
 
 extern void *mainThread(void *arg0);
 
 /* Stack size in bytes */
 #define THREADSTACKSIZE    4096
 
+/* Hot code linked to run from SRAM, see MSP_EXP432P401R_TIRTOS.lds */
+#if defined(__GNUC__) && !defined(__TI_COMPILER_VERSION__)
+#define SMO_RAMFUNC_COPY
+extern uint32_t __ramfunc_load__, __ramfunc_start__, __ramfunc_end__;
+#endif
+
 /*
  *  ======== main ========
  */
@@ -52,6 +59,15 @@ int main(void)
     struct sched_param  priParam;
     int                 retc;
 
+#ifdef SMO_RAMFUNC_COPY
+    /* Copy the SRAM code before any interrupt can run it */
+    uint32_t *src = &__ramfunc_load__;
+    uint32_t *dst = &__ramfunc_start__;
+    while (dst < &__ramfunc_end__) {
+        *dst++ = *src++;
+    }
+#endif
+
     /* Call driver init functions */
     Board_initGeneral();//
 
@@ -68,6 +84,7 @@ int main(void)
         while (1) {}
     }
 
+    Load_nameNext("main");
     retc = pthread_create(&thread, &attrs, mainThread, NULL);
     if (retc != 0) {
         while (1) {}
@@ -5,11 +5,22 @@
 #include <unistd.h>
 
 #include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/knl/Semaphore.h>
+#include <ti/sysbios/knl/Mailbox.h>
 
 #include "peripherals.h"
 #include "EVE.h"
+#include "font.h"
+#include "asset.h"
+#include "store.h"
+#include "scene.h"
+#include "touch.h"
+#include "sound.h"
 #include "LP5018.h"
-#include "board.h"
+#include "lock.h"
+#include "power.h"
+#include "Board.h"
 
 #define GRAY  	    0x919191UL
 #define BLACK  	    0x222222UL
@@ -18,17 +29,222 @@
 
 #define SPI_BITRATE     1000000
 
-#define SCREEN_UPDATE_INTERVAL_USEC 250000
+#define SCREEN_BACKLIGHT    0x10
+#define SCREEN_WAKE_MS      20 //EVE clock settle time after ACTIVE
+#define SCREEN_FONT_ADDR    0 //RAM_G offset of the med info font
+#define SCREEN_FONT_HANDLE  1 //uses handles 1 to FONT_MAX_PAGES
+#define SCREEN_TEXT_WIDTH   (HSIZE - 20)
+#define SCREEN_LOGO_ADDR    ((SCREEN_FONT_ADDR + Font_sans.RamSize + 3) & ~3UL) //after the font
+#define SCREEN_LOGO_HANDLE  (SCREEN_FONT_HANDLE + FONT_MAX_PAGES)
+#define SCREEN_SOUND_ADDR   ((SCREEN_LOGO_ADDR + Asset_logo.RamSize + 7) & ~7UL) //after the logo
+#define SCREEN_STORE_FONT   1 //asset store IDs
+#define SCREEN_STORE_LOGO   2
+#define SCREEN_CACHE_SIZE   3072 //command bytes kept for the scene nodes
+#define SCREEN_TILE_W       120
+#define SCREEN_TILE_H       70
+#define SCREEN_TILE_Y       (VSIZE - SCREEN_TILE_H - 10)
+#define SCREEN_HIGHLIGHT    0xFFB000UL //due compartments and alert progress
+
+// Screen updates, applied to the scene by the peripheral thread only
+#define SCREEN_MSG_TIME         0
+#define SCREEN_MSG_DATE         1
+#define SCREEN_MSG_DEVICE_ID    2
+#define SCREEN_MSG_MED_INFO     3
+#define SCREEN_MSG_REMOVE_INFO  4
+#define SCREEN_MSG_COMPARTMENTS 5
+#define SCREEN_MSG_CLEAR        6 //one compartment taken
+#define SCREEN_MSG_PROGRESS     7
+#define SCREEN_MSG_RESET        8
+#define SCREEN_MSG_SOUND        9
+#define SCREEN_MSG_MED_LIST     10
+
+typedef struct Screen_Msg
+{
+    uint8_t Type; //SCREEN_MSG_*
+    union
+    {
+        struct { uint8_t Hour; uint8_t Min; } Time;
+        struct { uint8_t Due; uint8_t nPills[SCREEN_COMPARTMENTS]; } Compartments;
+        struct { uint16_t Value; uint16_t Range; } Progress;
+        struct { uint8_t Tone; uint8_t Volume; uint16_t PeriodMs; } Sound;
+        struct { uint8_t Shown; char Lines[SCREEN_COMPARTMENTS][SCREEN_MED_SIZE]; } MedList;
+        uint8_t Index;
+        char Text[SCREEN_TEXT_SIZE];
+    } Arg;
+
+} Screen_Msg;
+
+//the med list rides in the mailbox, it must not make every message bigger
+_Static_assert(SCREEN_COMPARTMENTS*SCREEN_MED_SIZE <= SCREEN_TEXT_SIZE, "med list larger than a text update");
 
 extern volatile bool peripheralThreadStop;
 
-char printBuf[1024]; //for medInfo to screen
-char timeString[10]; //for time to screen
-char timeString2[2]; //for am/pm to screen
-char dateString[20]; //for month and year to screen
-char deviceIdString[25]; //for device Id to screen
+static char printBuf[SCREEN_TEXT_SIZE]; //for medInfo to screen
+static char timeString[10]; //for time to screen
+static char timeString2[3]; //for am/pm to screen
+static char dateString[20]; //for month and year to screen
+static char deviceIdString[25]; //for device Id to screen
+static char tileLabels[SCREEN_COMPARTMENTS][2];
+static char medText[SCREEN_COMPARTMENTS][SCREEN_MED_SIZE]; //med list, copied from the message
+static const char *medLines[SCREEN_COMPARTMENTS]; //rows of medText
 
 bool speakerOn;
+static bool speakerTones; //sampled tones loaded, else the EVE synth
+static uint8_t speakerTone;
+
+static Font screenFont; //med info can be any UTF-8 the font covers
+static bool screenFontLoaded;
+static Asset screenLogo;
+static bool screenLogoLoaded;
+
+// Screen contents, each node redrawn from its cache until it changes
+static Scene screenScene;
+static Scene_Node screenDivider;
+static Scene_Node screenTime;
+static Scene_Node screenAmPm;
+static Scene_Node screenDate;
+static Scene_Node screenDeviceId;
+static Scene_Node screenMedInfo;
+static Scene_Node screenMedList;
+static Scene_Node screenProgress;
+static Scene_Node screenUpcoming;
+static Scene_Node screenSnooze;
+static Scene_Node screenTiles[SCREEN_COMPARTMENTS];
+static uint8_t screenCache[SCREEN_CACHE_SIZE];
+static uint16_t screenCacheUsed;
+
+static Semaphore_Handle screenSem; //posted when the screen has work
+static Mailbox_Handle screenMbx; //Screen_Msg from any thread or interrupt
+static Lock_Mutex screenLock; //EVE power changes and redraws
+static volatile bool screenDirty;
+static volatile bool screenTouch; //EVE INT fired, tag not read yet
+static volatile bool screenSound; //volume ramp or tone repeat due
+static volatile uint8_t screenPowerTarget;
+static uint8_t screenPower;
+
+static void Speaker_synth(uint8_t vol);
+
+static void Screen_applyPower(void)
+{
+	uint8_t target;
+
+	Lock_acquire(&screenLock);
+	target = screenPowerTarget;
+	if (target != screenPower)
+	{
+		if (screenPower != SCREEN_POWER_ACTIVE)
+		{
+			EVE_sendHCMD(ACTIVE, 0);
+			delay(SCREEN_WAKE_MS);
+		}
+		if (target == SCREEN_POWER_ACTIVE)
+		{
+			EVE_write8(REG_PWM_DUTY + RAM_REG, SCREEN_BACKLIGHT);
+			screenDirty = true;
+		}
+		else
+		{
+			EVE_write8(REG_PWM_DUTY + RAM_REG, 0);
+			EVE_sendHCMD(target == SCREEN_POWER_STANDBY ? STANDBY : SLEEP, 0);
+		}
+		screenPower = target;
+	}
+	Lock_release(&screenLock);
+}
+
+// Copy the font from the EVE flash, or inflate it and save it there
+static bool Screen_loadFont(void)
+{
+	if (Store_fetch(SCREEN_STORE_FONT, Font_sans.Version, SCREEN_FONT_ADDR, Font_sans.RamSize))
+	{
+		Font_attach(&screenFont, &Font_sans, SCREEN_FONT_ADDR, SCREEN_FONT_HANDLE);
+		return true;
+	}
+	if (Font_load(&screenFont, &Font_sans, SCREEN_FONT_ADDR, SCREEN_FONT_HANDLE) != 0)
+	{
+		return false;
+	}
+	Store_save(SCREEN_STORE_FONT, Font_sans.Version, SCREEN_FONT_ADDR, Font_sans.RamSize);
+	return true;
+}
+
+static bool Screen_loadLogo(void)
+{
+	if (Store_fetch(SCREEN_STORE_LOGO, Asset_logo.Version, SCREEN_LOGO_ADDR, Asset_logo.RamSize))
+	{
+		Asset_attach(&screenLogo, &Asset_logo, SCREEN_LOGO_ADDR);
+		return true;
+	}
+	if (Asset_load(&screenLogo, &Asset_logo, SCREEN_LOGO_ADDR) != 0)
+	{
+		return false;
+	}
+	Store_save(SCREEN_STORE_LOGO, Asset_logo.Version, SCREEN_LOGO_ADDR, Asset_logo.RamSize);
+	return true;
+}
+
+static void Screen_addNode(Scene_Node *node, uint16_t cacheSize)
+{
+	uint8_t *cache = NULL;
+
+	if (screenCacheUsed + cacheSize <= SCREEN_CACHE_SIZE)
+	{
+		cache = &screenCache[screenCacheUsed];
+		screenCacheUsed += cacheSize;
+	}
+	Scene_add(&screenScene, node, cache, cacheSize);
+}
+
+static void Screen_buildScene(void)
+{
+	uint8_t i;
+
+	Scene_init(&screenScene);
+	screenCacheUsed = 0;
+	// Divider between the clock and the med info
+	Scene_rect(&screenDivider, 0, LAYOUT_Y1-2, HSIZE, 1, 0, GRAY);
+	Screen_addNode(&screenDivider, 32);
+	Scene_text(&screenTime, 580, 20, 31, 0, GRAY, timeString);
+	Screen_addNode(&screenTime, 32);
+	Scene_text(&screenAmPm, 750, 40, 28, 0, GRAY, timeString2);
+	Screen_addNode(&screenAmPm, 24);
+	Scene_text(&screenDate, 580, 65, 29, 0, GRAY, dateString);
+	Screen_addNode(&screenDate, 48);
+	Scene_text(&screenDeviceId, 10, 65, 28, 0, GRAY, deviceIdString);
+	Screen_addNode(&screenDeviceId, 48);
+	// Medication info can take several lines, uncached if it outgrows a burst
+	Scene_text(&screenMedInfo, 10, 150, 30, 0, GRAY, printBuf);
+	Screen_addNode(&screenMedInfo, SCENE_MAX_CACHE);
+	// Med info of a due event, one line per compartment
+	for (i = 0; i < SCREEN_COMPARTMENTS; ++i)
+	{
+		medLines[i] = medText[i];
+	}
+	Scene_list(&screenMedList, 10, 150, 30, 40, GRAY, medLines, SCREEN_COMPARTMENTS);
+	Screen_addNode(&screenMedList, SCENE_MAX_CACHE);
+	// Alert escalation and the compartments to take pills from
+	Scene_progress(&screenProgress, 10, SCREEN_TILE_Y - 30, HSIZE - 20, 12, 1, SCREEN_HIGHLIGHT);
+	Scene_setHidden(&screenProgress, true);
+	Screen_addNode(&screenProgress, 40);
+	// Touch buttons between the device ID and the clock
+	Scene_button(&screenUpcoming, 250, 30, 150, 50, 28, BLACK, "Upcoming");
+	Scene_setTag(&screenUpcoming, TOUCH_TAG_UPCOMING);
+	Screen_addNode(&screenUpcoming, 48);
+	Scene_button(&screenSnooze, 410, 30, 150, 50, 28, BLACK, "Snooze");
+	Scene_setTag(&screenSnooze, TOUCH_TAG_SNOOZE);
+	Scene_setHidden(&screenSnooze, true);
+	Screen_addNode(&screenSnooze, 48);
+	for (i = 0; i < SCREEN_COMPARTMENTS; ++i)
+	{
+		tileLabels[i][0] = 'A' + i;
+		tileLabels[i][1] = '\0';
+		Scene_tile(&screenTiles[i], (HSIZE - SCREEN_COMPARTMENTS*SCREEN_TILE_W - (SCREEN_COMPARTMENTS-1)*10)/2
+		           + i*(SCREEN_TILE_W + 10), SCREEN_TILE_Y, SCREEN_TILE_W, SCREEN_TILE_H,
+		           SCREEN_HIGHLIGHT, tileLabels[i]);
+		Scene_setTag(&screenTiles[i], TOUCH_TAG_COMPARTMENT + i);
+		Screen_addNode(&screenTiles[i], 96);
+	}
+}
 
 void LED_init(void)
 {
@@ -65,21 +281,32 @@ void LED_allOff(void)
 	LP5018_setAllBrightness(0);
 }
 
-void Screen_background(void)
+void LED_setBrightness(int nLed, uint8_t brightness)
 {
-	EVE_cmdBGColor(BLACK);
-	EVE_cmd(VERTEX_FORMAT(0));
-	// Divide the screen
-	EVE_cmd(DL_BEGIN | LINES);
-	EVE_cmd(LINE_WIDTH(1*16));
-	EVE_colorRGB(GRAY);
-	EVE_cmd(VERTEX2F(0,LAYOUT_Y1-2));
-	EVE_cmd(VERTEX2F(HSIZE,LAYOUT_Y1-2));
-	EVE_cmd(DL_END);
+	LP5018_setBrightness(nLed, brightness);
 }
 
 void Screen_init(void)
 {
+    Semaphore_Params semParams;
+
+    Semaphore_Params_init(&semParams);
+    semParams.mode = Semaphore_Mode_BINARY;
+    screenSem = Semaphore_create(0, &semParams, NULL);
+    if (screenSem == NULL)
+    {
+        while(1);
+    }
+    screenMbx = Mailbox_create(sizeof(Screen_Msg), SCREEN_MAILBOX_SIZE, NULL, NULL);
+    if (screenMbx == NULL)
+    {
+        while(1);
+    }
+    Lock_init(&screenLock, "screen", LOCK_RANK_SCREEN);
+    Screen_buildScene();
+    screenPowerTarget = SCREEN_POWER_ACTIVE;
+    screenPower = SCREEN_POWER_ACTIVE;
+
     SPI_init();
     SPI_Params_init(&spiParams);
     spiParams.bitRate = SPI_BITRATE;
@@ -91,60 +318,339 @@ void Screen_init(void)
     Screen_reset();
 	EVE_init();
 	EVE_initFlash();
+	// Custom font and logo come from the EVE flash, uploaded over SPI only
+	// the first time or after they change. ROM font 30 is the fallback.
+	Store_open();
+	screenFontLoaded = Screen_loadFont();
+	screenLogoLoaded = Screen_loadLogo();
+	Store_commit();
+	if (screenFontLoaded)
+	{
+		Scene_setFont(&screenMedInfo, &screenFont, SCREEN_TEXT_WIDTH);
+		Scene_setFont(&screenMedList, &screenFont, SCREEN_TEXT_WIDTH);
+	}
+	Touch_start();
     // Loading screen while waiting for wifi
 	EVE_startBurst();
 	EVE_cmd(CMD_DLSTART);
     EVE_cmd(DL_CLEAR_RGB | BLACK);
     EVE_cmd(DL_CLEAR | CLR_COL | CLR_STN | CLR_TAG);
-    EVE_cmdSpinner(400,240,1,1);
+    EVE_cmd(VERTEX_FORMAT(0));
+    if (screenLogoLoaded)
+    {
+        Asset_draw(&screenLogo, SCREEN_LOGO_HANDLE, (HSIZE - Asset_logo.Width) / 2, 60);
+    }
+    EVE_cmdSpinner(400,400,1,1);
 	EVE_cmd(DL_DISPLAY);
 	EVE_cmd(CMD_SWAP);
 	EVE_sendBurst();
 }
 
+/*
+ * Queue an update for the peripheral thread, safe from interrupts.
+ * The mailbox holds a few bursts of updates, if it is ever full the
+ * update is dropped rather than blocking the caller.
+ */
+static void Screen_post(Screen_Msg *msg)
+{
+	if (screenMbx != NULL && Mailbox_post(screenMbx, msg, BIOS_NO_WAIT))
+	{
+		Semaphore_post(screenSem);
+	}
+}
+
+static void Screen_postText(uint8_t type, const char *text)
+{
+	Screen_Msg msg;
+
+	msg.Type = type;
+	strncpy(msg.Arg.Text, text, sizeof(msg.Arg.Text) - 1);
+	msg.Arg.Text[sizeof(msg.Arg.Text) - 1] = '\0';
+	Screen_post(&msg);
+}
+
 void Screen_printf(const char *format, ...)
 {
+	Screen_Msg msg;
 	va_list args;
+
+	msg.Type = SCREEN_MSG_MED_INFO;
 	va_start(args, format);
-	snprintf(printBuf, sizeof(printBuf), format, args);
+	vsnprintf(msg.Arg.Text, sizeof(msg.Arg.Text), format, args);
 	va_end(args);
+	Screen_post(&msg);
 }
 
 void Screen_printMedInfo(char *MedInfo)
 {
-	snprintf(printBuf, sizeof(printBuf), MedInfo);
+	Screen_postText(SCREEN_MSG_MED_INFO, MedInfo);
+}
+
+/*
+ * Show the lines whose bit is set in Shown. They are copied into the
+ * message, as the caller may overwrite them (a new schedule) while the
+ * peripheral thread is still drawing.
+ */
+void Screen_showMedList(const char *const *Lines, uint8_t Shown)
+{
+	Screen_Msg msg;
+	uint8_t i;
+
+	msg.Type = SCREEN_MSG_MED_LIST;
+	msg.Arg.MedList.Shown = Shown;
+	for (i = 0; i < SCREEN_COMPARTMENTS; ++i)
+	{
+		msg.Arg.MedList.Lines[i][0] = '\0';
+		if ((Shown & (1 << i)) && Lines[i] != NULL)
+		{
+			snprintf(msg.Arg.MedList.Lines[i], SCREEN_MED_SIZE, "%s", Lines[i]);
+		}
+	}
+	Screen_post(&msg);
 }
 
 void Screen_printDeviceId(char *DeviceId)
 {
-    snprintf(deviceIdString, sizeof(deviceIdString), DeviceId);
+	Screen_postText(SCREEN_MSG_DEVICE_ID, DeviceId);
 }
 
 void Screen_removeMedInfo(void)
 {
-    memset(printBuf, 0, sizeof(printBuf));
+	Screen_Msg msg;
+
+	msg.Type = SCREEN_MSG_REMOVE_INFO;
+	Screen_post(&msg);
+}
+
+/*
+ * Highlight the compartments in the Due mask, with the number of
+ * pills to take from each
+ */
+void Screen_showCompartments(uint8_t Due, const uint8_t *nPills)
+{
+	Screen_Msg msg;
+
+	msg.Type = SCREEN_MSG_COMPARTMENTS;
+	msg.Arg.Compartments.Due = Due;
+	if (nPills != NULL)
+	{
+		memcpy(msg.Arg.Compartments.nPills, nPills, SCREEN_COMPARTMENTS);
+	}
+	else
+	{
+		memset(msg.Arg.Compartments.nPills, 0, SCREEN_COMPARTMENTS);
+	}
+	Screen_post(&msg);
+}
+
+/*
+ * Drop the highlight of a compartment once its pills are taken
+ */
+void Screen_clearCompartment(uint8_t Index)
+{
+	Screen_Msg msg;
+
+	if (Index < SCREEN_COMPARTMENTS)
+	{
+		msg.Type = SCREEN_MSG_CLEAR;
+		msg.Arg.Index = Index;
+		Screen_post(&msg);
+	}
+}
+
+/*
+ * Show how far an alert has escalated, a Value of 0 hides the bar.
+ * The snooze button is shown with it.
+ */
+void Screen_setAlertProgress(uint16_t Value, uint16_t Range)
+{
+	Screen_Msg msg;
+
+	msg.Type = SCREEN_MSG_PROGRESS;
+	msg.Arg.Progress.Value = Value;
+	msg.Arg.Progress.Range = Range;
+	Screen_post(&msg);
 }
 
 void Screen_reset(void)
 {
-	memset(printBuf, 0, sizeof(printBuf));
-    memset(timeString, 0, sizeof(timeString));
-    memset(timeString2, 0, sizeof(timeString2));
-    memset(dateString, 0, sizeof(dateString));
-    memset(deviceIdString, 0, sizeof(deviceIdString));
+	Screen_Msg msg;
+
+	msg.Type = SCREEN_MSG_RESET;
+	Screen_post(&msg);
 }
 
 void Screen_updateTime(int Hour, int Min)
 {
-	// Assuming 24 hour input, convert to 12 hour
-	snprintf(timeString2, sizeof(timeString2), Hour > 11 && Hour < 24 ? "PM":"AM");
-	Hour = Hour > 12 ? Hour-12 : Hour;
-	snprintf(timeString, sizeof(timeString), "%02d:%02d", Hour, Min);
+	Screen_Msg msg;
+
+	msg.Type = SCREEN_MSG_TIME;
+	msg.Arg.Time.Hour = Hour;
+	msg.Arg.Time.Min = Min;
+	Screen_post(&msg);
 }
 
 void Screen_updateDate(char *Date)
 {
-	snprintf(dateString, 20, Date);
+	Screen_postText(SCREEN_MSG_DATE, Date);
+}
+
+/*
+ * Ask the peripheral thread to redraw, safe from interrupts
+ */
+void Screen_refresh(void)
+{
+	screenDirty = true;
+	if (screenSem != NULL)
+	{
+		Semaphore_post(screenSem);
+	}
+}
+
+/*
+ * EVE touch interrupt, the tag is read on the peripheral thread
+ */
+void Screen_touched(void)
+{
+	screenTouch = true;
+	if (screenSem != NULL)
+	{
+		Semaphore_post(screenSem);
+	}
+}
+
+/*
+ * Sound engine step due, safe from interrupts
+ */
+static void Screen_soundDue(void)
+{
+	screenSound = true;
+	if (screenSem != NULL)
+	{
+		Semaphore_post(screenSem);
+	}
+}
+
+/*
+ * Request an EVE power state, safe from interrupts. The peripheral
+ * thread applies it before any update queued after this call, so a
+ * sound queued straight after a wake plays.
+ */
+void Screen_setPower(uint8_t power)
+{
+	if (power == screenPowerTarget && power == screenPower)
+	{
+		return;
+	}
+	screenPowerTarget = power;
+	Semaphore_post(screenSem);
+}
+
+static void Screen_clearScene(void)
+{
+	uint8_t i;
+
+	memset(printBuf, 0, sizeof(printBuf));
+	Scene_invalidate(&screenMedInfo);
+	Scene_setValue(&screenMedList, 0);
+	for (i = 0; i < SCREEN_COMPARTMENTS; ++i)
+	{
+		Scene_setHighlight(&screenTiles[i], false);
+		Scene_setValue(&screenTiles[i], 0);
+	}
+	Scene_setHidden(&screenProgress, true);
+	Scene_setHidden(&screenSnooze, true);
+	Scene_setValue(&screenProgress, 0);
+}
+
+/*
+ * Apply one update to the scene, on the peripheral thread only
+ */
+static void Screen_apply(Screen_Msg *msg)
+{
+	uint8_t i, hour;
+	uint16_t value, range;
+
+	switch (msg->Type)
+	{
+	case SCREEN_MSG_TIME:
+		// Assuming 24 hour input, convert to 12 hour
+		hour = msg->Arg.Time.Hour;
+		snprintf(timeString2, sizeof(timeString2), hour > 11 && hour < 24 ? "PM":"AM");
+		hour = hour > 12 ? hour-12 : hour;
+		snprintf(timeString, sizeof(timeString), "%02d:%02d", hour, msg->Arg.Time.Min);
+		Scene_invalidate(&screenTime);
+		Scene_invalidate(&screenAmPm);
+		break;
+	case SCREEN_MSG_DATE:
+		snprintf(dateString, sizeof(dateString), "%s", msg->Arg.Text);
+		Scene_invalidate(&screenDate);
+		break;
+	case SCREEN_MSG_DEVICE_ID:
+		snprintf(deviceIdString, sizeof(deviceIdString), "%s", msg->Arg.Text);
+		Scene_invalidate(&screenDeviceId);
+		break;
+	case SCREEN_MSG_MED_INFO:
+		snprintf(printBuf, sizeof(printBuf), "%s", msg->Arg.Text);
+		Scene_invalidate(&screenMedInfo);
+		Scene_setValue(&screenMedList, 0);
+		break;
+	case SCREEN_MSG_MED_LIST:
+		memcpy(medText, msg->Arg.MedList.Lines, sizeof(medText));
+		memset(printBuf, 0, sizeof(printBuf));
+		Scene_invalidate(&screenMedInfo);
+		Scene_setValue(&screenMedList, msg->Arg.MedList.Shown);
+		Scene_invalidate(&screenMedList);
+		break;
+	case SCREEN_MSG_REMOVE_INFO:
+		Screen_clearScene();
+		break;
+	case SCREEN_MSG_COMPARTMENTS:
+		for (i = 0; i < SCREEN_COMPARTMENTS; ++i)
+		{
+			Scene_setHighlight(&screenTiles[i], (msg->Arg.Compartments.Due & (1 << i)) != 0);
+			Scene_setValue(&screenTiles[i], msg->Arg.Compartments.nPills[i]);
+		}
+		break;
+	case SCREEN_MSG_CLEAR:
+		Scene_setHighlight(&screenTiles[msg->Arg.Index], false);
+		break;
+	case SCREEN_MSG_PROGRESS:
+		value = msg->Arg.Progress.Value;
+		range = msg->Arg.Progress.Range;
+		Scene_setHidden(&screenProgress, value == 0 || range == 0);
+		Scene_setHidden(&screenSnooze, value == 0 || range == 0);
+		if (range != 0)
+		{
+			Scene_setRange(&screenProgress, range);
+		}
+		Scene_setValue(&screenProgress, value);
+		break;
+	case SCREEN_MSG_RESET:
+		memset(timeString, 0, sizeof(timeString));
+		memset(timeString2, 0, sizeof(timeString2));
+		memset(dateString, 0, sizeof(dateString));
+		memset(deviceIdString, 0, sizeof(deviceIdString));
+		Scene_invalidate(&screenTime);
+		Scene_invalidate(&screenAmPm);
+		Scene_invalidate(&screenDate);
+		Scene_invalidate(&screenDeviceId);
+		Screen_clearScene();
+		break;
+	case SCREEN_MSG_SOUND:
+		if (speakerTones)
+		{
+			Sound_play(msg->Arg.Sound.Tone, msg->Arg.Sound.Volume, msg->Arg.Sound.PeriodMs);
+		}
+		else
+		{
+			Speaker_synth(msg->Arg.Sound.Volume);
+		}
+		return;
+	default:
+		return;
+	}
+	screenDirty = true;
 }
 
 void Screen_update(void)
@@ -154,50 +660,138 @@ void Screen_update(void)
 	EVE_cmd(CMD_DLSTART);
 	EVE_cmd(DL_CLEAR_RGB | BLACK);
 	EVE_cmd(DL_CLEAR | CLR_COL | CLR_STN | CLR_TAG);
-	// Static background
-	Screen_background();
-	// Display date/time
-	EVE_cmdText(580, 20, 31, 0, timeString);
-	EVE_cmdText(750, 40, 28, 0, timeString2);
-	EVE_cmdText(580, 65, 29, 0, dateString);
-	// Display medication info / other info
-	EVE_cmdText(10, 150, 30, 0, printBuf);
-	EVE_cmdText(10, 65, 28, 0, deviceIdString);
+	EVE_cmdBGColor(BLACK);
+	// Only the nodes that changed are laid out again
+	Scene_draw(&screenScene);
+	EVE_burstReserve(8);
 	EVE_cmd(DL_DISPLAY);
 	EVE_cmd(CMD_SWAP);
 	EVE_sendBurst();
 }
 
+/*
+ * The only thread that talks to the EVE once the screen and speaker
+ * are initialised. Everything else reaches it through screenMbx or
+ * the interrupt flags.
+ */
 void *peripheralThreadProc(void *pArg)
 {
+	Screen_Msg msg;
+	uint8_t tag;
+
     delay(100);
+	screenDirty = true;
+
 	while(!peripheralThreadStop)
 	{
-	    Screen_update();
-	    usleep(SCREEN_UPDATE_INTERVAL_USEC);
+	    SMO_Power_service();
+	    Screen_applyPower();
+	    Lock_acquire(&screenLock);
+	    //every update queued since the last frame goes into one redraw
+	    while (Mailbox_pend(screenMbx, &msg, BIOS_NO_WAIT))
+	    {
+	        Screen_apply(&msg);
+	    }
+	    //the touch engine only runs while the EVE is active
+	    tag = TOUCH_TAG_NONE;
+	    if (screenTouch && screenPower == SCREEN_POWER_ACTIVE)
+	    {
+	        screenTouch = false;
+	        tag = Touch_read();
+	    }
+	    if (screenSound && screenPower == SCREEN_POWER_ACTIVE)
+	    {
+	        screenSound = false;
+	        Sound_service();
+	    }
+	    //nothing is drawn while the EVE is in standby or asleep
+	    if (screenDirty && screenPower == SCREEN_POWER_ACTIVE)
+	    {
+	        screenDirty = false;
+	        Screen_update();
+	    }
+	    Lock_release(&screenLock);
+	    Touch_dispatch(tag);
+	    Semaphore_pend(screenSem, BIOS_WAIT_FOREVER);
 	}
 	return NULL;
 }
 
 void Speaker_init(void)
 {
+	uint32_t used;
+
+	Lock_acquire(&screenLock);
 	EVE_setVolume(0x00);
-	//EVE_setSound(SQUAREWAVE, MIDI_C1);
-	EVE_setSound(ALARM, MIDI_C1);
-	EVE_startSound();
+	// Alert tones are played from RAM_G, the synth is the fallback
+	used = Sound_load(SCREEN_SOUND_ADDR, Screen_soundDue);
+	speakerTones = used != 0 && SCREEN_SOUND_ADDR + used <= RAM_G_WORKING;
+	if (!speakerTones)
+	{
+		//EVE_setSound(SQUAREWAVE, MIDI_C1);
+		EVE_setSound(ALARM, MIDI_C1);
+		EVE_startSound();
+	}
+	Lock_release(&screenLock);
     speakerOn = false;
 }
 
+/*
+ * Tone used by the next Speaker_play, one of the tones from sound_data.c
+ */
+void Speaker_setTone(uint8_t tone)
+{
+	speakerTone = tone;
+}
+
+uint8_t Speaker_toneCount(void)
+{
+	return speakerTones ? Sound_nTones : 1;
+}
+
+/*
+ * Ramp to vol playing the tone every periodMs, or continuously
+ * if periodMs is 0. A vol of 0 fades out.
+ */
+void Speaker_play(uint8_t vol, uint16_t periodMs)
+{
+	Screen_Msg msg;
+
+	msg.Type = SCREEN_MSG_SOUND;
+	msg.Arg.Sound.Tone = speakerTone;
+	msg.Arg.Sound.Volume = vol;
+	msg.Arg.Sound.PeriodMs = periodMs;
+	Screen_post(&msg);
+	speakerOn = vol != 0;
+}
+
 void Speaker_on(void)
 {
-	EVE_startSound();
-	EVE_setVolume(0xFF);
-	speakerOn = true;
+	Speaker_play(0xFF, 0);
 }
 
 void Speaker_off(void)
 {
-	EVE_stopSound();
-	EVE_setVolume(0x00);
-	speakerOn = false;
+	Speaker_play(0, 0);
+}
+
+void Speaker_setVolume(uint8_t vol)
+{
+	Speaker_play(vol, 0);
+}
+
+/*
+ * EVE synth fallback when the tones could not be loaded, on the
+ * peripheral thread only
+ */
+static void Speaker_synth(uint8_t vol)
+{
+	if (vol == 0)
+	{
+		EVE_stopSound();
+		EVE_setVolume(0x00);
+		return;
+	}
+	EVE_startSound();
+	EVE_setVolume(vol);
 }
@@ -10,22 +10,45 @@
 #ifndef PERIPHERALS_H
 #define PERIPHERALS_H
 
-void *peripheralThreadProc(void *pArg); //periodically update screen
+#include <stdint.h>
+
+#define SCREEN_POWER_ACTIVE     0
+#define SCREEN_POWER_STANDBY    1 //backlight off, EVE in STANDBY
+#define SCREEN_POWER_SLEEP      2 //backlight off, EVE in SLEEP
+#define SCREEN_COMPARTMENTS     6 //tiles along the bottom of the screen
+#define SCREEN_MAILBOX_SIZE     12 //updates queued for the peripheral thread
+#define SCREEN_TEXT_SIZE        256 //longest med info, date or device ID
+#define SCREEN_MED_SIZE         31 //longest med list line, terminated
+
+void *peripheralThreadProc(void *pArg); //owns the EVE, applies queued updates
 
 void LED_init(void);
 void LED_on(int nLed); //turn on the given LED (0-5)
 void LED_allOn(void);
 void LED_off(int nLed); //turn off the given LED (0-5)
 void LED_allOff(void);
+void LED_setBrightness(int nLed, uint8_t brightness);
 void Screen_init(void);
 void Screen_reset(void); //clear everything from the screen
 void Screen_updateTime(int Hour, int Min);
 void Screen_printMedInfo(char *MedInfo);
-void Screen_removeMedInfo(void);
+void Screen_showMedList(const char *const *Lines, uint8_t Shown); //Shown is a bit mask, shown Lines are copied
+void Screen_removeMedInfo(void); //also clears the compartments and alert progress
+void Screen_showCompartments(uint8_t Due, const uint8_t *nPills); //Due is a bit mask
+void Screen_clearCompartment(uint8_t Index);
+void Screen_setAlertProgress(uint16_t Value, uint16_t Range); //also shows the snooze button
 void Screen_printDeviceId(char *DeviceId);
 void Screen_updateDate(char *Date);
+void Screen_refresh(void); //redraw on the peripheral thread
+//Screen_* and Speaker_* updates are queued, safe from any thread or interrupt
+void Screen_touched(void); //EVE touch interrupt, safe from interrupts
+void Screen_setPower(uint8_t power); //one of SCREEN_POWER_*
 void Speaker_init(void);
 void Speaker_on(void);
 void Speaker_off(void);
+void Speaker_setVolume(uint8_t vol); //0 turns the speaker off
+void Speaker_setTone(uint8_t tone);
+uint8_t Speaker_toneCount(void);
+void Speaker_play(uint8_t vol, uint16_t periodMs); //ramped
 
 #endif
@@ -0,0 +1,212 @@
+#include <string.h>
+
+#include <ti/drivers/Power.h>
+#include <ti/drivers/power/PowerMSP432.h>
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/hal/Hwi.h>
+
+#include "load.h"
+#include "power.h"
+#include "peripherals.h"
+#include "rtc.h"
+#include "timer_wheel.h"
+
+typedef struct SMO_PowerControl
+{
+    void (*OnDisplayWake)(void);
+    TimerWheel_Timer IdleTimer; //one-shot for the next display step down
+    volatile uint8_t Display; //SMO_DisplayState
+    volatile uint8_t Target; //display state asked for, applied by SMO_Power_service
+    volatile bool Busy; //display stays on while set
+    uint32_t Since; //tick of the last display change
+    SMO_PowerStats Stats;
+    bool Ready;
+
+} SMO_PowerControl;
+
+static SMO_PowerControl SMO_PowerCtrl;
+
+static void SMO_Power_request(SMO_DisplayState State);
+static void SMO_Power_idle(void *Arg);
+
+void SMO_Power_init(void (*OnDisplayWake)(void))
+{
+    memset(&SMO_PowerCtrl, 0, sizeof(SMO_PowerCtrl));
+    SMO_PowerCtrl.OnDisplayWake = OnDisplayWake;
+    SMO_PowerCtrl.Display = SMO_DISPLAY_ACTIVE;
+    SMO_PowerCtrl.Target = SMO_DISPLAY_ACTIVE;
+    SMO_PowerCtrl.Since = TimerWheel_now();
+    SMO_PowerCtrl.Ready = true;
+
+    TimerWheel_start(&SMO_PowerCtrl.IdleTimer, SMO_POWER_STANDBY_MS, 0, SMO_Power_idle, NULL);
+}
+
+/*
+ * Idle loop policy, installed as the board's Power policy function.
+ * Runs with interrupts disabled and returns after the next wakeup.
+ */
+void SMO_Power_policy(void)
+{
+    SMO_PowerState State;
+    uint32_t Start;
+
+    Load_idle();
+    if (!SMO_PowerCtrl.Ready)
+    {
+        PowerMSP432_sleepPolicy();
+        return;
+    }
+
+    //drivers in the middle of a transfer hold off deep sleep
+    if (Power_getConstraintMask() & (1 << PowerMSP432_DISALLOW_DEEPSLEEP_0))
+    {
+        State = SMO_POWER_LPM0;
+    }
+    else
+    {
+        State = SMO_POWER_LPM3;
+    }
+
+    Start = TimerWheel_now();
+    if (State == SMO_POWER_LPM3)
+    {
+        PowerMSP432_deepSleepPolicy();
+    }
+    else
+    {
+        PowerMSP432_sleepPolicy();
+    }
+
+    SMO_PowerCtrl.Stats.Ticks[State] += TimerWheel_now() - Start;
+    SMO_PowerCtrl.Stats.Entries[State]++;
+}
+
+/*
+ * User or alert activity, keeps the display on for another
+ * standby period. Safe from interrupts.
+ */
+void SMO_Power_activity(void)
+{
+    if (!SMO_PowerCtrl.Ready)
+    {
+        return;
+    }
+
+    SMO_Power_request(SMO_DISPLAY_ACTIVE);
+    if (!SMO_PowerCtrl.Busy)
+    {
+        TimerWheel_start(&SMO_PowerCtrl.IdleTimer, SMO_POWER_STANDBY_MS, 0, SMO_Power_idle, NULL);
+    }
+}
+
+/*
+ * Hold the display on while an alert is running
+ */
+void SMO_Power_setBusy(bool Busy)
+{
+    if (!SMO_PowerCtrl.Ready || Busy == SMO_PowerCtrl.Busy)
+    {
+        return;
+    }
+
+    SMO_PowerCtrl.Busy = Busy;
+    if (Busy)
+    {
+        TimerWheel_stop(&SMO_PowerCtrl.IdleTimer);
+    }
+    SMO_Power_activity();
+}
+
+void SMO_Power_getStats(SMO_PowerStats *Stats)
+{
+    UInt Key;
+    uint32_t Now;
+
+    Key = Hwi_disable();
+    Now = TimerWheel_now();
+    memcpy(Stats, &SMO_PowerCtrl.Stats, sizeof(SMO_PowerStats));
+    Stats->DisplayTicks[SMO_PowerCtrl.Display] += Now - SMO_PowerCtrl.Since;
+    Hwi_restore(Key);
+
+    //whatever was not spent sleeping was spent running
+    Stats->Ticks[SMO_POWER_ACTIVE] = Now - Stats->Ticks[SMO_POWER_LPM0] - Stats->Ticks[SMO_POWER_LPM3];
+}
+
+/*
+ * Inactivity timer callback, steps the display down one state.
+ * Runs in the timer wheel interrupt, so it only asks for it.
+ */
+static void SMO_Power_idle(void *Arg)
+{
+    if (SMO_PowerCtrl.Busy)
+    {
+        return;
+    }
+
+    if (SMO_PowerCtrl.Target == SMO_DISPLAY_ACTIVE)
+    {
+        SMO_Power_request(SMO_DISPLAY_STANDBY);
+        TimerWheel_start(&SMO_PowerCtrl.IdleTimer, SMO_POWER_SLEEP_MS, 0, SMO_Power_idle, NULL);
+    }
+    else
+    {
+        SMO_Power_request(SMO_DISPLAY_SLEEP);
+    }
+}
+
+/*
+ * Ask for a display state and wake the peripheral thread to
+ * apply it. Safe from interrupts.
+ */
+static void SMO_Power_request(SMO_DisplayState State)
+{
+    SMO_PowerCtrl.Target = State;
+    if (State != SMO_PowerCtrl.Display)
+    {
+        Screen_refresh();
+    }
+}
+
+/*
+ * Apply the display state last asked for, on the peripheral
+ * thread before it applies the screen's power
+ */
+void SMO_Power_service(void)
+{
+    SMO_DisplayState State;
+    UInt Key;
+    uint32_t Now;
+
+    Key = Hwi_disable();
+    State = (SMO_DisplayState) SMO_PowerCtrl.Target;
+    if (!SMO_PowerCtrl.Ready || State == SMO_PowerCtrl.Display)
+    {
+        Hwi_restore(Key);
+        return;
+    }
+    Now = TimerWheel_now();
+    SMO_PowerCtrl.Stats.DisplayTicks[SMO_PowerCtrl.Display] += Now - SMO_PowerCtrl.Since;
+    SMO_PowerCtrl.Since = Now;
+    SMO_PowerCtrl.Display = State;
+    Hwi_restore(Key);
+
+    //the minute tick only matters while the time is on screen
+    RTC_enableMinuteTick(State == SMO_DISPLAY_ACTIVE);
+
+    switch (State)
+    {
+    case SMO_DISPLAY_ACTIVE:
+        Screen_setPower(SCREEN_POWER_ACTIVE);
+        if (SMO_PowerCtrl.OnDisplayWake != NULL)
+        {
+            SMO_PowerCtrl.OnDisplayWake();
+        }
+        break;
+    case SMO_DISPLAY_STANDBY:
+        Screen_setPower(SCREEN_POWER_STANDBY);
+        break;
+    default:
+        Screen_setPower(SCREEN_POWER_SLEEP);
+        break;
+    }
+}
@@ -0,0 +1,60 @@
+/************************************************************
+ * power.h
+ *
+ * Power manager. Replaces the board's idle policy so the
+ * MSP432 drops to LPM3 whenever no driver holds a deep
+ * sleep constraint, and LPM0 otherwise. The display is put
+ * into EVE STANDBY and then SLEEP after inactivity, and the
+ * RTC minute tick only runs while the display is active, so
+ * the device only wakes for the RTC alarm, the button, the
+ * SimpleLink host interrupt and timer wheel deadlines.
+ * Activity and the inactivity timer only ask for a display
+ * state, from any context, and the peripheral thread applies
+ * it with SMO_Power_service, as waking the display redraws
+ * the clock.
+ *
+ ************************************************************/
+
+#ifndef POWER_H
+#define POWER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SMO_POWER_STANDBY_MS    (2*60*1000UL) //inactivity before display standby
+#define SMO_POWER_SLEEP_MS      (10*60*1000UL) //further inactivity before display sleep
+
+typedef enum SMO_PowerState
+{
+    SMO_POWER_ACTIVE = 0, //CPU running
+    SMO_POWER_LPM0 = 1, //CPU sleeping, clocks on
+    SMO_POWER_LPM3 = 2, //deep sleep, only ACLK domain running
+    SMO_POWER_STATE_COUNT
+
+} SMO_PowerState;
+
+typedef enum SMO_DisplayState
+{
+    SMO_DISPLAY_ACTIVE = 0,
+    SMO_DISPLAY_STANDBY = 1, //backlight off, EVE clock gated
+    SMO_DISPLAY_SLEEP = 2, //EVE clock and PLL off
+    SMO_DISPLAY_STATE_COUNT
+
+} SMO_DisplayState;
+
+typedef struct SMO_PowerStats
+{
+    uint32_t Ticks[SMO_POWER_STATE_COUNT]; //timer wheel ticks spent in each CPU state
+    uint32_t Entries[SMO_POWER_STATE_COUNT]; //times each sleep state was entered
+    uint32_t DisplayTicks[SMO_DISPLAY_STATE_COUNT]; //ticks spent in each display state
+
+} SMO_PowerStats;
+
+void SMO_Power_init(void (*OnDisplayWake)(void));
+void SMO_Power_policy(void);
+void SMO_Power_activity(void); //safe from interrupts
+void SMO_Power_service(void); //peripheral thread only
+void SMO_Power_setBusy(bool Busy);
+void SMO_Power_getStats(SMO_PowerStats *Stats);
+
+#endif
@@ -0,0 +1,331 @@
+#include <string.h>
+
+#include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/hal/Hwi.h>
+#include <ti/sysbios/knl/Clock.h>
+#include <ti/sysbios/knl/Semaphore.h>
+
+#include "load.h"
+#include "profile.h"
+#include "uart_term.h"
+#include "ustdlib.h"
+
+#define PROFILE_RING_MASK       (PROFILE_RING_SIZE - 1)
+#define PROFILE_SYSTICK_INT     15 //SysTick exception number
+#define PROFILE_ITM_PORT        1 //stimulus port carrying task switches
+#define PROFILE_LINE_PCS        16 //PCs per @P line, keeps lines well inside the log buffer
+#define PROFILE_LINE_SIZE       (8 + PROFILE_LINE_PCS*9 + 3)
+#define PROFILE_UNLOCK          0xC5ACCE55 //CoreSight lock access key
+#define PROFILE_TPIU_NRZ        2 //TPIU pin protocol, asynchronous NRZ (UART)
+#define PROFILE_TPIU_NO_FORMAT  0x100 //TPIU formatter bypassed, ITM bytes go straight out
+
+_Static_assert((PROFILE_RING_SIZE & PROFILE_RING_MASK) == 0, "PROFILE_RING_SIZE is not a power of 2");
+_Static_assert(LOAD_MAX_TASKS < PROFILE_TASK_INTERRUPT, "interrupt id is a task id");
+
+typedef struct Profile_Control
+{
+    volatile uint8_t Mode; //Profile_Mode, read by the switch hook
+    uint16_t Rate;
+    uint32_t Session; //counts Profile_setMode calls that start the profiler
+    uint64_t Start[LOAD_MAX_TASKS]; //task cycle counts when the profiler started
+    uint64_t End[LOAD_MAX_TASKS]; //and when it stopped
+    Hwi_Handle SampleHwi;
+    Semaphore_Handle Ready; //wakes the profile thread
+    uint32_t Pc[PROFILE_RING_SIZE];
+    uint8_t Task[PROFILE_RING_SIZE];
+    volatile uint32_t Head; //written only by the sample ISR
+    volatile uint32_t Tail; //written only by the profile thread
+    uint32_t Samples;
+    uint32_t Dropped;
+
+} Profile_Control;
+
+typedef struct Profile_Stream
+{
+    bool Streaming; //@S sent, @E not yet
+    uint32_t Session; //session the stream belongs to
+    uint32_t Named; //tasks whose @T line was sent, one bit each
+
+} Profile_Stream;
+
+static Profile_Control Profile_Ctrl;
+static Profile_Stream Profile_Out; //used only by the profile thread
+
+static void Profile_sampleIsr(uintptr_t Arg);
+static void Profile_stopSampling(void);
+static uint16_t Profile_startUart(uint16_t Rate);
+static uint16_t Profile_startSwo(uint16_t Rate);
+static void Profile_flush(void);
+
+void Profile_init(void)
+{
+    Hwi_Params HwiParams;
+
+    Profile_Ctrl.Ready = Semaphore_create(0, NULL, NULL);
+    if (Profile_Ctrl.Ready == NULL)
+    {
+        UART_PRINT("Error creating profile semaphore\r\n");
+        while (1);
+    }
+
+    //SysTick only runs while the UART profiler is on
+    SysTick->CTRL = 0;
+    Hwi_Params_init(&HwiParams);
+    Profile_Ctrl.SampleHwi = Hwi_create(PROFILE_SYSTICK_INT, Profile_sampleIsr, &HwiParams, NULL);
+    if (Profile_Ctrl.SampleHwi == NULL)
+    {
+        UART_PRINT("Error creating profile interrupt\r\n");
+        while (1);
+    }
+}
+
+/*
+ * Called by the task switch hook with the id of the task switched to
+ */
+void Profile_taskSwitch(uint8_t Task)
+{
+    //a full stimulus FIFO reads as 0, the switch is lost rather than waited for
+    if (Profile_Ctrl.Mode == PROFILE_SWO && ITM->PORT[PROFILE_ITM_PORT].u32 != 0)
+    {
+        ITM->PORT[PROFILE_ITM_PORT].u8 = Task;
+    }
+}
+
+/*
+ * SysTick interrupt, samples the PC of the interrupted task
+ */
+static void Profile_sampleIsr(uintptr_t Arg)
+{
+    const uint32_t *Frame;
+    uint32_t Head = Profile_Ctrl.Head;
+
+    Profile_Ctrl.Samples++;
+    if (Head - Profile_Ctrl.Tail >= PROFILE_RING_SIZE)
+    {
+        Profile_Ctrl.Dropped++;
+        return;
+    }
+
+    //with no other exception active the interrupted code was a task, whose
+    //exception frame is on the process stack with the return address at [6]
+    if (SCB->ICSR & SCB_ICSR_RETTOBASE_Msk)
+    {
+        Frame = (const uint32_t *) __get_PSP();
+        Profile_Ctrl.Pc[Head & PROFILE_RING_MASK] = Frame[6];
+        Profile_Ctrl.Task[Head & PROFILE_RING_MASK] = Load_currentTask();
+    }
+    else
+    {
+        Profile_Ctrl.Pc[Head & PROFILE_RING_MASK] = 0;
+        Profile_Ctrl.Task[Head & PROFILE_RING_MASK] = PROFILE_TASK_INTERRUPT;
+    }
+    Profile_Ctrl.Head = Head + 1;
+
+    if (Head + 1 - Profile_Ctrl.Tail == PROFILE_RING_SIZE/2)
+    {
+        Semaphore_post(Profile_Ctrl.Ready);
+    }
+}
+
+static void Profile_stopSampling(void)
+{
+    SysTick->CTRL = 0;
+    DWT->CTRL &= ~DWT_CTRL_PCSAMPLENA_Msk;
+    ITM->TCR &= ~ITM_TCR_ITMENA_Msk;
+}
+
+static uint16_t Profile_startUart(uint16_t Rate)
+{
+    uint32_t Mclk = MAP_CS_getMCLK();
+    uint32_t Period;
+
+    //SysTick counts 24 bits, so the slowest rate is a few per second
+    Rate = Rate == 0 ? PROFILE_UART_RATE : Rate;
+    Period = Mclk / Rate;
+    Period = Period > SysTick_LOAD_RELOAD_Msk + 1 ? SysTick_LOAD_RELOAD_Msk + 1 : Period;
+
+    SysTick->LOAD = Period - 1;
+    SysTick->VAL = 0;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+
+    return Mclk / (SysTick->LOAD + 1);
+}
+
+static uint16_t Profile_startSwo(uint16_t Rate)
+{
+    uint32_t Mclk = MAP_CS_getMCLK();
+    uint32_t Divider;
+
+    //a sample every 1024*(POSTPRESET + 1) cycles, POSTPRESET is 4 bits
+    Rate = Rate == 0 ? PROFILE_SWO_RATE : Rate;
+    Divider = Mclk / 1024 / Rate;
+    Divider = Divider < 1 ? 1 : Divider > 16 ? 16 : Divider;
+
+    TPI->SPPR = PROFILE_TPIU_NRZ;
+    TPI->ACPR = Mclk / PROFILE_SWO_BAUD - 1;
+    TPI->FFCR = PROFILE_TPIU_NO_FORMAT;
+
+    ITM->LAR = PROFILE_UNLOCK;
+    ITM->TCR = (1 << ITM_TCR_TraceBusID_Pos) | ITM_TCR_SYNCENA_Msk | ITM_TCR_DWTENA_Msk | ITM_TCR_ITMENA_Msk;
+    ITM->TPR = 0;
+    ITM->TER = 1 << PROFILE_ITM_PORT;
+
+    DWT->CTRL = (DWT->CTRL & ~(DWT_CTRL_POSTPRESET_Msk | DWT_CTRL_POSTINIT_Msk))
+              | ((Divider - 1) << DWT_CTRL_POSTPRESET_Pos) | DWT_CTRL_CYCTAP_Msk
+              | DWT_CTRL_PCSAMPLENA_Msk | DWT_CTRL_CYCCNTENA_Msk;
+
+    return Mclk / 1024 / Divider;
+}
+
+/*
+ * Start, restart or stop the profiler. Cycle counts and sample
+ * counts start from zero each time it is started and are kept
+ * when it stops, so they can be read afterwards.
+ */
+int Profile_setMode(uint8_t Mode, uint16_t Rate)
+{
+    UInt Key;
+
+    if (Mode != PROFILE_OFF && Mode != PROFILE_UART && Mode != PROFILE_SWO)
+    {
+        return -1;
+    }
+
+    Key = Hwi_disable();
+    Profile_stopSampling();
+    if (Mode != PROFILE_OFF)
+    {
+        Load_getCycles(Profile_Ctrl.Start);
+        Profile_Ctrl.Samples = 0;
+        Profile_Ctrl.Dropped = 0;
+        Profile_Ctrl.Rate = Mode == PROFILE_UART ? Profile_startUart(Rate) : Profile_startSwo(Rate);
+        Profile_Ctrl.Session++;
+    }
+    else if (Profile_Ctrl.Mode != PROFILE_OFF)
+    {
+        Load_getCycles(Profile_Ctrl.End);
+    }
+    Profile_Ctrl.Mode = Mode;
+    Hwi_restore(Key);
+
+    //the profile thread starts or ends the UART stream
+    Semaphore_post(Profile_Ctrl.Ready);
+
+    return Mode == PROFILE_OFF ? 0 : Profile_Ctrl.Rate;
+}
+
+void Profile_getStats(Profile_Stats *Stats)
+{
+    uint64_t Now[LOAD_MAX_TASKS];
+    const uint64_t *End;
+    int i;
+    UInt Key;
+
+    memset(Stats, 0, sizeof(*Stats));
+
+    Key = Hwi_disable();
+    Stats->Mode = Profile_Ctrl.Mode;
+    Stats->nTasks = Load_taskCount();
+    Stats->Rate = Profile_Ctrl.Mode == PROFILE_OFF ? 0 : Profile_Ctrl.Rate;
+    Stats->Samples = Profile_Ctrl.Samples;
+    Stats->Dropped = Profile_Ctrl.Dropped;
+
+    //cycles over the run, up to now if it is still going
+    Load_getCycles(Now);
+    End = Profile_Ctrl.Mode == PROFILE_OFF ? Profile_Ctrl.End : Now;
+    for (i = 0; i < Stats->nTasks; i++)
+    {
+        memcpy(Stats->Tasks[i].Name, Load_taskName(i), LOAD_NAME_SIZE);
+        Stats->Tasks[i].Cycles = End[i] - Profile_Ctrl.Start[i];
+    }
+    Hwi_restore(Key);
+}
+
+/*
+ * Stream the queued UART samples, see profile.h for the lines
+ */
+static void Profile_flush(void)
+{
+    Profile_Stream *Out = &Profile_Out;
+    Profile_Stats Stats;
+    char Line[PROFILE_LINE_SIZE];
+    char Name[LOAD_NAME_SIZE + 1];
+    uint32_t Tail;
+    uint8_t Task;
+    int i, n, Len;
+
+    if (Profile_Ctrl.Mode == PROFILE_UART && (!Out->Streaming || Out->Session != Profile_Ctrl.Session))
+    {
+        if (Out->Streaming)
+        {
+            usnprintf(Line, sizeof(Line), "@E %u %u\r\n", Profile_Ctrl.Samples, Profile_Ctrl.Dropped);
+            Message(Line);
+        }
+        Out->Streaming = true;
+        Out->Session = Profile_Ctrl.Session;
+        Out->Named = 0;
+        usnprintf(Line, sizeof(Line), "@S %u %u\r\n", Profile_Ctrl.Rate, MAP_CS_getMCLK());
+        Message(Line);
+    }
+    if (!Out->Streaming)
+    {
+        //samples left from a stream that already ended
+        Profile_Ctrl.Tail = Profile_Ctrl.Head;
+        return;
+    }
+
+    //tasks named since the last flush
+    for (i = 0; i < Load_taskCount(); i++)
+    {
+        if (!(Out->Named & (1UL << i)) && Load_taskName(i)[0] != '\0')
+        {
+            memcpy(Name, Load_taskName(i), LOAD_NAME_SIZE);
+            Name[LOAD_NAME_SIZE] = '\0';
+            usnprintf(Line, sizeof(Line), "@T %u %s\r\n", i, Name);
+            Message(Line);
+            Out->Named |= 1UL << i;
+        }
+    }
+
+    //one line per run of samples from the same task
+    Tail = Profile_Ctrl.Tail;
+    while (Tail != Profile_Ctrl.Head)
+    {
+        Task = Profile_Ctrl.Task[Tail & PROFILE_RING_MASK];
+        Len = usnprintf(Line, sizeof(Line), "@P %u", Task);
+        for (n = 0; n < PROFILE_LINE_PCS && Tail != Profile_Ctrl.Head
+                    && Profile_Ctrl.Task[Tail & PROFILE_RING_MASK] == Task; n++, Tail++)
+        {
+            Len += usnprintf(&Line[Len], sizeof(Line) - Len, " %x", Profile_Ctrl.Pc[Tail & PROFILE_RING_MASK]);
+        }
+        usnprintf(&Line[Len], sizeof(Line) - Len, "\r\n");
+        Message(Line);
+        Profile_Ctrl.Tail = Tail;
+    }
+
+    if (Profile_Ctrl.Mode != PROFILE_UART)
+    {
+        //the counts are only this stream's if the profiler stopped, not if it moved to SWO
+        Profile_getStats(&Stats);
+        for (i = 0; i < Stats.nTasks && Stats.Mode == PROFILE_OFF; i++)
+        {
+            usnprintf(Line, sizeof(Line), "@C %u %x%08x\r\n", i,
+                      (uint32_t) (Stats.Tasks[i].Cycles >> 32), (uint32_t) Stats.Tasks[i].Cycles);
+            Message(Line);
+        }
+        usnprintf(Line, sizeof(Line), "@E %u %u\r\n", Stats.Samples, Stats.Dropped);
+        Message(Line);
+        Out->Streaming = false;
+    }
+}
+
+void *profileThreadProc(void *pArg)
+{
+    while (1)
+    {
+        Semaphore_pend(Profile_Ctrl.Ready, Profile_Ctrl.Mode == PROFILE_UART
+                       ? PROFILE_FLUSH_MS*1000 / Clock_tickPeriod : BIOS_WAIT_FOREVER);
+        Profile_flush();
+    }
+}
@@ -0,0 +1,85 @@
+/************************************************************
+ * profile.h
+ *
+ * Sampling profiler, switched on and off at runtime with a
+ * profile request (type 0x9D) over UDP. While it runs, the
+ * PC is sampled one of two ways, and each task's cycles
+ * over the run are taken from the load counters (load.h):
+ *
+ * PROFILE_UART: SysTick interrupts at the requested rate and
+ * takes the PC from the interrupted task's exception frame.
+ * Samples taken over another interrupt are only counted as
+ * interrupt time. The profile thread streams the samples as
+ * text lines between the normal log output:
+ *   @S <rate> <cpu hz>         stream started
+ *   @T <task> <name>           task id to name
+ *   @P <task> <pc> <pc> ...    PC samples in hex
+ *   @C <task> <cycles>         cycles per task, at the end
+ *   @E <samples> <dropped>     stream ended
+ *
+ * PROFILE_SWO: the DWT samples the PC in hardware, ISRs and
+ * critical sections included, and the ITM sends the samples
+ * and the id of every task switched to (stimulus port 1)
+ * out of the SWO pin at PROFILE_SWO_BAUD for the debug probe
+ * to capture. The UART stays quiet.
+ *
+ * Task ids and names are the load module's.
+ * tools/smoprofile.py turns either stream into folded
+ * stacks and a flame graph. When off, the only cost is a
+ * flag test in the task switch hook.
+ *
+ * The kernel's Clock must not run on SysTick (the MSP432
+ * kernel uses Timer_A). The cycle counter and SysTick stop
+ * in LPM3, so deep sleep shows up in the power stats, not
+ * as idle time here.
+ *
+ ************************************************************/
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "load.h"
+
+#define PROFILE_RING_SIZE       512 //UART samples buffered for the profile thread, power of 2
+#define PROFILE_FLUSH_MS        100 //longest a UART sample waits to be streamed
+#define PROFILE_UART_RATE       200 //default samples per second, 115200 baud keeps up to ~1000
+#define PROFILE_SWO_RATE        3000 //default samples per second over SWO
+#define PROFILE_SWO_BAUD        2000000 //NRZ bit rate of the SWO pin
+#define PROFILE_TASK_INTERRUPT  0xFF //task id of samples taken over another interrupt
+
+typedef enum Profile_Mode
+{
+    PROFILE_OFF = 0,
+    PROFILE_UART = 1, //SysTick samples streamed on the UART
+    PROFILE_SWO = 2, //DWT samples and task switches sent by the ITM
+
+} Profile_Mode;
+
+typedef struct Profile_Task
+{
+    char Name[LOAD_NAME_SIZE];
+    uint64_t Cycles; //cycles spent running the task since profiling started
+
+} Profile_Task;
+
+typedef struct Profile_Stats
+{
+    uint8_t Mode; //Profile_Mode
+    uint8_t nTasks;
+    uint16_t Rate; //samples per second in use
+    uint32_t Samples; //UART samples taken since profiling started
+    uint32_t Dropped; //UART samples lost to a full ring
+    Profile_Task Tasks[LOAD_MAX_TASKS];
+
+} Profile_Stats;
+
+void Profile_init(void);
+int Profile_setMode(uint8_t Mode, uint16_t Rate); //returns the rate in use, negative if Mode is unknown
+void Profile_getStats(Profile_Stats *Stats);
+void Profile_taskSwitch(uint8_t Task); //from the load module's switch hook
+void *profileThreadProc(void *pArg);
+
+#endif
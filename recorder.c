@@ -0,0 +1,162 @@
+#include <string.h>
+
+#include <ti/sysbios/hal/Hwi.h>
+
+#include "recorder.h"
+#include "smo_wire.h"
+#include "timer_wheel.h"
+
+#define RECORDER_RING_MASK  (RECORDER_RING_SIZE - 1)
+
+_Static_assert((RECORDER_RING_SIZE & RECORDER_RING_MASK) == 0, "RECORDER_RING_SIZE is not a power of 2");
+_Static_assert(SMO_WIRE_REC_DATA + RECORDER_MAX_DATA <= RECORDER_EXPORT_MAX_BYTES, "a record must fit one export");
+
+typedef struct Recorder_Control
+{
+    uint8_t Ring[RECORDER_RING_SIZE];
+    uint32_t Head; //cursor of the next byte logged
+    uint32_t Tail; //cursor of the oldest whole record
+    uint32_t Next; //cursor the last read stopped at, a record boundary
+    Recorder_Stats Stats;
+
+} Recorder_Control;
+
+//zero initialised, so inputs are recorded from the first interrupt
+static Recorder_Control Recorder_Ctrl;
+
+static void Recorder_copyIn(uint32_t Cursor, const uint8_t *Src, uint32_t Len)
+{
+    uint32_t Offset = Cursor & RECORDER_RING_MASK;
+    uint32_t Run = Len < RECORDER_RING_SIZE - Offset ? Len : RECORDER_RING_SIZE - Offset;
+
+    memcpy(&Recorder_Ctrl.Ring[Offset], Src, Run);
+    memcpy(Recorder_Ctrl.Ring, Src + Run, Len - Run);
+}
+
+static void Recorder_copyOut(uint32_t Cursor, uint8_t *Dst, uint32_t Len)
+{
+    uint32_t Offset = Cursor & RECORDER_RING_MASK;
+    uint32_t Run = Len < RECORDER_RING_SIZE - Offset ? Len : RECORDER_RING_SIZE - Offset;
+
+    memcpy(Dst, &Recorder_Ctrl.Ring[Offset], Run);
+    memcpy(Dst + Run, Recorder_Ctrl.Ring, Len - Run);
+}
+
+/*
+ * Size of the record at Cursor, header included
+ */
+static uint32_t Recorder_size(uint32_t Cursor)
+{
+    uint8_t Length[2];
+
+    Recorder_copyOut(Cursor + SMO_WIRE_REC_LENGTH, Length, sizeof(Length));
+    return SMO_WIRE_REC_DATA + SMO_Wire_get16(Length);
+}
+
+/*
+ * Whether Cursor is the start of a record still in the ring, or
+ * the head. Cursors handed out by the last read are known to be,
+ * any other is checked by walking the records from the tail.
+ */
+static bool Recorder_isRecord(uint32_t Cursor)
+{
+    uint32_t Walk;
+
+    if (Cursor - Recorder_Ctrl.Tail > Recorder_Ctrl.Head - Recorder_Ctrl.Tail)
+    {
+        return false;
+    }
+    if (Cursor == Recorder_Ctrl.Next)
+    {
+        return true;
+    }
+
+    for (Walk = Recorder_Ctrl.Tail; Walk - Recorder_Ctrl.Tail < Cursor - Recorder_Ctrl.Tail;)
+    {
+        Walk += Recorder_size(Walk);
+    }
+    return Walk == Cursor;
+}
+
+void Recorder_log(uint8_t Type, const void *Data, uint16_t Len)
+{
+    uint8_t Header[SMO_WIRE_REC_DATA];
+    uint32_t Size = SMO_WIRE_REC_DATA + Len;
+    UInt Key;
+
+    Key = Hwi_disable();
+    if (Len > RECORDER_MAX_DATA)
+    {
+        Recorder_Ctrl.Stats.TooLong++;
+        Hwi_restore(Key);
+        return;
+    }
+
+    //the tick is taken with interrupts off, so records are in tick order
+    Header[SMO_WIRE_REC_TYPE] = Type;
+    Header[SMO_WIRE_REC_TYPE + 1] = 0;
+    SMO_Wire_put16(&Header[SMO_WIRE_REC_LENGTH], Len);
+    SMO_Wire_put32(&Header[SMO_WIRE_REC_TICK], TimerWheel_now());
+
+    //make room by dropping the oldest records
+    while (Recorder_Ctrl.Head + Size - Recorder_Ctrl.Tail > RECORDER_RING_SIZE)
+    {
+        Recorder_Ctrl.Tail += Recorder_size(Recorder_Ctrl.Tail);
+        Recorder_Ctrl.Stats.Dropped++;
+    }
+
+    Recorder_copyIn(Recorder_Ctrl.Head, Header, sizeof(Header));
+    Recorder_copyIn(Recorder_Ctrl.Head + SMO_WIRE_REC_DATA, Data, Len);
+    Recorder_Ctrl.Head += Size;
+    Recorder_Ctrl.Stats.Records++;
+    Hwi_restore(Key);
+}
+
+/*
+ * Copy the records from Cursor on into Buf, as many whole records as
+ * fit in MaxBytes but always at least one, so Buf must have room for
+ * RECORDER_EXPORT_MAX_BYTES. A cursor that is not the start of a
+ * record in the ring, because it was overwritten or was never a
+ * record boundary, reads from the oldest record instead, see
+ * FirstCursor. Returns the bytes copied.
+ */
+int Recorder_read(uint32_t Cursor, uint8_t *Buf, int MaxBytes,
+                  uint32_t *FirstCursor, uint32_t *HeadCursor)
+{
+    int nBytes = 0;
+    uint32_t Size;
+    UInt Key;
+
+    //copies at most one export, short enough to keep interrupts off
+    Key = Hwi_disable();
+
+    if (!Recorder_isRecord(Cursor))
+    {
+        Cursor = Recorder_Ctrl.Tail;
+    }
+    *FirstCursor = Cursor;
+
+    while (Cursor != Recorder_Ctrl.Head)
+    {
+        Size = Recorder_size(Cursor);
+        if (nBytes > 0 && nBytes + (int) Size > MaxBytes)
+        {
+            break;
+        }
+        Recorder_copyOut(Cursor, &Buf[nBytes], Size);
+        nBytes += Size;
+        Cursor += Size;
+    }
+    Recorder_Ctrl.Next = Cursor;
+    *HeadCursor = Recorder_Ctrl.Head;
+    Hwi_restore(Key);
+
+    return nBytes;
+}
+
+void Recorder_getStats(Recorder_Stats *Stats)
+{
+    UInt Key = Hwi_disable();
+    *Stats = Recorder_Ctrl.Stats;
+    Hwi_restore(Key);
+}
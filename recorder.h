@@ -0,0 +1,50 @@
+/************************************************************
+ * recorder.h
+ *
+ * Input recorder for reproducing field issues. Everything
+ * the event logic reacts to from outside is logged where
+ * it crosses the driver boundary: decrypted UDP packets,
+ * RTC interrupt status, okay button edges and the SNTP
+ * time. Each record carries the timer wheel tick it was
+ * taken at, in a RAM byte ring that overwrites its oldest
+ * records and is exported over UDP. host/replay.c feeds a
+ * recording back into the host build at the same ticks.
+ *
+ * Records are stored in wire format (smo_wire.h), so an
+ * export is a plain copy of the ring.
+ *
+ ************************************************************/
+
+#ifndef RECORDER_H
+#define RECORDER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define RECORDER_RING_SIZE          4096 //bytes, power of 2
+#define RECORDER_MAX_DATA           256 //largest payload, a whole decrypted packet buffer
+#define RECORDER_EXPORT_MAX_BYTES   1440 //keeps a response within one UDP datagram
+
+typedef enum Recorder_Type
+{
+    RECORDER_PACKET = 1, //decrypted packet as passed to the handlers
+    RECORDER_RTC = 2, //RTC interrupt status, 4 bytes
+    RECORDER_BUTTON = 3, //okay button level after an edge, 1 byte
+    RECORDER_SNTP = 4, //NTP seconds from the time server, 4 bytes
+
+} Recorder_Type;
+
+typedef struct Recorder_Stats
+{
+    uint32_t Records; //records logged since boot
+    uint32_t Dropped; //records pushed out of the ring by newer ones
+    uint32_t TooLong; //records over RECORDER_MAX_DATA, not logged
+
+} Recorder_Stats;
+
+void Recorder_log(uint8_t Type, const void *Data, uint16_t Len); //safe from interrupts
+int Recorder_read(uint32_t Cursor, uint8_t *Buf, int MaxBytes,
+                  uint32_t *FirstCursor, uint32_t *HeadCursor); //whole records only, at least one
+void Recorder_getStats(Recorder_Stats *Stats);
+
+#endif
@@ -2,9 +2,18 @@
 
 #include <ti/devices/msp432p4xx/driverlib/driverlib.h>
 #include <ti/sysbios/family/arm/msp432/Seconds.h>
+#include <ti/sysbios/hal/Hwi.h>
 
 #include "rtc.h"
 
+struct RTC_Control
+{
+    Hwi_Handle RtcHwi;
+
+};
+
+static struct RTC_Control RTC_Ctrl;
+
 void RTC_init(void)
 {
     MAP_WDT_A_holdTimer();
@@ -74,3 +83,16 @@ void RTC_setAlarm(uint_fast8_t Minutes,
 {
     MAP_RTC_C_setCalendarAlarm(Minutes, Hours, DoW, DoM);
 }
+
+void RTC_enableMinuteTick(bool Enable)
+{
+    if (Enable)
+    {
+        MAP_RTC_C_clearInterruptFlag(RTC_C_TIME_EVENT_INTERRUPT);
+        MAP_RTC_C_enableInterrupt(RTC_C_TIME_EVENT_INTERRUPT);
+    }
+    else
+    {
+        MAP_RTC_C_disableInterrupt(RTC_C_TIME_EVENT_INTERRUPT);
+    }
+}
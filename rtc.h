@@ -1,16 +1,9 @@
 #ifndef RTC_H
 #define RTC_H
 
-#include <ti/sysbios/hal/Hwi.h>
-
-struct RTC_Control
-{
-    Hwi_Handle RtcHwi;
-
-};
-
-//global variable for RTC
-static struct RTC_Control RTC_Ctrl;
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
 
 //interrupt handler
 extern void RTC_C_IRQHandler(uintptr_t Arg);
@@ -24,5 +17,6 @@ void RTC_setAlarm(uint_fast8_t Minutes,
                    uint_fast8_t Hours,
                    uint_fast8_t DoW,
                    uint_fast8_t DoM);
+void RTC_enableMinuteTick(bool Enable); //off while nothing shows the time
 
 #endif /* RTC_H */
@@ -0,0 +1,372 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "scene.h"
+#include "EVE.h"
+
+static void Scene_reset(Scene_Node *Node, uint8_t Type, int16_t X, int16_t Y);
+static void Scene_emit(Scene_Node *Node);
+static void Scene_emitText(int16_t X, int16_t Y, int16_t RomFont, uint16_t Options, const char *Text);
+static void Scene_emitList(Scene_Node *Node);
+static void Scene_emitRect(int16_t X, int16_t Y, uint16_t W, uint16_t H, uint16_t Radius);
+
+void Scene_init(Scene *Scn)
+{
+    Scn->First = NULL;
+    Scn->Last = NULL;
+}
+
+/*
+ * Append a node, drawn after (on top of) the ones before it. Cache
+ * may be NULL, then the node is serialised on every draw.
+ */
+void Scene_add(Scene *Scn, Scene_Node *Node, uint8_t *Cache, uint16_t CacheSize)
+{
+    Node->Next = NULL;
+    Node->Cache = Cache;
+    Node->CacheSize = CacheSize > SCENE_MAX_CACHE ? SCENE_MAX_CACHE : CacheSize;
+    Node->CacheLen = 0;
+    Node->Dirty = true;
+
+    if (Scn->Last == NULL)
+    {
+        Scn->First = Node;
+    }
+    else
+    {
+        Scn->Last->Next = Node;
+    }
+    Scn->Last = Node;
+}
+
+void Scene_text(Scene_Node *Node, int16_t X, int16_t Y, int16_t RomFont, uint16_t Options,
+                uint32_t Color, char *Text)
+{
+    Scene_reset(Node, SCENE_TEXT, X, Y);
+    Node->RomFont = RomFont;
+    Node->Options = Options;
+    Node->Color = Color;
+    Node->Text = Text;
+}
+
+/*
+ * Lines whose bit is set in the node's Value are drawn one below
+ * the other, skipping empty strings. The strings are read when the
+ * node is drawn, so the caller invalidates it when they change.
+ */
+void Scene_list(Scene_Node *Node, int16_t X, int16_t Y, int16_t RomFont, uint16_t LineHeight,
+                uint32_t Color, const char *const *Lines, uint8_t nLines)
+{
+    Scene_reset(Node, SCENE_LIST, X, Y);
+    Node->RomFont = RomFont;
+    Node->H = LineHeight;
+    Node->Color = Color;
+    Node->Lines = Lines;
+    Node->Range = nLines;
+}
+
+void Scene_setFont(Scene_Node *Node, Font *Fnt, uint16_t MaxWidth)
+{
+    Node->Fnt = Fnt;
+    Node->W = MaxWidth;
+    Node->Dirty = true;
+}
+
+void Scene_bitmap(Scene_Node *Node, int16_t X, int16_t Y, Asset *Ast, uint8_t Handle)
+{
+    Scene_reset(Node, SCENE_BITMAP, X, Y);
+    Node->Ast = Ast;
+    Node->Handle = Handle;
+}
+
+void Scene_rect(Scene_Node *Node, int16_t X, int16_t Y, uint16_t W, uint16_t H,
+                uint16_t Radius, uint32_t Color)
+{
+    Scene_reset(Node, SCENE_RECT, X, Y);
+    Node->W = W;
+    Node->H = H;
+    Node->Value = Radius;
+    Node->Color = Color;
+}
+
+void Scene_progress(Scene_Node *Node, int16_t X, int16_t Y, uint16_t W, uint16_t H,
+                    uint16_t Range, uint32_t Color)
+{
+    Scene_reset(Node, SCENE_PROGRESS, X, Y);
+    Node->W = W;
+    Node->H = H;
+    Node->Range = Range;
+    Node->Color = Color;
+}
+
+void Scene_tile(Scene_Node *Node, int16_t X, int16_t Y, uint16_t W, uint16_t H,
+                uint32_t Color, char *Label)
+{
+    Scene_reset(Node, SCENE_TILE, X, Y);
+    Node->W = W;
+    Node->H = H;
+    Node->Color = Color;
+    Node->Text = Label;
+}
+
+void Scene_button(Scene_Node *Node, int16_t X, int16_t Y, uint16_t W, uint16_t H,
+                  int16_t RomFont, uint32_t Color, char *Label)
+{
+    Scene_reset(Node, SCENE_BUTTON, X, Y);
+    Node->W = W;
+    Node->H = H;
+    Node->RomFont = RomFont;
+    Node->Color = Color;
+    Node->Text = Label;
+}
+
+/*
+ * The setters only invalidate a node when something changed, so
+ * callers can set the same state every time without a cost.
+ */
+void Scene_setTag(Scene_Node *Node, uint8_t Tag)
+{
+    if (Node->Tag != Tag)
+    {
+        Node->Tag = Tag;
+        Node->Dirty = true;
+    }
+}
+
+void Scene_setValue(Scene_Node *Node, uint16_t Value)
+{
+    if (Node->Value != Value)
+    {
+        Node->Value = Value;
+        Node->Dirty = true;
+    }
+}
+
+void Scene_setRange(Scene_Node *Node, uint16_t Range)
+{
+    if (Node->Range != Range)
+    {
+        Node->Range = Range;
+        Node->Dirty = true;
+    }
+}
+
+void Scene_setHighlight(Scene_Node *Node, bool Highlight)
+{
+    if (Node->Highlight != Highlight)
+    {
+        Node->Highlight = Highlight;
+        Node->Dirty = true;
+    }
+}
+
+void Scene_setHidden(Scene_Node *Node, bool Hidden)
+{
+    if (Node->Hidden != Hidden)
+    {
+        Node->Hidden = Hidden;
+        Node->Dirty = true;
+    }
+}
+
+void Scene_invalidate(Scene_Node *Node)
+{
+    Node->Dirty = true;
+}
+
+/*
+ * Draw every visible node into the current burst. Clean nodes are
+ * copied from their caches, dirty ones are serialised straight into
+ * the burst and the bytes kept if they fit the cache and were not
+ * split by a flush.
+ */
+void Scene_draw(Scene *Scn)
+{
+    Scene_Node *Node;
+    uint32_t Count;
+    int Start;
+
+    EVE_burstReserve(4);
+    EVE_cmd(VERTEX_FORMAT(0));
+
+    for (Node = Scn->First; Node != NULL; Node = Node->Next)
+    {
+        if (!Node->Dirty && Node->CacheLen != 0)
+        {
+            EVE_burstData(Node->Cache, Node->CacheLen);
+            continue;
+        }
+
+        //cleared first, so a change made while serialising is not lost
+        Node->Dirty = false;
+        Node->CacheLen = 0;
+        if (Node->Hidden)
+        {
+            continue;
+        }
+
+        EVE_burstReserve(Node->CacheSize);
+        Count = EVE_burstCount();
+        Start = txIdx;
+        Scene_emit(Node);
+        if (Node->Cache != NULL && EVE_burstCount() == Count && txIdx - Start <= Node->CacheSize)
+        {
+            memcpy(Node->Cache, &txBuf[Start], txIdx - Start);
+            Node->CacheLen = txIdx - Start;
+        }
+    }
+}
+
+static void Scene_reset(Scene_Node *Node, uint8_t Type, int16_t X, int16_t Y)
+{
+    Node->Type = Type;
+    Node->Tag = 0;
+    Node->X = X;
+    Node->Y = Y;
+    Node->W = 0;
+    Node->H = 0;
+    Node->Color = 0xFFFFFFUL;
+    Node->Text = NULL;
+    Node->Lines = NULL;
+    Node->RomFont = 0;
+    Node->Options = 0;
+    Node->Fnt = NULL;
+    Node->Ast = NULL;
+    Node->Handle = 0;
+    Node->Value = 0;
+    Node->Range = 0;
+    Node->Highlight = false;
+    Node->Hidden = false;
+    Node->Dirty = true;
+}
+
+static void Scene_emit(Scene_Node *Node)
+{
+    char Count[8];
+
+    //every node sets its tag, so untagged ones don't take the last one
+    EVE_burstReserve(4);
+    EVE_cmd(TAG(Node->Tag));
+
+    switch (Node->Type)
+    {
+    case SCENE_TEXT:
+        EVE_burstReserve(4);
+        EVE_colorRGB(Node->Color);
+        if (Node->Fnt != NULL)
+        {
+            Font_bind(Node->Fnt);
+            Font_drawText(Node->Fnt, Node->X, Node->Y, Node->W, Node->Text);
+        }
+        else
+        {
+            Scene_emitText(Node->X, Node->Y, Node->RomFont, Node->Options, Node->Text);
+        }
+        break;
+    case SCENE_LIST:
+        EVE_burstReserve(4);
+        EVE_colorRGB(Node->Color);
+        Scene_emitList(Node);
+        break;
+    case SCENE_BITMAP:
+        EVE_burstReserve(4);
+        EVE_colorRGB(0xFFFFFFUL);
+        Asset_draw(Node->Ast, Node->Handle, Node->X, Node->Y);
+        break;
+    case SCENE_RECT:
+        EVE_burstReserve(4);
+        EVE_colorRGB(Node->Color);
+        Scene_emitRect(Node->X, Node->Y, Node->W, Node->H, Node->Value);
+        break;
+    case SCENE_PROGRESS:
+        EVE_burstReserve(32);
+        EVE_colorRGB(Node->Color);
+        EVE_cmdBGColor(SCENE_PROGRESS_BG);
+        EVE_cmdProgress(Node->X, Node->Y, Node->W, Node->H, OPT_FLAT, Node->Value, Node->Range);
+        break;
+    case SCENE_TILE:
+        //border, then the fill inset by 2 pixels, then the label
+        EVE_burstReserve(4);
+        EVE_colorRGB(Node->Highlight ? Node->Color : SCENE_TILE_BORDER);
+        Scene_emitRect(Node->X, Node->Y, Node->W, Node->H, 8);
+        EVE_burstReserve(4);
+        EVE_colorRGB(Node->Highlight ? Node->Color : SCENE_TILE_FILL);
+        Scene_emitRect(Node->X + 2, Node->Y + 2, Node->W - 4, Node->H - 4, 6);
+        EVE_burstReserve(4);
+        EVE_colorRGB(Node->Highlight ? SCENE_TILE_FILL : SCENE_TILE_BORDER);
+        if (Node->Highlight && Node->Value != 0)
+        {
+            Scene_emitText(Node->X + Node->W/2, Node->Y + Node->H/3, 29, OPT_CENTER, Node->Text);
+            snprintf(Count, sizeof(Count), "x%u", Node->Value);
+            Scene_emitText(Node->X + Node->W/2, Node->Y + 3*Node->H/4, 27, OPT_CENTER, Count);
+        }
+        else
+        {
+            Scene_emitText(Node->X + Node->W/2, Node->Y + Node->H/2, 29, OPT_CENTER, Node->Text);
+        }
+        break;
+    case SCENE_BUTTON:
+        EVE_burstReserve(12);
+        EVE_colorRGB(0xFFFFFFUL);
+        EVE_cmdFGColor(Node->Color);
+        EVE_burstReserve(16 + strlen(Node->Text));
+        EVE_cmdButton(Node->X, Node->Y, Node->W, Node->H, Node->RomFont, OPT_FLAT, Node->Text);
+        break;
+    default:
+        break;
+    }
+}
+
+static void Scene_emitText(int16_t X, int16_t Y, int16_t RomFont, uint16_t Options, const char *Text)
+{
+    //command, string and up to 4 bytes of terminator and padding
+    EVE_burstReserve(16 + strlen(Text));
+    EVE_cmdText(X, Y, RomFont, Options, (char *) Text);
+}
+
+static void Scene_emitList(Scene_Node *Node)
+{
+    const char *Line;
+    int16_t Y = Node->Y;
+    uint8_t i;
+
+    if (Node->Fnt != NULL)
+    {
+        Font_bind(Node->Fnt);
+    }
+    for (i = 0; i < Node->Range; ++i)
+    {
+        Line = Node->Lines[i];
+        if ((Node->Value & (1 << i)) == 0 || Line == NULL || Line[0] == '\0')
+        {
+            continue;
+        }
+        if (Node->Fnt != NULL)
+        {
+            Y = Font_drawText(Node->Fnt, Node->X, Y, Node->W, Line);
+        }
+        else
+        {
+            Scene_emitText(Node->X, Y, Node->RomFont, 0, Line);
+            Y += Node->H;
+        }
+    }
+}
+
+/*
+ * Filled rectangle, rounded by drawing it with a wide line whose
+ * vertices are pulled in by the radius
+ */
+static void Scene_emitRect(int16_t X, int16_t Y, uint16_t W, uint16_t H, uint16_t Radius)
+{
+    if (Radius == 0)
+    {
+        Radius = 1;
+    }
+    EVE_burstReserve(20);
+    EVE_cmd(DL_BEGIN | RECTS);
+    EVE_cmd(LINE_WIDTH(Radius * 16));
+    EVE_cmd(VERTEX2F(X + Radius, Y + Radius));
+    EVE_cmd(VERTEX2F(X + W - 1 - Radius, Y + H - 1 - Radius));
+    EVE_cmd(DL_END);
+}
@@ -0,0 +1,101 @@
+/************************************************************
+ * scene.h
+ *
+ * Retained-mode scene graph for the EVE3 screen. Widgets
+ * (text, text lists, bitmaps, rectangles, progress bars,
+ * compartment tiles) are nodes in a list, drawn in order into the
+ * coprocessor FIFO. Each node keeps the command bytes it
+ * produced last time and sends those again until it is
+ * changed, so a redraw only formats and lays out the nodes
+ * that did change. Nodes and their caches are owned by the
+ * caller. A node with a tag is hit-tested by the EVE touch
+ * engine, see touch.h.
+ *
+ ************************************************************/
+
+#ifndef SCENE_H
+#define SCENE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "font.h"
+#include "asset.h"
+
+#define SCENE_MAX_CACHE     1020 //a cache is replayed from one burst
+#define SCENE_TILE_BORDER   0x919191UL
+#define SCENE_TILE_FILL     0x222222UL
+#define SCENE_PROGRESS_BG   0x444444UL
+
+typedef enum Scene_Type
+{
+    SCENE_TEXT = 0,
+    SCENE_BITMAP = 1,
+    SCENE_RECT = 2,
+    SCENE_PROGRESS = 3,
+    SCENE_TILE = 4, //compartment, highlighted while a dose is due
+    SCENE_BUTTON = 5,
+    SCENE_LIST = 6, //strings drawn one per line, by reference
+
+} Scene_Type;
+
+typedef struct Scene_Node
+{
+    struct Scene_Node *Next;
+    uint8_t Type; //Scene_Type
+    uint8_t Tag; //touch tag, 0 for none
+    volatile bool Dirty; //cache is out of date
+    bool Hidden;
+    int16_t X;
+    int16_t Y;
+    uint16_t W; //RECT, PROGRESS, TILE, wrap width for TEXT and LIST with a font
+    uint16_t H; //LIST line height with a ROM font
+    uint32_t Color; //RGB, highlight colour for TILE, face colour for BUTTON
+    char *Text; //TEXT string, TILE or BUTTON label, owned by the caller
+    const char *const *Lines; //LIST strings, owned by the caller
+    int16_t RomFont; //TEXT and LIST when Fnt is NULL, BUTTON
+    uint16_t Options; //CMD_TEXT options
+    Font *Fnt; //TEXT and LIST custom font
+    Asset *Ast; //BITMAP
+    uint8_t Handle; //BITMAP
+    uint16_t Value; //PROGRESS value, TILE pill count, RECT corner radius, LIST mask of lines shown
+    uint16_t Range; //PROGRESS, LIST number of lines
+    bool Highlight; //TILE
+    uint8_t *Cache;
+    uint16_t CacheSize;
+    uint16_t CacheLen; //0 when there is nothing cached
+
+} Scene_Node;
+
+typedef struct Scene
+{
+    Scene_Node *First;
+    Scene_Node *Last;
+
+} Scene;
+
+void Scene_init(Scene *Scn);
+void Scene_add(Scene *Scn, Scene_Node *Node, uint8_t *Cache, uint16_t CacheSize);
+void Scene_text(Scene_Node *Node, int16_t X, int16_t Y, int16_t RomFont, uint16_t Options,
+                uint32_t Color, char *Text);
+void Scene_list(Scene_Node *Node, int16_t X, int16_t Y, int16_t RomFont, uint16_t LineHeight,
+                uint32_t Color, const char *const *Lines, uint8_t nLines);
+void Scene_setFont(Scene_Node *Node, Font *Fnt, uint16_t MaxWidth); //NULL for RomFont
+void Scene_bitmap(Scene_Node *Node, int16_t X, int16_t Y, Asset *Ast, uint8_t Handle);
+void Scene_rect(Scene_Node *Node, int16_t X, int16_t Y, uint16_t W, uint16_t H,
+                uint16_t Radius, uint32_t Color);
+void Scene_progress(Scene_Node *Node, int16_t X, int16_t Y, uint16_t W, uint16_t H,
+                    uint16_t Range, uint32_t Color);
+void Scene_tile(Scene_Node *Node, int16_t X, int16_t Y, uint16_t W, uint16_t H,
+                uint32_t Color, char *Label);
+void Scene_button(Scene_Node *Node, int16_t X, int16_t Y, uint16_t W, uint16_t H,
+                  int16_t RomFont, uint32_t Color, char *Label);
+void Scene_setTag(Scene_Node *Node, uint8_t Tag);
+void Scene_setValue(Scene_Node *Node, uint16_t Value);
+void Scene_setRange(Scene_Node *Node, uint16_t Range);
+void Scene_setHighlight(Scene_Node *Node, bool Highlight);
+void Scene_setHidden(Scene_Node *Node, bool Hidden);
+void Scene_invalidate(Scene_Node *Node); //after changing its Text or Lines
+void Scene_draw(Scene *Scn); //into the current burst
+
+#endif
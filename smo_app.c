@@ -0,0 +1,371 @@
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+
+#include "smo_app.h"
+#include "SMO.h"
+#include "smo_wire.h"
+#include "alert.h"
+#include "journal.h"
+#include "lock.h"
+#include "peripherals.h"
+#include "rtc.h"
+#include "timer_wheel.h"
+#include "touch.h"
+#include "uart_term.h"
+
+_Static_assert(SMO_PACKET_MED_PAYLOAD_SIZE < SCREEN_MED_SIZE, "med list lines cut short on screen");
+
+//controller for smart medication organizer
+static SMO_Control SMO_Ctrl;
+static Lock_Mutex SMO_Mutex;
+
+static void SMO_refreshClock(bool UpdateDate);
+static void SMO_showUpcoming(SMO_Control *Ctrl);
+static int SMO_scheduleNextEvent(SMO_Control *Ctrl, uint8_t Hour, uint8_t Min);
+static int SMO_handleEvent(SMO_Control *Ctrl);
+static void SMO_logOutcome(SMO_Control *Ctrl, uint8_t Outcome, uint32_t EndTime);
+
+void SMO_App_init(void)
+{
+    SMO_Control_init(&SMO_Ctrl);
+    Lock_init(&SMO_Mutex, "app", LOCK_RANK_APP);
+}
+
+/*
+ * Apply a decrypted packet from the app and schedule the next event
+ */
+int SMO_App_handlePacket(const uint8_t *Pkt, int Len)
+{
+    int Res = 0;
+    RTC_C_Calendar Now;
+
+    //app is picking the alert tone of each compartment, one byte
+    //per compartment after the packet type
+    if (Len >= SMO_WIRE_TONES_SIZE && Pkt[SMO_WIRE_TYPE] == SMO_PACKET_TYPE_TONES)
+    {
+        Res = SMO_Control_setTones(&SMO_Ctrl, &Pkt[SMO_WIRE_TONES], Speaker_toneCount());
+        if (Res < 0)
+        {
+            UART_PRINT("Invalid tones recieved\r\n");
+        }
+        goto Error;
+    }
+
+    //check packet type, med count and length
+    Res = SMO_Wire_schedule(Pkt, Len);
+    if (Res < 0)
+    {
+        UART_PRINT("Invalid packet recieved\r\n");
+        goto Error;
+    }
+
+    Now = MAP_RTC_C_getCalendarTime();
+
+    //configure SMO from user data and schedule the next event
+    Lock_acquire(&SMO_Mutex);
+    Res = SMO_Control_configure(&SMO_Ctrl, Pkt, Len);
+    if (Res < 0)
+    {
+        UART_PRINT("Error configuring SMO\r\n");
+    }
+    else
+    {
+        Res = SMO_scheduleNextEvent(&SMO_Ctrl, Now.hours, Now.minutes);
+        if (Res < 0)
+        {
+            UART_PRINT("Error scheduling event\r\n");
+        }
+    }
+    Lock_release(&SMO_Mutex);
+
+Error:
+    return Res;
+}
+
+/*
+ * Act on the RTC interrupt status, shared with the replayer
+ */
+void SMO_App_rtcInterrupt(uint32_t Status)
+{
+    if (Status & RTC_C_TIME_EVENT_INTERRUPT)
+    {
+        SMO_App_minuteTick();
+    }
+
+    if (Status & RTC_C_CLOCK_ALARM_INTERRUPT)
+    {
+        SMO_App_alarm();
+    }
+}
+
+void SMO_App_minuteTick(void)
+{
+    RTC_C_Calendar Now = MAP_RTC_C_getCalendarTime();
+
+    UART_PRINT("RTC Int: Minute Passed\r\n");
+
+    //update screen time display every minute, and the date on a new day
+    SMO_refreshClock(Now.hours == 0 && Now.minutes == 0);
+}
+
+void SMO_App_alarm(void)
+{
+    UART_PRINT("RTC Int: Alarm Triggered\r\n");
+
+    //event is started by the alert thread, not in the interrupt
+    if (!SMO_Alert_post(SMO_ALERT_ALARM, (uint32_t) RTC_getTime()))
+    {
+        UART_PRINT("Error posting alarm\r\n");
+    }
+}
+
+/*
+ * Alert thread hook: start the event the RTC alarm fired for
+ */
+int SMO_App_beginAlert(void)
+{
+    int Res = 0;
+    RTC_C_Calendar Now = MAP_RTC_C_getCalendarTime();
+
+    Lock_acquire(&SMO_Mutex);
+    Res = SMO_handleEvent(&SMO_Ctrl);
+    if (Res < 0)
+    {
+        UART_PRINT("Error handling event\r\n");
+    }
+    else
+    {
+        Res = SMO_Ctrl.ActiveCompartments;
+    }
+
+    if (SMO_scheduleNextEvent(&SMO_Ctrl, Now.hours, Now.minutes) < 0)
+    {
+        UART_PRINT("Error scheduling next event\r\n");
+    }
+    Lock_release(&SMO_Mutex);
+
+    return Res;
+}
+
+/*
+ * Alert thread hook: journal how the active event ended
+ */
+void SMO_App_endAlert(uint8_t Outcome, uint32_t Time)
+{
+    Lock_acquire(&SMO_Mutex);
+    SMO_logOutcome(&SMO_Ctrl, Outcome, Time);
+    Lock_release(&SMO_Mutex);
+}
+
+/*
+ * Gesture handler for the okay button, runs on the button thread
+ */
+void SMO_App_handleGesture(Button_Gesture Gesture, uint32_t PressTime)
+{
+    uint8_t Input;
+
+    switch (Gesture)
+    {
+    case BUTTON_LONG_PRESS:
+        UART_PRINT("Button long press\r\n");
+        Input = SMO_ALERT_SNOOZE;
+        break;
+
+    case BUTTON_DOUBLE_PRESS:
+        UART_PRINT("Button double press\r\n");
+        Input = SMO_ALERT_DISMISS;
+        break;
+
+    case BUTTON_CLICK:
+    default:
+        UART_PRINT("Button clicked\r\n");
+        Input = SMO_ALERT_ACK;
+        break;
+    }
+
+    //journal the press itself rather than when decoding finished
+    if (!SMO_Alert_post(Input, (uint32_t) RTC_getTime() - (TimerWheel_now() - PressTime)/TIMERWHEEL_TICKS_PER_SEC))
+    {
+        UART_PRINT("Error posting button gesture\r\n");
+    }
+}
+
+/*
+ * Touch handler for tagged widgets, runs on the peripheral thread
+ */
+void SMO_App_handleTouch(uint8_t Tag, uint32_t PressTime)
+{
+    uint32_t Time = (uint32_t) RTC_getTime() - (TimerWheel_now() - PressTime)/TIMERWHEEL_TICKS_PER_SEC;
+    bool Posted = true;
+
+    if (Tag >= TOUCH_TAG_COMPARTMENT && Tag < TOUCH_TAG_COMPARTMENT + SMO_MAX_COMPARTMENTS)
+    {
+        UART_PRINT("Compartment %c touched\r\n", 'A' + Tag - TOUCH_TAG_COMPARTMENT);
+        Posted = SMO_Alert_take(Tag - TOUCH_TAG_COMPARTMENT, Time);
+    }
+    else if (Tag == TOUCH_TAG_SNOOZE)
+    {
+        UART_PRINT("Snooze touched\r\n");
+        Posted = SMO_Alert_post(SMO_ALERT_SNOOZE, Time);
+    }
+    else if (Tag == TOUCH_TAG_UPCOMING)
+    {
+        //the med info area belongs to the alert while one is running
+        if (SMO_Alert_getState() == SMO_ALERT_IDLE)
+        {
+            Lock_acquire(&SMO_Mutex);
+            SMO_showUpcoming(&SMO_Ctrl);
+            Lock_release(&SMO_Mutex);
+        }
+    }
+
+    if (!Posted)
+    {
+        UART_PRINT("Error posting touch\r\n");
+    }
+}
+
+/*
+ * The minute tick is off while the display sleeps, so catch up on wake
+ */
+void SMO_App_displayWake(void)
+{
+    SMO_refreshClock(true);
+}
+
+/*
+ * Put the RTC calendar time, and optionally the date, on the screen
+ */
+static void SMO_refreshClock(bool UpdateDate)
+{
+    RTC_C_Calendar Now = MAP_RTC_C_getCalendarTime();
+
+    uint_fast8_t Hour = Now.hours;
+    UART_PRINT("Updating screen time: %02d:%02d %s\r\n",
+               Hour>12?Hour-12:Hour, Now.minutes, Hour>=12?"PM":"AM");
+    Screen_updateTime(Now.hours, Now.minutes);
+
+    if (UpdateDate)
+    {
+        char *Date = RTC_getDate();
+        char DateStr[32], MonthStr[4] = {0};
+        sprintf(MonthStr, "%c%c%c", Date[4], Date[5], Date[6]);
+        snprintf(DateStr, sizeof(DateStr), "%s %d, %d", MonthStr, Now.dayOfmonth, (int) Now.year-70);
+        UART_PRINT("Update screen date: %s\r\n", DateStr);
+        Screen_updateDate(DateStr);
+    }
+}
+
+/*
+ * Toggle a list of the next few doses in the med info area
+ */
+static void SMO_showUpcoming(SMO_Control *Ctrl)
+{
+    static bool Showing;
+    char ScreenStr[255];
+    char *CurrentStr = ScreenStr, *End = ScreenStr + sizeof(ScreenStr);
+    SMO_Event *Events[4];
+    RTC_C_Calendar Now;
+    uint8_t i, Index, Count;
+
+    Showing = !Showing;
+    if (!Showing)
+    {
+        Screen_removeMedInfo();
+        return;
+    }
+
+    Now = MAP_RTC_C_getCalendarTime();
+    Count = SMO_Control_upcoming(Ctrl, Now.hours, Now.minutes, Events, 4);
+    CurrentStr += snprintf(CurrentStr, End - CurrentStr, Count == 0 ? "No doses scheduled\n" : "Upcoming doses:\n");
+    for (i = 0; i < Count && CurrentStr < End; ++i)
+    {
+        CurrentStr += snprintf(CurrentStr, End - CurrentStr, "%02d:%02d ", Events[i]->AlarmHour, Events[i]->AlarmMin);
+        for (Index = 0; Index < SMO_MAX_COMPARTMENTS && CurrentStr < End; ++Index)
+        {
+            if (Events[i]->Compartments & (1 << Index))
+            {
+                CurrentStr += snprintf(CurrentStr, End - CurrentStr, " %c x%d", 'A' + Index, Events[i]->nPills[Index]);
+            }
+        }
+        if (CurrentStr < End)
+        {
+            CurrentStr += snprintf(CurrentStr, End - CurrentStr, "\n");
+        }
+    }
+    Screen_printMedInfo(ScreenStr);
+}
+
+static int SMO_scheduleNextEvent(SMO_Control *Ctrl, uint8_t Hour, uint8_t Min)
+{
+    int Res = 0;
+
+    SMO_Event *NextEvent = SMO_Control_nextEvent(Ctrl, Hour, Min);
+    if (NextEvent == NULL)
+    {
+        UART_PRINT("No event available\r\n");
+        Res = -EINVAL;
+        goto Error;
+    }
+
+    UART_PRINT("Scheduling next event for %02d:%02d\r\n", NextEvent->AlarmHour, NextEvent->AlarmMin);
+    //set an alarm for the next event
+    RTC_setAlarm(NextEvent->AlarmMin, NextEvent->AlarmHour, RTC_C_ALARMCONDITION_OFF, RTC_C_ALARMCONDITION_OFF);
+
+    //save the event so we know what to do when alarm triggers
+    Ctrl->CurrentEvent = NextEvent;
+
+Error:
+    return Res;
+}
+
+static int SMO_handleEvent(SMO_Control *Ctrl)
+{
+    int Res = 0;
+    const char *MedStrs[SMO_MAX_COMPARTMENTS];
+    uint8_t Index, Compartments;
+
+    if (Ctrl->CurrentEvent == NULL)
+    {
+        UART_PRINT("No event ready\r\n");
+        Res = -EINVAL;
+        goto Error;
+    }
+
+    UART_PRINT("Starting SMO event\r\n");
+
+    //remember when the event started for the adherence journal
+    Compartments = Ctrl->CurrentEvent->Compartments;
+    Ctrl->ActiveStart = (uint32_t) RTC_getTime();
+    Ctrl->ActiveCompartments = Compartments;
+
+    //the screen update holds its own copy of the due names, the compartment
+    //tiles below them show where each med is and how many pills to take
+    for (Index = 0; Index < SMO_MAX_COMPARTMENTS; ++Index)
+    {
+        MedStrs[Index] = SMO_Control_getMedStr(Ctrl, Index);
+    }
+
+    UART_PRINT("Displaying compartments 0x%02x\r\n", Compartments);
+    Screen_showMedList(MedStrs, Compartments);
+    Screen_showCompartments(Compartments, Ctrl->CurrentEvent->nPills);
+    Speaker_setTone(SMO_Control_getTone(Ctrl, Compartments));
+
+Error:
+    return Res;
+}
+
+/*
+ * Record how the active event ended in the adherence journal
+ */
+static void SMO_logOutcome(SMO_Control *Ctrl, uint8_t Outcome, uint32_t EndTime)
+{
+    uint32_t Latency = EndTime > Ctrl->ActiveStart ? EndTime - Ctrl->ActiveStart : 0;
+
+    Latency = Latency > UINT16_MAX ? UINT16_MAX : Latency;
+    SMO_Journal_append(Ctrl->ActiveStart, Ctrl->ActiveCompartments, Outcome, (uint16_t) Latency);
+}
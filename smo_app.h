@@ -0,0 +1,33 @@
+/************************************************************
+ * smo_app.h
+ *
+ * Medication event logic: what the SMO does on the RTC
+ * minute tick and alarm, on button gestures and screen
+ * touches, and when a schedule or tones packet arrives. It
+ * owns the SMO controller and only reaches the hardware
+ * through the driver headers (rtc.h, peripherals.h, alert.h,
+ * journal.h), not SimpleLink or thread setup, so the same
+ * code runs on the host simulator in host/.
+ *
+ ************************************************************/
+
+#ifndef SMO_APP_H
+#define SMO_APP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "button.h"
+
+void SMO_App_init(void);
+int SMO_App_handlePacket(const uint8_t *Pkt, int Len); //decrypted schedule or tones packet
+void SMO_App_rtcInterrupt(uint32_t Status); //RTC_C interrupt status, from the interrupt
+void SMO_App_minuteTick(void); //RTC minute event, from the interrupt
+void SMO_App_alarm(void); //RTC alarm, from the interrupt
+int SMO_App_beginAlert(void); //SMO_AlertBegin hook
+void SMO_App_endAlert(uint8_t Outcome, uint32_t Time); //SMO_AlertEnd hook
+void SMO_App_handleGesture(Button_Gesture Gesture, uint32_t PressTime);
+void SMO_App_handleTouch(uint8_t Tag, uint32_t PressTime);
+void SMO_App_displayWake(void);
+
+#endif
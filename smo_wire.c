@@ -0,0 +1,71 @@
+#include <errno.h>
+
+#include "smo_wire.h"
+#include "journal.h"
+
+//the structs that mirror a wire layout must match it byte for byte
+_Static_assert(offsetof(SMO_PacketMed, AlarmHour) == SMO_WIRE_MED_HOUR, "SMO_PacketMed layout");
+_Static_assert(offsetof(SMO_PacketMed, AlarmMin) == SMO_WIRE_MED_MIN, "SMO_PacketMed layout");
+_Static_assert(offsetof(SMO_PacketMed, nPills) == SMO_WIRE_MED_NPILLS, "SMO_PacketMed layout");
+_Static_assert(offsetof(SMO_PacketMed, nCmptmt) == SMO_WIRE_MED_CMPTMT, "SMO_PacketMed layout");
+_Static_assert(offsetof(SMO_PacketMed, Length) == SMO_WIRE_MED_LENGTH, "SMO_PacketMed layout");
+_Static_assert(offsetof(SMO_PacketMed, Payload) == SMO_WIRE_MED_PAYLOAD, "SMO_PacketMed layout");
+_Static_assert(sizeof(SMO_PacketMed) == SMO_WIRE_MED_SIZE, "SMO_PacketMed is not 35 bytes");
+_Static_assert(offsetof(SMO_Packet, PacketType) == SMO_WIRE_TYPE, "SMO_Packet layout");
+_Static_assert(offsetof(SMO_Packet, nMeds) == SMO_WIRE_NMEDS, "SMO_Packet layout");
+_Static_assert(offsetof(SMO_Packet, Meds) == SMO_WIRE_MEDS, "SMO_Packet layout");
+_Static_assert(SMO_PACKET_HEADER_SIZE == SMO_WIRE_MEDS, "SMO_PACKET_HEADER_SIZE");
+_Static_assert(sizeof(SMO_Packet) == SMO_WIRE_SCHEDULE_SIZE(SMO_PACKET_MAX_MEDS), "SMO_Packet size");
+_Static_assert(sizeof(SMO_JournalRecord) == SMO_WIRE_JREC_SIZE, "SMO_JournalRecord size");
+_Static_assert(SMO_JOURNAL_EXPORT_HEADER_SIZE == SMO_WIRE_JRSP_RECORDS, "journal export header");
+
+/*
+ * Check the header of a schedule packet of Len bytes, returns the
+ * number of med records it holds
+ */
+int SMO_Wire_schedule(const uint8_t *Pkt, size_t Len)
+{
+    uint8_t nMeds;
+
+    if (Len < SMO_WIRE_MEDS || Pkt[SMO_WIRE_TYPE] != SMO_PACKET_TYPE_HEADER)
+    {
+        return -EINVAL;
+    }
+    nMeds = Pkt[SMO_WIRE_NMEDS];
+    if (nMeds == 0 || nMeds > SMO_PACKET_MAX_MEDS || Len < SMO_WIRE_SCHEDULE_SIZE(nMeds))
+    {
+        return -EINVAL;
+    }
+    return nMeds;
+}
+
+/*
+ * Decode and range check one med record in place
+ */
+int SMO_Wire_med(const uint8_t *Pkt, uint8_t Index, SMO_WireMed *Med)
+{
+    const uint8_t *Rec = &Pkt[SMO_WIRE_MEDS + Index*SMO_WIRE_MED_SIZE];
+
+    Med->Hour = Rec[SMO_WIRE_MED_HOUR];
+    Med->Min = Rec[SMO_WIRE_MED_MIN];
+    Med->nPills = Rec[SMO_WIRE_MED_NPILLS];
+    Med->Cmptmt = Rec[SMO_WIRE_MED_CMPTMT];
+    Med->Length = Rec[SMO_WIRE_MED_LENGTH];
+    Med->Payload = (const char *) &Rec[SMO_WIRE_MED_PAYLOAD];
+
+    if (Med->Hour > 23 || Med->Min > 59 || Med->nPills == 0
+        || Med->Cmptmt >= SMO_MAX_COMPARTMENTS || Med->Length > SMO_PACKET_MED_PAYLOAD_SIZE)
+    {
+        return -EINVAL;
+    }
+    return 0;
+}
+
+void SMO_Wire_putJournalRecord(uint8_t *Buf, uint32_t Epoch, uint8_t Compartments,
+                               uint8_t Outcome, uint16_t Latency)
+{
+    SMO_Wire_put32(&Buf[SMO_WIRE_JREC_EPOCH], Epoch);
+    Buf[SMO_WIRE_JREC_COMPARTMENTS] = Compartments;
+    Buf[SMO_WIRE_JREC_OUTCOME] = Outcome;
+    SMO_Wire_put16(&Buf[SMO_WIRE_JREC_LATENCY], Latency);
+}
@@ -0,0 +1,143 @@
+/************************************************************
+ * smo_wire.h
+ *
+ * Byte layout of the packets exchanged with the app over UDP,
+ * after AES decryption. Fields are read and written in place
+ * at fixed offsets in the packet buffer, so nothing depends
+ * on how the compiler pads a struct, and multi-byte fields
+ * are little endian on any host. The structs in SMO.h and
+ * journal.h that mirror a layout are checked against these
+ * offsets at compile time in smo_wire.c.
+ *
+ ************************************************************/
+
+#ifndef SMO_WIRE_H
+#define SMO_WIRE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "SMO.h"
+
+#define SMO_WIRE_TYPE               0 //every packet starts with its SMO_PACKET_TYPE_*
+
+//medication schedule, SMO_PACKET_TYPE_HEADER
+#define SMO_WIRE_NMEDS              1
+#define SMO_WIRE_MEDS               2 //first med record
+#define SMO_WIRE_MED_HOUR           0 //offsets within a med record
+#define SMO_WIRE_MED_MIN            1
+#define SMO_WIRE_MED_NPILLS         2
+#define SMO_WIRE_MED_CMPTMT         3
+#define SMO_WIRE_MED_LENGTH         4
+#define SMO_WIRE_MED_PAYLOAD        5
+#define SMO_WIRE_MED_SIZE           (SMO_WIRE_MED_PAYLOAD + SMO_PACKET_MED_PAYLOAD_SIZE)
+#define SMO_WIRE_SCHEDULE_SIZE(n)   (SMO_WIRE_MEDS + (n)*SMO_WIRE_MED_SIZE)
+
+//journal request and response, SMO_PACKET_TYPE_JOURNAL
+#define SMO_WIRE_JREQ_CURSOR        1
+#define SMO_WIRE_JREQ_MAX           5
+#define SMO_WIRE_JREQ_SIZE          7
+#define SMO_WIRE_JRSP_RECORD_SIZE   1
+#define SMO_WIRE_JRSP_COUNT         2
+#define SMO_WIRE_JRSP_FIRST         4
+#define SMO_WIRE_JRSP_NEXT          8
+#define SMO_WIRE_JRSP_HEAD          12
+#define SMO_WIRE_JRSP_RECORDS       16 //first journal record
+#define SMO_WIRE_JREC_EPOCH         0 //offsets within a journal record
+#define SMO_WIRE_JREC_COMPARTMENTS  4
+#define SMO_WIRE_JREC_OUTCOME       5
+#define SMO_WIRE_JREC_LATENCY       6
+#define SMO_WIRE_JREC_SIZE          8
+
+//input recording request and response, SMO_PACKET_TYPE_RECORDING
+#define SMO_WIRE_RREQ_CURSOR        1
+#define SMO_WIRE_RREQ_MAX           5 //bytes wanted, 0 for as many as fit
+#define SMO_WIRE_RREQ_SIZE          7
+#define SMO_WIRE_RRSP_LENGTH        2 //bytes of records that follow
+#define SMO_WIRE_RRSP_FIRST         4
+#define SMO_WIRE_RRSP_NEXT          8
+#define SMO_WIRE_RRSP_HEAD          12
+#define SMO_WIRE_RRSP_RECORDS       16 //first input record
+#define SMO_WIRE_REC_TYPE           0 //offsets within an input record
+#define SMO_WIRE_REC_LENGTH         2 //bytes of data after the header
+#define SMO_WIRE_REC_TICK           4
+#define SMO_WIRE_REC_DATA           8
+
+//CPU load and stack request and response, SMO_PACKET_TYPE_LOAD
+#define SMO_WIRE_LREQ_SIZE          1
+#define SMO_WIRE_LRSP_NTASKS        1
+#define SMO_WIRE_LRSP_IDLE          2 //task id of the idle task
+#define SMO_WIRE_LRSP_LOAD          4 //permille, last window
+#define SMO_WIRE_LRSP_PEAK          6 //permille, busiest window
+#define SMO_WIRE_LRSP_TICKS         8
+#define SMO_WIRE_LRSP_CYCLES_PER_TICK 12
+#define SMO_WIRE_LRSP_HWI_SIZE      16
+#define SMO_WIRE_LRSP_HWI_PEAK      20
+#define SMO_WIRE_LRSP_TASKS         24 //first task record
+#define SMO_WIRE_LTASK_NAME         0 //offsets within a task record
+#define SMO_WIRE_LTASK_CYCLES       8 //64 bits, low word first
+#define SMO_WIRE_LTASK_STACK_SIZE   16
+#define SMO_WIRE_LTASK_STACK_PEAK   20
+#define SMO_WIRE_LTASK_SIZE         24
+
+//profiler control request and response, SMO_PACKET_TYPE_PROFILE
+#define SMO_WIRE_PREQ_MODE          1 //Profile_Mode, SMO_WIRE_PREQ_QUERY to leave it as it is
+#define SMO_WIRE_PREQ_RATE          2 //samples per second, 0 for the default
+#define SMO_WIRE_PREQ_SIZE          4
+#define SMO_WIRE_PREQ_QUERY         0xFF
+#define SMO_WIRE_PRSP_MODE          1
+#define SMO_WIRE_PRSP_NTASKS        2
+#define SMO_WIRE_PRSP_RATE          4
+#define SMO_WIRE_PRSP_SAMPLES       8
+#define SMO_WIRE_PRSP_DROPPED       12
+#define SMO_WIRE_PRSP_TASKS         16 //first task record
+#define SMO_WIRE_PTASK_NAME         0 //offsets within a task record
+#define SMO_WIRE_PTASK_CYCLES       8 //64 bits, low word first
+#define SMO_WIRE_PTASK_SIZE         16
+
+//alert tone of each compartment, SMO_PACKET_TYPE_TONES
+#define SMO_WIRE_TONES              1
+#define SMO_WIRE_TONES_SIZE         (SMO_WIRE_TONES + SMO_MAX_COMPARTMENTS)
+
+//validated fields of one med record, Payload points into the packet
+typedef struct SMO_WireMed
+{
+    uint8_t Hour;
+    uint8_t Min;
+    uint8_t nPills;
+    uint8_t Cmptmt; //compartment index
+    uint8_t Length; //bytes of Payload used
+    const char *Payload;
+
+} SMO_WireMed;
+
+static inline uint16_t SMO_Wire_get16(const uint8_t *Buf)
+{
+    return (uint16_t) (Buf[0] | (Buf[1] << 8));
+}
+
+static inline uint32_t SMO_Wire_get32(const uint8_t *Buf)
+{
+    return Buf[0] | (Buf[1] << 8) | ((uint32_t) Buf[2] << 16) | ((uint32_t) Buf[3] << 24);
+}
+
+static inline void SMO_Wire_put16(uint8_t *Buf, uint16_t Val)
+{
+    Buf[0] = (uint8_t) Val;
+    Buf[1] = (uint8_t) (Val >> 8);
+}
+
+static inline void SMO_Wire_put32(uint8_t *Buf, uint32_t Val)
+{
+    Buf[0] = (uint8_t) Val;
+    Buf[1] = (uint8_t) (Val >> 8);
+    Buf[2] = (uint8_t) (Val >> 16);
+    Buf[3] = (uint8_t) (Val >> 24);
+}
+
+int SMO_Wire_schedule(const uint8_t *Pkt, size_t Len); //number of meds, or -EINVAL
+int SMO_Wire_med(const uint8_t *Pkt, uint8_t Index, SMO_WireMed *Med); //after SMO_Wire_schedule
+void SMO_Wire_putJournalRecord(uint8_t *Buf, uint32_t Epoch, uint8_t Compartments,
+                               uint8_t Outcome, uint16_t Latency);
+
+#endif
@@ -0,0 +1,218 @@
+#include <string.h>
+
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/hal/Hwi.h>
+
+#include "sound.h"
+#include "EVE.h"
+#include "timer_wheel.h"
+
+#define SOUND_STEP_VOLUME   ((255 * SOUND_STEP_MS + SOUND_RAMP_MS - 1) / SOUND_RAMP_MS)
+#define SOUND_STEP_TICKS    TIMERWHEEL_MS_TO_TICKS(SOUND_STEP_MS)
+
+typedef struct Sound_Control
+{
+    void (*Notify)(void); //wakes the thread that calls Sound_service
+    TimerWheel_Timer Timer; //next ramp step or pattern repeat
+    uint32_t Addr[SOUND_MAX_TONES]; //RAM_G address of each tone
+    uint8_t nTones;
+    volatile bool Requested; //Sound_play was called since the last service
+    volatile uint8_t ReqTone;
+    volatile uint8_t ReqVolume;
+    volatile uint16_t ReqPeriod;
+    uint8_t Tone; //playing tone
+    uint8_t Volume; //REG_VOL_PB now
+    uint8_t Target; //REG_VOL_PB at the end of the ramp
+    uint32_t Period; //ticks between starts, 0 to loop
+    uint32_t NextStart; //tick of the next repeat
+    bool Playing;
+    Sound_Stats Stats;
+
+} Sound_Control;
+
+static Sound_Control Sound_Ctrl;
+
+static void Sound_start(bool Loop);
+static void Sound_stop(void);
+static void Sound_timer(void *Arg);
+
+/*
+ * Inflate every tone into RAM_G from Addr, which must be 8 byte aligned
+ */
+uint32_t Sound_load(uint32_t Addr, void (*Notify)(void))
+{
+    const Sound_Data *Data;
+    uint32_t Used = 0;
+    uint8_t i;
+
+    memset(&Sound_Ctrl, 0, sizeof(Sound_Ctrl));
+    Sound_Ctrl.Notify = Notify;
+    if ((Addr & 7) != 0)
+    {
+        return 0;
+    }
+
+    for (i = 0; i < Sound_nTones && i < SOUND_MAX_TONES; ++i)
+    {
+        Data = Sound_tones[i];
+        EVE_cmdInflate(RAM_G + Addr + Used, Data->Blob, Data->BlobSize);
+        Sound_Ctrl.Addr[i] = Addr + Used;
+        Used += Data->RamSize;
+    }
+    Sound_Ctrl.nTones = i;
+
+    EVE_write8(REG_VOL_PB + RAM_REG, 0);
+    return Used;
+}
+
+/*
+ * Ramp to Volume playing Tone every PeriodMs, or looped if PeriodMs
+ * is 0. A Volume of 0 fades out and stops. Applied by Sound_service.
+ */
+void Sound_play(uint8_t Tone, uint8_t Volume, uint16_t PeriodMs)
+{
+    UInt Key;
+
+    if (Sound_Ctrl.nTones == 0)
+    {
+        return;
+    }
+
+    Key = Hwi_disable();
+    Sound_Ctrl.ReqTone = Tone % Sound_Ctrl.nTones;
+    Sound_Ctrl.ReqVolume = Volume;
+    Sound_Ctrl.ReqPeriod = PeriodMs;
+    Sound_Ctrl.Requested = true;
+    Hwi_restore(Key);
+
+    if (Sound_Ctrl.Notify != NULL)
+    {
+        Sound_Ctrl.Notify();
+    }
+}
+
+/*
+ * Take up a new request, step the volume ramp, restart a repeating
+ * tone when due, and arm the timer for whichever comes next
+ */
+void Sound_service(void)
+{
+    UInt Key;
+    uint32_t Now, Wait = UINT32_MAX;
+    bool Restart = false;
+    uint8_t Tone;
+
+    if (Sound_Ctrl.nTones == 0)
+    {
+        return;
+    }
+    Now = TimerWheel_now();
+
+    if (Sound_Ctrl.Requested)
+    {
+        Key = Hwi_disable();
+        Sound_Ctrl.Requested = false;
+        Tone = Sound_Ctrl.ReqTone;
+        Sound_Ctrl.Target = Sound_Ctrl.ReqVolume;
+        Sound_Ctrl.Period = TIMERWHEEL_MS_TO_TICKS(Sound_Ctrl.ReqPeriod);
+        Hwi_restore(Key);
+
+        //a new tone or pattern starts over, a fade out lets the tone finish
+        if (Sound_Ctrl.Target != 0)
+        {
+            Sound_Ctrl.Tone = Tone;
+            Restart = true;
+        }
+        Sound_Ctrl.NextStart = Now;
+    }
+
+    if (Sound_Ctrl.Volume != Sound_Ctrl.Target)
+    {
+        if (Sound_Ctrl.Volume < Sound_Ctrl.Target)
+        {
+            Sound_Ctrl.Volume = Sound_Ctrl.Target - Sound_Ctrl.Volume > SOUND_STEP_VOLUME
+                              ? Sound_Ctrl.Volume + SOUND_STEP_VOLUME : Sound_Ctrl.Target;
+        }
+        else
+        {
+            Sound_Ctrl.Volume = Sound_Ctrl.Volume - Sound_Ctrl.Target > SOUND_STEP_VOLUME
+                              ? Sound_Ctrl.Volume - SOUND_STEP_VOLUME : Sound_Ctrl.Target;
+        }
+        EVE_write8(REG_VOL_PB + RAM_REG, Sound_Ctrl.Volume);
+        Sound_Ctrl.Stats.Steps++;
+    }
+    if (Sound_Ctrl.Volume != Sound_Ctrl.Target)
+    {
+        Wait = SOUND_STEP_TICKS;
+    }
+
+    //faded out
+    if (Sound_Ctrl.Volume == 0 && Sound_Ctrl.Target == 0)
+    {
+        if (Sound_Ctrl.Playing)
+        {
+            Sound_stop();
+        }
+        TimerWheel_stop(&Sound_Ctrl.Timer);
+        return;
+    }
+
+    if (Restart || (Sound_Ctrl.Period != 0 && (int32_t) (Now - Sound_Ctrl.NextStart) >= 0))
+    {
+        Sound_start(Sound_Ctrl.Period == 0);
+        Sound_Ctrl.NextStart = Now + Sound_Ctrl.Period;
+    }
+    if (Sound_Ctrl.Period != 0 && Sound_Ctrl.NextStart - Now < Wait)
+    {
+        Wait = Sound_Ctrl.NextStart - Now;
+    }
+
+    if (Wait != UINT32_MAX)
+    {
+        TimerWheel_start(&Sound_Ctrl.Timer, TIMERWHEEL_TICKS_TO_MS(Wait), 0, Sound_timer, NULL);
+    }
+    else
+    {
+        TimerWheel_stop(&Sound_Ctrl.Timer);
+    }
+}
+
+void Sound_getStats(Sound_Stats *Stats)
+{
+    memcpy(Stats, &Sound_Ctrl.Stats, sizeof(Sound_Stats));
+}
+
+static void Sound_start(bool Loop)
+{
+    const Sound_Data *Data = Sound_tones[Sound_Ctrl.Tone];
+
+    EVE_write32(REG_PLAYBACK_START + RAM_REG, Sound_Ctrl.Addr[Sound_Ctrl.Tone]);
+    EVE_write32(REG_PLAYBACK_LENGTH + RAM_REG, Data->RamSize);
+    EVE_write16(REG_PLAYBACK_FREQ + RAM_REG, Data->Rate);
+    EVE_write8(REG_PLAYBACK_FORMAT + RAM_REG, Data->Format);
+    EVE_write8(REG_PLAYBACK_LOOP + RAM_REG, Loop);
+    EVE_write8(REG_PLAYBACK_PLAY + RAM_REG, 1);
+    Sound_Ctrl.Playing = true;
+    Sound_Ctrl.Stats.Starts++;
+}
+
+/*
+ * A zero length playback stops the player
+ */
+static void Sound_stop(void)
+{
+    EVE_write32(REG_PLAYBACK_LENGTH + RAM_REG, 0);
+    EVE_write8(REG_PLAYBACK_PLAY + RAM_REG, 1);
+    Sound_Ctrl.Playing = false;
+}
+
+/*
+ * Timer wheel callback, runs from interrupt so only wakes the EVE owner
+ */
+static void Sound_timer(void *Arg)
+{
+    if (Sound_Ctrl.Notify != NULL)
+    {
+        Sound_Ctrl.Notify();
+    }
+}
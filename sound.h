@@ -0,0 +1,50 @@
+/************************************************************
+ * sound.h
+ *
+ * Alert tones played by the EVE3's sample player. Tones are
+ * built by tools/mksound.py as IMA ADPCM, inflated into
+ * RAM_G once and played from there with REG_PLAYBACK_*, so
+ * the MCU does no work per sample. Volume ramps and
+ * repeating patterns are stepped from a timer wheel one-shot
+ * and applied by whichever thread owns the EVE, a few SPI
+ * register writes per step.
+ *
+ ************************************************************/
+
+#ifndef SOUND_H
+#define SOUND_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SOUND_MAX_TONES     8
+#define SOUND_RAMP_MS       1500 //time for a change from silent to full volume
+#define SOUND_STEP_MS       50 //volume ramp step
+
+typedef struct Sound_Data
+{
+    const uint8_t *Blob; //deflated samples for CMD_INFLATE
+    uint32_t BlobSize;
+    uint32_t RamSize; //size once inflated, a multiple of 8
+    uint32_t Version; //changes whenever the tone is rebuilt differently
+    uint16_t Rate; //samples per second
+    uint8_t Format; //REG_PLAYBACK_FORMAT
+
+} Sound_Data;
+
+typedef struct Sound_Stats
+{
+    uint32_t Starts; //times a tone was started
+    uint32_t Steps; //volume ramp steps written
+
+} Sound_Stats;
+
+extern const Sound_Data *const Sound_tones[];
+extern const uint8_t Sound_nTones;
+
+uint32_t Sound_load(uint32_t Addr, void (*Notify)(void)); //returns RAM_G bytes used, 0 on error
+void Sound_play(uint8_t Tone, uint8_t Volume, uint16_t PeriodMs); //safe from interrupts
+void Sound_service(void); //needs the SPI bus, call after Notify
+void Sound_getStats(Sound_Stats *Stats);
+
+#endif
@@ -0,0 +1,622 @@
+/************************************************************
+ * Generated by tools/mksound.py, do not edit. Rerun the
+ * tool with the tone list instead.
+ *
+ * 0 chime: preset, 800 ms adpcm at 8000 Hz, 3200 bytes in RAM_G, 980 deflated
+ * 1 bell: preset, 900 ms adpcm at 8000 Hz, 3600 bytes in RAM_G, 3134 deflated
+ * 2 pulse: preset, 480 ms adpcm at 8000 Hz, 1920 bytes in RAM_G, 108 deflated
+ * 3 rise: preset, 600 ms adpcm at 8000 Hz, 2400 bytes in RAM_G, 1757 deflated
+ * 4 trill: preset, 600 ms adpcm at 8000 Hz, 2400 bytes in RAM_G, 277 deflated
+ * 5 dingdong: preset, 900 ms adpcm at 8000 Hz, 3600 bytes in RAM_G, 2052 deflated
+ ************************************************************/
+
+#include <stdint.h>
+
+#include "sound.h"
+
+static const uint8_t Sound_chimeBlob[980] = {
+0x78,0xda,0xb5,0x96,0xcf,0x4f,0xd3,0x60,0x18,0xc7,0xdf,0xb7,0x68,0x52,0xa6,0x26,
+0x7d,0x8b,0x98,0x45,0x2f,0x6b,0x83,0x33,0xe2,0x5,0x89,0x1a,0xe3,0xc9,0x3,0x4b,
+0xe0,0xe6,0xd0,0x83,0x47,0x71,0xff,0x80,0xe2,0xc1,0xeb,0xca,0x2e,0x5b,0x7,0x64,
+0xe3,0x4,0x9b,0x68,0xf1,0x34,0x57,0xf9,0x71,0xdc,0x8f,0x28,0x1c,0x37,0x12,0x37,
+0x8f,0x8c,0x4,0xbd,0x2a,0x81,0x78,0x1f,0x44,0x7d,0xde,0xb7,0x5d,0xdb,0x75,0x1b,
+0xc,0xd0,0x5b,0x4f,0xfd,0xf4,0xfb,0xfd,0x3e,0xcf,0xf3,0xed,0x8b,0xd7,0x7f,0x7e,
+0x5,0x7,0xb8,0xdf,0x33,0x81,0x25,0x9d,0x97,0x86,0xf1,0xe1,0xec,0xe3,0xb9,0x22,
+0xef,0x93,0x71,0x7d,0x66,0x7c,0x4a,0xef,0x15,0x64,0xfc,0x73,0x71,0x82,0x83,0x7,
+0x9,0x6f,0x2d,0x4f,0xf4,0xe8,0x2a,0x96,0x49,0x69,0xf5,0x51,0xdf,0x66,0x4c,0x20,
+0x24,0xb3,0xfe,0xf4,0x72,0x7e,0x41,0x90,0xc8,0x7c,0xf5,0xfe,0xf5,0xbc,0xea,0x95,
+0xc4,0xf9,0x6f,0x37,0xfd,0x99,0x38,0x2f,0x89,0x89,0x9d,0xab,0x37,0xb4,0x38,0x4f,
+0x38,0x65,0xcf,0x73,0x4f,0x4b,0xf3,0x44,0x54,0xe,0x2e,0x8e,0x2c,0x65,0x79,0x41,
+0x46,0xf5,0xe9,0x90,0xa2,0xf3,0x82,0x88,0x77,0xdf,0xbc,0x52,0xb2,0x51,0x2c,0xe2,
+0xda,0xc7,0xc9,0xa9,0x2c,0x65,0x94,0x57,0x26,0x22,0x59,0xf,0x6a,0xc7,0xc8,0x7c,
+0x33,0x19,0x9a,0x9b,0x21,0x86,0x8f,0x64,0x84,0x1a,0x3a,0xc6,0x23,0x45,0x78,0xe0,
+0x7e,0x50,0x1d,0x6,0xe3,0xe1,0xf9,0x3c,0x30,0xb8,0xb3,0xea,0xd8,0x9e,0x65,0x5e,
+0x89,0xf8,0x87,0xc9,0x20,0x35,0x53,0x7,0xde,0x70,0xeb,0xc0,0x89,0xee,0x19,0x3e,
+0xa9,0x9d,0xe,0xe6,0x15,0xbc,0xba,0xb3,0x57,0x58,0xab,0x8c,0xf5,0xe7,0x54,0x24,
+0x11,0x6d,0xff,0xa6,0x3f,0xa7,0x7a,0x7d,0x24,0xbc,0x33,0xe8,0xd7,0xd2,0x5e,0x1f,
+0x78,0x75,0x8d,0x32,0x7c,0x72,0xf8,0xe0,0xd2,0x9d,0xe4,0x9b,0x28,0x11,0xd1,0xee,
+0xf4,0xab,0x64,0xa,0x3e,0x1f,0xd5,0x16,0x43,0x73,0x59,0xaa,0xa3,0xfc,0x2e,0x18,
+0x29,0xc4,0x8,0x64,0xfe,0xe9,0x79,0xcf,0x66,0x2f,0x12,0x71,0x6e,0x3d,0x78,0x2e,
+0x1f,0x83,0x37,0x66,0xaa,0x43,0x57,0xe0,0x81,0x70,0x5a,0xe5,0xfe,0x15,0xc6,0x48,
+0x54,0x1e,0xdc,0xc8,0xc4,0xdb,0x31,0x40,0x7,0x65,0xc0,0xe7,0xa3,0x7a,0xfc,0x89,
+0xa2,0xf7,0x12,0xd0,0xd1,0x60,0xd4,0x96,0x43,0x53,0xd9,0x18,0x8,0x2a,0xaf,0x6,
+0x7b,0xa,0x1e,0x34,0x8c,0x4b,0x8c,0xe1,0xed,0xc4,0x80,0x87,0xce,0x3a,0x3a,0x33,
+0xa,0x51,0x60,0x6c,0xad,0x50,0x6,0x3c,0x7c,0xfd,0xf2,0xa8,0xaf,0xa0,0x42,0x42,
+0xb9,0xef,0xa3,0x66,0x1e,0xeb,0x63,0x2c,0xf,0x2e,0x61,0xe7,0x31,0x78,0x2f,0x93,
+0x86,0x87,0xf0,0xa1,0x27,0xa0,0xa5,0x78,0x1f,0x51,0xe,0x2e,0x4,0x5c,0x79,0x6c,
+0x2f,0x86,0x8c,0xcc,0x6b,0x6f,0x8d,0xcc,0x29,0xe3,0x5c,0xa1,0xd7,0x2b,0x92,0x92,
+0xcd,0x18,0xea,0xcf,0xab,0x30,0x57,0x5a,0xd5,0xd4,0xa1,0xed,0x3c,0xf0,0xaf,0xa5,
+0x11,0xbc,0x7a,0x7f,0xf0,0xee,0x1a,0x30,0xe4,0xf0,0xbe,0xa5,0x63,0xfa,0xee,0x7b,
+0xa6,0xc3,0xce,0x83,0xed,0x7,0x65,0x2c,0xbe,0xa4,0xfb,0x41,0x70,0xc9,0xca,0x63,
+0x95,0x32,0xd0,0x30,0xd9,0xa0,0x99,0xab,0x30,0x5,0xc0,0xb8,0x5e,0x5a,0x40,0x20,
+0x68,0x7,0x74,0xa4,0xc0,0xa2,0x4,0xf3,0xa,0x74,0x24,0xf,0x3d,0xfe,0x25,0x3a,
+0x57,0xa8,0x75,0xae,0xb6,0x1b,0x5e,0x39,0x67,0x97,0xcb,0x7a,0xc0,0x99,0x8d,0xcf,
+0xcf,0xa8,0xe,0x49,0x64,0x5e,0xa9,0xf6,0x5c,0x11,0x91,0xea,0x60,0x5e,0xb9,0x75,
+0xd0,0xd9,0x3d,0x4a,0xc7,0x78,0x64,0x33,0xa,0x2f,0x2a,0xad,0x4,0xfb,0x8a,0xaa,
+0x30,0x4c,0xb6,0xc,0xc6,0x6d,0x3b,0xf,0x8b,0x31,0x6f,0x30,0x44,0x8b,0x21,0x2a,
+0x4e,0x46,0xb2,0x8,0x54,0x74,0x30,0x13,0x4a,0xc2,0x32,0x8a,0xca,0xcf,0xe6,0xfd,
+0x80,0x6d,0x28,0x53,0x1d,0x31,0xba,0x83,0x4d,0x3a,0x16,0x4,0x3a,0x57,0x16,0xc3,
+0xcc,0x3c,0x5c,0xb9,0xd5,0x72,0x4b,0x80,0x41,0x75,0x28,0xbb,0xd3,0x23,0xf4,0x26,
+0x8a,0xb8,0x6e,0x32,0x4,0x17,0x3,0xbe,0x3a,0x57,0x65,0x79,0xc8,0xdc,0xda,0xa9,
+0x18,0xc8,0x62,0x38,0x66,0x77,0xd2,0xcc,0xbc,0xc1,0x68,0xe8,0x0,0x86,0x39,0x57,
+0xec,0x5e,0xa5,0x4,0x7a,0x13,0x1b,0x79,0x54,0xe0,0x96,0xa4,0x91,0x9b,0xd1,0xe4,
+0x95,0xbd,0xe7,0xad,0xc,0x43,0x7,0x63,0xd8,0x3a,0x6,0x8c,0xb9,0xda,0xa3,0xb7,
+0x84,0x97,0xcc,0x1d,0x64,0xfb,0x71,0x75,0x64,0x49,0x87,0x49,0x43,0x7b,0x17,0x2,
+0x49,0x9d,0x2e,0xbc,0xeb,0xb6,0xd3,0x5b,0xb2,0xf2,0x9c,0xd3,0x63,0x58,0x66,0xfd,
+0x51,0x8c,0x99,0xfd,0x41,0xbd,0x32,0xe7,0xa,0x66,0xd7,0xba,0xbb,0x96,0x8e,0x76,
+0xb7,0xfd,0x38,0xaf,0x60,0x2d,0x4a,0x9f,0x5e,0x46,0xe0,0xa4,0x4b,0xa4,0x64,0x65,
+0x5e,0x1d,0xed,0xb7,0x74,0x7c,0x88,0xb7,0xf4,0x87,0xcb,0xab,0x36,0x77,0xd7,0xa9,
+0xc3,0xbc,0xbb,0xb6,0x8e,0x4d,0xab,0x3f,0x54,0x67,0x7f,0x1c,0xcf,0x68,0xea,0x8f,
+0xb7,0x8f,0x8f,0xea,0xda,0x26,0xaf,0xec,0xfe,0x38,0x19,0xc3,0xa9,0xc3,0xd1,0xb5,
+0xff,0x81,0x71,0xe6,0x3e,0xef,0xaa,0x6b,0x49,0x37,0x5e,0x19,0x3b,0x8,0x8d,0x62,
+0xdc,0xf6,0x63,0x7a,0x10,0xfa,0x63,0xce,0xdd,0x1f,0x93,0xee,0xbb,0xdb,0xae,0x7,
+0xfd,0x79,0xbb,0xa3,0x5a,0x18,0x3a,0xf2,0xc9,0xe8,0x50,0xd,0x24,0x60,0xae,0x8,
+0xae,0xa7,0x3,0xca,0xbf,0x67,0xb4,0xe8,0x50,0xf4,0x68,0x47,0x6,0xad,0x26,0xae,
+0x6d,0xd7,0x76,0xc9,0x38,0x59,0x9f,0x5b,0x3a,0xbc,0xff,0x89,0xe1,0xec,0x41,0xd6,
+0xb5,0x63,0x3,0x79,0x3b,0xf3,0xb3,0xf6,0x39,0xe4,0xb1,0xd1,0xdd,0x3f,0xc3,0xe9,
+0xbb,0x96,0xee,0xc7,0x29,0xba,0xf6,0x54,0xff,0xc,0x29,0x7c,0x9c,0x57,0x47,0xe9,
+0x60,0xfd,0xe1,0xf0,0xca,0xb8,0xbb,0xb2,0x50,0x36,0xff,0x19,0x4e,0xac,0xe3,0x2f,
+0x80,0x2b,0x83,0xc0,
+};
+
+static const Sound_Data Sound_chime = {
+    .Blob = Sound_chimeBlob,
+    .BlobSize = sizeof(Sound_chimeBlob),
+    .RamSize = 3200,
+    .Version = 0x918225FE, //CRC-32 of the blob
+    .Rate = 8000,
+    .Format = 2, //ADPCM
+};
+
+static const uint8_t Sound_bellBlob[3134] = {
+0x78,0xda,0x5d,0xd7,0xdb,0x53,0x1b,0x57,0x9e,0x7,0xf0,0x6e,0x71,0xeb,0x46,0x10,
+0x77,0xb,0x9,0xfa,0x48,0xe0,0x92,0x84,0xb0,0xd5,0x22,0x33,0x8b,0x40,0x9e,0x45,
+0x38,0xb3,0x85,0x84,0x3d,0x5,0x64,0x1e,0x40,0x64,0xaa,0x8c,0x77,0x1f,0x8c,0xb3,
+0x5b,0x15,0xcf,0xbe,0x60,0xbc,0x55,0x93,0x64,0x5f,0x4e,0x73,0x89,0xbb,0xb9,0xf6,
+0x91,0xc0,0xe9,0x16,0xc8,0xa8,0x45,0x32,0x83,0x40,0xd8,0x8,0xcf,0x6c,0x21,0x90,
+0x33,0x86,0xe4,0x1,0x9,0x67,0xca,0xb8,0xf6,0x1,0x41,0x52,0x65,0x4f,0x5e,0xb0,
+0x3d,0x5b,0x6b,0x67,0x5f,0x7c,0xd9,0x87,0x3d,0xc0,0x78,0x1e,0xf6,0x5f,0xf8,0xd4,
+0xf7,0x7c,0xbf,0xbf,0xd3,0xfb,0x9b,0xdf,0xfc,0xf8,0xdf,0xb1,0xab,0xd7,0x55,0x79,
+0xd6,0x47,0x5,0xb6,0xd4,0xc7,0x5c,0x1,0x47,0xde,0xa4,0x54,0xcf,0xa,0xf9,0xdc,
+0x42,0x5e,0xb4,0x4f,0xcb,0x6f,0xd8,0x60,0x20,0x5a,0xa2,0x54,0x16,0xc0,0x81,0x3d,
+0x2e,0xdc,0x4b,0x82,0x7b,0xb,0x3,0xd4,0x69,0x95,0x4f,0xb7,0x9,0xee,0x3f,0x84,
+0xa3,0xa5,0x1,0xca,0xfd,0x4c,0xdc,0xa8,0xcb,0x77,0xc9,0x13,0x9c,0xe8,0xd8,0x20,
+0x72,0x3c,0xd9,0xad,0x9b,0xd1,0xb2,0xe,0x54,0x9f,0xa9,0x52,0x9a,0xa,0xc5,0xd0,
+0x7d,0x86,0xbe,0xa,0xe9,0x7,0xd2,0x0,0x63,0x9a,0x6,0x4b,0x1d,0xc8,0xf6,0x50,
+0x95,0x6b,0xcf,0x98,0xd9,0x6f,0xa9,0x64,0x20,0xe4,0x5a,0x9d,0x60,0x41,0xcd,0x2e,
+0x4c,0xb5,0x92,0x17,0xd0,0x8c,0x16,0x3e,0x25,0xdb,0xf7,0x6b,0x95,0x8f,0x6,0x94,
+0xaf,0x13,0x36,0x70,0x4d,0xa1,0x73,0x60,0xd0,0x9a,0x77,0x93,0x1b,0xf3,0x41,0xf6,
+0x91,0x84,0xbc,0xe,0xb,0x71,0x9b,0x91,0x5b,0x62,0x96,0xcc,0x49,0x3,0x57,0x90,
+0x83,0xf1,0xe,0xb2,0x4d,0x19,0x43,0x74,0xb9,0xc2,0x26,0x9a,0xc4,0x4b,0x73,0xd2,
+0x4e,0xb8,0x9a,0xbf,0xb6,0x40,0xe7,0xac,0x83,0xcc,0xdc,0x4,0x55,0xdc,0x15,0xd5,
+0xbd,0x12,0x85,0x56,0x43,0x89,0x9c,0x30,0xa0,0x33,0xf7,0xcc,0xb,0x3f,0x2f,0xe3,
+0x6e,0x64,0x51,0xfc,0x1a,0x6c,0x5c,0x2b,0x41,0x4c,0x85,0x2a,0x44,0xda,0x28,0x5f,
+0x52,0xdd,0x29,0x76,0xf0,0xf5,0xb3,0x74,0xbc,0xfe,0x6,0x91,0x7c,0x87,0x33,0x7b,
+0xe6,0x85,0x37,0x9c,0xd0,0x41,0x96,0xcc,0x8f,0x56,0xa3,0xf2,0xc,0x8,0xff,0x5a,
+0xc7,0xaf,0xdc,0xef,0x97,0x3e,0x10,0xbd,0xfb,0xe6,0xa0,0xed,0xba,0xa,0xc7,0x9a,
+0x29,0xf7,0x23,0x65,0x83,0x33,0x2,0x76,0x96,0x50,0x1b,0xee,0x30,0x2f,0x2d,0x4c,
+0xbb,0x71,0x1,0x61,0xae,0x4e,0xb9,0x44,0xd1,0x97,0xcb,0x83,0x39,0x4e,0xbd,0x24,
+0x80,0xd,0xcc,0x75,0x4a,0xe5,0xd2,0xed,0x41,0xfb,0xef,0x54,0xb9,0xb4,0x13,0x58,
+0x73,0xe2,0xb2,0xbb,0xc0,0x5,0x67,0x19,0xc9,0xb1,0x9,0x77,0x5d,0x6c,0xb7,0x6e,
+0x5d,0xdb,0x77,0x8,0x9d,0xf1,0x2a,0xc5,0x55,0x28,0x87,0xd2,0xd6,0xe1,0x3e,0xc1,
+0xfc,0x48,0x1a,0xe0,0x4c,0x61,0x70,0xb3,0x2e,0xe8,0xfe,0x21,0x2c,0xbf,0xfb,0x21,
+0x4d,0xee,0x1f,0x72,0x99,0xe7,0x27,0x58,0xba,0x7c,0x15,0xe6,0x1a,0xd9,0x6e,0x21,
+0x82,0xc2,0x35,0xd0,0x9d,0x7e,0x57,0xe9,0x1e,0x52,0x62,0x98,0xab,0x4f,0xa1,0x77,
+0xe9,0x21,0x46,0x37,0x3,0x66,0x2,0x88,0x7d,0x81,0xb9,0x1a,0xf4,0xc2,0x1f,0x19,
+0xed,0x5c,0xcc,0x92,0x3a,0x61,0x7,0x5,0x19,0x98,0xe9,0x20,0xbd,0xd1,0x8,0x92,
+0x2a,0x64,0x36,0xed,0x55,0x7a,0xe6,0xd4,0xcd,0x99,0x23,0xae,0x5d,0xe7,0x94,0x15,
+0x8d,0x51,0xfa,0x73,0x51,0xdd,0x4b,0x1a,0xb5,0x1a,0xf4,0xf2,0x2d,0x83,0x86,0xb9,
+0x52,0xef,0x19,0xb9,0xc9,0xa7,0x44,0xfc,0x32,0xe1,0xcd,0x8c,0x4,0xb9,0xa,0x85,
+0x58,0x6a,0x15,0x3b,0x35,0xcc,0x65,0xe4,0xec,0x4b,0x20,0xe3,0xb,0x31,0x9b,0x27,
+0x38,0x73,0xcb,0xbc,0xf0,0x9a,0x13,0x2e,0x90,0x25,0xca,0xb4,0x11,0x99,0xb6,0xcc,
+0xf1,0x4f,0x49,0x2e,0x96,0xee,0x57,0x7f,0x25,0xf2,0x59,0xcc,0x55,0x14,0x86,0xe3,
+0x75,0x94,0xff,0x81,0xb4,0xc1,0x1b,0x81,0x6d,0x96,0x9a,0x6f,0xf8,0x82,0x78,0xa4,
+0x67,0xdb,0x1b,0xb2,0xe8,0x8d,0x55,0x78,0xcb,0x95,0x1,0xea,0xc7,0x24,0xbd,0xb9,
+0xa0,0x3,0xe7,0x55,0xb0,0xef,0xd,0xda,0x3f,0xf,0xcb,0xa5,0x3e,0xca,0xfd,0x4a,
+0x8c,0x5a,0xb,0x0,0x9c,0xe0,0x14,0x47,0x92,0xc8,0xd5,0x1a,0x2e,0xe6,0xad,0x6b,
+0xdf,0x35,0x8,0x3d,0xab,0x95,0xf3,0x4d,0x45,0x72,0xff,0xbe,0x53,0xc2,0xe9,0xba,
+0xa7,0xe,0x72,0xe,0x9c,0xae,0xd6,0xa0,0xfd,0x9b,0x69,0xf4,0x93,0x0,0xcd,0x3e,
+0xa3,0x92,0xf5,0x43,0x66,0x65,0xc2,0x4a,0x9b,0x30,0x57,0x1b,0xd9,0x18,0x5c,0x42,
+0xb,0xa7,0x90,0x1b,0xa7,0xab,0x7b,0x48,0x5c,0x49,0xbb,0x41,0x9f,0x5c,0x7c,0x40,
+0xe7,0x73,0xf9,0x33,0xd4,0x74,0x0,0x19,0x5e,0x48,0xb0,0xc9,0xa3,0x17,0xbe,0x67,
+0xb4,0x96,0x43,0x2e,0x3,0x51,0x98,0x81,0xf1,0x8f,0x18,0xcc,0x15,0x53,0x2a,0x64,
+0x6b,0xc2,0x5,0x3b,0x26,0xd5,0x64,0xa2,0x81,0xbf,0x16,0x2f,0x3e,0x70,0xe,0x32,
+0xfd,0x38,0x5d,0x7e,0x8d,0x7c,0x4e,0xc3,0x6e,0xc3,0x8,0xbc,0x5b,0xa6,0x9d,0x59,
+0xae,0x8c,0xff,0xa4,0x1a,0x7c,0xb6,0x87,0xb9,0xa0,0x73,0x75,0x34,0x46,0x60,0xae,
+0x88,0x17,0x76,0xc6,0xc2,0x3b,0x7a,0x8f,0xcb,0x9f,0xa6,0x77,0xdd,0x53,0x8c,0x36,
+0x41,0x98,0x1d,0xd1,0xb7,0x5c,0x8b,0x26,0xd4,0x90,0xab,0x5d,0xf8,0x77,0x1d,0x77,
+0xe7,0x3e,0xa9,0x7e,0x40,0xf1,0x7b,0xc5,0x21,0x6b,0x51,0x98,0x88,0xe0,0x74,0x3d,
+0x56,0x92,0xc0,0xf4,0x96,0xeb,0x41,0x9,0xdb,0xe4,0xc8,0xa0,0xa7,0x56,0xb2,0x3,
+0x96,0x2a,0xc3,0x26,0x98,0xf7,0x14,0x48,0x9f,0x90,0x74,0x72,0x7d,0x90,0x3a,0x8f,
+0x1f,0x23,0x3f,0x69,0xbb,0x11,0x16,0xc7,0xfc,0x94,0xfb,0x89,0x94,0x6c,0xcd,0x7,
+0x38,0x5d,0x8a,0x63,0x93,0xc8,0x60,0xae,0xb2,0x84,0xf6,0xb4,0x5e,0xb8,0x34,0x5f,
+0x12,0x5,0x98,0x6b,0xdb,0x49,0xf7,0x22,0x7a,0x47,0xcd,0xe3,0x3c,0x8b,0xae,0xbb,
+0x17,0x82,0x86,0x6f,0xc2,0xb0,0xaa,0x85,0x66,0x5f,0x8b,0x9a,0x4f,0x57,0x3b,0x3f,
+0xcb,0x42,0xd3,0x32,0xb5,0xd7,0xce,0xb6,0xf5,0xa7,0x63,0x6b,0xa7,0x61,0x5d,0xb6,
+0x52,0x6e,0xbc,0x2e,0xa2,0x44,0x1d,0x8d,0xb9,0x1e,0x89,0x83,0x8c,0x21,0xc2,0x2d,
+0xfa,0xe7,0xc,0x3f,0xea,0xe1,0xfb,0x2d,0xc3,0xe4,0xb7,0x8c,0x16,0x10,0x2c,0xf1,
+0x13,0x6,0xaa,0xe0,0xff,0x71,0xc9,0xbe,0x1b,0x4a,0x72,0xa6,0x9e,0xef,0x8b,0x4b,
+0x8f,0x8,0xcc,0x35,0x4e,0xd,0xb7,0x60,0x2e,0x49,0xe8,0xc6,0xe9,0xba,0x6b,0x88,
+0x9d,0x59,0xb6,0xac,0xfd,0x5d,0x19,0xf5,0x59,0x96,0x8,0x5f,0x25,0xf8,0xd5,0x51,
+0x9c,0x2e,0x89,0xc3,0x5c,0xbe,0x3b,0xb,0xf,0x4b,0x1a,0xf8,0xc0,0x3e,0x95,0x39,
+0xe6,0xa2,0x1d,0xcb,0xfd,0xaf,0x0,0xd9,0x4d,0x8e,0xc8,0x9,0x23,0x72,0x6c,0x59,
+0xe2,0xff,0x9a,0x47,0x7d,0xf1,0x8c,0x94,0xfa,0x44,0x2e,0xa5,0x9f,0x64,0x8a,0x54,
+0x6a,0xac,0x95,0xb2,0x6d,0xa8,0x1b,0x2e,0x7,0x6f,0xbb,0x4d,0xad,0x7a,0xe6,0xb8,
+0x7,0xef,0x30,0xbc,0x23,0x85,0x5e,0x3b,0xfb,0xdf,0x72,0xed,0xb9,0xd4,0x4f,0xfa,
+0xa9,0x64,0x2,0xa7,0x4b,0x72,0x3d,0xe3,0x43,0xb6,0x1b,0xb,0x70,0xac,0x93,0xb2,
+0x1d,0x28,0x5a,0xa3,0xd1,0x5,0x6f,0x33,0x4a,0x8d,0x46,0xe5,0x6a,0x6d,0xed,0x5,
+0x6b,0xda,0x5e,0x7d,0x7f,0xaf,0x52,0x2a,0xd3,0x85,0x72,0xff,0xba,0xb7,0xb8,0x37,
+0x24,0x3d,0x1e,0xce,0xe3,0xce,0x4d,0xbb,0xd2,0xad,0x21,0xfb,0x1f,0x66,0x60,0x55,
+0x40,0x64,0x5f,0x53,0x5a,0x5d,0xbe,0x45,0x9c,0x65,0x65,0xcc,0x95,0x39,0xe2,0x42,
+0x6b,0x3f,0x83,0xcd,0x6b,0x27,0x65,0x67,0xa1,0x72,0xcc,0x25,0x3d,0x12,0xf3,0x98,
+0xea,0x9b,0x60,0xb1,0x27,0x66,0xd8,0x19,0x21,0xde,0xeb,0x92,0x88,0x37,0x84,0xe6,
+0xf,0x1e,0x73,0x6d,0x51,0xb,0x9f,0x30,0xbc,0x36,0x83,0xa4,0x53,0xb2,0x35,0x7d,
+0x56,0xbe,0x34,0x35,0x1f,0x8b,0xb8,0xb9,0x9e,0x55,0xcc,0x95,0xcf,0xbd,0xe5,0x2a,
+0x26,0xdb,0xab,0xa7,0xd1,0xf7,0xba,0x58,0x57,0xd4,0x12,0x3f,0x59,0x4d,0xd,0xed,
+0x11,0xe1,0x1e,0xc2,0xb9,0x1a,0x9,0x51,0x98,0x2b,0xe1,0x45,0xfe,0xdf,0xc7,0x37,
+0x47,0x5b,0x78,0xdf,0x36,0xbd,0x6b,0x1b,0xe2,0x10,0xe6,0x6a,0x58,0x16,0x5e,0x9a,
+0xc9,0x2b,0xba,0x51,0x79,0xd1,0x18,0x6c,0xd9,0xaa,0x54,0xff,0x11,0x73,0xed,0x93,
+0xea,0x35,0x8,0xb6,0xf4,0x21,0x16,0x73,0x45,0xea,0x4,0xdf,0x43,0x75,0x3,0x38,
+0x80,0xed,0x2b,0x6e,0xb5,0x2b,0xc4,0x6f,0x9d,0x60,0x0,0xe6,0x7a,0xe5,0xc4,0x1d,
+0x5c,0xa2,0x84,0xcb,0xe5,0xb2,0x23,0x2e,0x71,0x65,0x5b,0x47,0xfd,0xb3,0x4,0xb2,
+0x20,0x64,0xbf,0x3e,0x4d,0xe1,0xe,0x36,0x3c,0x17,0xa3,0x4e,0x87,0x19,0x77,0x70,
+0xd4,0xb3,0x2,0x72,0x55,0x36,0xde,0xb8,0x87,0x32,0xee,0xfe,0x4b,0x4a,0x69,0x14,
+0x98,0xf0,0x63,0xe4,0xe9,0x5e,0x41,0xda,0x8,0xe7,0x39,0x3f,0x58,0x0,0xfb,0x8d,
+0x93,0xb6,0xdf,0xcf,0xc0,0xca,0xcb,0x22,0xfb,0x8a,0x92,0xeb,0xf2,0x2c,0xe2,0x6d,
+0x56,0x2e,0x4f,0xd2,0x99,0xf7,0xd,0xde,0xc1,0x34,0xca,0x9e,0x23,0x5a,0x17,0x4a,
+0x11,0x5f,0xa4,0x8,0x9,0x2b,0x75,0x55,0x96,0xee,0x49,0xf9,0xce,0x7a,0xcc,0xe5,
+0x9f,0xb3,0xff,0x38,0x42,0x9c,0xfd,0xe0,0x90,0xb,0xf9,0x4,0x8b,0x3a,0x61,0x80,
+0xa6,0x14,0x58,0xfb,0x94,0xf5,0x6a,0x4b,0x31,0xe5,0x67,0xa2,0x33,0x5d,0x8b,0x3a,
+0x3e,0x57,0xd0,0x8c,0x1b,0x5c,0xc6,0x5c,0x5c,0x3e,0xa7,0x9b,0xa0,0x54,0xbf,0xc6,
+0x3e,0xa7,0x89,0x76,0xfb,0x8,0xfc,0x8e,0x45,0x2d,0x5a,0x95,0x5a,0x55,0x6,0x87,
+0x72,0x44,0xb8,0x97,0xe0,0x97,0x17,0x43,0xd4,0x69,0x85,0x5b,0xc2,0x5c,0x5f,0x86,
+0x93,0xa5,0x7e,0xe0,0xcb,0xd2,0x5b,0x75,0x43,0x4e,0x3c,0x59,0x92,0x7,0x73,0x1,
+0xb2,0xcd,0x30,0xa3,0x6d,0x1b,0x5,0xff,0x6a,0x95,0xfa,0x7e,0x3e,0x9c,0xdc,0x27,
+0xa4,0x3e,0xcc,0x35,0x3c,0xc9,0x14,0x60,0xae,0x56,0x68,0xff,0x41,0xd5,0x6a,0x3d,
+0x2e,0xf7,0x1f,0xa9,0xe5,0x96,0x29,0x10,0x3d,0xc1,0x98,0x1d,0x5b,0x42,0xe,0x73,
+0x9,0xa3,0x98,0xb,0x1a,0xb2,0xb5,0xea,0xa7,0x3,0xe2,0xd7,0xeb,0x6,0xfa,0x5f,
+0x14,0x90,0xa5,0xa7,0xd8,0xc1,0x69,0x6a,0xdc,0x7,0x6d,0xcf,0x15,0xcd,0x69,0xa4,
+0x49,0xcc,0xe5,0x88,0x81,0xcc,0x49,0x96,0x37,0x66,0x51,0xd6,0x47,0x5e,0xc0,0xe9,
+0x2a,0x2e,0x17,0xc9,0xf5,0x26,0xe9,0xe3,0x49,0x71,0x63,0xba,0x8c,0x3f,0x8f,0xb9,
+0x9c,0x53,0xec,0x5c,0x84,0x28,0xd,0x88,0xe4,0x81,0x88,0x3b,0xf8,0x28,0x5d,0x8e,
+0xd,0x3a,0xf5,0x4b,0xd6,0x39,0xb8,0x8f,0x52,0x98,0x2b,0x55,0x2a,0x3b,0xf,0xb9,
+0x5a,0xe9,0x4e,0x59,0x7a,0x70,0xcc,0xb5,0x86,0x1f,0xe3,0xf,0xa3,0xc4,0xd9,0x2e,
+0x49,0x78,0x4d,0xa1,0x4e,0xb2,0x52,0x19,0xc3,0x5c,0x5b,0x60,0xa1,0x5b,0xe7,0x8d,
+0xdd,0x12,0xd4,0xf3,0xa2,0x73,0xbb,0x16,0x35,0x5f,0x57,0xff,0xca,0xf5,0x80,0x2a,
+0xe0,0xc,0x13,0x40,0xad,0xbf,0xa3,0x7b,0xae,0x27,0xdb,0x1b,0xa6,0xd1,0x7f,0xb1,
+0xc8,0x8f,0x4a,0x95,0x12,0x23,0xc4,0x93,0x15,0xbe,0x44,0x82,0x8d,0xe9,0x7e,0x11,
+0x73,0xa5,0xdb,0x91,0xef,0x8b,0x78,0x72,0xac,0x5,0xd4,0x3f,0x95,0x76,0xac,0xf9,
+0x40,0xc0,0x5c,0xd,0x9b,0x98,0x8b,0x69,0xd3,0x4d,0xcb,0xf7,0xab,0x83,0x5d,0xab,
+0x27,0xd5,0xa6,0x2,0xcc,0xc5,0xe0,0xe,0x6,0x5b,0xea,0x0,0x53,0x1e,0xe6,0x6e,
+0x36,0xa,0xee,0xff,0x54,0x35,0xcb,0x39,0xc0,0xde,0x17,0x37,0xea,0xa7,0xb8,0xc3,
+0xc9,0x72,0xac,0xc2,0xa7,0x4e,0xf6,0x8a,0x30,0x2a,0x2f,0xd4,0x40,0xfb,0x1e,0xe6,
+0xd2,0xe1,0xe,0xb6,0xd1,0xd7,0xa0,0xf9,0x9,0x3d,0xc9,0xe2,0xe,0x1e,0xed,0x80,
+0xb6,0xc7,0x92,0xdc,0xe4,0xb1,0x90,0xb7,0x89,0xa8,0x27,0xe6,0xca,0x55,0xb1,0xbc,
+0x29,0x87,0x52,0x1d,0x64,0xb7,0x32,0x12,0x95,0x2a,0x20,0x9b,0x6e,0x92,0x7a,0xfb,
+0xa5,0x87,0xb,0x65,0xb8,0x83,0xc1,0x9e,0x73,0x92,0x9d,0xc4,0x93,0x85,0xd3,0xf5,
+0x52,0x44,0x8d,0x65,0x87,0xe9,0xd2,0x6a,0x92,0xe6,0xec,0x7b,0x76,0xef,0x10,0xe6,
+0xfa,0x50,0x68,0x4d,0x95,0xc8,0x78,0xb2,0x84,0x44,0x1b,0xdd,0xa3,0x49,0x3b,0x52,
+0x19,0xd7,0x92,0x30,0x67,0x7d,0x93,0xcc,0xe6,0x28,0xf1,0x6e,0x8b,0x72,0xcc,0xa5,
+0x9f,0x1f,0x37,0xa0,0xf2,0x2d,0x2a,0x7e,0x51,0xc7,0xcf,0xdd,0xd,0xaa,0xe7,0xa1,
+0x77,0xbb,0x12,0xd9,0x8a,0x54,0x18,0x69,0x6,0x3e,0x9c,0x2e,0xca,0xc8,0xb3,0x37,
+0xa9,0x78,0xcb,0x1c,0xf3,0x42,0x4f,0x36,0xd5,0x84,0xd1,0x5f,0xfe,0xc6,0x95,0xb7,
+0x7,0xc2,0x1f,0x93,0xdc,0xc6,0x71,0xba,0xd2,0x4d,0x41,0xff,0xe7,0x61,0x6d,0x34,
+0x0,0xdc,0x7b,0xe2,0x3d,0x6b,0x3e,0x2f,0xcc,0x72,0x92,0x63,0x85,0x78,0xe5,0x62,
+0xda,0xca,0x12,0xe8,0x99,0xfd,0x28,0x5d,0x67,0x8b,0xe4,0x1,0x9c,0xae,0xab,0x90,
+0xba,0x37,0x1c,0x62,0xca,0x55,0x3c,0x59,0x82,0xed,0x9b,0xb0,0x56,0xd9,0x5,0x6c,
+0xdf,0x51,0x51,0xdf,0x80,0xb,0x77,0x30,0x5d,0xbe,0xc,0x73,0x5e,0xb6,0xbb,0x3f,
+0xa2,0xa5,0xca,0x91,0x1d,0xa7,0xeb,0xd7,0x83,0xe2,0x9d,0xb4,0xcd,0x7c,0x4d,0x6,
+0x4f,0xe8,0x1,0x6b,0xc1,0x22,0x35,0xde,0x8c,0xec,0x2f,0x24,0x99,0x77,0x98,0xc9,
+0xaf,0x8,0xad,0x6b,0xce,0x9c,0x3a,0xc1,0x72,0x85,0x5b,0x30,0x75,0x81,0x6c,0x95,
+0xc7,0x64,0xa9,0x5c,0x66,0xb7,0x71,0xba,0x30,0x57,0xd8,0xc0,0x61,0xae,0x2c,0x37,
+0xc4,0x4c,0xce,0x70,0x25,0x7e,0x59,0xf7,0x5c,0x42,0xad,0x76,0xbd,0x7c,0x5b,0x77,
+0xc8,0xb5,0xf6,0x73,0x3b,0xff,0xd9,0x1e,0xc2,0xb,0xdf,0x98,0x1a,0x43,0x5c,0x91,
+0x4c,0x24,0xda,0xf0,0xc2,0x4b,0x3b,0xc3,0x46,0xde,0x9f,0x0,0x6b,0xbe,0x29,0x66,
+0x65,0x9c,0xb0,0x9c,0x53,0x84,0x57,0x14,0x9e,0x2c,0xbd,0x12,0x29,0x43,0x35,0xbb,
+0x20,0x7e,0x91,0xe5,0x30,0x57,0xfc,0x17,0x62,0xe3,0xb6,0x25,0x68,0xad,0x88,0xa3,
+0xa5,0xe,0xca,0xbd,0x23,0xed,0x50,0xd5,0xbc,0xe1,0x36,0x97,0xf2,0xdc,0x61,0x1f,
+0x95,0x30,0xef,0x37,0xac,0x5,0xff,0x97,0x9,0xfa,0x70,0xa9,0x8c,0x16,0xa0,0x7c,
+0xbc,0xf0,0x9f,0x90,0x20,0xb9,0x1e,0x12,0xff,0x5e,0xf1,0xde,0x6d,0xa,0xfa,0x6e,
+0x84,0xb5,0x31,0x3f,0x70,0xbf,0x14,0x97,0xf1,0xc2,0x1f,0xa7,0x8b,0x38,0x30,0xb3,
+0x17,0xd,0x8b,0xda,0x33,0x7b,0xf0,0xf2,0x7c,0xa5,0xea,0x2a,0x84,0xa1,0x7d,0x4e,
+0xea,0x15,0xc0,0x83,0xe1,0x1,0xee,0x88,0xb,0xd9,0xbf,0x89,0xa3,0x92,0x2e,0x60,
+0x7d,0x46,0x2d,0xd7,0xf,0x81,0xe8,0x4,0x23,0x9a,0x8e,0xb8,0xae,0x8,0x8b,0xda,
+0xfa,0x69,0xe8,0xce,0x56,0x2a,0x6d,0x5,0xca,0xdc,0x92,0x15,0x77,0x30,0x3e,0x88,
+0x6,0xac,0x26,0x7c,0x10,0x75,0x20,0xc3,0x9f,0x87,0x91,0xcb,0x63,0x66,0xfe,0x44,
+0x68,0x81,0xa0,0x39,0x7e,0x82,0xa5,0x4c,0x19,0xcc,0xc5,0xb6,0x1d,0x73,0xd9,0x70,
+0xba,0x3e,0xe,0x29,0x9b,0x8b,0xf5,0xae,0x7f,0x53,0xcd,0x39,0x6e,0x90,0x19,0x18,
+0xa7,0x46,0x2e,0xcb,0xec,0x1,0x8d,0xda,0xec,0x7a,0x78,0x8b,0xd5,0x3c,0x9b,0xe6,
+0xb5,0x9f,0xda,0xf9,0xa1,0xbf,0x71,0x51,0x15,0xa,0x99,0x68,0x17,0x3b,0x63,0xea,
+0xce,0x70,0x3,0xdf,0x95,0xa0,0x73,0xb6,0x29,0x26,0x36,0xce,0x59,0x3c,0xa,0xf9,
+0x9a,0xe,0x7e,0x44,0xea,0xe5,0xa5,0x6a,0xb9,0xfc,0x1e,0x1d,0xbf,0x68,0x0,0x5f,
+0x6c,0xb,0x71,0x9c,0xae,0x6c,0x49,0xd0,0x5a,0xa4,0x12,0x91,0x56,0xca,0xbd,0xa1,
+0xee,0xd0,0x78,0xb2,0x66,0x41,0xbc,0xe1,0x4b,0xe6,0x5e,0x29,0xe3,0xf2,0xa4,0xf0,
+0xd9,0xd9,0x7f,0x9,0xea,0xe7,0x47,0x4d,0x72,0x41,0x86,0x3a,0xe6,0x1a,0xa0,0x7f,
+0xa1,0xf0,0xfb,0x20,0x64,0xbb,0x1e,0x96,0xc7,0xf0,0x41,0x74,0x20,0x2e,0x3b,0xb,
+0x79,0x62,0x96,0x10,0xab,0xbf,0x26,0x76,0x2d,0xb6,0x76,0xe3,0xa2,0xf6,0xc6,0x2e,
+0x74,0x44,0x71,0x7,0xe3,0x2b,0xfd,0x19,0xe6,0x22,0xe8,0xe5,0xc5,0x21,0xce,0x33,
+0xcd,0xdf,0x6a,0xc,0xd6,0xff,0xc7,0xb4,0x56,0x15,0xa0,0xf0,0x64,0x45,0xdd,0x83,
+0x2e,0x65,0x96,0xc5,0x57,0x3a,0xcc,0xf1,0xb6,0x8b,0xfd,0xeb,0xda,0xf6,0x19,0xe4,
+0xff,0x2b,0x57,0x1a,0x73,0x21,0xf3,0x81,0x34,0xc8,0x54,0x47,0xa8,0x43,0xae,0x9d,
+0x61,0xb9,0xe9,0x5c,0x31,0xfb,0x2d,0x91,0x6c,0x9,0xd5,0xa6,0x26,0x6c,0x54,0xf9,
+0x2e,0x8c,0xb7,0xb2,0x6d,0x5a,0x22,0x16,0x3e,0x8d,0xb9,0xce,0x8a,0x1f,0xd,0xaa,
+0x2b,0x89,0x7a,0xd7,0xb5,0xf9,0xe2,0x83,0x43,0xae,0x9b,0xdc,0x48,0x40,0x33,0xe0,
+0x74,0xb5,0xd9,0x87,0xe1,0xb7,0x98,0x6b,0xa5,0x32,0xf5,0x53,0x7c,0xa5,0xef,0xc1,
+0x78,0xf,0xd1,0xb8,0x3a,0x86,0xc4,0xa,0x91,0x48,0x78,0xc5,0x9e,0x98,0xfa,0x30,
+0xec,0x0,0x81,0x45,0xfa,0x89,0x6d,0x92,0x89,0x4d,0x10,0xc5,0x2d,0x51,0xf2,0x15,
+0x40,0xcd,0x86,0x51,0x39,0x51,0x16,0x3b,0xb5,0x6a,0x59,0xfb,0xa7,0x32,0xf0,0xe5,
+0x9e,0xa0,0x7e,0x88,0xb9,0xf4,0x73,0x6c,0x85,0xa,0x97,0x9a,0xf1,0x95,0x1e,0x7e,
+0x4c,0x3b,0x80,0xfd,0x16,0x95,0xea,0x9a,0x63,0x76,0x30,0x97,0x23,0x8e,0x17,0x5e,
+0xe8,0x10,0x46,0xa3,0xd3,0xe5,0xb0,0xec,0x9,0x50,0xaf,0x90,0xd4,0x4a,0x7a,0x80,
+0xfe,0x95,0xc2,0x6f,0xbb,0xe6,0xec,0xd7,0xf1,0xd9,0xd9,0x41,0xd5,0xed,0x2a,0x49,
+0xa7,0x9,0x30,0xb3,0xdc,0xbc,0x23,0xc6,0xe5,0x2a,0xd9,0xf6,0xea,0x6d,0xf4,0xd4,
+0x86,0x27,0xab,0x44,0x31,0x17,0x42,0xdd,0x51,0xba,0xe8,0x8d,0x5,0x7c,0x3f,0x86,
+0xc1,0xfd,0xc6,0x90,0xfd,0xb7,0x8b,0xe8,0x9d,0x80,0x68,0x7b,0x4a,0x45,0xeb,0xa,
+0xcc,0x22,0x4e,0x97,0x31,0x49,0xed,0x35,0x19,0xba,0x75,0x69,0xb4,0x5d,0x23,0x34,
+0xa7,0xaa,0x14,0xbe,0x48,0xc,0xa6,0xeb,0x8a,0xfb,0x60,0xf1,0x83,0x23,0x2e,0x30,
+0xd3,0x1c,0x34,0xfc,0xcf,0x30,0x74,0x79,0x24,0xf6,0x7b,0x22,0x1a,0xe8,0xb7,0xcc,
+0x4f,0x18,0x44,0x13,0x7e,0x8c,0x57,0x18,0x6f,0x2c,0x82,0xe2,0x15,0xd0,0xba,0xfe,
+0xae,0x78,0xe1,0x90,0xcb,0x7,0xfa,0x54,0x7a,0x97,0xca,0xe7,0xf0,0xa7,0x66,0xc4,
+0x1f,0xd3,0xbd,0x18,0x16,0xda,0x1b,0x46,0xd0,0x9f,0x30,0x97,0x56,0x19,0x3f,0x69,
+0xa7,0xa,0xb2,0x30,0x75,0x95,0x70,0x2e,0xe3,0x74,0x95,0x8b,0x44,0xda,0xb,0x7b,
+0xe6,0xe2,0xf,0xa7,0x1d,0xfc,0xe5,0x35,0xfa,0xc0,0x3a,0xe8,0x44,0x13,0xdc,0x31,
+0x97,0xd0,0xcd,0x8e,0xc8,0xe9,0xea,0x43,0xae,0x85,0x7f,0x30,0x52,0x93,0xfb,0x82,
+0xda,0x7,0xb9,0xad,0xe1,0x20,0xfe,0xd4,0x10,0x91,0x46,0xd8,0x99,0xc,0x6f,0x58,
+0x6a,0x78,0xfb,0x57,0xd4,0x96,0x7f,0x92,0x5b,0x1e,0x67,0x5c,0x35,0xab,0x78,0xe1,
+0x85,0xb,0x2,0xbe,0xd2,0x4d,0xc8,0x98,0x31,0xab,0x9f,0x62,0xae,0x6d,0x9d,0x84,
+0xb9,0xb2,0x66,0x9c,0xae,0x38,0x1c,0x77,0xff,0x1f,0xf7,0x2d,0x82,0xd7,
+};
+
+static const Sound_Data Sound_bell = {
+    .Blob = Sound_bellBlob,
+    .BlobSize = sizeof(Sound_bellBlob),
+    .RamSize = 3600,
+    .Version = 0x1AA48F23, //CRC-32 of the blob
+    .Rate = 8000,
+    .Format = 2, //ADPCM
+};
+
+static const uint8_t Sound_pulseBlob[108] = {
+0x78,0xda,0x2b,0x28,0xff,0xfb,0xbf,0x74,0xfa,0x6b,0x49,0x97,0x89,0x67,0xc0,0xd8,
+0x4,0x82,0x39,0x54,0x26,0x9e,0x6,0xd2,0x7b,0x35,0x81,0x58,0x52,0x15,0x89,0xed,
+0xd2,0xb0,0x46,0xd2,0x79,0xe2,0x1e,0x49,0xd3,0x85,0x40,0x3c,0x71,0x2d,0x12,0x7b,
+0x54,0xf,0x8a,0x9e,0x85,0x7b,0x34,0x81,0x6c,0x4d,0xe5,0x89,0x6b,0x24,0x94,0x26,
+0xcc,0x12,0x68,0x60,0xe8,0x0,0x22,0x6,0x8e,0xe,0x10,0xcd,0x1,0x67,0x83,0x28,
+0xe,0x20,0xb7,0x61,0x2,0xc3,0xc8,0x4,0x5,0xa3,0xe9,0x6f,0x34,0xfd,0x8d,0xa6,
+0xbf,0xd1,0xf4,0x37,0x42,0xd3,0x1f,0x0,0x51,0x11,0xd6,0x3b,
+};
+
+static const Sound_Data Sound_pulse = {
+    .Blob = Sound_pulseBlob,
+    .BlobSize = sizeof(Sound_pulseBlob),
+    .RamSize = 1920,
+    .Version = 0xAD6C91D9, //CRC-32 of the blob
+    .Rate = 8000,
+    .Format = 2, //ADPCM
+};
+
+static const uint8_t Sound_riseBlob[1757] = {
+0x78,0xda,0x4d,0x53,0xbb,0x72,0xe2,0x58,0x1a,0x5e,0xb,0x7,0x2d,0xf5,0x6,0x1e,
+0x84,0xab,0x90,0x27,0x61,0x2c,0xa9,0xb,0x7a,0x13,0x61,0xa4,0x2e,0x3a,0xb3,0x2e,
+0x54,0xcd,0x86,0x8d,0xfa,0xd,0xfc,0x2,0x9b,0x4d,0xda,0x92,0x23,0xb,0x4f,0x15,
+0x62,0x12,0x37,0xe0,0x2a,0x98,0x88,0x36,0x62,0x8a,0xde,0x48,0x42,0x47,0x1d,0xa3,
+0x8b,0x67,0x63,0x4b,0xf3,0x6,0xe,0xf7,0x5,0xf6,0x3b,0x78,0xb7,0x76,0x2,0xa4,
+0xa3,0xf3,0xff,0xff,0x77,0x3b,0x87,0x7f,0xfc,0xf4,0xd3,0xbf,0xff,0x35,0x3d,0x19,
+0xa8,0x7c,0xf8,0x7b,0x30,0x55,0x6,0x52,0x3d,0x7a,0x8c,0x47,0xfa,0x40,0x64,0x76,
+0xbf,0xef,0x6e,0x2e,0xde,0x49,0x4e,0x4a,0x2,0xd6,0x90,0xc5,0x4f,0x79,0x31,0x15,
+0x4c,0x95,0x5f,0x3c,0xc7,0xb3,0xd6,0xc7,0x5e,0x3d,0x7c,0x8c,0xbd,0x2e,0xca,0x51,
+0xb1,0xbe,0x31,0xad,0xf3,0x4f,0x39,0x99,0x35,0x2d,0xa9,0xbe,0x7a,0x5e,0x7b,0xca,
+0xe0,0xc2,0x49,0xab,0x7,0x76,0xd8,0x6b,0x8c,0x2b,0x74,0xf,0x7a,0xcc,0xbe,0x78,
+0xe0,0xc,0x55,0xfc,0x54,0xe4,0xf,0x2d,0xab,0xc7,0x80,0x83,0x35,0xac,0xf3,0x71,
+0x99,0x7f,0x3e,0x51,0xd5,0xa3,0xe8,0xf1,0x81,0xa5,0xd0,0x45,0xe0,0x29,0x56,0xcf,
+0x29,0x83,0xf5,0x89,0x2d,0xd5,0xbf,0x14,0x68,0xd2,0xce,0xef,0x9e,0xd7,0xd3,0xee,
+0x47,0xd1,0x1,0x41,0xdb,0x92,0x18,0xf0,0x9,0x43,0xb5,0x1e,0xa2,0xf8,0xc1,0xe4,
+0xc7,0xb4,0x38,0xe0,0x69,0xf1,0x7,0x4d,0x75,0x32,0xb2,0x6e,0x59,0x92,0x1b,0x25,
+0xeb,0xe6,0x4b,0xeb,0xab,0xab,0x1e,0x13,0x3e,0xae,0x5f,0x99,0x6a,0x2d,0x4c,0x2,
+0x90,0xd4,0xc3,0x3f,0xd6,0xaf,0xc,0x95,0xff,0xf2,0xb8,0x7b,0x35,0xec,0xf1,0x7b,
+0x12,0x8,0x78,0x45,0xdf,0xe6,0xc2,0x50,0xac,0x45,0xdf,0x66,0x1d,0x5b,0x62,0xd2,
+0x1c,0x56,0x7a,0x6e,0x99,0xcf,0x14,0xb,0xbc,0x89,0xf7,0x83,0xd6,0x1b,0x43,0xdb,
+0x85,0xc6,0x2f,0x1e,0x77,0x14,0x64,0x5f,0xcd,0x9a,0x76,0xcf,0xcd,0x8a,0x69,0xcb,
+0x3a,0xf7,0xcb,0x78,0x64,0x58,0xf5,0xc5,0xf3,0x3,0x6b,0xa8,0xdf,0x81,0xbb,0xad,
+0xa9,0x7e,0x46,0xa6,0xba,0x7d,0x7e,0x57,0xec,0x0,0x5f,0x4b,0x13,0xea,0xfa,0x13,
+0xa2,0xb9,0x78,0x57,0x5f,0x25,0xf3,0xa6,0x29,0x39,0x59,0x30,0xed,0x6a,0xe2,0x2a,
+0x9,0x4,0xa,0x94,0x78,0x8a,0x26,0x6e,0x21,0xcd,0x36,0x9d,0x34,0x9e,0xe9,0x80,
+0x2b,0x1e,0x4,0x5b,0xfa,0x4b,0x76,0xc0,0xe,0x8b,0x87,0x13,0x55,0xf2,0xcb,0x80,
+0xbd,0xd0,0x8e,0xa2,0x64,0xd6,0xd5,0x1a,0x8b,0x2a,0x6e,0x5e,0x89,0x4e,0x19,0x7b,
+0x43,0xb3,0x8e,0xad,0xd6,0x3b,0xe4,0x17,0x43,0xb7,0x5f,0x5,0x37,0x86,0x7a,0x94,
+0xe6,0xc0,0xe7,0xc3,0xc7,0x87,0x96,0x2a,0xfd,0xb7,0xb7,0x8a,0x39,0x5b,0x72,0xd3,
+0xc0,0xeb,0x6a,0xb5,0xe8,0x71,0xaa,0x58,0xf5,0x15,0x99,0xb7,0xad,0x73,0x28,0x6f,
+0xda,0x22,0x8e,0x4a,0x38,0x4c,0xb3,0x86,0xe4,0x66,0x1,0xa7,0xab,0x47,0x59,0xee,
+0x19,0x26,0x93,0x92,0xcf,0x17,0x5a,0x2d,0x25,0x23,0x5d,0xad,0xbf,0x3c,0xa3,0x6f,
+0x14,0x1b,0xeb,0xee,0x3b,0x66,0x4f,0x79,0x90,0x1c,0x40,0xf,0x55,0x99,0x49,0xe3,
+0xd1,0x50,0x62,0xb2,0x9c,0x33,0xcc,0xa3,0x8c,0xb0,0x43,0x71,0x52,0xc6,0xec,0x95,
+0xe8,0x43,0x84,0x25,0x2e,0x8b,0x75,0xdb,0x12,0x57,0x7f,0x4c,0x5b,0xb8,0x71,0x14,
+0x6,0xc0,0xde,0x87,0x1e,0x3,0xda,0xe1,0xa1,0xe5,0xe3,0xf9,0x1d,0x59,0x2b,0x83,
+0xfa,0x97,0x4,0x88,0xcc,0x53,0xec,0xd9,0x92,0x93,0x7,0x4d,0xfb,0x7c,0x41,0xe6,
+0x2d,0xab,0x1e,0x15,0x9f,0x2f,0x64,0xc8,0x63,0x21,0x18,0xa1,0x68,0xf5,0x30,0x99,
+0xea,0xf2,0xd1,0x6e,0xc3,0x9a,0xd2,0x98,0xac,0xfb,0x3,0x74,0xdc,0x74,0x35,0xa7,
+0x5c,0xb,0xf0,0x5d,0xc0,0xe4,0x77,0xbb,0xd,0x87,0x5a,0x85,0x20,0x8e,0xc3,0xe4,
+0xc6,0x30,0xfd,0x12,0x12,0x70,0xc,0x9e,0x2e,0xb9,0x14,0x99,0x5f,0x15,0x5e,0x57,
+0x65,0x9e,0xd7,0x8,0x21,0x2c,0x46,0x2f,0xbb,0xaa,0x18,0x7e,0x43,0xc3,0xe4,0xd0,
+0x1b,0x6e,0x3c,0x43,0xf2,0xab,0x59,0xcb,0x62,0x22,0xa,0x76,0x57,0x4d,0x15,0x99,
+0x29,0xd7,0x74,0x36,0x19,0xd,0x7b,0xfe,0xf3,0xac,0x6f,0xc1,0xf7,0xd9,0x15,0xce,
+0xc0,0xeb,0xca,0x4e,0x1e,0xb7,0x6,0x68,0x65,0xcd,0xc6,0x82,0x46,0xe2,0x67,0xeb,
+0x96,0x56,0xcf,0x88,0x0,0x82,0xc4,0x1b,0xe2,0x32,0xcd,0x94,0x37,0x6e,0x16,0xb7,
+0x11,0x22,0x9a,0xc4,0x3,0x8,0x36,0xbb,0x9a,0x5b,0xe1,0xf6,0xd4,0x32,0xf2,0x8a,
+0xa,0xbc,0x31,0x1b,0x63,0x9a,0xb7,0x4f,0xe6,0x8a,0xec,0x96,0xb8,0xfe,0x4c,0x16,
+0x37,0x69,0xf0,0xac,0xda,0x58,0x6d,0x38,0x3,0x97,0xc0,0xbb,0x90,0xc7,0xd5,0x14,
+0x94,0xd5,0xac,0xab,0xba,0xcf,0x90,0x78,0x94,0x1,0x82,0xc9,0x82,0x26,0x55,0xd4,
+0xb4,0xf8,0x5d,0x22,0x20,0x36,0x72,0x66,0xf1,0xfb,0x1c,0x5c,0x7b,0xc2,0xda,0xfc,
+0x36,0xe1,0xa8,0x14,0xee,0x4f,0xab,0x3f,0x3d,0xbe,0xd0,0x47,0x94,0x80,0x24,0xdc,
+0xb0,0x36,0x66,0x5,0xab,0x96,0xc6,0xc2,0x80,0x49,0xd7,0x1d,0x8a,0xdc,0xd6,0x8e,
+0x4a,0x10,0x39,0xe5,0x54,0x51,0xfd,0x67,0x4f,0x51,0xc7,0x5,0x64,0x2c,0x88,0x67,
+0x4a,0x21,0xe1,0x2c,0x3e,0x2,0x23,0xdc,0xb7,0x55,0xb7,0x5c,0x2b,0x1a,0x94,0xe9,
+0xe6,0x98,0x4c,0x4d,0x69,0x55,0xb0,0xc3,0xfa,0x17,0xd2,0xb1,0xeb,0xd9,0x1c,0x45,
+0x32,0xef,0xaa,0xcb,0xc2,0x33,0x7a,0xe1,0x23,0x6b,0xf2,0x29,0x32,0x67,0x68,0xbf,
+0x5f,0xe1,0x8,0xee,0x8,0xb4,0xa5,0x71,0x67,0x70,0x94,0xcd,0x14,0xd,0xe,0x8d,
+0xc6,0xb6,0x12,0xcc,0x7a,0x16,0xf7,0xdf,0xb8,0xd5,0x54,0x17,0x17,0xc9,0xd9,0x10,
+0xd,0x6d,0xed,0xba,0x78,0xd0,0x71,0xc1,0x6f,0xcc,0xf3,0x34,0x0,0x28,0xc8,0x7a,
+0x8b,0x47,0xd6,0x0,0xde,0x9,0x28,0x6e,0x75,0x71,0x9b,0xb0,0x16,0xb3,0xbb,0x6f,
+0xa9,0xcb,0xca,0x33,0x1a,0x21,0x69,0x6a,0x4e,0xb6,0x36,0xa4,0xc5,0xe6,0xcc,0xac,
+0x65,0x1,0x1c,0x24,0x9e,0xcd,0x47,0x9b,0xa6,0xec,0x92,0xd1,0x50,0xdc,0xe7,0x4d,
+0x80,0x20,0xd0,0xc5,0x86,0x85,0x9e,0xd9,0x65,0x6f,0x91,0x70,0x16,0x4,0x2b,0xd2,
+0xb2,0x60,0xcd,0xc3,0x62,0x8c,0x5,0x93,0xfe,0x6f,0xf1,0xf4,0xd0,0x55,0xb7,0x5,
+0x6b,0x33,0xd9,0x8c,0x4e,0x9,0xe6,0x35,0xf4,0xf5,0xf6,0x41,0x47,0x75,0xb,0xef,
+0xc3,0x79,0x44,0xfa,0x9a,0x5f,0xdc,0x18,0x7c,0xb6,0x56,0xde,0x8c,0x71,0x72,0xb5,
+0xe7,0x69,0xf7,0x74,0xfb,0x52,0xa6,0x32,0x15,0x79,0x91,0x9f,0xa9,0xd7,0xd5,0xcc,
+0xc0,0x99,0xb6,0x55,0xbf,0x60,0x8d,0x3a,0x92,0x95,0x57,0xa4,0x29,0x4f,0xf2,0xd7,
+0xe6,0x71,0xa,0x11,0xab,0xdf,0x4,0x75,0x52,0x79,0x66,0xed,0xe9,0xf0,0xd1,0x31,
+0xe9,0x7,0x5f,0x82,0x31,0x24,0x6d,0xcd,0x27,0xdc,0x95,0x9b,0xce,0xc,0x11,0x68,
+0xea,0x2,0xe9,0x3b,0xf8,0xf3,0xa1,0xaa,0x8b,0xe1,0x6f,0x6d,0x75,0x8c,0xb3,0x77,
+0xf3,0x11,0x5,0xa2,0xed,0x2d,0x79,0x49,0x68,0x87,0x87,0x63,0x58,0x23,0x90,0xfb,
+0xbe,0xb9,0xd8,0x74,0x4c,0x7,0x5e,0xdc,0xd2,0x33,0xea,0x4f,0xd3,0xae,0x14,0x6d,
+0x14,0x4,0xd4,0xa1,0x62,0x6c,0x27,0x3,0x6d,0x39,0xd2,0xc5,0x6c,0x7e,0x29,0xee,
+0x63,0x45,0xdb,0x92,0x8e,0xe6,0x27,0x2,0xf4,0x73,0x26,0x93,0xcf,0x6c,0x1e,0x45,
+0x3e,0x45,0x31,0x22,0x8a,0x46,0x2d,0x2c,0x8a,0xa6,0xe9,0x57,0xac,0xea,0x54,0x68,
+0x80,0xce,0x6b,0xc0,0xd6,0xb2,0x5b,0xbd,0x9e,0xce,0xf4,0x46,0x14,0x74,0xe5,0x8,
+0xa6,0x57,0x9b,0x16,0x28,0xda,0x2a,0x92,0xd0,0x16,0x40,0x1c,0x13,0x81,0xfe,0x2c,
+0x3f,0x67,0xd5,0x49,0x21,0x98,0xe,0x39,0xbb,0x72,0xe2,0xef,0x2d,0x17,0xde,0x9c,
+0x8c,0x33,0xdd,0xfc,0x35,0x5c,0x70,0xe6,0x75,0x41,0xd7,0xde,0x61,0xed,0x56,0x9c,
+0x3d,0x29,0x59,0xc3,0xad,0x58,0xd3,0xa1,0x3f,0x4,0xe9,0x93,0x33,0xe4,0xf1,0x56,
+0x83,0x49,0x6d,0x59,0xb4,0xcd,0x5,0xe9,0xab,0xdb,0x4d,0x5b,0xde,0x6,0x7d,0x39,
+0xc,0xe0,0x0,0xe7,0x6,0x1d,0xc7,0xd1,0x1c,0x9a,0x46,0xc3,0xeb,0x92,0x33,0x18,
+0xe8,0x74,0x11,0x92,0x4f,0x9a,0xea,0x72,0xd3,0x91,0x57,0xf1,0x8f,0x12,0x5a,0x1b,
+0xd1,0x5c,0xe7,0xb3,0xd9,0xb0,0x96,0xbf,0xb6,0xf,0xc,0x50,0x37,0xe,0xde,0x4b,
+0x5b,0x72,0xd9,0x83,0x5d,0xfe,0x69,0x6a,0xd4,0x2a,0x6e,0xe8,0x64,0xac,0xe9,0x13,
+0x18,0xd9,0x50,0x2,0x3a,0x61,0x1e,0x53,0x6d,0xf0,0xb0,0x4,0x77,0xb8,0xb9,0x14,
+0x9f,0xa6,0x7a,0xd,0x3c,0x2e,0x11,0x80,0xff,0x1e,0x5b,0xdd,0x46,0xa,0x5c,0xd0,
+0x4e,0x48,0x47,0xfd,0xba,0xe9,0x9f,0x86,0x73,0xbd,0x96,0xbd,0xb6,0x27,0x95,0x20,
+0x2d,0x89,0x22,0xed,0xd7,0xc6,0x71,0xe6,0xd9,0x4e,0x2e,0xa8,0xb,0xa2,0xc8,0xd1,
+0xfd,0x5,0xff,0xcc,0x41,0x40,0x7,0x2c,0x97,0x3c,0x66,0xaf,0x73,0xce,0x1a,0xc7,
+0x7f,0x97,0xf6,0x33,0x9d,0x7f,0x81,0x81,0xc1,0x4b,0xb1,0x1c,0xe1,0xb8,0x4,0x78,
+0x6,0xe7,0x68,0xe8,0xe6,0x90,0x80,0x98,0xa3,0x9f,0x75,0x6,0xc9,0x50,0xa4,0x74,
+0x64,0x5c,0x57,0xff,0x5f,0x92,0xb7,0xd6,0x22,0x50,0x1a,0x29,0xc6,0xf2,0x8e,0x1a,
+0xde,0x5f,0x42,0x84,0xfa,0x6b,0xd1,0x3e,0xd,0x67,0x43,0x3a,0xf2,0x15,0xf7,0x20,
+0x1b,0xd9,0x93,0x43,0xb1,0x7b,0x5c,0xb2,0xbd,0x7f,0x26,0xca,0x69,0x74,0x3b,0x74,
+0xf2,0xb6,0x19,0xde,0xeb,0x4c,0x76,0x66,0x7e,0xd,0x94,0xd3,0xdd,0x5f,0x11,0x41,
+0x5f,0x8e,0xe6,0x94,0x53,0xa5,0x66,0x2a,0x5a,0xb8,0xe4,0x4b,0xce,0xf4,0x37,0xad,
+0x46,0x74,0xb,0x89,0x6d,0x39,0xba,0x45,0x6,0x1d,0x39,0x9c,0x23,0x72,0x41,0xda,
+0x6,0x1f,0x98,0xf8,0x6f,0xda,0xf6,0xfe,0xb2,0x4e,0xd5,0x6d,0x40,0xce,0x81,0xb1,
+0x7b,0x8c,0xd7,0x72,0xa3,0x34,0x32,0xce,0x1e,0x43,0x5c,0xf6,0xfd,0xe1,0x5,0xee,
+0xaf,0xf0,0x5e,0xb1,0xd2,0xd7,0x0,0xf0,0x82,0x89,0x71,0x37,0x3,0xca,0x5c,0xbf,
+0x3e,0x60,0xe,0x9d,0xf8,0x3d,0x4c,0xd9,0x7e,0x8e,0x19,0xf,0x8,0x0,0x3a,0x33,
+0x17,0xf7,0xdd,0x5a,0x21,0xc8,0xe1,0xed,0xc5,0x2f,0x45,0x5b,0x4a,0x5f,0x43,0xce,
+0x1,0x6b,0xb,0xf1,0x55,0x47,0x82,0xa2,0x49,0xd0,0x97,0x20,0xf3,0x5,0x55,0xa,
+0xb1,0x41,0x5a,0xa7,0x29,0xd7,0xa3,0x1b,0xe4,0xad,0x7c,0xd8,0xa0,0x62,0x70,0x53,
+0x8d,0x5f,0xf2,0xf7,0x14,0x63,0x19,0x5c,0xd6,0xaa,0xa6,0xb8,0x1f,0x99,0xbf,0x42,
+0x19,0xc4,0xc3,0xd1,0x24,0xfe,0x91,0xa7,0xb8,0x3f,0x77,0x27,0x71,0xff,0x74,0x77,
+0xd6,0xdb,0xce,0xcf,0x27,0xd3,0x93,0xff,0x0,0x36,0x33,0xf7,0x4d,
+};
+
+static const Sound_Data Sound_rise = {
+    .Blob = Sound_riseBlob,
+    .BlobSize = sizeof(Sound_riseBlob),
+    .RamSize = 2400,
+    .Version = 0x56176CC4, //CRC-32 of the blob
+    .Rate = 8000,
+    .Format = 2, //ADPCM
+};
+
+static const uint8_t Sound_trillBlob[277] = {
+0x78,0xda,0x2b,0x28,0xff,0x5f,0x5f,0xfe,0xd7,0x52,0xec,0x24,0x97,0xf3,0x82,0x39,
+0x8e,0x4d,0x6b,0x2c,0x45,0x4e,0x72,0x5,0x83,0x58,0x7b,0x2c,0x50,0x59,0x1b,0x56,
+0x7,0x35,0xdd,0xd6,0x0,0xb2,0x4c,0x36,0xac,0x71,0x6a,0xba,0x6d,0xa1,0x7c,0xb,
+0xc8,0x9a,0xeb,0xd8,0x74,0x5a,0x43,0x74,0x17,0x97,0xc9,0x41,0xa0,0xec,0x1e,0xb,
+0x51,0x90,0x29,0x40,0xb1,0x35,0x20,0x75,0xce,0xb,0x80,0xea,0x10,0x62,0xa7,0x41,
+0x62,0x2a,0x1b,0x81,0xe6,0x81,0xf5,0x42,0x4d,0x56,0x39,0x5,0x31,0x19,0xa6,0xce,
+0xa8,0x69,0x8f,0x27,0x92,0xc9,0x40,0x1d,0x20,0x75,0xa7,0x35,0x80,0xea,0x10,0x62,
+0x48,0x2e,0x45,0xb8,0xea,0x86,0x96,0xc8,0x1e,0xc7,0x45,0x73,0x54,0x4e,0x68,0x89,
+0xac,0x71,0x18,0xc2,0x34,0xd8,0x6f,0x20,0xff,0xe,0xa1,0xb0,0xc7,0xe2,0x2a,0x97,
+0x1b,0x5a,0xac,0xa7,0xd,0x37,0xf7,0x1a,0xbf,0x90,0x44,0xa5,0x6f,0x68,0xb1,0xec,
+0x4e,0x98,0xd8,0xeb,0xbc,0xd3,0x9a,0x75,0x77,0xc0,0xa2,0x9e,0xc1,0x2e,0x6e,0xbc,
+0x61,0x4d,0x10,0x9e,0x5c,0x41,0x20,0xa7,0x80,0x42,0x9c,0x3a,0x2c,0x8a,0xe3,0xed,
+0x4,0x92,0x3f,0xe1,0xf4,0xc2,0x1e,0xbc,0xfc,0xc1,0x18,0x3f,0xe8,0x29,0x71,0xa8,
+0xe6,0x94,0x17,0xa3,0xf9,0x63,0x34,0x7f,0x8c,0xe6,0x8f,0x41,0x99,0x3f,0x40,0xfc,
+0x93,0x5a,0xac,0xbb,0xc1,0xed,0x9,0x49,0x96,0xd5,0xe,0x60,0x3e,0xb0,0x7e,0x9e,
+0xd8,0x63,0x74,0x2,0x21,0xbf,0x1a,0xc6,0x77,0x4,0xf3,0x59,0x76,0x7,0x2e,0xec,
+0x76,0xde,0x9,0x54,0x67,0xb8,0x70,0xb6,0xca,0xe,0x2d,0xe6,0xd5,0x8a,0x13,0x3b,
+0x1,0x21,0x61,0xfb,0x8f,
+};
+
+static const Sound_Data Sound_trill = {
+    .Blob = Sound_trillBlob,
+    .BlobSize = sizeof(Sound_trillBlob),
+    .RamSize = 2400,
+    .Version = 0x726BEAF3, //CRC-32 of the blob
+    .Rate = 8000,
+    .Format = 2, //ADPCM
+};
+
+static const uint8_t Sound_dingdongBlob[2052] = {
+0x78,0xda,0x95,0x56,0xbf,0x72,0xe2,0xda,0x1d,0xbe,0xc8,0xc9,0xc,0x70,0x1b,0x1b,
+0x51,0xc0,0x56,0x18,0x89,0x3b,0x6c,0x7,0x48,0xf2,0xb8,0x34,0x48,0x3c,0xc0,0x22,
+0x9e,0xe0,0xf2,0x2,0x99,0x49,0x71,0x5b,0x43,0x87,0x68,0xd0,0xa6,0xf1,0x4a,0xcc,
+0x5c,0xb9,0x3,0x4,0x99,0x2d,0x1,0x1d,0xb9,0x36,0x92,0x9c,0x7e,0x25,0x3f,0x41,
+0xfc,0xc,0x99,0xe4,0x3b,0x47,0x18,0xb3,0x9b,0xdd,0xdc,0x49,0x7d,0xc4,0xf9,0x7d,
+0xbf,0xef,0xdf,0xe1,0x2f,0xbf,0xfd,0xf6,0xef,0xdf,0x7f,0x15,0x9d,0x27,0xeb,0x46,
+0xc9,0x24,0xab,0xf7,0x9a,0xb0,0x7d,0xf8,0xb9,0x27,0x4e,0x43,0xb7,0xa1,0x9c,0x5,
+0x24,0x27,0x8b,0x4e,0x64,0x35,0x6b,0xa3,0xd8,0x2d,0x69,0x85,0xb9,0x9f,0xef,0x48,
+0x66,0x34,0xab,0xc8,0x5,0x1c,0xe9,0x82,0x13,0x4d,0x6e,0xd4,0x4c,0xbc,0x2b,0xc9,
+0xc5,0xd,0xf9,0xb9,0x53,0xbb,0xd,0xdd,0x8a,0xc2,0x7,0x24,0x3f,0xa8,0x4e,0x89,
+0xdb,0x96,0xb9,0xc4,0x2b,0x69,0xfc,0xdc,0x9f,0xf4,0x24,0xf3,0xc5,0xae,0x2b,0xdc,
+0xd6,0xcf,0xf5,0x84,0xfb,0xc8,0x6e,0x2a,0x99,0xd8,0x2d,0xd3,0x23,0xab,0x23,0x9b,
+0x89,0x5d,0xd7,0xa,0xec,0x68,0x1a,0xd9,0x97,0xca,0xe8,0x8b,0x5b,0x1e,0x14,0x1c,
+0x32,0x69,0xd7,0x86,0xa1,0x5b,0x57,0xf8,0x3d,0xc9,0xab,0xe2,0x7d,0x62,0x37,0x14,
+0x2e,0x20,0x65,0x5d,0xc0,0xaf,0xda,0xf2,0x30,0x5c,0xd5,0x65,0xfe,0x31,0xca,0xb5,
+0x5,0x33,0xb2,0x1b,0x1a,0xb7,0x5b,0xe7,0x74,0xde,0x79,0x3d,0xd2,0xb,0x9b,0x68,
+0xdc,0x91,0x70,0x61,0x45,0x1,0xd8,0xb2,0x2a,0xde,0xa5,0x7b,0xec,0xea,0x3a,0xbf,
+0xf0,0x8d,0x9e,0x60,0xbe,0x2c,0x2b,0x1a,0xb7,0xf7,0x70,0xa1,0xe3,0xdb,0x6d,0x79,
+0x14,0x92,0x92,0x56,0x5d,0xf8,0xe3,0xb6,0x68,0x86,0xee,0x75,0x97,0xdb,0xae,0x73,
+0x9d,0xe2,0x34,0xb1,0x2e,0x6b,0xa3,0xc0,0x2b,0xf5,0xb,0xf3,0x68,0xdc,0xac,0x99,
+0xf1,0xf2,0x5c,0xe3,0xb6,0x24,0xd7,0x2b,0x4e,0x43,0xfb,0x46,0xe4,0xe8,0x1e,0xd5,
+0x4d,0xf4,0xa9,0x5,0xb0,0x33,0x8c,0xdd,0xae,0xf3,0x3d,0xc1,0x61,0x60,0x63,0xaf,
+0x34,0xa8,0xce,0x23,0xa3,0x2d,0xd,0x5f,0x96,0x38,0x7a,0xc,0x73,0x1d,0xc9,0x89,
+0xe,0x7b,0xc8,0x22,0x8e,0x9a,0xb5,0x61,0x6c,0x83,0x59,0x8c,0xc5,0xf6,0x9,0xc0,
+0x72,0x5f,0xbc,0xf2,0xa0,0xea,0xe0,0x48,0x1e,0xbd,0xd8,0x25,0x59,0xd8,0x13,0x23,
+0xd5,0xa3,0x9b,0xd9,0xbe,0xea,0xa1,0xc,0xff,0x97,0x1e,0xf4,0x68,0x43,0x8c,0x37,
+0x3d,0xde,0xfd,0x5a,0x9d,0x46,0x46,0x43,0x1e,0xc5,0x7,0x3d,0x70,0x14,0x2f,0x2b,
+0x3a,0xf7,0xe8,0xe5,0x7,0x82,0x43,0x66,0x4d,0x99,0x8b,0x57,0x59,0x99,0xff,0xfc,
+0x64,0xb4,0x64,0xa,0x56,0xa6,0xa4,0xeb,0x54,0x2a,0xa,0x76,0x9d,0x55,0x41,0xfa,
+0xe4,0x83,0xf4,0x11,0x88,0x14,0x48,0x95,0xef,0x51,0x66,0xd9,0x8a,0x50,0xf1,0x33,
+0xc0,0x2a,0xc3,0xc4,0xad,0x6b,0x67,0x1b,0x1c,0x9,0xf7,0x2f,0x56,0x45,0x3e,0x8b,
+0xbd,0x9c,0x26,0x7c,0x7e,0xc6,0x1e,0xc3,0xd8,0xab,0x6b,0xfc,0x63,0x98,0xff,0x0,
+0xa9,0x96,0xd,0x2d,0x3,0x66,0x75,0xba,0x62,0x3,0xcc,0xae,0xea,0x2a,0xbf,0xf9,
+0xbb,0x41,0xf7,0x70,0x2b,0xdd,0x8b,0x1d,0xc9,0x61,0xfb,0xc4,0x6a,0x6a,0xc3,0xc0,
+0x7d,0xaf,0xf1,0x1b,0xdf,0xe8,0xc8,0xb7,0x64,0x5,0xa9,0xf0,0xab,0x1e,0xf6,0xb0,
+0x9a,0xd4,0x57,0x30,0x2a,0x7e,0xd5,0x96,0x3e,0x46,0xee,0x75,0x1f,0x7a,0xe4,0xf5,
+0xff,0x5b,0x8f,0xb3,0x6d,0x34,0x96,0x6a,0xd3,0x64,0x79,0x89,0x15,0x57,0xcc,0x3c,
+0x46,0xf3,0x97,0x61,0xe0,0xc1,0x72,0xdb,0x87,0xb1,0x2a,0xdd,0x3f,0x5b,0x15,0x6d,
+0xf4,0xa,0xb6,0x29,0x7f,0xfc,0xe7,0x89,0x1e,0xf6,0xf5,0x89,0x1e,0x7f,0x94,0x8f,
+0x6f,0xf4,0xf8,0x2a,0x1f,0xc2,0xe2,0x87,0x7a,0x8,0x9b,0x87,0x4f,0x1d,0xba,0x62,
+0xbd,0xcb,0x2d,0xd6,0xf9,0x8e,0xe8,0x60,0x45,0x15,0x60,0xcb,0x3a,0x4f,0xcd,0xa3,
+0x98,0xb1,0x7b,0x7e,0xa2,0x87,0xc6,0x5,0xde,0xbb,0x7e,0x75,0x4e,0xec,0x4e,0x6d,
+0x18,0xcc,0x4a,0x7a,0x1,0xbf,0x6a,0xd5,0x4c,0x32,0x6b,0xc8,0xdc,0x97,0x30,0x55,
+0xb1,0xfd,0x5d,0x3d,0xd4,0xa2,0x93,0xa4,0x7a,0x94,0x90,0xaa,0x64,0xdc,0x92,0x4d,
+0x1a,0x1d,0x6e,0xbf,0x7a,0x7,0xfa,0x7c,0x58,0x2e,0x35,0xf,0xf4,0xe8,0x51,0xa9,
+0x1a,0x5a,0x61,0xbf,0xca,0x75,0xc4,0x3b,0x82,0xe8,0x64,0xd2,0xa3,0xc8,0x68,0x29,
+0xb7,0x6f,0x61,0xc6,0x1e,0x8,0x73,0xc0,0xf6,0x80,0xaf,0x6a,0xc3,0x64,0x59,0xd7,
+0xb8,0xd,0x3b,0xfa,0x91,0x1e,0xea,0x5b,0x3e,0x70,0x84,0xa,0x90,0x3f,0xc6,0x7,
+0x3d,0xe,0xf9,0x28,0xc0,0x72,0x3,0x26,0x55,0x1a,0x2,0x7e,0x4b,0xa3,0x73,0xac,
+0x0,0xba,0xc7,0x1f,0xe5,0xe3,0xbf,0xfb,0x4a,0x16,0xa7,0xbe,0x75,0xa3,0xd2,0xed,
+0xf5,0x2a,0xdd,0x83,0x81,0x3d,0xe9,0x2b,0xd,0x15,0x50,0x56,0x8a,0x73,0xf8,0xea,
+0x24,0x1f,0x7,0xb0,0x34,0x4,0x8c,0xd9,0x1f,0xf7,0x55,0x2b,0xf5,0xd5,0x9f,0x60,
+0x3,0x1d,0x52,0xb1,0x30,0xaf,0xcb,0x54,0xf,0xbb,0x73,0xd0,0x3,0x2a,0x76,0x64,
+0xac,0x78,0x4d,0xfb,0xa,0xbe,0x82,0x8a,0x6d,0xf8,0xca,0x7e,0xff,0x4d,0x5f,0x1d,
+0x2b,0x80,0x82,0xe5,0xbf,0xea,0xab,0x77,0xdf,0xd7,0x43,0x29,0xec,0x49,0x4e,0x15,
+0x9d,0x64,0x2,0xad,0x77,0x6b,0x6a,0x1e,0xdf,0x68,0xfd,0x62,0x6,0x6f,0x60,0x21,
+0x55,0xd,0xe6,0xa1,0x7b,0x3c,0x31,0x3d,0x6c,0xe8,0xc1,0xfa,0x6a,0xea,0x53,0xf3,
+0x1c,0xf5,0x48,0x7d,0xc5,0x6d,0xc8,0x38,0xb5,0xdc,0x9f,0xa5,0xbf,0xfd,0x8b,0x18,
+0x3,0x4c,0xfb,0x87,0x5b,0xfe,0xab,0x54,0x8,0x9e,0xd0,0x8f,0xc5,0xe1,0x3e,0x34,
+0x2a,0xa,0x4,0x5b,0x41,0x26,0xd8,0x87,0xe4,0x3a,0x32,0xbf,0x78,0x5a,0x96,0x7b,
+0xd2,0xd9,0xee,0x1,0x45,0x21,0xe2,0xb,0x84,0x4b,0x30,0xe3,0x95,0xd1,0xc0,0x17,
+0x2f,0xde,0xb8,0xa3,0x71,0xe,0x59,0x95,0x3b,0x32,0x87,0xf,0x4b,0xba,0x94,0x9,
+0x88,0x7d,0xdd,0x17,0x86,0x21,0x99,0x34,0xbb,0xd5,0x69,0xe2,0x19,0x1d,0xad,0xe0,
+0x24,0x5e,0xae,0x27,0x9e,0x6d,0x22,0xb7,0x2c,0xd7,0x20,0xf,0xec,0x2f,0xf,0x3,
+0x32,0xa9,0x74,0xab,0x66,0x48,0xb0,0x6f,0xd1,0x9,0xe9,0xb0,0xc2,0x9c,0xd,0xe3,
+0xb6,0xf,0x68,0x57,0x69,0x14,0xf8,0x18,0x26,0x99,0xc9,0xa,0xbc,0xa1,0x27,0x56,
+0xf9,0xb6,0x8a,0x0,0x79,0xe5,0x9e,0x7c,0xb1,0xf0,0xc1,0x95,0xc8,0xed,0x7c,0xf0,
+0x24,0xdf,0x6,0xc4,0xba,0xec,0x56,0x6f,0xe9,0x30,0x59,0x70,0x9e,0xdc,0xbc,0xaa,
+0x5d,0xcc,0xa3,0x65,0x56,0x95,0xf1,0x85,0x5b,0xef,0xb,0xa3,0x60,0x4d,0x71,0xdf,
+0x26,0xe1,0xb8,0xa1,0xa0,0x8d,0xbc,0x7c,0x47,0x81,0xcf,0xd0,0x75,0x22,0xac,0xd,
+0xd3,0x89,0x99,0x7d,0x68,0x63,0xd8,0x6d,0xbc,0xb2,0x2e,0x15,0x74,0x21,0xc3,0x7d,
+0x47,0x56,0x14,0x15,0xdd,0xc,0xa8,0x2,0x82,0xd2,0x12,0x32,0x21,0xb1,0x2f,0xaf,
+0x84,0xdb,0xc8,0xb3,0x3a,0x5a,0xf5,0x2e,0x59,0xe5,0x5a,0xa,0x5e,0x2d,0x2f,0x2b,
+0x2b,0x99,0xc7,0x90,0xe2,0xce,0xc4,0xe1,0xe4,0x5a,0x13,0x86,0xc,0xb7,0x30,0x7d,
+0x76,0xc7,0xad,0x2b,0x3c,0x43,0x6e,0x4e,0x57,0xb9,0xc5,0xeb,0x30,0xab,0xae,0x31,
+0x92,0x1a,0x5d,0xca,0xf7,0xb8,0xa9,0x20,0x52,0x5e,0x4e,0x55,0xb8,0xb9,0x3f,0x2b,
+0xab,0x2a,0xb7,0x8b,0xd8,0x55,0xe1,0x7a,0x42,0xf9,0x4e,0x42,0xa6,0x48,0xb4,0xca,
+0xb5,0x55,0x7a,0x55,0xb9,0xc7,0x70,0xd7,0x35,0x89,0x8b,0x9,0xba,0x0,0xd2,0x7b,
+0x56,0xf3,0xa,0x2f,0x31,0x70,0x2b,0x5,0xe7,0x79,0x9,0xdc,0xf8,0x62,0x96,0xd5,
+0x5,0x6e,0xf7,0x0,0xb,0x4a,0xc3,0xd0,0x37,0x1a,0xa0,0x80,0xac,0xe9,0x55,0x73,
+0x5c,0xd5,0x51,0x81,0xdb,0xcd,0xea,0x22,0x14,0xb1,0x4b,0xfd,0xd6,0x70,0x4f,0xac,
+0x4a,0xbf,0x6a,0x6,0xc4,0xa0,0x7c,0x27,0x6e,0xbe,0xcd,0xc4,0xcd,0xe2,0xaa,0x6d,
+0xe4,0x52,0x45,0xbe,0x30,0x92,0xcc,0x98,0x7c,0x2,0x49,0x66,0xb4,0x82,0x74,0x8,
+0x35,0x23,0x69,0xfb,0xbc,0xcc,0xea,0x12,0x86,0xb9,0xf8,0x62,0x14,0xfa,0x56,0x43,
+0x2b,0x9a,0x1,0x75,0x12,0xf,0x9f,0x50,0x27,0x6d,0x9e,0x76,0x59,0x5d,0xcd,0x6c,
+0xa2,0x65,0x49,0x96,0xa9,0x4f,0x2a,0x5d,0xe1,0x36,0x24,0x56,0x5b,0xa7,0x3e,0xc9,
+0x7f,0x60,0xe2,0x66,0x7b,0x62,0x61,0x1b,0xd9,0xf0,0xc9,0x8,0xa8,0x28,0xee,0x98,
+0x89,0x3b,0x8d,0x3d,0xa3,0x75,0xc5,0x3b,0x90,0x4e,0x17,0xcf,0x28,0x49,0x3d,0xe9,
+0x2,0x9b,0xd5,0x29,0x49,0x74,0x98,0x0,0xa,0x8c,0xb6,0x4c,0x49,0x1a,0x3,0x15,
+0x9c,0x94,0x83,0xfc,0x5b,0x7f,0x56,0x52,0xe9,0x30,0xab,0xae,0x88,0x48,0xac,0xd5,
+0x4,0xdf,0x64,0xd,0xbe,0xe9,0xb0,0x5c,0xf,0xb8,0xc1,0x26,0x68,0xc4,0x66,0x75,
+0x36,0xc,0x9,0x28,0x9a,0xb1,0x37,0x6e,0x5e,0x55,0xef,0xf0,0x45,0x7,0x8a,0xe0,
+0xb,0x48,0xb7,0xf5,0xbf,0x49,0xc0,0xe5,0x21,0x1,0xb4,0x28,0xa1,0x8,0xc4,0x8d,
+0x10,0x7b,0xf8,0xc4,0x67,0x7c,0x27,0x21,0x9c,0x54,0xbc,0xd,0x57,0x6,0x6c,0xeb,
+0x44,0x2c,0x1,0xb0,0x5c,0x69,0x20,0x71,0xfb,0xc8,0x2a,0xc9,0xe2,0x8,0xa8,0xd2,
+0x4,0x7c,0x2,0x5,0x77,0x9,0x23,0x69,0xfe,0xc4,0xc4,0x5d,0x30,0x71,0x5f,0x13,
+0x0,0xe9,0x70,0xd5,0x34,0x76,0xd,0xfa,0xc5,0xb3,0x8b,0xcd,0xa,0x8b,0x87,0x25,
+0xd,0x13,0x4b,0x80,0x8,0x53,0x5a,0xcd,0x3e,0x4b,0x40,0xeb,0xa,0xe2,0x7a,0x79,
+0x35,0x35,0xa5,0x26,0x9d,0xed,0x21,0xee,0x11,0x37,0xe3,0x5b,0x16,0xa6,0x3e,0x19,
+0xb3,0x61,0xbb,0x2c,0xb2,0xfd,0x18,0xd1,0xe4,0x2,0xb7,0x75,0xae,0x0,0x37,0xa1,
+0x71,0x33,0xa1,0x48,0xfb,0x3b,0x9,0x38,0xef,0xa6,0x9,0xe8,0xb2,0x30,0x5d,0x2a,
+0x55,0x87,0x91,0x44,0x9d,0x94,0x1b,0x48,0x17,0x7b,0x14,0x30,0xe3,0xdb,0x6e,0xf4,
+0xab,0xf0,0x37,0x73,0x52,0x88,0x61,0x7a,0x61,0x9e,0x0,0xb7,0x76,0xb1,0x20,0xb3,
+0x32,0x6a,0x2,0x14,0x9c,0xcb,0xe2,0x30,0x4d,0x2e,0xb2,0xd,0x27,0x9,0x74,0x33,
+0xa0,0xda,0x3e,0xbb,0xd0,0x8c,0xdb,0x93,0x43,0x4d,0x30,0x92,0x20,0x5d,0x9b,0xc6,
+0xcd,0x1b,0xf7,0xd2,0x4,0xa8,0x35,0x96,0x80,0xc1,0x69,0xe3,0xdc,0xc8,0x92,0xf3,
+0x72,0xc,0x93,0xe,0x7f,0xbf,0xd5,0x4,0xbe,0x40,0xe3,0x0,0x15,0x6b,0x9c,0x6e,
+0x61,0x4a,0x56,0xf9,0xd3,0xc6,0x71,0xcf,0xbf,0x11,0x97,0xbf,0x67,0xe2,0xf2,0x9f,
+0x19,0xdf,0x67,0xdb,0xa7,0x94,0xa4,0xc8,0xaa,0x1f,0x71,0x1f,0xf9,0x66,0x61,0x5a,
+0x20,0x23,0x3d,0x16,0xa6,0x7a,0x9a,0x80,0x8a,0x22,0x82,0xef,0x71,0xb3,0x5f,0xa0,
+0x61,0xa2,0x9,0x78,0x76,0xd1,0x49,0xe8,0x75,0xb7,0x84,0x4e,0xda,0x33,0xdc,0xb4,
+0xbc,0x5e,0x9b,0xb2,0xc6,0xdf,0x31,0xdc,0xdc,0x6,0x9,0xd0,0x45,0x24,0x60,0xf9,
+0x9a,0x0,0x45,0x3c,0x49,0x80,0xfa,0xda,0x38,0x17,0xfb,0x10,0xb8,0x69,0xe3,0xd8,
+0x97,0x5f,0x35,0xe,0x36,0xfb,0xfc,0xcc,0xc4,0xc5,0x66,0xb4,0x71,0x76,0x11,0xae,
+0xa2,0x24,0xd9,0xb4,0x26,0x5e,0x20,0xae,0x9c,0xf2,0x5d,0x3,0x6e,0xc,0xc3,0x1b,
+0x10,0x2d,0xcf,0x65,0xca,0x37,0xc4,0xe5,0xc1,0xf7,0x4,0x9b,0x7d,0xb7,0x71,0x42,
+0x1f,0x8d,0x53,0xc4,0x43,0x76,0x7c,0x3,0x8e,0x24,0x3d,0x12,0xb7,0xdc,0x17,0xa8,
+0xbf,0x2b,0x2a,0x25,0x89,0x36,0x8e,0x19,0xbd,0xbd,0x1,0x27,0x8d,0x3,0x71,0xd3,
+0x4,0x80,0x24,0x6c,0xd6,0xbc,0xe2,0x69,0x79,0x61,0xb3,0x79,0x34,0xc3,0x3f,0x14,
+0x1a,0x26,0xca,0x77,0x7c,0xd2,0x38,0x78,0xba,0xe,0x8d,0x43,0xb2,0xa9,0x29,0x8f,
+0x8d,0x23,0xfe,0x14,0x20,0x6e,0xb4,0xe1,0xd3,0xc6,0x49,0x49,0x9a,0xfb,0xab,0xac,
+0x2a,0x72,0x8f,0x21,0xb,0x53,0x9c,0x18,0xb0,0x1c,0x1b,0x96,0xf2,0xdd,0x3b,0x3c,
+0x27,0xb4,0x71,0x68,0xbd,0x65,0xf6,0x48,0x0,0x1d,0x16,0x2,0x37,0x8f,0x77,0x27,
+0xdf,0xd4,0xa0,0x88,0x3b,0x56,0xf1,0xc,0x3e,0xd0,0x9a,0x60,0x24,0xd,0x5a,0xc3,
+0x20,0x9c,0xa0,0x29,0x69,0xb6,0xd3,0x5a,0x3e,0x69,0x9c,0xc7,0x84,0xfa,0x4,0x4d,
+0xb9,0x3c,0x3c,0x27,0xb8,0xe3,0x1e,0x51,0x69,0xc1,0x94,0xc7,0x5a,0x2e,0x23,0x23,
+0xfb,0xc4,0x3a,0xd7,0x59,0x98,0x0,0x7,0x71,0x33,0xa8,0xbf,0x9,0x7d,0x6,0xcf,
+0x52,0x53,0x16,0x7e,0xf0,0xe6,0xe6,0xbf,0x7a,0x73,0x7f,0xa2,0x6f,0xee,0x7f,0x0,
+0x50,0x80,0xf8,0xf4,
+};
+
+static const Sound_Data Sound_dingdong = {
+    .Blob = Sound_dingdongBlob,
+    .BlobSize = sizeof(Sound_dingdongBlob),
+    .RamSize = 3600,
+    .Version = 0xDD393AF7, //CRC-32 of the blob
+    .Rate = 8000,
+    .Format = 2, //ADPCM
+};
+
+const Sound_Data *const Sound_tones[6] = {
+    &Sound_chime,
+    &Sound_bell,
+    &Sound_pulse,
+    &Sound_rise,
+    &Sound_trill,
+    &Sound_dingdong,
+};
+
+const uint8_t Sound_nTones = 6;
+
+_Static_assert(6 <= SOUND_MAX_TONES, "too many tones for sound.c");
@@ -0,0 +1,196 @@
+#include <errno.h>
+#include <string.h>
+
+#include "store.h"
+#include "EVE.h"
+
+#define STORE_DIR_WORDS     (sizeof(Store_Dir) / sizeof(uint32_t))
+#define STORE_SECTORS(Size) (((Size) + EVE_FLASH_SECTOR - 1) & ~(EVE_FLASH_SECTOR - 1UL))
+
+typedef struct Store_Control
+{
+    Store_Dir Dir; //copy of the flash directory
+    uint32_t NextFree; //flash address for the next new asset
+    bool Ready; //flash is attached and in full mode
+    bool Dirty; //directory needs writing back
+
+} Store_Control;
+
+static Store_Control Store_Ctrl;
+
+static uint32_t Store_check(Store_Dir *Dir);
+static Store_Entry *Store_find(uint32_t Id);
+
+/*
+ * Read the directory from the EVE flash. An empty or corrupt
+ * directory just means everything gets provisioned again.
+ */
+int Store_open(void)
+{
+    uint32_t *Words = (uint32_t *) &Store_Ctrl.Dir;
+    uint32_t End;
+    uint8_t i;
+
+    memset(&Store_Ctrl, 0, sizeof(Store_Ctrl));
+    Store_Ctrl.NextFree = STORE_DATA_ADDR;
+
+    if (EVE_read8(REG_FLASH_STATUS + RAM_REG) != FLASH_STATUS_FULL)
+    {
+        return -ENODEV;
+    }
+    Store_Ctrl.Ready = true;
+
+    EVE_cmdFlashRead(STORE_SCRATCH, STORE_DIR_ADDR, sizeof(Store_Dir));
+    for (i = 0; i < STORE_DIR_WORDS; ++i)
+    {
+        Words[i] = EVE_read32(STORE_SCRATCH + 4*i);
+    }
+
+    if (Store_Ctrl.Dir.Magic != STORE_MAGIC || Store_Ctrl.Dir.nEntries > STORE_MAX_ENTRIES
+            || Store_Ctrl.Dir.Check != Store_check(&Store_Ctrl.Dir))
+    {
+        memset(&Store_Ctrl.Dir, 0, sizeof(Store_Dir));
+        Store_Ctrl.Dir.Magic = STORE_MAGIC;
+        return -ENOENT;
+    }
+
+    for (i = 0; i < Store_Ctrl.Dir.nEntries; ++i)
+    {
+        End = Store_Ctrl.Dir.Entries[i].FlashAddr + STORE_SECTORS(Store_Ctrl.Dir.Entries[i].Size);
+        if (End > Store_Ctrl.NextFree)
+        {
+            Store_Ctrl.NextFree = End;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Copy an asset from flash to RAM_G if the stored copy is the
+ * same version and was saved from the same RAM_G address
+ */
+bool Store_fetch(uint32_t Id, uint32_t Version, uint32_t RamAddr, uint32_t Size)
+{
+    Store_Entry *Entry = Store_find(Id);
+
+    if (!Store_Ctrl.Ready || Entry == NULL || Entry->Version != Version
+            || Entry->RamAddr != RamAddr || Entry->Size != Size)
+    {
+        return false;
+    }
+
+    EVE_cmdFlashRead(RAM_G + RamAddr, Entry->FlashAddr, (Size + 3) & ~3UL);
+    return true;
+}
+
+/*
+ * Write an asset that is already in RAM_G to flash. The
+ * directory is only updated in flash by Store_commit.
+ */
+int Store_save(uint32_t Id, uint32_t Version, uint32_t RamAddr, uint32_t Size)
+{
+    int Res = 0;
+    Store_Entry *Entry;
+    uint32_t FlashSize;
+
+    if (!Store_Ctrl.Ready)
+    {
+        Res = -ENODEV;
+        goto Error;
+    }
+
+    //FLASHUPDATE copies whole sectors, so the source must not run off RAM_G
+    if (RamAddr + STORE_SECTORS(Size) > RAM_G_WORKING)
+    {
+        Res = -EINVAL;
+        goto Error;
+    }
+
+    Entry = Store_find(Id);
+    if (Entry == NULL)
+    {
+        if (Store_Ctrl.Dir.nEntries >= STORE_MAX_ENTRIES)
+        {
+            Res = -ENOSPC;
+            goto Error;
+        }
+        Entry = &Store_Ctrl.Dir.Entries[Store_Ctrl.Dir.nEntries++];
+        Entry->Id = Id;
+        Entry->FlashAddr = 0;
+    }
+
+    //reuse the old sectors if the new version still fits
+    if (Entry->FlashAddr == 0 || STORE_SECTORS(Size) > STORE_SECTORS(Entry->Size))
+    {
+        FlashSize = (uint32_t) EVE_read16(REG_FLASH_SIZE + RAM_REG) << 20;
+        if (Store_Ctrl.NextFree + STORE_SECTORS(Size) > FlashSize)
+        {
+            Entry->Version = 0;
+            Res = -ENOSPC;
+            goto Error;
+        }
+        Entry->FlashAddr = Store_Ctrl.NextFree;
+        Store_Ctrl.NextFree += STORE_SECTORS(Size);
+    }
+
+    EVE_cmdFlashUpdate(Entry->FlashAddr, RAM_G + RamAddr, STORE_SECTORS(Size));
+    Entry->Version = Version;
+    Entry->RamAddr = RamAddr;
+    Entry->Size = Size;
+    Store_Ctrl.Dirty = true;
+
+Error:
+    return Res;
+}
+
+/*
+ * Write the directory back if any asset was saved. It goes last,
+ * so a reset during provisioning only costs another upload.
+ */
+int Store_commit(void)
+{
+    uint32_t *Words = (uint32_t *) &Store_Ctrl.Dir;
+    uint8_t i;
+
+    if (!Store_Ctrl.Ready || !Store_Ctrl.Dirty)
+    {
+        return 0;
+    }
+
+    Store_Ctrl.Dir.Check = Store_check(&Store_Ctrl.Dir);
+    for (i = 0; i < STORE_DIR_WORDS; ++i)
+    {
+        EVE_write32(STORE_SCRATCH + 4*i, Words[i]);
+    }
+    EVE_cmdFlashUpdate(STORE_DIR_ADDR, STORE_SCRATCH, EVE_FLASH_SECTOR);
+    Store_Ctrl.Dirty = false;
+
+    return 0;
+}
+
+static uint32_t Store_check(Store_Dir *Dir)
+{
+    uint32_t *Words = (uint32_t *) Dir;
+    uint32_t Check = 0;
+    uint8_t i;
+
+    for (i = 0; i < STORE_DIR_WORDS - 1; ++i)
+    {
+        Check ^= Words[i];
+    }
+    return Check;
+}
+
+static Store_Entry *Store_find(uint32_t Id)
+{
+    uint8_t i;
+
+    for (i = 0; i < Store_Ctrl.Dir.nEntries; ++i)
+    {
+        if (Store_Ctrl.Dir.Entries[i].Id == Id)
+        {
+            return &Store_Ctrl.Dir.Entries[i];
+        }
+    }
+    return NULL;
+}
@@ -0,0 +1,50 @@
+/************************************************************
+ * store.h
+ *
+ * Asset store on the flash attached to the EVE3. Inflated
+ * RAM_G images (fonts, bitmaps) are written to the flash the
+ * first time they are uploaded, and on later boots copied
+ * back with CMD_FLASHREAD, so nothing crosses the MCU SPI
+ * bus. A directory sector after the flash driver blob maps
+ * asset IDs to their version, flash and RAM_G location; an
+ * asset is provisioned again whenever its version changes.
+ *
+ ************************************************************/
+
+#ifndef STORE_H
+#define STORE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define STORE_MAGIC         0x534D4F41 //"SMOA"
+#define STORE_MAX_ENTRIES   8
+#define STORE_DIR_ADDR      EVE_FLASH_BLOB_SIZE //flash address of the directory sector
+#define STORE_DATA_ADDR     (STORE_DIR_ADDR + EVE_FLASH_SECTOR) //first asset sector
+#define STORE_SCRATCH       RAM_G_WORKING //4K of RAM_G for the directory
+
+typedef struct Store_Entry
+{
+    uint32_t Id;
+    uint32_t Version;
+    uint32_t FlashAddr; //sector aligned
+    uint32_t RamAddr; //where the image was when it was saved
+    uint32_t Size; //bytes
+
+} Store_Entry;
+
+typedef struct Store_Dir
+{
+    uint32_t Magic;
+    uint32_t nEntries;
+    Store_Entry Entries[STORE_MAX_ENTRIES];
+    uint32_t Check; //xor of all words before it
+
+} Store_Dir;
+
+int Store_open(void);
+bool Store_fetch(uint32_t Id, uint32_t Version, uint32_t RamAddr, uint32_t Size);
+int Store_save(uint32_t Id, uint32_t Version, uint32_t RamAddr, uint32_t Size);
+int Store_commit(void);
+
+#endif
@@ -0,0 +1,381 @@
+#include <string.h>
+
+#include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+#include <ti/sysbios/hal/Hwi.h>
+
+#include "timer_wheel.h"
+#include "load.h"
+#include "uart_term.h"
+
+#define TIMERWHEEL_BASE     TIMER_A3_BASE
+#define TIMERWHEEL_MASK     (TIMERWHEEL_SLOTS - 1)
+
+typedef struct TimerWheel_Control
+{
+    TimerWheel_Timer *Slots[TIMERWHEEL_LEVELS][TIMERWHEEL_SLOTS];
+    uint64_t Occupied[TIMERWHEEL_LEVELS]; //bit set for each non-empty slot
+    uint32_t Now; //tick the wheel has been advanced to
+    volatile uint32_t Overflows; //upper bits of the 16 bit counter
+    bool Servicing; //callbacks are running, don't advance again
+    Hwi_Handle CompareHwi;
+    Hwi_Handle OverflowHwi;
+
+} TimerWheel_Control;
+
+static TimerWheel_Control TimerWheel_Ctrl;
+
+static void TimerWheel_compareIsr(uintptr_t Arg);
+static void TimerWheel_overflowIsr(uintptr_t Arg);
+
+static inline uint32_t TimerWheel_ctz64(uint64_t Bits)
+{
+    uint32_t Lo = (uint32_t) Bits;
+    return Lo != 0 ? __CLZ(__RBIT(Lo)) : 32 + __CLZ(__RBIT((uint32_t) (Bits >> 32)));
+}
+
+static inline uint64_t TimerWheel_ror64(uint64_t Bits, uint32_t n)
+{
+    return n == 0 ? Bits : (Bits >> n) | (Bits << (64 - n));
+}
+
+/*
+ * Extend the 16 bit hardware counter with the overflow count
+ */
+static uint32_t TimerWheel_hwNow(void)
+{
+    uint32_t Hi;
+    uint16_t Lo;
+    UInt Key = Hwi_disable();
+
+    Hi = TimerWheel_Ctrl.Overflows;
+    Lo = MAP_Timer_A_getCounterValue(TIMERWHEEL_BASE);
+    if (MAP_Timer_A_getInterruptStatus(TIMERWHEEL_BASE) == TIMER_A_INTERRUPT_PENDING)
+    {
+        //wrapped but the overflow interrupt hasn't run yet
+        Lo = MAP_Timer_A_getCounterValue(TIMERWHEEL_BASE);
+        Hi++;
+    }
+
+    Hwi_restore(Key);
+    return (Hi << 16) | Lo;
+}
+
+static void TimerWheel_unlink(TimerWheel_Timer *Timer)
+{
+    *Timer->PPrev = Timer->Next;
+    if (Timer->Next != NULL)
+    {
+        Timer->Next->PPrev = Timer->PPrev;
+    }
+    if (TimerWheel_Ctrl.Slots[Timer->Level][Timer->Slot] == NULL)
+    {
+        TimerWheel_Ctrl.Occupied[Timer->Level] &= ~(1ULL << Timer->Slot);
+    }
+    Timer->Next = NULL;
+    Timer->PPrev = NULL;
+}
+
+/*
+ * Put a timer in the slot for its expiry relative to the wheel's time
+ */
+static void TimerWheel_insert(TimerWheel_Timer *Timer)
+{
+    uint32_t Delta = Timer->Expires - TimerWheel_Ctrl.Now;
+    uint32_t Level = 0, Slot;
+    TimerWheel_Timer **Head;
+
+    if ((int32_t) Delta <= 0)
+    {
+        //overdue, fire on the next tick
+        Slot = (TimerWheel_Ctrl.Now + 1) & TIMERWHEEL_MASK;
+    }
+    else
+    {
+        if (Delta >= TIMERWHEEL_SLOTS)
+        {
+            Level = (31 - __CLZ(Delta)) / TIMERWHEEL_SLOT_BITS;
+        }
+        Slot = (Timer->Expires >> (Level*TIMERWHEEL_SLOT_BITS)) & TIMERWHEEL_MASK;
+    }
+
+    Head = &TimerWheel_Ctrl.Slots[Level][Slot];
+    Timer->Level = Level;
+    Timer->Slot = Slot;
+    Timer->Next = *Head;
+    Timer->PPrev = Head;
+    if (*Head != NULL)
+    {
+        (*Head)->PPrev = &Timer->Next;
+    }
+    *Head = Timer;
+    TimerWheel_Ctrl.Occupied[Level] |= 1ULL << Slot;
+}
+
+/*
+ * Ticks from the wheel's time to the next slot that needs work, 0 if none
+ */
+static uint32_t TimerWheel_nextDelta(void)
+{
+    uint32_t Best = 0, Delta, Base, Ahead, Shift, Level;
+
+    for (Level = 0; Level < TIMERWHEEL_LEVELS; Level++)
+    {
+        if (TimerWheel_Ctrl.Occupied[Level] == 0)
+        {
+            continue;
+        }
+
+        //first occupied slot after the current one, then the tick it is reached
+        Shift = Level*TIMERWHEEL_SLOT_BITS;
+        Base = TimerWheel_Ctrl.Now >> Shift;
+        Ahead = TimerWheel_ctz64(TimerWheel_ror64(TimerWheel_Ctrl.Occupied[Level],
+                                                  (Base + 1) & TIMERWHEEL_MASK)) + 1;
+        Delta = ((Base + Ahead) << Shift) - TimerWheel_Ctrl.Now;
+        if (Best == 0 || Delta < Best)
+        {
+            Best = Delta;
+        }
+    }
+
+    return Best;
+}
+
+/*
+ * Take a whole slot off the wheel into a local list that stays
+ * consistent if callbacks stop timers in it
+ */
+static void TimerWheel_detach(uint32_t Level, uint32_t Slot, TimerWheel_Timer **List)
+{
+    *List = TimerWheel_Ctrl.Slots[Level][Slot];
+    TimerWheel_Ctrl.Slots[Level][Slot] = NULL;
+    TimerWheel_Ctrl.Occupied[Level] &= ~(1ULL << Slot);
+    if (*List != NULL)
+    {
+        (*List)->PPrev = List;
+    }
+}
+
+/*
+ * Handle the current tick: move timers down from higher levels whose
+ * slot boundary this is, then fire the level 0 slot
+ */
+static void TimerWheel_processTick(void)
+{
+    uint32_t Level, Shift;
+    TimerWheel_Timer *List, *Timer;
+
+    for (Level = 1; Level < TIMERWHEEL_LEVELS; Level++)
+    {
+        Shift = Level*TIMERWHEEL_SLOT_BITS;
+        if (TimerWheel_Ctrl.Now & ((1UL << Shift) - 1))
+        {
+            break;
+        }
+
+        TimerWheel_detach(Level, (TimerWheel_Ctrl.Now >> Shift) & TIMERWHEEL_MASK, &List);
+        while (List != NULL)
+        {
+            Timer = List;
+            TimerWheel_unlink(Timer);
+            TimerWheel_insert(Timer);
+        }
+    }
+
+    TimerWheel_detach(0, TimerWheel_Ctrl.Now & TIMERWHEEL_MASK, &List);
+    while (List != NULL)
+    {
+        //unlink first so the callback can restart or stop any timer
+        Timer = List;
+        TimerWheel_unlink(Timer);
+        Timer->Active = false;
+        if (Timer->Period != 0)
+        {
+            Timer->Expires += Timer->Period;
+            if ((int32_t) (Timer->Expires - TimerWheel_Ctrl.Now) <= 0)
+            {
+                Timer->Expires = TimerWheel_Ctrl.Now + Timer->Period;
+            }
+            TimerWheel_insert(Timer);
+            Timer->Active = true;
+        }
+        Timer->Callback(Timer->Arg);
+    }
+}
+
+/*
+ * Bring the wheel up to the hardware time, skipping ticks with no work
+ */
+static void TimerWheel_advance(uint32_t Target)
+{
+    uint32_t Delta;
+
+    while ((int32_t) (Target - TimerWheel_Ctrl.Now) > 0)
+    {
+        Delta = TimerWheel_nextDelta();
+        if (Delta == 0 || (int32_t) (TimerWheel_Ctrl.Now + Delta - Target) > 0)
+        {
+            TimerWheel_Ctrl.Now = Target;
+            break;
+        }
+        TimerWheel_Ctrl.Now += Delta;
+        TimerWheel_processTick();
+    }
+}
+
+/*
+ * Arm the compare for the next deadline, or leave only the overflow running
+ */
+static void TimerWheel_program(void)
+{
+    uint32_t Delta = TimerWheel_nextDelta(), Now, Target;
+
+    if (Delta == 0)
+    {
+        MAP_Timer_A_disableCaptureCompareInterrupt(TIMERWHEEL_BASE, TIMER_A_CAPTURECOMPARE_REGISTER_0);
+        return;
+    }
+
+    Delta = Delta > TIMERWHEEL_MAX_SLEEP ? TIMERWHEEL_MAX_SLEEP : Delta;
+    Target = TimerWheel_Ctrl.Now + Delta;
+
+    //the counter keeps running while we get here, never set a compare behind it
+    Now = TimerWheel_hwNow();
+    if ((int32_t) (Target - Now) < 2)
+    {
+        Target = Now + 2;
+    }
+
+    MAP_Timer_A_setCompareValue(TIMERWHEEL_BASE, TIMER_A_CAPTURECOMPARE_REGISTER_0, (uint16_t) Target);
+    MAP_Timer_A_clearCaptureCompareInterrupt(TIMERWHEEL_BASE, TIMER_A_CAPTURECOMPARE_REGISTER_0);
+    MAP_Timer_A_enableCaptureCompareInterrupt(TIMERWHEEL_BASE, TIMER_A_CAPTURECOMPARE_REGISTER_0);
+}
+
+static void TimerWheel_service(void)
+{
+    UInt Key = Hwi_disable();
+
+    if (!TimerWheel_Ctrl.Servicing)
+    {
+        TimerWheel_Ctrl.Servicing = true;
+        TimerWheel_advance(TimerWheel_hwNow());
+        TimerWheel_Ctrl.Servicing = false;
+    }
+    TimerWheel_program();
+
+    Hwi_restore(Key);
+}
+
+static void TimerWheel_compareIsr(uintptr_t Arg)
+{
+    MAP_Timer_A_clearCaptureCompareInterrupt(TIMERWHEEL_BASE, TIMER_A_CAPTURECOMPARE_REGISTER_0);
+    TimerWheel_service();
+}
+
+static void TimerWheel_overflowIsr(uintptr_t Arg)
+{
+    UInt Key = Hwi_disable();
+    MAP_Timer_A_clearInterruptFlag(TIMERWHEEL_BASE);
+    TimerWheel_Ctrl.Overflows++;
+    Hwi_restore(Key);
+
+    //every 64 s, well inside a wrap of the cycle counter
+    Load_overflow();
+    TimerWheel_service();
+}
+
+void TimerWheel_init(void)
+{
+    Hwi_Params HwiParams;
+    const Timer_A_ContinuousModeConfig ContinuousCfg =
+    {
+        TIMER_A_CLOCKSOURCE_ACLK, //32768 Hz
+        TIMER_A_CLOCKSOURCE_DIVIDER_32, //1024 Hz
+        TIMER_A_TAIE_INTERRUPT_ENABLE,
+        TIMER_A_DO_CLEAR
+    };
+    const Timer_A_CompareModeConfig CompareCfg =
+    {
+        TIMER_A_CAPTURECOMPARE_REGISTER_0,
+        TIMER_A_CAPTURECOMPARE_INTERRUPT_DISABLE,
+        TIMER_A_OUTPUTMODE_OUTBITVALUE,
+        0
+    };
+
+    memset(&TimerWheel_Ctrl, 0, sizeof(TimerWheel_Ctrl));
+
+    Hwi_Params_init(&HwiParams);
+    HwiParams.priority = 0x60;
+
+    TimerWheel_Ctrl.CompareHwi = Hwi_create(INT_TA3_0, TimerWheel_compareIsr, &HwiParams, NULL);
+    TimerWheel_Ctrl.OverflowHwi = Hwi_create(INT_TA3_N, TimerWheel_overflowIsr, &HwiParams, NULL);
+    if (TimerWheel_Ctrl.CompareHwi == NULL || TimerWheel_Ctrl.OverflowHwi == NULL)
+    {
+        UART_PRINT("Error creating timer wheel interrupts\r\n");
+        while (1);
+    }
+
+    //ACLK keeps running in LPM3, so deadlines wake the device from sleep
+    MAP_Timer_A_configureContinuousMode(TIMERWHEEL_BASE, &ContinuousCfg);
+    MAP_Timer_A_initCompare(TIMERWHEEL_BASE, &CompareCfg);
+    MAP_Timer_A_startCounter(TIMERWHEEL_BASE, TIMER_A_CONTINUOUS_MODE);
+}
+
+/*
+ * Start or restart a timer, PeriodMs of 0 makes it one-shot
+ */
+void TimerWheel_start(TimerWheel_Timer *Timer, uint32_t DelayMs, uint32_t PeriodMs,
+                      TimerWheel_Callback Callback, void *Arg)
+{
+    uint32_t Delay = TIMERWHEEL_MS_TO_TICKS(DelayMs);
+    UInt Key = Hwi_disable();
+
+    //catch up first so the timer is placed relative to the current tick,
+    //unless this is a callback and the wheel is already being advanced
+    if (!TimerWheel_Ctrl.Servicing)
+    {
+        TimerWheel_Ctrl.Servicing = true;
+        TimerWheel_advance(TimerWheel_hwNow());
+        TimerWheel_Ctrl.Servicing = false;
+    }
+
+    if (Timer->Active)
+    {
+        TimerWheel_unlink(Timer);
+    }
+
+    Delay = Delay == 0 ? 1 : Delay;
+    Delay = Delay > TIMERWHEEL_MAX_TICKS ? TIMERWHEEL_MAX_TICKS : Delay;
+    Timer->Expires = TimerWheel_Ctrl.Now + Delay;
+    Timer->Period = TIMERWHEEL_MS_TO_TICKS(PeriodMs);
+    Timer->Period = Timer->Period > TIMERWHEEL_MAX_TICKS ? TIMERWHEEL_MAX_TICKS : Timer->Period;
+    Timer->Callback = Callback;
+    Timer->Arg = Arg;
+    Timer->Active = true;
+    TimerWheel_insert(Timer);
+
+    TimerWheel_program();
+    Hwi_restore(Key);
+}
+
+void TimerWheel_stop(TimerWheel_Timer *Timer)
+{
+    UInt Key = Hwi_disable();
+
+    if (Timer->Active)
+    {
+        TimerWheel_unlink(Timer);
+        Timer->Active = false;
+    }
+
+    Hwi_restore(Key);
+}
+
+bool TimerWheel_isActive(TimerWheel_Timer *Timer)
+{
+    return Timer->Active;
+}
+
+uint32_t TimerWheel_now(void)
+{
+    return TimerWheel_hwNow();
+}
@@ -0,0 +1,56 @@
+/************************************************************
+ * timer_wheel.h
+ *
+ * Hierarchical timing wheel for software timers, driven by
+ * Timer_A3 on ACLK at 1024 ticks per second. Five levels of
+ * 64 slots cover one tick up to about 12 days, start and
+ * stop are O(1), and the hardware compare is programmed for
+ * the next deadline only, so there is no periodic tick.
+ *
+ * Callbacks run in interrupt context with interrupts
+ * disabled, so they should only post to a thread or toggle
+ * a GPIO. Timer_A3 (Board_TIMER4/Board_CAPTURE2) is owned by
+ * the wheel and must not be opened through the drivers.
+ *
+ ************************************************************/
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TIMERWHEEL_TICKS_PER_SEC    1024
+#define TIMERWHEEL_LEVELS           5
+#define TIMERWHEEL_SLOT_BITS        6
+#define TIMERWHEEL_SLOTS            (1 << TIMERWHEEL_SLOT_BITS)
+#define TIMERWHEEL_MAX_TICKS        ((1UL << (TIMERWHEEL_LEVELS*TIMERWHEEL_SLOT_BITS)) - 1)
+#define TIMERWHEEL_MAX_SLEEP        0x8000 //longest compare, keeps clear of the 16 bit wrap
+
+#define TIMERWHEEL_MS_TO_TICKS(Ms)      ((uint32_t) (((uint64_t) (Ms)*TIMERWHEEL_TICKS_PER_SEC + 999) / 1000))
+#define TIMERWHEEL_TICKS_TO_MS(Ticks)   ((uint32_t) (((uint64_t) (Ticks)*1000) / TIMERWHEEL_TICKS_PER_SEC))
+
+typedef void (*TimerWheel_Callback)(void *Arg);
+
+typedef struct TimerWheel_Timer
+{
+    struct TimerWheel_Timer *Next;
+    struct TimerWheel_Timer **PPrev; //link that points at this timer
+    uint32_t Expires; //absolute tick
+    uint32_t Period; //ticks, 0 for one-shot
+    TimerWheel_Callback Callback;
+    void *Arg;
+    uint8_t Level;
+    uint8_t Slot;
+    bool Active;
+
+} TimerWheel_Timer;
+
+void TimerWheel_init(void);
+void TimerWheel_start(TimerWheel_Timer *Timer, uint32_t DelayMs, uint32_t PeriodMs,
+                      TimerWheel_Callback Callback, void *Arg);
+void TimerWheel_stop(TimerWheel_Timer *Timer);
+bool TimerWheel_isActive(TimerWheel_Timer *Timer);
+uint32_t TimerWheel_now(void); //ticks since init, safe from interrupts
+
+#endif
@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+"""
+benchcmp.py
+
+Compares two results files written by smo_bench --json, such as the
+last commit's and this one's, and prints the change in time per
+operation of every benchmark they share. Exits with 1 if any benchmark
+got slower by more than --threshold percent, so CI can flag the commit.
+
+The fastest sample is compared by default, as it is the least disturbed
+by other work on the machine; --median compares the medians instead.
+
+Usage:
+    tools/benchcmp.py base.json build/bench.json
+    tools/benchcmp.py base.json build/bench.json --threshold 5 --median
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        doc = json.load(f)
+    return doc, {b['name']: b for b in doc['benchmarks']}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare two smo_bench --json results')
+    parser.add_argument('base')
+    parser.add_argument('new')
+    parser.add_argument('--threshold', type=float, default=10.0, help='percent slower that fails (10)')
+    parser.add_argument('--median', action='store_true', help='compare medians, not the fastest samples')
+    args = parser.parse_args()
+
+    base_doc, base = load(args.base)
+    new_doc, new = load(args.new)
+    key = 'ns_per_op' if args.median else 'min_ns'
+
+    for doc, path in ((base_doc, args.base), (new_doc, args.new)):
+        print('%s: %s %s' % (path, doc.get('label') or '-', doc.get('build', '')))
+    if base_doc.get('build') != new_doc.get('build'):
+        print('warning: the builds differ, times may not be comparable')
+
+    print('%-24s %12s %12s %9s' % ('benchmark', 'base ns', 'new ns', 'change'))
+    slower = []
+    for name in new:
+        if name not in base:
+            print('%-24s %12s %12.1f %9s' % (name, '-', new[name][key], 'new'))
+            continue
+        old_ns = base[name][key]
+        new_ns = new[name][key]
+        change = (new_ns - old_ns)/old_ns*100 if old_ns > 0 else 0.0
+        flag = ''
+        if change > args.threshold:
+            flag = ' slower'
+            slower.append(name)
+        print('%-24s %12.1f %12.1f %+8.1f%%%s' % (name, old_ns, new_ns, change, flag))
+    for name in base:
+        if name not in new:
+            print('%-24s %12.1f %12s %9s' % (name, base[name][key], '-', 'gone'))
+
+    if slower:
+        print('%d benchmark(s) slower by more than %.0f%%: %s' % (len(slower), args.threshold, ', '.join(slower)))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
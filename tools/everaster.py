@@ -0,0 +1,554 @@
+#!/usr/bin/env python3
+"""
+everaster.py
+
+Replays the SPI traffic EVE3.c sends to the screen and rasterises every
+frame it swaps in to an 800x480 PNG, so screens can be looked at and
+compared without the EVE3-50A. For each frame it also reports what the
+frame cost: SPI bytes sent, words written to the coprocessor FIFO, and the
+display list entries the frame needs out of the 2048 that fit in RAM_DL.
+
+The capture is every SPI transaction in order, each as a little-endian
+16-bit length followed by the bytes sent to the EVE. Memory writes update
+an emulated RAM_G and RAM_DL, writes to REG_CMDB_WRITE are
+run through a small coprocessor model (inflate, fonts, bitmaps, append,
+flash and the widgets the firmware uses), and a frame is drawn on CMD_SWAP
+or a write to REG_DLSWAP.
+
+Rendering is close enough to review layout, colours, bitmaps and the
+custom font, but it is not pixel identical to the BT815. ROM fonts are
+drawn with a scaled 5x7 font at the ROM font's height, widgets are flat,
+anti-aliasing is not modelled, and widget display list costs are estimates.
+CMD_LOADIMAGE is not supported (images go through tools/mkasset.py and
+CMD_INFLATE instead), and flash starts erased, so
+a capture of a boot that reads the font from flash needs an earlier
+capture of the boot that wrote it (pass both, in order).
+
+Usage:
+    tools/everaster.py boot.spi -o frames/
+    tools/everaster.py first.spi warm.spi --spi-hz 1000000 -o frames/
+"""
+
+import argparse
+import math
+import os
+import struct
+import sys
+import zlib
+
+WIDTH, HEIGHT = 800, 480
+
+RAM_G_SIZE = 0x100000
+RAM_DL, RAM_DL_SIZE = 0x300000, 0x2000
+RAM_REG = 0x302000
+REG_DLSWAP = RAM_REG + 0x54
+REG_CMDB_WRITE = RAM_REG + 0x578
+FLASH_SIZE = 0x800000
+DL_ENTRIES = RAM_DL_SIZE // 4
+
+#coprocessor commands and the number of parameter words before any string or stream
+COMMANDS = {
+    0xFFFFFF00: ('DLSTART', 0), 0xFFFFFF01: ('SWAP', 0), 0xFFFFFF09: ('BGCOLOR', 1),
+    0xFFFFFF0A: ('FGCOLOR', 1), 0xFFFFFF0B: ('GRADIENT', 4), 0xFFFFFF0C: ('TEXT', 2),
+    0xFFFFFF0D: ('BUTTON', 3), 0xFFFFFF0F: ('PROGRESS', 4), 0xFFFFFF10: ('SLIDER', 4),
+    0xFFFFFF11: ('SCROLLBAR', 4), 0xFFFFFF12: ('TOGGLE', 3), 0xFFFFFF16: ('SPINNER', 2),
+    0xFFFFFF17: ('STOP', 0), 0xFFFFFF19: ('REGREAD', 2), 0xFFFFFF1A: ('MEMWRITE', 2),
+    0xFFFFFF1B: ('MEMSET', 3), 0xFFFFFF1C: ('MEMZERO', 2), 0xFFFFFF1D: ('MEMCPY', 3),
+    0xFFFFFF1E: ('APPEND', 2), 0xFFFFFF22: ('INFLATE', 1), 0xFFFFFF23: ('GETPTR', 1),
+    0xFFFFFF24: ('LOADIMAGE', 2), 0xFFFFFF26: ('LOADIDENTITY', 0), 0xFFFFFF2A: ('SETMATRIX', 0),
+    0xFFFFFF2B: ('SETFONT', 2), 0xFFFFFF2E: ('NUMBER', 3), 0xFFFFFF34: ('GRADCOLOR', 1),
+    0xFFFFFF36: ('SETROTATE', 1), 0xFFFFFF3B: ('SETFONT2', 3), 0xFFFFFF3F: ('ROMFONT', 2),
+    0xFFFFFF42: ('SYNC', 0), 0xFFFFFF43: ('SETBITMAP', 3), 0xFFFFFF44: ('FLASHERASE', 0),
+    0xFFFFFF45: ('FLASHWRITE', 2), 0xFFFFFF46: ('FLASHREAD', 3), 0xFFFFFF47: ('FLASHUPDATE', 3),
+    0xFFFFFF48: ('FLASHDETACH', 0), 0xFFFFFF49: ('FLASHATTACH', 0), 0xFFFFFF4A: ('FLASHFAST', 1),
+    0xFFFFFF4F: ('CLEARCACHE', 0), 0xFFFFFF52: ('RESETFONTS', 0), 0xFFFFFF58: ('FILLWIDTH', 1),
+}
+STRING_COMMANDS = {'TEXT', 'BUTTON', 'TOGGLE'}
+
+#display list entries the coprocessor writes for a widget, beyond one per character
+WIDGET_COST = {'text': 4, 'button': 14, 'progress': 16, 'spinner': 40}
+
+OPT_CENTERX, OPT_CENTERY, OPT_RIGHTX, OPT_FILL = 0x200, 0x400, 0x800, 0x2000
+
+#ROM font handles 16-34, line height in pixels
+ROM_HEIGHTS = {16: 8, 17: 8, 18: 16, 19: 16, 20: 13, 21: 17, 22: 20, 23: 22, 24: 29, 25: 38,
+               26: 16, 27: 20, 28: 25, 29: 28, 30: 36, 31: 49, 32: 63, 33: 83, 34: 108}
+
+#5x7 glyphs for ' ' to '~', one byte per column with the top row in bit 0
+GLYPHS = bytes.fromhex(
+    '0000000000' '00005f0000' '0007000700' '147f147f14' '242a7f2a12' '2313086462' '3649562050'
+    '0005030000' '001c224100' '0041221c00' '2a1c7f1c2a' '08083e0808' '0050300000' '0808080808'
+    '0060600000' '2010080402' '3e5149453e' '00427f4000' '4261514946' '2141454b31' '1814127f10'
+    '2745454539' '3c4a494930' '0171090503' '3649494936' '064949291e' '0036360000' '0056360000'
+    '0814224100' '1414141414' '0041221408' '0201510906' '3249794132' '7e1111117e' '7f49494936'
+    '3e41414122' '7f4141221c' '7f49494941' '7f09090901' '3e4149497a' '7f0808087f' '00417f4100'
+    '2040413f01' '7f08142241' '7f40404040' '7f020c027f' '7f0408107f' '3e4141413e' '7f09090906'
+    '3e4151215e' '7f09192946' '4649494931' '01017f0101' '3f4040403f' '1f2040201f' '3f4038403f'
+    '6314081463' '0708700807' '6151494543' '007f414100' '0204081020' '0041417f00' '0402010204'
+    '4040404040' '0001020400' '2054545478' '7f48444438' '3844444420' '384444487f' '3854545418'
+    '087e090102' '0c5252523e' '7f08040478' '00447d4000' '2040443d00' '7f10284400' '00417f4000'
+    '7c04180478' '7c08040478' '3844444438' '7c14141408' '081414187c' '7c08040408' '4854545420'
+    '043f444020' '3c4040207c' '1c2040201c' '3c4030403c' '4428102844' '0c5050503c' '4464544c44'
+    '0008364100' '00007f0000' '0041360800' '1008081008')
+
+
+def sext(value, bits):
+    return value - (1 << bits) if value & (1 << (bits - 1)) else value
+
+
+def writePng(path, pixels):
+    rows = b''.join(b'\x00' + pixels[y * WIDTH * 3:(y + 1) * WIDTH * 3] for y in range(HEIGHT))
+
+    def chunk(kind, data):
+        return struct.pack('>I', len(data)) + kind + data + struct.pack('>I', zlib.crc32(kind + data))
+    with open(path, 'wb') as f:
+        f.write(b'\x89PNG\r\n\x1a\n')
+        f.write(chunk(b'IHDR', struct.pack('>IIBBBBB', WIDTH, HEIGHT, 8, 2, 0, 0, 0)))
+        f.write(chunk(b'IDAT', zlib.compress(rows, 6)))
+        f.write(chunk(b'IEND', b''))
+
+
+class Raster:
+    """800x480 RGB frame buffer with the primitives a display list needs"""
+
+    def __init__(self):
+        self.pixels = bytearray(WIDTH * HEIGHT * 3)
+
+    def clear(self, color):
+        self.pixels[:] = bytes(color) * (WIDTH * HEIGHT)
+
+    def span(self, y, x0, x1, color):
+        y, x0, x1 = int(y), max(0, int(math.ceil(x0))), min(WIDTH - 1, int(math.floor(x1)))
+        if 0 <= y < HEIGHT and x0 <= x1:
+            start = (y * WIDTH + x0) * 3
+            self.pixels[start:start + (x1 - x0 + 1) * 3] = bytes(color) * (x1 - x0 + 1)
+
+    def blend(self, x, y, color, alpha):
+        if 0 <= x < WIDTH and 0 <= y < HEIGHT and alpha > 0:
+            i = (y * WIDTH + x) * 3
+            for c in range(3):
+                self.pixels[i + c] = (color[c] * alpha + self.pixels[i + c] * (255 - alpha)) // 255
+
+    def roundRect(self, x0, y0, x1, y1, radius, color):
+        #a rectangle grown by radius with round corners, as RECTS and POINTS draw
+        x0, x1 = min(x0, x1), max(x0, x1)
+        y0, y1 = min(y0, y1), max(y0, y1)
+        for y in range(int(math.floor(y0 - radius)), int(math.ceil(y1 + radius)) + 1):
+            dy = max(y0 - y, 0, y - y1)
+            if dy <= radius:
+                half = math.sqrt(radius * radius - dy * dy)
+                self.span(y, x0 - half, x1 + half, color)
+
+    def line(self, x0, y0, x1, y1, radius, color):
+        dx, dy = x1 - x0, y1 - y0
+        length = dx * dx + dy * dy
+        for y in range(int(min(y0, y1) - radius), int(max(y0, y1) + radius) + 1):
+            for x in range(int(min(x0, x1) - radius), int(max(x0, x1) + radius) + 1):
+                t = 0 if length == 0 else max(0, min(1, ((x - x0) * dx + (y - y0) * dy) / length))
+                if math.hypot(x - x0 - t * dx, y - y0 - t * dy) <= radius:
+                    self.blend(x, y, color, 255)
+
+    def glyph(self, ch, x, y, height, color):
+        #the 5x7 glyph scaled so its cap height is about 70% of the line
+        code = ord(ch) - 0x20 if 0x20 <= ord(ch) < 0x7F else ord('?') - 0x20
+        scale = max(1.0, height / 10.0)
+        top = y + (height - 7 * scale) / 2
+        for col in range(5):
+            bits = GLYPHS[code * 5 + col]
+            for row in range(7):
+                if bits & (1 << row):
+                    x0, x1 = int(round(x + col * scale)), int(round(x + (col + 1) * scale))
+                    for yy in range(int(round(top + row * scale)), int(round(top + (row + 1) * scale))):
+                        self.span(yy, x0, x1 - 1, color)
+        return int(round(6 * scale))
+
+
+class Eve:
+    """Memory, coprocessor and display list state of one BT815"""
+
+    def __init__(self, raster, outDir, spiHz):
+        self.raster, self.outDir, self.spiHz = raster, outDir, spiHz
+        self.ram = bytearray(RAM_G_SIZE)
+        self.dlRam = bytearray(RAM_DL_SIZE)
+        self.flash = bytearray(b'\xff') * FLASH_SIZE
+        self.fifo = bytearray()
+        self.stream = None #(kind, dest, decompressor, bytes consumed) while data follows a command
+        self.dl = [] #display list being built by the coprocessor
+        self.romSlots = {}
+        self.fgColor, self.bgColor, self.fillWidth = (0, 56, 112), (0, 32, 64), 0
+        self.frames = 0
+        self.resetCost()
+
+    def resetCost(self):
+        self.spiBytes, self.fifoWords = 0, 0
+
+    #SPI transactions
+
+    def transaction(self, data):
+        self.spiBytes += len(data)
+        if len(data) == 3 or data[0] & 0xC0 != 0x80:
+            return #host command or read
+        addr = (data[0] & 0x3F) << 16 | data[1] << 8 | data[2]
+        payload = data[3:]
+        if addr == REG_CMDB_WRITE:
+            self.fifoWords += len(payload) // 4
+            self.fifo += payload
+            self.runCoprocessor()
+        elif addr < RAM_G_SIZE:
+            self.ram[addr:addr + len(payload)] = payload
+        elif RAM_DL <= addr < RAM_DL + RAM_DL_SIZE:
+            offset = addr - RAM_DL
+            self.dlRam[offset:offset + len(payload)] = payload
+        elif addr == REG_DLSWAP and payload and payload[0] != 0:
+            words = struct.unpack('<%dI' % DL_ENTRIES, self.dlRam)
+            end = next((i for i, w in enumerate(words) if w == 0), DL_ENTRIES - 1)
+            self.frame([('dl', w) for w in words[:end + 1]])
+
+    #coprocessor
+
+    def runCoprocessor(self):
+        while True:
+            if self.stream is not None:
+                if not self.feedStream():
+                    return
+                continue
+            if len(self.fifo) < 4:
+                return
+            word = struct.unpack_from('<I', self.fifo)[0]
+            if word & 0xFFFFFF00 != 0xFFFFFF00:
+                del self.fifo[:4]
+                self.dl.append(('dl', word))
+                continue
+            if word not in COMMANDS:
+                raise SystemExit('unsupported coprocessor command 0x%08X, the capture is out of step' % word)
+            name, nParams = COMMANDS[word]
+            size = 4 + 4 * nParams
+            if len(self.fifo) < size:
+                return
+            text = None
+            if name in STRING_COMMANDS:
+                end = self.fifo.find(b'\x00', size)
+                if end < 0:
+                    return
+                text = self.fifo[size:end].decode('latin-1')
+                size = (end + 4) & ~3
+            params = bytes(self.fifo[4:4 + 4 * nParams])
+            del self.fifo[:size]
+            self.command(name, params, text)
+
+    def feedStream(self):
+        kind, dest, inflater, consumed = self.stream
+        if kind == 'inflate':
+            out = inflater.decompress(bytes(self.fifo))
+            self.ram[dest:dest + len(out)] = out
+            dest += len(out)
+            used = len(self.fifo) - len(inflater.unused_data)
+            done = inflater.eof
+        else:
+            #LOADIMAGE and MEMWRITE data, inflater holds the bytes still expected
+            used = min(len(self.fifo), inflater)
+            if kind == 'memwrite':
+                self.ram[dest:dest + used] = self.fifo[:used]
+                dest += used
+            inflater -= used
+            done = inflater == 0
+        consumed += used
+        if not done:
+            del self.fifo[:used]
+            self.stream = (kind, dest, inflater, consumed)
+            return False
+        #the data is padded to a whole word
+        del self.fifo[:used + (-consumed % 4)]
+        self.stream = None
+        return True
+
+    def command(self, name, params, text):
+        words = struct.unpack('<%dI' % (len(params) // 4), params)
+        halves = struct.unpack('<%dh' % (len(params) // 2), params)
+        if name == 'DLSTART':
+            self.dl = []
+        elif name == 'SWAP':
+            self.frame(self.dl)
+        elif name == 'FGCOLOR':
+            self.fgColor = rgb(words[0])
+        elif name == 'BGCOLOR':
+            self.bgColor = rgb(words[0])
+        elif name == 'FILLWIDTH':
+            self.fillWidth = words[0]
+        elif name == 'TEXT':
+            self.dl.append(('text', halves[0], halves[1], halves[2], halves[3] & 0xFFFF, text, self.fillWidth))
+        elif name == 'BUTTON':
+            self.dl.append(('button', halves[:5], halves[5] & 0xFFFF, text, self.fgColor))
+        elif name == 'PROGRESS':
+            self.dl.append(('progress', halves[:4], halves[4] & 0xFFFF, halves[5] & 0xFFFF, halves[6] & 0xFFFF, self.bgColor))
+        elif name == 'SPINNER':
+            self.dl.append(('spinner', halves[0], halves[1], halves[3]))
+        elif name == 'APPEND':
+            start = words[0] & (RAM_G_SIZE - 1)
+            self.dl += [('dl', w) for w in struct.unpack_from('<%dI' % (words[1] // 4), self.ram, start)]
+        elif name == 'ROMFONT':
+            self.romSlots[words[0]] = words[1]
+        elif name == 'SETFONT2':
+            self.dl.append(self.setFont(words[0], words[1], words[2]))
+        elif name == 'SETBITMAP':
+            fmt, w, h = words[1] & 0xFFFF, words[1] >> 16, words[2] & 0xFFFF
+            self.dl.append(('setbitmap', words[0], fmt, w, h))
+        elif name == 'INFLATE':
+            self.stream = ('inflate', words[0], zlib.decompressobj(), 0)
+        elif name == 'LOADIMAGE':
+            raise SystemExit('CMD_LOADIMAGE data has no length in the stream, convert the image with tools/mkasset.py')
+        elif name == 'MEMWRITE':
+            self.stream = ('memwrite', words[0], words[1], 0)
+        elif name == 'FLASHWRITE':
+            self.stream = ('skip', 0, words[1], 0)
+        elif name == 'MEMSET':
+            self.ram[words[0]:words[0] + words[2]] = bytes([words[1] & 0xFF]) * words[2]
+        elif name == 'MEMZERO':
+            self.ram[words[0]:words[0] + words[1]] = bytes(words[1])
+        elif name == 'MEMCPY':
+            self.ram[words[0]:words[0] + words[2]] = self.ram[words[1]:words[1] + words[2]]
+        elif name == 'FLASHREAD':
+            self.ram[words[0]:words[0] + words[2]] = self.flash[words[1]:words[1] + words[2]]
+        elif name == 'FLASHUPDATE':
+            self.flash[words[0]:words[0] + words[2]] = self.ram[words[1]:words[1] + words[2]]
+        elif name == 'FLASHERASE':
+            self.flash[:] = b'\xff' * FLASH_SIZE
+        #the rest only read back state or change nothing that is drawn
+
+    def setFont(self, handle, ptr, first):
+        #legacy metric block: 128 widths, then format, stride, width, height and glyph pointer
+        widths = self.ram[ptr:ptr + 128]
+        fmt, stride, w, h, gptr = struct.unpack_from('<5I', self.ram, ptr + 128)
+        return ('setfont', handle & 31, dict(addr=gptr, fmt=fmt, stride=stride, w=w, h=h,
+                                             first=first, font=bytes(widths)))
+
+    #display list
+
+    def frame(self, dl):
+        cost = self.render(dl)
+        path = os.path.join(self.outDir, 'frame_%03d.png' % self.frames)
+        writePng(path, bytes(self.raster.pixels))
+        print('%5d %10d %10d %10d %9.1f  %s%s'
+              % (self.frames, self.spiBytes, self.fifoWords, cost, self.spiBytes * 8000.0 / self.spiHz,
+                 path, '  (over RAM_DL)' if cost > DL_ENTRIES else ''))
+        self.frames += 1
+        self.resetCost()
+
+    def render(self, dl):
+        r = self.raster
+        st = dict(color=(255, 255, 255), clear=(0, 0, 0), handle=0, cell=0, frac=4, prim=0,
+                  lineWidth=16, pointSize=16, palette=0)
+        handles = [dict(addr=0, fmt=1, stride=1, w=0, h=0, first=0, font=None) for _ in range(32)]
+        vertices, cost = [], 0
+        for entry in dl:
+            if entry[0] != 'dl':
+                cost += self.widget(entry, st, handles)
+                continue
+            cost += 1
+            word = entry[1]
+            if word >> 30 == 1:
+                x, y = sext(word >> 15 & 0x7FFF, 15), sext(word & 0x7FFF, 15)
+                vertices.append((x / (1 << st['frac']), y / (1 << st['frac']), st['handle'], st['cell']))
+            elif word >> 30 == 2:
+                vertices.append((word >> 21 & 0x1FF, word >> 12 & 0x1FF, word >> 7 & 31, word & 127))
+            else:
+                op = word >> 24
+                if op == 0x00:
+                    break
+                elif op == 0x01:
+                    handles[st['handle']]['addr'] = word & 0x3FFFFF
+                elif op == 0x02:
+                    st['clear'] = rgb(word)
+                elif op == 0x04:
+                    st['color'] = rgb(word)
+                elif op == 0x05:
+                    st['handle'] = word & 31
+                elif op == 0x06:
+                    st['cell'] = word & 127
+                elif op == 0x07:
+                    handles[st['handle']].update(fmt=word >> 19 & 31, stride=word >> 9 & 0x3FF, h=word & 0x1FF)
+                elif op == 0x08:
+                    handles[st['handle']].update(w=word >> 9 & 0x1FF, h=word & 0x1FF)
+                elif op == 0x0D:
+                    st['pointSize'] = word & 0x1FFF
+                elif op == 0x0E:
+                    st['lineWidth'] = word & 0xFFF
+                elif op == 0x1F:
+                    st['prim'], vertices = word & 15, []
+                elif op == 0x21:
+                    st['prim'] = 0
+                elif op == 0x26:
+                    if word & 4:
+                        r.clear(st['clear'])
+                elif op == 0x27:
+                    st['frac'] = word & 7
+                elif op == 0x2A:
+                    st['palette'] = word & 0x3FFFFF
+            vertices = self.primitive(st, handles, vertices)
+        return cost
+
+    def primitive(self, st, handles, vertices):
+        r, prim, color = self.raster, st['prim'], st['color']
+        if prim == 1:
+            for x, y, handle, cell in vertices:
+                self.bitmap(handles[handle], cell, int(x), int(y), color, st['palette'])
+        elif prim == 2:
+            for x, y, _, _ in vertices:
+                r.roundRect(x, y, x, y, st['pointSize'] / 16.0, color)
+        elif prim in (3, 4) and len(vertices) >= 2:
+            r.line(vertices[0][0], vertices[0][1], vertices[1][0], vertices[1][1], st['lineWidth'] / 16.0, color)
+            return vertices[1:] if prim == 4 else []
+        elif prim == 9 and len(vertices) >= 2:
+            r.roundRect(vertices[0][0], vertices[0][1], vertices[1][0], vertices[1][1],
+                        st['lineWidth'] / 16.0, color)
+            return []
+        else:
+            return vertices
+        return []
+
+    def bitmap(self, bm, cell, x0, y0, color, palette):
+        fmt, stride, w, h = bm['fmt'], bm['stride'], bm['w'], bm['h']
+        base = bm['addr'] + cell * stride * h
+        bits = {1: 1, 2: 4, 3: 8, 17: 2}.get(fmt)
+        for y in range(h):
+            row = base + y * stride
+            for x in range(w):
+                if bits is not None:
+                    #luminance formats are alpha masks in the current colour
+                    value = self.ram[row + x * bits // 8] >> (8 - bits - x * bits % 8) & ((1 << bits) - 1)
+                    self.raster.blend(x0 + x, y0 + y, color, value * 255 // ((1 << bits) - 1))
+                    continue
+                if fmt == 16: #PALETTED8, ARGB8888 entries
+                    b, g, rr, a = self.ram[palette + 4 * self.ram[row + x]:][:4]
+                    pixel, alpha = (rr, g, b), a
+                elif fmt == 14: #PALETTED565
+                    pixel, alpha = rgb565(struct.unpack_from('<H', self.ram, palette + 2 * self.ram[row + x])[0]), 255
+                elif fmt == 15: #PALETTED4444
+                    pixel, alpha = argb4(struct.unpack_from('<H', self.ram, palette + 2 * self.ram[row + x])[0])
+                elif fmt == 7:
+                    pixel, alpha = rgb565(struct.unpack_from('<H', self.ram, row + 2 * x)[0]), 255
+                elif fmt == 6:
+                    pixel, alpha = argb4(struct.unpack_from('<H', self.ram, row + 2 * x)[0])
+                elif fmt == 0:
+                    v = struct.unpack_from('<H', self.ram, row + 2 * x)[0]
+                    pixel, alpha = (((v >> 10) & 31) * 255 // 31, ((v >> 5) & 31) * 255 // 31, (v & 31) * 255 // 31), 255 * (v >> 15)
+                else:
+                    return
+                tinted = tuple(p * c // 255 for p, c in zip(pixel, color))
+                self.raster.blend(x0 + x, y0 + y, tinted, alpha)
+
+    #widgets, drawn flat with their estimated display list cost
+
+    def widget(self, entry, st, handles):
+        r, kind = self.raster, entry[0]
+        if kind == 'setfont':
+            handles[entry[1]] = dict(entry[2])
+            st['handle'] = entry[1]
+            return 5
+        if kind == 'setbitmap':
+            _, addr, fmt, w, h = entry
+            bpp = {0: 16, 1: 1, 2: 4, 3: 8, 6: 16, 7: 16, 14: 8, 15: 8, 16: 8, 17: 2}.get(fmt, 8)
+            handles[st['handle']].update(addr=addr, fmt=fmt, w=w, h=h, stride=(w * bpp + 7) // 8)
+            return 4
+        if kind == 'text':
+            _, x, y, font, options, text, fill = entry
+            return WIDGET_COST[kind] + self.text(x, y, font, options, text, st['color'], handles,
+                                                 fill if options & OPT_FILL else 0)
+        if kind == 'button':
+            _, (x, y, w, h, font), options, text, fg = entry
+            r.roundRect(x + 4, y + 4, x + w - 5, y + h - 5, 4, fg)
+            return WIDGET_COST[kind] + self.text(x + w // 2, y + h // 2, font, OPT_CENTERX | OPT_CENTERY,
+                                                 text, st['color'], handles, 0)
+        if kind == 'progress':
+            _, (x, y, w, h), options, value, rng, bg = entry
+            radius = h / 2.0
+            r.roundRect(x + radius, y + radius, x + w - radius, y + radius, radius, bg)
+            if rng and value:
+                r.roundRect(x + radius, y + radius, x + radius + (w - h) * min(value, rng) / rng, y + radius,
+                            radius, st['color'])
+            return WIDGET_COST[kind]
+        if kind == 'spinner':
+            _, x, y, scale = entry
+            radius = (40 if scale == 0 else 24 * scale)
+            for i in range(8):
+                a = 2 * math.pi * i / 8
+                r.roundRect(x + radius * math.cos(a), y + radius * math.sin(a),
+                            x + radius * math.cos(a), y + radius * math.sin(a), radius / 6.0, st['color'])
+            return WIDGET_COST[kind]
+        return 0
+
+    def text(self, x, y, font, options, text, color, handles, fillWidth):
+        bm = handles[font & 31]
+        custom = font < 16 and bm['font'] is not None
+        height = bm['h'] if custom else ROM_HEIGHTS.get(self.romSlots.get(font, font), 16)
+
+        def advance(ch):
+            return bm['font'][ord(ch) & 127] if custom else int(round(6 * max(1.0, height / 10.0)))
+        lines = [text]
+        if fillWidth:
+            lines, line = [], ''
+            for word in text.split(' '):
+                trial = (line + ' ' + word) if line else word
+                if line and sum(advance(c) for c in trial) > fillWidth:
+                    lines.append(line)
+                    trial = word
+                line = trial
+            lines.append(line)
+        if options & OPT_CENTERY:
+            y -= height * len(lines) // 2
+        for line in lines:
+            width = sum(advance(c) for c in line)
+            pen = x - width // 2 if options & OPT_CENTERX else x - width if options & OPT_RIGHTX else x
+            for ch in line:
+                if custom:
+                    self.bitmap(bm, ord(ch) - bm['first'], pen, y, color, 0)
+                else:
+                    self.raster.glyph(ch, pen, y, height, color)
+                pen += advance(ch)
+            y += height
+        return len(text)
+
+
+def rgb(word):
+    return (word >> 16 & 255, word >> 8 & 255, word & 255)
+
+
+def rgb565(v):
+    return ((v >> 11) * 255 // 31, (v >> 5 & 63) * 255 // 63, (v & 31) * 255 // 31)
+
+
+def argb4(v):
+    return ((v >> 8 & 15) * 17, (v >> 4 & 15) * 17, (v & 15) * 17), (v >> 12) * 17
+
+
+def transactions(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    pos = 0
+    while pos + 2 <= len(data):
+        length = struct.unpack_from('<H', data, pos)[0]
+        yield data[pos + 2:pos + 2 + length]
+        pos += 2 + length
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Rasterise EVE3 SPI captures to PNG with per-frame costs')
+    parser.add_argument('captures', nargs='+', help='SPI captures, replayed in order into one EVE')
+    parser.add_argument('-o', '--output', default='.', help='directory for frame_NNN.png')
+    parser.add_argument('--spi-hz', type=int, default=1000000, help='SPI clock, for the transfer time')
+    args = parser.parse_args()
+
+    os.makedirs(args.output, exist_ok=True)
+    eve = Eve(Raster(), args.output, args.spi_hz)
+    print('%5s %10s %10s %10s %9s' % ('frame', 'spi bytes', 'fifo words', 'dl entries', 'spi ms'))
+    for path in args.captures:
+        for data in transactions(path):
+            eve.transaction(data)
+    if eve.frames == 0:
+        sys.stderr.write('no frames in the capture\n')
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""
+mapreport.py
+
+Reports the RAM and flash used by each module from a linker map file, and
+with --no-heap fails if the C library allocator was linked in. The firmware
+keeps every buffer in static storage or fixed pools, so malloc appearing in
+the map means a new dependency started using the heap. Run it as a
+post-build step so the build fails when that happens.
+
+Reads maps from the TI ARM linker (--map_file, using its MODULE SUMMARY)
+and from GNU ld (-Map, summing .text, .rodata, .data and .bss per object).
+
+Usage:
+    tools/mapreport.py Release/smo.map
+    tools/mapreport.py Release/smo.map --no-heap --sort ram
+"""
+
+import argparse
+import os
+import re
+import sys
+
+#allocator entry points, any of these in the map means heap use
+HEAP_SYMBOLS = ['malloc', 'calloc', 'realloc', 'free', 'strdup', 'strndup',
+                'memalign', 'aligned_alloc', 'posix_memalign', '_malloc_r', '_calloc_r']
+
+GNU_SECTIONS = {
+    '.text': 'code', '.rodata': 'ro', '.data': 'rw', '.bss': 'zi', 'COMMON': 'zi',
+}
+
+
+def moduleName(path):
+    #archive members are reported as lib.a(member.o)
+    member = re.search(r'\(([^)]+)\)$', path)
+    return os.path.basename(member.group(1) if member else path)
+
+
+def parseTi(lines):
+    modules, inSummary = {}, False
+    for line in lines:
+        if line.strip() == 'MODULE SUMMARY':
+            inSummary = True
+            continue
+        if not inSummary:
+            continue
+        if line.startswith('GLOBAL') or line.startswith('LINKER GENERATED'):
+            break
+        #name, code, ro data, rw data, with rw data covering .data and .bss
+        fields = line.split()
+        if len(fields) == 4 and all(f.isdigit() for f in fields[1:]) and not fields[0].endswith(':'):
+            code, ro, rw = (int(f) for f in fields[1:])
+            sizes = modules.setdefault(fields[0], {'code': 0, 'ro': 0, 'rw': 0, 'zi': 0})
+            sizes['code'] += code
+            sizes['ro'] += ro
+            sizes['zi'] += rw #the TI summary doesn't split initialised data out
+    symbols = set()
+    for line in lines:
+        match = re.match(r'^[0-9a-fA-F]{8}\s+(\w+)\s*$', line)
+        if match:
+            symbols.add(match.group(1))
+    return modules, symbols
+
+
+def parseGnu(lines):
+    modules, section = {}, None
+    for line in lines:
+        #input sections are listed as " .text.name  0xaddr  0xsize  file", or
+        #with the name alone on a line when it is too long
+        match = re.match(r'^ (\S+)\s*$', line)
+        if match:
+            section = match.group(1)
+            continue
+        match = re.match(r'^ (\S+)?\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(\S.*)$', line)
+        if not match:
+            section = None if not line.startswith(' ') else section
+            continue
+        name = match.group(1) or section
+        section = None
+        if name is None:
+            continue
+        kind = next((k for prefix, k in GNU_SECTIONS.items()
+                     if name == prefix or name.startswith(prefix + '.')), None)
+        size = int(match.group(3), 16)
+        if kind is None or size == 0:
+            continue
+        sizes = modules.setdefault(moduleName(match.group(4).strip()),
+                                   {'code': 0, 'ro': 0, 'rw': 0, 'zi': 0})
+        sizes[kind] += size
+    #archive members pulled in to resolve a symbol are listed as "lib.a(file.o)\n  ref.o (symbol)"
+    symbols = set(re.findall(r'^\s+\S+ \((\w+)\)\s*$', '\n'.join(lines), re.M))
+    return modules, symbols
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Per-module memory use and heap check from a linker map')
+    parser.add_argument('map')
+    parser.add_argument('--sort', choices=['ram', 'flash', 'name'], default='ram')
+    parser.add_argument('--no-heap', action='store_true', help='fail if an allocator is linked')
+    args = parser.parse_args()
+
+    with open(args.map, errors='replace') as f:
+        lines = f.read().splitlines()
+    isTi = any(line.strip() == 'MODULE SUMMARY' for line in lines)
+    modules, symbols = parseTi(lines) if isTi else parseGnu(lines)
+
+    rows = [(name, s['code'] + s['ro'] + s['rw'], s['rw'] + s['zi']) for name, s in modules.items()]
+    key = {'ram': lambda r: (-r[2], r[0]), 'flash': lambda r: (-r[1], r[0]), 'name': lambda r: r[0]}[args.sort]
+    print('%-32s %10s %10s' % ('module', 'flash', 'ram'))
+    for name, flash, ram in sorted(rows, key=key):
+        if flash or ram:
+            print('%-32s %10d %10d' % (name, flash, ram))
+    print('%-32s %10d %10d' % ('total', sum(r[1] for r in rows), sum(r[2] for r in rows)))
+
+    if args.no_heap:
+        linked = sorted(s for s in HEAP_SYMBOLS if s in symbols)
+        if linked:
+            sys.stderr.write('%s: heap allocator linked (%s)\n' % (args.map, ', '.join(linked)))
+            return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,356 @@
+#!/usr/bin/env python3
+"""
+mkasset.py
+
+Converts images to EVE-native bitmaps at build time and writes them as a C
+source file for asset.c. Each image is decoded (baseline JPEG, binary PPM),
+converted to PALETTED565, RGB565 or L8, and its RAM_G image (palette first,
+then pixels) is deflated for CMD_INFLATE. The report lists, per asset, the
+bytes in MCU flash and the SPI time to upload it compared to sending the
+source file for CMD_LOADIMAGE.
+
+Usage:
+    tools/mkasset.py logo=assets/logo.jpg:paletted565:32 logo2=assets/logo2.jpg:paletted565:16 -o asset_data.c
+"""
+
+import argparse
+import math
+import struct
+import sys
+import zlib
+
+#EVE bitmap formats, bytes per pixel of the pixel data
+FORMATS = {'paletted565': (14, 1), 'rgb565': (7, 2), 'l8': (3, 1)}
+SPI_OVERHEAD = 3 #address bytes per burst
+SPI_CHUNK = 1000 #payload bytes per burst, EVE_CHUNK_SIZE
+
+
+#zigzag order of coefficients in a JPEG block
+ZIGZAG = [
+    0, 1, 8, 16, 9, 2, 3, 10, 17, 24, 32, 25, 18, 11, 4, 5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6, 7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+]
+
+IDCT = [[(math.sqrt(0.5) if u == 0 else 1.0) * math.cos((2*x + 1) * u * math.pi / 16) / 2
+         for u in range(8)] for x in range(8)]
+
+
+class BitReader:
+    def __init__(self, data, at):
+        self.data = data
+        self.at = at
+        self.bits = 0
+        self.count = 0
+
+    def bit(self):
+        if self.count == 0:
+            byte = self.data[self.at]
+            self.at += 1
+            if byte == 0xFF:
+                marker = self.data[self.at]
+                if marker == 0x00:
+                    self.at += 1 #stuffed zero
+                elif 0xD0 <= marker <= 0xD7:
+                    byte = 0 #restart marker, handled by the caller
+                    self.at -= 1
+            self.bits = byte
+            self.count = 8
+        self.count -= 1
+        return (self.bits >> self.count) & 1
+
+    def receive(self, length):
+        value = 0
+        for _ in range(length):
+            value = (value << 1) | self.bit()
+        return value
+
+    def restart(self):
+        self.count = 0
+        while not (self.data[self.at] == 0xFF and 0xD0 <= self.data[self.at + 1] <= 0xD7):
+            self.at += 1
+        self.at += 2
+
+
+def extend(value, length):
+    return value - (1 << length) + 1 if length and value < (1 << (length - 1)) else value
+
+
+def buildHuffman(counts, symbols):
+    table, code, k = {}, 0, 0
+    for length in range(1, 17):
+        for _ in range(counts[length - 1]):
+            table[(length, code)] = symbols[k]
+            code += 1
+            k += 1
+        code <<= 1
+    return table
+
+
+def decodeHuffman(reader, table):
+    code = 0
+    for length in range(1, 17):
+        code = (code << 1) | reader.bit()
+        if (length, code) in table:
+            return table[(length, code)]
+    raise ValueError('bad Huffman code')
+
+
+def idct(block):
+    rows = [[sum(IDCT[x][u] * block[v*8 + u] for u in range(8)) for x in range(8)] for v in range(8)]
+    return [[max(0, min(255, int(round(sum(IDCT[y][v] * rows[v][x] for v in range(8)) + 128))))
+             for x in range(8)] for y in range(8)]
+
+
+def decodeJpeg(data):
+    """Baseline sequential JPEG to rows of (r, g, b)"""
+    if data[:2] != b'\xff\xd8':
+        raise ValueError('not a JPEG')
+    quant, huffman, components = {}, {}, []
+    restartInterval = 0
+    at = 2
+    while True:
+        marker = data[at + 1]
+        length = struct.unpack_from('>H', data, at + 2)[0]
+        segment = data[at + 4:at + 2 + length]
+        at += 2 + length
+        if marker == 0xDB:
+            i = 0
+            while i < len(segment):
+                precision, ident = segment[i] >> 4, segment[i] & 15
+                size = 128 if precision else 64
+                fmt = '>64H' if precision else '64B'
+                quant[ident] = struct.unpack_from(fmt, segment, i + 1)
+                i += 1 + size
+        elif marker == 0xC4:
+            i = 0
+            while i < len(segment):
+                cls, ident = segment[i] >> 4, segment[i] & 15
+                counts = segment[i + 1:i + 17]
+                symbols = segment[i + 17:i + 17 + sum(counts)]
+                huffman[(cls, ident)] = buildHuffman(counts, symbols)
+                i += 17 + sum(counts)
+        elif marker == 0xC0 or marker == 0xC1:
+            height, width, count = struct.unpack_from('>HHB', segment, 1)
+            for c in range(count):
+                ident, sampling, table = struct.unpack_from('BBB', segment, 6 + 3*c)
+                components.append({'id': ident, 'h': sampling >> 4, 'v': sampling & 15, 'q': table})
+        elif 0xC2 <= marker <= 0xCF and marker not in (0xC4, 0xC8, 0xCC):
+            raise ValueError('only baseline JPEGs are supported')
+        elif marker == 0xDD:
+            restartInterval = struct.unpack_from('>H', segment)[0]
+        elif marker == 0xDA:
+            for c in range(segment[0]):
+                ident, tables = segment[1 + 2*c], segment[2 + 2*c]
+                for comp in components:
+                    if comp['id'] == ident:
+                        comp['dc'], comp['ac'] = tables >> 4, tables & 15
+            break
+
+    hMax = max(c['h'] for c in components)
+    vMax = max(c['v'] for c in components)
+    mcusX = (width + 8*hMax - 1) // (8*hMax)
+    mcusY = (height + 8*vMax - 1) // (8*vMax)
+    for comp in components:
+        comp['plane'] = [[0] * (mcusX * comp['h'] * 8) for _ in range(mcusY * comp['v'] * 8)]
+        comp['pred'] = 0
+
+    reader = BitReader(data, at)
+    for mcu in range(mcusX * mcusY):
+        if restartInterval and mcu and mcu % restartInterval == 0:
+            reader.restart()
+            for comp in components:
+                comp['pred'] = 0
+        mx, my = mcu % mcusX, mcu // mcusX
+        for comp in components:
+            q = quant[comp['q']]
+            for by in range(comp['v']):
+                for bx in range(comp['h']):
+                    coeffs = [0] * 64
+                    size = decodeHuffman(reader, huffman[(0, comp['dc'])])
+                    comp['pred'] += extend(reader.receive(size), size)
+                    coeffs[0] = comp['pred'] * q[0]
+                    k = 1
+                    while k < 64:
+                        symbol = decodeHuffman(reader, huffman[(1, comp['ac'])])
+                        run, size = symbol >> 4, symbol & 15
+                        if size == 0:
+                            if run != 15:
+                                break
+                            k += 16
+                            continue
+                        k += run
+                        coeffs[ZIGZAG[k]] = extend(reader.receive(size), size) * q[k]
+                        k += 1
+                    pixels = idct(coeffs)
+                    x0 = (mx * comp['h'] + bx) * 8
+                    y0 = (my * comp['v'] + by) * 8
+                    for y in range(8):
+                        comp['plane'][y0 + y][x0:x0 + 8] = pixels[y]
+
+    rows = []
+    for y in range(height):
+        row = []
+        for x in range(width):
+            samples = [c['plane'][y * c['v'] // vMax][x * c['h'] // hMax] for c in components]
+            if len(samples) == 1:
+                row.append((samples[0],) * 3)
+                continue
+            Y, cb, cr = samples[0], samples[1] - 128, samples[2] - 128
+            row.append(tuple(max(0, min(255, int(round(v)))) for v in
+                             (Y + 1.402*cr, Y - 0.344136*cb - 0.714136*cr, Y + 1.772*cb)))
+        rows.append(row)
+    return rows
+
+
+def decodePpm(data):
+    fields, at = [], 0
+    while len(fields) < 4:
+        while data[at:at + 1].isspace():
+            at += 1
+        if data[at:at + 1] == b'#':
+            at = data.index(b'\n', at)
+            continue
+        end = at
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(data[at:end])
+        at = end
+    if fields[0] != b'P6' or int(fields[3]) > 255:
+        raise ValueError('only 8 bit binary PPM is supported')
+    width, height = int(fields[1]), int(fields[2])
+    at += 1
+    return [[tuple(data[at + 3*(y*width + x):at + 3*(y*width + x) + 3]) for x in range(width)]
+            for y in range(height)]
+
+
+def rgb565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def medianCut(colours, count):
+    """Palette of at most count colours from a {colour: pixels} histogram"""
+    boxes = [list(colours.items())]
+    while len(boxes) < count:
+        #split the box with the most pixels along its widest channel
+        splittable = [b for b in boxes if len(b) > 1]
+        if not splittable:
+            break
+        box = max(splittable, key=lambda b: sum(n for _, n in b))
+        boxes.remove(box)
+        channel = max(range(3), key=lambda c: max(k[c] for k, _ in box) - min(k[c] for k, _ in box))
+        box.sort(key=lambda item: item[0][channel])
+        total, half, split = sum(n for _, n in box), 0, 0
+        for split, (_, n) in enumerate(box):
+            half += n
+            if half * 2 >= total:
+                break
+        split = max(1, min(len(box) - 1, split + 1))
+        boxes += [box[:split], box[split:]]
+
+    palette = []
+    for box in boxes:
+        total = sum(n for _, n in box)
+        palette.append(tuple(int(round(sum(k[c] * n for k, n in box) / total)) for c in range(3)))
+    return palette
+
+
+def convert(rows, fmt, colours):
+    """Palette (empty if the format has none) and pixel data in EVE byte order"""
+    height, width = len(rows), len(rows[0])
+    if fmt == 'rgb565':
+        return b'', b''.join(struct.pack('<H', rgb565(*p)) for row in rows for p in row)
+    if fmt == 'l8':
+        return b'', bytes(int(round(0.299*r + 0.587*g + 0.114*b)) for row in rows for r, g, b in row)
+
+    histogram = {}
+    for row in rows:
+        for p in row:
+            histogram[p] = histogram.get(p, 0) + 1
+    palette = medianCut(histogram, colours)
+    nearest = {}
+    pixels = bytearray(width * height)
+    for y, row in enumerate(rows):
+        for x, p in enumerate(row):
+            if p not in nearest:
+                nearest[p] = min(range(len(palette)),
+                                 key=lambda i: sum((a - b) ** 2 for a, b in zip(palette[i], p)))
+            pixels[y*width + x] = nearest[p]
+    lut = b''.join(struct.pack('<H', rgb565(*c)) for c in palette)
+    lut += bytes(-len(lut) % 4) #pixels stay word aligned
+    return lut, bytes(pixels)
+
+
+def spiMs(payload, hz):
+    bursts = (payload + SPI_CHUNK - 1) // SPI_CHUNK
+    return (payload + 12 + bursts * SPI_OVERHEAD) * 8 * 1000.0 / hz
+
+
+def hexLines(data, perLine=16):
+    for i in range(0, len(data), perLine):
+        yield ','.join('0x%x' % b for b in data[i:i + perLine]) + ','
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert images to deflated EVE bitmaps for asset.c')
+    parser.add_argument('assets', nargs='+', help='name=path[:format[:colours]], format is one of %s, '
+                        'colours limits the palette (default 256)' % ', '.join(sorted(FORMATS)))
+    parser.add_argument('--spi-hz', type=int, default=1000000, help='SPI bit rate for the report')
+    parser.add_argument('-o', '--output', default='-')
+    args = parser.parse_args()
+
+    results = []
+    for spec in args.assets:
+        name, _, path = spec.partition('=')
+        path, _, fmt = path.partition(':')
+        fmt, _, colours = fmt.partition(':')
+        fmt = fmt or 'paletted565'
+        colours = int(colours or 256)
+        with open(path, 'rb') as f:
+            source = f.read()
+        rows = decodeJpeg(source) if source[:2] == b'\xff\xd8' else decodePpm(source)
+        palette, pixels = convert(rows, fmt, colours)
+        image = palette + pixels
+        blob = zlib.compress(image, 9)
+        results.append((name, path, fmt, len(rows[0]), len(rows), len(palette), image, blob, source))
+
+        sys.stderr.write('%-8s %-12s %4dx%-4d source %6d B %7.1f ms, RAM_G %6d B, flash %6d B %7.1f ms\n'
+                         % (name, fmt, len(rows[0]), len(rows), len(source), spiMs(len(source), args.spi_hz),
+                            len(image), len(blob), spiMs(len(blob), args.spi_hz)))
+
+    out = sys.stdout if args.output == '-' else open(args.output, 'w', newline='\n')
+    w = out.write
+    w('/************************************************************\n')
+    w(' * Generated by tools/mkasset.py, do not edit. Rerun the\n')
+    w(' * tool on the source images instead.\n')
+    w(' *\n')
+    for name, path, fmt, width, height, _, image, blob, _ in results:
+        w(' * %s: %s, %dx%d %s, %d bytes in RAM_G, %d deflated\n'
+          % (name, path, width, height, fmt, len(image), len(blob)))
+    w(' ************************************************************/\n\n')
+    w('#include <stdint.h>\n\n#include "asset.h"\n')
+
+    for name, path, fmt, width, height, paletteSize, image, blob, _ in results:
+        symbol = 'Asset_' + name
+        w('\nstatic const uint8_t %sBlob[%d] = {\n' % (symbol, len(blob)))
+        for line in hexLines(blob):
+            w(line + '\n')
+        w('};\n\n')
+        w('const Asset_Data %s = {\n' % symbol)
+        w('    .Blob = %sBlob,\n' % symbol)
+        w('    .BlobSize = sizeof(%sBlob),\n' % symbol)
+        w('    .RamSize = %d,\n' % len(image))
+        w('    .Version = 0x%08X, //CRC-32 of the blob\n' % zlib.crc32(blob))
+        w('    .PaletteSize = %d,\n' % paletteSize)
+        w('    .Format = %d, //%s\n' % (FORMATS[fmt][0], fmt.upper()))
+        w('    .Width = %d,\n' % width)
+        w('    .Height = %d,\n' % height)
+        w('};\n')
+
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,430 @@
+#!/usr/bin/env python3
+"""
+mkfont.py
+
+Builds a custom EVE font from a TrueType file and writes it as a C source
+file for font.c. Glyphs are rasterised with anti-aliasing into fixed size
+cells, split into pages of 128 cells with one legacy font metric block per
+page (for CMD_SETFONT2), and the whole RAM_G image is deflated for
+CMD_INFLATE. Code point ranges and advances are written next to the blob so
+the MCU can lay out text without asking the coprocessor.
+
+Usage:
+    tools/mkfont.py DejaVuSans.ttf --size 28 --name Font_sans -o font_data.c
+"""
+
+import argparse
+import math
+import struct
+import sys
+import zlib
+
+#code points in the default subset: ASCII, Latin-1, Latin Extended-A,
+#Greek, Cyrillic and common typographic punctuation
+DEFAULT_RANGES = [
+    (0x0020, 0x007E),
+    (0x00A0, 0x017F),
+    (0x0386, 0x03CE),
+    (0x0400, 0x045F),
+    (0x2013, 0x2014),
+    (0x2018, 0x201E),
+    (0x2022, 0x2022),
+    (0x2026, 0x2026),
+    (0x20AC, 0x20AC),
+]
+
+PAGE_CELLS = 128
+METRIC_SIZE = 148 #legacy font metric block: 128 widths, format, stride, width, height, gptr
+FORMATS = {'L1': (1, 1), 'L2': (17, 2), 'L4': (2, 4), 'L8': (3, 8)} #EVE format, bits per pixel
+
+
+class TrueType:
+    def __init__(self, data):
+        self.data = data
+        numTables = struct.unpack_from('>H', data, 4)[0]
+        self.tables = {}
+        for i in range(numTables):
+            tag, _, offset, length = struct.unpack_from('>4sIII', data, 12 + 16*i)
+            self.tables[tag.decode('latin-1')] = (offset, length)
+
+        head = self.tables['head'][0]
+        self.unitsPerEm = struct.unpack_from('>H', data, head + 18)[0]
+        self.longLoca = struct.unpack_from('>h', data, head + 50)[0] == 1
+
+        hhea = self.tables['hhea'][0]
+        self.ascender, self.descender = struct.unpack_from('>hh', data, hhea + 4)
+        self.numHMetrics = struct.unpack_from('>H', data, hhea + 34)[0]
+        self.numGlyphs = struct.unpack_from('>H', data, self.tables['maxp'][0] + 4)[0]
+        self.cmap = self._readCmap()
+
+    def _readCmap(self):
+        data = self.data
+        base = self.tables['cmap'][0]
+        count = struct.unpack_from('>H', data, base + 2)[0]
+        for i in range(count):
+            platform, encoding, offset = struct.unpack_from('>HHI', data, base + 4 + 8*i)
+            sub = base + offset
+            if platform == 3 and encoding in (1, 10) and struct.unpack_from('>H', data, sub)[0] == 4:
+                return self._readCmap4(sub)
+        raise ValueError('no Unicode format 4 cmap')
+
+    def _readCmap4(self, sub):
+        data = self.data
+        segX2 = struct.unpack_from('>H', data, sub + 6)[0]
+        ends = sub + 14
+        starts = ends + segX2 + 2
+        deltas = starts + segX2
+        rangeOffsets = deltas + segX2
+        cmap = {}
+        for s in range(segX2 // 2):
+            end = struct.unpack_from('>H', data, ends + 2*s)[0]
+            start = struct.unpack_from('>H', data, starts + 2*s)[0]
+            delta = struct.unpack_from('>h', data, deltas + 2*s)[0]
+            rangeOffset = struct.unpack_from('>H', data, rangeOffsets + 2*s)[0]
+            for c in range(start, end + 1):
+                if c == 0xFFFF:
+                    continue
+                if rangeOffset == 0:
+                    glyph = (c + delta) & 0xFFFF
+                else:
+                    at = rangeOffsets + 2*s + rangeOffset + 2*(c - start)
+                    glyph = struct.unpack_from('>H', data, at)[0]
+                    if glyph != 0:
+                        glyph = (glyph + delta) & 0xFFFF
+                if glyph != 0:
+                    cmap[c] = glyph
+        return cmap
+
+    def advance(self, glyph):
+        hmtx = self.tables['hmtx'][0]
+        index = min(glyph, self.numHMetrics - 1)
+        return struct.unpack_from('>H', self.data, hmtx + 4*index)[0]
+
+    def _glyphOffset(self, glyph):
+        loca = self.tables['loca'][0]
+        if self.longLoca:
+            start, end = struct.unpack_from('>II', self.data, loca + 4*glyph)
+        else:
+            start, end = struct.unpack_from('>HH', self.data, loca + 2*glyph)
+            start, end = start*2, end*2
+        return start, end
+
+    def contours(self, glyph, depth=0):
+        """Outline of a glyph as lists of (x, y, onCurve) in font units"""
+        start, end = self._glyphOffset(glyph)
+        if start == end or depth > 8:
+            return []
+        data = self.data
+        at = self.tables['glyf'][0] + start
+        numContours = struct.unpack_from('>h', data, at)[0]
+        at += 10
+        if numContours >= 0:
+            return self._simple(at, numContours)
+
+        #composite glyph, components are offset (and rarely scaled) copies
+        result = []
+        while True:
+            flags, component = struct.unpack_from('>HH', data, at)
+            at += 4
+            if flags & 0x0001:
+                dx, dy = struct.unpack_from('>hh', data, at)
+                at += 4
+            else:
+                dx, dy = struct.unpack_from('>bb', data, at)
+                at += 2
+            xx, xy, yx, yy = 1.0, 0.0, 0.0, 1.0
+            if flags & 0x0008:
+                xx = yy = struct.unpack_from('>h', data, at)[0] / 16384.0
+                at += 2
+            elif flags & 0x0040:
+                xx, yy = [v / 16384.0 for v in struct.unpack_from('>hh', data, at)]
+                at += 4
+            elif flags & 0x0080:
+                xx, xy, yx, yy = [v / 16384.0 for v in struct.unpack_from('>hhhh', data, at)]
+                at += 8
+            if not flags & 0x0002:
+                dx = dy = 0 #point matching is not used by the fonts we ship
+            for contour in self.contours(component, depth + 1):
+                result.append([(x*xx + y*yx + dx, x*xy + y*yy + dy, on) for x, y, on in contour])
+            if not flags & 0x0020:
+                break
+        return result
+
+    def _simple(self, at, numContours):
+        data = self.data
+        endPts = struct.unpack_from('>%dH' % numContours, data, at)
+        at += 2*numContours
+        numPoints = endPts[-1] + 1 if numContours else 0
+        at += 2 + struct.unpack_from('>H', data, at)[0]
+
+        flags = []
+        while len(flags) < numPoints:
+            flag = data[at]
+            at += 1
+            flags.append(flag)
+            if flag & 0x08:
+                flags.extend([flag] * data[at])
+                at += 1
+
+        def coords(short, same):
+            nonlocal at
+            values, value = [], 0
+            for flag in flags:
+                if flag & short:
+                    delta = data[at]
+                    at += 1
+                    value += delta if flag & same else -delta
+                elif not flag & same:
+                    value += struct.unpack_from('>h', data, at)[0]
+                    at += 2
+                values.append(value)
+            return values
+
+        xs = coords(0x02, 0x10)
+        ys = coords(0x04, 0x20)
+        result, first = [], 0
+        for last in endPts:
+            result.append([(xs[i], ys[i], bool(flags[i] & 1)) for i in range(first, last + 1)])
+            first = last + 1
+        return result
+
+
+def flatten(contour, steps=8):
+    """Quadratic outline to a closed polyline"""
+    count = len(contour)
+    if count == 0:
+        return []
+    #start from an on-curve point, inventing one between two off-curve points
+    start = next((i for i, p in enumerate(contour) if p[2]), None)
+    if start is None:
+        a, b = contour[0], contour[1 % count]
+        contour = [((a[0] + b[0]) / 2, (a[1] + b[1]) / 2, True)] + contour
+        start, count = 0, count + 1
+    points = contour[start:] + contour[:start] + [contour[start]]
+
+    line = [points[0][:2]]
+    control = None
+    for x, y, on in points[1:]:
+        if on:
+            if control is None:
+                line.append((x, y))
+            else:
+                line.extend(quad(line[-1], control, (x, y), steps))
+                control = None
+        else:
+            if control is not None:
+                mid = ((control[0] + x) / 2, (control[1] + y) / 2)
+                line.extend(quad(line[-1], control, mid, steps))
+            control = (x, y)
+    if control is not None:
+        line.extend(quad(line[-1], control, points[0][:2], steps))
+    return line
+
+
+def quad(p0, p1, p2, steps):
+    out = []
+    for i in range(1, steps + 1):
+        t = i / steps
+        u = 1 - t
+        out.append((u*u*p0[0] + 2*u*t*p1[0] + t*t*p2[0], u*u*p0[1] + 2*u*t*p1[1] + t*t*p2[1]))
+    return out
+
+
+def rasterise(lines, width, height, subsamples=4):
+    """Non-zero winding fill of polylines (pixel coordinates) into coverage 0..1"""
+    edges = []
+    for line in lines:
+        for (x0, y0), (x1, y1) in zip(line, line[1:]):
+            if y0 != y1:
+                edges.append((x0, y0, x1, y1))
+
+    cover = [[0.0] * width for _ in range(height)]
+    for row in range(height):
+        for k in range(subsamples):
+            y = row + (k + 0.5) / subsamples
+            crossings = []
+            for x0, y0, x1, y1 in edges:
+                if (y0 <= y < y1) or (y1 <= y < y0):
+                    x = x0 + (y - y0) * (x1 - x0) / (y1 - y0)
+                    crossings.append((x, 1 if y1 > y0 else -1))
+            crossings.sort()
+            winding = 0
+            for i, (x, direction) in enumerate(crossings):
+                before = winding
+                winding += direction
+                if before == 0 and winding != 0:
+                    spanStart = x
+                elif before != 0 and winding == 0:
+                    addSpan(cover[row], spanStart, x, 1.0 / subsamples)
+    return cover
+
+
+def addSpan(row, x0, x1, weight):
+    x0 = max(0.0, x0)
+    x1 = min(float(len(row)), x1)
+    if x1 <= x0:
+        return
+    first, last = int(x0), int(math.ceil(x1)) - 1
+    for px in range(first, last + 1):
+        row[px] += (min(x1, px + 1) - max(x0, px)) * weight
+
+
+def pack(cover, stride, bits):
+    maxValue = (1 << bits) - 1
+    out = bytearray()
+    for row in cover:
+        packed = bytearray(stride)
+        for x, value in enumerate(row):
+            level = min(maxValue, int(round(value * maxValue)))
+            bit = x * bits
+            packed[bit // 8] |= level << (8 - bits - bit % 8)
+        out += packed
+    return out
+
+
+def parseRanges(text):
+    ranges = []
+    for part in text.split(','):
+        first, _, last = part.partition('-')
+        ranges.append((int(first, 16), int(last or first, 16)))
+    return ranges
+
+
+def build(font, size, ranges, bitmapFormat):
+    evFormat, bits = FORMATS[bitmapFormat]
+    scale = size / font.unitsPerEm
+    baseline = int(math.ceil(font.ascender * scale))
+    height = baseline + int(math.ceil(-font.descender * scale))
+
+    codepoints = [c for first, last in ranges for c in range(first, last + 1) if c in font.cmap]
+    codepoints = sorted(set(codepoints))
+    if ord('?') not in codepoints:
+        raise ValueError('subset must contain "?" for unmapped characters')
+
+    glyphs = []
+    for c in codepoints:
+        glyph = font.cmap[c]
+        lines = [[(x*scale, baseline - y*scale) for x, y in flatten(contour)]
+                 for contour in font.contours(glyph)]
+        advance = int(round(font.advance(glyph) * scale))
+        inkRight = max((x for line in lines for x, _ in line), default=0)
+        glyphs.append((c, advance, lines, int(math.ceil(inkRight))))
+
+    width = max(max(advance, ink) for _, advance, _, ink in glyphs)
+    stride = (width * bits + 7) // 8
+    cellSize = stride * height
+    pages = (len(glyphs) + PAGE_CELLS - 1) // PAGE_CELLS
+
+    #RAM_G image: all metric blocks, then every page's cells back to back
+    image = bytearray()
+    for page in range(pages):
+        widths = bytearray(PAGE_CELLS)
+        for cell, (_, advance, _, _) in enumerate(glyphs[page*PAGE_CELLS:(page + 1)*PAGE_CELLS]):
+            widths[cell] = min(advance, 255)
+        #gptr is patched by Font_load once the load address is known
+        image += widths + struct.pack('<IIIII', evFormat, stride, width, height, 0)
+    for _, _, lines, _ in glyphs:
+        image += pack(rasterise(lines, width, height), stride, bits)
+    image += bytes(cellSize * (pages*PAGE_CELLS - len(glyphs)))
+
+    #contiguous code point runs map straight onto glyph indices
+    runs = []
+    for index, c in enumerate(codepoints):
+        if runs and runs[-1][0] + runs[-1][1] == c:
+            runs[-1][1] += 1
+        else:
+            runs.append([c, 1, index])
+
+    return {
+        'image': bytes(image),
+        'runs': runs,
+        'advances': [min(advance, 255) for _, advance, _, _ in glyphs],
+        'fallback': codepoints.index(ord('?')),
+        'height': height,
+        'baseline': baseline,
+        'width': width,
+        'stride': stride,
+        'pages': pages,
+        'cellSize': cellSize,
+    }
+
+
+def hexLines(data, perLine=16):
+    for i in range(0, len(data), perLine):
+        yield ','.join('0x%x' % b for b in data[i:i + perLine]) + ','
+
+
+def write(out, name, source, size, fmt, result, blob):
+    image = result['image']
+    w = out.write
+    w('/************************************************************\n')
+    w(' * Generated by tools/mkfont.py from %s at %d px, %s.\n' % (source, size, fmt))
+    w(' * Do not edit, rerun the tool instead.\n')
+    w(' *\n')
+    w(' * %d glyphs in %d pages, %d x %d cells, %d bytes in RAM_G,\n'
+      % (len(result['advances']), result['pages'], result['width'], result['height'], len(image)))
+    w(' * %d bytes deflated.\n' % len(blob))
+    w(' ************************************************************/\n\n')
+    w('#include <stdint.h>\n\n#include "font.h"\n\n')
+
+    w('static const uint8_t %sBlob[%d] = {\n' % (name, len(blob)))
+    for line in hexLines(blob):
+        w(line + '\n')
+    w('};\n\n')
+
+    w('static const Font_Range %sRanges[%d] = {\n' % (name, len(result['runs'])))
+    w('    //First  Count  Glyph\n')
+    for first, count, glyph in result['runs']:
+        w('    { 0x%04X, %4d,  %4d },\n' % (first, count, glyph))
+    w('};\n\n')
+
+    w('static const uint8_t %sAdvances[%d] = {\n' % (name, len(result['advances'])))
+    for line in hexLines(bytes(result['advances'])):
+        w(line + '\n')
+    w('};\n\n')
+
+    w('const Font_Data %s = {\n' % name)
+    w('    .Blob = %sBlob,\n' % name)
+    w('    .BlobSize = sizeof(%sBlob),\n' % name)
+    w('    .RamSize = %d,\n' % len(image))
+    w('    .Version = 0x%08X, //CRC-32 of the blob\n' % zlib.crc32(blob))
+    w('    .Ranges = %sRanges,\n' % name)
+    w('    .nRanges = %d,\n' % len(result['runs']))
+    w('    .Advances = %sAdvances,\n' % name)
+    w('    .nGlyphs = %d,\n' % len(result['advances']))
+    w('    .Fallback = %d,\n' % result['fallback'])
+    w('    .nPages = %d,\n' % result['pages'])
+    w('    .CellSize = %d,\n' % result['cellSize'])
+    w('    .Height = %d,\n' % result['height'])
+    w('    .Baseline = %d,\n' % result['baseline'])
+    w('};\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Build an EVE custom font for font.c')
+    parser.add_argument('ttf')
+    parser.add_argument('--size', type=int, default=28, help='em size in pixels')
+    parser.add_argument('--format', choices=sorted(FORMATS), default='L4')
+    parser.add_argument('--ranges', type=parseRanges, default=DEFAULT_RANGES,
+                        help='hex code point ranges, e.g. 20-7E,A0-FF')
+    parser.add_argument('--name', default='Font_sans')
+    parser.add_argument('-o', '--output', default='-')
+    args = parser.parse_args()
+
+    with open(args.ttf, 'rb') as f:
+        font = TrueType(f.read())
+    result = build(font, args.size, args.ranges, args.format)
+    blob = zlib.compress(result['image'], 9)
+
+    source = args.ttf.replace('\\', '/').split('/')[-1]
+    out = sys.stdout if args.output == '-' else open(args.output, 'w', newline='\n')
+    write(out, args.name, source, args.size, args.format, result, blob)
+    if out is not sys.stdout:
+        out.close()
+
+    sys.stderr.write('%s: %d glyphs, %d pages, %d bytes in RAM_G, %d bytes deflated\n'
+                     % (args.name, len(result['advances']), result['pages'], len(result['image']), len(blob)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,218 @@
+#!/usr/bin/env python3
+"""
+mksound.py
+
+Builds the alert tones for sound.c. Each tone is either synthesised from one
+of the presets below or read from a mono 16-bit WAV file, resampled to the
+playback rate, encoded as IMA ADPCM or u-law for the EVE's sample player and
+deflated for CMD_INFLATE. The tones are written as a C source file in the
+order given, which is the order of the tone numbers the app picks from.
+
+Usage:
+    tools/mksound.py chime bell pulse rise trill dingdong -o sound_data.c
+    tools/mksound.py chime custom=assets/custom.wav --format ulaw -o sound_data.c
+"""
+
+import argparse
+import math
+import struct
+import sys
+import wave
+import zlib
+
+FORMATS = {'ulaw': 1, 'adpcm': 2} #REG_PLAYBACK_FORMAT
+
+IMA_STEPS = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767,
+]
+IMA_INDEX = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def envelope(t, attack, decay):
+    return min(1.0, t / attack) * math.exp(-t / decay)
+
+
+def partials(freqs, gains, length, decay, rate):
+    return [sum(g * math.sin(2 * math.pi * f * i / rate) for f, g in zip(freqs, gains))
+            * envelope(i / rate, 0.005, decay) for i in range(int(length * rate))]
+
+
+def beeps(freq, count, on, off, rate):
+    out = []
+    for _ in range(count):
+        out += [math.sin(2 * math.pi * freq * i / rate) * min(1.0, i / (0.004 * rate), (on * rate - i) / (0.004 * rate))
+                for i in range(int(on * rate))]
+        out += [0.0] * int(off * rate)
+    return out
+
+
+def sweep(start, end, length, rate):
+    out, phase = [], 0.0
+    n = int(length * rate)
+    for i in range(n):
+        phase += 2 * math.pi * (start + (end - start) * i / n) / rate
+        out.append(math.sin(phase) * envelope(i / rate, 0.01, length) * min(1.0, (n - i) / (0.02 * rate)))
+    return out
+
+
+def trill(low, high, step, length, rate):
+    n, per = int(length * rate), int(step * rate)
+    return [math.sin(2 * math.pi * (low if (i // per) % 2 == 0 else high) * i / rate)
+            * min(1.0, (n - i) / (0.02 * rate)) for i in range(n)]
+
+
+#distinct shapes and pitches, so doses from different compartments sound different
+PRESETS = {
+    'chime': lambda rate: partials([880, 1320, 1760], [0.6, 0.3, 0.1], 0.8, 0.25, rate),
+    'bell': lambda rate: partials([660, 660 * 2.76, 660 * 5.4], [0.6, 0.3, 0.1], 0.9, 0.3, rate),
+    'pulse': lambda rate: beeps(1000, 3, 0.09, 0.07, rate),
+    'rise': lambda rate: sweep(500, 1200, 0.6, rate),
+    'trill': lambda rate: trill(1200, 1500, 0.05, 0.6, rate),
+    'dingdong': lambda rate: partials([740], [0.8], 0.4, 0.15, rate) + partials([587], [0.8], 0.5, 0.2, rate),
+}
+
+
+def readWav(path, rate):
+    with wave.open(path, 'rb') as f:
+        if f.getnchannels() != 1 or f.getsampwidth() != 2:
+            raise SystemExit('%s: only mono 16-bit WAV is supported' % path)
+        source = f.getframerate()
+        frames = f.readframes(f.getnframes())
+    pcm = [s / 32768.0 for s in struct.unpack('<%dh' % (len(frames) // 2), frames)]
+    #linear resampling is plenty for alert tones
+    n = int(len(pcm) * rate / source)
+    out = []
+    for i in range(n):
+        x = i * source / rate
+        j = int(x)
+        k = min(j + 1, len(pcm) - 1)
+        out.append(pcm[j] + (pcm[k] - pcm[j]) * (x - j))
+    return out
+
+
+def toPcm(samples):
+    peak = max(1e-9, max(abs(s) for s in samples))
+    return [max(-32767, min(32767, int(round(s / peak * 0.9 * 32767)))) for s in samples]
+
+
+def encodeAdpcm(pcm):
+    #predictor and step index start at 0, as the EVE resets them for every playback
+    predictor, index, out, nibbles = 0, 0, bytearray(), []
+    for sample in pcm:
+        step = IMA_STEPS[index]
+        diff = sample - predictor
+        code = 0
+        if diff < 0:
+            code = 8
+            diff = -diff
+        delta = step >> 3
+        if diff >= step:
+            code |= 4
+            diff -= step
+            delta += step
+        if diff >= step >> 1:
+            code |= 2
+            diff -= step >> 1
+            delta += step >> 1
+        if diff >= step >> 2:
+            code |= 1
+            delta += step >> 2
+        predictor = max(-32768, min(32767, predictor - delta if code & 8 else predictor + delta))
+        index = max(0, min(88, index + IMA_INDEX[code & 7]))
+        nibbles.append(code)
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    for i in range(0, len(nibbles), 2):
+        out.append(nibbles[i] | nibbles[i + 1] << 4) #first sample in the low nibble
+    return bytes(out)
+
+
+def encodeUlaw(pcm):
+    out = bytearray()
+    for sample in pcm:
+        sign = 0x80 if sample < 0 else 0
+        sample = min(32635, abs(sample)) + 0x84
+        exponent = 7
+        while exponent > 0 and not sample & (0x4000 >> (7 - exponent)):
+            exponent -= 1
+        mantissa = (sample >> (exponent + 3)) & 0x0F
+        out.append(~(sign | exponent << 4 | mantissa) & 0xFF)
+    return bytes(out)
+
+
+def hexLines(data, perLine=16):
+    for i in range(0, len(data), perLine):
+        yield ','.join('0x%x' % b for b in data[i:i + perLine]) + ','
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Build deflated EVE alert tones for sound.c')
+    parser.add_argument('tones', nargs='+', help='preset (one of %s) or name=path.wav' % ', '.join(sorted(PRESETS)))
+    parser.add_argument('--format', choices=sorted(FORMATS), default='adpcm')
+    parser.add_argument('--rate', type=int, default=8000, help='playback rate in Hz')
+    parser.add_argument('-o', '--output', default='-')
+    args = parser.parse_args()
+
+    results = []
+    for spec in args.tones:
+        name, _, path = spec.partition('=')
+        if path:
+            samples = readWav(path, args.rate)
+        elif name in PRESETS:
+            samples = PRESETS[name](args.rate)
+        else:
+            raise SystemExit('%s: not a preset, use name=path.wav for a file' % name)
+        pcm = toPcm(samples)
+        data = encodeAdpcm(pcm) if args.format == 'adpcm' else encodeUlaw(pcm)
+        data += bytes(-len(data) % 8) #playback start and length are 8 byte aligned
+        blob = zlib.compress(data, 9)
+        results.append((name, path or 'preset', len(pcm), data, blob))
+        sys.stderr.write('%-9s %5d ms, RAM_G %6d B, flash %6d B\n'
+                         % (name, len(pcm) * 1000 // args.rate, len(data), len(blob)))
+
+    out = sys.stdout if args.output == '-' else open(args.output, 'w', newline='\n')
+    w = out.write
+    w('/************************************************************\n')
+    w(' * Generated by tools/mksound.py, do not edit. Rerun the\n')
+    w(' * tool with the tone list instead.\n')
+    w(' *\n')
+    for i, (name, path, samples, data, blob) in enumerate(results):
+        w(' * %d %s: %s, %d ms %s at %d Hz, %d bytes in RAM_G, %d deflated\n'
+          % (i, name, path, samples * 1000 // args.rate, args.format, args.rate, len(data), len(blob)))
+    w(' ************************************************************/\n\n')
+    w('#include <stdint.h>\n\n#include "sound.h"\n')
+
+    for name, path, samples, data, blob in results:
+        symbol = 'Sound_' + name
+        w('\nstatic const uint8_t %sBlob[%d] = {\n' % (symbol, len(blob)))
+        for line in hexLines(blob):
+            w(line + '\n')
+        w('};\n\n')
+        w('static const Sound_Data %s = {\n' % symbol)
+        w('    .Blob = %sBlob,\n' % symbol)
+        w('    .BlobSize = sizeof(%sBlob),\n' % symbol)
+        w('    .RamSize = %d,\n' % len(data))
+        w('    .Version = 0x%08X, //CRC-32 of the blob\n' % zlib.crc32(blob))
+        w('    .Rate = %d,\n' % args.rate)
+        w('    .Format = %d, //%s\n' % (FORMATS[args.format], args.format.upper()))
+        w('};\n')
+
+    w('\nconst Sound_Data *const Sound_tones[%d] = {\n' % len(results))
+    for name, _, _, _, _ in results:
+        w('    &Sound_%s,\n' % name)
+    w('};\n\n')
+    w('const uint8_t Sound_nTones = %d;\n\n' % len(results))
+    w('_Static_assert(%d <= SOUND_MAX_TONES, "too many tones for sound.c");\n' % len(results))
+
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == '__main__':
+    main()
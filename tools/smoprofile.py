@@ -0,0 +1,332 @@
+#!/usr/bin/env python3
+"""
+smoprofile.py
+
+Drives the firmware's sampling profiler (profile.h) and turns its samples
+into a flame graph. The control command sends a profile request (type
+0x9D) to the device over UDP to start the profiler in UART or SWO mode,
+stop it, or just read it, and prints the CPU cycles each task has run
+since the profiler started.
+
+The load command sends a load request (type 0x9A) and prints the CPU load
+and, for each task, its share of the CPU since boot and the most stack it
+has used out of its size (load.h), with the size its peak plus --margin
+would round up to, for trimming TASK_STACK_SIZE and THREADSTACKSIZE.
+
+The flame command reads what was captured while it ran: the UART log with
+the profiler's @ lines mixed into the normal output (saved by any serial
+terminal), and/or the raw ITM byte stream the debug probe captured from
+the SWO pin. Each PC sample is looked up in the firmware's symbol table
+(arm-none-eabi-nm on the .out) and counted as task;function. The counts
+are written as folded stacks, which flamegraph.pl and speedscope read
+too, and drawn as a self-contained SVG flame graph. Samples are only of
+the PC, so each stack is the task and the function it was in, not the
+whole call chain.
+
+UART samples taken over another interrupt are counted as [interrupt]. SWO
+samples cover interrupts as well, and ones taken while the core slept in
+WFI are counted as [sleep]. The SWO stream only carries task ids, the
+names come from --tasks, which control --tasks writes.
+
+Usage:
+    tools/smoprofile.py control 192.168.1.40 --mode uart --rate 500
+    tools/smoprofile.py control 192.168.1.40 --mode off --tasks tasks.txt
+    tools/smoprofile.py load 192.168.1.40
+    tools/smoprofile.py flame --elf build-msp432/smo.out --uart putty.log -o profile.svg
+    tools/smoprofile.py flame --elf build-msp432/smo.out --swo swo.bin --tasks tasks.txt -o profile.svg
+"""
+
+import argparse
+import bisect
+import collections
+import html
+import re
+import socket
+import struct
+import subprocess
+import sys
+import zlib
+
+from smorecord import DATA_PORT, DEFAULT_KEY, decryptBlock, ecb, encryptBlock, expandKey
+
+PACKET_TYPE_LOAD = 0x9A
+PACKET_TYPE_PROFILE = 0x9D
+MODES = {'off': 0, 'uart': 1, 'swo': 2, 'query': 0xFF} #Profile_Mode, SMO_WIRE_PREQ_QUERY
+MODE_NAMES = {0: 'off', 1: 'uart', 2: 'swo'}
+RESPONSE_HEADER = struct.Struct('<BBBBHHII')
+TASK_RECORD = struct.Struct('<8sQ')
+LOAD_HEADER = struct.Struct('<BBBBHHIIII')
+LOAD_TASK_RECORD = struct.Struct('<8sQII')
+TASK_INTERRUPT = 255 #PROFILE_TASK_INTERRUPT
+ITM_TASK_PORT = 1 #PROFILE_ITM_PORT
+ITM_PC_SAMPLE = 2 #DWT hardware source id of PC samples
+
+LINE = re.compile(r'@([STPCE])((?: [0-9A-Za-z_\[\]]+)+)')
+
+def request(args, req):
+    """Send an encrypted request and wait for the response of the same type"""
+    key = bytes.fromhex(args.key) if args.key else DEFAULT_KEY
+    if len(key) != 32:
+        sys.exit('key must be 32 bytes')
+    rounds = expandKey(key)
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.settimeout(args.timeout)
+    addr = (socket.gethostbyname(args.host), args.port)
+    sock.sendto(ecb(rounds, req, encryptBlock), addr)
+    try:
+        while True:
+            data, src = sock.recvfrom(2048)
+            if src[0] != addr[0] or len(data) < 16 or len(data) % 16:
+                continue
+            rsp = ecb(rounds, data, decryptBlock)
+            if rsp[0] == req[0]:
+                return rsp
+    except socket.timeout:
+        sys.exit('no response from %s:%d' % addr)
+
+def taskName(name, task):
+    return name.rstrip(b'\0').decode('ascii', 'replace') or 'task%d' % task
+
+def control(args):
+    rsp = request(args, struct.pack('<BBH', PACKET_TYPE_PROFILE, MODES[args.mode], args.rate))
+    _, mode, ntasks, _, rate, _, samples, dropped = RESPONSE_HEADER.unpack_from(rsp)
+    if RESPONSE_HEADER.size + ntasks*TASK_RECORD.size > len(rsp):
+        sys.exit('response claims %d tasks but is %d bytes' % (ntasks, len(rsp)))
+    tasks = [TASK_RECORD.unpack_from(rsp, RESPONSE_HEADER.size + i*TASK_RECORD.size) for i in range(ntasks)]
+    names = [taskName(name, i) for i, (name, _) in enumerate(tasks)]
+
+    print('profiler %s' % MODE_NAMES.get(mode, mode) + (', %d samples/s' % rate if mode else ''))
+    if mode == MODES['uart'] or samples:
+        print('%d UART samples, %d dropped' % (samples, dropped))
+    total = sum(cycles for _, cycles in tasks)
+    for i, (name, (_, cycles)) in enumerate(zip(names, tasks)):
+        print('%3d %-8s %14d cycles %6.2f%%' % (i, name, cycles, 100.0*cycles/total if total else 0))
+
+    if args.tasks:
+        with open(args.tasks, 'w') as f:
+            for i, name in enumerate(names):
+                f.write('%d %s\n' % (i, name))
+
+def load(args):
+    rsp = request(args, bytes([PACKET_TYPE_LOAD]))
+    _, ntasks, idle, _, now, peak, ticks, cyclesPerTick, hwiSize, hwiPeak = LOAD_HEADER.unpack_from(rsp)
+    if LOAD_HEADER.size + ntasks*LOAD_TASK_RECORD.size > len(rsp):
+        sys.exit('response claims %d tasks but is %d bytes' % (ntasks, len(rsp)))
+    wall = ticks*cyclesPerTick or 1
+
+    def suggest(used):
+        size = used*(100 + args.margin)//100
+        return -(-size//args.align)*args.align
+
+    print('up %.1fs, load %.1f%%, peak %.1f%%' % (ticks/1024.0, now/10.0, peak/10.0))
+    print('%3s %-8s %7s %7s %7s %5s %7s' % ('id', 'task', 'cpu', 'used', 'size', '', 'suggest'))
+    print('%3s %-8s %7s %7d %7d %4d%% %7d' % ('', '[hwi]', '', hwiPeak, hwiSize,
+                                            100*hwiPeak//hwiSize if hwiSize else 0, suggest(hwiPeak)))
+    for i in range(ntasks):
+        name, cycles, size, used = LOAD_TASK_RECORD.unpack_from(rsp, LOAD_HEADER.size + i*LOAD_TASK_RECORD.size)
+        print('%3d %-8s %6.2f%% %7d %7d %4d%% %7s' % (i, taskName(name, i) + ('*' if i == idle else ''),
+                                                      100.0*cycles/wall, used, size, 100*used//size if size else 0,
+                                                      suggest(used) if size else '-'))
+    print('cpu is the share of wall time, * is the idle task, suggest is the peak plus %d%%' % args.margin)
+
+class Symbols:
+    """Function lookup by address, from nm -n -S"""
+
+    def __init__(self, elf, nm):
+        out = subprocess.run([nm, '-n', '-S', '--defined-only', elf], check=True,
+                             stdout=subprocess.PIPE, universal_newlines=True).stdout
+        self.starts, self.ends, self.names = [], [], []
+        for line in out.splitlines():
+            fields = line.split()
+            if len(fields) != 4 or fields[2] not in 'TtWw':
+                continue
+            #Thumb functions have bit 0 set, the sampled PC never does
+            start = int(fields[0], 16) & ~1
+            self.starts.append(start)
+            self.ends.append(start + int(fields[1], 16))
+            self.names.append(fields[3])
+
+    def lookup(self, pc):
+        i = bisect.bisect_right(self.starts, pc) - 1
+        if i >= 0 and pc < self.ends[i]:
+            return self.names[i]
+        return '0x%08x' % pc
+
+def readUart(path, samples, names, cycles):
+    with open(path, 'rb') as f:
+        text = f.read().decode('latin-1')
+    for kind, rest in LINE.findall(text):
+        fields = rest.split()
+        try:
+            if kind == 'T':
+                names[int(fields[0])] = fields[1]
+            elif kind == 'P':
+                task = int(fields[0])
+                for pc in fields[1:]:
+                    samples[task, int(pc, 16)] += 1
+            elif kind == 'C':
+                cycles[int(fields[0])] += int(fields[1], 16)
+            elif kind == 'E':
+                print('%s: stream of %s samples, %s dropped' % (path, fields[0], fields[1]), file=sys.stderr)
+        except (ValueError, IndexError):
+            #another thread's output landed inside the line
+            continue
+
+def readSwo(path, samples):
+    with open(path, 'rb') as f:
+        data = f.read()
+    task, i = None, 0
+    while i < len(data):
+        header = data[i]
+        i += 1
+        size = header & 3
+        if size == 0:
+            #sync, overflow, timestamp or extension, skip any continuation bytes
+            if header not in (0x00, 0x70, 0x80) and header & 0x80:
+                while i < len(data) and data[i] & 0x80:
+                    i += 1
+                i += 1
+            continue
+        size = 4 if size == 3 else size
+        payload = int.from_bytes(data[i:i + size], 'little')
+        i += size
+        if not header & 4 and header >> 3 == ITM_TASK_PORT:
+            task = payload & 0xFF
+        elif header & 4 and header >> 3 == ITM_PC_SAMPLE:
+            samples[task, payload if size == 4 else None] += 1
+
+def fold(samples, names, symbols):
+    stacks = collections.Counter()
+    for (task, pc), count in samples.items():
+        if task == TASK_INTERRUPT:
+            frames = ['[interrupt]']
+        else:
+            frames = ['?' if task is None else names.get(task, 'task%d' % task),
+                      '[sleep]' if pc is None else symbols.lookup(pc)]
+        stacks[';'.join(frames)] += count
+    return stacks
+
+def flameSvg(stacks, title, width=1200, rowHeight=17):
+    #tree of nodes, each [count, children]
+    root = [0, {}]
+    for stack, count in stacks.items():
+        root[0] += count
+        node = root
+        for frame in stack.split(';'):
+            node = node[1].setdefault(frame, [0, {}])
+            node[0] += count
+
+    def depth(node):
+        return 1 + max((depth(child) for child in node[1].values()), default=0)
+
+    rows = depth(root)
+    height = (rows + 2)*rowHeight
+    scale = (width - 20) / root[0] if root[0] else 0
+    out = ['<svg xmlns="http://www.w3.org/2000/svg" width="%d" height="%d" font-family="Verdana" font-size="11">'
+           % (width, height),
+           '<rect width="100%" height="100%" fill="#f8f8f8"/>',
+           '<text x="%d" y="14" text-anchor="middle" font-size="15">%s</text>' % (width//2, html.escape(title))]
+
+    def draw(name, node, x, level):
+        w = node[0]*scale
+        y = height - (level + 1)*rowHeight
+        hue = zlib.crc32(name.encode()) % 50
+        out.append('<g><title>%s (%d samples, %.2f%%)</title>'
+                   '<rect x="%.1f" y="%d" width="%.1f" height="%d" fill="rgb(%d,%d,%d)" rx="2"/>'
+                   % (html.escape(name), node[0], 100.0*node[0]/root[0], x, y, max(w - 0.5, 0.1), rowHeight - 1,
+                      205 + hue, 80 + 2*hue, 40 + hue))
+        chars = int(w / 7)
+        if chars >= 3:
+            label = name if len(name) <= chars else name[:chars - 2] + '..'
+            out.append('<text x="%.1f" y="%d">%s</text>' % (x + 3, y + rowHeight - 5, html.escape(label)))
+        out.append('</g>')
+        for child in sorted(node[1], key=lambda c: -node[1][c][0]):
+            draw(child, node[1][child], x, level + 1)
+            x += node[1][child][0]*scale
+
+    draw('all', root, 10, 0)
+    out.append('</svg>')
+    return '\n'.join(out) + '\n'
+
+def flame(args):
+    if not args.uart and not args.swo:
+        sys.exit('nothing to read, give --uart and/or --swo')
+    names, cycles = {}, collections.Counter()
+    samples = collections.Counter()
+    if args.tasks:
+        with open(args.tasks) as f:
+            for line in f:
+                fields = line.split()
+                if len(fields) == 2:
+                    names[int(fields[0])] = fields[1]
+    for path in args.uart:
+        readUart(path, samples, names, cycles)
+    for path in args.swo:
+        readSwo(path, samples)
+    if not samples:
+        sys.exit('no samples found')
+
+    stacks = fold(samples, names, Symbols(args.elf, args.nm))
+    total = sum(stacks.values())
+    if args.folded:
+        with open(args.folded, 'w') as f:
+            for stack, count in sorted(stacks.items()):
+                f.write('%s %d\n' % (stack, count))
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(flameSvg(stacks, args.title or '%s, %d samples' % (args.elf, total)))
+
+    print('%d samples' % total)
+    for stack, count in stacks.most_common(args.top):
+        print('%6.2f%% %7d  %s' % (100.0*count/total, count, stack.replace(';', ' ')))
+    if cycles:
+        allCycles = sum(cycles.values())
+        print('cycles per task:')
+        for task, count in sorted(cycles.items()):
+            print('%3d %-8s %14d %6.2f%%' % (task, names.get(task, 'task%d' % task), count, 100.0*count/allCycles))
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[1],
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest='command')
+    commands.required = True
+
+    ctl = commands.add_parser('control', help='start, stop or read the profiler over UDP')
+    ctl.add_argument('host', help='device address')
+    ctl.add_argument('--mode', choices=sorted(MODES), default='query')
+    ctl.add_argument('--rate', type=int, default=0, help='samples per second, 0 for the firmware default')
+    ctl.add_argument('--tasks', help='write the task ids and names here, for flame --tasks')
+    ctl.add_argument('--port', type=int, default=DATA_PORT)
+    ctl.add_argument('--key', help='AES-256 key as 64 hex digits, the firmware key by default')
+    ctl.add_argument('--timeout', type=float, default=2.0, help='seconds to wait for the response')
+    ctl.set_defaults(run=control)
+
+    ld = commands.add_parser('load', help='read CPU load and stack use over UDP')
+    ld.add_argument('host', help='device address')
+    ld.add_argument('--margin', type=int, default=25, help='percent added to each peak stack use')
+    ld.add_argument('--align', type=int, default=256, help='stack sizes are rounded up to this')
+    ld.add_argument('--port', type=int, default=DATA_PORT)
+    ld.add_argument('--key', help='AES-256 key as 64 hex digits, the firmware key by default')
+    ld.add_argument('--timeout', type=float, default=2.0, help='seconds to wait for the response')
+    ld.set_defaults(run=load)
+
+    fl = commands.add_parser('flame', help='symbolise captured samples into a flame graph')
+    fl.add_argument('--elf', required=True, help='firmware image the samples were taken from')
+    fl.add_argument('--nm', default='arm-none-eabi-nm', help='nm that reads the image')
+    fl.add_argument('--uart', action='append', default=[], help='UART log holding @ lines')
+    fl.add_argument('--swo', action='append', default=[], help='raw ITM stream captured from SWO')
+    fl.add_argument('--tasks', help='task ids and names, as written by control --tasks')
+    fl.add_argument('-o', '--output', help='flame graph SVG to write')
+    fl.add_argument('--folded', help='folded stacks to write')
+    fl.add_argument('--title', help='flame graph title')
+    fl.add_argument('--top', type=int, default=20, help='stacks to print')
+    fl.set_defaults(run=flame)
+
+    args = parser.parse_args()
+    if args.command == 'control' and not 0 <= args.rate <= 0xFFFF:
+        sys.exit('rate must fit 16 bits')
+    args.run(args)
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+"""
+smorecord.py
+
+Fetches the input recording from a device over UDP and saves it for
+host/replay.c. The device keeps its inputs (decrypted packets, RTC
+interrupt status, button edges and SNTP replies) in a RAM ring, see
+recorder.h, and answers recording requests (type 0x9C) on the data port
+with as many whole records as fit one packet. Requests are sent until the
+device reports nothing newer, so an export taken while the device runs is
+a consistent prefix of its inputs.
+
+Packets to and from the device are AES-256 encrypted with the key in
+get_time.c, one 16 byte block at a time. The cipher here is a plain
+Python implementation, which is slow but more than fast enough for a few
+kilobytes.
+
+The file written is "SMOR", the little endian cursor of the first record,
+then the records. A cursor other than 0 means the ring had already dropped
+the oldest inputs, so the replay will not start from boot.
+
+Usage:
+    tools/smorecord.py 192.168.1.40 -o field.smor
+    tools/smorecord.py 192.168.1.40 --key b385bb33...8447 -o field.smor
+"""
+
+import argparse
+import socket
+import struct
+import sys
+
+DATA_PORT = 5004 #get_time.h
+PACKET_TYPE_RECORDING = 0x9C
+EXPORT_MAX_BYTES = 1440 #RECORDER_EXPORT_MAX_BYTES
+RESPONSE_HEADER = struct.Struct('<BBHIII')
+
+DEFAULT_KEY = bytes([
+    0xB3, 0x85, 0xBB, 0x33, 0x0C, 0x98, 0xAA, 0x5D,
+    0xFA, 0x02, 0x6E, 0x2B, 0xE3, 0x78, 0xBA, 0x53,
+    0xAF, 0xDF, 0xAF, 0xBE, 0xA5, 0x05, 0x5D, 0x52,
+    0xC5, 0x5C, 0xCE, 0xCE, 0x6C, 0x1E, 0x84, 0x47,
+])
+
+def xtime(a):
+    a <<= 1
+    return a ^ 0x11B if a & 0x100 else a
+
+def gmul(a, b):
+    p = 0
+    while b:
+        if b & 1:
+            p ^= a
+        a = xtime(a)
+        b >>= 1
+    return p
+
+def makeSbox():
+    sbox = [0]*256
+    inv = [0]*256
+    for a in range(256):
+        #multiplicative inverse, then the affine transform
+        x = next((b for b in range(1, 256) if gmul(a, b) == 1), 0)
+        s = x
+        for i in range(1, 5):
+            s ^= ((x << i) | (x >> (8 - i))) & 0xFF
+        sbox[a] = s ^ 0x63
+        inv[sbox[a]] = a
+    return sbox, inv
+
+SBOX, INV_SBOX = makeSbox()
+
+def expandKey(key):
+    words = [list(key[i:i + 4]) for i in range(0, 32, 4)]
+    rcon = 1
+    for i in range(8, 60):
+        t = list(words[i - 1])
+        if i % 8 == 0:
+            t = [SBOX[b] for b in t[1:] + t[:1]]
+            t[0] ^= rcon
+            rcon = xtime(rcon)
+        elif i % 8 == 4:
+            t = [SBOX[b] for b in t]
+        words.append([a ^ b for a, b in zip(words[i - 8], t)])
+    return [sum(words[r*4:r*4 + 4], []) for r in range(15)]
+
+def shiftRows(s, inverse=False):
+    d = -1 if inverse else 1
+    return [s[(c + d*r) % 4*4 + r] for c in range(4) for r in range(4)]
+
+def mixColumns(s, m):
+    out = []
+    for c in range(4):
+        col = s[c*4:c*4 + 4]
+        out += [gmul(col[0], m[r][0]) ^ gmul(col[1], m[r][1]) ^ gmul(col[2], m[r][2]) ^ gmul(col[3], m[r][3])
+                for r in range(4)]
+    return out
+
+MIX = [[2, 3, 1, 1], [1, 2, 3, 1], [1, 1, 2, 3], [3, 1, 1, 2]]
+INV_MIX = [[14, 11, 13, 9], [9, 14, 11, 13], [13, 9, 14, 11], [11, 13, 9, 14]]
+
+def encryptBlock(rounds, block):
+    s = [a ^ b for a, b in zip(block, rounds[0])]
+    for r in range(1, 15):
+        s = shiftRows([SBOX[b] for b in s])
+        if r < 14:
+            s = mixColumns(s, MIX)
+        s = [a ^ b for a, b in zip(s, rounds[r])]
+    return bytes(s)
+
+def decryptBlock(rounds, block):
+    s = [a ^ b for a, b in zip(block, rounds[14])]
+    for r in range(13, -1, -1):
+        s = [INV_SBOX[b] for b in shiftRows(s, inverse=True)]
+        s = [a ^ b for a, b in zip(s, rounds[r])]
+        if r > 0:
+            s = mixColumns(s, INV_MIX)
+    return bytes(s)
+
+def ecb(rounds, data, block):
+    data += bytes(-len(data) % 16)
+    return b''.join(block(rounds, data[i:i + 16]) for i in range(0, len(data), 16))
+
+def fetch(sock, addr, rounds, cursor):
+    req = struct.pack('<BIH', PACKET_TYPE_RECORDING, cursor, EXPORT_MAX_BYTES)
+    sock.sendto(ecb(rounds, req, encryptBlock), addr)
+    while True:
+        data, src = sock.recvfrom(2048)
+        if src[0] != addr[0] or len(data) < 16 or len(data) % 16:
+            continue
+        rsp = ecb(rounds, data, decryptBlock)
+        if rsp[0] == PACKET_TYPE_RECORDING:
+            break
+
+    _, _, length, first, nxt, head = RESPONSE_HEADER.unpack_from(rsp)
+    if RESPONSE_HEADER.size + length > len(rsp):
+        raise ValueError('response claims %d bytes but holds %d' % (length, len(rsp) - RESPONSE_HEADER.size))
+    return first, nxt, head, rsp[RESPONSE_HEADER.size:RESPONSE_HEADER.size + length]
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[1],
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('host', help='device address')
+    parser.add_argument('-o', '--output', required=True, help='recording to write')
+    parser.add_argument('--port', type=int, default=DATA_PORT)
+    parser.add_argument('--key', help='AES-256 key as 64 hex digits, the firmware key by default')
+    parser.add_argument('--timeout', type=float, default=2.0, help='seconds to wait for each response')
+    args = parser.parse_args()
+
+    key = bytes.fromhex(args.key) if args.key else DEFAULT_KEY
+    if len(key) != 32:
+        sys.exit('key must be 32 bytes')
+    rounds = expandKey(key)
+    if encryptBlock(expandKey(bytes(range(32))), bytes.fromhex('00112233445566778899aabbccddeeff')).hex() \
+            != '8ea2b7ca516745bfeafc49904b496089':
+        sys.exit('AES self test failed')
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.settimeout(args.timeout)
+    addr = (socket.gethostbyname(args.host), args.port)
+
+    records = []
+    start = cursor = None
+    while True:
+        try:
+            first, nxt, head, chunk = fetch(sock, addr, rounds, 0 if cursor is None else cursor)
+        except socket.timeout:
+            sys.exit('no response from %s:%d' % addr)
+        if start is None:
+            start = first
+        elif first != cursor:
+            #the ring wrapped past us while fetching, what was read is still a prefix
+            print('inputs %d to %d were dropped during the export, stopping' % (cursor, first), file=sys.stderr)
+            break
+        records.append(chunk)
+        cursor = nxt
+        if cursor == head or not chunk:
+            break
+
+    data = b''.join(records)
+    with open(args.output, 'wb') as f:
+        f.write(b'SMOR' + struct.pack('<I', start) + data)
+    print('%s: %d bytes of inputs from cursor %d' % (args.output, len(data), start))
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""
+stackreport.py
+
+Reports the functions with the largest stack frames and the deepest call
+paths from the .su and .ci files GCC writes with -fstack-usage and
+-fcallgraph-info=su. The build runs it after every link, so a change that
+grows a thread's worst case stack shows up next to the size report.
+
+Frames marked dynamic or bounded use alloca or variable length arrays and
+are shown with a +. Calls through function pointers and into libraries
+built without the flags have no stack usage and count as zero, and a
+recursive call ends the path at the function it re-enters, so the depths
+are a lower bound. Set thread stacks with a margin on top.
+
+Usage:
+    tools/stackreport.py build/CMakeFiles/smo_sim.dir
+    tools/stackreport.py --top 20 -o smo.stack.txt build/CMakeFiles/smo.dir build/smo.ltrans
+"""
+
+import argparse
+import os
+import re
+import sys
+
+NODE = re.compile(r'node: \{ title: "([^"]*)" label: "([^"]*)"')
+EDGE = re.compile(r'edge: \{ sourcename: "([^"]*)" targetname: "([^"]*)"')
+
+
+def find(dirs, ext):
+    for top in dirs:
+        for root, _, files in os.walk(top):
+            for name in files:
+                if name.endswith(ext):
+                    yield os.path.join(root, name)
+
+
+def read_su(paths):
+    frames = {}
+    for path in paths:
+        with open(path) as f:
+            for line in f:
+                parts = line.rstrip('\n').split('\t')
+                if len(parts) != 3:
+                    continue
+                where, size, kind = parts
+                func = where.rsplit(':', 1)[-1]
+                frames[where] = (func, int(size), kind != 'static')
+    return frames
+
+
+def read_ci(paths):
+    nodes = {}
+    calls = {}
+    for path in paths:
+        with open(path) as f:
+            for line in f:
+                m = NODE.match(line)
+                if m:
+                    label = m.group(2).split('\\n')
+                    size = 0
+                    dynamic = False
+                    if len(label) > 2:
+                        size = int(label[2].split()[0])
+                        dynamic = 'static' not in label[2]
+                    #a defined function replaces an earlier external declaration
+                    if m.group(1) not in nodes or len(label) > 2:
+                        nodes[m.group(1)] = (label[0], size, dynamic, len(label) > 2)
+                    continue
+                m = EDGE.match(line)
+                if m:
+                    calls.setdefault(m.group(1), set()).add(m.group(2))
+    return nodes, calls
+
+
+def deepest(nodes, calls):
+    memo = {}
+
+    def walk(title, active):
+        if title in memo:
+            return memo[title]
+        _, size, dynamic, _ = nodes.get(title, (title, 0, False, False))
+        best = (0, [], False)
+        active.add(title)
+        for callee in sorted(calls.get(title, ())):
+            if callee in active:
+                continue
+            depth = walk(callee, active)
+            if depth[0] > best[0]:
+                best = depth
+        active.discard(title)
+        result = (size + best[0], [title] + best[1], dynamic or best[2])
+        memo[title] = result
+        return result
+
+    called = set()
+    for targets in calls.values():
+        called |= targets
+    roots = [t for t, n in nodes.items() if n[3] and t not in called]
+    return sorted((walk(t, set()) for t in roots), key=lambda p: -p[0])
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Largest stack frames and deepest call paths')
+    parser.add_argument('dirs', nargs='+', help='directories searched for .su and .ci files')
+    parser.add_argument('--top', type=int, default=10)
+    parser.add_argument('-o', '--output', help='also write the report to this file')
+    args = parser.parse_args()
+
+    dirs = [d for d in args.dirs if os.path.isdir(d)]
+    frames = read_su(find(dirs, '.su'))
+    nodes, calls = read_ci(find(dirs, '.ci'))
+
+    lines = ['%-40s %8s' % ('function', 'frame')]
+    for where, (func, size, dynamic) in sorted(frames.items(), key=lambda f: -f[1][1])[:args.top]:
+        lines.append('%-40s %7d%s  %s' % (func, size, '+' if dynamic else ' ', where.rsplit(':', 3)[0]))
+
+    if nodes:
+        lines.append('')
+        lines.append('%-40s %8s' % ('call path', 'stack'))
+        for size, path, dynamic in deepest(nodes, calls)[:args.top]:
+            names = [nodes[t][0] if t in nodes else t for t in path]
+            lines.append('%-40s %7d%s  %s' % (names[0], size, '+' if dynamic else ' ', ' > '.join(names[1:])))
+
+    if not frames:
+        lines = ['no stack usage found in ' + ' '.join(args.dirs)]
+
+    report = '\n'.join(lines) + '\n'
+    sys.stdout.write(report)
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(report)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,123 @@
+#include <string.h>
+
+#include <ti/devices/msp432p4xx/driverlib/driverlib.h>
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/hal/Hwi.h>
+
+#include "touch.h"
+#include "EVE.h"
+#include "peripherals.h"
+#include "power.h"
+#include "timer_wheel.h"
+#include "uart_term.h"
+
+typedef struct Touch_Control
+{
+    Touch_Callback Callback;
+    Hwi_Handle Hwi;
+    volatile uint32_t IrqTime; //tick of the last interrupt
+    uint8_t Tag; //tag currently touched
+    Touch_Stats Stats;
+
+} Touch_Control;
+
+static Touch_Control Touch_Ctrl;
+
+static void Touch_isr(uintptr_t Arg);
+
+void Touch_init(Touch_Callback Callback)
+{
+    Hwi_Params HwiParams;
+
+    memset(&Touch_Ctrl, 0, sizeof(Touch_Ctrl));
+    Touch_Ctrl.Callback = Callback;
+
+    //INT_N is held low until REG_INT_FLAGS is read
+    MAP_GPIO_setAsInputPinWithPullUpResistor(TOUCH_INT_PORT, TOUCH_INT_PIN);
+    MAP_GPIO_interruptEdgeSelect(TOUCH_INT_PORT, TOUCH_INT_PIN, GPIO_HIGH_TO_LOW_TRANSITION);
+    MAP_GPIO_clearInterruptFlag(TOUCH_INT_PORT, TOUCH_INT_PIN);
+    MAP_GPIO_enableInterrupt(TOUCH_INT_PORT, TOUCH_INT_PIN);
+    MAP_Interrupt_enableInterrupt(TOUCH_INT);
+
+    Hwi_Params_init(&HwiParams);
+    HwiParams.priority = 0x41;
+
+    Touch_Ctrl.Hwi = Hwi_create(TOUCH_INT, Touch_isr, &HwiParams, NULL);
+    if (Touch_Ctrl.Hwi == NULL)
+    {
+        UART_PRINT("Error creating touch interrupt\r\n");
+        while (1);
+    }
+}
+
+/*
+ * Have the EVE interrupt on tag changes only, so touches outside
+ * tagged widgets and moves within one don't wake the MCU
+ */
+void Touch_start(void)
+{
+    EVE_write8(REG_TOUCH_MODE + RAM_REG, TOUCHMODE_CONTINUOUS);
+    EVE_write8(REG_INT_MASK + RAM_REG, INT_TAG);
+    EVE_read8(REG_INT_FLAGS + RAM_REG);
+    EVE_write8(REG_INT_EN + RAM_REG, 1);
+}
+
+/*
+ * Clear the EVE interrupt and return the tag if a new one was
+ * pressed. Releases and slides back to the same tag are ignored.
+ */
+uint8_t Touch_read(void)
+{
+    uint8_t Tag;
+
+    EVE_read8(REG_INT_FLAGS + RAM_REG);
+    Tag = EVE_read8(REG_TOUCH_TAG + RAM_REG);
+    if (Tag == Touch_Ctrl.Tag)
+    {
+        return TOUCH_TAG_NONE;
+    }
+
+    Touch_Ctrl.Tag = Tag;
+    if (Tag != TOUCH_TAG_NONE)
+    {
+        Touch_Ctrl.Stats.Presses++;
+    }
+    return Tag;
+}
+
+/*
+ * Run the callback for a tag from Touch_read, outside any lock
+ * the caller held for the SPI bus
+ */
+void Touch_dispatch(uint8_t Tag)
+{
+    if (Tag != TOUCH_TAG_NONE && Touch_Ctrl.Callback != NULL)
+    {
+        Touch_Ctrl.Callback(Tag, Touch_Ctrl.IrqTime);
+    }
+}
+
+void Touch_getStats(Touch_Stats *Stats)
+{
+    memcpy(Stats, &Touch_Ctrl.Stats, sizeof(Touch_Stats));
+}
+
+/*
+ * Interrupt handler for EVE INT_N, only records the time
+ */
+static void Touch_isr(uintptr_t Arg)
+{
+    uint32_t Status;
+
+    Status = MAP_GPIO_getEnabledInterruptStatus(TOUCH_INT_PORT);
+    if (Status & TOUCH_INT_PIN)
+    {
+        MAP_GPIO_clearInterruptFlag(TOUCH_INT_PORT, TOUCH_INT_PIN);
+        Touch_Ctrl.IrqTime = TimerWheel_now();
+        Touch_Ctrl.Stats.Interrupts++;
+
+        //touching the screen counts as activity, like the button
+        SMO_Power_activity();
+        Screen_touched();
+    }
+}
@@ -0,0 +1,45 @@
+/************************************************************
+ * touch.h
+ *
+ * Touch input through the EVE3 touch engine. Touchable
+ * widgets are drawn with a tag, the EVE hit-tests every
+ * touch against the tag buffer itself, and its INT line
+ * interrupts the MCU only when the touched tag changes.
+ * The port interrupt just timestamps the change and wakes
+ * the screen owner, which reads REG_TOUCH_TAG over SPI, and
+ * new presses are passed to a callback.
+ *
+ ************************************************************/
+
+#ifndef TOUCH_H
+#define TOUCH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TOUCH_INT_PORT          GPIO_PORT_P4 //EVE INT_N, open drain, active low
+#define TOUCH_INT_PIN           GPIO_PIN6
+#define TOUCH_INT               INT_PORT4
+
+#define TOUCH_TAG_NONE          0
+#define TOUCH_TAG_COMPARTMENT   1 //1 to 6 for compartments A to F
+#define TOUCH_TAG_SNOOZE        16
+#define TOUCH_TAG_UPCOMING      17
+
+typedef struct Touch_Stats
+{
+    uint32_t Interrupts; //INT_N falling edges
+    uint32_t Presses; //changes to a tag other than TOUCH_TAG_NONE
+
+} Touch_Stats;
+
+//called from the screen owner's thread, PressTime is the timer wheel tick of the interrupt
+typedef void (*Touch_Callback)(uint8_t Tag, uint32_t PressTime);
+
+void Touch_init(Touch_Callback Callback);
+void Touch_start(void); //configure the EVE side, needs the SPI bus
+uint8_t Touch_read(void); //newly pressed tag or TOUCH_TAG_NONE, needs the SPI bus
+void Touch_dispatch(uint8_t Tag);
+void Touch_getStats(Touch_Stats *Stats);
+
+#endif
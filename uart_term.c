@@ -4,7 +4,6 @@
 
 // Standard includes
 #include <stdarg.h>
-#include <stdlib.h>
 #include <string.h>
 
 #include "pthread.h"
@@ -17,6 +16,8 @@ extern int vsnprintf (char * s, size_t n, const char * format, va_list arg );
 //                          LOCAL DEFINES
 //*****************************************************************************
 #define IS_SPACE(x)       (x == 32 ? 1 : 0)
+#define REPORT_BUF_SIZE   256 //longest line Report prints, on the caller's stack
+#define REPORT_TRUNCATED  "...\r\n"
 
 //*****************************************************************************
 //                 GLOBAL VARIABLES
@@ -74,43 +75,22 @@ UART_Handle InitTerm(void)
 int Report(const char *pcFormat, ...)
 {
     int     iRet = 0;
-    char        *pcBuff;
-    char        *pcTemp;
-    int         iSize = 256;
+    char        pcBuff[REPORT_BUF_SIZE];
     va_list     list;
 
-
-    pcBuff = (char*)malloc(iSize);
-    if(pcBuff == NULL)
+    // Longer lines are cut short rather than taking memory from the heap
+    va_start(list,pcFormat);
+    iRet = vsnprintf(pcBuff, sizeof(pcBuff), pcFormat, list);
+    va_end(list);
+    if(iRet < 0)
     {
-        return -1;
+        return iRet;
     }
-    while(1)
+    if((size_t) iRet >= sizeof(pcBuff))
     {
-        va_start(list,pcFormat);
-        iRet = vsnprintf(pcBuff, iSize, pcFormat, list);
-        va_end(list);
-        if((iRet > -1) && (iRet < iSize))
-        {
-            break;
-        }
-        else
-        {
-            iSize *= 2;
-            if((pcTemp = realloc(pcBuff, iSize)) == NULL)
-            {
-                Message("Could not reallocate memory\n\r");
-                iRet = -1;
-                break;
-            }
-            else
-            {
-                pcBuff = pcTemp;
-            }
-        }
+        strcpy(&pcBuff[sizeof(pcBuff) - sizeof(REPORT_TRUNCATED)], REPORT_TRUNCATED);
     }
     Message(pcBuff);
-    free(pcBuff);
 
     return iRet;
 }